@@ -0,0 +1,311 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#include "batch.h"
+#include "bitboard.h"
+#include "board.h"
+#include "endgame.h"
+#include "evaluate.h"
+#include "move.h"
+#include "pawns.h"
+
+static const Piece PIECES[6] = {PAWN, KNIGHT, BISHOP, ROOK, QUEEN, KING};
+
+BoardBatch* batch_alloc(int capacity) {
+    BoardBatch* batch = (BoardBatch*) malloc(sizeof(BoardBatch));
+    batch->size = 0;
+    batch->capacity = (capacity + BATCH_WIDTH - 1) / BATCH_WIDTH * BATCH_WIDTH;
+    for (int color = 0; color < 2; color++) {
+        for (int piece = 0; piece < 7; piece++) {
+            batch->pieces[color][piece] = calloc(batch->capacity, sizeof(Bitboard));
+        }
+    }
+    batch->material = calloc(batch->capacity, sizeof(int32_t));
+    batch->middle_game = calloc(batch->capacity, sizeof(int32_t));
+    batch->end_game = calloc(batch->capacity, sizeof(int32_t));
+    batch->phase = calloc(batch->capacity, sizeof(uint8_t));
+    batch->active_color = calloc(batch->capacity, sizeof(uint8_t));
+    return batch;
+}
+
+void batch_free(BoardBatch* batch) {
+    for (int color = 0; color < 2; color++) {
+        for (int piece = 0; piece < 7; piece++) {
+            free(batch->pieces[color][piece]);
+        }
+    }
+    free(batch->material);
+    free(batch->middle_game);
+    free(batch->end_game);
+    free(batch->phase);
+    free(batch->active_color);
+    free(batch);
+}
+
+void batch_clear(BoardBatch* batch) {
+    batch->size = 0;
+}
+
+// Puts the pieces of a position back into the state bitboards of a board, which is all
+// gen_attack_info looks at.
+static void load_state(BoardBatch* batch, int i, Board* board) {
+    board->state[WHITE] = board->state[BLACK] = 0;
+    for (int p = 0; p < 6; p++) {
+        Bitboard white = batch->pieces[0][PIECES[p]][i];
+        Bitboard black = batch->pieces[1][PIECES[p]][i];
+        board->state[PIECES[p]] = white | black;
+        board->state[WHITE] |= white;
+        board->state[BLACK] |= black;
+    }
+    board->active_color = batch->active_color[i];
+}
+
+bool batch_add(BoardBatch* batch, Board* board) {
+    if (batch->size == batch->capacity) return false;
+    for (int i = 0; i < 6; i++) {
+        batch->pieces[0][PIECES[i]][batch->size] = get_pieces(board, PIECES[i], WHITE);
+        batch->pieces[1][PIECES[i]][batch->size] = get_pieces(board, PIECES[i], BLACK);
+    }
+    batch->material[batch->size] = board->material[WHITE & 1] - board->material[BLACK & 1];
+    batch->middle_game[batch->size] = board->middle_game[WHITE & 1] - board->middle_game[BLACK & 1];
+    batch->end_game[batch->size] = board->end_game[WHITE & 1] - board->end_game[BLACK & 1];
+    batch->phase[batch->size] = board->phase;
+    batch->active_color[batch->size++] = board->active_color;
+    return true;
+}
+
+#if defined(__AVX2__)
+
+// Every vector holds one 64 bit lane per position. Counts and scores are small, so 32 bit multiplies
+// of the lanes are exact.
+typedef __m256i Vec;
+
+#define SET(x) _mm256_set1_epi64x(x)
+#define ZERO _mm256_setzero_si256()
+#define AND(a, b) _mm256_and_si256(a, b)
+#define OR(a, b) _mm256_or_si256(a, b)
+#define ANDNOT(a, b) _mm256_andnot_si256(b, a) // a & ~b
+#define ADD(a, b) _mm256_add_epi64(a, b)
+#define SUB(a, b) _mm256_sub_epi64(a, b)
+#define MUL(a, x) _mm256_mul_epi32(a, SET(x))
+
+INLINE Vec popcount(Vec v) {
+    const Vec lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const Vec nibble = _mm256_set1_epi8(0x0f);
+    Vec low = _mm256_shuffle_epi8(lookup, AND(v, nibble));
+    Vec high = _mm256_shuffle_epi8(lookup, AND(_mm256_srli_epi16(v, 4), nibble));
+    return _mm256_sad_epu8(_mm256_add_epi8(low, high), ZERO);
+}
+
+INLINE Vec abs64(Vec v) {
+    Vec negative = _mm256_cmpgt_epi64(ZERO, v);
+    return SUB(_mm256_xor_si256(v, negative), negative);
+}
+
+// Index of the lowest set bit, 64 in empty lanes.
+INLINE Vec lsb(Vec v) {
+    return popcount(SUB(AND(v, SUB(ZERO, v)), SET(1)));
+}
+
+INLINE Vec nonzero(Vec v) {
+    return _mm256_xor_si256(_mm256_cmpeq_epi64(v, ZERO), SET(-1));
+}
+
+// Looks up table[index] in the lanes where mask is set and returns 0 in the others.
+INLINE Vec gather(const int* table, Vec index, Vec mask) {
+    __m128i mask32 = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(mask, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+    return _mm256_cvtepi32_epi64(_mm256_mask_i64gather_epi32(_mm_setzero_si128(), table, index, mask32, 4));
+}
+
+// Sums the passed pawn bonuses of every pawn, by its rank counted from the owner's side.
+INLINE void passed_sum(Vec passed, int color, Vec* middle_game, Vec* end_game) {
+    while (!_mm256_testz_si256(passed, passed)) {
+        Vec rank = _mm256_srli_epi64(lsb(passed), 3);
+        if (color == 1) rank = SUB(SET(7), rank);
+        Vec mask = nonzero(passed);
+        *middle_game = ADD(*middle_game, gather(PASSED_PAWN_MIDDLE_GAME, rank, mask));
+        *end_game = ADD(*end_game, gather(PASSED_PAWN_END_GAME, rank, mask));
+        passed = AND(passed, SUB(passed, SET(1)));
+    }
+}
+
+INLINE Vec vec_north_fill(Vec v) {
+    v = OR(v, _mm256_slli_epi64(v, 8));
+    v = OR(v, _mm256_slli_epi64(v, 16));
+    return OR(v, _mm256_slli_epi64(v, 32));
+}
+
+INLINE Vec vec_south_fill(Vec v) {
+    v = OR(v, _mm256_srli_epi64(v, 8));
+    v = OR(v, _mm256_srli_epi64(v, 16));
+    return OR(v, _mm256_srli_epi64(v, 32));
+}
+
+INLINE Vec vec_file_set(Vec v) {
+    return AND(vec_south_fill(v), SET(RANK1));
+}
+
+INLINE Vec vec_forward(Vec v, int color) {
+    return color == 0 ? _mm256_slli_epi64(v, 8) : _mm256_srli_epi64(v, 8);
+}
+
+INLINE Vec vec_forward_fill(Vec v, int color) {
+    return color == 0 ? vec_north_fill(v) : vec_south_fill(v);
+}
+
+INLINE Vec vec_shift_west(Vec v) {
+    return ANDNOT(_mm256_slli_epi64(v, 1), SET(FILEH));
+}
+
+INLINE Vec vec_shift_east(Vec v) {
+    return ANDNOT(_mm256_srli_epi64(v, 1), SET(FILEA));
+}
+
+// Same terms as pawn_structure in pawns.c.
+INLINE void pawn_terms(Vec pawns, Vec enemy_pawns, int color, Vec* middle_game, Vec* end_game, Vec* files) {
+    const int enemy = color ^ 1;
+
+    Vec attacks = vec_forward(OR(vec_shift_west(pawns), vec_shift_east(pawns)), color);
+    Vec enemy_attacks = vec_forward(OR(vec_shift_west(enemy_pawns), vec_shift_east(enemy_pawns)), enemy);
+    Vec enemy_spans = vec_forward_fill(vec_forward(OR(enemy_pawns, OR(vec_shift_west(enemy_pawns), vec_shift_east(enemy_pawns))), enemy), enemy);
+    Vec open = ANDNOT(pawns, vec_forward_fill(vec_forward(enemy_pawns, enemy), enemy));
+
+    Vec passed = ANDNOT(pawns, enemy_spans);
+    *files = vec_file_set(pawns);
+
+    Vec support = vec_forward_fill(OR(vec_shift_west(pawns), vec_shift_east(pawns)), color);
+    Vec backward = vec_forward(ANDNOT(AND(vec_forward(pawns, color), enemy_attacks), support), enemy);
+    Vec connected = AND(pawns, OR(attacks, OR(vec_shift_west(pawns), vec_shift_east(pawns))));
+    Vec candidates = ANDNOT(ANDNOT(open, passed), backward);
+
+    Vec stacked = ZERO;
+    Vec isolated = ZERO;
+    for (int i = 0; i < 8; i++) {
+        Vec count = popcount(AND(pawns, SET(FILEH << i)));
+        stacked = SUB(stacked, _mm256_cmpgt_epi64(count, SET(1)));
+        Vec alone = _mm256_cmpeq_epi64(AND(*files, SET(0b101 << i >> 1)), ZERO);
+        isolated = ADD(isolated, AND(count, alone));
+    }
+
+    Vec score = ZERO;
+    score = SUB(score, MUL(stacked, STACKED_PAWN_PENALTY));
+    score = SUB(score, MUL(isolated, ISOLATED_PAWN_PENALTY));
+    score = SUB(score, MUL(popcount(backward), BACKWARD_PAWN_PENALTY));
+    score = ADD(score, MUL(popcount(connected), CONNECTED_PAWN_BONUS));
+    score = ADD(score, MUL(popcount(candidates), CANDIDATE_PAWN_BONUS));
+
+    *middle_game = score;
+    *end_game = score;
+    passed_sum(passed, color, middle_game, end_game);
+}
+
+// Evaluates BATCH_WIDTH positions starting at index i. Every term is computed for white and black
+// and only the differences are combined, from the side to move's point of view, in scalar code.
+static void evaluate_block(BoardBatch* batch, int i, int* scores) {
+    Vec bishop_pair[2], pawn_middle_game[2], pawn_end_game[2], pawn_files[2], rooks[2], king_safety[2], all[2], king[2];
+
+    for (int color = 0; color < 2; color++) {
+        all[color] = ZERO;
+        for (int p = 0; p < 6; p++) {
+            all[color] = OR(all[color], _mm256_loadu_si256((const Vec*) &batch->pieces[color][PIECES[p]][i]));
+        }
+
+        // If the player still has both of their bishops, they get a bonus.
+        Vec bishops = popcount(_mm256_loadu_si256((const Vec*) &batch->pieces[color][BISHOP][i]));
+        bishop_pair[color] = AND(_mm256_cmpeq_epi64(bishops, SET(2)), SET(BISHOP_VALUE / 2));
+    }
+
+    for (int color = 0; color < 2; color++) {
+        Vec pawns = _mm256_loadu_si256((const Vec*) &batch->pieces[color][PAWN][i]);
+        Vec enemy_pawns = _mm256_loadu_si256((const Vec*) &batch->pieces[color ^ 1][PAWN][i]);
+        pawn_terms(pawns, enemy_pawns, color, &pawn_middle_game[color], &pawn_end_game[color], &pawn_files[color]);
+    }
+
+    for (int color = 0; color < 2; color++) {
+        Vec rook_files = vec_file_set(_mm256_loadu_si256((const Vec*) &batch->pieces[color][ROOK][i]));
+        Vec half_open = ANDNOT(SET(RANK1), pawn_files[color]);
+        Vec open = ANDNOT(half_open, pawn_files[color ^ 1]);
+        rooks[color] = ADD(MUL(popcount(AND(rook_files, open)), ROOK_OPEN_FILE_BONUS),
+                           MUL(popcount(ANDNOT(AND(rook_files, half_open), open)), ROOK_HALF_OPEN_FILE_BONUS));
+
+        Vec kings = _mm256_loadu_si256((const Vec*) &batch->pieces[color][KING][i]);
+        king[color] = lsb(kings);
+        Vec quadrant = _mm256_mask_i64gather_epi64(ZERO, (const long long*) QUADRANT, king[color], nonzero(kings), 8);
+        Vec qdiff = SUB(popcount(AND(quadrant, all[color])), popcount(AND(quadrant, all[color ^ 1])));
+        king_safety[color] = MUL(qdiff, KING_QUADRANT_BONUS);
+    }
+
+    // mop_up_eval is the same for both sides: the rank distance is |(enemy - ours) / 8| rounded
+    // towards zero, which is |enemy - ours| / 8 rounded down.
+    Vec rank_distance = _mm256_srli_epi64(abs64(SUB(king[1], king[0])), 3);
+    Vec file_distance = abs64(SUB(AND(king[1], SET(7)), AND(king[0], SET(7))));
+    Vec mop_up = MUL(SUB(SET(14), ADD(rank_distance, file_distance)), KING_DISTANCE_BONUS);
+
+    int64_t terms[6][BATCH_WIDTH];
+    _mm256_storeu_si256((Vec*) terms[0], SUB(bishop_pair[0], bishop_pair[1]));
+    _mm256_storeu_si256((Vec*) terms[1], SUB(rooks[0], rooks[1]));
+    _mm256_storeu_si256((Vec*) terms[2], SUB(king_safety[0], king_safety[1]));
+    _mm256_storeu_si256((Vec*) terms[3], SUB(pawn_middle_game[0], pawn_middle_game[1]));
+    _mm256_storeu_si256((Vec*) terms[4], SUB(pawn_end_game[0], pawn_end_game[1]));
+    _mm256_storeu_si256((Vec*) terms[5], mop_up);
+
+    for (int j = 0; j < BATCH_WIDTH && i + j < batch->size; j++) {
+        int k = i + j;
+        int sign = batch->active_color[k] == WHITE ? 1 : -1;
+
+        // Mobility and king attacks need the sliding attacks from the magic tables, which are
+        // looked up one position at a time.
+        Board board;
+        AttackInfo info;
+        load_state(batch, k, &board);
+        gen_attack_info(&board, &info);
+        int mobility = mobility_eval(&board, &info, WHITE) - mobility_eval(&board, &info, BLACK);
+        int king_attacks = king_attack_eval(&board, &info, WHITE) - king_attack_eval(&board, &info, BLACK);
+
+        int phase = batch->phase[k] < MAX_PHASE ? batch->phase[k] : MAX_PHASE;
+        int middle_game = sign * (batch->middle_game[k] * DEVELOPMENT_BONUS + terms[3][j] + king_attacks);
+        int end_game = sign * (batch->end_game[k] * DEVELOPMENT_BONUS + terms[4][j]) + terms[5][j];
+
+        int score = 0;
+        score += sign * (batch->material[k] + terms[0][j]);
+        score += sign * terms[1][j];
+        score += KING_SAFETY_BONUS * sign * terms[2][j];
+        score += sign * mobility;
+        score += (middle_game * phase + end_game * (MAX_PHASE - phase)) / MAX_PHASE;
+        scores[k] = sign * score * endgame_scale(&board) / SCALE_NORMAL;
+    }
+}
+
+void batch_evaluate(BoardBatch* batch, int* scores) {
+    for (int i = 0; i < batch->size; i += BATCH_WIDTH) {
+        evaluate_block(batch, i, scores);
+    }
+}
+
+#else
+
+// Without AVX2 each position is put back into a Board and evaluated on its own.
+void batch_evaluate(BoardBatch* batch, int* scores) {
+    for (int i = 0; i < batch->size; i++) {
+        Board board;
+        board_clear(&board);
+        for (int p = 0; p < 6; p++) {
+            for (int color = 0; color < 2; color++) {
+                Bitboard bits = batch->pieces[color][PIECES[p]][i];
+                while (bits != 0) {
+                    add_piece(&board, PIECES[p], color == 0 ? WHITE : BLACK, LSB(bits));
+                    bits &= bits - 1;
+                }
+            }
+        }
+        board.active_color = batch->active_color[i];
+        AttackInfo info;
+        gen_attack_info(&board, &info);
+        scores[i] = evaluate_classical(&board, &info) * endgame_scale(&board) / SCALE_NORMAL;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,36 @@
+#ifndef BATCH_H_
+#define BATCH_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bitboard.h"
+#include "board.h"
+
+// Positions stored as structure of arrays for evaluating many positions at once. Each bitboard of a
+// piece type and color has its own array over all positions, so consecutive positions sit next to
+// each other in vector registers. The material and piece square sums the board keeps up to date are
+// copied as white minus black instead of being recomputed from the bitboards.
+typedef struct {
+    int size;
+    int capacity; // Always a multiple of BATCH_WIDTH.
+    Bitboard* pieces[2][7]; // Indexed by color & 1, then piece type.
+    int32_t* material;
+    int32_t* middle_game;
+    int32_t* end_game;
+    uint8_t* phase;
+    uint8_t* active_color;
+} BoardBatch;
+
+// Number of positions evaluated together.
+#define BATCH_WIDTH 4
+
+BoardBatch* batch_alloc(int capacity);
+void batch_free(BoardBatch* batch);
+void batch_clear(BoardBatch* batch);
+bool batch_add(BoardBatch* batch, Board* board);
+
+// Computes the classical evaluation of every position, exactly as evaluate does with the neural
+// evaluator disabled.
+void batch_evaluate(BoardBatch* batch, int* scores);
+
+#endif
\ No newline at end of file
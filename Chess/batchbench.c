@@ -0,0 +1,77 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "batch.h"
+#include "board.h"
+#include "move.h"
+#include "evaluate.h"
+
+// Compares batch_evaluate against evaluate on positions from random games and measures
+// the throughput of both: batchbench.exe [positions] [rounds]
+
+static uint64_t seed = 0x2545f4914f6cdd1dULL;
+
+static uint64_t next_random() {
+    seed ^= seed >> 12;
+    seed ^= seed << 25;
+    seed ^= seed >> 27;
+    return seed * 0x2545f4914f6cdd1dULL;
+}
+
+int main(int argc, char* args[]) {
+    init_magic_tables();
+    int n = argc > 1 ? atoi(args[1]) : 100000;
+    int rounds = argc > 2 ? atoi(args[2]) : 20;
+
+    Board* boards = malloc(n * sizeof(Board));
+    BoardBatch* batch = batch_alloc(n);
+    int* expected = malloc(n * sizeof(int));
+    int* scores = malloc(n * sizeof(int));
+
+    Board board;
+    board_from_fen(&board, "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+    for (int i = 0, ply = 0; i < n; ply++) {
+        Move moves[MAX_MOVES];
+        int n_moves = gen_moves(&board, moves);
+        if (n_moves == 0 || ply == 200) {
+            board_from_fen(&board, "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+            ply = 0;
+            continue;
+        }
+        make_move(&board, &moves[next_random() % n_moves]);
+        boards[i] = board;
+        batch_add(batch, &boards[i++]);
+    }
+
+    clock_t start = clock();
+    int64_t sum = 0;
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < n; i++) {
+            AttackInfo info;
+            gen_attack_info(&boards[i], &info);
+            sum += expected[i] = evaluate(&boards[i], &info);
+        }
+    }
+    double scalar = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (int r = 0; r < rounds; r++) {
+        batch_evaluate(batch, scores);
+        for (int i = 0; i < n; i++) sum -= scores[i];
+    }
+    double batched = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    int mismatches = 0;
+    for (int i = 0; i < n; i++) mismatches += scores[i] != expected[i];
+
+    printf("%d positions, %d mismatches, checksum %lld\n", n, mismatches, (long long) sum);
+    printf("evaluate: %.0f positions/s\n", n * rounds / scalar);
+    printf("batch_evaluate: %.0f positions/s\n", n * rounds / batched);
+
+    batch_free(batch);
+    free(boards);
+    free(expected);
+    free(scores);
+    return mismatches != 0;
+}
\ No newline at end of file
@@ -9,6 +9,11 @@ typedef uint64_t Bitboard;
 #define MSB(x) (63 - __builtin_clzll(x))
 #define COUNT(x) (__builtin_popcountll(x))
 
+#define INLINE static inline __attribute__((always_inline))
+
+// Black magic index: the bits outside the blocker mask are set instead of cleared before multiplying.
+#define MAGIC_KEY(blockers, mask, magic, offset) (((((blockers) | ~(mask)) * (magic)) >> (64 - (offset))))
+
 #define ADD_BIT(board, pos) ((board) |= (1ULL << (pos)))
 #define CLEAR_BIT(board, pos) ((board) &= ~(1ULL << (pos)))
 
@@ -119,8 +124,9 @@ typedef uint64_t Bitboard;
 
 Bitboard get_blocker(Bitboard mask, int square);
 void init_magic_tables();
-void init_rook_table();
-void init_bishop_table();
+
+Bitboard gen_cardinal_attacks_classical(int position, Bitboard blockers);
+Bitboard gen_intercardinal_attacks_classical(int position, Bitboard blockers);
 
 extern const Bitboard KING_MOVES[64];
 extern const Bitboard KNIGHT_MOVES[64];
@@ -130,10 +136,14 @@ extern const Bitboard ROOK_MAGIC[64];
 extern const Bitboard BISHOP_MAGIC[64];
 extern const int ROOK_OFFSET[64];
 extern const int BISHOP_OFFSET[64];
+extern const int ROOK_INDEX[64];
+extern const int BISHOP_INDEX[64];
+extern const int ROOK_TABLE_SIZE;
+extern const int BISHOP_TABLE_SIZE;
 extern const Bitboard ROOK_BLOCKER_MASK[64];
 extern const Bitboard BISHOP_BLOCKER_MASK[64];
-extern Bitboard ROOK_TABLE[64][4096];
-extern Bitboard BISHOP_TABLE[64][512];
+extern const Bitboard ROOK_TABLE[];
+extern const Bitboard BISHOP_TABLE[];
 extern const Bitboard CASTLING[2][6];
 
 #endif
\ No newline at end of file
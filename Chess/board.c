@@ -1,7 +1,16 @@
+#include <stdio.h>
 #include <string.h>
+#include <stddef.h>
 #include "bitboard.h"
 #include "board.h"
 #include "move.h"
+#include "evaluate.h"
+#include "nnue.h"
+
+// Number of bytes hashed by hash. This is the size of the Board struct before the evaluation fields
+// were added, so it includes two bytes of padding which are hashed as zeros. The evaluation fields
+// follow from the pieces on the board, and leaving them out keeps the opening book hashes valid.
+#define HASH_SIZE 136
 
 void board_from_fen(Board* board, const char* fen) {
     board_clear(board);
@@ -90,13 +99,13 @@ void board_to_fen(Board* board, char* fen) {
             }
             if (count != 0) {
                 fen[pos++] = count + '0';
+                count = 0;
             }
-            if (piece != EMPTY) {
-                Piece color = get_color(board, index);
-                fen[pos++] = " PNKBRQ"[piece] + ('a' - 'A') * (color & 1);
-            }
+            Piece color = get_color(board, index);
+            fen[pos++] = " PNKBRQ"[piece] + ('a' - 'A') * (color & 1);
         }
-        fen[pos++] = '/';
+        if (count != 0) fen[pos++] = count + '0';
+        if (rank != 0) fen[pos++] = '/';
     }
     fen[pos++] = ' ';
 
@@ -115,37 +124,16 @@ void board_to_fen(Board* board, char* fen) {
     }
     fen[pos++] = ' ';
 
-    // En passant square;
+    // En passant square, files are counted from the H file.
     if (board->en_passant != 0) {
-        fen[pos++] = (board->en_passant / 8) + 'a';
-        fen[pos++] = (7 - (board->en_passant & 7)) + '1';
+        fen[pos++] = (7 - (board->en_passant & 7)) + 'a';
+        fen[pos++] = (board->en_passant / 8) + '1';
     } else {
         fen[pos++] = '-';
     }
-    fen[pos++] = ' ';
 
-    // Half moves.
-    uint8_t moves = board->half_moves;
-    char buff[8];
-    int curr = 0;
-    while (moves != 0) {
-        uint8_t digit = moves % 10;
-        moves /= 10;
-        buff[curr++] = digit + '0';
-    }
-    for (int i = curr - 1; i >= 0; i--) fen[pos++] = buff[i];
-
-    // Full moves.
-    moves = board->full_moves;
-    curr = 0;
-    while (moves != 0) {
-        uint8_t digit = moves % 10;
-        moves /= 10;
-        buff[curr++] = digit + '0';
-    }
-    for (int i = curr - 1; i >= 0; i--) fen[pos++] = buff[i];
-
-    fen[pos++] = 0;
+    // Half moves and full moves.
+    sprintf(fen + pos, " %d %d", board->half_moves, board->full_moves);
 }
 
 void switch_ply(Board* board) {
@@ -167,8 +155,8 @@ uint64_t hash(Board *board) {
     board->full_moves = 0;
 
     uint64_t hash = 525201411107845655ULL;
-    for (int i = 0; i < sizeof(Board); i++) {
-        hash ^= ptr[i];
+    for (size_t i = 0; i < HASH_SIZE; i++) {
+        hash ^= i < offsetof(Board, material) ? ptr[i] : 0;
         hash *= 0x5bd1e9955bd1e995;
         hash ^= hash >> 47;
     }
@@ -179,6 +167,16 @@ uint64_t hash(Board *board) {
     return hash;
 }
 
+// Unlike hash, which is kept for the opening book, the key is updated with each piece that is added or
+// removed, so only the castling rights, en passant square and side to move are added here.
+uint64_t position_key(Board* board) {
+    uint64_t key = board->key;
+    key ^= ZOBRIST_CASTLE[board->castle[0] | board->castle[1] << 2];
+    key ^= ZOBRIST_EN_PASSANT[board->en_passant];
+    key ^= board->active_color == BLACK ? ZOBRIST_BLACK : 0;
+    return key;
+}
+
 Piece get_piece(Board* board, uint8_t index) {
     return board->positions[index];
 }
@@ -203,12 +201,38 @@ void add_piece(Board* board, Piece piece, Piece color, uint8_t index) {
     board->positions[index] = piece;
     ADD_BIT(board->state[color], index);
     ADD_BIT(board->state[piece], index);
+
+    int si = color == WHITE ? index : 63 - index;
+    board->material[color & 1] += PIECE_VALUES[piece];
+    board->middle_game[color & 1] += PST[piece][si];
+    board->end_game[color & 1] += ENDGAME_PST[piece][si];
+    board->phase += PHASE_VALUES[piece];
+    board->key ^= ZOBRIST_PIECES[color & 1][piece][index];
+
+    if (nnue_enabled) {
+        nnue_add_piece(board, piece, color, index);
+    } else {
+        board->nnue_ready = 0;
+    }
 }
 
 void remove_piece(Board* board, Piece piece, Piece color, uint8_t index) {
     board->positions[index] = 0;
     CLEAR_BIT(board->state[color], index);
     CLEAR_BIT(board->state[piece], index);
+
+    int si = color == WHITE ? index : 63 - index;
+    board->material[color & 1] -= PIECE_VALUES[piece];
+    board->middle_game[color & 1] -= PST[piece][si];
+    board->end_game[color & 1] -= ENDGAME_PST[piece][si];
+    board->phase -= PHASE_VALUES[piece];
+    board->key ^= ZOBRIST_PIECES[color & 1][piece][index];
+
+    if (nnue_enabled) {
+        nnue_remove_piece(board, piece, color, index);
+    } else {
+        board->nnue_ready = 0;
+    }
 }
 
 void add_castle_kingside(Board* board, Piece color) {
@@ -243,14 +267,17 @@ bool can_castle(Board* board) {
     return *(uint16_t*)(board->castle) != 0;
 }
 
+// Only looks for attackers of the king, which is cheaper than generating every attack.
 bool is_legal(Board* board) {
     Bitboard king = get_pieces(board, KING, OPPOSITE(board->active_color));
-    Bitboard attacks = gen_attacks(board);
+    switch_ply(board);
+    Bitboard checkers = gen_checkers(board, LSB(king));
+    switch_ply(board);
 
-    return (king & attacks) == 0;
+    return checkers == 0;
 }
 
 bool is_in_check(Board* board) {
-    Bitboard king = get_pieces(board, KING, OPPOSITE(board->active_color));
+    Bitboard king = get_pieces(board, KING, board->active_color);
     return gen_checkers(board, LSB(king)) != 0;
 }
\ No newline at end of file
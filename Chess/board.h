@@ -24,6 +24,13 @@ typedef uint8_t Piece;
 #define WHITE_TO_MOVE(x) (((x)->active_color) == 0)
 #define IN_OPENING_BOOK(x) (((x)->full_moves) < 5)
 
+// Checks the side to move once and calls an INLINE kernel whose last parameter is the color, so
+// both calls get compiled into a color specialized copy of the kernel.
+#define DISPATCH(board, kernel, ...) (WHITE_TO_MOVE(board) ? kernel(__VA_ARGS__, WHITE) : kernel(__VA_ARGS__, BLACK))
+
+// Size of each accumulator of the neural evaluator, see nnue.h.
+#define NNUE_HIDDEN 64
+
 typedef struct {
     Piece positions[64]; // Stores locations of pieces.
     Bitboard state[8]; // One bitboard for each piece type and color.
@@ -32,8 +39,21 @@ typedef struct {
     uint8_t castle[2]; // First bit for Kingside, Second for Queenside.
     uint8_t half_moves;
     uint8_t full_moves;
+    // Evaluation terms kept up to date by add_piece and remove_piece, indexed by color & 1.
+    int16_t material[2];
+    int16_t middle_game[2]; // Piece square table sums.
+    int16_t end_game[2];
+    uint8_t phase; // Sum of PHASE_VALUES of all pieces on the board.
+    uint64_t key; // Zobrist key of the pieces only, see position_key.
+    uint8_t nnue_ready; // One bit per side whose accumulator is up to date.
+    int16_t accumulator[2][NNUE_HIDDEN] __attribute__((aligned(32))); // Neural evaluator, indexed by color & 1.
 } Board;
 
+extern const uint64_t ZOBRIST_PIECES[2][8][64];
+extern const uint64_t ZOBRIST_CASTLE[16];
+extern const uint64_t ZOBRIST_EN_PASSANT[64];
+extern const uint64_t ZOBRIST_BLACK;
+
 void board_from_fen(Board* board, const char* fen);
 void board_to_fen(Board* board, char* fen);
 
@@ -41,6 +61,7 @@ void switch_ply(Board* board);
 
 void board_clear(Board* board);
 uint64_t hash(Board* board);
+uint64_t position_key(Board* board);
 
 Piece get_piece(Board* board, uint8_t index);
 Piece get_color(Board* board, uint8_t index);
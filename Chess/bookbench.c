@@ -0,0 +1,106 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "board.h"
+#include "move.h"
+#include "opening.h"
+
+// Measures the latency of opening book probes on positions from games which follow the book for
+// a while and then leave it, so both hits and misses are timed. The results are checked against a
+// linear scan of the book: bookbench.exe [positions] [rounds]
+
+#define MAX_PLY 30
+
+static uint64_t seed = 0x2545f4914f6cdd1dULL;
+
+static uint64_t next_random() {
+    seed ^= seed >> 12;
+    seed ^= seed << 25;
+    seed ^= seed >> 27;
+    return seed * 0x2545f4914f6cdd1dULL;
+}
+
+int linear_openings(uint64_t hash) {
+    int n = 0;
+    for (int i = 0; i < openings_size; i++) n += openings[i].hash == hash;
+    return n;
+}
+
+int main(int argc, char* args[]) {
+    init_magic_tables();
+    int n = argc > 1 ? atoi(args[1]) : 100000;
+    int rounds = argc > 2 ? atoi(args[2]) : 20;
+
+    for (int i = 1; i < openings_size; i++) {
+        if (openings[i - 1].hash > openings[i].hash) {
+            printf("book is not sorted at entry %d\n", i);
+            return 1;
+        }
+    }
+
+    Board* boards = malloc(n * sizeof(Board));
+    uint64_t* hashes = malloc(n * sizeof(uint64_t));
+
+    Board board;
+    board_from_fen(&board, "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+    for (int i = 0, ply = 0; i < n; ply++) {
+        Move moves[MAX_MOVES];
+        int n_moves = gen_moves(&board, moves);
+        if (n_moves == 0 || ply == MAX_PLY) {
+            board_from_fen(&board, "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+            ply = 0;
+            continue;
+        }
+        boards[i] = board;
+        hashes[i++] = hash(&board);
+
+        // Leave the book with a random move now and then.
+        Move move;
+        if (next_random() % 8 == 0 || !select_opening(&board, &move)) move = moves[next_random() % n_moves];
+        make_move(&board, &move);
+    }
+
+    int mismatches = 0;
+    for (int i = 0; i < n; i++) {
+        const Opening* first;
+        mismatches += find_openings(hashes[i], &first) != linear_openings(hashes[i]);
+    }
+
+    clock_t start = clock();
+    int64_t found = 0;
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < n; i++) {
+            const Opening* first;
+            found += find_openings(hashes[i], &first);
+        }
+    }
+    double lookup = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    int selected = 0;
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < n; i++) {
+            Move move;
+            selected += select_opening(&boards[i], &move);
+        }
+    }
+    double select = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    int linear_rounds = rounds / 20 + 1;
+    for (int r = 0; r < linear_rounds; r++) {
+        for (int i = 0; i < n; i++) found += linear_openings(hashes[i]);
+    }
+    double linear = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    printf("%d book entries, %d positions, %d in book, %d mismatches, checksum %lld\n",
+           openings_size, n, selected / rounds, mismatches, (long long) found);
+    printf("find_openings: %.1f ns/probe\n", lookup * 1e9 / ((double) n * rounds));
+    printf("select_opening: %.1f ns/probe\n", select * 1e9 / ((double) n * rounds));
+    printf("linear scan: %.1f ns/probe\n", linear * 1e9 / ((double) n * linear_rounds));
+
+    free(boards);
+    free(hashes);
+    return mismatches != 0;
+}
\ No newline at end of file
@@ -0,0 +1,479 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "tinycthread.h"
+#include "bitboard.h"
+#include "board.h"
+#include "move.h"
+#include "polyglot.h"
+
+// Builds an opening book from the games in PGN files: the table of the built in book, written into
+// opening.c in place of the one there, or a Polyglot book (see polyglot.h) if the output file ends
+// in .bin.
+//
+// The files are read in a single pass by the main thread, which cuts them into blocks of whole
+// games and hands these to the worker threads through a queue of a few blocks, so the size of the
+// files does not matter. Each worker plays the games of its blocks from their SAN moves and counts
+// every position and move of the first plies in a hash table of its own. The tables have a fixed
+// size: when one fills up, the pairs seen least often so far are dropped, so with huge collections
+// some rare moves are lost, but memory stays bounded. At the end the tables are merged and written
+// sorted by key.
+// Usage: bookgen <output file> <plies> <threads> <pgn files...>
+
+#define BLOCK_SIZE (1 << 20)
+#define QUEUE_LENGTH 16
+#define MAX_LINE 4096
+// Entries of each table as a power of two, 16 bytes each.
+#define MAP_SIZE 22
+#define START_FEN "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+#define TABLE_START "const Opening openings[] = {"
+
+typedef struct {
+    char* text;
+    size_t length;
+} Block;
+
+typedef struct {
+    uint64_t key;
+    Move move;
+    uint32_t count; // 0 for empty slots.
+} BookEntry;
+
+typedef struct {
+    BookEntry* entries;
+    uint64_t mask;
+    uint64_t size;
+    uint32_t threshold; // Pairs seen at most this often are dropped when the table fills up.
+    uint64_t games;
+    uint64_t positions;
+    uint64_t errors; // Games with a move that could not be read.
+} CountMap;
+
+static Block queue[QUEUE_LENGTH];
+static int queue_head = 0;
+static int queue_count = 0;
+static bool reading_done = false;
+static mtx_t queue_lock;
+static cnd_t queue_filled;
+static cnd_t queue_emptied;
+
+static int max_plies;
+static bool polyglot;
+
+void map_init(CountMap* map, int size) {
+    memset(map, 0, sizeof(CountMap));
+    map->mask = (1ULL << size) - 1;
+    map->entries = calloc(map->mask + 1, sizeof(BookEntry));
+}
+
+INLINE uint64_t slot_of(const CountMap* map, uint64_t key, Move move) {
+    return (key ^ (move * 0x9e3779b97f4a7c15ULL)) & map->mask;
+}
+
+static void map_prune(CountMap* map);
+
+void map_add(CountMap* map, uint64_t key, Move move, uint32_t count) {
+    uint64_t i = slot_of(map, key, move);
+    while (map->entries[i].count != 0) {
+        if (map->entries[i].key == key && map->entries[i].move == move) {
+            map->entries[i].count += count;
+            return;
+        }
+        i = (i + 1) & map->mask;
+    }
+    map->entries[i] = (BookEntry) {key, move, count};
+    if (++map->size > (map->mask + 1) / 4 * 3) map_prune(map);
+}
+
+// Drops the rarest pairs until the table is at most half full.
+static void map_prune(CountMap* map) {
+    BookEntry* old = map->entries;
+    uint64_t capacity = map->mask + 1;
+    while (map->size > capacity / 2) {
+        map->threshold++;
+        uint64_t size = 0;
+        for (uint64_t i = 0; i < capacity; i++) size += old[i].count > map->threshold;
+        map->size = size;
+    }
+
+    map->entries = calloc(capacity, sizeof(BookEntry));
+    for (uint64_t i = 0; i < capacity; i++) {
+        if (old[i].count <= map->threshold) continue;
+        uint64_t j = slot_of(map, old[i].key, old[i].move);
+        while (map->entries[j].count != 0) j = (j + 1) & map->mask;
+        map->entries[j] = old[i];
+    }
+    free(old);
+}
+
+// Squares are numbered from the H file, see board_from_fen.
+INLINE int parse_square(char file, char rank) {
+    return (rank - '1') * 8 + 7 - (file - 'a');
+}
+
+// Finds the legal move written in SAN, like e4, Nbd7, exd8=Q+ or O-O-O.
+bool parse_san(Board* board, const char* san, Move* move) {
+    char text[16];
+    int length = 0;
+    for (int i = 0; san[i] != '\0' && length < 15; i++) {
+        if (strchr("+#!?=x", san[i]) == NULL) text[length++] = san[i];
+    }
+    text[length] = '\0';
+
+    Move moves[MAX_MOVES];
+    int n_moves = gen_moves(board, moves);
+
+    if (strcmp(text, "O-O") == 0 || strcmp(text, "0-0") == 0 || strcmp(text, "O-O-O") == 0 || strcmp(text, "0-0-0") == 0) {
+        bool kingside = length == 3;
+        for (int i = 0; i < n_moves; i++) {
+            Flag flags = MOVE_FLAGS(moves[i]);
+            if (kingside ? IS_CASTLE_KINGSIDE(flags) : IS_CASTLE_QUEENSIDE(flags)) {
+                *move = moves[i];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Piece piece = PAWN;
+    const char* pieces = "NBRQK";
+    const Piece types[] = {KNIGHT, BISHOP, ROOK, QUEEN, KING};
+    int start = 0;
+    if (length > 0 && strchr(pieces, text[0]) != NULL) piece = types[strchr(pieces, text[0]) - pieces];
+    if (piece != PAWN) start = 1;
+
+    Piece promotion = EMPTY;
+    if (length > 0 && piece == PAWN && strchr(pieces, text[length - 1]) != NULL) {
+        promotion = types[strchr(pieces, text[--length]) - pieces];
+    }
+
+    if (length - start < 2) return false;
+    char file = text[length - 2], rank = text[length - 1];
+    if (file < 'a' || file > 'h' || rank < '1' || rank > '8') return false;
+    int to = parse_square(file, rank);
+
+    // Disambiguation by the file and/or rank the piece comes from.
+    int from_file = -1, from_rank = -1;
+    for (int i = start; i < length - 2; i++) {
+        if (text[i] >= 'a' && text[i] <= 'h') from_file = 7 - (text[i] - 'a');
+        else if (text[i] >= '1' && text[i] <= '8') from_rank = text[i] - '1';
+        else return false;
+    }
+
+    for (int i = 0; i < n_moves; i++) {
+        int from = MOVE_FROM(moves[i]);
+        Flag flags = MOVE_FLAGS(moves[i]);
+        if (MOVE_TO(moves[i]) != to || get_piece(board, from) != piece || IS_CASTLE(flags)) continue;
+        if ((from_file != -1 && (from & 7) != from_file) || (from_rank != -1 && (from >> 3) != from_rank)) continue;
+        if (PROMOTED_PIECE(flags) != promotion) continue;
+        *move = moves[i];
+        return true;
+    }
+    return false;
+}
+
+INLINE bool is_result(const char* token) {
+    return strcmp(token, "1-0") == 0 || strcmp(token, "0-1") == 0 || strcmp(token, "1/2-1/2") == 0 || strcmp(token, "*") == 0;
+}
+
+// Plays the games of a block and counts their moves.
+void count_block(CountMap* map, const char* text, size_t length) {
+    Board board;
+    board_from_fen(&board, START_FEN);
+    int ply = 0;
+    bool in_moves = false;
+    bool done = false; // The rest of the moves of the game are not counted.
+
+    size_t i = 0;
+    while (i < length) {
+        char c = text[i];
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '.') {
+            i++;
+        } else if (c == '[') {
+            // Tag pair. The first tag after the moves of a game starts the next one.
+            size_t end = i;
+            while (end < length && text[end] != ']' && text[end] != '\n') end++;
+            if (in_moves || strncmp(text + i, "[Event ", 7) == 0) {
+                board_from_fen(&board, START_FEN);
+                ply = 0;
+                in_moves = false;
+                done = false;
+            }
+            if (strncmp(text + i, "[FEN \"", 6) == 0) {
+                char fen[128];
+                size_t n = 0;
+                for (size_t j = i + 6; j < end && text[j] != '"' && n < sizeof(fen) - 1; j++) fen[n++] = text[j];
+                fen[n] = '\0';
+                board_from_fen(&board, fen);
+            }
+            i = end + 1;
+        } else if (c == '{') {
+            while (i < length && text[i] != '}') i++;
+            i++;
+        } else if (c == ';' || c == '%') {
+            while (i < length && text[i] != '\n') i++;
+        } else if (c == '(') {
+            // Variations are not counted.
+            int depth = 0;
+            do {
+                if (text[i] == '(') depth++;
+                else if (text[i] == ')') depth--;
+                else if (text[i] == '{') while (i + 1 < length && text[i + 1] != '}') i++;
+                i++;
+            } while (i < length && depth > 0);
+        } else {
+            char token[32];
+            size_t n = 0;
+            while (i < length && n < sizeof(token) - 1 && strchr(" \t\r\n{}();[", text[i]) == NULL) token[n++] = text[i++];
+            while (i < length && strchr(" \t\r\n{}();[", text[i]) == NULL) i++;
+            token[n] = '\0';
+
+            if (!in_moves) map->games++;
+            in_moves = true;
+            if (is_result(token)) {
+                done = true;
+                continue;
+            }
+
+            // Move numbers, possibly written together with the move like 1.e4.
+            const char* san = token;
+            if (*san >= '0' && *san <= '9') {
+                while (*san >= '0' && *san <= '9') san++;
+                while (*san == '.') san++;
+            }
+            if (*san == '\0' || *san == '$' || done) continue;
+
+            Move move;
+            if (!parse_san(&board, san, &move)) {
+                map->errors++;
+                done = true;
+                continue;
+            }
+            map_add(map, polyglot ? polyglot_key(&board) : hash(&board), move, 1);
+            map->positions++;
+            make_move(&board, &move);
+            done = ++ply == max_plies;
+        }
+    }
+}
+
+int worker(void* arg) {
+    CountMap* map = arg;
+    while (true) {
+        mtx_lock(&queue_lock);
+        while (queue_count == 0 && !reading_done) cnd_wait(&queue_filled, &queue_lock);
+        if (queue_count == 0) {
+            mtx_unlock(&queue_lock);
+            return 0;
+        }
+        Block block = queue[queue_head];
+        queue_head = (queue_head + 1) % QUEUE_LENGTH;
+        queue_count--;
+        cnd_signal(&queue_emptied);
+        mtx_unlock(&queue_lock);
+
+        count_block(map, block.text, block.length);
+        free(block.text);
+    }
+}
+
+void push_block(Block block) {
+    mtx_lock(&queue_lock);
+    while (queue_count == QUEUE_LENGTH) cnd_wait(&queue_emptied, &queue_lock);
+    queue[(queue_head + queue_count) % QUEUE_LENGTH] = block;
+    queue_count++;
+    cnd_signal(&queue_filled);
+    mtx_unlock(&queue_lock);
+}
+
+// Cuts the file into blocks of at least BLOCK_SIZE bytes, only where a new game starts.
+bool read_games(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        fprintf(stderr, "Could not open %s.\n", path);
+        return false;
+    }
+
+    size_t capacity = BLOCK_SIZE + MAX_LINE;
+    Block block = {malloc(capacity), 0};
+    char line[MAX_LINE];
+    bool line_start = true;
+    bool in_moves = false;
+    while (fgets(line, sizeof(line), file)) {
+        size_t n = strlen(line);
+        if (line_start) {
+            if (line[0] == '[') {
+                if (in_moves && block.length >= BLOCK_SIZE) {
+                    push_block(block);
+                    block = (Block) {malloc(capacity), 0};
+                }
+                in_moves = false;
+            } else if (strspn(line, " \t\r\n") != n) {
+                in_moves = true;
+            }
+        }
+        line_start = n > 0 && line[n - 1] == '\n';
+
+        // Games longer than a block make it grow.
+        if (block.length + n > capacity) {
+            capacity *= 2;
+            block.text = realloc(block.text, capacity);
+        }
+        memcpy(block.text + block.length, line, n);
+        block.length += n;
+    }
+    fclose(file);
+
+    if (block.length > 0) push_block(block);
+    else free(block.text);
+    return true;
+}
+
+int compare_entries(const void* a, const void* b) {
+    const BookEntry* x = a;
+    const BookEntry* y = b;
+    if (x->key != y->key) return x->key < y->key ? -1 : 1;
+    if (x->count != y->count) return x->count > y->count ? -1 : 1;
+    return (int) x->move - (int) y->move;
+}
+
+// Replaces the table at the end of opening.c, keeping the code above it.
+bool write_table(const char* path, const BookEntry* entries, uint64_t n) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) return false;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char* source = malloc(size + 1);
+    source[fread(source, 1, size, file)] = '\0';
+    fclose(file);
+
+    char* table = strstr(source, TABLE_START);
+    if (table == NULL) {
+        fprintf(stderr, "%s has no openings table.\n", path);
+        free(source);
+        return false;
+    }
+
+    char temporary[1100];
+    snprintf(temporary, sizeof(temporary), "%s.tmp", path);
+    file = fopen(temporary, "wb");
+    if (file == NULL) {
+        free(source);
+        return false;
+    }
+    fwrite(source, 1, table - source, file);
+    fprintf(file, "%s\n", TABLE_START);
+    for (uint64_t i = 0; i < n; i++) {
+        Move move = entries[i].move;
+        fprintf(file, "    {%lluULL, %u, MOVE(%d, %d, 0x%x)}%s\n", (unsigned long long) entries[i].key, entries[i].count,
+                MOVE_FROM(move), MOVE_TO(move), MOVE_FLAGS(move), i < n - 1 ? "," : "");
+    }
+    fprintf(file, "};\n\nconst int openings_size = sizeof(openings) / sizeof(Opening);");
+    free(source);
+
+    bool ok = fclose(file) == 0;
+    remove(path);
+    return ok && rename(temporary, path) == 0;
+}
+
+// Weights are the counts, scaled down per position if they do not fit into 16 bits.
+bool write_polyglot(const char* path, const BookEntry* entries, uint64_t n) {
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) return false;
+    for (uint64_t i = 0; i < n; i++) {
+        uint64_t first = i;
+        while (first > 0 && entries[first - 1].key == entries[i].key) first--;
+        uint32_t most = entries[first].count;
+
+        uint32_t weight = most > 0xffff ? (uint32_t) ((uint64_t) entries[i].count * 0xffff / most) : entries[i].count;
+        if (weight == 0) weight = 1;
+        uint16_t move = polyglot_move(entries[i].move);
+
+        uint8_t entry[POLYGLOT_ENTRY_SIZE] = {0};
+        for (int j = 0; j < 8; j++) entry[j] = entries[i].key >> (56 - 8 * j);
+        entry[8] = move >> 8;
+        entry[9] = move & 0xff;
+        entry[10] = weight >> 8;
+        entry[11] = weight & 0xff;
+        fwrite(entry, 1, POLYGLOT_ENTRY_SIZE, file);
+    }
+    return fclose(file) == 0;
+}
+
+int main(int argc, char* args[]) {
+    if (argc < 5) {
+        fprintf(stderr, "Usage: %s <output file> <plies> <threads> <pgn files...>\n", args[0]);
+        return 1;
+    }
+    const char* output = args[1];
+    max_plies = atoi(args[2]);
+    int n_threads = atoi(args[3]);
+    if (n_threads < 1) n_threads = 1;
+    size_t output_length = strlen(output);
+    polyglot = output_length > 4 && strcmp(output + output_length - 4, ".bin") == 0;
+
+    init_magic_tables();
+    mtx_init(&queue_lock, mtx_plain);
+    cnd_init(&queue_filled);
+    cnd_init(&queue_emptied);
+
+    clock_t start = clock();
+    time_t wall = time(NULL);
+
+    CountMap* maps = malloc(n_threads * sizeof(CountMap));
+    thrd_t* threads = malloc(n_threads * sizeof(thrd_t));
+    for (int i = 0; i < n_threads; i++) {
+        map_init(&maps[i], MAP_SIZE);
+        thrd_create(&threads[i], worker, &maps[i]);
+    }
+
+    for (int i = 4; i < argc; i++) read_games(args[i]);
+
+    mtx_lock(&queue_lock);
+    reading_done = true;
+    cnd_broadcast(&queue_filled);
+    mtx_unlock(&queue_lock);
+    for (int i = 0; i < n_threads; i++) thrd_join(threads[i], NULL);
+
+    // Merge everything into the first table.
+    CountMap* book = &maps[0];
+    for (int i = 1; i < n_threads; i++) {
+        for (uint64_t j = 0; j <= maps[i].mask; j++) {
+            const BookEntry* entry = &maps[i].entries[j];
+            if (entry->count != 0) map_add(book, entry->key, entry->move, entry->count);
+        }
+        book->games += maps[i].games;
+        book->positions += maps[i].positions;
+        book->errors += maps[i].errors;
+        if (maps[i].threshold > book->threshold) book->threshold = maps[i].threshold;
+        free(maps[i].entries);
+    }
+
+    BookEntry* entries = malloc(book->size * sizeof(BookEntry));
+    uint64_t n = 0;
+    for (uint64_t j = 0; j <= book->mask; j++) {
+        if (book->entries[j].count != 0) entries[n++] = book->entries[j];
+    }
+    qsort(entries, n, sizeof(BookEntry), compare_entries);
+
+    bool ok = polyglot ? write_polyglot(output, entries, n) : write_table(output, entries, n);
+    if (!ok) fprintf(stderr, "Could not write %s.\n", output);
+
+    printf("%llu games, %llu with unreadable moves, %llu positions, %llu entries", (unsigned long long) book->games,
+           (unsigned long long) book->errors, (unsigned long long) book->positions, (unsigned long long) n);
+    if (book->threshold > 0) printf(", moves seen at most %u times dropped", book->threshold);
+    printf("\n%.1f s, %.1f s CPU\n", difftime(time(NULL), wall), (double) (clock() - start) / CLOCKS_PER_SEC);
+
+    free(entries);
+    free(book->entries);
+    free(maps);
+    free(threads);
+    mtx_destroy(&queue_lock);
+    cnd_destroy(&queue_filled);
+    cnd_destroy(&queue_emptied);
+    return !ok;
+}
\ No newline at end of file
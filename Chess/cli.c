@@ -0,0 +1,448 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "engine.h"
+#include "tinycthread.h"
+
+// Command line driver of the engine library, which uses the engine through engine.h only.
+//
+// Searches a position given as an argument, startpos or a FEN optionally followed by moves, or one
+// such position per line read from standard input, and prints every completed iteration and the
+// best move.
+//
+// The batch command analyzes a file of positions, FENs or EPD lines, on a pool of workers which each
+// search with an engine of their own, with their own hash tables or, with -shared, one they all
+// share. Lines are read into a queue of fixed length as the workers take them, so any number of
+// positions is analyzed in bounded memory, and every result is written as soon as it is complete, in
+// the order the searches finish. Results start with the line number of their position, EPD lines
+// can set their own limits with the acd (depth), acn (nodes) and acs (seconds) operations, and their
+// id is copied into the result.
+//
+// With -cache, searches are answered from a cache of earlier results where one is deep enough, which
+// -snapshot loads at the start and saves at the end. With -hashfile, the hash table is kept in a
+// memory mapped file, so the next run starts with the table of this one. With -hashshm, it is in a
+// shared memory segment which other processes attach to as well. All workers share either of them.
+// Usage: chess-cli [options] [startpos | fen [moves...]]
+//        chess-cli batch [options] [-workers n] [-shared] <input file | -> [output file]
+// Options: -depth n, -movetime ms, -nodes n, -threads n (per worker), -hash MB (per engine),
+//          -tablebases dir, -nnue file, -cache MB, -snapshot file, -hashfile file,
+//          -hashshm name
+
+#define DEFAULT_DEPTH 10
+#define DEFAULT_HASH 64 // MB
+#define MAX_LINE 65536
+#define MAX_EPD 1024
+// Positions waiting for a worker, per worker.
+#define QUEUE_PER_WORKER 4
+
+typedef struct {
+    EngineLimits limits;
+    int threads;
+    int hash;
+    int workers;
+    bool shared;
+    const char* tablebases;
+    const char* nnue;
+    int cache; // MB, 0 for none.
+    const char* snapshot;
+    const char* hashfile; // NULL for a hash table in memory.
+    const char* hashshm; // Shared memory segment of the hash table, NULL for none.
+} Options;
+
+typedef struct {
+    uint64_t number; // Line in the input, from 1.
+    char line[MAX_EPD];
+} Job;
+
+static Job* queue;
+static int queue_length;
+static int queue_head = 0;
+static int queue_count = 0;
+static bool reading_done = false;
+static mtx_t queue_lock;
+static cnd_t queue_filled;
+static cnd_t queue_emptied;
+
+static FILE* output;
+static mtx_t output_lock;
+
+void print_info(const EngineInfo* info, void* data) {
+    if (info->mate != 0) printf("depth %d score mate %d", info->depth, info->mate);
+    else printf("depth %d score cp %d", info->depth, info->score);
+    printf(" nodes %llu time %llu pv", (unsigned long long) info->nodes, (unsigned long long) info->milliseconds);
+    for (int i = 0; i < info->pv_length; i++) printf(" %s", info->pv[i]);
+    printf("\n");
+    fflush(stdout);
+}
+
+// The position is startpos or a FEN of six fields, anything after it are moves.
+void analyze(Engine* engine, const EngineLimits* limits, char* line) {
+    char* moves = line + strspn(line, " \t");
+    char fen[ENGINE_FEN_LENGTH];
+    bool start = strncmp(moves, "startpos", 8) == 0;
+    if (start) {
+        moves += 8;
+    } else {
+        for (int field = 0; field < 6 && *moves != '\0'; field++) {
+            moves += strspn(moves, " \t");
+            moves += strcspn(moves, " \t");
+        }
+        snprintf(fen, sizeof(fen), "%.*s", (int) (moves - line), line);
+    }
+
+    int result = engine_set_position(engine, start ? NULL : fen, moves);
+    if (result == ENGINE_INVALID_FEN) {
+        printf("invalid position %s\n", line);
+        return;
+    } else if (result == ENGINE_ILLEGAL_MOVE) {
+        printf("illegal move in %s\n", moves);
+        return;
+    }
+
+    char best[ENGINE_MOVE_LENGTH], ponder[ENGINE_MOVE_LENGTH];
+    EngineInfo info;
+    if (engine_search(engine, limits, print_info, NULL, best, ponder, &info) == ENGINE_NO_MOVES) {
+        printf("bestmove (none)\n");
+    } else if (ponder[0] != '\0') {
+        printf("bestmove %s ponder %s\n", best, ponder);
+    } else {
+        printf("bestmove %s\n", best);
+    }
+    fflush(stdout);
+}
+
+// Splits an EPD or FEN line into the position, its first four fields and the move counters if
+// there are any, and the operations, and applies the limit operations. Returns false if the line
+// has fewer than four fields.
+bool parse_epd(char* line, char* fen, EngineLimits* limits, char* id) {
+    char* rest = line;
+    for (int field = 0; field < 4; field++) {
+        rest += strspn(rest, " \t");
+        if (*rest == '\0') return false;
+        rest += strcspn(rest, " \t");
+    }
+    // Move counters of a FEN.
+    for (int field = 0; field < 2; field++) {
+        char* next = rest + strspn(rest, " \t");
+        int length = strcspn(next, " \t");
+        if (length == 0 || strspn(next, "0123456789") != (size_t) length) break;
+        rest = next + length;
+    }
+    snprintf(fen, ENGINE_FEN_LENGTH, "%.*s", (int) (rest - line), line);
+
+    // Operations are an opcode and operands, ended by semicolons. They replace the limit of the same
+    // kind from the command line.
+    id[0] = '\0';
+    char* operation = rest;
+    while (*operation != '\0') {
+        char* end = strchr(operation, ';');
+        if (end != NULL) *end = '\0';
+        char opcode[16];
+        char operand[MAX_EPD];
+        if (sscanf(operation, "%15s %1023[^\n]", opcode, operand) == 2) {
+            if (strcmp(opcode, "acd") == 0) limits->depth = atoi(operand);
+            else if (strcmp(opcode, "acn") == 0) limits->nodes = strtoull(operand, NULL, 10);
+            else if (strcmp(opcode, "acs") == 0) limits->milliseconds = strtoull(operand, NULL, 10) * 1000;
+            else if (strcmp(opcode, "id") == 0) snprintf(id, MAX_EPD, "%s", operand);
+        }
+        if (end == NULL) break;
+        operation = end + 1;
+    }
+    return true;
+}
+
+// Searches without any limit would never end.
+void default_limits(EngineLimits* limits) {
+    if (limits->depth == 0 && limits->nodes == 0 && limits->milliseconds == 0) limits->depth = DEFAULT_DEPTH;
+}
+
+// Searches one line of the batch and writes its result.
+void analyze_job(Engine* engine, const Options* options, Job* job) {
+    char fen[ENGINE_FEN_LENGTH], id[MAX_EPD];
+    EngineLimits limits = options->limits;
+    char result[MAX_EPD + 128 + ENGINE_MAX_PV * ENGINE_MOVE_LENGTH];
+    int length = snprintf(result, sizeof(result), "%llu", (unsigned long long) job->number);
+
+    bool valid = parse_epd(job->line, fen, &limits, id);
+    default_limits(&limits);
+    if (!valid || engine_set_position(engine, fen, NULL) != ENGINE_OK) {
+        length += snprintf(result + length, sizeof(result) - length, " invalid position");
+    } else {
+        char best[ENGINE_MOVE_LENGTH], ponder[ENGINE_MOVE_LENGTH];
+        EngineInfo info;
+        if (engine_search(engine, &limits, NULL, NULL, best, ponder, &info) == ENGINE_NO_MOVES) {
+            length += snprintf(result + length, sizeof(result) - length, " bestmove (none)");
+        } else {
+            length += snprintf(result + length, sizeof(result) - length, " bestmove %s score %s %d depth %d nodes %llu time %llu pv",
+                               best, info.mate != 0 ? "mate" : "cp", info.mate != 0 ? info.mate : info.score, info.depth,
+                               (unsigned long long) info.nodes, (unsigned long long) info.milliseconds);
+            for (int i = 0; i < info.pv_length; i++) {
+                length += snprintf(result + length, sizeof(result) - length, " %s", info.pv[i]);
+            }
+        }
+        if (id[0] != '\0') snprintf(result + length, sizeof(result) - length, " id %s", id);
+    }
+
+    // Whole lines, in the order the searches finish.
+    mtx_lock(&output_lock);
+    fprintf(output, "%s\n", result);
+    fflush(output);
+    mtx_unlock(&output_lock);
+}
+
+typedef struct {
+    Engine* engine;
+    const Options* options;
+} Worker;
+
+int worker(void* arg) {
+    Worker* worker = arg;
+    Job* job = malloc(sizeof(Job));
+    while (true) {
+        mtx_lock(&queue_lock);
+        while (queue_count == 0 && !reading_done) cnd_wait(&queue_filled, &queue_lock);
+        if (queue_count == 0) {
+            mtx_unlock(&queue_lock);
+            break;
+        }
+        *job = queue[queue_head];
+        queue_head = (queue_head + 1) % queue_length;
+        queue_count--;
+        cnd_signal(&queue_emptied);
+        mtx_unlock(&queue_lock);
+
+        analyze_job(worker->engine, worker->options, job);
+    }
+    free(job);
+    return 0;
+}
+
+// Waits while the queue is full, so the reader never gets far ahead of the workers.
+void push_job(uint64_t number, const char* line) {
+    mtx_lock(&queue_lock);
+    while (queue_count == queue_length) cnd_wait(&queue_emptied, &queue_lock);
+    Job* job = &queue[(queue_head + queue_count) % queue_length];
+    job->number = number;
+    snprintf(job->line, MAX_EPD, "%s", line);
+    queue_count++;
+    cnd_signal(&queue_filled);
+    mtx_unlock(&queue_lock);
+}
+
+// Prints the reason if the engine can not be created.
+Engine* create_engine(const Options* options) {
+    if (options->hashshm != NULL) {
+        Engine* engine = engine_new_attached(options->hashshm, options->hash, options->threads);
+        if (engine == NULL) fprintf(stderr, "Could not attach to %s, or it has another size.\n", options->hashshm);
+        return engine;
+    }
+    if (options->hashfile == NULL) {
+        Engine* engine = engine_new(options->hash, options->threads);
+        if (engine == NULL) fprintf(stderr, "Out of memory.\n");
+        return engine;
+    }
+    Engine* engine = engine_new_file(options->hashfile, options->hash, options->threads);
+    if (engine == NULL) fprintf(stderr, "Could not open %s, or it is in use.\n", options->hashfile);
+    return engine;
+}
+
+int batch(const Options* options, EngineCache* cache, const char* input_path, const char* output_path) {
+    FILE* input = strcmp(input_path, "-") == 0 ? stdin : fopen(input_path, "r");
+    if (input == NULL) {
+        fprintf(stderr, "Could not open %s.\n", input_path);
+        return 1;
+    }
+    output = output_path != NULL ? fopen(output_path, "w") : stdout;
+    if (output == NULL) {
+        fprintf(stderr, "Could not open %s.\n", output_path);
+        return 1;
+    }
+
+    int n_workers = options->workers;
+    Engine** engines = malloc(n_workers * sizeof(Engine*));
+    for (int i = 0; i < n_workers; i++) {
+        if (options->shared && i > 0) {
+            engines[i] = engine_new_shared(engines[0], options->threads);
+            if (engines[i] == NULL) fprintf(stderr, "Out of memory.\n");
+        } else {
+            engines[i] = create_engine(options);
+        }
+        if (engines[i] == NULL) return 1;
+        engine_set_cache(engines[i], cache);
+    }
+
+    queue_length = n_workers * QUEUE_PER_WORKER;
+    queue = malloc(queue_length * sizeof(Job));
+    mtx_init(&queue_lock, mtx_plain);
+    cnd_init(&queue_filled);
+    cnd_init(&queue_emptied);
+    mtx_init(&output_lock, mtx_plain);
+
+    Worker* workers = malloc(n_workers * sizeof(Worker));
+    thrd_t* threads = malloc(n_workers * sizeof(thrd_t));
+    for (int i = 0; i < n_workers; i++) {
+        workers[i] = (Worker) {engines[i], options};
+        thrd_create(&threads[i], worker, &workers[i]);
+    }
+
+    char line[MAX_EPD];
+    uint64_t number = 0;
+    while (fgets(line, sizeof(line), input)) {
+        number++;
+        size_t length = strcspn(line, "\r\n");
+        if (line[length] == '\0' && !feof(input)) {
+            // Longer than any position, the rest of the line is skipped.
+            int c;
+            while ((c = fgetc(input)) != EOF && c != '\n');
+            mtx_lock(&output_lock);
+            fprintf(output, "%llu line too long\n", (unsigned long long) number);
+            mtx_unlock(&output_lock);
+            continue;
+        }
+        line[length] = '\0';
+        if (line[strspn(line, " \t")] == '\0' || line[0] == '#') continue;
+        push_job(number, line);
+    }
+
+    mtx_lock(&queue_lock);
+    reading_done = true;
+    cnd_broadcast(&queue_filled);
+    mtx_unlock(&queue_lock);
+    for (int i = 0; i < n_workers; i++) thrd_join(threads[i], NULL);
+
+    // Engines sharing the hash table of the first are freed before it.
+    for (int i = n_workers - 1; i >= 0; i--) engine_free(engines[i]);
+    if (input != stdin) fclose(input);
+    if (output != stdout) fclose(output);
+    free(engines);
+    free(workers);
+    free(threads);
+    free(queue);
+    mtx_destroy(&queue_lock);
+    cnd_destroy(&queue_filled);
+    cnd_destroy(&queue_emptied);
+    mtx_destroy(&output_lock);
+    return 0;
+}
+
+// Analyzes the position of the arguments, or the positions read from standard input.
+int analyze_positions(const Options* options, EngineCache* cache, int argc, char** argv) {
+    Engine* engine = create_engine(options);
+    if (engine == NULL) return 1;
+    engine_set_cache(engine, cache);
+
+    EngineLimits limits = options->limits;
+    default_limits(&limits);
+    char* line = malloc(MAX_LINE);
+    if (argc > 0) {
+        // The arguments are joined, so the FEN may be passed as one argument or as several.
+        int length = 0;
+        for (int i = 0; i < argc && length < MAX_LINE - 1; i++) {
+            length += snprintf(line + length, MAX_LINE - length, "%s%s", length > 0 ? " " : "", argv[i]);
+        }
+        analyze(engine, &limits, line);
+    } else {
+        while (fgets(line, MAX_LINE, stdin)) {
+            line[strcspn(line, "\r\n")] = '\0';
+            if (line[strspn(line, " \t")] == '\0') continue;
+            analyze(engine, &limits, line);
+            if (options->hashfile == NULL && options->hashshm == NULL) engine_clear(engine);
+        }
+    }
+
+    free(line);
+    engine_free(engine);
+    return 0;
+}
+
+// Returns the index of the first argument which is not an option, or -1 for an unknown option.
+int parse_options(int argc, char** argv, int i, Options* options) {
+    for (; i < argc && argv[i][0] == '-' && argv[i][1] != '\0'; i++) {
+        if (strcmp(argv[i], "-shared") == 0) {
+            options->shared = true;
+            continue;
+        }
+        if (i + 1 == argc) return -1;
+        const char* value = argv[++i];
+        if (strcmp(argv[i - 1], "-depth") == 0) options->limits.depth = atoi(value);
+        else if (strcmp(argv[i - 1], "-movetime") == 0) options->limits.milliseconds = strtoull(value, NULL, 10);
+        else if (strcmp(argv[i - 1], "-nodes") == 0) options->limits.nodes = strtoull(value, NULL, 10);
+        else if (strcmp(argv[i - 1], "-threads") == 0) options->threads = atoi(value);
+        else if (strcmp(argv[i - 1], "-hash") == 0) options->hash = atoi(value);
+        else if (strcmp(argv[i - 1], "-workers") == 0) options->workers = atoi(value);
+        else if (strcmp(argv[i - 1], "-tablebases") == 0) options->tablebases = value;
+        else if (strcmp(argv[i - 1], "-nnue") == 0) options->nnue = value;
+        else if (strcmp(argv[i - 1], "-cache") == 0) options->cache = atoi(value);
+        else if (strcmp(argv[i - 1], "-snapshot") == 0) options->snapshot = value;
+        else if (strcmp(argv[i - 1], "-hashfile") == 0) options->hashfile = value;
+        else if (strcmp(argv[i - 1], "-hashshm") == 0) options->hashshm = value;
+        else return -1;
+    }
+    return i;
+}
+
+int main(int argc, char** argv) {
+    Options options = {{0, 0, 0}, 1, DEFAULT_HASH, 1, false, NULL, NULL, 0, NULL, NULL, NULL};
+    bool batch_mode = argc > 1 && strcmp(argv[1], "batch") == 0;
+    int i = parse_options(argc, argv, batch_mode ? 2 : 1, &options);
+    if (i < 0) {
+        fprintf(stderr, "Unknown option or missing value.\n");
+        return 1;
+    }
+    if (options.workers < 1) options.workers = 1;
+    // The hash table file is locked by the first engine, the others share its table, and so does a
+    // shared memory segment to keep the workers attached once.
+    if (options.hashfile != NULL || options.hashshm != NULL) options.shared = true;
+
+    if (engine_version() != ENGINE_API_VERSION) {
+        fprintf(stderr, "Engine library version %d, expected %d.\n", engine_version(), ENGINE_API_VERSION);
+        return 1;
+    }
+    if (options.tablebases != NULL) engine_load_tablebases(options.tablebases);
+    if (options.nnue != NULL && engine_load_nnue(options.nnue) != ENGINE_OK) {
+        fprintf(stderr, "Could not load %s.\n", options.nnue);
+        return 1;
+    }
+
+    if (batch_mode && i == argc) {
+        fprintf(stderr, "Usage: chess-cli batch [options] [-workers n] [-shared] <input file | -> [output file]\n");
+        return 1;
+    }
+
+    EngineCache* cache = NULL;
+    if (options.cache > 0) {
+        cache = engine_cache_new(options.cache);
+        if (cache == NULL) {
+            fprintf(stderr, "Out of memory.\n");
+            return 1;
+        }
+        if (options.snapshot != NULL) {
+            int loaded = engine_cache_load(cache, options.snapshot);
+            if (loaded >= 0) fprintf(stderr, "Loaded %d results from %s.\n", loaded, options.snapshot);
+        }
+    }
+
+    int result = 0;
+    if (batch_mode) {
+        result = batch(&options, cache, argv[i], i + 1 < argc ? argv[i + 1] : NULL);
+    } else {
+        result = analyze_positions(&options, cache, argc - i, argv + i);
+    }
+
+    if (cache != NULL) {
+        EngineCacheStats stats;
+        engine_cache_stats(cache, &stats);
+        uint64_t lookups = stats.hits + stats.misses;
+        fprintf(stderr, "Cache: %llu hits, %llu misses (%.1f%% hits), %llu of %llu entries, %llu MB.\n",
+                (unsigned long long) stats.hits, (unsigned long long) stats.misses,
+                lookups > 0 ? 100.0 * stats.hits / lookups : 0.0, (unsigned long long) stats.entries,
+                (unsigned long long) stats.capacity, (unsigned long long) stats.bytes >> 20);
+        if (options.snapshot != NULL && engine_cache_save(cache, options.snapshot) < 0) {
+            fprintf(stderr, "Could not write %s.\n", options.snapshot);
+        }
+        engine_cache_free(cache);
+    }
+    return result;
+}
\ No newline at end of file
@@ -0,0 +1,353 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "tinycthread.h"
+
+// Load generator for chess-server. Opens a number of connections which each send their share of the
+// requests, keeping a number of them in flight, then prints the throughput and the latencies seen
+// by the clients for each lane, followed by the stats of the server. Positions are read from a file,
+// one FEN per line, or a few built in ones are used. A share of the requests can be sent as bulk
+// requests and a share cancelled right after sending them.
+//
+// With -check it instead sends a fixed set of requests, including invalid ones, to a server started
+// with one worker, and checks the replies. It returns 1 if any of them is wrong.
+// Usage: chess-client [-socket path | -port n] [-connections n] [-requests n] [-inflight n]
+//                     [-bulk percent] [-cancel percent] [-depth n] [-nodes n] [-movetime ms]
+//                     [-check] [positions file]
+
+#define DEFAULT_PORT 7411
+#define MAX_LINE 65536
+#define MAX_POSITIONS 100000
+
+static const char* const DEFAULT_POSITIONS[] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r2q1rk1/pP1p2pp/Q4n2/bbp1p3/Np6/1B3NBn/pPPP1PPP/R3K2R b KQ - 0 1",
+    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+};
+
+typedef struct {
+    const char* path;
+    int port;
+    int requests; // Per connection.
+    int inflight;
+    int bulk; // Percent.
+    int cancel; // Percent.
+    char limits[128]; // JSON fields.
+} Options;
+
+typedef struct {
+    int index;
+    int answered;
+    int errors;
+    int cancelled;
+    uint64_t* sent; // Microseconds, per request.
+    uint64_t* latencies[2]; // Of the interactive and bulk requests answered with a result.
+    int n_latencies[2];
+} Client;
+
+static Options options = {NULL, DEFAULT_PORT, 100, 4, 0, 0, ""};
+static char** positions;
+static int n_positions = 0;
+
+uint64_t now() {
+    struct timespec time;
+    timespec_get(&time, TIME_UTC);
+    return (uint64_t) time.tv_sec * 1000000 + time.tv_nsec / 1000;
+}
+
+int connect_server() {
+    int server;
+    if (options.path != NULL) {
+        struct sockaddr_un address = {0};
+        address.sun_family = AF_UNIX;
+        snprintf(address.sun_path, sizeof(address.sun_path), "%s", options.path);
+        server = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (server < 0 || connect(server, (struct sockaddr*) &address, sizeof(address)) != 0) return -1;
+    } else {
+        struct sockaddr_in address = {0};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(options.port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        server = socket(AF_INET, SOCK_STREAM, 0);
+        if (server < 0 || connect(server, (struct sockaddr*) &address, sizeof(address)) != 0) return -1;
+    }
+    return server;
+}
+
+bool send_line(int server, const char* line) {
+    size_t length = strlen(line), sent = 0;
+    while (sent < length) {
+        ssize_t n = send(server, line + sent, length - sent, MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        sent += n;
+    }
+    return true;
+}
+
+// Reads the next line into line, keeping the rest of what was received in buffer.
+bool read_line(int server, char* buffer, size_t* length, char* line) {
+    while (true) {
+        char* end = memchr(buffer, '\n', *length);
+        if (end != NULL) {
+            size_t size = end - buffer;
+            memcpy(line, buffer, size);
+            line[size] = '\0';
+            memmove(buffer, end + 1, *length - size - 1);
+            *length -= size + 1;
+            return true;
+        }
+        if (*length == MAX_LINE) return false;
+        ssize_t n = recv(server, buffer + *length, MAX_LINE - *length, 0);
+        if (n <= 0) return false;
+        *length += n;
+    }
+}
+
+// Number at the end of the id of the reply, which is <connection>-<request>, or -1.
+int reply_index(const char* line) {
+    const char* id = strstr(line, "\"id\": \"");
+    if (id == NULL) return -1;
+    const char* dash = strchr(id + 7, '-');
+    return dash != NULL ? atoi(dash + 1) : -1;
+}
+
+int run_client(void* arg) {
+    Client* client = arg;
+    int server = connect_server();
+    if (server < 0) {
+        fprintf(stderr, "Could not connect.\n");
+        return 1;
+    }
+
+    char* buffer = malloc(MAX_LINE);
+    char* line = malloc(MAX_LINE);
+    size_t length = 0;
+    int sent = 0;
+    unsigned int seed = client->index * 7919 + 1;
+    while (client->answered < options.requests) {
+        while (sent < options.requests && sent - client->answered < options.inflight) {
+            bool bulk = rand_r(&seed) % 100 < options.bulk;
+            snprintf(line, MAX_LINE, "{\"id\": \"%d-%d\", \"fen\": \"%s\"%s, \"priority\": \"%s\"}\n", client->index, sent,
+                     positions[(client->index + sent) % n_positions], options.limits, bulk ? "bulk" : "interactive");
+            client->sent[sent] = now();
+            if (!send_line(server, line)) break;
+            if (rand_r(&seed) % 100 < options.cancel) {
+                snprintf(line, MAX_LINE, "{\"op\": \"cancel\", \"id\": \"%d-%d\"}\n", client->index, sent);
+                if (!send_line(server, line)) break;
+            }
+            // The lane is remembered in the sign of the send time.
+            if (bulk) client->sent[sent] |= 1ULL << 63;
+            sent++;
+        }
+
+        if (!read_line(server, buffer, &length, line)) {
+            fprintf(stderr, "Connection lost.\n");
+            break;
+        }
+        // A cancel which came too late is answered with an error, the request gets its result.
+        if (strstr(line, "\"error\": \"unknown id\"") != NULL) continue;
+        int index = reply_index(line);
+        if (index < 0 || index >= sent) continue;
+        client->answered++;
+        if (strstr(line, "\"error\"") != NULL) {
+            client->errors++;
+        } else if (strstr(line, "\"cancelled\"") != NULL) {
+            client->cancelled++;
+        } else {
+            int lane = client->sent[index] >> 63;
+            uint64_t latency = now() - (client->sent[index] & ~(1ULL << 63));
+            client->latencies[lane][client->n_latencies[lane]++] = latency;
+        }
+    }
+
+    close(server);
+    free(buffer);
+    free(line);
+    return 0;
+}
+
+typedef struct {
+    const char* request;
+    const char* reply; // Part of the expected reply.
+} Check;
+
+// In order, each answered before the next is sent, except that the cancelled searches are answered
+// when their cancel is.
+static const Check CHECKS[] = {
+    {"{\"id\": \"start\", \"depth\": 2}", "\"bestmove\": \""},
+    {"{\"id\": \"moves\", \"moves\": \"e2e4 e7e5\", \"depth\": 2}", "\"bestmove\": \""},
+    {"{\"id\": \"illegal\", \"moves\": \"e2e5\", \"depth\": 2}", "\"error\": \"illegal move\""},
+    {"{\"id\": \"fen\", \"fen\": \"8/8/8/8/8/8/8/8 w - - 0 1\"}", "\"error\": \"invalid fen\""},
+    // More material than a game can reach, which would overflow the move lists of the search.
+    {"{\"id\": \"queens\", \"fen\": \"RQ4QR/3Q4/1Q4Q1/4Q3/2Q4Q/Q4Q2/pp1Q4/kBNN1KB1 w - - 0 1\"}",
+     "\"error\": \"invalid fen\""},
+    {"{\"id\": \"pawns\", \"fen\": \"4k3/pppppppp/p7/8/8/8/PPPPPPPP/4K3 w - - 0 1\"}", "\"error\": \"invalid fen\""},
+    {"{\"id\": \"mated\", \"fen\": \"k6R/8/1K6/8/8/8/8/8 b - - 0 1\"}", "\"bestmove\": null"},
+    {"{\"op\": \"cancel\", \"id\": \"missing\"}", "\"error\": \"unknown id\""},
+    {"{\"op\": \"stats\", \"id\": \"stats\"}", "\"completed\": "},
+    // The one worker searches the first request, so the second is still queued when cancelled.
+    {"{\"id\": \"busy\", \"movetime\": 10000}", NULL},
+    {"{\"id\": \"queued\", \"depth\": 1}", NULL},
+    {"{\"op\": \"cancel\", \"id\": \"queued\"}", "{\"id\": \"queued\", \"cancelled\": true}"},
+    {"{\"op\": \"cancel\", \"id\": \"busy\"}", "{\"id\": \"busy\", \"cancelled\": true}"},
+};
+
+int run_checks() {
+    // The server may still be starting.
+    int server = -1;
+    for (int i = 0; i < 50 && (server = connect_server()) < 0; i++) usleep(100000);
+    if (server < 0) {
+        fprintf(stderr, "Could not connect.\n");
+        return 1;
+    }
+
+    char* buffer = malloc(MAX_LINE);
+    char* line = malloc(MAX_LINE);
+    size_t length = 0;
+    int n = sizeof(CHECKS) / sizeof(CHECKS[0]), failed = 0;
+    for (int i = 0; i < n; i++) {
+        snprintf(line, MAX_LINE, "%s\n", CHECKS[i].request);
+        if (!send_line(server, line)) break;
+        if (CHECKS[i].reply == NULL) continue;
+        if (!read_line(server, buffer, &length, line)) {
+            fprintf(stderr, "Connection lost.\n");
+            failed += n - i;
+            break;
+        }
+        if (strstr(line, CHECKS[i].reply) == NULL) {
+            printf("%s\n    answered %s\n    expected %s\n", CHECKS[i].request, line, CHECKS[i].reply);
+            failed++;
+        }
+    }
+    printf("%d of %d checks passed\n", n - failed, n);
+
+    close(server);
+    free(buffer);
+    free(line);
+    return failed != 0;
+}
+
+int compare_latencies(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*) a, y = *(const uint64_t*) b;
+    return (x > y) - (x < y);
+}
+
+void print_latencies(const char* lane, uint64_t* latencies, int n) {
+    if (n == 0) return;
+    qsort(latencies, n, sizeof(uint64_t), compare_latencies);
+    printf("%-12s %8d   p50 %8.1f ms   p90 %8.1f ms   p99 %8.1f ms   max %8.1f ms\n", lane, n,
+           latencies[(n - 1) * 50 / 100] / 1000.0, latencies[(n - 1) * 90 / 100] / 1000.0,
+           latencies[(n - 1) * 99 / 100] / 1000.0, latencies[n - 1] / 1000.0);
+}
+
+int main(int argc, char** argv) {
+    int n_connections = 4;
+    const char* file = NULL;
+    bool check = false;
+    int length = 0;
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] != '-') {
+            file = argv[i];
+            continue;
+        }
+        if (strcmp(argv[i], "-check") == 0) {
+            check = true;
+            continue;
+        }
+        if (i + 1 == argc) {
+            fprintf(stderr, "Missing value of %s.\n", argv[i]);
+            return 1;
+        }
+        const char* value = argv[++i];
+        if (strcmp(argv[i - 1], "-socket") == 0) options.path = value;
+        else if (strcmp(argv[i - 1], "-port") == 0) options.port = atoi(value);
+        else if (strcmp(argv[i - 1], "-connections") == 0) n_connections = atoi(value);
+        else if (strcmp(argv[i - 1], "-requests") == 0) options.requests = atoi(value);
+        else if (strcmp(argv[i - 1], "-inflight") == 0) options.inflight = atoi(value);
+        else if (strcmp(argv[i - 1], "-bulk") == 0) options.bulk = atoi(value);
+        else if (strcmp(argv[i - 1], "-cancel") == 0) options.cancel = atoi(value);
+        else if (strcmp(argv[i - 1], "-depth") == 0 || strcmp(argv[i - 1], "-nodes") == 0 || strcmp(argv[i - 1], "-movetime") == 0) {
+            length += snprintf(options.limits + length, sizeof(options.limits) - length, ", \"%s\": %s", argv[i - 1] + 1, value);
+        } else {
+            fprintf(stderr, "Unknown option %s.\n", argv[i - 1]);
+            return 1;
+        }
+    }
+    if (check) return run_checks();
+    if (n_connections < 1) n_connections = 1;
+    if (options.inflight < 1) options.inflight = 1;
+
+    positions = malloc(MAX_POSITIONS * sizeof(char*));
+    if (file != NULL) {
+        FILE* input = fopen(file, "r");
+        if (input == NULL) {
+            fprintf(stderr, "Could not open %s.\n", file);
+            return 1;
+        }
+        char line[1024];
+        while (n_positions < MAX_POSITIONS && fgets(line, sizeof(line), input)) {
+            line[strcspn(line, "\r\n")] = '\0';
+            if (line[0] != '\0' && line[0] != '#') positions[n_positions++] = strdup(line);
+        }
+        fclose(input);
+    }
+    if (n_positions == 0) {
+        for (size_t i = 0; i < sizeof(DEFAULT_POSITIONS) / sizeof(DEFAULT_POSITIONS[0]); i++) {
+            positions[n_positions++] = strdup(DEFAULT_POSITIONS[i]);
+        }
+    }
+
+    Client* clients = calloc(n_connections, sizeof(Client));
+    thrd_t* threads = malloc(n_connections * sizeof(thrd_t));
+    uint64_t start = now();
+    for (int i = 0; i < n_connections; i++) {
+        clients[i].index = i;
+        clients[i].sent = malloc(options.requests * sizeof(uint64_t));
+        for (int lane = 0; lane < 2; lane++) clients[i].latencies[lane] = malloc(options.requests * sizeof(uint64_t));
+        thrd_create(&threads[i], run_client, &clients[i]);
+    }
+    for (int i = 0; i < n_connections; i++) thrd_join(threads[i], NULL);
+    double seconds = (now() - start) / 1e6;
+
+    int answered = 0, errors = 0, cancelled = 0, n_latencies[2] = {0, 0};
+    uint64_t* latencies[2];
+    for (int lane = 0; lane < 2; lane++) latencies[lane] = malloc((size_t) n_connections * options.requests * sizeof(uint64_t));
+    for (int i = 0; i < n_connections; i++) {
+        answered += clients[i].answered;
+        errors += clients[i].errors;
+        cancelled += clients[i].cancelled;
+        for (int lane = 0; lane < 2; lane++) {
+            memcpy(latencies[lane] + n_latencies[lane], clients[i].latencies[lane], clients[i].n_latencies[lane] * sizeof(uint64_t));
+            n_latencies[lane] += clients[i].n_latencies[lane];
+        }
+    }
+
+    printf("%d requests answered in %.2f s, %.1f per second, %d errors, %d cancelled\n", answered, seconds,
+           answered / seconds, errors, cancelled);
+    print_latencies("interactive", latencies[0], n_latencies[0]);
+    print_latencies("bulk", latencies[1], n_latencies[1]);
+
+    int server = connect_server();
+    if (server >= 0) {
+        char* buffer = malloc(MAX_LINE);
+        char* line = malloc(MAX_LINE);
+        size_t received = 0;
+        if (send_line(server, "{\"op\": \"stats\", \"id\": \"stats\"}\n") && read_line(server, buffer, &received, line)) {
+            printf("server %s\n", line);
+        }
+        close(server);
+        free(buffer);
+        free(line);
+    }
+    return 0;
+}
\ No newline at end of file
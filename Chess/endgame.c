@@ -0,0 +1,216 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "tinycthread.h"
+#include "endgame.h"
+#include "bitboard.h"
+#include "board.h"
+#include "evaluate.h"
+
+// Results during the retrograde analysis, as bits so the results of all moves can be or'ed together.
+#define KPK_INVALID 0
+#define KPK_UNKNOWN 1
+#define KPK_DRAW 2
+#define KPK_WIN 4
+
+#define PAWN_ATTACKS(x) ((((1ULL << (x)) & ~FILEA) << 9) | (((1ULL << (x)) & ~FILEH) << 7))
+// Squares of the same color have the same parity of rank plus file.
+#define SQUARE_COLOR(x) ((((x) >> 3) + (x)) & 1)
+
+// One bit per position, set if the side with the pawn wins.
+static uint32_t kpk_bitbase[KPK_SIZE / 32];
+static once_flag kpk_flag = ONCE_FLAG_INIT;
+
+// Positions with white to move have even indices. The pawn is white and on one of the files H to E,
+// which are the files 0 to 3 of the board, and ranks 2 to 7.
+INLINE int kpk_index(int black_to_move, int white_king, int black_king, int pawn) {
+    return black_to_move | (black_king << 1) | (white_king << 7) | ((pawn & 7) << 13) | ((6 - (pawn >> 3)) << 15);
+}
+
+// Result of a position without looking at its moves: invalid positions, immediate promotions and
+// positions where black captures the pawn or is stalemated.
+static uint8_t kpk_initial(int black_to_move, int white_king, int black_king, int pawn) {
+    if (white_king == black_king || white_king == pawn || black_king == pawn) return KPK_INVALID;
+    if ((KING_MOVES[white_king] & (1ULL << black_king)) != 0) return KPK_INVALID;
+    // Black can not be in check with white to move.
+    if (!black_to_move && (PAWN_ATTACKS(pawn) & (1ULL << black_king)) != 0) return KPK_INVALID;
+
+    if (!black_to_move && (pawn >> 3) == 6) {
+        Bitboard promotion = 1ULL << (pawn + 8);
+        // The pawn promotes and the black king can not take the new queen.
+        if (white_king != pawn + 8 && black_king != pawn + 8 &&
+            ((KING_MOVES[black_king] & promotion) == 0 || (KING_MOVES[white_king] & promotion) != 0)) {
+            return KPK_WIN;
+        }
+    }
+
+    if (black_to_move) {
+        Bitboard safe = KING_MOVES[black_king] & ~(KING_MOVES[white_king] | PAWN_ATTACKS(pawn));
+        if (safe == 0) return KPK_DRAW; // Stalemate, a lone pawn can not give mate.
+        if ((safe & (1ULL << pawn)) != 0) return KPK_DRAW; // The pawn is taken.
+    }
+
+    return KPK_UNKNOWN;
+}
+
+// Result of a position from the results of its moves. Moves into invalid positions add nothing.
+static uint8_t kpk_classify(const uint8_t* results, int black_to_move, int white_king, int black_king, int pawn) {
+    uint8_t r = KPK_INVALID;
+
+    if (!black_to_move) {
+        Bitboard moves = KING_MOVES[white_king];
+        while (moves != 0) {
+            r |= results[kpk_index(1, LSB(moves), black_king, pawn)];
+            moves &= moves - 1;
+        }
+        // Promotions were handled by kpk_initial.
+        if ((pawn >> 3) < 6) {
+            r |= results[kpk_index(1, white_king, black_king, pawn + 8)];
+            if ((pawn >> 3) == 1 && pawn + 8 != white_king && pawn + 8 != black_king) {
+                r |= results[kpk_index(1, white_king, black_king, pawn + 16)];
+            }
+        }
+        return (r & KPK_WIN) ? KPK_WIN : (r & KPK_UNKNOWN) ? KPK_UNKNOWN : KPK_DRAW;
+    }
+
+    Bitboard moves = KING_MOVES[black_king];
+    while (moves != 0) {
+        r |= results[kpk_index(0, white_king, LSB(moves), pawn)];
+        moves &= moves - 1;
+    }
+    return (r & KPK_DRAW) ? KPK_DRAW : (r & KPK_UNKNOWN) ? KPK_UNKNOWN : KPK_WIN;
+}
+
+// Starts from the positions whose result is immediate and repeats passes over the rest until
+// nothing changes. Whatever is still unknown then is a draw.
+static void generate_kpk() {
+    uint8_t* results = malloc(KPK_SIZE);
+
+    for (int i = 0; i < KPK_SIZE; i++) {
+        int pawn = ((6 - (i >> 15)) << 3) | ((i >> 13) & 3);
+        results[i] = kpk_initial(i & 1, (i >> 7) & 63, (i >> 1) & 63, pawn);
+    }
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int i = 0; i < KPK_SIZE; i++) {
+            if (results[i] != KPK_UNKNOWN) continue;
+            int pawn = ((6 - (i >> 15)) << 3) | ((i >> 13) & 3);
+            results[i] = kpk_classify(results, i & 1, (i >> 7) & 63, (i >> 1) & 63, pawn);
+            changed |= results[i] != KPK_UNKNOWN;
+        }
+    }
+
+    for (int i = 0; i < KPK_SIZE; i++) {
+        if (results[i] == KPK_WIN) kpk_bitbase[i / 32] |= 1U << (i % 32);
+    }
+    free(results);
+}
+
+void init_endgames() {
+    call_once(&kpk_flag, generate_kpk);
+}
+
+// Squares are from the point of view of the side with the pawn, as if it was white.
+bool kpk_win(int strong_king, int pawn, int weak_king, bool strong_to_move) {
+    // Mirror pawns on the files D to A onto the files E to H.
+    if ((pawn & 7) > 3) {
+        strong_king ^= 7;
+        pawn ^= 7;
+        weak_king ^= 7;
+    }
+    int i = kpk_index(!strong_to_move, strong_king, weak_king, pawn);
+    return (kpk_bitbase[i / 32] >> (i % 32)) & 1;
+}
+
+// Lone king against a king with at most one minor piece or two knights, none of which can force mate.
+INLINE bool drawn_material(Board* board) {
+    for (int i = 0; i < 2; i++) {
+        Piece strong = i == 0 ? WHITE : BLACK;
+        Piece weak = OPPOSITE(strong);
+        if (get_pieces_color(board, weak) != get_pieces(board, KING, weak)) continue;
+
+        int knights = COUNT(get_pieces(board, KNIGHT, strong));
+        int bishops = COUNT(get_pieces(board, BISHOP, strong));
+        if (knights + bishops <= 1 || (knights == 2 && bishops == 0)) return true;
+    }
+    return false;
+}
+
+// Only rook pawns and a bishop which does not control the promotion square, with the defending king
+// in front of them in the corner.
+INLINE bool wrong_bishop(Board* board, Piece strong) {
+    Piece weak = OPPOSITE(strong);
+    if (get_pieces_color(board, weak) != get_pieces(board, KING, weak)) return false;
+
+    Bitboard pawns = get_pieces(board, PAWN, strong);
+    Bitboard bishops = get_pieces(board, BISHOP, strong);
+    if (pawns == 0 || COUNT(bishops) != 1) return false;
+    if ((pawns | bishops | get_pieces(board, KING, strong)) != get_pieces_color(board, strong)) return false;
+
+    int corner;
+    if ((pawns & ~FILEA) == 0) {
+        corner = strong == WHITE ? A8 : A1;
+    } else if ((pawns & ~FILEH) == 0) {
+        corner = strong == WHITE ? H8 : H1;
+    } else {
+        return false;
+    }
+    if (SQUARE_COLOR(LSB(bishops)) == SQUARE_COLOR(corner)) return false;
+
+    Bitboard fortress = KING_MOVES[corner] | (1ULL << corner);
+    return (get_pieces(board, KING, weak) & fortress) != 0;
+}
+
+bool probe_endgame(Board* board, int* score) {
+    if ((board->state[ROOK] | board->state[QUEEN]) != 0) return false;
+
+    Bitboard pawns = board->state[PAWN];
+    if (pawns == 0) {
+        if (!drawn_material(board)) return false;
+        *score = 0;
+        return true;
+    }
+
+    if (COUNT(get_all_pieces(board)) == 3) {
+        Piece strong = (pawns & get_pieces_color(board, WHITE)) != 0 ? WHITE : BLACK;
+        int strong_king = LSB(get_pieces(board, KING, strong));
+        int weak_king = LSB(get_pieces(board, KING, OPPOSITE(strong)));
+        int pawn = LSB(pawns);
+        // Flip the board so the pawn moves up.
+        if (strong == BLACK) {
+            strong_king ^= 56;
+            weak_king ^= 56;
+            pawn ^= 56;
+        }
+
+        bool strong_to_move = board->active_color == strong;
+        if (!kpk_win(strong_king, pawn, weak_king, strong_to_move)) {
+            *score = 0;
+            return true;
+        }
+        // Prefer the wins with the pawn further up, so the search keeps pushing it.
+        *score = KNOWN_WIN + PAWN_VALUE * (pawn >> 3);
+        if (!strong_to_move) *score = -*score;
+        return true;
+    }
+
+    if (wrong_bishop(board, WHITE) || wrong_bishop(board, BLACK)) {
+        *score = 0;
+        return true;
+    }
+    return false;
+}
+
+// Endings with only a bishop of opposite color each and pawns are often drawn even a few pawns down.
+int endgame_scale(Board* board) {
+    if ((board->state[KNIGHT] | board->state[ROOK] | board->state[QUEEN]) != 0) return SCALE_NORMAL;
+
+    Bitboard white = get_pieces(board, BISHOP, WHITE);
+    Bitboard black = get_pieces(board, BISHOP, BLACK);
+    if (COUNT(white) != 1 || COUNT(black) != 1) return SCALE_NORMAL;
+    if (SQUARE_COLOR(LSB(white)) == SQUARE_COLOR(LSB(black))) return SCALE_NORMAL;
+
+    return SCALE_OPPOSITE_BISHOPS;
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#ifndef ENDGAME_H_
+#define ENDGAME_H_
+
+#include <stdbool.h>
+#include "board.h"
+
+// Endings whose result is known without searching them.
+//
+// King and pawn against king is looked up in a bitbase built by retrograde analysis in init_endgames.
+// It has one bit per position: side to move, both kings and the pawn on one of 24 squares (files A-D
+// of ranks 2-7, other pawns are mirrored onto them), 196608 bits in all. Bare kings, a single minor
+// piece, two knights and a bishop with rook pawns of the wrong color are recognized as draws.
+
+#define KPK_SIZE (2 * 64 * 64 * 24)
+
+// Score of a won ending, from the winning side's point of view. Far below the checkmate scores, so a
+// found mate is still preferred.
+#define KNOWN_WIN 20000
+
+// Evaluation scale factors, out of SCALE_NORMAL.
+#define SCALE_NORMAL 64
+#define SCALE_OPPOSITE_BISHOPS 32
+
+// Builds the bitbase. Must be called once before probe_endgame, it is safe to call again.
+void init_endgames();
+
+bool kpk_win(int strong_king, int pawn, int weak_king, bool strong_to_move);
+
+// Returns true and the score from the side to move's point of view if the ending is known.
+bool probe_endgame(Board* board, int* score);
+
+// How much of the evaluation to keep in endings which are more drawish than the material suggests.
+int endgame_scale(Board* board);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,384 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include "engine.h"
+#include "tinycthread.h"
+#include "bitboard.h"
+#include "board.h"
+#include "move.h"
+#include "evaluate.h"
+#include "search.h"
+#include "hashmap.h"
+#include "nnue.h"
+#include "tablebase.h"
+#include "resultcache.h"
+
+#define START_FEN "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+#define NNUE_CACHE_KEY 0x9e3779b97f4a7c15ULL
+
+struct Engine {
+    Board board;
+    HashMap* hashmap;
+    bool shared; // The hashmap belongs to another engine.
+    int threads;
+    EngineCache* cache; // NULL if none.
+    bool stop;
+    bool cancelled; // Stopped by engine_stop rather than a limit, the result is not cached.
+};
+
+typedef struct {
+    bool* stop;
+    bool* finished;
+    uint64_t start; // Milliseconds.
+    uint64_t budget;
+} Timer;
+
+typedef struct {
+    EngineCallback callback;
+    void* data;
+    SearchReport last; // Of the last completed iteration.
+} Reporter;
+
+static uint64_t now() {
+    struct timespec time;
+    timespec_get(&time, TIME_UTC);
+    return (uint64_t) time.tv_sec * 1000 + time.tv_nsec / 1000000;
+}
+
+int engine_version() {
+    return ENGINE_API_VERSION;
+}
+
+// Largest power of two number of entries which fits into the given number of megabytes, the size of
+// the hashmap is an int.
+static int hash_size(int megabytes) {
+    int size = 0;
+    while (size < 30 && (sizeof(Item) << (size + 1)) <= (uint64_t) MAX(megabytes, 1) << 20) size++;
+    return size;
+}
+
+static Engine* engine_init(HashMap* hashmap, int threads) {
+    Engine* engine = malloc(sizeof(Engine));
+    if (engine == NULL) {
+        hashmap_free(hashmap);
+        return NULL;
+    }
+    init_magic_tables();
+    engine->hashmap = hashmap;
+    engine->shared = false;
+    engine->cache = NULL;
+    engine->threads = MIN(MAX(threads, 1), MAX_THREADS);
+    engine->stop = false;
+    board_from_fen(&engine->board, START_FEN);
+    return engine;
+}
+
+Engine* engine_new(int hash_megabytes, int threads) {
+    HashMap* hashmap = hashmap_alloc(hash_size(hash_megabytes));
+    if (hashmap->data == NULL) {
+        hashmap_free(hashmap);
+        return NULL;
+    }
+    return engine_init(hashmap, threads);
+}
+
+Engine* engine_new_file(const char* path, int hash_megabytes, int threads) {
+    HashMap* hashmap = hashmap_open(path, hash_size(hash_megabytes));
+    if (hashmap == NULL) return NULL;
+    return engine_init(hashmap, threads);
+}
+
+Engine* engine_new_attached(const char* name, int hash_megabytes, int threads) {
+    HashMap* hashmap = hashmap_attach(name, hash_size(hash_megabytes));
+    if (hashmap == NULL) return NULL;
+    return engine_init(hashmap, threads);
+}
+
+Engine* engine_new_shared(Engine* other, int threads) {
+    Engine* engine = malloc(sizeof(Engine));
+    if (engine == NULL) return NULL;
+    engine->hashmap = other->hashmap;
+    engine->shared = true;
+    engine->cache = NULL;
+    engine->threads = MIN(MAX(threads, 1), MAX_THREADS);
+    engine->stop = false;
+    board_from_fen(&engine->board, START_FEN);
+    return engine;
+}
+
+void engine_free(Engine* engine) {
+    if (!engine->shared) hashmap_free(engine->hashmap);
+    free(engine);
+}
+
+void engine_clear(Engine* engine) {
+    hashmap_clear(engine->hashmap);
+}
+
+static bool parse_move(Board* board, const char* text, int length, Move* move) {
+    Move moves[MAX_MOVES];
+    int n_moves = gen_moves(board, moves);
+    for (int i = 0; i < n_moves; i++) {
+        char name[ENGINE_MOVE_LENGTH];
+        move_to_string(moves[i], name);
+        if ((int) strlen(name) == length && strncmp(name, text, length) == 0) {
+            *move = moves[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+// Number of moves at the start of the line which are legal when played in turn from the position.
+static int legal_length(Board board, const Move* pv, int length) {
+    for (int i = 0; i < length; i++) {
+        Move moves[MAX_MOVES];
+        int n_moves = gen_moves(&board, moves);
+        int j = 0;
+        while (j < n_moves && moves[j] != pv[i]) j++;
+        if (j == n_moves) return i;
+        make_move(&board, &moves[j]);
+    }
+    return length;
+}
+
+// Order of the piece counts of a side.
+static const char PIECE_LETTERS[] = "PNBRQK";
+
+// Whether a side has no more pieces than it can have in a game: at most 8 pawns, and no more pieces
+// promoted from the missing ones. Move generation relies on this to stay within MAX_MOVES.
+static bool possible_material(const int* counts) {
+    int pawns = counts[0];
+    int promoted = 0;
+    for (int i = 1; i <= 3; i++) {
+        if (counts[i] > 2) promoted += counts[i] - 2;
+    }
+    if (counts[4] > 1) promoted += counts[4] - 1;
+    return pawns <= 8 && promoted <= 8 - pawns;
+}
+
+// board_from_fen trusts its input, so the FEN is checked and written out again in full, with the
+// move counters added if they are missing.
+static bool normalize_fen(const char* fen, char* normalized) {
+    char placement[80], side[2], castling[5], en_passant[3];
+    int half_moves = 0, full_moves = 1;
+    int n = sscanf(fen, "%79s %1s %4s %2s %d %d", placement, side, castling, en_passant, &half_moves, &full_moves);
+    if (n < 4) return false;
+
+    int rank = 0, file = 0, counts[2][6] = {{0}};
+    for (const char* c = placement; *c != '\0'; c++) {
+        if (*c == '/') {
+            if (file != 8) return false;
+            rank++;
+            file = 0;
+        } else if (*c >= '1' && *c <= '8') {
+            file += *c - '0';
+        } else if (strchr("pnbrqkPNBRQK", *c) != NULL) {
+            if ((*c == 'p' || *c == 'P') && (rank == 0 || rank == 7)) return false;
+            counts[islower(*c) ? 1 : 0][strchr(PIECE_LETTERS, toupper(*c)) - PIECE_LETTERS]++;
+            file++;
+        } else {
+            return false;
+        }
+        if (file > 8) return false;
+    }
+    if (rank != 7 || file != 8 || counts[0][5] != 1 || counts[1][5] != 1) return false;
+    if (!possible_material(counts[0]) || !possible_material(counts[1])) return false;
+
+    if (strcmp(side, "w") != 0 && strcmp(side, "b") != 0) return false;
+    if (strcmp(castling, "-") != 0 && strspn(castling, "KQkq") != strlen(castling)) return false;
+    if (strcmp(en_passant, "-") != 0 &&
+        (en_passant[0] < 'a' || en_passant[0] > 'h' || (en_passant[1] != '3' && en_passant[1] != '6'))) return false;
+    if (half_moves < 0 || full_moves < 1) return false;
+
+    snprintf(normalized, ENGINE_FEN_LENGTH, "%s %s %s %s %d %d", placement, side, castling, en_passant, half_moves, full_moves);
+    return true;
+}
+
+int engine_set_position(Engine* engine, const char* fen, const char* moves) {
+    char normalized[ENGINE_FEN_LENGTH];
+    if (fen != NULL && !normalize_fen(fen, normalized)) return ENGINE_INVALID_FEN;
+
+    Board board;
+    board_from_fen(&board, fen != NULL ? normalized : START_FEN);
+    // The side which just moved can not be left in check.
+    Board passed = board;
+    passed.active_color = OPPOSITE(passed.active_color);
+    if (is_in_check(&passed)) return ENGINE_INVALID_FEN;
+
+    while (moves != NULL && *moves != '\0') {
+        moves += strspn(moves, " \t");
+        int length = strcspn(moves, " \t");
+        if (length == 0) break;
+        Move move;
+        if (!parse_move(&board, moves, length, &move)) return ENGINE_ILLEGAL_MOVE;
+        make_move(&board, &move);
+        moves += length;
+    }
+
+    engine->board = board;
+    return ENGINE_OK;
+}
+
+void engine_get_position(Engine* engine, char* fen) {
+    board_to_fen(&engine->board, fen);
+}
+
+int engine_play_move(Engine* engine, const char* move) {
+    Move parsed;
+    if (!parse_move(&engine->board, move, strlen(move), &parsed)) return ENGINE_ILLEGAL_MOVE;
+    make_move(&engine->board, &parsed);
+    return ENGINE_OK;
+}
+
+int engine_legal_moves(Engine* engine, char moves[][ENGINE_MOVE_LENGTH]) {
+    Move legal[MAX_MOVES];
+    int n_moves = gen_moves(&engine->board, legal);
+    for (int i = 0; i < n_moves; i++) move_to_string(legal[i], moves[i]);
+    return n_moves;
+}
+
+int engine_evaluate(Engine* engine) {
+    Board board = engine->board;
+    if (nnue_enabled) nnue_refresh(&board);
+    AttackInfo info;
+    gen_attack_info(&board, &info);
+    // evaluate scores from the point of view of white.
+    int score = evaluate(&board, &info);
+    return WHITE_TO_MOVE(&board) ? score : -score;
+}
+
+static void to_info(const SearchReport* report, EngineInfo* info) {
+    info->depth = report->depth;
+    info->score = report->score;
+    info->mate = 0;
+    // Mate scores count plies from the root, the interface counts moves.
+    if (report->score > CHECKMATE - MAX_SEARCH_DEPTH * 2) {
+        info->mate = (CHECKMATE - report->score + 1) / 2;
+        info->score = 0;
+    } else if (report->score < -CHECKMATE + MAX_SEARCH_DEPTH * 2) {
+        info->mate = -(CHECKMATE + report->score) / 2;
+        info->score = 0;
+    }
+    info->nodes = report->nodes;
+    info->milliseconds = report->milliseconds;
+    info->pv_length = MIN(report->pv_length, ENGINE_MAX_PV);
+    for (int i = 0; i < info->pv_length; i++) move_to_string(report->pv[i], info->pv[i]);
+}
+
+static void report_iteration(const SearchReport* report, void* data) {
+    Reporter* reporter = data;
+    reporter->last = *report;
+    EngineInfo info;
+    to_info(report, &info);
+    if (reporter->callback != NULL) reporter->callback(&info, reporter->data);
+}
+
+static int watch_time(void* arg) {
+    Timer* timer = arg;
+    struct timespec wait = {0, 1000000};
+    while (!*timer->finished && !*timer->stop) {
+        if (now() - timer->start >= timer->budget) {
+            *timer->stop = true;
+            break;
+        }
+        thrd_sleep(&wait, NULL);
+    }
+    return 0;
+}
+
+int engine_search(Engine* engine, const EngineLimits* limits, EngineCallback callback, void* data,
+                  char* best, char* ponder, EngineInfo* info) {
+    uint64_t start = now();
+    Board board = engine->board;
+    if (nnue_enabled) nnue_refresh(&board);
+    engine->stop = false;
+    engine->cancelled = false;
+    best[0] = '\0';
+    ponder[0] = '\0';
+
+    Move move = NULL_MOVE;
+    Reporter reporter = {callback, data, {0}};
+    uint64_t elapsed;
+    // The two evaluators find different results.
+    uint64_t key = position_key(&board) ^ (nnue_enabled ? NNUE_CACHE_KEY : 0);
+    CachedResult cached;
+    // A cached line is checked against the position, since it may come from a damaged snapshot, or
+    // from a different position with the same key.
+    if (engine->cache != NULL && cache_get(engine->cache, key, limits, &cached) &&
+        (cached.pv_length = legal_length(board, cached.pv, cached.pv_length)) > 0) {
+        reporter.last = (SearchReport) {cached.depth, cached.score, cached.nodes, cached.milliseconds, cached.pv_length};
+        memcpy(reporter.last.pv, cached.pv, cached.pv_length * sizeof(Move));
+        move = cached.pv[0];
+        elapsed = cached.milliseconds;
+    } else if (tb_probe_root(&board, &move)) {
+        // Won and lost endings in the tablebases are played from them without searching.
+        reporter.last.pv_length = 1;
+        reporter.last.pv[0] = move;
+        elapsed = now() - start;
+    } else {
+        bool finished = false;
+        Timer timer = {&engine->stop, &finished, start, limits->milliseconds};
+        thrd_t timer_thread;
+        if (limits->milliseconds > 0) thrd_create(&timer_thread, watch_time, &timer);
+
+        SearchLimits search_limits = {limits->depth, limits->nodes, engine->threads};
+        bool found = search_position(&board, engine->hashmap, &search_limits, &engine->stop, report_iteration,
+                                     &reporter, &move);
+        finished = true;
+        if (limits->milliseconds > 0) thrd_join(timer_thread, NULL);
+        if (!found) return ENGINE_NO_MOVES;
+        elapsed = now() - start;
+        // The move, score, depth and line all come from the last completed iteration. A search stopped
+        // before completing one plays a legal move without a line.
+        bool completed = reporter.last.depth > 0 && reporter.last.pv[0] == move;
+        if (reporter.last.pv_length == 0) {
+            reporter.last.pv_length = 1;
+            reporter.last.pv[0] = move;
+        }
+
+        // Only that iteration is stored, with the nodes and time it took rather than those of the
+        // search, since the rest of the search was stopped partway.
+        if (engine->cache != NULL && !engine->cancelled && completed) {
+            SearchReport* last = &reporter.last;
+            cached = (CachedResult) {key, last->score, last->depth, last->pv_length, last->nodes, last->milliseconds};
+            memcpy(cached.pv, last->pv, last->pv_length * sizeof(Move));
+            cache_put(engine->cache, &cached);
+        }
+    }
+
+    move_to_string(move, best);
+    if (reporter.last.pv_length > 1) move_to_string(reporter.last.pv[1], ponder);
+    if (info != NULL) {
+        to_info(&reporter.last, info);
+        info->milliseconds = elapsed;
+    }
+    return ENGINE_OK;
+}
+
+void engine_stop(Engine* engine) {
+    engine->cancelled = true;
+    engine->stop = true;
+}
+
+void engine_set_cache(Engine* engine, EngineCache* cache) {
+    engine->cache = cache;
+}
+
+int engine_load_tablebases(const char* path) {
+    return tb_init(path);
+}
+
+int engine_load_nnue(const char* path) {
+    if (path == NULL) {
+        nnue_enable(false);
+        return ENGINE_OK;
+    }
+    if (!nnue_load(path)) return ENGINE_NOT_FOUND;
+    nnue_enable(true);
+    return ENGINE_OK;
+}
\ No newline at end of file
@@ -0,0 +1,154 @@
+#ifndef ENGINE_H_
+#define ENGINE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Stable C interface of the engine library (libchess.a and libchess.so, see make lib), for programs
+// which link the engine in instead of talking UCI to it. The header only uses standard C types and
+// the Engine structure is opaque, so programs built against it keep working as the engine changes.
+// Only the functions declared here are exported from the shared library.
+//
+// Moves are written in coordinate notation, like e2e4 or e7e8q. An engine holds a position and a
+// hash table of its own, so several engines can search at the same time on different threads. The
+// tablebases and the NNUE weights are shared by all engines of the process.
+//
+// All functions return ENGINE_OK or a negative error code, except where noted.
+
+#define ENGINE_API_VERSION 1
+
+#if defined(_WIN32)
+#define ENGINE_API __declspec(dllexport)
+#elif defined(__GNUC__)
+#define ENGINE_API __attribute__((visibility("default")))
+#else
+#define ENGINE_API
+#endif
+
+#define ENGINE_OK 0
+#define ENGINE_INVALID_FEN -1
+#define ENGINE_ILLEGAL_MOVE -2
+#define ENGINE_NO_MOVES -3 // The side to move is mated or stalemated.
+#define ENGINE_NOT_FOUND -4 // A file could not be read or written.
+
+#define ENGINE_MAX_PV 64
+#define ENGINE_MAX_MOVES 256
+#define ENGINE_MOVE_LENGTH 6 // Longest move in coordinate notation, with the terminating 0.
+#define ENGINE_FEN_LENGTH 128
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct Engine Engine;
+
+// Limits of engine_search, 0 for no limit. A search without any limit runs until engine_stop.
+typedef struct {
+    int depth;
+    uint64_t nodes;
+    uint64_t milliseconds;
+} EngineLimits;
+
+// State of a search, reported after every completed iteration and returned at its end.
+typedef struct {
+    int depth;
+    int score; // Centipawns from the point of view of the side to move, 0 if mate is set.
+    int mate; // Moves to mate, negative if the side to move gets mated, 0 for no mate.
+    uint64_t nodes;
+    uint64_t milliseconds;
+    int pv_length;
+    char pv[ENGINE_MAX_PV][ENGINE_MOVE_LENGTH];
+} EngineInfo;
+
+typedef void (*EngineCallback)(const EngineInfo* info, void* data);
+
+// Results of finished searches, shared by any number of engines, see engine_set_cache.
+typedef struct EngineCache EngineCache;
+
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t stores;
+    uint64_t evictions;
+    uint64_t entries;
+    uint64_t capacity; // Entries.
+    uint64_t bytes;
+} EngineCacheStats;
+
+// API version the library was built with, compare with ENGINE_API_VERSION.
+ENGINE_API int engine_version();
+
+// Creates an engine with a hash table of at most hash_megabytes and the number of threads every
+// search uses, set up in the starting position. Returns NULL if out of memory.
+ENGINE_API Engine* engine_new(int hash_megabytes, int threads);
+// Creates an engine whose hash table is kept in a memory mapped file, so a later run which opens
+// the same file starts with the results of this one. Stored results count for a little less depth
+// each time the file is opened, and a file written with another size or by an incompatible build is
+// emptied. The file is locked while the engine uses it. engine_clear empties it. Returns NULL if the
+// file can not be created, mapped or locked.
+ENGINE_API Engine* engine_new_file(const char* path, int hash_megabytes, int threads);
+// Creates an engine whose hash table is in the POSIX shared memory segment of the name, like /chess,
+// shared with the engines of every process which attaches to it with the same size. A process which
+// crashes leaves the others running, and the segment is removed when the last engine using it is
+// freed. engine_clear empties it for all of them. Returns NULL if the segment can not be created or
+// mapped, if it is in use with another size or by an incompatible build, and on Windows.
+ENGINE_API Engine* engine_new_attached(const char* name, int hash_megabytes, int threads);
+// Creates an engine which shares the hash table of another, so engines searching related positions
+// on different threads reuse each other's results. The other engine must be freed last, and
+// engine_clear of either clears the table of both.
+ENGINE_API Engine* engine_new_shared(Engine* other, int threads);
+ENGINE_API void engine_free(Engine* engine);
+// Empties the hash table, for a new game.
+ENGINE_API void engine_clear(Engine* engine);
+
+// Sets up the position of the FEN, or the starting position if fen is NULL, and plays the moves,
+// separated by spaces, if moves is not NULL. The position is not changed if anything is invalid. A
+// FEN is also invalid if a side has more pawns and promoted pieces than it can have in a game.
+ENGINE_API int engine_set_position(Engine* engine, const char* fen, const char* moves);
+// Writes the FEN of the current position, at most ENGINE_FEN_LENGTH characters.
+ENGINE_API void engine_get_position(Engine* engine, char* fen);
+ENGINE_API int engine_play_move(Engine* engine, const char* move);
+// Writes the legal moves of the position. Returns their number.
+ENGINE_API int engine_legal_moves(Engine* engine, char moves[][ENGINE_MOVE_LENGTH]);
+// Static evaluation in centipawns from the point of view of the side to move.
+ENGINE_API int engine_evaluate(Engine* engine);
+
+// Searches the position until a limit is reached or engine_stop is called, and writes the best
+// move and, if the line is long enough, the expected reply (or an empty string). Calls callback,
+// if not NULL, on the searching thread after every completed iteration. info may be NULL.
+// Positions won or lost in the tablebases are played from them without a search.
+ENGINE_API int engine_search(Engine* engine, const EngineLimits* limits, EngineCallback callback, void* data,
+                             char* best, char* ponder, EngineInfo* info);
+// Ends the search of the engine as soon as possible, can be called from any thread.
+ENGINE_API void engine_stop(Engine* engine);
+
+// Creates a cache of search results using at most megabytes of memory, all allocated up front.
+// Returns NULL if out of memory. It is thread safe and must be freed after the engines using it.
+ENGINE_API EngineCache* engine_cache_new(int megabytes);
+ENGINE_API void engine_cache_free(EngineCache* cache);
+// Lets the engine answer searches from the cache, or stop using one if cache is NULL. A search is
+// answered from it if a result for the position reached the depth, nodes or time of any of the
+// limits of the search, and is then returned as it was searched, without calling the callback.
+// The last completed iteration of searches which were not stopped by engine_stop is stored in it,
+// with the nodes and time it took.
+ENGINE_API void engine_set_cache(Engine* engine, EngineCache* cache);
+ENGINE_API void engine_cache_stats(EngineCache* cache, EngineCacheStats* stats);
+// Writes all results to a file, to warm the cache of a later run with engine_cache_load. Returns the
+// number of results written, or ENGINE_NOT_FOUND if the file can not be written.
+ENGINE_API int engine_cache_save(EngineCache* cache, const char* path);
+// Adds the results of a file written by engine_cache_save of the same build. Returns their number,
+// or ENGINE_NOT_FOUND if the file is missing or was written by another build.
+ENGINE_API int engine_cache_load(EngineCache* cache, const char* path);
+
+// Memory maps the tablebases in a directory for all engines, replacing any loaded before. Returns
+// their number. Must not be called while any engine is searching, like engine_load_nnue.
+ENGINE_API int engine_load_tablebases(const char* path);
+// Loads the NNUE weights and switches all engines to them, or back to the classical evaluation if
+// path is NULL. Returns ENGINE_NOT_FOUND if the file is missing or invalid.
+ENGINE_API int engine_load_nnue(const char* path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
\ No newline at end of file
@@ -2,77 +2,98 @@
 #include "bitboard.h"
 #include "board.h"
 #include "move.h"
+#include "pawns.h"
+#include "nnue.h"
+#include "endgame.h"
 
-int evaluate(Board* board) {
-    Piece active = board->active_color;
-    Piece inactive = OPPOSITE(board->active_color);
+// Material and piece square sums are kept in the board by add_piece and remove_piece, so this only
+// adds them up and blends the middle and end game tables by the game phase. Mobility and king
+// attacks come from the attack sets the search already computed for the node.
+INLINE int evaluate_color(Board* board, const AttackInfo* info, const Piece active) {
+    Piece inactive = OPPOSITE(active);
+
+    const PawnEntry* pawns = probe_pawns(board);
 
     int material = material_eval(board, active) - material_eval(board, inactive);
-    int pawn_structure = pawn_structure_eval(board, inactive) - pawn_structure_eval(board, active);
-    int development = piece_square_eval(board, active) - piece_square_eval(board, inactive);
+    int rooks = rook_file_eval(board, pawns, active) - rook_file_eval(board, pawns, inactive);
     int king_safety = king_safety_eval(board, active) - king_safety_eval(board, inactive);
+    int mobility = mobility_eval(board, info, active) - mobility_eval(board, info, inactive);
+    int king_attacks = king_attack_eval(board, info, active) - king_attack_eval(board, info, inactive);
+    int middle_game = board->middle_game[active & 1] - board->middle_game[inactive & 1];
+    int end_game = board->end_game[active & 1] - board->end_game[inactive & 1];
+
+    // Promotions can push the phase past its starting value.
+    int phase = board->phase < MAX_PHASE ? board->phase : MAX_PHASE;
+    int pawn_sign = active == WHITE ? 1 : -1;
+    middle_game = middle_game * DEVELOPMENT_BONUS + pawn_sign * pawns->middle_game + king_attacks;
+    end_game = end_game * DEVELOPMENT_BONUS + pawn_sign * pawns->end_game + mop_up_eval(board, active);
 
     int score = 0;
     score += material;
-    score += PAWN_STRUCTURE_BONUS * pawn_structure;
-    score += DEVELOPMENT_BONUS * development;
+    score += rooks;
     score += KING_SAFETY_BONUS * king_safety;
-    score += mop_up_eval(board, material, active);
+    score += mobility;
+    score += (middle_game * phase + end_game * (MAX_PHASE - phase)) / MAX_PHASE;
 
     return active == WHITE ? score : -score;
 }
 
-int material_eval(Board* board, Piece color) {
-    int score = 0;
+// Only the terms the board keeps up to date: material and the blended piece square sums. The rest of
+// evaluate_color differs from this by at most LAZY_MARGIN in the positions margingen looked at.
+INLINE int lazy_color(Board* board, const Piece active) {
+    Piece inactive = OPPOSITE(active);
+
+    int material = material_eval(board, active) - material_eval(board, inactive);
+    int middle_game = (board->middle_game[active & 1] - board->middle_game[inactive & 1]) * DEVELOPMENT_BONUS;
+    int end_game = (board->end_game[active & 1] - board->end_game[inactive & 1]) * DEVELOPMENT_BONUS;
+    int phase = board->phase < MAX_PHASE ? board->phase : MAX_PHASE;
 
-    score += COUNT(get_pieces(board, PAWN, color)) * PAWN_VALUE;
-    score += COUNT(get_pieces(board, KNIGHT, color)) * KNIGHT_VALUE;
-    score += COUNT(get_pieces(board, ROOK, color)) * ROOK_VALUE;
-    score += COUNT(get_pieces(board, QUEEN, color)) * QUEEN_VALUE;
+    int score = material + (middle_game * phase + end_game * (MAX_PHASE - phase)) / MAX_PHASE;
+    return active == WHITE ? score : -score;
+}
+
+int evaluate(Board* board, const AttackInfo* info) {
+    if (nnue_enabled) return nnue_evaluate(board);
+    return evaluate_classical(board, info) * endgame_scale(board) / SCALE_NORMAL;
+}
+
+int evaluate_classical(Board* board, const AttackInfo* info) {
+    return DISPATCH(board, evaluate_color, board, info);
+}
+
+int evaluate_lazy(Board* board) {
+    return DISPATCH(board, lazy_color, board);
+}
+
+int lazy_margin(Board* board) {
+    return LAZY_MARGIN[board->phase < MAX_PHASE ? board->phase : MAX_PHASE];
+}
+
+int material_eval(Board* board, Piece color) {
+    int score = board->material[color & 1];
 
-    int n_bishops = COUNT(get_pieces(board, BISHOP, color));
-    score += n_bishops * BISHOP_VALUE;
     // If the player still has both of their bishops, they get a bonus.
-    score += (n_bishops == 2) * BISHOP_VALUE / 2;
+    score += (COUNT(get_pieces(board, BISHOP, color)) == 2) * BISHOP_VALUE / 2;
 
     return score;
 }
 
-int pawn_structure_eval(Board* board, Piece color) {
-    Bitboard pawns = get_pieces(board, PAWN, color);
-
-    int files[10] = {
-        0,
-        COUNT(pawns & FILEA),
-        COUNT(pawns & FILEB),
-        COUNT(pawns & FILEC),
-        COUNT(pawns & FILED),
-        COUNT(pawns & FILEE),
-        COUNT(pawns & FILEF),
-        COUNT(pawns & FILEG),
-        COUNT(pawns & FILEH),
-        0
-    };
-
-    int stacked = 0;
-    int isolated = 0;
-    for (int i = 1; i < sizeof(files) / sizeof(int) - 1; i++) {
-        stacked += files[i] > 1;
-        isolated += (files[i - 1] == 0) & (files[i + 1] == 0);
-    }
+// Pawn structure terms come from the pawn table, this only adds the terms which also depend on where
+// the rooks are.
+int rook_file_eval(Board* board, const PawnEntry* pawns, Piece color) {
+    uint8_t rooks = file_set(get_pieces(board, ROOK, color));
+    uint8_t half_open = ~pawns->files[color & 1];
+    uint8_t open = half_open & ~pawns->files[OPPOSITE(color) & 1];
+
+    int score = 0;
+    score += COUNT(rooks & open) * ROOK_OPEN_FILE_BONUS;
+    score += COUNT(rooks & half_open & ~open) * ROOK_HALF_OPEN_FILE_BONUS;
 
-    return stacked + isolated;
+    return score;
 }
 
 int piece_square_eval(Board* board, Piece color) {
-    int score = 0;
-    for (int i = 0; i < 64; i++) {
-        Piece current = get_color(board, i);
-        if (current == color) {
-            score += pst(board->positions[i], color, i);
-        }
-    }
-    return score;
+    return board->middle_game[color & 1];
 }
 
 int pst(Piece piece, Piece color, int index) {
@@ -91,23 +112,49 @@ int king_safety_eval(Board* board, Piece color) {
     return qdiff * KING_QUADRANT_BONUS;
 }
 
-int mop_up_eval(Board* board, int material, Piece color) {
+// Squares the knights, bishops, rooks and queens can go to without being taken by a pawn. The attack
+// sets are per piece type, so squares reached by two pieces of the same type only count once.
+int mobility_eval(Board* board, const AttackInfo* info, Piece color) {
+    const int side = color & 1;
+    Bitboard available = ~get_pieces_color(board, color) & ~info->by_piece[side ^ 1][PAWN];
+
+    int score = 0;
+    score += COUNT(info->by_piece[side][KNIGHT] & available) * MOBILITY_BONUS[KNIGHT];
+    score += COUNT(info->by_piece[side][BISHOP] & available) * MOBILITY_BONUS[BISHOP];
+    score += COUNT(info->by_piece[side][ROOK] & available) * MOBILITY_BONUS[ROOK];
+    score += COUNT(info->by_piece[side][QUEEN] & available) * MOBILITY_BONUS[QUEEN];
+
+    return score;
+}
+
+// Attacks on the enemy king and the squares around it, more for squares attacked twice.
+int king_attack_eval(Board* board, const AttackInfo* info, Piece color) {
+    const int side = color & 1;
+    int king = LSB(get_pieces(board, KING, OPPOSITE(color)));
+    Bitboard zone = KING_MOVES[king] | (1ULL << king);
+
+    int score = 0;
+    score += COUNT(zone & info->all[side]) * KING_ZONE_ATTACK_BONUS;
+    score += COUNT(zone & info->twice[side]) * KING_ZONE_ATTACK_BONUS;
+
+    return score;
+}
+
+// Only applies in the end game, where the king piece square table already drives the enemy king
+// into the corners.
+int mop_up_eval(Board* board, Piece color) {
     int our_king = LSB(get_pieces(board, KING, color));
     int enemy_king = LSB(get_pieces(board, KING, OPPOSITE(color)));
-    // Prefer when opponent king is forced into corners.
-    int score = 0;
-    score += (KING_ENDGAME_PST[our_king] - KING_ENDGAME_PST[enemy_king]) * KING_CORNER_BONUS;
 
     // Minimize the distance between kings.
     int rankDistance = ABS((enemy_king - our_king) / 8);
     int fileDistance = ABS((enemy_king & 7) - (our_king & 7));
-    score += (14 - (rankDistance + fileDistance)) * KING_DISTANCE_BONUS;
-
-    double endgame = (double) (TOTAL_VALUE - material) / (double) TOTAL_VALUE;
-
-    return (int)((double) score * endgame);
+    return (14 - (rankDistance + fileDistance)) * KING_DISTANCE_BONUS;
 }
 
+// Per square a piece can move to.
+const int MOBILITY_BONUS[7] = {0, 0, 8, 0, 6, 4, 2};
+
 const int PIECE_VALUES[7] = {
     0,
     PAWN_VALUE,
@@ -203,6 +250,27 @@ const int KING_ENDGAME_PST[64] = {
     -50,-30,-30,-30,-30,-30,-30,-50
 };
 
+// End game piece square tables. Only the king plays differently in the end game.
+const int* const ENDGAME_PST[7] = {
+    PST[EMPTY],
+    PST[PAWN],
+    PST[KNIGHT],
+    KING_ENDGAME_PST,
+    PST[BISHOP],
+    PST[ROOK],
+    PST[QUEEN]
+};
+
+const int PHASE_VALUES[7] = {
+    0, // Empty
+    0, // Pawn
+    1, // Knight
+    0, // King
+    1, // Bishop
+    2, // Rook
+    4  // Queen
+};
+
 const Bitboard QUADRANT[64] = {
     Q1, Q1, Q1, Q1, Q2, Q2, Q2, Q2,
     Q1, Q1, Q1, Q1, Q2, Q2, Q2, Q2,
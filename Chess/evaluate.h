@@ -3,6 +3,8 @@
 
 #include "bitboard.h"
 #include "board.h"
+#include "pawns.h"
+#include "move.h"
 
 #define ABS(x) (__builtin_abs(x))
 
@@ -13,33 +15,46 @@
 #define QUEEN_VALUE 900
 #define KING_VALUE 200
 
-#define TOTAL_VALUE (PAWN_VALUE + KNIGHT_VALUE + BISHOP_VALUE + ROOK_VALUE + QUEEN_VALUE + KING_VALUE)
+// Game phase of the starting position. Each knight and bishop counts 1, rook 2 and queen 4.
+#define MAX_PHASE 24
+
 #define KING_DISTANCE_BONUS 8
-#define KING_CORNER_BONUS 4
 #define KING_QUADRANT_BONUS 8
 
 #define CAPTURE_BONUS 10
 #define PAWN_ATTACK_PENALTY 256
 #define QUEEN_CAPTURE_BONUS 1000000
 
-#define PAWN_STRUCTURE_BONUS 5
 #define DEVELOPMENT_BONUS 10
 #define KING_SAFETY_BONUS 5
+#define KING_ZONE_ATTACK_BONUS 12
 
 #define CHECKMATE 131072
 
 extern const int PIECE_VALUES[7];
+extern const int MOBILITY_BONUS[7];
 extern const int PST[7][64];
 extern const int KING_ENDGAME_PST[64];
+extern const int* const ENDGAME_PST[7];
+extern const int PHASE_VALUES[7];
 extern const Bitboard QUADRANT[64];
+// Generated by margingen into margins.c, indexed by game phase.
+extern const int LAZY_MARGIN[MAX_PHASE + 1];
 
-int evaluate(Board* board);
+int evaluate(Board* board, const AttackInfo* info);
+int evaluate_classical(Board* board, const AttackInfo* info);
+// Cheap part of the classical evaluation. The full evaluation is within lazy_margin of it, so a
+// search can skip the rest when even that cannot bring the score into its window.
+int evaluate_lazy(Board* board);
+int lazy_margin(Board* board);
 
 int material_eval(Board* board, Piece color);
-int pawn_structure_eval(Board* board, Piece color);
+int rook_file_eval(Board* board, const PawnEntry* pawns, Piece color);
 int piece_square_eval(Board* board, Piece color);
 int pst(Piece piece, Piece color, int index);
 int king_safety_eval(Board* board, Piece color);
-int mop_up_eval(Board* board, int material, Piece color);
+int mobility_eval(Board* board, const AttackInfo* info, Piece color);
+int king_attack_eval(Board* board, const AttackInfo* info, Piece color);
+int mop_up_eval(Board* board, Piece color);
 
 #endif
\ No newline at end of file
@@ -2,18 +2,272 @@
 #include <string.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdatomic.h>
+#include <time.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 #include "hashmap.h"
+#include "board.h"
 #include "move.h"
 
+#define HASHMAP_FILE_MAGIC "CHTT"
+// The items start on the second page of the file.
+#define HASHMAP_FILE_HEADER 4096
+#define START_FEN "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+
+// States of a shared segment.
+#define SEGMENT_EMPTY 0
+#define SEGMENT_READY 1
+#define SEGMENT_REMOVED 2 // Unlinked by the last process, attaching to it again starts over.
+#define SEGMENT_ATTEMPTS 100
+
+// Start of a hashmap file.
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t size; // Number of items, as a power of two.
+    uint32_t item_size;
+    uint32_t key_offset;
+    uint32_t generation; // Number of times the file was opened before.
+    uint64_t scheme; // Key of the starting position, changes with the Zobrist numbers.
+} FileHeader;
+
+// Start of a shared segment, followed by the items at the same offset as in a file.
+typedef struct {
+    FileHeader header;
+    _Atomic uint32_t state;
+} SegmentHeader;
+
+struct HashFile {
+    void* mapping;
+    size_t length;
+    char* name; // Of the shared segment, NULL for a file.
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE view;
+#else
+    int fd;
+#endif
+};
+
+// Threads searching the same position share the hashmap without locks. The stored key is XORed with
+// a hash of the rest of the entry, so an entry torn between two writes does not match its key.
+INLINE uint32_t item_check(const Item* item) {
+    uint64_t data = (uint32_t) item->value | (uint64_t) item->move << 32 | (uint64_t) (uint16_t) item->eval << 48;
+    data ^= (uint64_t) ((uint8_t) item->depth | item->flag << 8) * 0xff51afd7ed558ccdULL;
+    data *= 0x9e3779b97f4a7c15ULL;
+    return (uint32_t) (data >> 32);
+}
+
 HashMap* hashmap_alloc(int size) {
     HashMap* hashmap = (HashMap*) malloc(sizeof(HashMap));
     hashmap->size = 1 << size;
     hashmap->data = calloc(hashmap->size, sizeof(Item));
+    hashmap->file = NULL;
+    return hashmap;
+}
+
+// Opens the file with an exclusive lock and maps it with the given length. A file of any other length
+// is truncated and grown again, so it reads as zeros. Sets resized in that case.
+static bool map_file(HashFile* file, const char* path, size_t length, bool* resized) {
+    file->length = length;
+#ifdef _WIN32
+    // Without sharing the file is locked until its handle is closed.
+    file->file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file->file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size;
+    GetFileSizeEx(file->file, &size);
+    *resized = (size_t) size.QuadPart != length;
+    if (*resized) {
+        LARGE_INTEGER position = {0};
+        SetFilePointerEx(file->file, position, NULL, FILE_BEGIN);
+        SetEndOfFile(file->file);
+        position.QuadPart = (LONGLONG) length;
+        SetFilePointerEx(file->file, position, NULL, FILE_BEGIN);
+        SetEndOfFile(file->file);
+    }
+    file->view = CreateFileMappingA(file->file, NULL, PAGE_READWRITE, 0, 0, NULL);
+    file->mapping = file->view == NULL ? NULL : MapViewOfFile(file->view, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    if (file->mapping == NULL) {
+        if (file->view != NULL) CloseHandle(file->view);
+        CloseHandle(file->file);
+        return false;
+    }
+#else
+    file->fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (file->fd < 0) return false;
+    struct stat st;
+    if (flock(file->fd, LOCK_EX | LOCK_NB) != 0 || fstat(file->fd, &st) != 0) {
+        close(file->fd);
+        return false;
+    }
+    *resized = (size_t) st.st_size != length;
+    if (*resized && (ftruncate(file->fd, 0) != 0 || ftruncate(file->fd, (off_t) length) != 0)) {
+        close(file->fd);
+        return false;
+    }
+    file->mapping = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, file->fd, 0);
+    if (file->mapping == MAP_FAILED) {
+        close(file->fd);
+        return false;
+    }
+#endif
+    return true;
+}
+
+static void unmap_file(HashFile* file) {
+#ifdef _WIN32
+    FlushViewOfFile(file->mapping, 0);
+    UnmapViewOfFile(file->mapping);
+    CloseHandle(file->view);
+    CloseHandle(file->file);
+#else
+    // Every attached process holds a shared lock on the segment, so only the last one to detach gets
+    // the exclusive lock. It marks the segment as removed for processes which opened it just before.
+    if (file->name != NULL && flock(file->fd, LOCK_EX | LOCK_NB) == 0) {
+        atomic_store(&((SegmentHeader*) file->mapping)->state, SEGMENT_REMOVED);
+        shm_unlink(file->name);
+    }
+    munmap(file->mapping, file->length);
+    close(file->fd);
+#endif
+    free(file->name);
+}
+
+static FileHeader expected_header(int size) {
+    Board board;
+    board_from_fen(&board, START_FEN);
+    FileHeader header = {HASHMAP_FILE_MAGIC, HASHMAP_FILE_VERSION, size, sizeof(Item), KEY_OFFSET, 0,
+                         position_key(&board)};
+    return header;
+}
+
+static bool header_matches(const FileHeader* header, const FileHeader* expected) {
+    return memcmp(header->magic, expected->magic, 4) == 0 && header->version == expected->version &&
+           header->size == expected->size && header->item_size == expected->item_size &&
+           header->key_offset == expected->key_offset && header->scheme == expected->scheme;
+}
+
+// Lowers the depth of every entry by HASHMAP_AGE_DECAY and empties those which would fall below 0.
+// The key is stored XORed with the check of the entry, so it is stored again with the new check.
+static void age_items(HashMap* hashmap) {
+    for (int i = 0; i < hashmap->size; i++) {
+        Item* item = &hashmap->data[i];
+        if (item->flag == 0) continue;
+        if (item->depth < HASHMAP_AGE_DECAY) {
+            memset(item, 0, sizeof(Item));
+            continue;
+        }
+        uint32_t key = item->key ^ item_check(item);
+        item->depth -= HASHMAP_AGE_DECAY;
+        item->key = key ^ item_check(item);
+    }
+}
+
+HashMap* hashmap_open(const char* path, int size) {
+    HashMap* hashmap = (HashMap*) malloc(sizeof(HashMap));
+    hashmap->file = (HashFile*) malloc(sizeof(HashFile));
+    hashmap->file->name = NULL;
+    hashmap->size = 1 << size;
+
+    bool resized;
+    if (!map_file(hashmap->file, path, HASHMAP_FILE_HEADER + (size_t) hashmap->size * sizeof(Item), &resized)) {
+        free(hashmap->file);
+        free(hashmap);
+        return NULL;
+    }
+    FileHeader* header = (FileHeader*) hashmap->file->mapping;
+    hashmap->data = (Item*) ((char*) hashmap->file->mapping + HASHMAP_FILE_HEADER);
+
+    FileHeader expected = expected_header(size);
+    if (!resized && header_matches(header, &expected)) {
+        expected.generation = header->generation + 1;
+        age_items(hashmap);
+    } else if (!resized) {
+        hashmap_clear(hashmap);
+    }
+    *header = expected;
     return hashmap;
 }
 
+#ifndef _WIN32
+// Maps the segment if it has the length, returns NULL otherwise.
+static SegmentHeader* map_segment(int fd, size_t length) {
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t) st.st_size != length) return NULL;
+    void* mapping = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    return mapping != MAP_FAILED ? (SegmentHeader*) mapping : NULL;
+}
+#endif
+
+HashMap* hashmap_attach(const char* name, int size) {
+#ifdef _WIN32
+    return NULL;
+#else
+    FileHeader expected = expected_header(size);
+    size_t length = HASHMAP_FILE_HEADER + ((size_t) 1 << size) * sizeof(Item);
+
+    for (int attempt = 0; attempt < SEGMENT_ATTEMPTS; attempt++) {
+        int fd = shm_open(name, O_RDWR | O_CREAT, 0600);
+        if (fd < 0) return NULL;
+
+        // The exclusive lock is only free if no other process is attached. The segment is then set up
+        // anew, unless it is a ready one left behind by processes which crashed. Otherwise the shared
+        // lock waits until a process setting up or removing the segment is done.
+        bool alone = flock(fd, LOCK_EX | LOCK_NB) == 0;
+        if (!alone && flock(fd, LOCK_SH) != 0) {
+            close(fd);
+            return NULL;
+        }
+        SegmentHeader* segment = map_segment(fd, length);
+        int state = segment != NULL ? atomic_load(&segment->state) : SEGMENT_EMPTY;
+        bool usable = state == SEGMENT_READY && header_matches(&segment->header, &expected);
+        if (alone && !usable && state != SEGMENT_REMOVED) {
+            if (segment != NULL) munmap(segment, length);
+            segment = NULL;
+            if (ftruncate(fd, 0) == 0 && ftruncate(fd, (off_t) length) == 0) segment = map_segment(fd, length);
+            if (segment != NULL) {
+                segment->header = expected;
+                atomic_store(&segment->state, SEGMENT_READY);
+                usable = true;
+            }
+        }
+        if (alone) flock(fd, LOCK_SH);
+
+        // The last process may have detached while the lock was changed from exclusive to shared.
+        if (usable && atomic_load(&segment->state) == SEGMENT_READY) {
+            HashMap* hashmap = (HashMap*) malloc(sizeof(HashMap));
+            hashmap->size = 1 << size;
+            hashmap->data = (Item*) ((char*) segment + HASHMAP_FILE_HEADER);
+            hashmap->file = (HashFile*) malloc(sizeof(HashFile));
+            *hashmap->file = (HashFile) {segment, length, strdup(name), fd};
+            return hashmap;
+        }
+        if (segment != NULL) munmap(segment, length);
+        close(fd);
+        // Processes using the segment with another size or by an incompatible build keep it.
+        if (!alone && state != SEGMENT_REMOVED) return NULL;
+        struct timespec wait = {0, 1000000};
+        nanosleep(&wait, NULL);
+    }
+    return NULL;
+#endif
+}
+
 void hashmap_free(HashMap* hashmap) {
-    free(hashmap->data);
+    if (hashmap->file != NULL) {
+        unmap_file(hashmap->file);
+        free(hashmap->file);
+    } else {
+        free(hashmap->data);
+    }
     free(hashmap);
 }
 
@@ -21,21 +275,74 @@ void hashmap_clear(HashMap* hashmap) {
     memset(hashmap->data, 0, hashmap->size * sizeof(Item));
 }
 
-void hashmap_set(HashMap* hashmap, uint64_t key, int value, int depth, int flag) {
-    Item* item = &hashmap->data[(key >> KEY_OFFSET) & (hashmap->size - 1)];
-    if (depth >= item->depth) {
-        item->key = key;
-        item->value = value;
-        item->depth = depth;
-        item->flag = flag;
+void hashmap_set(HashMap* hashmap, uint64_t key, int value, int depth, int flag, Move move, int eval) {
+    Item* slot = &hashmap->data[(key >> KEY_OFFSET) & (hashmap->size - 1)];
+    if (depth >= slot->depth) {
+        Item item;
+        item.value = value;
+        item.move = move;
+        item.eval = eval >= INT16_MIN && eval <= INT16_MAX ? eval : EVAL_NONE;
+        item.depth = depth;
+        item.flag = flag;
+        item.key = (uint32_t) key ^ item_check(&item);
+        *slot = item;
     }
 }
 
-int hashmap_get(HashMap* hashmap, uint64_t key, int depth, int* ret) {
-    Item* item = &hashmap->data[(key >> KEY_OFFSET) & (hashmap->size - 1)];
-    if (depth <= item->depth && key == item->key) {
-        *ret = item->value;
-        return item->flag;
+// The stored move and static evaluation are returned whenever the key matches, even if the entry is
+// too shallow for its value to be used, since they do not depend on the depth.
+int hashmap_get(HashMap* hashmap, uint64_t key, int depth, int* ret, Move* move, int* eval) {
+    Item item = hashmap->data[(key >> KEY_OFFSET) & (hashmap->size - 1)];
+    *move = NULL_MOVE;
+    *eval = EVAL_NONE;
+    if ((uint32_t) key == (item.key ^ item_check(&item))) {
+        *move = item.move;
+        *eval = item.eval;
+        if (depth <= item.depth) {
+            *ret = item.value;
+            return item.flag;
+        }
     }
     return 0;
 }
+
+#define EVAL_BITS 24
+#define EVAL_MASK ((1ULL << EVAL_BITS) - 1)
+
+// Each entry is a single 64 bit word holding the upper 40 bits of the key and the evaluation in the
+// lower 24 bits, so a reader sees either a whole entry or a key mismatch, never half of another
+// thread's write.
+struct EvalCache {
+    int size;
+    _Atomic uint64_t* data;
+};
+
+EvalCache* evalcache_alloc(int size) {
+    EvalCache* cache = (EvalCache*) malloc(sizeof(EvalCache));
+    cache->size = 1 << size;
+    cache->data = calloc(cache->size, sizeof(uint64_t));
+    return cache;
+}
+
+void evalcache_free(EvalCache* cache) {
+    free(cache->data);
+    free(cache);
+}
+
+void evalcache_clear(EvalCache* cache) {
+    for (int i = 0; i < cache->size; i++) {
+        atomic_store_explicit(&cache->data[i], 0, memory_order_relaxed);
+    }
+}
+
+void evalcache_set(EvalCache* cache, uint64_t key, int eval) {
+    uint64_t entry = (key & ~EVAL_MASK) | ((uint64_t) (eval + (1 << (EVAL_BITS - 1))) & EVAL_MASK);
+    atomic_store_explicit(&cache->data[key & (cache->size - 1)], entry, memory_order_relaxed);
+}
+
+bool evalcache_get(EvalCache* cache, uint64_t key, int* eval) {
+    uint64_t entry = atomic_load_explicit(&cache->data[key & (cache->size - 1)], memory_order_relaxed);
+    if (((entry ^ key) & ~EVAL_MASK) != 0) return false;
+    *eval = (int) (entry & EVAL_MASK) - (1 << (EVAL_BITS - 1));
+    return true;
+}
\ No newline at end of file
@@ -3,30 +3,75 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "move.h"
 
 #define BOUND_EXACT 1
 #define BOUND_UPPER 2
 #define BOUND_LOWER 3
 
-#define KEY_OFFSET 20
+// The upper bits of the key select the item and the lower 32 bits are stored to check for collisions.
+#define KEY_OFFSET 32
+
+// Stored in place of the static evaluation when it is not known.
+#define EVAL_NONE INT16_MIN
+
+// Number of entries in the evaluation cache, as a power of two.
+#define EVAL_CACHE_SIZE 18
+
+// Plies taken off the depth of the entries of a hashmap file each time it is opened.
+#define HASHMAP_AGE_DECAY 2
+// Changes whenever the items or the keys of hashmap files change.
+#define HASHMAP_FILE_VERSION 1
 
 typedef struct {
-    uint64_t key;
-    int value;
-    int depth;
-    int flag;
+    uint32_t key;
+    int32_t value;
+    Move move; // Best move found in the position, NULL_MOVE if none.
+    int16_t eval; // Static evaluation of the position, EVAL_NONE if none.
+    int8_t depth;
+    uint8_t flag;
 } Item;
 
+// Mapping of a hashmap file, see hashmap_open.
+typedef struct HashFile HashFile;
+
 typedef struct {
     int size;
     Item* data;
+    HashFile* file; // NULL unless opened by hashmap_open or hashmap_attach.
 } HashMap;
 
+// Lossy cache of static evaluations, shared between threads without locks.
+typedef struct EvalCache EvalCache;
+
 HashMap* hashmap_alloc(int size);
+// Opens a hashmap backed by a memory mapped file, so its entries survive the process and a later run
+// starts with the results of the earlier ones. The file holds a header with the format version, the
+// size and the key scheme, followed by the items. A file written with another size, format or key
+// scheme is emptied. The entries of a valid file are aged, their depth lowered by HASHMAP_AGE_DECAY,
+// so they answer shallower searches than they were searched to and new results replace them first.
+// The file is locked while it is open. Returns NULL if it can not be created, mapped or locked.
+HashMap* hashmap_open(const char* path, int size);
+// Attaches to the hashmap in the POSIX shared memory segment of the name, like /chess, creating it if
+// no process has it, so engines in several processes share their results. Entries are read and
+// written without locks across processes like across threads, an entry torn by two writes does not
+// match its key. Every attached process holds a shared lock on the segment, which the system releases
+// if it crashes, and the last one to detach removes the segment. Returns NULL if it can not be
+// created or mapped, or if other processes use it with another size or build, and on Windows.
+HashMap* hashmap_attach(const char* name, int size);
+// Frees an allocated hashmap, unmaps and closes the file of an opened one, or detaches from a shared
+// segment.
 void hashmap_free(HashMap* hashmap);
 void hashmap_clear(HashMap* hashmap);
 
-void hashmap_set(HashMap* hashmap, uint64_t key, int value, int depth, int flag);
-int hashmap_get(HashMap* hashmap, uint64_t key, int depth, int* ret);
+void hashmap_set(HashMap* hashmap, uint64_t key, int value, int depth, int flag, Move move, int eval);
+int hashmap_get(HashMap* hashmap, uint64_t key, int depth, int* ret, Move* move, int* eval);
+
+EvalCache* evalcache_alloc(int size);
+void evalcache_free(EvalCache* cache);
+void evalcache_clear(EvalCache* cache);
+
+void evalcache_set(EvalCache* cache, uint64_t key, int eval);
+bool evalcache_get(EvalCache* cache, uint64_t key, int* eval);
 
 #endif
\ No newline at end of file
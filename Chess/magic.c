@@ -0,0 +1,89 @@
+// Generated by magicfinder. Do not edit.
+// Rook table: 101199 entries. Bishop table: 4461 entries.
+
+#include "bitboard.h"
+
+const Bitboard ROOK_MAGIC[64] = {
+    0xa8002c000108020ULL, 0x100184000088100ULL, 0x100200010090040ULL, 0x2480041000800801ULL,
+    0x2000244aa000120ULL, 0x8200048600009008ULL, 0x8400040091280050ULL, 0x2880002041000080ULL,
+    0xa000800080400034ULL, 0x458400030200010ULL, 0x900100200504c008ULL, 0x4082000c40120002ULL,
+    0x212000600a41002ULL, 0x500092c000100ULL, 0x200400082190008bULL, 0x48120000510a0004ULL,
+    0x104808010c00011ULL, 0xc0026008100012ULL, 0x104410020090008ULL, 0x500808008001000ULL,
+    0xa08018014000880ULL, 0x8000808004000200ULL, 0x50c0001880090ULL, 0x801020000441091ULL,
+    0x281020400440080ULL, 0x40c0080120100014ULL, 0x120200402082ULL, 0x80080100080ULL,
+    0x28c0020200189020ULL, 0x1800060200033001ULL, 0x2086020400215048ULL, 0x120c600040491ULL,
+    0x104010800080ULL, 0x8001114100400ULL, 0x8084024024008100ULL, 0x180060012002040ULL,
+    0x3080020106000c18ULL, 0x1000010007000400ULL, 0x1828002144001008ULL, 0x2064001450200100ULL,
+    0x8000082811b000ULL, 0x12000348096cc000ULL, 0x8100040014182000ULL, 0x18044002041a0010ULL,
+    0x401200008c920008ULL, 0x44000100030016ULL, 0x210004220018009ULL, 0x400010639a0001ULL,
+    0x20544750050ULL, 0x11000044390200c0ULL, 0x4410992200ULL, 0x21a020014101a0ULL,
+    0x82000089108600ULL, 0x8040000a004c0a0ULL, 0x848800404402a0ULL, 0x400000465080050ULL,
+    0x4000084081101026ULL, 0x1040251882ULL, 0x404001144008208aULL, 0x2904c02012ULL,
+    0x220001a22e0306ULL, 0x2000064880302ULL, 0xc004004108208604ULL, 0xc00001884004222ULL
+};
+
+const Bitboard BISHOP_MAGIC[64] = {
+    0x8418400922001ULL, 0x9010418900152ULL, 0x40821a104020000ULL, 0x43030060600100ULL,
+    0x261858200010008ULL, 0x20a25402020044ULL, 0x2128808411010000ULL, 0x4904120082088008ULL,
+    0x12090224143010ULL, 0x10102210892409ULL, 0x1003082199200808ULL, 0x30300600904ULL,
+    0x8804018682040102ULL, 0x8101244280c400ULL, 0x820004208450080ULL, 0x22202104228040ULL,
+    0x124409142423021ULL, 0x12000242421820ULL, 0x6000c02103404ULL, 0x1214002030081801ULL,
+    0x800c02063009028ULL, 0x1000604030005802ULL, 0x8a4061010180d0ULL, 0x141400028824010ULL,
+    0x98140205050044ULL, 0x85140204818019ULL, 0x48040008201620ULL, 0x21004004040200ULL,
+    0x941408200c002000ULL, 0x608006000302004ULL, 0x605000c60600ULL, 0x1420002446031ULL,
+    0x90050a514100410ULL, 0x4021a461a01500ULL, 0x26800a3000880098ULL, 0x4010200800090810ULL,
+    0x47040010082a0080ULL, 0x2010001438060100ULL, 0x200040a0a042c281ULL, 0x489028018140ULL,
+    0x224291002426ULL, 0x820340308400404ULL, 0x8400011804100200ULL, 0x200000318081400ULL,
+    0x20000c240c00180ULL, 0x100904860880040ULL, 0x611250880280ULL, 0x220109084900120ULL,
+    0x430000c804100420ULL, 0x1a0201044400ULL, 0x200851244480ULL, 0x4140008018460004ULL,
+    0x2010a00105414040ULL, 0x890018881112024ULL, 0x824411420a42ULL, 0xa22220450800ULL,
+    0x800010082412082ULL, 0x1000c0094010901ULL, 0x40d808512440ULL, 0x162200010184600ULL,
+    0x41000000854140ULL, 0x1000010082a46120ULL, 0x8008002c4014a02ULL, 0x1084114408011ULL
+};
+
+const int ROOK_OFFSET[64] = {
+    12, 11, 11, 11, 11, 11, 11, 12,
+    11, 10, 10, 10, 10, 10, 10, 11,
+    11, 10, 10, 10, 10, 10, 10, 11,
+    11, 10, 10, 10, 10, 10, 10, 11,
+    11, 10, 10, 10, 10, 10, 10, 11,
+    11, 10, 10, 10, 10, 10, 10, 11,
+    11, 10, 10, 10, 10, 10, 10, 11,
+    12, 11, 11, 11, 11, 11, 11, 12
+};
+
+const int BISHOP_OFFSET[64] = {
+    6, 5, 5, 5, 5, 5, 5, 6,
+    5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 7, 7, 7, 7, 5, 5,
+    5, 5, 7, 9, 9, 7, 5, 5,
+    5, 5, 7, 9, 9, 7, 5, 5,
+    5, 5, 7, 7, 7, 7, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5,
+    6, 5, 5, 5, 5, 5, 5, 6
+};
+
+const int ROOK_INDEX[64] = {
+    0, 16346, 18394, 20442, 22484, 24531, 26576, 4096,
+    28624, 64883, 65904, 66927, 67948, 68970, 69992, 30671,
+    32718, 71016, 72038, 73062, 74086, 75110, 76133, 34766,
+    36813, 77157, 78180, 79204, 80228, 81249, 82272, 38861,
+    40908, 83293, 84316, 85339, 86361, 87382, 88405, 42956,
+    45000, 89425, 90435, 91457, 92476, 93499, 94500, 47045,
+    48897, 95487, 96442, 97326, 98345, 99302, 100175, 50709,
+    8162, 52695, 54715, 56730, 58776, 60810, 62835, 12251
+};
+
+const int BISHOP_INDEX[64] = {
+    3444, 3288, 3595, 3619, 3643, 3663, 3684, 3495,
+    3697, 3714, 3735, 3757, 3786, 3799, 3817, 3833,
+    3851, 3869, 2030, 2157, 2280, 2396, 3887, 3906,
+    3928, 3948, 2515, 0, 512, 2638, 3972, 3998,
+    4024, 4049, 2761, 1024, 1535, 2887, 4074, 4092,
+    4110, 4130, 3001, 3125, 3248, 3346, 4148, 4166,
+    4191, 4200, 4218, 4250, 4266, 4281, 4297, 4314,
+    3512, 4331, 4349, 4373, 4393, 4413, 4429, 3544
+};
+
+const int ROOK_TABLE_SIZE = 101199;
+const int BISHOP_TABLE_SIZE = 4461;
\ No newline at end of file
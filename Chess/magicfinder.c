@@ -0,0 +1,315 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "tinycthread.h"
+#include "bitboard.h"
+
+// Searches for black magic numbers for the rook and bishop attack tables and writes them to a
+// drop-in replacement for magic.c. For every square the current magic is kept unless a magic with
+// a smaller offset (fewer index bits) is found within the time budget. Afterwards all square tables
+// are packed into one flat table per piece, letting squares share entries wherever their attack
+// sets agree or an entry is never reached.
+// Usage: magicfinder <output file> [threads] [milliseconds per square]
+
+#define MAX_OCCUPANCIES 4096
+
+typedef struct {
+    bool rook;
+    int square;
+    Bitboard mask;
+    int n_occupancies;
+    Bitboard occupancies[MAX_OCCUPANCIES];
+    Bitboard attacks[MAX_OCCUPANCIES];
+    Bitboard magic;
+    int offset;
+} Job;
+
+static Job jobs[128];
+static int next_job = 0;
+static mtx_t job_lock;
+static long budget_ms = 250;
+
+static Bitboard rook_table[64 * MAX_OCCUPANCIES];
+static Bitboard bishop_table[64 * MAX_OCCUPANCIES];
+static bool rook_used[64 * MAX_OCCUPANCIES];
+static bool bishop_used[64 * MAX_OCCUPANCIES];
+
+long elapsed_ms(struct timespec* start) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (now.tv_sec - start->tv_sec) * 1000 + (now.tv_nsec - start->tv_nsec) / 1000000;
+}
+
+Bitboard random_bitboard(uint64_t* state) {
+    // xorshift64*
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 0x2545f4914f6cdd1dULL;
+}
+
+// Magics with few set bits are found much faster.
+Bitboard random_magic(uint64_t* state) {
+    return random_bitboard(state) & random_bitboard(state) & random_bitboard(state);
+}
+
+// Checks that every occupancy of the square maps to an entry that holds its exact attack set.
+bool try_magic(Job* job, Bitboard magic, int offset, Bitboard* table, int* epoch, int* stamp) {
+    (*stamp)++;
+    for (int i = 0; i < job->n_occupancies; i++) {
+        Bitboard key = MAGIC_KEY(job->occupancies[i], job->mask, magic, offset);
+        if (epoch[key] != *stamp) {
+            epoch[key] = *stamp;
+            table[key] = job->attacks[i];
+        } else if (table[key] != job->attacks[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool search_magic(Job* job, int offset, uint64_t* state, long time_ms, Bitboard* table, int* epoch, int* stamp) {
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+    for (long attempt = 0; ; attempt++) {
+        // Only check the clock every so often since it is much slower than a single attempt.
+        if ((attempt & 0xfff) == 0 && time_ms >= 0 && elapsed_ms(&start) > time_ms) return false;
+        Bitboard magic = random_magic(state);
+        if (try_magic(job, magic, offset, table, epoch, stamp)) {
+            job->magic = magic;
+            job->offset = offset;
+            return true;
+        }
+    }
+}
+
+// Number of entries at the start and end of the square table that no occupancy reaches. The packer
+// can overlap these with the tables of other squares.
+int count_gaps(int offset, const int* epoch, int stamp) {
+    int n_keys = 1 << offset;
+    int leading = 0, trailing = 0;
+    while (leading < n_keys && epoch[leading] != stamp) leading++;
+    while (trailing < n_keys && epoch[n_keys - 1 - trailing] != stamp) trailing++;
+    return leading + trailing;
+}
+
+// Looks for a magic at the current offset of the job that leaves larger gaps than its current one.
+void search_gaps(Job* job, uint64_t* state, long time_ms, Bitboard* table, int* epoch, int* stamp) {
+    if (!try_magic(job, job->magic, job->offset, table, epoch, stamp)) return;
+    int best = count_gaps(job->offset, epoch, *stamp);
+
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+    for (long attempt = 0; ; attempt++) {
+        if ((attempt & 0xfff) == 0 && elapsed_ms(&start) > time_ms) return;
+        Bitboard magic = random_magic(state);
+        if (try_magic(job, magic, job->offset, table, epoch, stamp)) {
+            int gaps = count_gaps(job->offset, epoch, *stamp);
+            if (gaps > best) {
+                best = gaps;
+                job->magic = magic;
+            }
+        }
+    }
+}
+
+void run_job(Job* job, uint64_t* state) {
+    static _Thread_local Bitboard table[MAX_OCCUPANCIES];
+    static _Thread_local int epoch[MAX_OCCUPANCIES];
+    static _Thread_local int stamp = 0;
+
+    const Bitboard* magics = job->rook ? ROOK_MAGIC : BISHOP_MAGIC;
+    const int* offsets = job->rook ? ROOK_OFFSET : BISHOP_OFFSET;
+
+    job->magic = magics[job->square];
+    job->offset = offsets[job->square];
+
+    // Fall back to the full offset for the square if the current magic does not work.
+    if (!try_magic(job, job->magic, job->offset, table, epoch, &stamp)) {
+        search_magic(job, COUNT(job->mask), state, -1, table, epoch, &stamp);
+    }
+
+    // Half of the budget goes towards denser magics, the other half towards magics that pack better.
+    while (job->offset > 1 && search_magic(job, job->offset - 1, state, budget_ms / 2, table, epoch, &stamp));
+    search_gaps(job, state, budget_ms / 2, table, epoch, &stamp);
+}
+
+int worker(void* arg) {
+    uint64_t state = 0x9e3779b97f4a7c15ULL * ((uintptr_t) arg + 1);
+    while (true) {
+        mtx_lock(&job_lock);
+        int index = next_job++;
+        mtx_unlock(&job_lock);
+        if (index >= 128) break;
+        run_job(&jobs[index], &state);
+    }
+    return 0;
+}
+
+void init_job(Job* job, bool rook, int square) {
+    job->rook = rook;
+    job->square = square;
+    job->mask = rook ? ROOK_BLOCKER_MASK[square] : BISHOP_BLOCKER_MASK[square];
+    job->n_occupancies = 1 << COUNT(job->mask);
+    for (int i = 0; i < job->n_occupancies; i++) {
+        Bitboard blockers = get_blocker(job->mask, i);
+        job->occupancies[i] = blockers;
+        job->attacks[i] = rook ? gen_cardinal_attacks_classical(square, blockers)
+                               : gen_intercardinal_attacks_classical(square, blockers);
+    }
+}
+
+// Places the square tables into one flat table, largest first, at the lowest index where every
+// entry the square needs is either unused or already holds the same attack set.
+int pack_tables(bool rook, int* indices, Bitboard* table, bool* used) {
+    Job* order[64];
+    for (int i = 0; i < 64; i++) order[i] = &jobs[i + (rook ? 0 : 64)];
+    for (int i = 1; i < 64; i++) {
+        for (int j = i; j > 0 && order[j - 1]->offset < order[j]->offset; j--) {
+            Job* temp = order[j];
+            order[j] = order[j - 1];
+            order[j - 1] = temp;
+        }
+    }
+
+    static Bitboard local[MAX_OCCUPANCIES];
+    static bool reached[MAX_OCCUPANCIES];
+
+    int size = 0;
+    for (int i = 0; i < 64; i++) {
+        Job* job = order[i];
+        int n_keys = 1 << job->offset;
+        memset(reached, 0, sizeof(reached));
+        for (int j = 0; j < job->n_occupancies; j++) {
+            Bitboard key = MAGIC_KEY(job->occupancies[j], job->mask, job->magic, job->offset);
+            local[key] = job->attacks[j];
+            reached[key] = true;
+        }
+
+        int base = 0;
+        for (;; base++) {
+            bool fits = true;
+            for (int key = 0; key < n_keys && fits; key++) {
+                fits = !reached[key] || !used[base + key] || table[base + key] == local[key];
+            }
+            if (fits) break;
+        }
+
+        for (int key = 0; key < n_keys; key++) {
+            if (reached[key]) {
+                table[base + key] = local[key];
+                used[base + key] = true;
+            }
+        }
+        indices[job->square] = base;
+        if (base + n_keys > size) size = base + n_keys;
+    }
+
+    return size;
+}
+
+// Re-checks every occupancy of every square against the classical ray walkers using the packed table.
+bool verify_tables(bool rook, const int* indices, const Bitboard* table) {
+    for (int square = 0; square < 64; square++) {
+        Job* job = &jobs[square + (rook ? 0 : 64)];
+        for (int i = 0; i < job->n_occupancies; i++) {
+            Bitboard blockers = job->occupancies[i];
+            Bitboard key = MAGIC_KEY(blockers, job->mask, job->magic, job->offset);
+            Bitboard expected = rook ? gen_cardinal_attacks_classical(square, blockers)
+                                     : gen_intercardinal_attacks_classical(square, blockers);
+            if (table[indices[square] + key] != expected) return false;
+        }
+    }
+    return true;
+}
+
+void write_magics(FILE* file, const char* name, bool rook) {
+    fprintf(file, "const Bitboard %s[64] = {", name);
+    for (int i = 0; i < 64; i++) {
+        fprintf(file, i % 4 == 0 ? "\n    " : " ");
+        fprintf(file, "0x%llxULL%s", (unsigned long long) jobs[i + (rook ? 0 : 64)].magic, i < 63 ? "," : "");
+    }
+    fprintf(file, "\n};\n\n");
+}
+
+void write_ints(FILE* file, const char* name, const int* values) {
+    fprintf(file, "const int %s[64] = {", name);
+    for (int i = 0; i < 64; i++) {
+        fprintf(file, i % 8 == 0 ? "\n    " : " ");
+        fprintf(file, "%d%s", values[i], i < 63 ? "," : "");
+    }
+    fprintf(file, "\n};\n\n");
+}
+
+int main(int argc, char* args[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <output file> [threads] [milliseconds per square]\n", args[0]);
+        return 1;
+    }
+    int n_threads = argc > 2 ? atoi(args[2]) : 4;
+    if (argc > 3) budget_ms = atol(args[3]);
+    if (n_threads < 1) n_threads = 1;
+
+    for (int i = 0; i < 64; i++) {
+        init_job(&jobs[i], true, i);
+        init_job(&jobs[i + 64], false, i);
+    }
+
+    mtx_init(&job_lock, mtx_plain);
+    thrd_t* threads = malloc(n_threads * sizeof(thrd_t));
+    for (int i = 0; i < n_threads; i++) {
+        thrd_create(&threads[i], worker, (void*)(uintptr_t) i);
+    }
+    for (int i = 0; i < n_threads; i++) {
+        thrd_join(threads[i], NULL);
+    }
+    free(threads);
+    mtx_destroy(&job_lock);
+
+    int rook_index[64], bishop_index[64], rook_offset[64], bishop_offset[64];
+    for (int i = 0; i < 64; i++) {
+        rook_offset[i] = jobs[i].offset;
+        bishop_offset[i] = jobs[i + 64].offset;
+    }
+
+    int rook_size = pack_tables(true, rook_index, rook_table, rook_used);
+    int bishop_size = pack_tables(false, bishop_index, bishop_table, bishop_used);
+
+    if (!verify_tables(true, rook_index, rook_table) || !verify_tables(false, bishop_index, bishop_table)) {
+        fprintf(stderr, "Packed tables do not match the classical attack generators.\n");
+        return 1;
+    }
+
+    int rook_bits = 0, bishop_bits = 0;
+    for (int i = 0; i < 64; i++) {
+        rook_bits += rook_offset[i];
+        bishop_bits += bishop_offset[i];
+    }
+    printf("Rook: %d index bits, %d entries (%d KB)\n", rook_bits, rook_size, rook_size * 8 / 1024);
+    printf("Bishop: %d index bits, %d entries (%d KB)\n", bishop_bits, bishop_size, bishop_size * 8 / 1024);
+
+    FILE* file = fopen(args[1], "w");
+    if (file == NULL) {
+        fprintf(stderr, "Could not open %s for writing.\n", args[1]);
+        return 1;
+    }
+
+    fprintf(file, "// Generated by magicfinder. Do not edit.\n");
+    fprintf(file, "// Rook table: %d entries. Bishop table: %d entries.\n\n", rook_size, bishop_size);
+    fprintf(file, "#include \"bitboard.h\"\n\n");
+    write_magics(file, "ROOK_MAGIC", true);
+    write_magics(file, "BISHOP_MAGIC", false);
+    write_ints(file, "ROOK_OFFSET", rook_offset);
+    write_ints(file, "BISHOP_OFFSET", bishop_offset);
+    write_ints(file, "ROOK_INDEX", rook_index);
+    write_ints(file, "BISHOP_INDEX", bishop_index);
+    fprintf(file, "const int ROOK_TABLE_SIZE = %d;\n", rook_size);
+    fprintf(file, "const int BISHOP_TABLE_SIZE = %d;", bishop_size);
+
+    fclose(file);
+
+    return 0;
+}
\ No newline at end of file
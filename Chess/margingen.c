@@ -0,0 +1,129 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "bitboard.h"
+#include "board.h"
+#include "move.h"
+#include "evaluate.h"
+
+// Derives the lazy evaluation margins from a set of positions: for every game phase, the difference
+// between the full classical evaluation and evaluate_lazy which MARGIN_QUANTILE of the positions stay
+// within. The largest differences come from a few wild positions, and covering them would make the
+// margins too wide to ever cut anything. The positions are read from a file with one FEN per line,
+// or played out as random games from the starting position if no file is given.
+// Usage: margingen <output file> [positions file]
+
+#define RANDOM_POSITIONS 1000000
+#define MAX_PLY 200
+#define MARGIN_QUANTILE 0.999
+// Larger differences are counted as this.
+#define MAX_DIFFERENCE 4096
+
+static long histogram[MAX_PHASE + 1][MAX_DIFFERENCE + 1];
+static long samples[MAX_PHASE + 1];
+
+// xorshift64*
+uint64_t random64(uint64_t* state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 0x2545f4914f6cdd1dULL;
+}
+
+void sample(Board* board) {
+    AttackInfo info;
+    gen_attack_info(board, &info);
+    int difference = abs(evaluate_classical(board, &info) - evaluate_lazy(board));
+
+    int phase = board->phase < MAX_PHASE ? board->phase : MAX_PHASE;
+    histogram[phase][difference < MAX_DIFFERENCE ? difference : MAX_DIFFERENCE]++;
+    samples[phase]++;
+}
+
+long sample_file(const char* path) {
+    FILE* file = fopen(path, "r");
+    if (file == NULL) return -1;
+
+    long n = 0;
+    char line[256];
+    Board board;
+    while (fgets(line, sizeof(line), file) != NULL) {
+        if (strchr(line, '/') == NULL) continue;
+        board_from_fen(&board, line);
+        sample(&board);
+        n++;
+    }
+    fclose(file);
+    return n;
+}
+
+long sample_random() {
+    const char* start = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+    uint64_t state = 0x3c6ef372fe94f82bULL;
+
+    Board board;
+    board_from_fen(&board, start);
+    for (int n = 0, ply = 0; n < RANDOM_POSITIONS; ply++) {
+        Move moves[MAX_MOVES];
+        int n_moves = gen_moves(&board, moves);
+        if (n_moves == 0 || ply == MAX_PLY) {
+            board_from_fen(&board, start);
+            ply = 0;
+            continue;
+        }
+        make_move(&board, &moves[random64(&state) % n_moves]);
+        sample(&board);
+        n++;
+    }
+    return RANDOM_POSITIONS;
+}
+
+int main(int argc, char* args[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <output file> [positions file]\n", args[0]);
+        return 1;
+    }
+    init_magic_tables();
+
+    long n = argc > 2 ? sample_file(args[2]) : sample_random();
+    if (n <= 0) {
+        fprintf(stderr, "No positions read from %s.\n", args[2]);
+        return 1;
+    }
+
+    // Phases without any positions get the largest margin of all.
+    int margins[MAX_PHASE + 1];
+    int largest = 0;
+    for (int i = 0; i <= MAX_PHASE; i++) {
+        long covered = 0;
+        margins[i] = 0;
+        while (margins[i] < MAX_DIFFERENCE && covered + histogram[i][margins[i]] < samples[i] * MARGIN_QUANTILE) {
+            covered += histogram[i][margins[i]++];
+        }
+        if (margins[i] > largest) largest = margins[i];
+    }
+
+    FILE* file = fopen(args[1], "w");
+    if (file == NULL) {
+        fprintf(stderr, "Could not open %s for writing.\n", args[1]);
+        return 1;
+    }
+
+    fprintf(file, "// Generated by margingen. Do not edit.\n\n");
+    fprintf(file, "#include \"evaluate.h\"\n\n");
+    fprintf(file, "// Difference between the classical evaluation and evaluate_lazy for each game phase, which\n");
+    fprintf(file, "// %g%% of %ld positions stayed within.\n", MARGIN_QUANTILE * 100, n);
+    fprintf(file, "const int LAZY_MARGIN[MAX_PHASE + 1] = {");
+    for (int i = 0; i <= MAX_PHASE; i++) {
+        fprintf(file, i % 8 == 0 ? "\n    " : " ");
+        fprintf(file, "%d%s", samples[i] > 0 ? margins[i] : largest, i < MAX_PHASE ? "," : "");
+    }
+    fprintf(file, "\n};");
+    fclose(file);
+
+    for (int i = 0; i <= MAX_PHASE; i++) {
+        printf("phase %2d: %8ld positions, margin %d\n", i, samples[i], margins[i]);
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,12 @@
+// Generated by margingen. Do not edit.
+
+#include "evaluate.h"
+
+// Difference between the classical evaluation and evaluate_lazy for each game phase, which
+// 99.9% of 1000000 positions stayed within.
+const int LAZY_MARGIN[MAX_PHASE + 1] = {
+    421, 603, 595, 525, 529, 569, 531, 563,
+    568, 533, 550, 577, 574, 594, 565, 583,
+    552, 554, 520, 530, 485, 470, 452, 426,
+    375
+};
\ No newline at end of file
@@ -0,0 +1,249 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "mate.h"
+#include "board.h"
+#include "move.h"
+
+// Proof and disproof number of decided positions.
+#define PN_INF 100000000U
+
+typedef struct {
+    uint64_t key;
+    uint32_t pn;
+    uint32_t dn;
+    uint8_t plies; // Plies left when the numbers were stored.
+    uint8_t distance; // Plies to mate of a proven position.
+} MateEntry;
+
+struct MateTable {
+    uint64_t mask;
+    MateEntry* entries;
+};
+
+typedef struct {
+    MateTable* table;
+    Piece attacker;
+    uint64_t nodes;
+    uint64_t max_nodes;
+    bool aborted;
+} Solver;
+
+MateTable* mate_table_alloc(int size) {
+    MateTable* table = (MateTable*) malloc(sizeof(MateTable));
+    table->mask = (1ULL << size) - 1;
+    table->entries = calloc(table->mask + 1, sizeof(MateEntry));
+    return table;
+}
+
+void mate_table_free(MateTable* table) {
+    free(table->entries);
+    free(table);
+}
+
+// Proofs are kept for any number of plies at least their distance, disproofs for at most as many
+// plies as they were stored with. Anything else is only reused for the same number of plies.
+static void lookup(MateTable* table, uint64_t key, int plies, uint32_t* pn, uint32_t* dn, int* distance) {
+    MateEntry* entry = &table->entries[key & table->mask];
+    *pn = 1;
+    *dn = 1;
+    *distance = 0;
+    if (entry->key != key) return;
+
+    if (entry->pn == 0 && entry->distance <= plies) {
+        *pn = 0;
+        *dn = PN_INF;
+        *distance = entry->distance;
+    } else if (entry->dn == 0 && entry->plies >= plies) {
+        *pn = PN_INF;
+        *dn = 0;
+    } else if (entry->pn != 0 && entry->dn != 0 && entry->plies == plies) {
+        *pn = entry->pn;
+        *dn = entry->dn;
+    }
+}
+
+static void store(MateTable* table, uint64_t key, int plies, uint32_t pn, uint32_t dn, int distance) {
+    MateEntry* entry = &table->entries[key & table->mask];
+    entry->key = key;
+    entry->pn = pn;
+    entry->dn = dn;
+    entry->plies = plies;
+    entry->distance = distance;
+}
+
+INLINE uint32_t add_numbers(uint32_t a, uint32_t b) {
+    return a + b >= PN_INF ? PN_INF : a + b;
+}
+
+// Expands the position until its proof number reaches thpn or its disproof number thdn, or it is
+// decided. Children keep their numbers in local arrays as well, so the search still makes progress
+// when their table entries get overwritten.
+static void mid(Solver* solver, Board* board, uint64_t key, int plies, uint32_t thpn, uint32_t thdn,
+                uint32_t* pn, uint32_t* dn, int* distance) {
+    solver->nodes++;
+    bool attacker = board->active_color == solver->attacker;
+
+    Move moves[MAX_MOVES];
+    int n_moves = gen_moves(board, moves);
+    *distance = 0;
+    if (n_moves == 0 && !attacker && is_in_check(board)) {
+        // Checkmate.
+        *pn = 0;
+        *dn = PN_INF;
+        store(solver->table, key, plies, *pn, *dn, 0);
+        return;
+    }
+    if (n_moves == 0 || plies == 0) {
+        *pn = PN_INF;
+        *dn = 0;
+        store(solver->table, key, plies, *pn, *dn, 0);
+        return;
+    }
+
+    uint64_t keys[MAX_MOVES];
+    uint32_t child_pn[MAX_MOVES], child_dn[MAX_MOVES];
+    int child_distance[MAX_MOVES];
+    const Board copy = *board;
+    for (int i = 0; i < n_moves; i++) {
+        make_move(board, &moves[i]);
+        keys[i] = position_key(board);
+        *board = copy; // Undo move.
+        lookup(solver->table, keys[i], plies - 1, &child_pn[i], &child_dn[i], &child_distance[i]);
+    }
+
+    while (true) {
+        // The attacker needs one move to work, the defender all of them.
+        int best = 0;
+        uint32_t second = PN_INF;
+        uint32_t sum = 0;
+        int longest = 0;
+        if (attacker) {
+            *pn = PN_INF;
+            for (int i = 0; i < n_moves; i++) {
+                sum = add_numbers(sum, child_dn[i]);
+                if (child_pn[i] < *pn || (child_pn[i] == 0 && child_distance[i] < child_distance[best])) {
+                    second = *pn;
+                    *pn = child_pn[i];
+                    best = i;
+                } else if (child_pn[i] < second) {
+                    second = child_pn[i];
+                }
+            }
+            *dn = sum;
+            *distance = child_distance[best] + 1;
+        } else {
+            *dn = PN_INF;
+            for (int i = 0; i < n_moves; i++) {
+                sum = add_numbers(sum, child_pn[i]);
+                if (child_distance[i] > longest) longest = child_distance[i];
+                if (child_dn[i] < *dn) {
+                    second = *dn;
+                    *dn = child_dn[i];
+                    best = i;
+                } else if (child_dn[i] < second) {
+                    second = child_dn[i];
+                }
+            }
+            *pn = sum;
+            *distance = longest + 1;
+        }
+
+        if (*pn == 0 || *dn == 0 || *pn >= thpn || *dn >= thdn || solver->aborted) break;
+        if (solver->max_nodes != 0 && solver->nodes >= solver->max_nodes) {
+            solver->aborted = true;
+            break;
+        }
+
+        uint32_t next_pn, next_dn;
+        if (attacker) {
+            next_pn = thpn < second + 1 ? thpn : second + 1;
+            next_dn = add_numbers(thdn - *dn, child_dn[best]);
+        } else {
+            next_pn = add_numbers(thpn - *pn, child_pn[best]);
+            next_dn = thdn < second + 1 ? thdn : second + 1;
+        }
+
+        make_move(board, &moves[best]);
+        mid(solver, board, keys[best], plies - 1, next_pn, next_dn, &child_pn[best], &child_dn[best], &child_distance[best]);
+        *board = copy; // Undo move.
+    }
+
+    if (*pn != 0) *distance = 0;
+    store(solver->table, key, plies, *pn, *dn, *distance);
+}
+
+// Follows the proof: the attacker takes the fastest mate, the defender the slowest.
+static int follow_line(Solver* solver, Board* board, int plies, Move* line) {
+    int length = 0;
+    while (plies > 0) {
+        Move moves[MAX_MOVES];
+        int n_moves = gen_moves(board, moves);
+        bool attacker = board->active_color == solver->attacker;
+
+        uint64_t keys[MAX_MOVES];
+        uint32_t pn[MAX_MOVES], dn[MAX_MOVES];
+        int distance[MAX_MOVES];
+        bool proven = false;
+        const Board copy = *board;
+        for (int i = 0; i < n_moves; i++) {
+            make_move(board, &moves[i]);
+            keys[i] = position_key(board);
+            *board = copy; // Undo move.
+            lookup(solver->table, keys[i], plies - 1, &pn[i], &dn[i], &distance[i]);
+            proven |= pn[i] == 0;
+        }
+
+        // Entries of the line may have been overwritten, those are proven again. All moves of the
+        // defender are, the attacker only needs one.
+        for (int i = 0; i < n_moves && !(attacker && proven); i++) {
+            if (pn[i] == 0 || dn[i] == 0) continue;
+            make_move(board, &moves[i]);
+            mid(solver, board, keys[i], plies - 1, PN_INF, PN_INF, &pn[i], &dn[i], &distance[i]);
+            *board = copy; // Undo move.
+            proven |= pn[i] == 0;
+        }
+
+        int best = -1;
+        for (int i = 0; i < n_moves; i++) {
+            if (pn[i] != 0) continue;
+            if (best == -1 || (attacker ? distance[i] < distance[best] : distance[i] > distance[best])) best = i;
+        }
+        if (best == -1) break;
+
+        line[length++] = moves[best];
+        make_move(board, &moves[best]);
+        plies = distance[best];
+    }
+    return length;
+}
+
+int solve_mate(MateTable* table, Board* board, int max_moves, uint64_t max_nodes, MateResult* result) {
+    Solver solver = {table, board->active_color, 0, max_nodes, false};
+    if (max_moves > MATE_MAX_MOVES) max_moves = MATE_MAX_MOVES;
+
+    result->result = MATE_NONE;
+    result->moves = 0;
+    result->length = 0;
+
+    uint64_t key = position_key(board);
+    for (int moves = 1; moves <= max_moves; moves++) {
+        uint32_t pn, dn;
+        int distance;
+        mid(&solver, board, key, 2 * moves - 1, PN_INF, PN_INF, &pn, &dn, &distance);
+        if (solver.aborted) {
+            result->result = MATE_UNKNOWN;
+            break;
+        }
+        if (pn == 0) {
+            result->result = MATE_FOUND;
+            result->moves = moves;
+            Board copy = *board;
+            result->length = follow_line(&solver, &copy, distance, result->line);
+            break;
+        }
+    }
+
+    result->nodes = solver.nodes;
+    return result->result;
+}
\ No newline at end of file
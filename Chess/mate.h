@@ -0,0 +1,49 @@
+#ifndef MATE_H_
+#define MATE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "board.h"
+#include "move.h"
+
+// Mate solver based on depth-first proof-number search (df-pn).
+//
+// The side to move is the attacker. A position with the attacker to move is proven if any move
+// leads to a proven position, one with the defender to move if all moves do, and checkmating the
+// defender proves it. Proof numbers count how many positions still have to be proven to prove a
+// position, disproof numbers how many to disprove it, and the search always expands the position
+// which is cheapest to decide, going deeper as long as it stays under the thresholds passed down.
+//
+// Every position has a number of plies left and positions which run out of plies before the defender
+// is mated are disproven, so a proof is a mate within that many plies. Mates in 1 to max_moves are
+// tried one after the other, so the first proof is the shortest mate.
+//
+// The solver has its own table of proof and disproof numbers. A proof holds for more plies and a
+// disproof for fewer, so the table does not need clearing between positions.
+
+#define MATE_MAX_MOVES 32
+#define MATE_MAX_PLIES (2 * MATE_MAX_MOVES - 1)
+
+#define MATE_NONE 0 // No mate within max_moves.
+#define MATE_FOUND 1
+#define MATE_UNKNOWN 2 // The node limit was reached first.
+
+typedef struct MateTable MateTable;
+
+typedef struct {
+    int result;
+    int moves; // Mate in this many moves of the attacker.
+    int length; // Plies in line, 2 * moves - 1 if the whole line could be followed.
+    Move line[MATE_MAX_PLIES];
+    uint64_t nodes;
+} MateResult;
+
+// Number of entries as a power of two.
+MateTable* mate_table_alloc(int size);
+void mate_table_free(MateTable* table);
+
+// Looks for a mate for the side to move within max_moves moves, searching at most max_nodes
+// positions (0 for no limit).
+int solve_mate(MateTable* table, Board* board, int max_moves, uint64_t max_nodes, MateResult* result);
+
+#endif
\ No newline at end of file
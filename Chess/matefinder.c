@@ -0,0 +1,73 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "board.h"
+#include "move.h"
+#include "mate.h"
+
+// Solves mate problems with the proof-number mate solver. Prints the shortest mate for the side to
+// move with its main line, or that there is none within the given number of moves. The position is
+// given as an argument, or one FEN per line is read from standard input.
+// Usage: matefinder <max moves> [fen]
+
+#define TABLE_SIZE 22
+#define MAX_NODES 100000000
+
+void solve(MateTable* table, const char* fen, int max_moves) {
+    Board board;
+    board_from_fen(&board, fen);
+
+    MateResult result;
+    clock_t start = clock();
+    solve_mate(table, &board, max_moves, MAX_NODES, &result);
+    double seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    if (result.result == MATE_FOUND) {
+        printf("mate in %d:", result.moves);
+        for (int i = 0; i < result.length; i++) {
+            char move[6];
+            move_to_string(result.line[i], move);
+            printf(" %s", move);
+        }
+        printf("\n");
+    } else if (result.result == MATE_NONE) {
+        printf("no mate within %d\n", max_moves);
+    } else {
+        printf("unknown, node limit reached\n");
+    }
+    printf("nodes %llu, %.3f s\n", (unsigned long long) result.nodes, seconds);
+}
+
+int main(int argc, char* args[]) {
+    if (argc < 2) {
+        printf("Usage: matefinder <max moves> [fen]\n");
+        return 1;
+    }
+    init_magic_tables();
+    int max_moves = atoi(args[1]);
+    MateTable* table = mate_table_alloc(TABLE_SIZE);
+
+    if (argc > 2) {
+        // The FEN may also be passed unquoted, as separate arguments.
+        char fen[256] = "";
+        for (int i = 2; i < argc; i++) {
+            if (strlen(fen) + strlen(args[i]) + 2 > sizeof(fen)) break;
+            if (i > 2) strcat(fen, " ");
+            strcat(fen, args[i]);
+        }
+        solve(table, fen, max_moves);
+    } else {
+        char line[256];
+        while (fgets(line, sizeof(line), stdin)) {
+            line[strcspn(line, "\r\n")] = 0;
+            if (line[0] == 0) continue;
+            printf("%s\n", line);
+            solve(table, line, max_moves);
+        }
+    }
+
+    mate_table_free(table);
+    return 0;
+}
\ No newline at end of file
@@ -1,29 +1,47 @@
+#include <string.h>
 #include <stdbool.h>
 #include "bitboard.h"
 #include "board.h"
 #include "move.h"
 #include "evaluate.h"
 
-int score_move(Board* board, Move* move) {
-    Piece src = board->positions[move->from];
-    Piece dst = board->positions[move->to];
+// Most generators below come in two parts: an inlined kernel that takes the side to move as its
+// last argument, and the exported function which DISPATCHes to the kernel with a constant color.
+// Each kernel is compiled into a white and a black copy where the pawn shifts, masks and offsets
+// are constants and the color branches are gone.
+
+// Pawn moves relative to the given color. "Left" and "Right" are from the point of view of the player.
+#define PUSH(x, color) ((color) == WHITE ? (x) << 8 : (x) >> 8)
+#define CAPTURE_LEFT(x, color) ((color) == WHITE ? ((x) & ~FILEA) << 9 : ((x) & ~FILEH) >> 9)
+#define CAPTURE_RIGHT(x, color) ((color) == WHITE ? ((x) & ~FILEH) << 7 : ((x) & ~FILEA) >> 7)
+#define PUSH_OFFSET(color) ((color) == WHITE ? 8 : -8)
+#define CAPTURE_LEFT_OFFSET(color) ((color) == WHITE ? 9 : -9)
+#define CAPTURE_RIGHT_OFFSET(color) ((color) == WHITE ? 7 : -7)
+#define PROMOTION_RANK(color) ((color) == WHITE ? RANK7 : RANK2)
+#define DOUBLE_PUSH_RANK(color) ((color) == WHITE ? RANK3 : RANK6)
+
+int score_move(Board* board, const AttackInfo* info, Move* move) {
+    uint8_t from = MOVE_FROM(*move);
+    uint8_t to = MOVE_TO(*move);
+    Flag flags = MOVE_FLAGS(*move);
+
+    Piece src = board->positions[from];
+    Piece dst = board->positions[to];
 
     int score = 0;
     // Promotions.
-    score += PIECE_VALUES[PROMOTED_PIECE(move->flags)];
+    score += PIECE_VALUES[PROMOTED_PIECE(flags)];
     // Captures.
-    score += (PIECE_VALUES[dst] * CAPTURE_BONUS - PIECE_VALUES[src]) * IS_CAPTURE(move->flags);
+    score += (PIECE_VALUES[dst] * CAPTURE_BONUS - PIECE_VALUES[src]) * IS_CAPTURE(flags);
 
     if (src != PAWN) {
-        switch_ply(board);
-        Bitboard attacks = gen_attacks(board);
-        switch_ply(board);
+        Bitboard attacks = info->all[OPPOSITE(board->active_color) & 1];
         // Promote moving away from a piece currently attacked.
-        if (((1ULL << move->from) & attacks) != 0) {
+        if (((1ULL << from) & attacks) != 0) {
             score += PIECE_VALUES[src];
         }
         // Penalize moving to an attacked spot.
-        if (((1ULL << move->to) & attacks) != 0) {
+        if (((1ULL << to) & attacks) != 0) {
             score -= CAPTURE_BONUS * PIECE_VALUES[src];
         }
     }
@@ -35,8 +53,7 @@ int extract_moves_pawns(Bitboard board, int8_t offset, Move* moves, int start, F
     while (board != 0) {
         int pos = LSB(board);
         board &= board - 1;
-        Move* move = &moves[start++];
-        move->to = pos; move->from = pos - offset; move->flags = flag;
+        moves[start++] = MOVE(pos - offset, pos, flag);
     }
 
     return start;
@@ -46,141 +63,109 @@ int extract_moves_pawns_promotions(Bitboard board, int8_t offset, Move* moves, i
     while (board != 0) {
         int pos = LSB(board);
         board &= board - 1;
-        Move* move;
-        move = &moves[start++];
-        move->to = pos; move->from = pos - offset; move->flags = ADD_PROMOTED_PIECE(QUEEN) | flag;
-        move = &moves[start++];
-        move->to = pos; move->from = pos - offset; move->flags = ADD_PROMOTED_PIECE(KNIGHT) | flag;
-        move = &moves[start++];
-        move->to = pos; move->from = pos - offset; move->flags = ADD_PROMOTED_PIECE(BISHOP) | flag;
-        move = &moves[start++];
-        move->to = pos; move->from = pos - offset; move->flags = ADD_PROMOTED_PIECE(ROOK) | flag;
+        moves[start++] = MOVE(pos - offset, pos, PROMOTION_QUEEN | flag);
+        moves[start++] = MOVE(pos - offset, pos, PROMOTION_KNIGHT | flag);
+        moves[start++] = MOVE(pos - offset, pos, PROMOTION_BISHOP | flag);
+        moves[start++] = MOVE(pos - offset, pos, PROMOTION_ROOK | flag);
     }
 
     return start;
 }
 
-int gen_pawn_pushes(Board* board, Move* moves, int index) {
-    Bitboard pawns = get_pieces(board, PAWN, board->active_color);
+INLINE int pawn_pushes(Board* board, Move* moves, int index, const Piece color) {
+    Bitboard pawns = get_pieces(board, PAWN, color);
     Bitboard empty = ~get_all_pieces(board);
 
-    Bitboard single_pushes, double_pushes;
-    int8_t offset;
-
-    if (WHITE_TO_MOVE(board)) {
-        single_pushes = ((pawns & ~RANK7) << 8) & empty;
-        double_pushes = ((single_pushes & RANK3) << 8) & empty;
-        offset = 8;
-    } else {
-        single_pushes = ((pawns & ~RANK2) >> 8) & empty;
-        double_pushes = ((single_pushes & RANK6) >> 8) & empty;
-        offset = -8;
-    }
+    Bitboard single_pushes = PUSH(pawns & ~PROMOTION_RANK(color), color) & empty;
+    Bitboard double_pushes = PUSH(single_pushes & DOUBLE_PUSH_RANK(color), color) & empty;
 
-    index = extract_moves_pawns(single_pushes, offset, moves, index, QUIET);
-    index = extract_moves_pawns(double_pushes, offset * 2, moves, index, PAWN_DOUBLE | QUIET);
+    index = extract_moves_pawns(single_pushes, PUSH_OFFSET(color), moves, index, QUIET);
+    index = extract_moves_pawns(double_pushes, PUSH_OFFSET(color) * 2, moves, index, PAWN_DOUBLE | QUIET);
 
     return index;
 }
 
-int gen_pawn_captures(Board* board, Move* moves, int index) {
-    Bitboard pawns = get_pieces(board, PAWN, board->active_color);
-    Bitboard enemies = get_pieces_color(board, OPPOSITE(board->active_color));
-
-    if (WHITE_TO_MOVE(board)) {
-        Bitboard valid_pawns = pawns & ~RANK7;
-        Bitboard capture_left = ((valid_pawns & ~FILEA) << 9) & enemies;
-        index = extract_moves_pawns(capture_left, 9, moves, index, CAPTURE);
-        Bitboard capture_right = ((valid_pawns & ~FILEH) << 7) & enemies;
-        index = extract_moves_pawns(capture_right, 7, moves, index, CAPTURE);
-    } else {
-        Bitboard valid_pawns = pawns & ~RANK2;
-        Bitboard capture_left = ((valid_pawns & ~FILEH) >> 9) & enemies;
-        index = extract_moves_pawns(capture_left, -9, moves, index, CAPTURE);
-        Bitboard capture_right = ((valid_pawns & ~FILEA) >> 7) & enemies;
-        index = extract_moves_pawns(capture_right, -7, moves, index, CAPTURE);
-    }
+int gen_pawn_pushes(Board* board, Move* moves, int index) {
+    return DISPATCH(board, pawn_pushes, board, moves, index);
+}
+
+INLINE int pawn_captures(Board* board, Move* moves, int index, const Piece color) {
+    Bitboard pawns = get_pieces(board, PAWN, color) & ~PROMOTION_RANK(color);
+    Bitboard enemies = get_pieces_color(board, OPPOSITE(color));
+
+    Bitboard capture_left = CAPTURE_LEFT(pawns, color) & enemies;
+    index = extract_moves_pawns(capture_left, CAPTURE_LEFT_OFFSET(color), moves, index, CAPTURE);
+    Bitboard capture_right = CAPTURE_RIGHT(pawns, color) & enemies;
+    index = extract_moves_pawns(capture_right, CAPTURE_RIGHT_OFFSET(color), moves, index, CAPTURE);
 
     return index;
 }
 
-int gen_pawn_promotions_quiets(Board* board, Move* moves, int index) {
-    Bitboard pawns = get_pieces(board, PAWN, board->active_color);
+int gen_pawn_captures(Board* board, Move* moves, int index) {
+    return DISPATCH(board, pawn_captures, board, moves, index);
+}
+
+INLINE int pawn_promotions_quiets(Board* board, Move* moves, int index, const Piece color) {
+    Bitboard pawns = get_pieces(board, PAWN, color);
     Bitboard empty = ~get_all_pieces(board);
 
-    Bitboard promotions;
-    int8_t offset;
+    Bitboard promotions = PUSH(pawns & PROMOTION_RANK(color), color) & empty;
 
-    if (WHITE_TO_MOVE(board)) {
-        promotions = ((pawns & RANK7) << 8) & empty;
-        offset = 8;
-    } else {
-        promotions = ((pawns & RANK2) >> 8) & empty;
-        offset = -8;
-    }
+    return extract_moves_pawns_promotions(promotions, PUSH_OFFSET(color), moves, index, QUIET);
+}
+
+int gen_pawn_promotions_quiets(Board* board, Move* moves, int index) {
+    return DISPATCH(board, pawn_promotions_quiets, board, moves, index);
+}
+
+INLINE int pawn_promotions_captures(Board* board, Move* moves, int index, const Piece color) {
+    Bitboard pawns = get_pieces(board, PAWN, color) & PROMOTION_RANK(color);
+    Bitboard enemies = get_pieces_color(board, OPPOSITE(color));
 
-    index = extract_moves_pawns_promotions(promotions, offset, moves, index, QUIET);
+    Bitboard capture_left = CAPTURE_LEFT(pawns, color) & enemies;
+    index = extract_moves_pawns_promotions(capture_left, CAPTURE_LEFT_OFFSET(color), moves, index, CAPTURE);
+    Bitboard capture_right = CAPTURE_RIGHT(pawns, color) & enemies;
+    index = extract_moves_pawns_promotions(capture_right, CAPTURE_RIGHT_OFFSET(color), moves, index, CAPTURE);
 
     return index;
 }
 
 int gen_pawn_promotions_captures(Board* board, Move* moves, int index) {
-    Bitboard pawns = get_pieces(board, PAWN, board->active_color);
-    Bitboard enemies = get_pieces_color(board, OPPOSITE(board->active_color));
-
-    if (WHITE_TO_MOVE(board)) {
-        Bitboard valid_pawns = pawns & RANK7;
-        Bitboard capture_left = ((valid_pawns & ~FILEA) << 9) & enemies;
-        index = extract_moves_pawns_promotions(capture_left, 9, moves, index, CAPTURE);
-        Bitboard capture_right = ((valid_pawns & ~FILEH) << 7) & enemies;
-        index = extract_moves_pawns_promotions(capture_right, 7, moves, index, CAPTURE);
-    } else {
-        Bitboard valid_pawns = pawns & RANK2;
-        Bitboard capture_left = ((valid_pawns & ~FILEH) >> 9) & enemies;
-        index = extract_moves_pawns_promotions(capture_left, -9, moves, index, CAPTURE);
-        Bitboard capture_right = ((valid_pawns & ~FILEA) >> 7) & enemies;
-        index = extract_moves_pawns_promotions(capture_right, -7, moves, index, CAPTURE);
-    }
-
-    return index;
+    return DISPATCH(board, pawn_promotions_captures, board, moves, index);
 }
 
-int gen_pawn_en_passant(Board* board, Move* moves, int index) {
+INLINE int pawn_en_passant(Board* board, Move* moves, int index, const Piece color) {
     if (board->en_passant == 0) return index;
 
-    Bitboard pawns = get_pieces(board, PAWN, board->active_color);
+    Bitboard pawns = get_pieces(board, PAWN, color);
     Bitboard en_passant = 1ULL << board->en_passant;
 
-    if (WHITE_TO_MOVE(board)) {
-        Bitboard capture_left = ((pawns & ~FILEA) << 9) & en_passant;
-        index = extract_moves_pawns(capture_left, 9, moves, index, CAPTURE | EN_PASSANT);
-        Bitboard capture_right = ((pawns & ~FILEH) << 7) & en_passant;
-        index = extract_moves_pawns(capture_right, 7, moves, index, CAPTURE | EN_PASSANT);
-    } else {
-        Bitboard capture_left = ((pawns & ~FILEH) >> 9) & en_passant;
-        index = extract_moves_pawns(capture_left, -9, moves, index, CAPTURE | EN_PASSANT);
-        Bitboard capture_right = ((pawns & ~FILEA) >> 7) & en_passant;
-        index = extract_moves_pawns(capture_right, -7, moves, index, CAPTURE | EN_PASSANT);
-    }
+    Bitboard capture_left = CAPTURE_LEFT(pawns, color) & en_passant;
+    index = extract_moves_pawns(capture_left, CAPTURE_LEFT_OFFSET(color), moves, index, CAPTURE | EN_PASSANT);
+    Bitboard capture_right = CAPTURE_RIGHT(pawns, color) & en_passant;
+    index = extract_moves_pawns(capture_right, CAPTURE_RIGHT_OFFSET(color), moves, index, CAPTURE | EN_PASSANT);
 
     return index;
 }
 
+int gen_pawn_en_passant(Board* board, Move* moves, int index) {
+    return DISPATCH(board, pawn_en_passant, board, moves, index);
+}
+
 int extract_moves(Bitboard board, int8_t init, Move* moves, int start, Flag flag) {
     while (board != 0) {
         int pos = LSB(board);
         board &= board - 1;
-        Move* move = &moves[start++];
-        move->to = pos; move->from = init; move->flags = flag;
+        moves[start++] = MOVE(init, pos, flag);
     }
 
     return start;
 }
 
-int gen_knight_moves(Board* board, Move* moves, int index, bool captures_only) {
-    Bitboard knights = get_pieces(board, KNIGHT, board->active_color);
+INLINE int knight_moves(Board* board, Move* moves, int index, bool captures_only, const Piece color) {
+    Bitboard knights = get_pieces(board, KNIGHT, color);
     Bitboard empty = ~get_all_pieces(board);
-    Bitboard enemies = get_pieces_color(board, OPPOSITE(board->active_color));
+    Bitboard enemies = get_pieces_color(board, OPPOSITE(color));
 
     while (knights != 0) {
         int pos = LSB(knights);
@@ -194,10 +179,14 @@ int gen_knight_moves(Board* board, Move* moves, int index, bool captures_only) {
     return index;
 }
 
-int gen_king_moves(Board* board, Move* moves, int index, bool captures_only) {
-    Bitboard king = get_pieces(board, KING, board->active_color);
+int gen_knight_moves(Board* board, Move* moves, int index, bool captures_only) {
+    return DISPATCH(board, knight_moves, board, moves, index, captures_only);
+}
+
+INLINE int king_moves(Board* board, Move* moves, int index, bool captures_only, const Piece color) {
+    Bitboard king = get_pieces(board, KING, color);
     Bitboard empty = ~get_all_pieces(board);
-    Bitboard enemies = get_pieces_color(board, OPPOSITE(board->active_color));
+    Bitboard enemies = get_pieces_color(board, OPPOSITE(color));
 
     int pos = LSB(king);
     if (!captures_only) {
@@ -208,10 +197,12 @@ int gen_king_moves(Board* board, Move* moves, int index, bool captures_only) {
     return index;
 }
 
-int gen_cardinal_moves(Board* board, Move* moves, int index, bool captures_only) {
-    Piece color = board->active_color;
+int gen_king_moves(Board* board, Move* moves, int index, bool captures_only) {
+    return DISPATCH(board, king_moves, board, moves, index, captures_only);
+}
+
+INLINE int cardinal_moves(Board* board, Move* moves, int index, bool captures_only, const Piece color) {
     Bitboard cardinal = get_pieces(board, ROOK, color) | get_pieces(board, QUEEN, color);
-    Bitboard us = get_pieces_color(board, color);
     Bitboard enemies = get_pieces_color(board, OPPOSITE(color));
     Bitboard empty = ~get_all_pieces(board);
 
@@ -230,10 +221,12 @@ int gen_cardinal_moves(Board* board, Move* moves, int index, bool captures_only)
     return index;
 }
 
-int gen_intercardinal_moves(Board* board, Move* moves, int index, bool captures_only) {
-    Piece color = board->active_color;
+int gen_cardinal_moves(Board* board, Move* moves, int index, bool captures_only) {
+    return DISPATCH(board, cardinal_moves, board, moves, index, captures_only);
+}
+
+INLINE int intercardinal_moves(Board* board, Move* moves, int index, bool captures_only, const Piece color) {
     Bitboard intercardinal = get_pieces(board, BISHOP, color) | get_pieces(board, QUEEN, color);
-    Bitboard us = get_pieces_color(board, color);
     Bitboard enemies = get_pieces_color(board, OPPOSITE(color));
     Bitboard empty = ~get_all_pieces(board);
 
@@ -252,123 +245,40 @@ int gen_intercardinal_moves(Board* board, Move* moves, int index, bool captures_
     return index;
 }
 
-int gen_castle_moves(Board* board, Move* moves, int index) {
-    switch_ply(board);
-    Bitboard attacks = gen_attacks(board);
-    switch_ply(board);
-
-    Bitboard king = get_pieces(board, KING, board->active_color);
-    if ((king & attacks) == 0) { // If king is not in check.
-        uint8_t color = board->active_color & 1; // Maps White to 0, Black to 1.
-
-        Bitboard us = get_pieces_color(board, board->active_color);
-        Bitboard enemies = get_pieces_color(board, OPPOSITE(board->active_color));
-
-        if (can_castle_kingside(board, board->active_color)) {
-            if ((CASTLING[color][KINGSIDE_PATH] & (attacks | us | enemies)) == 0) {
-                Move* move = &moves[index++];
-                move->to = CASTLING[color][KING_DST_KINGSIDE];
-                move->from = CASTLING[color][KING_POSITION];
-                move->flags = CASTLE_KINGSIDE;
-            }
-        }
-        if (can_castle_queenside(board, board->active_color)) {
-            if ((CASTLING[color][QUEENSIDE_PATH] & (attacks | us | enemies)) == 0 &&
-                (CASTLING[color][QUEENSIDE_PATH_TO_ROOK] & (us | enemies)) == 0) {
-                Move* move = &moves[index++];
-                move->to = CASTLING[color][KING_DST_QUEENSIDE];
-                move->from = CASTLING[color][KING_POSITION];
-                move->flags = CASTLE_QUEENSIDE;
-            }
-        }
-    }
-
-    return index;
-}
-
-Bitboard gen_pawn_attacks(Board* board) {
-    Bitboard attacks = 0;
-    Bitboard pawns = get_pieces(board, PAWN, board->active_color);
-    if (WHITE_TO_MOVE(board)) {
-        attacks |= (pawns & ~FILEA) << 9;
-        attacks |= (pawns & ~FILEH) << 7;
-    } else {
-        attacks |= (pawns & ~FILEH) >> 9;
-        attacks |= (pawns & ~FILEA) >> 7;
-    }
-    return attacks;
+int gen_intercardinal_moves(Board* board, Move* moves, int index, bool captures_only) {
+    return DISPATCH(board, intercardinal_moves, board, moves, index, captures_only);
 }
 
-Bitboard gen_cardinal_attacks_classical(int position, Bitboard blockers) {
-    Bitboard attacks = 0;
-    Bitboard ray_blockers;
-
-    attacks |= ROOK_MOVES[position][NORTH];
-    ray_blockers = ROOK_MOVES[position][NORTH] & blockers;
-    attacks &= ~ROOK_MOVES[ray_blockers != 0 ? LSB(ray_blockers) : 64][NORTH];
-
-    attacks |= ROOK_MOVES[position][EAST];
-    ray_blockers = ROOK_MOVES[position][EAST] & blockers;
-    attacks &= ~ROOK_MOVES[ray_blockers != 0 ? MSB(ray_blockers) : 64][EAST];
-
-    attacks |= ROOK_MOVES[position][SOUTH];
-    ray_blockers = ROOK_MOVES[position][SOUTH] & blockers;
-    attacks &= ~ROOK_MOVES[ray_blockers != 0 ? MSB(ray_blockers) : 64][SOUTH];
-
-    attacks |= ROOK_MOVES[position][WEST];
-    ray_blockers = ROOK_MOVES[position][WEST] & blockers;
-    attacks &= ~ROOK_MOVES[ray_blockers != 0 ? LSB(ray_blockers) : 64][WEST];
-
-    return attacks;
+INLINE Bitboard pawn_attacks(Board* board, const Piece color) {
+    Bitboard pawns = get_pieces(board, PAWN, color);
+    return CAPTURE_LEFT(pawns, color) | CAPTURE_RIGHT(pawns, color);
 }
 
-Bitboard gen_intercardinal_attacks_classical(int position, Bitboard blockers) {
-    Bitboard attacks = 0;
-    Bitboard ray_blockers;
-    
-    attacks |= BISHOP_MOVES[position][SOUTHEAST];
-    ray_blockers = BISHOP_MOVES[position][SOUTHEAST] & blockers;
-    attacks &= ~BISHOP_MOVES[ray_blockers != 0 ? MSB(ray_blockers) : 64][SOUTHEAST];
-
-    attacks |= BISHOP_MOVES[position][SOUTHWEST];
-    ray_blockers = BISHOP_MOVES[position][SOUTHWEST] & blockers;
-    attacks &= ~BISHOP_MOVES[ray_blockers != 0 ? MSB(ray_blockers) : 64][SOUTHWEST];
-
-    attacks |= BISHOP_MOVES[position][NORTHEAST];
-    ray_blockers = BISHOP_MOVES[position][NORTHEAST] & blockers;
-    attacks &= ~BISHOP_MOVES[ray_blockers != 0 ? LSB(ray_blockers) : 64][NORTHEAST];
-
-    attacks |= BISHOP_MOVES[position][NORTHWEST];
-    ray_blockers = BISHOP_MOVES[position][NORTHWEST] & blockers;
-    attacks &= ~BISHOP_MOVES[ray_blockers != 0 ? LSB(ray_blockers) : 64][NORTHWEST];
-
-    return attacks;
+Bitboard gen_pawn_attacks(Board* board) {
+    return DISPATCH(board, pawn_attacks, board);
 }
 
 Bitboard gen_cardinal_attacks_magic(int position, Bitboard blockers) {
-    Bitboard key = (blockers & ROOK_BLOCKER_MASK[position]) * ROOK_MAGIC[position];
-    key >>= (64 - ROOK_OFFSET[position]);
-    return ROOK_TABLE[position][key];
+    Bitboard key = MAGIC_KEY(blockers, ROOK_BLOCKER_MASK[position], ROOK_MAGIC[position], ROOK_OFFSET[position]);
+    return ROOK_TABLE[ROOK_INDEX[position] + key];
 }
 
 Bitboard gen_intercardinal_attacks_magic(int position, Bitboard blockers) {
-    Bitboard key = (blockers & BISHOP_BLOCKER_MASK[position]) * BISHOP_MAGIC[position];
-    key >>= (64 - BISHOP_OFFSET[position]);
-    return BISHOP_TABLE[position][key];
+    Bitboard key = MAGIC_KEY(blockers, BISHOP_BLOCKER_MASK[position], BISHOP_MAGIC[position], BISHOP_OFFSET[position]);
+    return BISHOP_TABLE[BISHOP_INDEX[position] + key];
 }
 
-Bitboard gen_attacks(Board* board) {
+// Squares attacked by the given color.
+INLINE Bitboard attacks(Board* board, const Piece color) {
     Bitboard attacks = 0;
 
-    Piece active = board->active_color;
-    Piece inactive = OPPOSITE(active);
     Bitboard empty = ~get_all_pieces(board);
 
     // Pawn Attacks.
-    attacks |= gen_pawn_attacks(board);
+    attacks |= pawn_attacks(board, color);
 
     // Knight Attacks.
-    Bitboard knights = get_pieces(board, KNIGHT, active);
+    Bitboard knights = get_pieces(board, KNIGHT, color);
     while (knights != 0) {
         int pos = LSB(knights);
         knights &= knights - 1;
@@ -376,12 +286,12 @@ Bitboard gen_attacks(Board* board) {
     }
 
     // King Attacks.
-    Bitboard king = get_pieces(board, KING, active);
+    Bitboard king = get_pieces(board, KING, color);
     attacks |= KING_MOVES[LSB(king)];
 
-    Bitboard rooks = get_pieces(board, ROOK, active);
-    Bitboard bishops = get_pieces(board, BISHOP, active);
-    Bitboard queens = get_pieces(board, QUEEN, active);
+    Bitboard rooks = get_pieces(board, ROOK, color);
+    Bitboard bishops = get_pieces(board, BISHOP, color);
+    Bitboard queens = get_pieces(board, QUEEN, color);
     // Sliding Attacks.
     Bitboard sliding_cardinal = rooks | queens;
     while (sliding_cardinal != 0) {
@@ -399,52 +309,42 @@ Bitboard gen_attacks(Board* board) {
     return attacks;
 }
 
-int gen_moves(Board* board, Move* moves) {
-    int index = 0;
-
-    index = gen_king_moves(board, moves, index, false);
-
-    index = gen_pawn_promotions_quiets(board, moves, index);
-    index = gen_pawn_promotions_captures(board, moves, index);
-    index = gen_pawn_captures(board, moves, index);
+Bitboard gen_attacks(Board* board) {
+    return DISPATCH(board, attacks, board);
+}
 
-    index = gen_knight_moves(board, moves, index, false);
-    index = gen_cardinal_moves(board, moves, index, false);
-    index = gen_intercardinal_moves(board, moves, index, false);
+INLINE int castle_moves(Board* board, const AttackInfo* info, Move* moves, int index, const Piece color) {
+    Bitboard attacked = info->all[OPPOSITE(color) & 1];
 
-    index = gen_pawn_pushes(board, moves, index);
-    index = gen_pawn_en_passant(board, moves, index);
+    Bitboard king = get_pieces(board, KING, color);
+    if ((king & attacked) == 0) { // If king is not in check.
+        const int side = color & 1; // Maps White to 0, Black to 1.
 
-    index = filter_legal(board, moves, index);
+        Bitboard all = get_all_pieces(board);
 
-    // gen_castle_moves generates legal castling moves only.
-    if (can_castle_color(board, board->active_color)) {
-        index = gen_castle_moves(board, moves, index);
+        if (can_castle_kingside(board, color)) {
+            if ((CASTLING[side][KINGSIDE_PATH] & (attacked | all)) == 0) {
+                moves[index++] = MOVE(CASTLING[side][KING_POSITION], CASTLING[side][KING_DST_KINGSIDE], CASTLE_KINGSIDE);
+            }
+        }
+        if (can_castle_queenside(board, color)) {
+            if ((CASTLING[side][QUEENSIDE_PATH] & (attacked | all)) == 0 &&
+                (CASTLING[side][QUEENSIDE_PATH_TO_ROOK] & all) == 0) {
+                moves[index++] = MOVE(CASTLING[side][KING_POSITION], CASTLING[side][KING_DST_QUEENSIDE], CASTLE_QUEENSIDE);
+            }
+        }
     }
 
     return index;
 }
 
-int gen_captures(Board* board, Move* moves) {
-    int index = 0;
-
-    index = gen_king_moves(board, moves, index, true);
-
-    index = gen_pawn_promotions_captures(board, moves, index);
-    index = gen_pawn_captures(board, moves, index);
-
-    index = gen_knight_moves(board, moves, index, true);
-    index = gen_cardinal_moves(board, moves, index, true);
-    index = gen_intercardinal_moves(board, moves, index, true);
-
-    index = gen_pawn_en_passant(board, moves, index);
-
-    return filter_legal(board, moves, index);
+int gen_castle_moves(Board* board, const AttackInfo* info, Move* moves, int index) {
+    return DISPATCH(board, castle_moves, board, info, moves, index);
 }
 
-Bitboard gen_checkers(Board* board, int position) {
-    Piece active = board->active_color;
-    Piece inactive = OPPOSITE(active);
+// Pieces of the opponent of the given color attacking the given square.
+INLINE Bitboard checkers(Board* board, int position, const Piece color) {
+    Piece inactive = OPPOSITE(color);
 
     Bitboard checks = 0;
 
@@ -456,13 +356,7 @@ Bitboard gen_checkers(Board* board, int position) {
 
     // Pawn Checks.
     Bitboard pawns = get_pieces(board, PAWN, inactive);
-    if (WHITE_TO_MOVE(board)) {
-        checks |= ((piece & ~FILEA) << 9) & pawns;
-        checks |= ((piece & ~FILEH) << 7) & pawns;
-    } else {
-        checks |= ((piece & ~FILEH) >> 9) & pawns;
-        checks |= ((piece & ~FILEA) >> 7) & pawns;
-    }
+    checks |= (CAPTURE_LEFT(piece, color) | CAPTURE_RIGHT(piece, color)) & pawns;
 
     // Sliding Checks.
     Bitboard rooks = get_pieces(board, ROOK, inactive);
@@ -475,36 +369,268 @@ Bitboard gen_checkers(Board* board, int position) {
     return checks;
 }
 
-int filter_legal(Board* board, Move* moves, int size) {
-    const Board copy = *board;
-    int king_pos = LSB(get_pieces(board, KING, board->active_color));
+Bitboard gen_checkers(Board* board, int position) {
+    return DISPATCH(board, checkers, board, position);
+}
+
+INLINE void add_attacks(Bitboard attacks, Bitboard* by_piece, Bitboard* all, Bitboard* twice) {
+    *by_piece |= attacks;
+    *twice |= *all & attacks;
+    *all |= attacks;
+}
+
+// Fills in the attack sets of one side.
+INLINE void side_attacks(Board* board, AttackInfo* info, const Piece color) {
+    const int side = color & 1;
+    Bitboard* by_piece = info->by_piece[side];
+    Bitboard blockers = get_all_pieces(board);
+
+    Bitboard pawns = get_pieces(board, PAWN, color);
+    Bitboard left = CAPTURE_LEFT(pawns, color);
+    Bitboard right = CAPTURE_RIGHT(pawns, color);
+    by_piece[EMPTY] = 0;
+    by_piece[PAWN] = left | right;
+    Bitboard all = left | right;
+    Bitboard twice = left & right;
+
+    by_piece[KNIGHT] = 0;
+    Bitboard knights = get_pieces(board, KNIGHT, color);
+    while (knights != 0) {
+        int pos = LSB(knights);
+        knights &= knights - 1;
+        add_attacks(KNIGHT_MOVES[pos], &by_piece[KNIGHT], &all, &twice);
+    }
+
+    by_piece[BISHOP] = 0;
+    Bitboard bishops = get_pieces(board, BISHOP, color);
+    while (bishops != 0) {
+        int pos = LSB(bishops);
+        bishops &= bishops - 1;
+        add_attacks(gen_intercardinal_attacks_magic(pos, blockers), &by_piece[BISHOP], &all, &twice);
+    }
+
+    by_piece[ROOK] = 0;
+    Bitboard rooks = get_pieces(board, ROOK, color);
+    while (rooks != 0) {
+        int pos = LSB(rooks);
+        rooks &= rooks - 1;
+        add_attacks(gen_cardinal_attacks_magic(pos, blockers), &by_piece[ROOK], &all, &twice);
+    }
+
+    by_piece[QUEEN] = 0;
+    Bitboard queens = get_pieces(board, QUEEN, color);
+    while (queens != 0) {
+        int pos = LSB(queens);
+        queens &= queens - 1;
+        Bitboard attacks = gen_cardinal_attacks_magic(pos, blockers) | gen_intercardinal_attacks_magic(pos, blockers);
+        add_attacks(attacks, &by_piece[QUEEN], &all, &twice);
+    }
+
+    by_piece[KING] = 0;
+    add_attacks(KING_MOVES[LSB(get_pieces(board, KING, color))], &by_piece[KING], &all, &twice);
+
+    info->all[side] = all;
+    info->twice[side] = twice;
+}
+
+INLINE void attack_info(Board* board, AttackInfo* info, const Piece color) {
+    const Piece inactive = OPPOSITE(color);
+    side_attacks(board, info, color);
+    side_attacks(board, info, inactive);
+
+    int king = LSB(get_pieces(board, KING, color));
+    info->checkers = checkers(board, king, color);
+
+    // Enemy sliders which would attack the king if our own pieces were not in the way. A piece is
+    // pinned when it is the only one between such a slider and the king, which is the one square
+    // both of them attack.
+    Bitboard all = get_all_pieces(board);
+    Bitboard us = get_pieces_color(board, color);
+    Bitboard them = get_pieces_color(board, inactive);
+    Bitboard queens = get_pieces(board, QUEEN, inactive);
+    Bitboard pinned = 0;
+
+    Bitboard cardinal = gen_cardinal_attacks_magic(king, all);
+    Bitboard pinners = gen_cardinal_attacks_magic(king, them) & (get_pieces(board, ROOK, inactive) | queens);
+    while (pinners != 0) {
+        int pos = LSB(pinners);
+        pinners &= pinners - 1;
+        pinned |= cardinal & gen_cardinal_attacks_magic(pos, all) & us;
+    }
+
+    Bitboard intercardinal = gen_intercardinal_attacks_magic(king, all);
+    pinners = gen_intercardinal_attacks_magic(king, them) & (get_pieces(board, BISHOP, inactive) | queens);
+    while (pinners != 0) {
+        int pos = LSB(pinners);
+        pinners &= pinners - 1;
+        pinned |= intercardinal & gen_intercardinal_attacks_magic(pos, all) & us;
+    }
+
+    info->pinned = pinned;
+}
+
+void gen_attack_info(Board* board, AttackInfo* info) {
+    DISPATCH(board, attack_info, board, info);
+}
+
+// Only moves the pieces in the state bitboards, which is all the legality check in legal_moves looks
+// at. The rest of the board, including the piece positions, is left as it was.
+INLINE void move_cheap(Board* board, Move* move, const Piece color) {
+    uint8_t src = MOVE_FROM(*move);
+    uint8_t dst = MOVE_TO(*move);
+
+    Piece src_piece = board->positions[src];
+    Piece dst_piece = board->positions[dst];
+
+    Flag flags = MOVE_FLAGS(*move);
+
+    Piece inactive = OPPOSITE(color);
+
+    Bitboard from = 1ULL << src;
+    Bitboard to = 1ULL << dst;
+
+    if (IS_CAPTURE(flags)) {
+        if (IS_EN_PASSANT(flags)) {
+            Bitboard captured = 1ULL << (dst - PUSH_OFFSET(color));
+            board->state[PAWN] ^= captured;
+            board->state[inactive] ^= captured;
+        } else {
+            board->state[dst_piece] ^= to;
+            board->state[inactive] ^= to;
+        }
+    }
+
+    board->state[src_piece] ^= from;
+    board->state[IS_PROMOTION(flags) ? PROMOTED_PIECE(flags) : src_piece] ^= to;
+    board->state[color] ^= from | to;
+
+    // If the move was a castle, move the rook to the corresponding position.
+    if (IS_CASTLE(flags)) {
+        bool is_castle_kingside = IS_CASTLE_KINGSIDE(flags);
+        Bitboard rook;
+        if (color == WHITE) {
+            rook = is_castle_kingside ? (1ULL << H1) | (1ULL << F1) : (1ULL << A1) | (1ULL << D1);
+        } else {
+            rook = is_castle_kingside ? (1ULL << H8) | (1ULL << F8) : (1ULL << A8) | (1ULL << D8);
+        }
+        board->state[ROOK] ^= rook;
+        board->state[color] ^= rook;
+    }
+}
+
+INLINE int legal_moves(Board* board, const AttackInfo* info, Move* moves, int size, const Piece color) {
+    Bitboard state[8];
+    memcpy(state, board->state, sizeof(state));
+    int king_pos = LSB(get_pieces(board, KING, color));
+    Bitboard attacked = info->all[OPPOSITE(color) & 1];
 
     int n_legal = 0;
     for (int i = 0; i < size; i++) {
         Move* move = &moves[i];
-        int pos = board->positions[move->from] == KING ? move->to : king_pos;
-        make_move_cheap(board, move);
+        bool is_king = board->positions[MOVE_FROM(*move)] == KING;
+        // Out of check, a king move is legal if the square is not attacked, and any other move is
+        // legal unless the piece is pinned. En passant removes two pieces from the rank of the king,
+        // so it is always checked by making the move.
+        if (info->checkers == 0 && !IS_EN_PASSANT(MOVE_FLAGS(*move))) {
+            if (is_king) {
+                if (((1ULL << MOVE_TO(*move)) & attacked) == 0) moves[n_legal++] = *move;
+                continue;
+            }
+            if (((1ULL << MOVE_FROM(*move)) & info->pinned) == 0) {
+                moves[n_legal++] = *move;
+                continue;
+            }
+        }
+
+        int pos = is_king ? MOVE_TO(*move) : king_pos;
+        move_cheap(board, move, color);
         // If king is not in check after making the move, then it is legal.
-        if (gen_checkers(board, pos) == 0) {
+        if (checkers(board, pos, color) == 0) {
             moves[n_legal++] = *move;
         }
-        *board = copy; // Undo move.
+        memcpy(board->state, state, sizeof(state)); // Undo move.
     }
 
     return n_legal;
 }
 
-void make_move(Board* board, Move* move) {
-    uint8_t src = move->from;
-    uint8_t dst = move->to;
+int filter_legal(Board* board, const AttackInfo* info, Move* moves, int size) {
+    return DISPATCH(board, legal_moves, board, info, moves, size);
+}
+
+INLINE int all_moves(Board* board, const AttackInfo* info, Move* moves, const Piece color) {
+    int index = 0;
+
+    index = king_moves(board, moves, index, false, color);
+
+    index = pawn_promotions_quiets(board, moves, index, color);
+    index = pawn_promotions_captures(board, moves, index, color);
+    index = pawn_captures(board, moves, index, color);
+
+    index = knight_moves(board, moves, index, false, color);
+    index = cardinal_moves(board, moves, index, false, color);
+    index = intercardinal_moves(board, moves, index, false, color);
+
+    index = pawn_pushes(board, moves, index, color);
+    index = pawn_en_passant(board, moves, index, color);
+
+    index = legal_moves(board, info, moves, index, color);
+
+    // castle_moves generates legal castling moves only.
+    if (can_castle_color(board, color)) {
+        index = castle_moves(board, info, moves, index, color);
+    }
+
+    return index;
+}
+
+int gen_moves(Board* board, Move* moves) {
+    AttackInfo info;
+    gen_attack_info(board, &info);
+    return DISPATCH(board, all_moves, board, &info, moves);
+}
+
+int gen_moves_info(Board* board, const AttackInfo* info, Move* moves) {
+    return DISPATCH(board, all_moves, board, info, moves);
+}
+
+INLINE int capture_moves(Board* board, const AttackInfo* info, Move* moves, const Piece color) {
+    int index = 0;
+
+    index = king_moves(board, moves, index, true, color);
+
+    index = pawn_promotions_captures(board, moves, index, color);
+    index = pawn_captures(board, moves, index, color);
+
+    index = knight_moves(board, moves, index, true, color);
+    index = cardinal_moves(board, moves, index, true, color);
+    index = intercardinal_moves(board, moves, index, true, color);
+
+    index = pawn_en_passant(board, moves, index, color);
+
+    return legal_moves(board, info, moves, index, color);
+}
+
+int gen_captures(Board* board, Move* moves) {
+    AttackInfo info;
+    gen_attack_info(board, &info);
+    return DISPATCH(board, capture_moves, board, &info, moves);
+}
+
+int gen_captures_info(Board* board, const AttackInfo* info, Move* moves) {
+    return DISPATCH(board, capture_moves, board, info, moves);
+}
+
+INLINE void move_full(Board* board, Move* move, const Piece color) {
+    uint8_t src = MOVE_FROM(*move);
+    uint8_t dst = MOVE_TO(*move);
 
     Piece src_piece = board->positions[src];
     Piece dst_piece = board->positions[dst];
 
-    Flag flags = move->flags;
+    Flag flags = MOVE_FLAGS(*move);
 
-    Piece active = board->active_color;
-    Piece inactive = OPPOSITE(active);
+    Piece inactive = OPPOSITE(color);
 
     if (src_piece == PAWN || IS_CAPTURE(flags)) {
         board->half_moves = 0;
@@ -512,22 +638,22 @@ void make_move(Board* board, Move* move) {
         board->half_moves++;
     }
 
-    if (active == BLACK) {
+    if (color == BLACK) {
         board->full_moves++;
     }
 
-    // If King moved and it wasn't a castle, then the player can no longer castle.
-    if (src_piece == KING && !IS_CASTLE(flags)) {
-        remove_castle_kingside(board, active);
-        remove_castle_queenside(board, active);
+    // If King moved, then the player can no longer castle.
+    if (src_piece == KING) {
+        remove_castle_kingside(board, color);
+        remove_castle_queenside(board, color);
     }
 
     // If any of the rooks moved from one of the corners, then the player can no longer castle on that side.
     if (src_piece == ROOK) {
         if (src == H1 || src == H8) {
-            remove_castle_kingside(board, active);
+            remove_castle_kingside(board, color);
         } else if (src == A1 || src == A8) {
-            remove_castle_queenside(board, active);
+            remove_castle_queenside(board, color);
         }
     }
 
@@ -542,25 +668,23 @@ void make_move(Board* board, Move* move) {
         }
 
         if (IS_EN_PASSANT(flags)) {
-            int8_t offset = WHITE_TO_MOVE(board) ? -8 : 8;
-            remove_piece(board, PAWN, inactive, dst + offset);
+            remove_piece(board, PAWN, inactive, dst - PUSH_OFFSET(color));
         } else {
             remove_piece(board, dst_piece, inactive, dst);
         }
     }
 
-    remove_piece(board, src_piece, active, src);
+    remove_piece(board, src_piece, color, src);
 
     if (IS_PROMOTION(flags)) {
         // If the flag is a promotion, the top 3 bits contain the piece promoted.
-        add_piece(board, PROMOTED_PIECE(flags), active, dst);
+        add_piece(board, PROMOTED_PIECE(flags), color, dst);
     } else {
-        add_piece(board, src_piece, active, dst);
+        add_piece(board, src_piece, color, dst);
     }
 
     if (IS_DOUBLE_PUSH(flags)) {
-        int8_t offset = WHITE_TO_MOVE(board) ? -8 : 8;
-        board->en_passant = dst + offset;
+        board->en_passant = dst - PUSH_OFFSET(color);
     } else {
         // If the right to capture en passant is not exercised immediately, it is subsequently lost.
         // If an en passant capture happens, then it is lost as well.
@@ -570,63 +694,34 @@ void make_move(Board* board, Move* move) {
     // If the move was a castle, move the rook to the corresponding position.
     if (IS_CASTLE(flags)) {
         if (IS_CASTLE_KINGSIDE(flags)) {
-            if (WHITE_TO_MOVE(board)) {
-                remove_piece(board, ROOK, active, H1);
-                add_piece(board, ROOK, active, F1);
-            } else {
-                remove_piece(board, ROOK, active, H8);
-                add_piece(board, ROOK, active, F8);
-            }
-            remove_castle_kingside(board, active);
+            remove_piece(board, ROOK, color, color == WHITE ? H1 : H8);
+            add_piece(board, ROOK, color, color == WHITE ? F1 : F8);
+            remove_castle_kingside(board, color);
         } else if (IS_CASTLE_QUEENSIDE(flags)) {
-            if (WHITE_TO_MOVE(board)) {
-                remove_piece(board, ROOK, active, A1);
-                add_piece(board, ROOK, active, D1);
-            } else {
-                remove_piece(board, ROOK, active, A8);
-                add_piece(board, ROOK, active, D8);
-            }
-            remove_castle_queenside(board, active);
+            remove_piece(board, ROOK, color, color == WHITE ? A1 : A8);
+            add_piece(board, ROOK, color, color == WHITE ? D1 : D8);
+            remove_castle_queenside(board, color);
         }
     }
 
     board->active_color = inactive;
 }
 
-void make_move_cheap(Board* board, Move* move) {
-    uint8_t src = move->from;
-    uint8_t dst = move->to;
-
-    Piece src_piece = board->positions[src];
-    Piece dst_piece = board->positions[dst];
-
-    Flag flags = move->flags;
-
-    Piece active = board->active_color;
-    Piece inactive = OPPOSITE(active);
-
-    if (IS_CAPTURE(flags)) {
-        if (IS_EN_PASSANT(flags)) {
-            int8_t offset = WHITE_TO_MOVE(board) ? -8 : 8;
-            remove_piece(board, PAWN, inactive, dst + offset);
-        } else {
-            remove_piece(board, dst_piece, inactive, dst);
-        }
-    }
-
-    remove_piece(board, src_piece, active, src);
-
-    add_piece(board, IS_PROMOTION(flags) ? PROMOTED_PIECE(flags) : src_piece, active, dst);
+void make_move(Board* board, Move* move) {
+    DISPATCH(board, move_full, board, move);
+}
 
-    // If the move was a castle, move the rook to the corresponding position.
-    if (IS_CASTLE(flags)) {
-        bool is_castle_kingside = IS_CASTLE_KINGSIDE(flags);
-        if (WHITE_TO_MOVE(board)) {
-            remove_piece(board, ROOK, active, is_castle_kingside ? H1 : A1);
-            add_piece(board, ROOK, active, is_castle_kingside ? F1 : D1);
-        } else {
-            remove_piece(board, ROOK, active, is_castle_kingside ? H8 : A8);
-            add_piece(board, ROOK, active, is_castle_kingside ? F8 : D8);
-        }
-    }
+void make_move_cheap(Board* board, Move* move) {
+    DISPATCH(board, move_cheap, board, move);
 }
+
+// Files are numbered from the H file, see board_from_fen.
+void move_to_string(Move move, char* str) {
+    int from = MOVE_FROM(move), to = MOVE_TO(move);
+    str[0] = 'a' + 7 - (from & 7);
+    str[1] = '1' + (from >> 3);
+    str[2] = 'a' + 7 - (to & 7);
+    str[3] = '1' + (to >> 3);
+    str[4] = IS_PROMOTION(MOVE_FLAGS(move)) ? " pnkbrq"[PROMOTED_PIECE(MOVE_FLAGS(move))] : '\0';
+    str[5] = '\0';
+}
\ No newline at end of file
@@ -6,42 +6,59 @@
 #include "bitboard.h"
 #include "board.h"
 
-// 1st Bit: Is move a capture?
-// 2nd Bit: Is move a double pawn push?
-// 3rd-5th Bits: Is move a pawn promotion? (Bits contain piece that was promoted).
-// 6th Bit: Is move an en passant capture?
-// 7th Bit: Is move a castle kingside?
-// 8th Bit: Is move a castle queenside?
+// Moves are packed into 16 bits:
+// Bits 0-5: Destination square.
+// Bits 6-11: Source square.
+// Bits 12-15: Kind of move (see the Flag values below).
+typedef uint16_t Move;
+
+// 4 bit move kind. The 3rd bit marks captures and the 4th bit promotions, in which case the
+// lower two bits select the promoted piece.
 typedef uint8_t Flag;
 
 #define QUIET 0x0
-#define CAPTURE 0x1
-#define PAWN_DOUBLE 0x2
-#define PROMOTION 0x1c
-#define EN_PASSANT 0x20
-#define CASTLE_KINGSIDE 0x40
-#define CASTLE_QUEENSIDE 0x80
-#define CASTLE 0xc0
+#define PAWN_DOUBLE 0x1
+#define CASTLE_KINGSIDE 0x2
+#define CASTLE_QUEENSIDE 0x3
+#define CAPTURE 0x4
+#define EN_PASSANT 0x5
+#define PROMOTION 0x8
+#define PROMOTION_KNIGHT 0x8
+#define PROMOTION_BISHOP 0x9
+#define PROMOTION_ROOK 0xa
+#define PROMOTION_QUEEN 0xb
 
 #define IS_CAPTURE(x) (((x) & CAPTURE) != 0)
-#define IS_DOUBLE_PUSH(x) (((x) & PAWN_DOUBLE) != 0)
+#define IS_DOUBLE_PUSH(x) ((x) == PAWN_DOUBLE)
 #define IS_PROMOTION(x) (((x) & PROMOTION) != 0)
-#define IS_EN_PASSANT(x) (((x) & EN_PASSANT) != 0)
-#define IS_CASTLE_KINGSIDE(x) (((x) & CASTLE_KINGSIDE) != 0)
-#define IS_CASTLE_QUEENSIDE(x) (((x) & CASTLE_QUEENSIDE) != 0)
-#define IS_CASTLE(x) (((x) & CASTLE) != 0)
+#define IS_EN_PASSANT(x) ((x) == EN_PASSANT)
+#define IS_CASTLE_KINGSIDE(x) ((x) == CASTLE_KINGSIDE)
+#define IS_CASTLE_QUEENSIDE(x) ((x) == CASTLE_QUEENSIDE)
+#define IS_CASTLE(x) (((x) & 0xe) == CASTLE_KINGSIDE)
 
-#define ADD_PROMOTED_PIECE(x) ((x) << 2)
-#define PROMOTED_PIECE(x) (((x) & PROMOTION) >> 2)
+// Piece for every move kind, packed 4 bits per kind. EMPTY for all kinds that are not promotions.
+#define PROMOTED_PIECE(x) ((Piece)((0x6542654200000000ULL >> ((x) * 4)) & 0xf))
+
+#define MOVE(from, to, flags) ((Move)((to) | ((from) << 6) | ((flags) << 12)))
+#define MOVE_TO(x) ((x) & 0x3f)
+#define MOVE_FROM(x) (((x) >> 6) & 0x3f)
+#define MOVE_FLAGS(x) ((Flag)((x) >> 12))
+
+#define NULL_MOVE 0
 
 #define MAX_MOVES 218
 
+// Attack sets of both sides, computed once per node and shared by move ordering, castling, the
+// legality checks and the evaluation. Indexed by color & 1.
 typedef struct {
-    uint8_t to, from;
-    Flag flags;
-} Move;
+    Bitboard by_piece[2][7]; // Squares attacked by each piece type.
+    Bitboard all[2];
+    Bitboard twice[2]; // Squares attacked by at least two pieces.
+    Bitboard checkers; // Enemy pieces giving check to the side to move.
+    Bitboard pinned; // Pieces of the side to move pinned to their king.
+} AttackInfo;
 
-int score_move(Board* board, Move* move);
+int score_move(Board* board, const AttackInfo* info, Move* move);
 
 int extract_moves_pawns(Bitboard board, int8_t offset, Move* moves, int start, Flag flag);
 int extract_moves_pawns_promotions(Bitboard board, int8_t offset, Move* moves, int start, Flag flag);
@@ -59,21 +76,26 @@ int gen_king_moves(Board* board, Move* moves, int index, bool captures_only);
 int gen_cardinal_moves(Board* board, Move* moves, int index, bool captures_only);
 int gen_intercardinal_moves(Board* board, Move* moves, int index, bool captures_only);
 
-int gen_castle_moves(Board* board, Move* moves, int index);
+int gen_castle_moves(Board* board, const AttackInfo* info, Move* moves, int index);
 
 Bitboard gen_pawn_attacks(Board* board);
-Bitboard gen_cardinal_attacks_classical(int position, Bitboard blockers);
-Bitboard gen_intercardinal_attacks_classical(int position, Bitboard blockers);
 Bitboard gen_cardinal_attacks_magic(int position, Bitboard blockers);
 Bitboard gen_intercardinal_attacks_magic(int position, Bitboard blockers);
 Bitboard gen_attacks(Board* board);
+void gen_attack_info(Board* board, AttackInfo* info);
 
+// The _info variants reuse attack info already computed for the board.
 int gen_moves(Board* board, Move* moves);
+int gen_moves_info(Board* board, const AttackInfo* info, Move* moves);
 int gen_captures(Board* board, Move* moves);
+int gen_captures_info(Board* board, const AttackInfo* info, Move* moves);
 Bitboard gen_checkers(Board* board, int position);
-int filter_legal(Board* board, Move* moves, int size);
+int filter_legal(Board* board, const AttackInfo* info, Move* moves, int size);
 
 void make_move(Board* board, Move* move);
 void make_move_cheap(Board* board, Move* move);
 
+// Writes the move in coordinate notation, like e2e4 or e7e8q. str needs room for 6 characters.
+void move_to_string(Move move, char* str);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,231 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#if defined(__AVX2__) || defined(__SSSE3__)
+#include <immintrin.h>
+#endif
+#include "nnue.h"
+#include "bitboard.h"
+#include "board.h"
+
+bool nnue_enabled = false;
+static bool nnue_loaded = false;
+
+#define ALIGNED __attribute__((aligned(32)))
+
+static int16_t feature_bias[NNUE_HIDDEN] ALIGNED;
+static int16_t feature_weights[NNUE_FEATURES * NNUE_HIDDEN] ALIGNED;
+static int32_t hidden_bias[NNUE_L2] ALIGNED;
+static int8_t hidden_weights[NNUE_L2 * 2 * NNUE_HIDDEN] ALIGNED;
+static int32_t output_bias;
+static int8_t output_weights[NNUE_L2] ALIGNED;
+
+// Index of each piece type among the five feature piece types, -1 for empty squares and kings.
+static const int FEATURE_PIECE[7] = {-1, 0, 1, -1, 2, 3, 4};
+
+#define ORIENT(square, side) ((side) == 0 ? (square) : (square) ^ 56)
+
+INLINE int feature(int side, int king, Piece piece, Piece color, int square) {
+    int type = FEATURE_PIECE[piece] * 2 + ((color & 1) != side);
+    return (ORIENT(king, side) * 640 + type * 64 + ORIENT(square, side)) * NNUE_HIDDEN;
+}
+
+bool nnue_load(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) return false;
+
+    char magic[4];
+    uint32_t header[4];
+    bool ok = fread(magic, 1, 4, file) == 4 && memcmp(magic, "NNUE", 4) == 0 &&
+              fread(header, sizeof(uint32_t), 4, file) == 4 &&
+              header[0] == NNUE_VERSION && header[1] == NNUE_FEATURES &&
+              header[2] == NNUE_HIDDEN && header[3] == NNUE_L2;
+
+    ok = ok && fread(feature_bias, sizeof(int16_t), NNUE_HIDDEN, file) == NNUE_HIDDEN;
+    ok = ok && fread(feature_weights, sizeof(int16_t), NNUE_FEATURES * NNUE_HIDDEN, file) == NNUE_FEATURES * NNUE_HIDDEN;
+    ok = ok && fread(hidden_bias, sizeof(int32_t), NNUE_L2, file) == NNUE_L2;
+    ok = ok && fread(hidden_weights, sizeof(int8_t), NNUE_L2 * 2 * NNUE_HIDDEN, file) == NNUE_L2 * 2 * NNUE_HIDDEN;
+    ok = ok && fread(&output_bias, sizeof(int32_t), 1, file) == 1;
+    ok = ok && fread(output_weights, sizeof(int8_t), NNUE_L2, file) == NNUE_L2;
+    fclose(file);
+
+    nnue_loaded = ok;
+    if (!ok) nnue_enabled = false;
+    return ok;
+}
+
+// Boards created while the network was disabled have no accumulators, so they must be passed to
+// nnue_refresh after enabling it.
+bool nnue_enable(bool enable) {
+    nnue_enabled = enable && nnue_loaded;
+    return nnue_enabled == enable;
+}
+
+// Vector kernels for the accumulator updates and the hidden layer. Each handles a multiple of 32
+// bytes, which NNUE_HIDDEN and NNUE_L2 are.
+
+INLINE void vector_add(int16_t* acc, const int16_t* weights) {
+#if defined(__AVX2__)
+    for (int i = 0; i < NNUE_HIDDEN; i += 16) {
+        __m256i sum = _mm256_add_epi16(_mm256_load_si256((__m256i*) &acc[i]), _mm256_load_si256((__m256i*) &weights[i]));
+        _mm256_store_si256((__m256i*) &acc[i], sum);
+    }
+#elif defined(__SSSE3__)
+    for (int i = 0; i < NNUE_HIDDEN; i += 8) {
+        __m128i sum = _mm_add_epi16(_mm_load_si128((__m128i*) &acc[i]), _mm_load_si128((__m128i*) &weights[i]));
+        _mm_store_si128((__m128i*) &acc[i], sum);
+    }
+#else
+    for (int i = 0; i < NNUE_HIDDEN; i++) acc[i] += weights[i];
+#endif
+}
+
+INLINE void vector_sub(int16_t* acc, const int16_t* weights) {
+#if defined(__AVX2__)
+    for (int i = 0; i < NNUE_HIDDEN; i += 16) {
+        __m256i diff = _mm256_sub_epi16(_mm256_load_si256((__m256i*) &acc[i]), _mm256_load_si256((__m256i*) &weights[i]));
+        _mm256_store_si256((__m256i*) &acc[i], diff);
+    }
+#elif defined(__SSSE3__)
+    for (int i = 0; i < NNUE_HIDDEN; i += 8) {
+        __m128i diff = _mm_sub_epi16(_mm_load_si128((__m128i*) &acc[i]), _mm_load_si128((__m128i*) &weights[i]));
+        _mm_store_si128((__m128i*) &acc[i], diff);
+    }
+#else
+    for (int i = 0; i < NNUE_HIDDEN; i++) acc[i] -= weights[i];
+#endif
+}
+
+// Clips the accumulator to [0, 127] and narrows it to bytes.
+INLINE void clip(uint8_t* out, const int16_t* acc) {
+#if defined(__AVX2__)
+    for (int i = 0; i < NNUE_HIDDEN; i += 32) {
+        __m256i a = _mm256_load_si256((__m256i*) &acc[i]);
+        __m256i b = _mm256_load_si256((__m256i*) &acc[i + 16]);
+        // packs works within 128 bit lanes, the permute puts the quarters back in order.
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(a, b), 0xd8);
+        packed = _mm256_max_epi8(packed, _mm256_setzero_si256());
+        _mm256_store_si256((__m256i*) &out[i], packed);
+    }
+#elif defined(__SSSE3__)
+    for (int i = 0; i < NNUE_HIDDEN; i += 16) {
+        __m128i a = _mm_load_si128((__m128i*) &acc[i]);
+        __m128i b = _mm_load_si128((__m128i*) &acc[i + 8]);
+        __m128i packed = _mm_packs_epi16(a, b);
+        // No signed byte max before SSE4.1, so mask off the negative bytes instead.
+        packed = _mm_andnot_si128(_mm_cmplt_epi8(packed, _mm_setzero_si128()), packed);
+        _mm_store_si128((__m128i*) &out[i], packed);
+    }
+#else
+    for (int i = 0; i < NNUE_HIDDEN; i++) {
+        out[i] = acc[i] < 0 ? 0 : acc[i] > 127 ? 127 : acc[i];
+    }
+#endif
+}
+
+INLINE int dot(const uint8_t* inputs, const int8_t* weights) {
+#if defined(__AVX2__)
+    const __m256i ones = _mm256_set1_epi16(1);
+    __m256i sum = _mm256_setzero_si256();
+    for (int i = 0; i < 2 * NNUE_HIDDEN; i += 32) {
+        // Inputs are at most 127, so the pairwise products cannot saturate.
+        __m256i products = _mm256_maddubs_epi16(_mm256_load_si256((__m256i*) &inputs[i]), _mm256_load_si256((__m256i*) &weights[i]));
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(products, ones));
+    }
+    __m128i half = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4e));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xb1));
+    return _mm_cvtsi128_si32(half);
+#elif defined(__SSSE3__)
+    const __m128i ones = _mm_set1_epi16(1);
+    __m128i sum = _mm_setzero_si128();
+    for (int i = 0; i < 2 * NNUE_HIDDEN; i += 16) {
+        __m128i products = _mm_maddubs_epi16(_mm_load_si128((__m128i*) &inputs[i]), _mm_load_si128((__m128i*) &weights[i]));
+        sum = _mm_add_epi32(sum, _mm_madd_epi16(products, ones));
+    }
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4e));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xb1));
+    return _mm_cvtsi128_si32(sum);
+#else
+    int sum = 0;
+    for (int i = 0; i < 2 * NNUE_HIDDEN; i++) sum += inputs[i] * weights[i];
+    return sum;
+#endif
+}
+
+// Recomputes the accumulator of one side from every piece on the board.
+INLINE void refresh_side(Board* board, int side) {
+    Bitboard king = get_pieces(board, KING, side == 0 ? WHITE : BLACK);
+    if (king == 0) return;
+    int king_square = LSB(king);
+
+    int16_t* acc = board->accumulator[side];
+    memcpy(acc, feature_bias, sizeof(feature_bias));
+
+    static const Piece types[5] = {PAWN, KNIGHT, BISHOP, ROOK, QUEEN};
+    for (int t = 0; t < 5; t++) {
+        for (int color = 0; color < 2; color++) {
+            Bitboard pieces = get_pieces(board, types[t], color == 0 ? WHITE : BLACK);
+            while (pieces != 0) {
+                int i = LSB(pieces);
+                pieces &= pieces - 1;
+                vector_add(acc, &feature_weights[feature(side, king_square, types[t], color, i)]);
+            }
+        }
+    }
+    board->nnue_ready |= 1 << side;
+}
+
+void nnue_refresh(Board* board) {
+    refresh_side(board, 0);
+    refresh_side(board, 1);
+}
+
+// The accumulator of a side is only valid while its king is on the board. A king move removes the
+// king first, which invalidates the accumulator, and adding the king back refreshes it.
+void nnue_add_piece(Board* board, Piece piece, Piece color, uint8_t index) {
+    if (piece == KING) {
+        refresh_side(board, color & 1);
+        return;
+    }
+    for (int side = 0; side < 2; side++) {
+        if (board->nnue_ready & (1 << side)) {
+            int king = LSB(get_pieces(board, KING, side == 0 ? WHITE : BLACK));
+            vector_add(board->accumulator[side], &feature_weights[feature(side, king, piece, color, index)]);
+        }
+    }
+}
+
+void nnue_remove_piece(Board* board, Piece piece, Piece color, uint8_t index) {
+    if (piece == KING) {
+        board->nnue_ready &= ~(1 << (color & 1));
+        return;
+    }
+    for (int side = 0; side < 2; side++) {
+        if (board->nnue_ready & (1 << side)) {
+            int king = LSB(get_pieces(board, KING, side == 0 ? WHITE : BLACK));
+            vector_sub(board->accumulator[side], &feature_weights[feature(side, king, piece, color, index)]);
+        }
+    }
+}
+
+// Returns the evaluation from white's point of view, like evaluate.
+int nnue_evaluate(Board* board) {
+    if (board->nnue_ready != 0b11) nnue_refresh(board);
+
+    int us = board->active_color & 1;
+    uint8_t inputs[2 * NNUE_HIDDEN] ALIGNED;
+    clip(inputs, board->accumulator[us]);
+    clip(inputs + NNUE_HIDDEN, board->accumulator[us ^ 1]);
+
+    int output = output_bias;
+    for (int i = 0; i < NNUE_L2; i++) {
+        int hidden = (hidden_bias[i] + dot(inputs, &hidden_weights[i * 2 * NNUE_HIDDEN])) >> NNUE_HIDDEN_SHIFT;
+        hidden = hidden < 0 ? 0 : hidden > 127 ? 127 : hidden;
+        output += hidden * output_weights[i];
+    }
+
+    int score = output / NNUE_OUTPUT_DIVISOR;
+    return us == 0 ? score : -score;
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef NNUE_H_
+#define NNUE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "board.h"
+
+// Efficiently updatable neural network evaluator, used instead of the classical evaluation when
+// weights are loaded and it is enabled.
+//
+// Features are HalfKP: for each side, the position of its own king combined with the type, color and
+// square of every other piece, seen from that side (squares are flipped vertically for black). The
+// first layer sums the weights of the active features into one accumulator per side. Those are
+// kept in the Board and updated by add_piece and remove_piece, so a move only adds and subtracts a
+// few weight rows. Only a king move refreshes the accumulator of its side from scratch.
+//
+// The accumulators of the side to move and the other side are clipped to [0, 127] and go through a
+// hidden layer of NNUE_L2 neurons with int8 weights and a single output neuron.
+//
+// Weights file, little endian:
+//     char magic[4] = "NNUE"
+//     uint32_t version, features, hidden, l2
+//     int16_t feature_bias[hidden]
+//     int16_t feature_weights[features][hidden]
+//     int32_t hidden_bias[l2]
+//     int8_t hidden_weights[l2][2 * hidden]    (side to move first)
+//     int32_t output_bias
+//     int8_t output_weights[l2]
+
+#define NNUE_VERSION 1
+#define NNUE_FEATURES (64 * 10 * 64)
+#define NNUE_L2 32
+
+// Hidden layer sums are shifted right by this many bits before clipping.
+#define NNUE_HIDDEN_SHIFT 6
+// The output neuron is divided by this to get centipawns.
+#define NNUE_OUTPUT_DIVISOR 16
+
+extern bool nnue_enabled;
+
+bool nnue_load(const char* path);
+bool nnue_enable(bool enable);
+
+void nnue_refresh(Board* board);
+void nnue_add_piece(Board* board, Piece piece, Piece color, uint8_t index);
+void nnue_remove_piece(Board* board, Piece piece, Piece color, uint8_t index);
+
+int nnue_evaluate(Board* board);
+
+#endif
\ No newline at end of file
@@ -5,50 +5,59 @@
 #include "board.h"
 #include "move.h"
 
-static const int openings_size;
+int find_openings(uint64_t hash, const Opening** first) {
+    // Binary search for the first entry with the hash.
+    int low = 0, high = openings_size;
+    while (low < high) {
+        int middle = (low + high) / 2;
+        if (openings[middle].hash < hash) low = middle + 1;
+        else high = middle;
+    }
 
-bool select_opening(Board* board, Move* move) {
-    int possible[256]; // Indices of possible openings in "openings" array.
+    int end = low;
+    while (end < openings_size && openings[end].hash == hash) end++;
 
-    uint64_t board_hash = hash(board);
+    *first = &openings[low];
+    return end - low;
+}
 
-    const int possible_size = sizeof(possible) / sizeof(int);
+bool select_opening(Board* board, Move* move) {
+    const Opening* possible;
+    int n_possible = find_openings(hash(board), &possible);
+    if (n_possible == 0) return false;
 
     Move moves[MAX_MOVES];
     int n_moves = gen_moves(board, moves);
 
-    int n_openings = 0;
-    for (int i = 0; i < openings_size && n_openings < possible_size; i++) {
-        const Opening* opening = &openings[i];
-        if (opening->hash == board_hash) {
-            const Move* opening_move = &opening->move;
-            // Check if the given move is valid in case of hash collision.
-            for (int j = 0; j < n_moves; j++) {
-                Move* check = &moves[j];
-                if (check->to == opening_move->to && check->from == opening_move->from && check->flags == opening_move->flags) {
-                    possible[n_openings++] = i;
-                    break;
-                }
+    // Check if the moves are valid in case of hash collision. The moves of a position are distinct,
+    // so at most MAX_MOVES of them are.
+    int valid[MAX_MOVES];
+    int n_valid = 0;
+    int total = 0;
+    for (int i = 0; i < n_possible && n_valid < MAX_MOVES; i++) {
+        for (int j = 0; j < n_moves; j++) {
+            if (moves[j] == possible[i].move) {
+                valid[n_valid++] = i;
+                total += possible[i].count;
+                break;
             }
         }
     }
 
-    if (n_openings == 0) return false;
-
-    int total = 0;
-    for (int i = 0; i < n_openings; i++) {
-        total += (&openings[possible[i]])->count;
-    }
+    if (total == 0) return false;
 
     // Weighted random selection based on the number of times
     // the opening appears in the database.
-    srand(time(NULL));
+    static bool seeded = false;
+    if (!seeded) {
+        srand(time(NULL));
+        seeded = true;
+    }
     int selection = rand() % total;
-    total = 0;
-    for (int i = 0; i < n_openings; i++) {
-        const Opening* opening = &openings[possible[i]];
-        total += opening->count;
-        if (total >= selection) {
+    for (int i = 0; i < n_valid; i++) {
+        const Opening* opening = &possible[valid[i]];
+        selection -= opening->count;
+        if (selection < 0) {
             *move = opening->move;
             return true;
         }
@@ -57,7602 +66,7603 @@ bool select_opening(Board* board, Move* move) {
     return false;
 }
 
+// Sorted by hash and then by count, find_openings relies on the order.
 const Opening openings[] = {
-    {1318184152444028073ULL, 3499, {27, 11, 0x2}},
-    {5072961277340380631ULL, 1687, {35, 51, 0x2}},
-    {8285786309667566735ULL, 1644, {18, 1, 0x0}},
-    {6689260125950577352ULL, 1366, {45, 62, 0x0}},
-    {2977727989287694999ULL, 223, {29, 2, 0x0}},
-    {13569620647532257995ULL, 178, {37, 58, 0x0}},
-    {13034166716182122047ULL, 93, {21, 13, 0x0}},
-    {14212825924053235854ULL, 93, {42, 57, 0x0}},
-    {7454719158710978582ULL, 77, {20, 12, 0x0}},
-    {8422942228386859655ULL, 48, {44, 52, 0x0}},
-    {1318184152444028073ULL, 2955, {28, 12, 0x2}},
-    {18295344350778702024ULL, 1999, {42, 57, 0x0}},
-    {11214941578300297656ULL, 1772, {29, 13, 0x2}},
-    {17986255588715308102ULL, 575, {41, 49, 0x0}},
-    {16481155002993949900ULL, 38, {18, 10, 0x0}},
-    {4429722800411233674ULL, 16, {36, 52, 0x2}},
-    {574542390866506722ULL, 16, {36, 29, 0x1}},
-    {7498740239830171489ULL, 16, {36, 42, 0x1}},
-    {17019730063059733190ULL, 16, {27, 11, 0x2}},
-    {18233074494206562603ULL, 16, {46, 36, 0x0}},
-    {1318184152444028073ULL, 540, {29, 13, 0x2}},
-    {14764886521043386317ULL, 83, {43, 51, 0x0}},
-    {10257129069726795371ULL, 47, {21, 6, 0x0}},
-    {6102227344327626433ULL, 37, {36, 52, 0x2}},
-    {4800344975375356952ULL, 36, {28, 12, 0x2}},
-    {188692947242122750ULL, 20, {42, 57, 0x0}},
-    {16737318500190807828ULL, 24, {36, 29, 0x1}},
-    {8704901504534309549ULL, 28, {36, 43, 0x1}},
-    {12413195510696745595ULL, 29, {33, 5, 0x0}},
-    {1542558454087408499ULL, 20, {45, 53, 0x0}},
-    {5072961277340380631ULL, 214, {43, 51, 0x0}},
-    {13792971579311590148ULL, 202, {28, 12, 0x2}},
-    {2674412997242402908ULL, 202, {36, 52, 0x2}},
-    {3690195118672909497ULL, 59, {12, 6, 0x0}},
-    {15301545555950680705ULL, 28, {37, 53, 0x2}},
-    {4762473953496873755ULL, 13, {18, 1, 0x0}},
-    {7817461587773872977ULL, 10, {28, 37, 0x1}},
-    {2134500069948893010ULL, 7, {28, 18, 0x1}},
-    {2346112283035786720ULL, 4, {42, 57, 0x0}},
-    {2977727989287694999ULL, 1021, {38, 2, 0x0}},
-    {4286387923052900783ULL, 329, {42, 57, 0x0}},
-    {18302720294942730011ULL, 128, {20, 12, 0x0}},
-    {15244418029398614846ULL, 112, {37, 58, 0x0}},
-    {11092478349946713888ULL, 48, {45, 38, 0x1}},
-    {17979848928863056438ULL, 48, {45, 52, 0x1}},
-    {14764886521043386317ULL, 148, {35, 51, 0x2}},
-    {16269969763765474400ULL, 82, {21, 6, 0x0}},
-    {2170996588730705085ULL, 52, {42, 57, 0x0}},
-    {14417823256763608663ULL, 47, {18, 1, 0x0}},
-    {17900901150637285192ULL, 94, {45, 62, 0x0}},
-    {4090227221675244617ULL, 72, {17, 9, 0x0}},
-    {53917537757537769ULL, 16, {30, 58, 0x0}},
-    {1680310096665698135ULL, 5, {36, 21, 0x0}},
-    {887255215022334696ULL, 2, {37, 30, 0x0}},
-    {17986255588715308102ULL, 1153, {43, 51, 0x0}},
-    {2089109217373219756ULL, 714, {18, 1, 0x0}},
-    {2093600658088600321ULL, 417, {36, 52, 0x2}},
-    {5938379997229303409ULL, 325, {21, 6, 0x0}},
-    {8188711911683670460ULL, 32, {37, 53, 0x2}},
-    {2812344339552456972ULL, 28, {36, 29, 0x1}},
-    {2704646598920888075ULL, 23, {36, 42, 0x1}},
-    {4429722800411233674ULL, 3, {44, 52, 0x0}},
-    {687394209600746243ULL, 2, {27, 11, 0x2}},
-    {4987700965284032707ULL, 1, {49, 58, 0x0}},
-    {15601617251738118311ULL, 2, {11, 1, 0x0}},
-    {5931596520312635387ULL, 2, {57, 59, 0x40}},
-    {4286387923052900783ULL, 660, {47, 55, 0x0}},
-    {13816452686897890834ULL, 635, {31, 38, 0x0}},
-    {16576340125263318608ULL, 612, {42, 57, 0x0}},
-    {13521105088988198766ULL, 566, {1, 3, 0x40}},
-    {10638464564107361517ULL, 429, {51, 58, 0x0}},
-    {2089109217373219756ULL, 307, {21, 6, 0x0}},
-    {16228966911907385688ULL, 286, {30, 58, 0x0}},
-    {1149462635247451623ULL, 106, {13, 4, 0x0}},
-    {14500376946479100129ULL, 61, {57, 59, 0x40}},
-    {15340939793667601002ULL, 1, {33, 5, 0x0}},
-    {8817193211456690718ULL, 1, {37, 53, 0x2}},
-    {5072961277340380631ULL, 18, {41, 49, 0x0}},
-    {13932234736183596501ULL, 18, {28, 12, 0x2}},
-    {1317269159200877694ULL, 16, {49, 58, 0x0}},
-    {14886941955474873389ULL, 13, {21, 6, 0x0}},
-    {3888513160075342839ULL, 9, {44, 52, 0x0}},
-    {2502997548444194087ULL, 10, {19, 5, 0x0}},
-    {15785635894244981277ULL, 6, {47, 55, 0x0}},
-    {5979050373511178273ULL, 3, {31, 15, 0x2}},
-    {4491897023529820590ULL, 2, {42, 57, 0x0}},
-    {18302720294942730011ULL, 196, {1, 3, 0x40}},
-    {5449587215307019566ULL, 192, {27, 42, 0x1}},
-    {8210569864270191849ULL, 137, {28, 12, 0x2}},
-    {12937686490474628778ULL, 136, {44, 27, 0x0}},
-    {14764886521043386317ULL, 76, {37, 53, 0x2}},
-    {18241325219517442881ULL, 13, {17, 9, 0x0}},
-    {18013332567305626445ULL, 3, {45, 62, 0x0}},
-    {428678263658520080ULL, 3, {9, 2, 0x0}},
-    {7070369653830339942ULL, 3, {41, 49, 0x0}},
-    {9565771135229060886ULL, 1, {18, 1, 0x0}},
-    {16708243329712653353ULL, 3, {49, 58, 0x0}},
-    {7657735767223613411ULL, 2, {1, 3, 0x40}},
-    {7018414241491437706ULL, 1, {44, 52, 0x0}},
-    {18295344350778702024ULL, 797, {36, 52, 0x2}},
-    {12385723303618198603ULL, 721, {29, 13, 0x2}},
-    {1901106070116560627ULL, 521, {45, 53, 0x0}},
-    {7027421162547560469ULL, 342, {18, 1, 0x0}},
-    {10611652356716532963ULL, 346, {42, 57, 0x0}},
-    {13469448620684297881ULL, 9, {22, 4, 0x0}},
-    {166791874754328764ULL, 6, {29, 36, 0x1}},
-    {11667757937158994662ULL, 6, {29, 22, 0x1}},
-    {3224743661667501963ULL, 5, {25, 61, 0x0}},
-    {18295344350778702024ULL, 30, {34, 50, 0x2}},
-    {8001711469908866168ULL, 18, {17, 9, 0x0}},
-    {15372786037618742241ULL, 18, {42, 57, 0x0}},
-    {1406378603153108222ULL, 18, {9, 2, 0x0}},
-    {4610926162051661550ULL, 2, {43, 51, 0x0}},
-    {18251266537852898417ULL, 2, {29, 13, 0x2}},
-    {450160377695859491ULL, 2, {45, 53, 0x0}},
-    {17236358238867494427ULL, 3, {18, 1, 0x0}},
-    {7735114798968513524ULL, 3, {36, 52, 0x2}},
-    {8188711911683670460ULL, 111, {30, 58, 0x0}},
-    {14912508655231223447ULL, 12, {31, 4, 0x0}},
-    {6094161083065346371ULL, 15, {45, 62, 0x0}},
-    {14764886521043386317ULL, 146, {42, 57, 0x0}},
-    {11471909942384048753ULL, 16, {17, 9, 0x0}},
-    {6803142323179306268ULL, 4, {41, 49, 0x0}},
-    {4220306397011959743ULL, 4, {9, 2, 0x0}},
-    {8102900898980577380ULL, 1, {37, 53, 0x2}},
-    {3523090201300521019ULL, 1, {21, 6, 0x0}},
-    {9559182597749349740ULL, 1, {49, 58, 0x0}},
-    {7367330988849436548ULL, 1, {18, 1, 0x0}},
-    {11644183791189424220ULL, 2, {57, 59, 0x40}},
-    {6102227344327626433ULL, 2, {42, 57, 0x0}},
-    {15670840758972587419ULL, 5, {18, 1, 0x0}},
-    {2775107915265966558ULL, 29, {36, 52, 0x2}},
-    {8957568966247469475ULL, 26, {28, 12, 0x2}},
-    {11208045346968085271ULL, 6, {30, 58, 0x0}},
-    {14912508655231223447ULL, 41, {36, 29, 0x1}},
-    {8826506160819367355ULL, 46, {36, 43, 0x1}},
-    {1680310096665698135ULL, 11, {9, 2, 0x0}},
-    {4967810136213311215ULL, 10, {57, 59, 0x40}},
-    {2093600658088600321ULL, 35, {30, 58, 0x0}},
-    {4853624536339282574ULL, 18, {12, 6, 0x0}},
-    {7959766696922578202ULL, 5, {46, 54, 0x0}},
-    {9263271353037574102ULL, 1, {17, 9, 0x0}},
-    {155359140753283504ULL, 3, {54, 61, 0x0}},
-    {5938379997229303409ULL, 85, {17, 9, 0x0}},
-    {5120058751335183637ULL, 55, {51, 58, 0x0}},
-    {3109977063751214413ULL, 63, {9, 2, 0x0}},
-    {14801080014453631598ULL, 106, {57, 59, 0x40}},
-    {11214941578300297656ULL, 164, {18, 1, 0x0}},
-    {13004833892763861492ULL, 61, {41, 49, 0x0}},
-    {12886379800431348820ULL, 15, {33, 5, 0x0}},
-    {10446376483992331032ULL, 15, {49, 58, 0x0}},
-    {16974726260933053736ULL, 9, {12, 6, 0x0}},
-    {6991759869702880635ULL, 5, {57, 59, 0x40}},
-    {16413674698006998565ULL, 2, {19, 11, 0x0}},
-    {2821523153251970917ULL, 2, {44, 52, 0x0}},
-    {2977727989287694999ULL, 44, {21, 6, 0x0}},
-    {5318238419023606241ULL, 44, {42, 57, 0x0}},
-    {3829185419407060211ULL, 16, {28, 12, 0x2}},
-    {6385102848399624523ULL, 15, {28, 35, 0x1}},
-    {16419208563653743463ULL, 15, {28, 18, 0x1}},
-    {14563831968270906750ULL, 18, {30, 58, 0x0}},
-    {1318184152444028073ULL, 709, {18, 1, 0x0}},
-    {6841954008926061468ULL, 319, {42, 57, 0x0}},
-    {9169622694104440521ULL, 239, {29, 13, 0x2}},
-    {6665738033459067864ULL, 77, {41, 49, 0x0}},
-    {8163029570126985157ULL, 12, {17, 9, 0x0}},
-    {15922057144552798951ULL, 11, {49, 58, 0x0}},
-    {3055345220471439193ULL, 12, {9, 2, 0x0}},
-    {4792450617328695419ULL, 6, {57, 59, 0x40}},
-    {177579987036537401ULL, 4, {1, 3, 0x40}},
-    {4853601819725163340ULL, 1, {37, 53, 0x2}},
-    {9263271353037574102ULL, 3, {23, 15, 0x0}},
-    {3326158652882032720ULL, 3, {12, 30, 0x1}},
-    {18302720294942730011ULL, 3, {21, 6, 0x0}},
-    {16286724957976613671ULL, 13, {30, 58, 0x0}},
-    {6399184565892408140ULL, 12, {1, 3, 0x40}},
-    {12527706986486010701ULL, 12, {57, 59, 0x40}},
-    {9263271353037574102ULL, 1, {19, 11, 0x0}},
-    {9488121084213675024ULL, 1, {54, 61, 0x0}},
-    {8210569864270191849ULL, 55, {3, 2, 0x0}},
-    {17851436344735038153ULL, 55, {44, 27, 0x0}},
-    {13469448620684297881ULL, 125, {19, 11, 0x0}},
-    {4481191155974191812ULL, 49, {34, 61, 0x0}},
-    {13162821910944742601ULL, 49, {21, 6, 0x0}},
-    {8281950019485970242ULL, 46, {43, 51, 0x0}},
-    {16481155002993949900ULL, 38, {18, 1, 0x0}},
-    {18332203148590987961ULL, 38, {49, 58, 0x0}},
-    {4214986889140312976ULL, 9, {19, 11, 0x0}},
-    {14600436452788189562ULL, 9, {57, 59, 0x40}},
-    {5173219973096022835ULL, 10, {11, 2, 0x0}},
-    {16083454359407930157ULL, 7, {44, 52, 0x0}},
-    {6665738033459067864ULL, 71, {43, 51, 0x0}},
-    {14878020546722721943ULL, 37, {21, 6, 0x0}},
-    {8957568966247469475ULL, 3, {19, 11, 0x0}},
-    {5704785486228255402ULL, 2, {44, 58, 0x0}},
-    {354149070471230713ULL, 2, {22, 14, 0x0}},
-    {661377698293930152ULL, 2, {57, 59, 0x40}},
-    {16974726260933053736ULL, 6, {21, 13, 0x0}},
-    {4521472673423428096ULL, 1, {40, 48, 0x0}},
-    {9725560077456088598ULL, 1, {24, 33, 0x0}},
-    {14478323156919206081ULL, 1, {44, 52, 0x0}},
-    {11471909942384048753ULL, 105, {21, 6, 0x0}},
-    {6279419389070596696ULL, 8, {41, 49, 0x0}},
-    {14517200146087942421ULL, 4, {27, 11, 0x2}},
-    {2191999413442801878ULL, 4, {44, 52, 0x0}},
-    {14596593045753694941ULL, 4, {28, 12, 0x2}},
-    {9519051506726767542ULL, 4, {49, 58, 0x0}},
-    {6210545000529033810ULL, 5, {11, 1, 0x0}},
-    {18229112317190813776ULL, 5, {57, 59, 0x40}},
-    {3690195118672909497ULL, 130, {21, 6, 0x0}},
-    {14711377200923721030ULL, 71, {42, 57, 0x0}},
-    {8581667194222942950ULL, 45, {35, 27, 0x0}},
-    {1943139704514941389ULL, 45, {52, 42, 0x0}},
-    {18199251077287288567ULL, 42, {26, 10, 0x2}},
-    {5934393962861427507ULL, 42, {37, 53, 0x2}},
-    {3690195118672909497ULL, 14, {35, 27, 0x0}},
-    {16231115769579433772ULL, 14, {37, 53, 0x2}},
-    {4108408489730703649ULL, 14, {21, 13, 0x0}},
-    {14202440315533356840ULL, 13, {45, 62, 0x0}},
-    {10653774156151461578ULL, 13, {18, 1, 0x0}},
-    {5323941034666326580ULL, 7, {46, 60, 0x0}},
-    {8285786309667566735ULL, 26, {29, 2, 0x0}},
-    {12179545257381228895ULL, 25, {42, 57, 0x0}},
-    {3715327064442691319ULL, 22, {20, 12, 0x0}},
-    {9185097134366520292ULL, 14, {45, 53, 0x0}},
-    {15265224815114118988ULL, 1, {11, 4, 0x0}},
-    {8561402197627218569ULL, 1, {51, 58, 0x0}},
-    {14438512631938665073ULL, 1, {18, 1, 0x0}},
-    {17674561234970890517ULL, 1, {44, 52, 0x0}},
-    {5072961277340380631ULL, 1232, {37, 53, 0x2}},
-    {17188657718858330447ULL, 1126, {18, 1, 0x0}},
-    {10331459553381165467ULL, 223, {43, 51, 0x0}},
-    {1017817944632322248ULL, 189, {28, 12, 0x2}},
-    {15675038834182613124ULL, 189, {28, 37, 0x1}},
-    {15254863164974906563ULL, 189, {28, 18, 0x1}},
-    {591964673182378060ULL, 113, {45, 62, 0x0}},
-    {4687596134951815932ULL, 115, {21, 6, 0x0}},
-    {2082559453057686086ULL, 64, {53, 60, 0x0}},
-    {16481155002993949900ULL, 437, {21, 6, 0x0}},
-    {1038801348951046746ULL, 169, {49, 58, 0x0}},
-    {7949953625194153246ULL, 153, {27, 11, 0x2}},
-    {4442527735552920965ULL, 146, {44, 52, 0x0}},
-    {6210545000529033810ULL, 88, {18, 1, 0x0}},
-    {11688404403997700044ULL, 90, {57, 59, 0x40}},
-    {11092478349946713888ULL, 37, {21, 13, 0x0}},
-    {9795222854442232821ULL, 28, {57, 59, 0x40}},
-    {13816452686897890834ULL, 25, {45, 38, 0x1}},
-    {5056650811953932498ULL, 25, {45, 52, 0x1}},
-    {2030037965993528977ULL, 25, {1, 3, 0x40}},
-    {6747563481170891826ULL, 7, {42, 60, 0x0}},
-    {6841954008926061468ULL, 90, {37, 53, 0x2}},
-    {9176897335069304700ULL, 61, {29, 13, 0x2}},
-    {1510908925626784060ULL, 25, {42, 57, 0x0}},
-    {2797284083970668928ULL, 10, {17, 9, 0x0}},
-    {14859532205576770013ULL, 2, {41, 49, 0x0}},
-    {1704289629100926163ULL, 2, {22, 14, 0x0}},
-    {17698282400848229718ULL, 2, {49, 58, 0x0}},
-    {1900768854942377416ULL, 2, {14, 5, 0x0}},
-    {5614207512099928577ULL, 4, {46, 54, 0x0}},
-    {13521105088988198766ULL, 34, {20, 12, 0x0}},
-    {4804627023261683682ULL, 6, {37, 58, 0x0}},
-    {15244418029398614846ULL, 16, {44, 52, 0x0}},
-    {2242200468607670578ULL, 13, {1, 3, 0x40}},
-    {9411031113065290682ULL, 7, {52, 61, 0x0}},
-    {5072961277340380631ULL, 244, {45, 53, 0x0}},
-    {17324407511141808068ULL, 220, {28, 12, 0x2}},
-    {5327852733952340572ULL, 220, {36, 52, 0x2}},
-    {3279538519127023954ULL, 113, {35, 27, 0x0}},
-    {926701955664750813ULL, 22, {37, 45, 0x0}},
-    {16715324912760771006ULL, 15, {37, 28, 0x1}},
-    {7891106867928632660ULL, 12, {43, 51, 0x0}},
-    {4407573588513695826ULL, 7, {18, 1, 0x0}},
-    {1102326585621353541ULL, 7, {37, 58, 0x1}},
-    {10257129069726795371ULL, 16, {17, 9, 0x0}},
-    {13003266174063986401ULL, 3, {42, 57, 0x0}},
-    {3343172008136264873ULL, 9, {9, 2, 0x0}},
-    {17669415395245569191ULL, 9, {36, 52, 0x2}},
-    {16751514426814786804ULL, 7, {18, 1, 0x0}},
-    {7973501314323608374ULL, 20, {51, 58, 0x0}},
-    {500301882652361302ULL, 18, {1, 3, 0x40}},
-    {5393528153754143595ULL, 18, {57, 59, 0x40}},
-    {2089109217373219756ULL, 156, {17, 9, 0x0}},
-    {3340141460419567022ULL, 36, {30, 58, 0x0}},
-    {10043568051984666171ULL, 27, {12, 5, 0x0}},
-    {15212621752507211582ULL, 8, {12, 30, 0x1}},
-    {3081624932332351129ULL, 8, {12, 4, 0x1}},
-    {16522509712876901003ULL, 8, {36, 52, 0x2}},
-    {1510908925626784060ULL, 34, {45, 62, 0x0}},
-    {12767304288290706910ULL, 33, {21, 6, 0x0}},
-    {6045171391468466416ULL, 16, {35, 51, 0x2}},
-    {7796621468328471473ULL, 11, {19, 11, 0x0}},
-    {11154749178147782672ULL, 10, {42, 57, 0x0}},
-    {13346865458864431589ULL, 8, {28, 12, 0x2}},
-    {3290796852604307161ULL, 6, {27, 35, 0x0}},
-    {926701955664750813ULL, 91, {34, 61, 0x0}},
-    {6336426424493360561ULL, 13, {12, 6, 0x0}},
-    {11284108459412079929ULL, 13, {43, 51, 0x0}},
-    {7777793937139534802ULL, 12, {22, 12, 0x0}},
-    {13662260861317265669ULL, 9, {52, 62, 0x0}},
-    {10257129069726795371ULL, 16, {18, 1, 0x0}},
-    {15419048708294904890ULL, 13, {36, 52, 0x2}},
-    {3818204582793849347ULL, 7, {19, 11, 0x0}},
-    {14497967459763721915ULL, 7, {42, 57, 0x0}},
-    {6098913703770649056ULL, 8, {22, 14, 0x0}},
-    {13211197149147348207ULL, 3, {51, 58, 0x0}},
-    {17170762129768520253ULL, 4, {14, 5, 0x0}},
-    {10172808026173050809ULL, 5, {57, 59, 0x40}},
-    {5120058751335183637ULL, 58, {30, 58, 0x0}},
-    {11702902790697243436ULL, 58, {12, 5, 0x0}},
-    {4612158134553866464ULL, 51, {51, 30, 0x0}},
-    {6689260125950577352ULL, 272, {42, 57, 0x0}},
-    {14872605389211903863ULL, 223, {35, 18, 0x1}},
-    {14068689509844757436ULL, 223, {44, 52, 0x0}},
-    {3849912855756839599ULL, 217, {18, 35, 0x0}},
-    {12800229300540056417ULL, 217, {27, 42, 0x1}},
-    {17192387111477417047ULL, 83, {21, 6, 0x0}},
-    {990476394463937226ULL, 80, {21, 27, 0x1}},
-    {16481155002993949900ULL, 65, {17, 9, 0x0}},
-    {3020983148694912262ULL, 32, {45, 53, 0x0}},
-    {10545336015550013711ULL, 23, {9, 2, 0x0}},
-    {3751359726665911200ULL, 23, {36, 52, 0x2}},
-    {4831661732843981970ULL, 7, {31, 4, 0x0}},
-    {6005901262839606125ULL, 3, {49, 58, 0x0}},
-    {1901106070116560627ULL, 141, {43, 51, 0x0}},
-    {9969281635438771999ULL, 59, {18, 1, 0x0}},
-    {17289678316442885910ULL, 2, {29, 36, 0x1}},
-    {11100349786942314973ULL, 7, {19, 11, 0x0}},
-    {8862819093315379337ULL, 1, {38, 54, 0x2}},
-    {15108070161034984777ULL, 1, {31, 15, 0x2}},
-    {17983520388877863366ULL, 1, {30, 38, 0x0}},
-    {6279419389070596696ULL, 21, {43, 51, 0x0}},
-    {15670840758972587419ULL, 15, {27, 11, 0x2}},
-    {8522667962060215183ULL, 13, {36, 52, 0x2}},
-    {5352034229397960676ULL, 6, {36, 29, 0x1}},
-    {17004333105976284212ULL, 6, {36, 43, 0x1}},
-    {9804118428399689026ULL, 6, {35, 27, 0x0}},
-    {15794563882661026932ULL, 6, {27, 42, 0x0}},
-    {14711377200923721030ULL, 22, {27, 36, 0x1}},
-    {9671896366334917969ULL, 22, {27, 21, 0x1}},
-    {12545354567470915424ULL, 23, {52, 62, 0x0}},
-    {6499654851304846777ULL, 7, {17, 9, 0x0}},
-    {11050227760932339762ULL, 5, {51, 58, 0x0}},
-    {14764886521043386317ULL, 44, {45, 53, 0x0}},
-    {2301175346920265746ULL, 1, {17, 9, 0x0}},
-    {13373322070656627055ULL, 1, {36, 52, 0x2}},
-    {5884204378543251602ULL, 1, {18, 1, 0x0}},
-    {10231223605290625048ULL, 2, {42, 57, 0x0}},
-    {15990847974206992062ULL, 2, {9, 2, 0x0}},
-    {12446057105285763466ULL, 3, {29, 36, 0x1}},
-    {1026621960966324240ULL, 5, {1, 3, 0x40}},
-    {8248464237858819965ULL, 4, {52, 62, 0x0}},
-    {10331459553381165467ULL, 582, {44, 52, 0x0}},
-    {2859227840215654479ULL, 496, {28, 12, 0x2}},
-    {5943300442968134893ULL, 491, {28, 37, 0x1}},
-    {16890211989583392808ULL, 483, {28, 18, 0x1}},
-    {17412844422434330551ULL, 483, {42, 57, 0x0}},
-    {16972310216973429816ULL, 479, {21, 6, 0x0}},
-    {3957430868384523950ULL, 411, {47, 55, 0x0}},
-    {4804627023261683682ULL, 14, {38, 54, 0x2}},
-    {17289678316442885910ULL, 39, {42, 57, 0x0}},
-    {6742497247546110933ULL, 41, {17, 9, 0x0}},
-    {7454719158710978582ULL, 15, {28, 12, 0x2}},
-    {13843369711056426321ULL, 15, {28, 35, 0x1}},
-    {2797284083970668928ULL, 30, {21, 6, 0x0}},
-    {3037644815974198949ULL, 32, {36, 52, 0x2}},
-    {12767371061115616523ULL, 32, {36, 29, 0x1}},
-    {1488156328378533661ULL, 32, {36, 42, 0x1}},
-    {3945733029276424557ULL, 19, {19, 11, 0x0}},
-    {8062892291652416076ULL, 12, {21, 36, 0x1}},
-    {6841954008926061468ULL, 263, {36, 52, 0x2}},
-    {4220449201395613495ULL, 97, {17, 9, 0x0}},
-    {6720658469582997910ULL, 33, {42, 57, 0x0}},
-    {2762207527424417380ULL, 33, {9, 2, 0x0}},
-    {2931941168010677267ULL, 29, {43, 51, 0x0}},
-    {1942747963897999773ULL, 27, {1, 3, 0x40}},
-    {2413318848762180534ULL, 28, {51, 58, 0x0}},
-    {17941578739202831579ULL, 5, {28, 12, 0x2}},
-    {3437205817293449776ULL, 2, {38, 54, 0x2}},
-    {3957430868384523950ULL, 22, {45, 62, 0x0}},
-    {14872605389211903863ULL, 41, {28, 12, 0x2}},
-    {3010295623396451285ULL, 41, {27, 42, 0x1}},
-    {2082746201644327278ULL, 11, {35, 28, 0x1}},
-    {6121481513974814369ULL, 9, {36, 52, 0x2}},
-    {8927232463280915272ULL, 9, {12, 6, 0x0}},
-    {819755709118438304ULL, 1, {52, 60, 0x0}},
-    {14912508655231223447ULL, 56, {33, 5, 0x0}},
-    {1728904685062386737ULL, 7, {29, 36, 0x1}},
-    {17986255588715308102ULL, 34, {37, 53, 0x2}},
-    {394886718395218886ULL, 33, {36, 28, 0x0}},
-    {97357755900603218ULL, 7, {41, 49, 0x0}},
-    {11645006896589516280ULL, 7, {21, 6, 0x0}},
-    {15307975612095806053ULL, 3, {44, 52, 0x0}},
-    {17690575525356375328ULL, 3, {27, 11, 0x2}},
-    {3309964279440569268ULL, 3, {49, 58, 0x0}},
-    {10331459553381165467ULL, 296, {45, 62, 0x0}},
-    {16086452201153868928ULL, 149, {28, 12, 0x2}},
-    {17673254940818477226ULL, 149, {28, 37, 0x1}},
-    {5524180836157283416ULL, 148, {28, 18, 0x1}},
-    {14079786836315397439ULL, 103, {42, 57, 0x0}},
-    {7276851524171976983ULL, 103, {21, 6, 0x0}},
-    {2843498529103349471ULL, 89, {35, 51, 0x2}},
-    {6336426424493360561ULL, 58, {18, 1, 0x0}},
-    {2007182963251330080ULL, 58, {43, 51, 0x0}},
-    {15712428185523199541ULL, 56, {11, 2, 0x0}},
-    {8166857017631394197ULL, 22, {37, 45, 0x0}},
-    {4220449201395613495ULL, 108, {28, 12, 0x2}},
-    {15703377938568828405ULL, 4, {43, 51, 0x0}},
-    {10779614103892708249ULL, 1, {17, 9, 0x0}},
-    {9654280728768681035ULL, 1, {38, 54, 0x2}},
-    {17358220433928412790ULL, 1, {9, 2, 0x0}},
-    {4784794009544478618ULL, 1, {42, 57, 0x0}},
-    {7907110843853411900ULL, 1, {1, 3, 0x40}},
-    {15612465643840114443ULL, 1, {54, 61, 0x0}},
-    {10638464564107361517ULL, 16, {37, 58, 0x0}},
-    {17188657718858330447ULL, 53, {21, 6, 0x0}},
-    {9279904601962351389ULL, 21, {44, 52, 0x0}},
-    {7030747919821981677ULL, 4, {28, 12, 0x2}},
-    {18022891502337549559ULL, 4, {28, 37, 0x1}},
-    {3087532017135673061ULL, 4, {28, 4, 0x1}},
-    {15934472863346101857ULL, 4, {45, 62, 0x0}},
-    {15108273603392009846ULL, 3, {12, 28, 0x0}},
-    {11966111657242112441ULL, 2, {42, 57, 0x0}},
-    {2859227840215654479ULL, 79, {38, 2, 0x0}},
-    {749254599134020196ULL, 25, {52, 61, 0x0}},
-    {972090875215448539ULL, 23, {52, 38, 0x1}},
-    {16958530572748384779ULL, 4, {52, 62, 0x1}},
-    {14099342430382020470ULL, 4, {1, 3, 0x40}},
-    {12970923876143208755ULL, 4, {42, 57, 0x0}},
-    {16269969763765474400ULL, 58, {17, 9, 0x0}},
-    {14722752504102510990ULL, 42, {42, 57, 0x0}},
-    {11693809640101141234ULL, 4, {21, 6, 0x0}},
-    {12927324252494665270ULL, 11, {30, 58, 0x0}},
-    {12438349538819842921ULL, 2, {27, 11, 0x2}},
-    {15219476474486520450ULL, 2, {21, 30, 0x1}},
-    {14083272988971352998ULL, 2, {21, 12, 0x1}},
-    {14499287725172837034ULL, 2, {44, 52, 0x0}},
-    {4853624536339282574ULL, 20, {12, 5, 0x0}},
-    {14162427766673015610ULL, 6, {51, 60, 0x0}},
-    {4150445350212146872ULL, 6, {17, 9, 0x0}},
-    {17569587732497452335ULL, 5, {45, 62, 0x0}},
-    {9279904601962351389ULL, 7, {47, 55, 0x0}},
-    {15123715279150201890ULL, 4, {11, 1, 0x0}},
-    {12209062772473466690ULL, 4, {44, 52, 0x0}},
-    {4799157966916021975ULL, 1, {31, 15, 0x2}},
-    {8786119498380586920ULL, 1, {42, 57, 0x0}},
-    {11056931898895136148ULL, 1, {17, 9, 0x0}},
-    {17260343367499928723ULL, 1, {45, 62, 0x0}},
-    {17324407511141808068ULL, 10, {21, 6, 0x0}},
-    {18005960373333159012ULL, 10, {36, 52, 0x2}},
-    {4758988849336851150ULL, 9, {18, 1, 0x0}},
-    {5426689571434376504ULL, 6, {25, 61, 0x0}},
-    {3725861170738813190ULL, 4, {16, 8, 0x0}},
-    {6159264229901429919ULL, 4, {18, 25, 0x1}},
-    {16632410792882256146ULL, 4, {18, 4, 0x1}},
-    {1464030157970685512ULL, 3, {43, 51, 0x0}},
-    {1038801348951046746ULL, 268, {36, 52, 0x2}},
-    {2735451798568382007ULL, 88, {18, 1, 0x0}},
-    {11070070598919302487ULL, 88, {49, 58, 0x0}},
-    {14066936134873869619ULL, 1, {16, 8, 0x0}},
-    {4989403225331577077ULL, 1, {29, 36, 0x1}},
-    {887255215022334696ULL, 1, {39, 55, 0x2}},
-    {13569620647532257995ULL, 46, {42, 57, 0x0}},
-    {5466096304987133231ULL, 37, {20, 12, 0x0}},
-    {6093801372723278857ULL, 7, {40, 48, 0x0}},
-    {15897976919747503107ULL, 4, {1, 3, 0x40}},
-    {13466262426645202598ULL, 4, {44, 52, 0x0}},
-    {18295344350778702024ULL, 65, {43, 51, 0x0}},
-    {16764546303442426248ULL, 47, {29, 13, 0x2}},
-    {12213484500741002131ULL, 18, {42, 57, 0x0}},
-    {8188711911683670460ULL, 45, {29, 36, 0x1}},
-    {12497160100107022887ULL, 38, {27, 11, 0x2}},
-    {6033719119731001948ULL, 4, {38, 54, 0x2}},
-    {3829185419407060211ULL, 34, {38, 2, 0x0}},
-    {16286724957976613671ULL, 16, {28, 45, 0x0}},
-    {15398269115123770354ULL, 9, {29, 38, 0x0}},
-    {1606170700876046612ULL, 6, {37, 58, 0x0}},
-    {15398269115123770354ULL, 5, {31, 38, 0x0}},
-    {17942696889218479070ULL, 3, {45, 53, 0x0}},
-    {9169622694104440521ULL, 66, {17, 9, 0x0}},
-    {7167454292758700144ULL, 16, {41, 49, 0x0}},
-    {16076012578906554498ULL, 9, {9, 2, 0x0}},
-    {9495592592238646496ULL, 9, {49, 58, 0x0}},
-    {14102430483509011100ULL, 7, {1, 3, 0x40}},
-    {907646101892257178ULL, 7, {57, 59, 0x40}},
-    {12537249603252538281ULL, 4, {28, 12, 0x2}},
-    {12528487787489454684ULL, 3, {44, 52, 0x0}},
-    {4799157966916021975ULL, 5, {17, 9, 0x0}},
-    {9031485652680936441ULL, 2, {42, 57, 0x0}},
-    {3812764770462522928ULL, 2, {9, 2, 0x0}},
-    {8073873576878319402ULL, 2, {45, 62, 0x0}},
-    {2093600658088600321ULL, 231, {46, 54, 0x0}},
-    {9829105923230151897ULL, 200, {17, 9, 0x0}},
-    {15128617958922077397ULL, 13, {30, 58, 0x0}},
-    {18024949223581808694ULL, 2, {12, 6, 0x0}},
-    {6033719119731001948ULL, 34, {30, 58, 0x0}},
-    {6499654851304846777ULL, 15, {18, 1, 0x0}},
-    {13772048944206015654ULL, 15, {42, 57, 0x0}},
-    {3340141460419567022ULL, 98, {36, 52, 0x2}},
-    {7484879384508194744ULL, 67, {9, 2, 0x0}},
-    {2870234735003405743ULL, 10, {30, 58, 0x0}},
-    {6816235727209850492ULL, 4, {12, 6, 0x0}},
-    {3097742310711099765ULL, 5, {57, 59, 0x40}},
-    {5938379997229303409ULL, 15, {33, 5, 0x0}},
-    {8100970276233269951ULL, 2, {52, 62, 0x0}},
-    {17352001458879994114ULL, 2, {19, 11, 0x0}},
-    {18339136762031753310ULL, 2, {40, 48, 0x0}},
-    {16086452201153868928ULL, 102, {38, 2, 0x0}},
-    {840766407050404543ULL, 56, {41, 49, 0x0}},
-    {17136210561104122632ULL, 38, {45, 38, 0x1}},
-    {17812174044496671167ULL, 22, {45, 52, 0x1}},
-    {7961381793481255136ULL, 20, {20, 12, 0x0}},
-    {2427767664370733664ULL, 19, {49, 58, 0x0}},
-    {16086452201153868928ULL, 42, {21, 6, 0x0}},
-    {12749293669328252047ULL, 14, {35, 51, 0x2}},
-    {8733794996227375186ULL, 14, {29, 2, 0x0}},
-    {7774923372170535490ULL, 9, {51, 58, 0x0}},
-    {15675546052372158039ULL, 9, {20, 12, 0x0}},
-    {5511004320492376252ULL, 4, {44, 52, 0x0}},
-    {17188657718858330447ULL, 34, {21, 13, 0x0}},
-    {6627323009912906888ULL, 19, {42, 57, 0x0}},
-    {2538729223371410991ULL, 19, {35, 27, 0x0}},
-    {13506578415349676552ULL, 19, {36, 42, 0x0}},
-    {12031766022652374246ULL, 15, {18, 1, 0x0}},
-    {15187880888391144940ULL, 11, {45, 62, 0x0}},
-    {9481557531746939739ULL, 9, {29, 2, 0x0}},
-    {8021248351717500261ULL, 7, {46, 36, 0x0}},
-    {14764886521043386317ULL, 6, {46, 54, 0x0}},
-    {16954522953539018144ULL, 4, {21, 6, 0x0}},
-    {13056737717640939829ULL, 3, {54, 61, 0x0}},
-    {18390433579275433556ULL, 2, {27, 11, 0x2}},
-    {15148002233069058654ULL, 1, {35, 51, 0x2}},
-    {8184610935273486613ULL, 1, {11, 1, 0x0}},
-    {10531215677618469210ULL, 1, {45, 62, 0x0}},
-    {2533458225393825749ULL, 1, {17, 9, 0x0}},
-    {14676951179810983636ULL, 1, {37, 58, 0x0}},
-    {18013332567305626445ULL, 9, {41, 49, 0x0}},
-    {13858232775334722139ULL, 9, {9, 2, 0x0}},
-    {7750542552379145765ULL, 10, {49, 58, 0x0}},
-    {14935808703457755782ULL, 10, {21, 6, 0x0}},
-    {4768491383048242903ULL, 21, {45, 62, 0x0}},
-    {11406991152036004517ULL, 10, {18, 1, 0x0}},
-    {11569242016875752350ULL, 7, {44, 52, 0x0}},
-    {2093600658088600321ULL, 29, {37, 53, 0x2}},
-    {10556237788187991416ULL, 28, {36, 28, 0x0}},
-    {17846851669840453769ULL, 23, {44, 52, 0x0}},
-    {12688187564676735892ULL, 23, {21, 6, 0x0}},
-    {9335905268941726859ULL, 22, {36, 43, 0x1}},
-    {6210545000529033810ULL, 2, {26, 10, 0x2}},
-    {6392777289878072855ULL, 2, {57, 59, 0x40}},
-    {11092478349946713888ULL, 5, {21, 6, 0x0}},
-    {5807311083072943038ULL, 2, {44, 52, 0x0}},
-    {14711377200923721030ULL, 35, {30, 58, 0x0}},
-    {1915407437674664021ULL, 29, {35, 27, 0x0}},
-    {1967469480015213900ULL, 23, {37, 53, 0x2}},
-    {8763854933737976437ULL, 23, {23, 15, 0x0}},
-    {9804492220063593050ULL, 18, {21, 30, 0x1}},
-    {16958530572748384779ULL, 19, {52, 60, 0x1}},
-    {8987149673667085504ULL, 15, {29, 13, 0x2}},
-    {14210434252865569227ULL, 9, {42, 57, 0x0}},
-    {9969281635438771999ULL, 81, {21, 6, 0x0}},
-    {14844827457311525070ULL, 18, {45, 53, 0x0}},
-    {1314835731158487594ULL, 9, {19, 11, 0x0}},
-    {15545691668011886600ULL, 5, {42, 57, 0x0}},
-    {12331730809702144593ULL, 51, {18, 1, 0x0}},
-    {16322243606798646720ULL, 14, {47, 55, 0x0}},
-    {10638464564107361517ULL, 54, {27, 42, 0x1}},
-    {13469448620684297881ULL, 245, {21, 6, 0x0}},
-    {5615811326698465498ULL, 153, {43, 51, 0x0}},
-    {5987116548675183042ULL, 108, {33, 5, 0x0}},
-    {14413491166405804459ULL, 75, {40, 48, 0x0}},
-    {5072961277340380631ULL, 71, {44, 52, 0x0}},
-    {9581962968419767339ULL, 69, {28, 12, 0x2}},
-    {2621311469583977504ULL, 61, {42, 57, 0x0}},
-    {12109531797814807584ULL, 64, {21, 6, 0x0}},
-    {12827528685899115972ULL, 41, {41, 49, 0x0}},
-    {9720808026548882503ULL, 6, {18, 1, 0x0}},
-    {12021186080624265295ULL, 9, {49, 58, 0x0}},
-    {2185107376395608112ULL, 7, {11, 2, 0x0}},
-    {8115729475355106385ULL, 8, {57, 59, 0x40}},
-    {97357755900603218ULL, 4, {43, 51, 0x0}},
-    {12545752070711262764ULL, 4, {21, 6, 0x0}},
-    {3008848162440257535ULL, 8, {36, 43, 0x1}},
-    {1894978136666100151ULL, 8, {36, 29, 0x1}},
-    {2435442547058127667ULL, 8, {44, 52, 0x0}},
-    {10638464564107361517ULL, 65, {38, 54, 0x2}},
-    {14066936134873869619ULL, 12, {19, 11, 0x0}},
-    {15577658622448847543ULL, 13, {57, 59, 0x40}},
-    {11471909942384048753ULL, 7, {28, 12, 0x2}},
-    {10232516574562256036ULL, 3, {45, 53, 0x0}},
-    {14210563145996024942ULL, 4, {18, 1, 0x0}},
-    {14109056509716853776ULL, 4, {36, 52, 0x2}},
-    {15172674956200401904ULL, 4, {19, 11, 0x0}},
-    {17192387111477417047ULL, 116, {28, 12, 0x2}},
-    {2349425162729810088ULL, 115, {36, 44, 0x0}},
-    {1149462635247451623ULL, 71, {18, 1, 0x0}},
-    {17757592753060749438ULL, 28, {37, 53, 0x2}},
-    {8796440348712422494ULL, 29, {17, 9, 0x0}},
-    {4708117040037441050ULL, 17, {28, 37, 0x1}},
-    {591964673182378060ULL, 56, {47, 55, 0x0}},
-    {16838785698363190156ULL, 14, {21, 6, 0x0}},
-    {7504456281895907817ULL, 4, {38, 54, 0x2}},
-    {16413674698006998565ULL, 3, {21, 13, 0x0}},
-    {12432952356401683391ULL, 1, {40, 48, 0x0}},
-    {4481191155974191812ULL, 39, {25, 61, 0x0}},
-    {18160575012496129293ULL, 23, {16, 8, 0x0}},
-    {15999877143920231641ULL, 13, {18, 25, 0x1}},
-    {4286387923052900783ULL, 18, {34, 50, 0x2}},
-    {7071296602228129401ULL, 12, {20, 12, 0x0}},
-    {1540265533518731173ULL, 11, {27, 34, 0x1}},
-    {1093974392833597562ULL, 11, {27, 20, 0x1}},
-    {3862702256675475552ULL, 11, {42, 57, 0x0}},
-    {15128617958922077397ULL, 39, {54, 61, 0x0}},
-    {10093040266006802083ULL, 40, {9, 2, 0x0}},
-    {9131774160553666360ULL, 32, {51, 58, 0x0}},
-    {15301545555950680705ULL, 16, {42, 57, 0x0}},
-    {7006831277103232781ULL, 16, {35, 27, 0x0}},
-    {2875828653044774410ULL, 15, {52, 42, 0x0}},
-    {3643562861573077371ULL, 4, {21, 13, 0x0}},
-    {18373868559938525930ULL, 4, {37, 53, 0x2}},
-    {4481191155974191812ULL, 25, {47, 55, 0x0}},
-    {13623201159966729441ULL, 15, {21, 6, 0x0}},
-    {15482817343018728520ULL, 34, {38, 54, 0x2}},
-    {3279538519127023954ULL, 46, {21, 6, 0x0}},
-    {12871989951295209753ULL, 45, {27, 36, 0x1}},
-    {6504743862482812212ULL, 46, {27, 21, 0x1}},
-    {4940966313009054159ULL, 49, {34, 61, 0x0}},
-    {2615527265235199523ULL, 46, {17, 27, 0x0}},
-    {17500984169399236072ULL, 46, {41, 34, 0x0}},
-    {7027421162547560469ULL, 161, {21, 6, 0x0}},
-    {6110199738464616719ULL, 155, {42, 57, 0x0}},
-    {10769085544516845782ULL, 66, {18, 1, 0x0}},
-    {5615811326698465498ULL, 78, {47, 55, 0x0}},
-    {7413384737443105225ULL, 18, {37, 29, 0x0}},
-    {12570435042201213075ULL, 8, {52, 62, 0x0}},
-    {2775107915265966558ULL, 6, {30, 58, 0x0}},
-    {10563597401517293534ULL, 3, {13, 4, 0x0}},
-    {1992228808461556049ULL, 2, {57, 59, 0x40}},
-    {12129859749492972866ULL, 2, {23, 15, 0x0}},
-    {12615713685532767200ULL, 2, {21, 30, 0x1}},
-    {13623201159966729441ULL, 2, {12, 6, 0x0}},
-    {17092755077021478666ULL, 2, {34, 61, 0x0}},
-    {2977727989287694999ULL, 73, {28, 12, 0x2}},
-    {13818699683759293321ULL, 73, {28, 35, 0x1}},
-    {17791765001825661139ULL, 72, {28, 18, 0x1}},
-    {1177254642481836431ULL, 34, {37, 58, 0x0}},
-    {4198153015302602510ULL, 18, {45, 28, 0x1}},
-    {18313940594820593511ULL, 15, {42, 60, 0x0}},
-    {3957430868384523950ULL, 45, {41, 49, 0x0}},
-    {6665738033459067864ULL, 52, {37, 53, 0x2}},
-    {14633532450326116898ULL, 6, {17, 9, 0x0}},
-    {14859532205576770013ULL, 1, {44, 52, 0x0}},
-    {7855320497807264259ULL, 1, {9, 2, 0x0}},
-    {103316315860200750ULL, 1, {45, 62, 0x0}},
-    {16636683412129523599ULL, 2, {21, 6, 0x0}},
-    {13195742579694599230ULL, 2, {41, 49, 0x0}},
-    {5987116548675183042ULL, 92, {19, 11, 0x0}},
-    {16322243606798646720ULL, 130, {52, 62, 0x0}},
-    {2735451798568382007ULL, 26, {33, 5, 0x0}},
-    {14319812193453475101ULL, 18, {27, 42, 0x0}},
-    {16584525557971222757ULL, 16, {24, 33, 0x0}},
-    {12026498250778304545ULL, 3, {37, 53, 0x2}},
-    {14413491166405804459ULL, 3, {51, 58, 0x0}},
-    {15703377938568828405ULL, 94, {42, 57, 0x0}},
-    {3209144858891408054ULL, 127, {29, 13, 0x2}},
-    {6716062724244528433ULL, 51, {45, 53, 0x0}},
-    {7413384737443105225ULL, 4, {17, 9, 0x0}},
-    {3530860594165431057ULL, 2, {29, 36, 0x1}},
-    {7413384737443105225ULL, 18, {31, 15, 0x2}},
-    {15303123935364238221ULL, 18, {43, 51, 0x0}},
-    {6093801372723278857ULL, 16, {51, 58, 0x0}},
-    {1668084767683326049ULL, 15, {1, 3, 0x40}},
-    {16726239604249353934ULL, 14, {57, 59, 0x40}},
-    {9829105923230151897ULL, 30, {21, 6, 0x0}},
-    {10279891813135870892ULL, 15, {30, 58, 0x0}},
-    {14143150030531999970ULL, 11, {33, 5, 0x0}},
-    {25380838153886694ULL, 4, {40, 48, 0x0}},
-    {53917537757537769ULL, 39, {36, 52, 0x2}},
-    {15406502552299956960ULL, 39, {36, 29, 0x1}},
-    {10545344780971900685ULL, 39, {36, 42, 0x1}},
-    {15128617958922077397ULL, 148, {47, 61, 0x0}},
-    {12711790140574267462ULL, 20, {31, 4, 0x0}},
-    {1229768859905630747ULL, 19, {54, 47, 0x0}},
-    {16576340125263318608ULL, 18, {44, 52, 0x0}},
-    {14968096081227615330ULL, 10, {1, 3, 0x40}},
-    {14483204128172795756ULL, 2, {25, 61, 0x0}},
-    {2082559453057686086ULL, 45, {47, 55, 0x0}},
-    {4708117040037441050ULL, 4, {57, 59, 0x40}},
-    {3020983148694912262ULL, 27, {49, 58, 0x0}},
-    {770971303097717231ULL, 27, {9, 2, 0x0}},
-    {7579535807716578346ULL, 17, {57, 59, 0x40}},
-    {3343666456905200021ULL, 12, {21, 6, 0x0}},
-    {3601454187398330320ULL, 12, {44, 52, 0x0}},
-    {2082746201644327278ULL, 30, {20, 2, 0x0}},
-    {11377745320027862815ULL, 30, {36, 52, 0x2}},
-    {773515506199458081ULL, 8, {35, 28, 0x1}},
-    {11825779621770200243ULL, 3, {45, 62, 0x0}},
-    {16838785698363190156ULL, 10, {29, 13, 0x2}},
-    {6804668624446428026ULL, 10, {42, 57, 0x0}},
-    {10769085544516845782ULL, 86, {19, 11, 0x0}},
-    {12119748102978060678ULL, 25, {47, 55, 0x0}},
-    {993118837056614295ULL, 8, {13, 4, 0x0}},
-    {5087855683859097311ULL, 5, {43, 51, 0x0}},
-    {15108273603392009846ULL, 1, {38, 2, 0x0}},
-    {4398019156501779114ULL, 1, {52, 61, 0x0}},
-    {6747563481170891826ULL, 7, {42, 50, 0x0}},
-    {840766407050404543ULL, 6, {42, 57, 0x0}},
-    {1455392966675295401ULL, 3, {21, 6, 0x0}},
-    {13921072136224265788ULL, 5, {53, 60, 0x0}},
-    {14897711322401616057ULL, 4, {1, 3, 0x40}},
-    {5214082631592432688ULL, 4, {28, 45, 0x0}},
-    {17324407511141808068ULL, 3, {20, 12, 0x0}},
-    {133458314977683586ULL, 3, {36, 52, 0x2}},
-    {11368999790208975023ULL, 3, {12, 6, 0x0}},
-    {7152911819642134194ULL, 3, {41, 49, 0x0}},
-    {12641107388846704544ULL, 3, {18, 1, 0x0}},
-    {8719313362175360439ULL, 3, {49, 58, 0x0}},
-    {2680562559861720671ULL, 3, {17, 9, 0x0}},
-    {10825393252843202608ULL, 2, {35, 51, 0x2}},
-    {6747563481170891826ULL, 5, {51, 58, 0x0}},
-    {12026498250778304545ULL, 13, {21, 27, 0x1}},
-    {15301545555950680705ULL, 4, {27, 36, 0x1}},
-    {2104842608597774724ULL, 4, {27, 12, 0x1}},
-    {5615811326698465498ULL, 82, {29, 36, 0x1}},
-    {10783425967204384441ULL, 82, {31, 15, 0x2}},
-    {2741397821981498825ULL, 63, {34, 61, 0x0}},
-    {12711790140574267462ULL, 31, {13, 4, 0x0}},
-    {8449531528916247117ULL, 20, {54, 47, 0x0}},
-    {14079786836315397439ULL, 19, {41, 49, 0x0}},
-    {11333902720713066036ULL, 14, {29, 13, 0x2}},
-    {17871351009244034742ULL, 12, {42, 57, 0x0}},
-    {14500376946479100129ULL, 36, {36, 52, 0x2}},
-    {17190097366240346434ULL, 18, {23, 15, 0x0}},
-    {10758381565394943214ULL, 18, {21, 30, 0x1}},
-    {12570435042201213075ULL, 8, {34, 61, 0x0}},
-    {15340939793667601002ULL, 41, {23, 15, 0x0}},
-    {2563168401952395121ULL, 41, {21, 30, 0x1}},
-    {17757592753060749438ULL, 23, {46, 54, 0x0}},
-    {25380838153886694ULL, 7, {54, 61, 0x0}},
-    {12886379800431348820ULL, 26, {29, 13, 0x2}},
-    {7637180607189499230ULL, 24, {49, 58, 0x0}},
-    {4214986889140312976ULL, 38, {17, 9, 0x0}},
-    {18258654199023794385ULL, 19, {57, 59, 0x40}},
-    {13712061606645507650ULL, 19, {9, 2, 0x0}},
-    {16736625676928893282ULL, 13, {44, 52, 0x0}},
-    {993118837056614295ULL, 17, {18, 1, 0x0}},
-    {9279904601962351389ULL, 14, {45, 62, 0x0}},
-    {9920121575557290596ULL, 8, {38, 2, 0x0}},
-    {1868446406993437951ULL, 7, {28, 45, 0x0}},
-    {17009048183442145544ULL, 2, {29, 38, 0x0}},
-    {4032557597801673769ULL, 1, {42, 57, 0x0}},
-    {12590278638344084256ULL, 1, {11, 1, 0x0}},
-    {14431444792400727475ULL, 1, {47, 55, 0x0}},
-    {2870234735003405743ULL, 43, {51, 58, 0x0}},
-    {3426955840866958320ULL, 43, {18, 1, 0x0}},
-    {1901106070116560627ULL, 57, {29, 36, 0x1}},
-    {7970692074950612299ULL, 26, {27, 11, 0x2}},
-    {11957554872739730731ULL, 17, {35, 51, 0x2}},
-    {9976399992468034644ULL, 17, {18, 1, 0x0}},
-    {11707367423980845857ULL, 15, {28, 35, 0x1}},
-    {17950980260751052398ULL, 14, {29, 2, 0x1}},
-    {8239232551187103096ULL, 4, {45, 62, 0x0}},
-    {6210545000529033810ULL, 15, {18, 10, 0x0}},
-    {16479042260086204431ULL, 15, {57, 59, 0x40}},
-    {17846851669840453769ULL, 4, {38, 54, 0x2}},
-    {7328389343944275548ULL, 2, {33, 5, 0x0}},
-    {3979068331136125196ULL, 1, {30, 38, 0x0}},
-    {8285786309667566735ULL, 7, {26, 10, 0x2}},
-    {3950652040008493277ULL, 2, {36, 52, 0x2}},
-    {3313732875402653305ULL, 2, {36, 27, 0x1}},
-    {1673060906266845664ULL, 2, {26, 35, 0x1}},
-    {17681432306470096337ULL, 2, {18, 1, 0x0}},
-    {13594745439207162141ULL, 2, {42, 57, 0x0}},
-    {12733805347311715613ULL, 1, {29, 2, 0x0}},
-    {17181749530464600074ULL, 1, {36, 42, 0x1}},
-    {8163029570126985157ULL, 64, {21, 6, 0x0}},
-    {7911383522077931103ULL, 23, {49, 58, 0x0}},
-    {1908771061529858395ULL, 7, {17, 9, 0x0}},
-    {16615435909344049583ULL, 2, {45, 53, 0x0}},
-    {6585822173527842533ULL, 2, {9, 2, 0x0}},
-    {3648410339936323360ULL, 2, {36, 52, 0x2}},
-    {6716062724244528433ULL, 84, {43, 51, 0x0}},
-    {6742497247546110933ULL, 79, {21, 6, 0x0}},
-    {1728904685062386737ULL, 38, {40, 48, 0x0}},
-    {13004833892763861492ULL, 31, {36, 52, 0x2}},
-    {15903038813817600414ULL, 24, {29, 13, 0x2}},
-    {12385723303618198603ULL, 59, {18, 1, 0x0}},
-    {5171627440783890126ULL, 49, {42, 57, 0x0}},
-    {6716062724244528433ULL, 16, {29, 36, 0x1}},
-    {15319811241057226675ULL, 27, {19, 11, 0x0}},
-    {6993440976739071748ULL, 25, {43, 51, 0x0}},
-    {17062168505804268613ULL, 27, {29, 2, 0x1}},
-    {12290004925374514634ULL, 22, {37, 53, 0x2}},
-    {12749293669328252047ULL, 23, {41, 49, 0x0}},
-    {16322081069638909478ULL, 19, {28, 12, 0x2}},
-    {9970987918424216689ULL, 19, {28, 37, 0x1}},
-    {14588135369666616740ULL, 19, {28, 18, 0x1}},
-    {16033269815702364101ULL, 28, {49, 58, 0x0}},
-    {12119748102978060678ULL, 14, {41, 49, 0x0}},
-    {12324854824352036840ULL, 14, {18, 1, 0x0}},
-    {15095885281735851699ULL, 22, {49, 58, 0x0}},
-    {14844827457311525070ULL, 40, {51, 58, 0x0}},
-    {12624446126019701868ULL, 8, {26, 5, 0x0}},
-    {2649350018744866719ULL, 8, {42, 57, 0x0}},
-    {9711748395756806951ULL, 7, {19, 11, 0x0}},
-    {572603635893002343ULL, 7, {57, 59, 0x40}},
-    {7071296602228129401ULL, 6, {21, 6, 0x0}},
-    {14124627038352913409ULL, 6, {27, 34, 0x1}},
-    {7011946785873280527ULL, 6, {27, 21, 0x1}},
-    {1714458505954375055ULL, 2, {36, 52, 0x2}},
-    {2301175346920265746ULL, 13, {27, 11, 0x2}},
-    {8473730752022548436ULL, 12, {36, 52, 0x2}},
-    {13830462267328348228ULL, 5, {36, 29, 0x1}},
-    {14641472080953146293ULL, 5, {36, 45, 0x1}},
-    {9848279537485177373ULL, 5, {36, 27, 0x1}},
-    {10376842152009751076ULL, 9, {42, 57, 0x0}},
-    {14671375724513095326ULL, 1, {38, 2, 0x0}},
-    {6731332181414880213ULL, 1, {52, 62, 0x0}},
-    {1908771061529858395ULL, 14, {27, 11, 0x2}},
-    {2886669060342436932ULL, 12, {44, 52, 0x0}},
-    {3355138731290550218ULL, 12, {28, 12, 0x2}},
-    {17372698285898210683ULL, 12, {57, 59, 0x40}},
-    {17188657718858330447ULL, 2, {26, 10, 0x2}},
-    {16232682458722154997ULL, 1, {36, 52, 0x2}},
-    {1283078865747651410ULL, 1, {36, 27, 0x1}},
-    {15703593316695087983ULL, 1, {36, 60, 0x1}},
-    {17543867194890805084ULL, 1, {21, 6, 0x0}},
-    {11519129908340649398ULL, 1, {60, 36, 0x0}},
-    {283656114870248381ULL, 1, {18, 1, 0x0}},
-    {6162882846702653527ULL, 1, {42, 57, 0x0}},
-    {14066936134873869619ULL, 35, {22, 4, 0x0}},
-    {2879742079958877232ULL, 36, {29, 36, 0x1}},
-    {840766407050404543ULL, 27, {43, 51, 0x0}},
-    {7548622393127657459ULL, 20, {1, 3, 0x40}},
-    {293707353222029336ULL, 20, {51, 57, 0x0}},
-    {11643672303704649343ULL, 1, {31, 38, 0x0}},
-    {4155452502290639426ULL, 1, {47, 55, 0x0}},
-    {2812344339552456972ULL, 4, {19, 11, 0x0}},
-    {1665519270960685263ULL, 1, {29, 36, 0x1}},
-    {9720808026548882503ULL, 15, {26, 10, 0x2}},
-    {1854194660543656710ULL, 15, {49, 58, 0x0}},
-    {7727470717747927906ULL, 5, {20, 2, 0x0}},
-    {18355500386696156565ULL, 2, {35, 51, 0x2}},
-    {16838785698363190156ULL, 25, {20, 2, 0x0}},
-    {15278193525252374643ULL, 10, {42, 57, 0x0}},
-    {7413384737443105225ULL, 27, {19, 11, 0x0}},
-    {15482817343018728520ULL, 10, {41, 49, 0x0}},
-    {12711790140574267462ULL, 78, {22, 14, 0x0}},
-    {17442651412078622752ULL, 65, {30, 58, 0x0}},
-    {1318184152444028073ULL, 24, {17, 9, 0x0}},
-    {5536440748729165775ULL, 3, {41, 49, 0x0}},
-    {16995851547538842892ULL, 3, {9, 2, 0x0}},
-    {10048159195367972858ULL, 3, {49, 58, 0x0}},
-    {15042907740151897088ULL, 1, {28, 12, 0x2}},
-    {16041893229697429387ULL, 1, {36, 52, 0x2}},
-    {8519506059000683964ULL, 1, {18, 1, 0x0}},
-    {4250077511963411789ULL, 1, {42, 57, 0x0}},
-    {2505803546339071536ULL, 4, {29, 13, 0x2}},
-    {2501578675895032961ULL, 3, {45, 53, 0x0}},
-    {6665738033459067864ULL, 20, {46, 54, 0x0}},
-    {8959450622482795558ULL, 5, {28, 12, 0x2}},
-    {14915169002306869447ULL, 5, {43, 51, 0x0}},
-    {12711790140574267462ULL, 6, {22, 4, 0x0}},
-    {9751489673746178941ULL, 4, {45, 62, 0x0}},
-    {18295344350778702024ULL, 31, {44, 52, 0x0}},
-    {7513718561077675328ULL, 14, {18, 1, 0x0}},
-    {1422303883457906996ULL, 10, {41, 49, 0x0}},
-    {7110736979523648927ULL, 6, {29, 13, 0x2}},
-    {10342381966893010432ULL, 3, {34, 50, 0x2}},
-    {4770231800961963911ULL, 2, {21, 6, 0x0}},
-    {15197607163124411638ULL, 2, {42, 57, 0x0}},
-    {16903320222177165557ULL, 2, {17, 9, 0x0}},
-    {14781214604342801071ULL, 2, {49, 58, 0x0}},
-    {8188711911683670460ULL, 141, {51, 58, 0x0}},
-    {8883769607788037463ULL, 9, {17, 9, 0x0}},
-    {15541371297749655392ULL, 6, {57, 59, 0x40}},
-    {5120058751335183637ULL, 44, {29, 36, 0x1}},
-    {8608987003803134410ULL, 2, {31, 4, 0x0}},
-    {13786902070151292447ULL, 1, {45, 62, 0x0}},
-    {2735451798568382007ULL, 122, {36, 29, 0x1}},
-    {7090549624570246630ULL, 122, {36, 42, 0x1}},
-    {2893989887187591113ULL, 15, {12, 5, 0x0}},
-    {6122447396797997856ULL, 6, {46, 36, 0x0}},
-    {6110199738464616719ULL, 7, {29, 36, 0x1}},
-    {9598795231784767581ULL, 4, {19, 11, 0x0}},
-    {6148795439238606372ULL, 4, {38, 54, 0x2}},
-    {8322776912128133000ULL, 4, {31, 15, 0x2}},
-    {7745143358504352076ULL, 4, {30, 38, 0x0}},
-    {14079786836315397439ULL, 1, {46, 60, 0x0}},
-    {4864449671301378125ULL, 1, {22, 28, 0x0}},
-    {812840133700858392ULL, 1, {42, 57, 0x0}},
-    {18241325219517442881ULL, 11, {21, 6, 0x0}},
-    {4847744698071564754ULL, 3, {45, 62, 0x0}},
-    {5288160281399232754ULL, 1, {18, 1, 0x0}},
-    {6045171391468466416ULL, 9, {41, 49, 0x0}},
-    {10637443691682725580ULL, 9, {19, 11, 0x0}},
-    {16901637410980053552ULL, 2, {49, 58, 0x0}},
-    {9750818109215314719ULL, 2, {28, 12, 0x2}},
-    {9172695510878081810ULL, 2, {44, 52, 0x0}},
-    {1149462635247451623ULL, 75, {19, 11, 0x0}},
-    {13991009012707108773ULL, 62, {57, 59, 0x40}},
-    {17062104511720056560ULL, 13, {11, 1, 0x0}},
-    {2895546725888111521ULL, 11, {36, 52, 0x2}},
-    {4687596134951815932ULL, 5, {38, 28, 0x0}},
-    {11081432967022332892ULL, 5, {44, 52, 0x0}},
-    {7579535807716578346ULL, 6, {36, 52, 0x2}},
-    {9549965178660595352ULL, 6, {36, 29, 0x1}},
-    {17442165573530301713ULL, 6, {36, 42, 0x1}},
-    {6279419389070596696ULL, 58, {35, 51, 0x2}},
-    {8120541413462616762ULL, 47, {18, 1, 0x0}},
-    {12497160100107022887ULL, 1, {17, 9, 0x0}},
-    {9986732514127811056ULL, 1, {47, 55, 0x0}},
-    {18241325219517442881ULL, 52, {18, 1, 0x0}},
-    {6475952180568536409ULL, 20, {42, 57, 0x0}},
-    {3037644815974198949ULL, 28, {45, 62, 0x0}},
-    {9569009031069948786ULL, 19, {17, 9, 0x0}},
-    {10364255661490601026ULL, 15, {36, 52, 0x2}},
-    {3729409966781515091ULL, 6, {28, 12, 0x2}},
-    {15947404463563569580ULL, 4, {43, 51, 0x0}},
-    {4214986889140312976ULL, 19, {21, 6, 0x0}},
-    {914637218120196131ULL, 9, {36, 52, 0x2}},
-    {12943328154826809346ULL, 2, {19, 11, 0x0}},
-    {15703377938568828405ULL, 4, {34, 61, 0x0}},
-    {9024235308395511945ULL, 4, {29, 13, 0x2}},
-    {278409118042173093ULL, 4, {43, 51, 0x0}},
-    {4649591379722895290ULL, 4, {21, 6, 0x0}},
-    {12731542551486537385ULL, 2, {42, 57, 0x0}},
-    {17582251946335691483ULL, 1, {36, 29, 0x1}},
-    {1585947895491903ULL, 1, {36, 43, 0x1}},
-    {7513718561077675328ULL, 11, {27, 11, 0x2}},
-    {777990396790851720ULL, 6, {42, 57, 0x0}},
-    {12827528685899115972ULL, 19, {35, 51, 0x2}},
-    {1474266377571258710ULL, 14, {18, 1, 0x0}},
-    {8219265671452526402ULL, 14, {52, 62, 0x0}},
-    {5669295284370306900ULL, 15, {29, 2, 0x0}},
-    {3300256014667870026ULL, 1, {28, 35, 0x1}},
-    {2931941168010677267ULL, 19, {45, 53, 0x0}},
-    {8785894358676112783ULL, 19, {1, 3, 0x40}},
-    {9975603925005967238ULL, 1, {41, 49, 0x0}},
-    {14194279687717433392ULL, 1, {20, 12, 0x0}},
-    {17726787498060847846ULL, 1, {49, 58, 0x0}},
-    {15340939793667601002ULL, 7, {18, 1, 0x0}},
-    {17133496805546514110ULL, 4, {37, 53, 0x2}},
-    {7911383522077931103ULL, 41, {36, 52, 0x2}},
-    {7322700205443602857ULL, 34, {36, 29, 0x1}},
-    {13574086720261976204ULL, 34, {36, 42, 0x1}},
-    {3176364777583782124ULL, 6, {17, 9, 0x0}},
-    {17534946915197922388ULL, 6, {49, 58, 0x0}},
-    {9176897335069304700ULL, 15, {27, 11, 0x2}},
-    {8782252516741021107ULL, 4, {43, 51, 0x0}},
-    {972090875215448539ULL, 2, {29, 13, 0x2}},
-    {13362506628755188942ULL, 1, {38, 52, 0x1}},
-    {2301266309358357510ULL, 1, {38, 29, 0x1}},
-    {9459660023428820087ULL, 1, {42, 57, 0x0}},
-    {6210545000529033810ULL, 20, {11, 2, 0x0}},
-    {11048650874918221550ULL, 20, {57, 59, 0x40}},
-    {12871989951295209753ULL, 1, {41, 49, 0x0}},
-    {1068111835404379490ULL, 1, {16, 8, 0x0}},
-    {7149637445512971273ULL, 1, {27, 36, 0x1}},
-    {849092312563254848ULL, 1, {27, 21, 0x1}},
-    {6434299344458721954ULL, 1, {49, 58, 0x0}},
-    {13004833892763861492ULL, 64, {43, 51, 0x0}},
-    {2036112602586856111ULL, 14, {26, 5, 0x0}},
-    {4109029209836402763ULL, 8, {37, 53, 0x2}},
-    {4536785660751313020ULL, 5, {19, 11, 0x0}},
-    {196176948054795775ULL, 2, {46, 54, 0x0}},
-    {9336284102959383684ULL, 1, {16, 8, 0x0}},
-    {8354904400468729281ULL, 1, {54, 61, 0x0}},
-    {17062104511720056560ULL, 44, {20, 2, 0x0}},
-    {1317110858163818703ULL, 31, {36, 52, 0x2}},
-    {6045171391468466416ULL, 9, {42, 57, 0x0}},
-    {9569009031069948786ULL, 8, {19, 11, 0x0}},
-    {1635983559685780572ULL, 6, {43, 51, 0x0}},
-    {13856607936477302279ULL, 7, {28, 12, 0x2}},
-    {6199532930025342549ULL, 7, {36, 52, 0x2}},
-    {14066936134873869619ULL, 7, {31, 4, 0x0}},
-    {8649008993049352522ULL, 8, {52, 61, 0x0}},
-    {8166857017631394197ULL, 1, {41, 34, 0x0}},
-    {177579987036537401ULL, 2, {28, 12, 0x2}},
-    {839368920358445451ULL, 1, {45, 53, 0x0}},
-    {7027421162547560469ULL, 12, {36, 29, 0x1}},
-    {14987197842980211143ULL, 13, {36, 45, 0x1}},
-    {7537262777870219194ULL, 5, {26, 5, 0x0}},
-    {13393008549543341842ULL, 4, {45, 62, 0x0}},
-    {2887115534459666234ULL, 3, {19, 11, 0x0}},
-    {13686315263580342902ULL, 3, {42, 57, 0x0}},
-    {4109029209836402763ULL, 2, {36, 52, 0x2}},
-    {6272273757919023540ULL, 2, {19, 11, 0x0}},
-    {14723228151667756608ULL, 6, {44, 58, 0x0}},
-    {6133301595152107456ULL, 2, {17, 26, 0x0}},
-    {554085673995016712ULL, 2, {57, 59, 0x40}},
-    {8959450622482795558ULL, 3, {21, 6, 0x0}},
-    {3459559979807822615ULL, 3, {54, 61, 0x0}},
-    {3497726837187527558ULL, 4, {28, 12, 0x2}},
-    {1558463254630670412ULL, 4, {43, 51, 0x0}},
-    {6852069104017634040ULL, 4, {33, 5, 0x0}},
-    {14296547635220651976ULL, 1, {51, 58, 0x0}},
-    {14143150030531999970ULL, 11, {19, 11, 0x0}},
-    {2471150850997830812ULL, 6, {54, 61, 0x0}},
-    {3300256014667870026ULL, 16, {51, 58, 0x0}},
-    {7030747919821981677ULL, 4, {26, 10, 0x2}},
-    {1991589756165033547ULL, 3, {41, 49, 0x0}},
-    {6524392516040585523ULL, 3, {18, 1, 0x0}},
-    {7331386490102310482ULL, 3, {49, 58, 0x0}},
-    {17845635959471148989ULL, 3, {38, 2, 0x0}},
-    {1170341815958351220ULL, 3, {52, 61, 0x0}},
-    {773515506199458081ULL, 22, {35, 18, 0x1}},
-    {1129310601353224863ULL, 22, {52, 62, 0x0}},
-    {2036112602586856111ULL, 9, {17, 9, 0x0}},
-    {11963779754448401402ULL, 5, {36, 52, 0x2}},
-    {9091132709694184297ULL, 5, {9, 2, 0x0}},
-    {14243878172982361627ULL, 3, {51, 58, 0x0}},
-    {18128335501968969319ULL, 2, {29, 13, 0x2}},
-    {15090543245635307054ULL, 2, {57, 59, 0x40}},
-    {11693809640101141234ULL, 38, {9, 2, 0x0}},
-    {6880499474982597015ULL, 4, {40, 48, 0x0}},
-    {11860608617220744156ULL, 2, {21, 6, 0x0}},
-    {3585995825695372266ULL, 2, {30, 58, 0x0}},
-    {13154287382139801668ULL, 2, {27, 11, 0x2}},
-    {18099297388613665079ULL, 1, {21, 30, 0x1}},
-    {13469448620684297881ULL, 7, {36, 29, 0x1}},
-    {5150116533860079001ULL, 8, {36, 45, 0x1}},
-    {8345469821715418428ULL, 10, {21, 6, 0x0}},
-    {12012657410847535054ULL, 14, {45, 62, 0x0}},
-    {14500376946479100129ULL, 7, {37, 53, 0x2}},
-    {7197946325623443479ULL, 7, {37, 28, 0x1}},
-    {5331602436707500901ULL, 6, {57, 59, 0x40}},
-    {1017817944632322248ULL, 4, {20, 12, 0x0}},
-    {9941928836988309392ULL, 3, {45, 62, 0x0}},
-    {12897490993319664343ULL, 3, {17, 9, 0x0}},
-    {2448743964428755036ULL, 1, {51, 57, 0x0}},
-    {2249454939323824452ULL, 1, {21, 13, 0x0}},
-    {2646975902456156113ULL, 1, {41, 49, 0x0}},
-    {14878020546722721943ULL, 42, {17, 9, 0x0}},
-    {14052924361077828856ULL, 34, {36, 52, 0x2}},
-    {13906417954511346675ULL, 18, {9, 2, 0x0}},
-    {7959766696922578202ULL, 2, {39, 55, 0x2}},
-    {17150155133668666767ULL, 2, {23, 15, 0x0}},
-    {8162407103885109136ULL, 1, {12, 30, 0x1}},
-    {14671375724513095326ULL, 4, {31, 4, 0x0}},
-    {10954363195010390302ULL, 4, {52, 62, 0x0}},
-    {2036112602586856111ULL, 32, {29, 13, 0x2}},
-    {12104179740467917825ULL, 6, {36, 52, 0x2}},
-    {10331459553381165467ULL, 18, {41, 49, 0x0}},
-    {9514755543312572244ULL, 4, {21, 13, 0x0}},
-    {2191941687698111428ULL, 2, {49, 58, 0x0}},
-    {1782235634839136110ULL, 1, {28, 12, 0x2}},
-    {8604448727084761388ULL, 1, {28, 37, 0x1}},
-    {6174515128114182479ULL, 1, {28, 21, 0x1}},
-    {2956479477355012859ULL, 1, {36, 52, 0x2}},
-    {12767304288290706910ULL, 25, {28, 12, 0x2}},
-    {3357054024295368751ULL, 25, {28, 37, 0x1}},
-    {6303982029310930464ULL, 25, {28, 18, 0x1}},
-    {3980838960065995378ULL, 21, {42, 57, 0x0}},
-    {5767964915664738883ULL, 5, {17, 9, 0x0}},
-    {15208973919737899966ULL, 1, {43, 51, 0x0}},
-    {16838785698363190156ULL, 6, {11, 2, 0x0}},
-    {9145870416929855859ULL, 5, {42, 57, 0x0}},
-    {12104179740467917825ULL, 20, {46, 54, 0x0}},
-    {18024949223581808694ULL, 11, {12, 5, 0x0}},
-    {1314071407186854557ULL, 6, {12, 30, 0x1}},
-    {914637218120196131ULL, 4, {44, 52, 0x0}},
-    {4338179277917135841ULL, 3, {27, 11, 0x2}},
-    {12242530732107952140ULL, 3, {57, 59, 0x40}},
-    {1967469480015213900ULL, 4, {51, 57, 0x0}},
-    {1369671539045391712ULL, 4, {23, 15, 0x0}},
-    {13992497681083233895ULL, 4, {21, 30, 0x1}},
-    {97357755900603218ULL, 17, {38, 54, 0x2}},
-    {12694204206617854514ULL, 12, {38, 29, 0x1}},
-    {12256943519400572148ULL, 12, {47, 55, 0x0}},
-    {10444527169228465763ULL, 6, {47, 38, 0x1}},
-    {14964634505381996230ULL, 6, {41, 49, 0x0}},
-    {14633532450326116898ULL, 41, {21, 6, 0x0}},
-    {10364255661490601026ULL, 4, {41, 49, 0x0}},
-    {509134656474423740ULL, 3, {9, 2, 0x0}},
-    {548173204504080986ULL, 4, {49, 58, 0x0}},
-    {5511004320492376252ULL, 5, {42, 57, 0x0}},
-    {7413384737443105225ULL, 1, {22, 4, 0x0}},
-    {17017989480636133258ULL, 1, {43, 51, 0x0}},
-    {8188711911683670460ULL, 53, {45, 53, 0x0}},
-    {14413491166405804459ULL, 16, {52, 62, 0x0}},
-    {9569009031069948786ULL, 10, {28, 12, 0x2}},
-    {15267411468318500604ULL, 10, {28, 37, 0x1}},
-    {11489100509247893810ULL, 10, {28, 18, 0x1}},
-    {3865680031249028750ULL, 25, {43, 51, 0x0}},
-    {1017817944632322248ULL, 8, {21, 6, 0x0}},
-    {1134272023716330017ULL, 8, {45, 62, 0x0}},
-    {12917418249858201547ULL, 9, {28, 12, 0x2}},
-    {16801472893648106522ULL, 9, {28, 37, 0x1}},
-    {18159464821010636281ULL, 9, {28, 18, 0x1}},
-    {1455392966675295401ULL, 3, {45, 38, 0x1}},
-    {5102092696111592600ULL, 3, {45, 52, 0x1}},
-    {15100931190156258941ULL, 3, {20, 12, 0x0}},
-    {13141918964415820484ULL, 1, {52, 42, 0x0}},
-    {15265224815114118988ULL, 13, {18, 1, 0x0}},
-    {265221686384261250ULL, 3, {51, 58, 0x0}},
-    {3338049629144311765ULL, 3, {1, 3, 0x40}},
-    {16755969635800584756ULL, 3, {44, 52, 0x0}},
-    {5767964915664738883ULL, 18, {21, 6, 0x0}},
-    {6499654851304846777ULL, 1, {20, 2, 0x0}},
-    {12892961079757915258ULL, 1, {42, 57, 0x0}},
-    {14764886521043386317ULL, 30, {41, 49, 0x0}},
-    {15178710260014237150ULL, 11, {17, 9, 0x0}},
-    {13778814878623985577ULL, 9, {49, 58, 0x0}},
-    {2310651779669703706ULL, 9, {9, 2, 0x0}},
-    {5606354080358853735ULL, 1, {44, 52, 0x0}},
-    {17743355200043250827ULL, 1, {21, 6, 0x0}},
-    {16576596393701968532ULL, 1, {35, 51, 0x2}},
-    {538741738609871893ULL, 1, {20, 12, 0x0}},
-    {11345259063409242439ULL, 1, {45, 62, 0x0}},
-    {1317110858163818703ULL, 12, {37, 53, 0x2}},
-    {7949953625194153246ULL, 10, {18, 1, 0x0}},
-    {4338179277917135841ULL, 2, {17, 9, 0x0}},
-    {13421171685228884160ULL, 1, {57, 59, 0x40}},
-    {18160575012496129293ULL, 5, {21, 6, 0x0}},
-    {5379048569990581756ULL, 5, {43, 51, 0x0}},
-    {10364255661490601026ULL, 1, {43, 51, 0x0}},
-    {17249587808713272659ULL, 3, {9, 2, 0x0}},
-    {10890416690863827587ULL, 1, {36, 52, 0x2}},
-    {15278193525252374643ULL, 11, {37, 58, 0x0}},
-    {14722752504102510990ULL, 7, {45, 62, 0x0}},
-    {7743772893405030460ULL, 5, {9, 2, 0x0}},
-    {290539675022121757ULL, 4, {41, 49, 0x0}},
-    {18367464845307951065ULL, 5, {21, 6, 0x0}},
-    {8481625270009182845ULL, 6, {49, 58, 0x0}},
-    {8826388458108771235ULL, 1, {27, 11, 0x2}},
-    {2931371582047688027ULL, 1, {44, 52, 0x0}},
-    {9598795231784767581ULL, 3, {27, 11, 0x2}},
-    {13615835569174439546ULL, 3, {38, 54, 0x2}},
-    {8112777327794963562ULL, 3, {31, 15, 0x2}},
-    {2364379553530036849ULL, 3, {30, 38, 0x0}},
-    {14413491166405804459ULL, 14, {29, 36, 0x1}},
-    {1149462635247451623ULL, 7, {17, 9, 0x0}},
-    {12872666619662034762ULL, 2, {37, 53, 0x2}},
-    {9838234650818906495ULL, 2, {18, 1, 0x0}},
-    {4708117040037441050ULL, 1, {36, 52, 0x2}},
-    {18295344350778702024ULL, 22, {41, 49, 0x0}},
-    {7927473974648057776ULL, 11, {29, 13, 0x2}},
-    {16191468960106392415ULL, 11, {49, 58, 0x0}},
-    {7585785385337761577ULL, 3, {18, 1, 0x0}},
-    {2796280262426834101ULL, 2, {37, 53, 0x2}},
-    {16442994370200959247ULL, 2, {36, 28, 0x0}},
-    {5393527823492562986ULL, 2, {44, 52, 0x0}},
-    {14732534521533457304ULL, 2, {27, 11, 0x2}},
-    {447141404647627765ULL, 1, {42, 57, 0x0}},
-    {8100970276233269951ULL, 4, {40, 48, 0x0}},
-    {450072722366051628ULL, 3, {42, 33, 0x1}},
-    {3920963583253172205ULL, 3, {42, 60, 0x1}},
-    {11092478349946713888ULL, 12, {1, 3, 0x40}},
-    {13645967238160397941ULL, 9, {44, 52, 0x0}},
-    {13469448620684297881ULL, 9, {13, 4, 0x0}},
-    {5587286139241334396ULL, 7, {29, 36, 0x1}},
-    {12721134832249602215ULL, 7, {29, 13, 0x1}},
-    {3224743661667501963ULL, 8, {34, 61, 0x0}},
-    {9145870416929855859ULL, 1, {53, 60, 0x0}},
-    {10556237788187991416ULL, 3, {19, 11, 0x0}},
-    {5839849230185073442ULL, 2, {36, 52, 0x2}},
-    {7750475974625958028ULL, 2, {36, 29, 0x1}},
-    {6467201969773744832ULL, 3, {36, 43, 0x1}},
-    {11208045346968085271ULL, 2, {29, 36, 0x1}},
-    {6880499474982597015ULL, 22, {36, 52, 0x2}},
-    {2972254706930812946ULL, 22, {36, 29, 0x1}},
-    {2338757539548132740ULL, 22, {36, 42, 0x1}},
-    {15080344919695872854ULL, 10, {18, 1, 0x0}},
-    {5737912747907144810ULL, 10, {45, 62, 0x0}},
-    {1728904685062386737ULL, 1, {57, 59, 0x40}},
-    {17442651412078622752ULL, 6, {36, 52, 0x2}},
-    {12104179740467917825ULL, 3, {37, 53, 0x2}},
-    {10556237788187991416ULL, 1, {21, 6, 0x0}},
-    {1045336252137225194ULL, 1, {28, 37, 0x1}},
-    {2940903930875650287ULL, 2, {28, 18, 0x1}},
-    {2698255297296854847ULL, 2, {30, 58, 0x0}},
-    {1474266377571258710ULL, 3, {11, 1, 0x0}},
-    {10743518969449421535ULL, 2, {52, 62, 0x0}},
-    {10972059542153044357ULL, 1, {17, 9, 0x0}},
-    {8318498027237316353ULL, 1, {45, 53, 0x0}},
-    {14066936134873869619ULL, 10, {36, 29, 0x1}},
-    {8992354472741281074ULL, 13, {36, 42, 0x1}},
-    {12711790140574267462ULL, 13, {12, 6, 0x0}},
-    {13753117743094411742ULL, 4, {30, 58, 0x0}},
-    {6093801372723278857ULL, 16, {37, 58, 0x0}},
-    {672891751845276267ULL, 11, {21, 13, 0x0}},
-    {8422942228386859655ULL, 18, {47, 55, 0x0}},
-    {15212621752507211582ULL, 13, {51, 30, 0x0}},
-    {14901221747370452102ULL, 1, {18, 1, 0x0}},
-    {1076541696884820839ULL, 1, {36, 52, 0x2}},
-    {12213484500741002131ULL, 3, {37, 53, 0x2}},
-    {14012520439647040014ULL, 2, {36, 28, 0x0}},
-    {1276296526391476254ULL, 2, {36, 43, 0x1}},
-    {15940793430932476639ULL, 2, {36, 29, 0x1}},
-    {204286754603129889ULL, 2, {44, 52, 0x0}},
-    {17304774685644002423ULL, 2, {27, 11, 0x2}},
-    {17121389247970721295ULL, 2, {41, 49, 0x0}},
-    {5807311083072943038ULL, 4, {57, 59, 0x40}},
-    {1728904685062386737ULL, 14, {52, 62, 0x0}},
-    {9514755543312572244ULL, 10, {28, 12, 0x2}},
-    {15176067252810826357ULL, 4, {49, 58, 0x0}},
-    {10604165298643732127ULL, 1, {21, 6, 0x0}},
-    {7962322369552991508ULL, 1, {28, 37, 0x1}},
-    {16681075051455833859ULL, 2, {28, 18, 0x1}},
-    {15330863956172145218ULL, 3, {45, 62, 0x0}},
-    {15482817343018728520ULL, 10, {43, 51, 0x0}},
-    {7970692074950612299ULL, 22, {18, 1, 0x0}},
-    {14754085956677752251ULL, 14, {42, 57, 0x0}},
-    {12290004925374514634ULL, 11, {47, 55, 0x0}},
-    {2735451798568382007ULL, 8, {22, 4, 0x0}},
-    {4799307488805448735ULL, 8, {29, 36, 0x1}},
-    {8415331870334822986ULL, 8, {29, 22, 0x1}},
-    {10762195255169343249ULL, 6, {49, 58, 0x0}},
-    {17289678316442885910ULL, 2, {51, 58, 0x0}},
-    {3089809638989619779ULL, 1, {21, 6, 0x0}},
-    {10586808458295039916ULL, 27, {42, 57, 0x0}},
-    {8883769607788037463ULL, 55, {33, 5, 0x0}},
-    {10012751652114958081ULL, 2, {52, 62, 0x0}},
-    {9829105923230151897ULL, 22, {23, 15, 0x0}},
-    {7739810275036596223ULL, 4, {47, 61, 0x0}},
-    {8955599048947091230ULL, 1, {19, 11, 0x0}},
-    {6119325312330059491ULL, 1, {51, 58, 0x0}},
-    {14844827457311525070ULL, 11, {42, 57, 0x0}},
-    {1542558454087408499ULL, 6, {51, 58, 0x0}},
-    {2502997548444194087ULL, 3, {18, 1, 0x0}},
-    {6093706452326611260ULL, 2, {42, 57, 0x0}},
-    {1314835731158487594ULL, 8, {27, 11, 0x2}},
-    {7752577716901560103ULL, 7, {27, 36, 0x1}},
-    {9388005635330423822ULL, 7, {27, 21, 0x1}},
-    {2569514779259505425ULL, 7, {30, 58, 0x0}},
-    {10444527169228465763ULL, 2, {46, 38, 0x0}},
-    {10567234733280494159ULL, 1, {41, 49, 0x0}},
-    {11214941578300297656ULL, 28, {33, 5, 0x0}},
-    {17761317798730265785ULL, 5, {27, 42, 0x0}},
-    {12738464977685026107ULL, 4, {26, 33, 0x0}},
-    {2436054827271930815ULL, 3, {37, 53, 0x2}},
-    {13242493330680669223ULL, 3, {18, 10, 0x0}},
-    {11035919610801287067ULL, 3, {39, 60, 0x0}},
-    {13409395657452281824ULL, 3, {21, 13, 0x0}},
-    {6529626200979590115ULL, 3, {42, 27, 0x0}},
-    {1017817944632322248ULL, 4, {22, 14, 0x0}},
-    {5042902563486555274ULL, 2, {45, 62, 0x0}},
-    {9130588288642540357ULL, 1, {38, 2, 0x0}},
-    {15915291554037386368ULL, 1, {28, 45, 0x0}},
-    {11234064057812682911ULL, 1, {28, 18, 0x1}},
-    {17312489975484012561ULL, 1, {28, 37, 0x1}},
-    {1317110858163818703ULL, 1, {44, 52, 0x0}},
-    {12213484500741002131ULL, 8, {34, 50, 0x2}},
-    {17635026690004585557ULL, 5, {17, 9, 0x0}},
-    {12601444150436945129ULL, 5, {42, 57, 0x0}},
-    {12479429775323201874ULL, 5, {9, 2, 0x0}},
-    {13448610030005351832ULL, 2, {45, 53, 0x0}},
-    {6841954008926061468ULL, 16, {41, 49, 0x0}},
-    {14982825262317278076ULL, 1, {28, 12, 0x2}},
-    {14116875082459419049ULL, 1, {49, 58, 0x0}},
-    {14783785900967398601ULL, 1, {17, 9, 0x0}},
-    {2063254687334640552ULL, 1, {42, 57, 0x0}},
-    {8395160467009063010ULL, 12, {9, 2, 0x0}},
-    {15208067252259670207ULL, 8, {57, 59, 0x40}},
-    {4167540962880983898ULL, 7, {1, 3, 0x40}},
-    {7715834833786149323ULL, 6, {44, 52, 0x0}},
-    {15148002233069058654ULL, 1, {43, 51, 0x0}},
-    {16108890653513171977ULL, 1, {23, 15, 0x0}},
-    {13764528106604442583ULL, 1, {37, 53, 0x2}},
-    {5799671569739277097ULL, 1, {17, 9, 0x0}},
-    {1478252545954910413ULL, 1, {45, 62, 0x0}},
-    {7891106867928632660ULL, 3, {45, 62, 0x0}},
-    {10907661118049216360ULL, 3, {18, 1, 0x0}},
-    {6819904985226900455ULL, 3, {25, 61, 0x0}},
-    {7167454292758700144ULL, 33, {36, 52, 0x2}},
-    {12604074158025521965ULL, 32, {9, 2, 0x0}},
-    {2931941168010677267ULL, 1, {52, 62, 0x0}},
-    {15907968204951449389ULL, 1, {28, 12, 0x2}},
-    {6356945566280843511ULL, 1, {43, 51, 0x0}},
-    {6944955422330938788ULL, 1, {1, 3, 0x40}},
-    {14577919608128022166ULL, 1, {44, 58, 0x0}},
-    {4536785660751313020ULL, 3, {21, 13, 0x0}},
-    {3952992680209769981ULL, 2, {46, 54, 0x0}},
-    {9727971503483455233ULL, 1, {19, 11, 0x0}},
-    {11637746991010981505ULL, 1, {54, 61, 0x0}},
-    {3279538519127023954ULL, 5, {18, 10, 0x0}},
-    {1759454108154958090ULL, 1, {43, 51, 0x0}},
-    {5517498278492602745ULL, 1, {21, 6, 0x0}},
-    {4342413917885567123ULL, 1, {42, 57, 0x0}},
-    {3196818871982216944ULL, 1, {35, 27, 0x0}},
-    {4256888552973700056ULL, 1, {52, 42, 0x0}},
-    {10743518969449421535ULL, 1, {51, 58, 0x0}},
-    {14076723074167027940ULL, 1, {17, 9, 0x0}},
-    {12934391977925429749ULL, 1, {57, 59, 0x40}},
-    {2859227840215654479ULL, 2, {29, 2, 0x0}},
-    {3744328298212194984ULL, 1, {42, 57, 0x0}},
-    {16220995228481948069ULL, 1, {20, 12, 0x0}},
-    {3725392830567381942ULL, 1, {45, 62, 0x0}},
-    {3167216258108842344ULL, 1, {21, 13, 0x0}},
-    {17481061622390293590ULL, 1, {43, 51, 0x0}},
-    {15301545555950680705ULL, 3, {45, 62, 0x0}},
-    {858928466479824022ULL, 1, {36, 27, 0x1}},
-    {10400805827133179929ULL, 1, {28, 45, 0x1}},
-    {6460619418394365507ULL, 1, {21, 13, 0x0}},
-    {5792817998996072220ULL, 1, {34, 28, 0x0}},
-    {12886379800431348820ULL, 10, {17, 9, 0x0}},
-    {7418432720018372881ULL, 10, {49, 58, 0x0}},
-    {17761317798730265785ULL, 13, {36, 52, 0x2}},
-    {605550243213857586ULL, 2, {42, 33, 0x1}},
-    {13065428591627326893ULL, 2, {42, 51, 0x1}},
-    {68195655605713027ULL, 2, {19, 11, 0x0}},
-    {8401568749159558518ULL, 2, {43, 61, 0x0}},
-    {13549391744590295184ULL, 1, {17, 9, 0x0}},
-    {11273556764671010133ULL, 1, {45, 53, 0x0}},
-    {12031766022652374246ULL, 4, {28, 12, 0x2}},
-    {12654722711022386266ULL, 4, {28, 37, 0x1}},
-    {6871736350725988592ULL, 4, {18, 1, 0x0}},
-    {11679719024517508790ULL, 2, {43, 51, 0x0}},
-    {10331459553381165467ULL, 1, {46, 54, 0x0}},
-    {6219142053654397957ULL, 1, {21, 13, 0x0}},
-    {49523499739340863ULL, 1, {54, 61, 0x0}},
-    {661549278697845199ULL, 1, {35, 27, 0x0}},
-    {4403761404333435418ULL, 1, {53, 60, 0x0}},
-    {1268631091672386975ULL, 1, {28, 12, 0x2}},
-    {10815366673686397951ULL, 1, {43, 51, 0x0}},
-    {2242200468607670578ULL, 1, {12, 6, 0x0}},
-    {6670730662602215091ULL, 1, {52, 61, 0x0}},
-    {13792971579311590148ULL, 1, {21, 6, 0x0}},
-    {1148412694854180801ULL, 1, {36, 52, 0x2}},
-    {9271587882275132323ULL, 1, {17, 9, 0x0}},
-    {1413626396146629889ULL, 1, {27, 36, 0x1}},
-    {3534813344148321571ULL, 1, {27, 21, 0x1}},
-    {6393060314176663196ULL, 1, {37, 53, 0x2}},
-    {8348902176758671749ULL, 1, {9, 2, 0x0}},
-    {8936134001505145787ULL, 1, {51, 58, 0x0}},
-    {2036112602586856111ULL, 9, {19, 11, 0x0}},
-    {1552752966703351933ULL, 3, {37, 53, 0x2}},
-    {3611072275150588425ULL, 3, {20, 2, 0x0}},
-    {13368116288615836385ULL, 1, {46, 54, 0x0}},
-    {2967698932998918681ULL, 1, {1, 3, 0x40}},
-    {9010705165428670877ULL, 1, {54, 61, 0x0}},
-    {18258654199023794385ULL, 6, {36, 52, 0x2}},
-    {1985071777532431226ULL, 3, {9, 2, 0x0}},
-    {4408286280941886435ULL, 2, {29, 36, 0x1}},
-    {3818204582793849347ULL, 5, {17, 9, 0x0}},
-    {2587095624732631979ULL, 4, {42, 57, 0x0}},
-    {1003484777785739016ULL, 1, {28, 12, 0x2}},
-    {15647365035980378476ULL, 6, {51, 58, 0x0}},
-    {3744328298212194984ULL, 1, {45, 62, 0x0}},
-    {14083572275049291516ULL, 1, {1, 3, 0x40}},
-    {10952697430594757534ULL, 1, {47, 55, 0x0}},
-    {14913237983732065980ULL, 1, {31, 15, 0x2}},
-    {14822976440181273040ULL, 1, {42, 57, 0x0}},
-    {17289678316442885910ULL, 9, {45, 53, 0x0}},
-    {2377697397716333952ULL, 5, {12, 6, 0x0}},
-    {13611697232999170319ULL, 2, {42, 57, 0x0}},
-    {17355296761389975716ULL, 2, {19, 11, 0x0}},
-    {4164044936573681678ULL, 2, {37, 45, 0x0}},
-    {17136210561104122632ULL, 18, {1, 3, 0x40}},
-    {13923575865640161044ULL, 18, {49, 58, 0x0}},
-    {4078879476029418157ULL, 9, {21, 13, 0x0}},
-    {3536559802224465222ULL, 8, {42, 57, 0x0}},
-    {6665738033459067864ULL, 1, {44, 52, 0x0}},
-    {950135029103736088ULL, 1, {28, 12, 0x2}},
-    {6721006963003085742ULL, 1, {25, 61, 0x0}},
-    {15427448072840118952ULL, 1, {21, 6, 0x0}},
-    {16591618751264102261ULL, 1, {41, 49, 0x0}},
-    {4460831227017018309ULL, 1, {27, 11, 0x2}},
-    {6462129320683039070ULL, 1, {18, 25, 0x1}},
-    {16890211989583392808ULL, 8, {28, 4, 0x1}},
-    {8479464403566310891ULL, 4, {47, 55, 0x0}},
-    {800882841314085815ULL, 4, {29, 13, 0x2}},
-    {11076711113738808353ULL, 4, {45, 62, 0x0}},
-    {2931941168010677267ULL, 3, {25, 61, 0x0}},
-    {3706630933671860971ULL, 2, {29, 13, 0x2}},
-    {10434380230358141736ULL, 2, {45, 53, 0x0}},
-    {1909968632792283777ULL, 1, {35, 18, 0x0}},
-    {14632348881051229564ULL, 1, {32, 25, 0x0}},
-    {3037644815974198949ULL, 3, {41, 49, 0x0}},
-    {4978320699383804585ULL, 2, {28, 12, 0x2}},
-    {14844834356083480465ULL, 1, {49, 58, 0x0}},
-    {8165671717154344545ULL, 1, {27, 11, 0x2}},
-    {14408368519134467182ULL, 1, {57, 59, 0x40}},
-    {1714458505954375055ULL, 4, {42, 57, 0x0}},
-    {97357755900603218ULL, 5, {35, 51, 0x2}},
-    {12224413131823439633ULL, 5, {21, 6, 0x0}},
-    {7632094953397738153ULL, 5, {44, 52, 0x0}},
-    {17855689868310326886ULL, 5, {27, 11, 0x2}},
-    {14198307122025381492ULL, 1, {51, 58, 0x0}},
-    {3530860594165431057ULL, 1, {41, 49, 0x0}},
-    {18295344350778702024ULL, 1, {47, 55, 0x0}},
-    {16387720834556272809ULL, 1, {27, 11, 0x2}},
-    {16134951765389151292ULL, 1, {43, 51, 0x0}},
-    {16195295210446943030ULL, 1, {29, 13, 0x2}},
-    {7598522870607799602ULL, 1, {36, 52, 0x2}},
-    {919785641456212912ULL, 1, {36, 27, 0x1}},
-    {14222169435220960465ULL, 1, {36, 43, 0x1}},
-    {385174634760044217ULL, 1, {21, 6, 0x0}},
-    {13673103394040306596ULL, 1, {42, 57, 0x0}},
-    {13003266174063986401ULL, 1, {34, 50, 0x2}},
-    {2015566470739782375ULL, 1, {9, 2, 0x0}},
-    {3846853498848637681ULL, 1, {42, 57, 0x0}},
-    {2307138913022321259ULL, 1, {21, 6, 0x0}},
-    {7930296744177730525ULL, 1, {51, 58, 0x0}},
-    {115560444758234360ULL, 1, {18, 1, 0x0}},
-    {7893644188203796787ULL, 1, {57, 59, 0x40}},
-    {7727470717747927906ULL, 9, {18, 1, 0x0}},
-    {1627082392457633904ULL, 5, {57, 59, 0x40}},
-    {4804627023261683682ULL, 14, {44, 52, 0x0}},
-    {6665738033459067864ULL, 18, {45, 53, 0x0}},
-    {9028429106017927757ULL, 1, {19, 11, 0x0}},
-    {3295156943371690905ULL, 1, {36, 52, 0x2}},
-    {3680904702241539980ULL, 1, {21, 6, 0x0}},
-    {11284174284759867902ULL, 4, {41, 49, 0x0}},
-    {8427069443767115565ULL, 1, {11, 2, 0x0}},
-    {5908257543455764165ULL, 1, {49, 58, 0x0}},
-    {7504456281895907817ULL, 2, {44, 52, 0x0}},
-    {2859227840215654479ULL, 8, {21, 13, 0x0}},
-    {3886053172307272152ULL, 8, {42, 57, 0x0}},
-    {11359052761181115683ULL, 6, {11, 2, 0x0}},
-    {13555015828291031229ULL, 3, {25, 61, 0x0}},
-    {4231103127187505784ULL, 2, {1, 3, 0x40}},
-    {12806733296467991187ULL, 2, {43, 51, 0x0}},
-    {7579535807716578346ULL, 1, {44, 52, 0x0}},
-    {11460514359407261666ULL, 1, {21, 6, 0x0}},
-    {236905469139159753ULL, 1, {57, 59, 0x40}},
-    {4831661732843981970ULL, 4, {18, 1, 0x0}},
-    {5557366448656898951ULL, 1, {29, 36, 0x1}},
-    {3643562861573077371ULL, 2, {26, 10, 0x2}},
-    {15936227981166688493ULL, 2, {37, 53, 0x2}},
-    {16076012578906554498ULL, 4, {22, 14, 0x0}},
-    {1887387029694063607ULL, 3, {49, 58, 0x0}},
-    {8219435077874981154ULL, 3, {14, 5, 0x0}},
-    {2657755876041350308ULL, 1, {36, 52, 0x2}},
-    {10267711863099617736ULL, 1, {29, 13, 0x2}},
-    {17142027502159825647ULL, 1, {45, 53, 0x0}},
-    {7484879384508194744ULL, 31, {18, 1, 0x0}},
-    {8608987003803134410ULL, 46, {9, 2, 0x0}},
-    {1579516743148795256ULL, 12, {45, 62, 0x0}},
-    {12385723303618198603ULL, 1, {21, 13, 0x0}},
-    {9409728825916657066ULL, 1, {42, 57, 0x0}},
-    {7309004960025897548ULL, 1, {26, 5, 0x0}},
-    {8479195570444980746ULL, 1, {45, 53, 0x0}},
-    {11483741222968857236ULL, 1, {19, 11, 0x0}},
-    {4987309759649196530ULL, 1, {34, 61, 0x0}},
-    {11992421264978900135ULL, 1, {20, 2, 0x0}},
-    {7690522187008051288ULL, 1, {20, 34, 0x1}},
-    {4481191155974191812ULL, 15, {43, 51, 0x0}},
-    {4762152482573493221ULL, 2, {12, 6, 0x0}},
-    {4164044936573681678ULL, 1, {52, 62, 0x0}},
-    {15176067252810826357ULL, 6, {28, 37, 0x1}},
-    {16125677912596589472ULL, 4, {28, 18, 0x1}},
-    {5012081711401034708ULL, 2, {49, 58, 0x0}},
-    {15959385010588200892ULL, 1, {21, 6, 0x0}},
-    {1474266377571258710ULL, 2, {35, 28, 0x1}},
-    {13386777882781345417ULL, 2, {35, 44, 0x1}},
-    {4002273626804530579ULL, 2, {60, 4, 0x1}},
-    {12329374850386920957ULL, 2, {60, 59, 0x1}},
-    {13368116288615836385ULL, 2, {36, 52, 0x2}},
-    {2307367954850281513ULL, 1, {21, 13, 0x0}},
-    {567261592823134366ULL, 1, {45, 62, 0x0}},
-    {15278193525252374643ULL, 1, {44, 52, 0x0}},
-    {3690195118672909497ULL, 3, {36, 27, 0x1}},
-    {15724523368341727640ULL, 3, {36, 43, 0x1}},
-    {5291462465963502586ULL, 3, {18, 1, 0x0}},
-    {13396606202090000715ULL, 2, {42, 57, 0x0}},
-    {4138958925290388977ULL, 1, {33, 5, 0x0}},
-    {14927851178373049692ULL, 1, {40, 48, 0x0}},
-    {6475952180568536409ULL, 1, {41, 49, 0x0}},
-    {3782377025650532232ULL, 1, {17, 9, 0x0}},
-    {7068691384629058992ULL, 1, {45, 62, 0x0}},
-    {14667145161425173911ULL, 2, {9, 2, 0x0}},
-    {7657735767223613411ULL, 2, {21, 6, 0x0}},
-    {17761317798730265785ULL, 7, {43, 51, 0x0}},
-    {16295225101571396706ULL, 3, {27, 11, 0x2}},
-    {6002176467628409345ULL, 2, {40, 48, 0x0}},
-    {4781295671017670434ULL, 2, {42, 33, 0x1}},
-    {7487534372056117100ULL, 2, {42, 60, 0x1}},
-    {100237571413659426ULL, 1, {21, 6, 0x0}},
-    {11381350357955504225ULL, 1, {30, 58, 0x0}},
-    {6121481513974814369ULL, 2, {37, 58, 0x0}},
-    {1940781237270161209ULL, 1, {36, 4, 0x0}},
-    {15642717968967388419ULL, 1, {10, 37, 0x1}},
-    {7927473974648057776ULL, 4, {27, 11, 0x2}},
-    {15102842385850172257ULL, 4, {49, 58, 0x0}},
-    {14886941955474873389ULL, 7, {18, 1, 0x0}},
-    {6666530347622905259ULL, 7, {44, 52, 0x0}},
-    {12557464768465772210ULL, 2, {29, 13, 0x2}},
-    {3606366423567729436ULL, 1, {25, 61, 0x0}},
-    {16834804579963191393ULL, 2, {11, 2, 0x0}},
-    {13428633108021623929ULL, 2, {45, 62, 0x0}},
-    {9720808026548882503ULL, 14, {19, 5, 0x0}},
-    {16616484927163915605ULL, 6, {45, 53, 0x0}},
-    {7748692583649315031ULL, 1, {18, 1, 0x0}},
-    {6365250423035260639ULL, 1, {52, 62, 0x0}},
-    {12528487787489454684ULL, 1, {36, 52, 0x2}},
-    {1868446406993437951ULL, 1, {43, 51, 0x0}},
-    {8403970559007440406ULL, 1, {45, 38, 0x1}},
-    {2483652895203617156ULL, 1, {45, 54, 0x1}},
-    {15817931984043023074ULL, 1, {26, 10, 0x2}},
-    {18003783440831207674ULL, 1, {36, 52, 0x2}},
-    {7030747919821981677ULL, 2, {18, 1, 0x0}},
-    {17585704880308186542ULL, 6, {42, 57, 0x0}},
-    {17975516294966124570ULL, 4, {28, 12, 0x2}},
-    {9127470429296041650ULL, 4, {28, 37, 0x1}},
-    {14659149986332415082ULL, 8, {28, 18, 0x1}},
-    {749254599134020196ULL, 50, {52, 62, 0x0}},
-    {3191478979579164346ULL, 20, {28, 12, 0x2}},
-    {7072668093296210685ULL, 3, {42, 57, 0x0}},
-    {13710737241426338357ULL, 2, {21, 6, 0x0}},
-    {7005397799315745482ULL, 2, {28, 37, 0x1}},
-    {858928466479824022ULL, 2, {18, 1, 0x0}},
-    {7380097971405230941ULL, 2, {42, 57, 0x0}},
-    {4018728438201559389ULL, 2, {35, 27, 0x0}},
-    {15166664571812775448ULL, 2, {52, 42, 0x0}},
-    {5536440748729165775ULL, 12, {36, 52, 0x2}},
-    {10198375359209752128ULL, 7, {9, 2, 0x0}},
-    {2219195368029115391ULL, 4, {35, 51, 0x2}},
-    {8314746806995411380ULL, 1, {21, 13, 0x0}},
-    {2591917515717564953ULL, 1, {42, 57, 0x0}},
-    {9151149934221896231ULL, 1, {28, 12, 0x2}},
-    {6361401850376070727ULL, 1, {27, 35, 0x0}},
-    {10063191438050824045ULL, 1, {33, 5, 0x0}},
-    {14697636540982072933ULL, 1, {52, 62, 0x0}},
-    {3950652040008493277ULL, 5, {26, 35, 0x1}},
-    {13680638196083069633ULL, 2, {18, 1, 0x0}},
-    {505234611596610632ULL, 1, {33, 49, 0x2}},
-    {528800069085439848ULL, 1, {29, 2, 0x0}},
-    {507879134194112219ULL, 1, {49, 58, 0x0}},
-    {4266133425356937549ULL, 1, {28, 12, 0x2}},
-    {5828343441854373965ULL, 1, {44, 52, 0x0}},
-    {17190097366240346434ULL, 17, {36, 29, 0x1}},
-    {14222378995784290494ULL, 7, {36, 43, 0x1}},
-    {12119748102978060678ULL, 49, {43, 51, 0x0}},
-    {14143150030531999970ULL, 7, {22, 4, 0x0}},
-    {9866328628075937741ULL, 2, {39, 55, 0x2}},
-    {17635026690004585557ULL, 2, {21, 6, 0x0}},
-    {5617810014797473686ULL, 3, {42, 57, 0x0}},
-    {14261056271690753593ULL, 1, {18, 1, 0x0}},
-    {9566539845835681766ULL, 2, {30, 58, 0x0}},
-    {9003258572621751899ULL, 2, {22, 4, 0x0}},
-    {14738180685062386979ULL, 2, {51, 60, 0x0}},
-    {7027421162547560469ULL, 6, {19, 11, 0x0}},
-    {4094399477551906857ULL, 5, {42, 57, 0x0}},
-    {8652740999533214637ULL, 3, {21, 6, 0x0}},
-    {12331730809702144593ULL, 1, {12, 5, 0x0}},
-    {9001587623109235175ULL, 1, {52, 62, 0x0}},
-    {6210545000529033810ULL, 15, {16, 8, 0x0}},
-    {3491502442880202193ULL, 14, {57, 59, 0x40}},
-    {3643562861573077371ULL, 9, {20, 2, 0x0}},
-    {6909972647279467544ULL, 9, {37, 53, 0x2}},
-    {5072961277340380631ULL, 24, {36, 52, 0x2}},
-    {11861434908048214061ULL, 24, {36, 27, 0x1}},
-    {3709447702243419339ULL, 21, {36, 60, 0x1}},
-    {4421049698786829563ULL, 20, {21, 6, 0x0}},
-    {1470267459755539660ULL, 14, {44, 36, 0x0}},
-    {2412718457320762017ULL, 13, {28, 12, 0x2}},
-    {6904871901544991906ULL, 1, {45, 53, 0x0}},
-    {8243767295012507784ULL, 1, {18, 1, 0x0}},
-    {9839418138689436173ULL, 1, {25, 61, 0x0}},
-    {15959385010588200892ULL, 1, {19, 5, 0x0}},
-    {10097232864235156991ULL, 1, {42, 57, 0x0}},
-    {12385723303618198603ULL, 12, {26, 5, 0x0}},
-    {1866326805214807779ULL, 4, {42, 57, 0x0}},
-    {18227398382931378351ULL, 4, {19, 11, 0x0}},
-    {17313780895394783879ULL, 5, {37, 53, 0x2}},
-    {8938242349718636745ULL, 1, {21, 6, 0x0}},
-    {10428603308154157834ULL, 1, {28, 37, 0x1}},
-    {16820036440816881490ULL, 1, {28, 19, 0x1}},
-    {3185008070414531576ULL, 1, {47, 55, 0x0}},
-    {2170996588730705085ULL, 15, {45, 62, 0x0}},
-    {8777988894073005794ULL, 1, {19, 11, 0x0}},
-    {2719467177570820237ULL, 1, {41, 49, 0x0}},
-    {16092962842642909823ULL, 1, {28, 12, 0x2}},
-    {2923740835950709053ULL, 1, {44, 52, 0x0}},
-    {2428708951008651551ULL, 1, {18, 1, 0x0}},
-    {9568627263453093670ULL, 1, {49, 58, 0x0}},
-    {14210563145996024942ULL, 5, {21, 6, 0x0}},
-    {3866080351849020521ULL, 4, {36, 52, 0x2}},
-    {3466013003869596279ULL, 2, {36, 29, 0x1}},
-    {4136386675948814492ULL, 6, {36, 45, 0x1}},
-    {7701453733410039243ULL, 8, {26, 5, 0x0}},
-    {4475667876256774178ULL, 6, {45, 62, 0x0}},
-    {8479464403566310891ULL, 4, {45, 62, 0x0}},
-    {106046548944541306ULL, 4, {38, 2, 0x0}},
-    {8199754194772814436ULL, 3, {52, 61, 0x0}},
-    {7504456281895907817ULL, 12, {53, 60, 0x0}},
-    {3706630933671860971ULL, 1, {20, 12, 0x0}},
-    {16607011228818266249ULL, 1, {52, 62, 0x0}},
-    {3884314137641379252ULL, 1, {12, 6, 0x0}},
-    {15291033815252050139ULL, 1, {35, 51, 0x2}},
-    {9279904601962351389ULL, 3, {41, 49, 0x0}},
-    {14166941894700718919ULL, 2, {26, 10, 0x2}},
-    {9349488048243500653ULL, 2, {49, 58, 0x0}},
-    {16636284789862403867ULL, 2, {18, 1, 0x0}},
-    {3842513751841813357ULL, 1, {47, 55, 0x0}},
-    {18105542617842407789ULL, 1, {17, 9, 0x0}},
-    {5811751137337086653ULL, 1, {45, 62, 0x0}},
-    {4078879476029418157ULL, 1, {45, 38, 0x1}},
-    {4226166395749929724ULL, 1, {45, 52, 0x1}},
-    {4687596134951815932ULL, 1, {45, 28, 0x1}},
-    {12281488578048362893ULL, 1, {45, 54, 0x1}},
-    {3279538519127023954ULL, 32, {36, 27, 0x1}},
-    {7881001148496703780ULL, 32, {36, 45, 0x1}},
-    {2769349522364596657ULL, 12, {29, 13, 0x2}},
-    {11800671333116129597ULL, 12, {42, 57, 0x0}},
-    {8682102834439549420ULL, 21, {21, 6, 0x0}},
-    {974579608276137956ULL, 11, {45, 62, 0x0}},
-    {12104179740467917825ULL, 3, {30, 58, 0x0}},
-    {6841954008926061468ULL, 7, {43, 51, 0x0}},
-    {14994908378016895015ULL, 3, {29, 13, 0x2}},
-    {8328677879379439582ULL, 1, {42, 57, 0x0}},
-    {7973501314323608374ULL, 11, {29, 36, 0x1}},
-    {3196136884870062599ULL, 11, {31, 4, 0x0}},
-    {12827406069961229111ULL, 7, {52, 62, 0x0}},
-    {3290796852604307161ULL, 2, {28, 37, 0x1}},
-    {1909968632792283777ULL, 1, {36, 29, 0x1}},
-    {16819215092143981720ULL, 1, {18, 25, 0x1}},
-    {9804492220063593050ULL, 5, {39, 30, 0x0}},
-    {14066936134873869619ULL, 8, {33, 5, 0x0}},
-    {5046030979849798653ULL, 11, {27, 42, 0x0}},
-    {12557464768465772210ULL, 6, {29, 2, 0x0}},
-    {9994094141098002072ULL, 4, {43, 51, 0x0}},
-    {15988508608179915173ULL, 2, {22, 29, 0x0}},
-    {2266145346668704161ULL, 2, {51, 57, 0x0}},
-    {16764546303442426248ULL, 9, {18, 1, 0x0}},
-    {15871311355326417738ULL, 3, {34, 50, 0x2}},
-    {15466321103651634401ULL, 1, {36, 28, 0x0}},
-    {14581970808641791994ULL, 1, {44, 58, 0x0}},
-    {13246440738786193900ULL, 1, {43, 36, 0x1}},
-    {6984518816488383184ULL, 1, {43, 52, 0x1}},
-    {17238399497057935238ULL, 1, {27, 11, 0x2}},
-    {3164809494600564886ULL, 1, {27, 34, 0x1}},
-    {14417823256763608663ULL, 5, {17, 9, 0x0}},
-    {12927324252494665270ULL, 5, {45, 53, 0x0}},
-    {8470066044995744290ULL, 2, {28, 12, 0x2}},
-    {16839738908512949538ULL, 2, {28, 35, 0x1}},
-    {11106906716939014875ULL, 2, {28, 4, 0x1}},
-    {3632202504220565208ULL, 1, {36, 52, 0x2}},
-    {16764546303442426248ULL, 1, {26, 5, 0x0}},
-    {17915143023483086329ULL, 1, {42, 57, 0x0}},
-    {12624302281362513461ULL, 3, {19, 11, 0x0}},
-    {4369314115388502255ULL, 2, {46, 54, 0x0}},
-    {7890919460067679784ULL, 1, {18, 1, 0x0}},
-    {1914918688758184670ULL, 3, {54, 61, 0x0}},
-    {7151533816882094737ULL, 2, {20, 2, 0x0}},
-    {2894679736730455882ULL, 2, {51, 58, 0x0}},
-    {8581667194222942950ULL, 26, {33, 5, 0x0}},
-    {1663832166159008451ULL, 18, {27, 36, 0x1}},
-    {7422060213042019910ULL, 18, {27, 21, 0x1}},
-    {16264027291797640511ULL, 9, {51, 58, 0x0}},
-    {9335905268941726859ULL, 1, {41, 49, 0x0}},
-    {3340141460419567022ULL, 22, {37, 53, 0x2}},
-    {18124417442460565296ULL, 12, {36, 28, 0x0}},
-    {18084995140901047081ULL, 12, {36, 43, 0x1}},
-    {7200547854315650862ULL, 13, {36, 29, 0x1}},
-    {13627577292328807427ULL, 9, {44, 52, 0x0}},
-    {5171627440783890126ULL, 5, {43, 51, 0x0}},
-    {10779614103892708249ULL, 8, {29, 13, 0x2}},
-    {14967932910556530892ULL, 1, {45, 53, 0x0}},
-    {2377697397716333952ULL, 6, {19, 11, 0x0}},
-    {7890823158783700341ULL, 3, {44, 58, 0x0}},
-    {11986922613219215399ULL, 2, {20, 2, 0x0}},
-    {9867796225464216286ULL, 1, {34, 50, 0x2}},
-    {3279538519127023954ULL, 24, {12, 6, 0x0}},
-    {15093700431420768837ULL, 24, {27, 36, 0x1}},
-    {3400429104195651552ULL, 24, {27, 12, 0x1}},
-    {18295344350778702024ULL, 4, {37, 53, 0x2}},
-    {3568581767632938472ULL, 1, {21, 13, 0x0}},
-    {14496368617218115988ULL, 1, {42, 57, 0x0}},
-    {4172513772854032499ULL, 1, {18, 1, 0x0}},
-    {5829757181024350118ULL, 1, {36, 52, 0x2}},
-    {16367538768560379927ULL, 1, {26, 5, 0x0}},
-    {2709471811406604004ULL, 1, {45, 62, 0x0}},
-    {7042899123922595835ULL, 1, {19, 11, 0x0}},
-    {857280651899350990ULL, 2, {46, 60, 0x0}},
-    {9514755543312572244ULL, 4, {29, 13, 0x2}},
-    {869759129724362111ULL, 3, {49, 58, 0x0}},
-    {17094807668047066791ULL, 3, {28, 12, 0x2}},
-    {4948679547013045421ULL, 2, {28, 37, 0x1}},
-    {13228923320843567014ULL, 3, {28, 18, 0x1}},
-    {10681212387779320195ULL, 3, {45, 62, 0x0}},
-    {2893989887187591113ULL, 104, {27, 11, 0x2}},
-    {10108691043913349969ULL, 104, {21, 36, 0x1}},
-    {16286724957976613671ULL, 4, {44, 58, 0x0}},
-    {8609301101699196205ULL, 1, {28, 12, 0x2}},
-    {14026909596115215971ULL, 1, {28, 35, 0x1}},
-    {672891751845276267ULL, 2, {22, 29, 0x0}},
-    {9459438636499422140ULL, 2, {44, 52, 0x0}},
-    {7970692074950612299ULL, 9, {19, 11, 0x0}},
-    {17905593382394388158ULL, 1, {37, 53, 0x2}},
-    {5020138937822598730ULL, 1, {29, 2, 0x1}},
-    {6791526722481098964ULL, 1, {43, 51, 0x0}},
-    {960520148007230521ULL, 1, {18, 1, 0x0}},
-    {15646350575703943441ULL, 1, {42, 57, 0x0}},
-    {3957430868384523950ULL, 9, {43, 51, 0x0}},
-    {5536440748729165775ULL, 4, {42, 57, 0x0}},
-    {267050811498992697ULL, 1, {18, 1, 0x0}},
-    {7167454292758700144ULL, 5, {38, 54, 0x2}},
-    {18097649239267738950ULL, 4, {9, 2, 0x0}},
-    {14655298396420834627ULL, 4, {54, 61, 0x0}},
-    {1036574346454279426ULL, 1, {1, 3, 0x40}},
-    {10604510914748698550ULL, 1, {43, 51, 0x0}},
-    {15149015201653982224ULL, 1, {20, 12, 0x0}},
-    {7747084087736085174ULL, 1, {44, 52, 0x0}},
-    {3343666456905200021ULL, 5, {18, 1, 0x0}},
-    {6720658469582997910ULL, 18, {25, 61, 0x0}},
-    {121128135302914303ULL, 18, {9, 2, 0x0}},
-    {12772366688609568166ULL, 5, {52, 62, 0x0}},
-    {16124679052965644032ULL, 1, {28, 12, 0x2}},
-    {13833902189638692957ULL, 1, {43, 51, 0x0}},
-    {15697529732397744343ULL, 1, {1, 3, 0x40}},
-    {8430424817324327995ULL, 1, {42, 57, 0x0}},
-    {13792971579311590148ULL, 6, {20, 12, 0x0}},
-    {3448846763706090934ULL, 5, {36, 52, 0x2}},
-    {14203952494545290658ULL, 4, {12, 6, 0x0}},
-    {9527671046628839996ULL, 4, {42, 57, 0x0}},
-    {5661518234690268547ULL, 4, {18, 1, 0x0}},
-    {14928208149731698549ULL, 1, {46, 54, 0x0}},
-    {15169343070567365225ULL, 1, {21, 13, 0x0}},
-    {9427672685962674790ULL, 1, {51, 58, 0x0}},
-    {6475952180568536409ULL, 30, {45, 62, 0x0}},
-    {3980838960065995378ULL, 3, {41, 49, 0x0}},
-    {15188450156989899068ULL, 4, {27, 11, 0x2}},
-    {8261788701150145605ULL, 2, {42, 57, 0x0}},
-    {1470267459755539660ULL, 6, {39, 36, 0x0}},
-    {624465518644386062ULL, 5, {28, 12, 0x2}},
-    {4394942307833677123ULL, 4, {42, 57, 0x0}},
-    {4747103221187686127ULL, 3, {18, 1, 0x0}},
-    {10927591739302886766ULL, 3, {45, 53, 0x0}},
-    {14261056271690753593ULL, 2, {13, 4, 0x0}},
-    {12385964245234870348ULL, 1, {51, 58, 0x0}},
-    {16276695824839541126ULL, 1, {18, 1, 0x0}},
-    {304209884733681000ULL, 1, {57, 59, 0x40}},
-    {6336426424493360561ULL, 5, {21, 6, 0x0}},
-    {4464733142327551964ULL, 5, {43, 51, 0x0}},
-    {14280573367926136120ULL, 5, {25, 9, 0x2}},
-    {5959230123311104082ULL, 5, {41, 34, 0x0}},
-    {18295344350778702024ULL, 2, {45, 62, 0x0}},
-    {1253955909588988649ULL, 2, {18, 1, 0x0}},
-    {8474826304192585091ULL, 2, {36, 52, 0x2}},
-    {1137187048104417131ULL, 1, {17, 9, 0x0}},
-    {5022897622865659534ULL, 1, {34, 61, 0x0}},
-    {2161924089453353437ULL, 1, {9, 2, 0x0}},
-    {2717384055191503525ULL, 1, {43, 51, 0x0}},
-    {4968300091572422469ULL, 1, {1, 3, 0x40}},
-    {13120146567935649473ULL, 1, {44, 58, 0x0}},
-    {15785635894244981277ULL, 1, {43, 51, 0x0}},
-    {3298527352984539554ULL, 1, {12, 4, 0x0}},
-    {11687213399843804468ULL, 1, {47, 55, 0x0}},
-    {13162821910944742601ULL, 1, {36, 29, 0x1}},
-    {106178352613734151ULL, 1, {36, 45, 0x1}},
-    {2036112602586856111ULL, 5, {33, 5, 0x0}},
-    {7820819144862538687ULL, 1, {36, 52, 0x2}},
-    {14888651743065779626ULL, 1, {21, 13, 0x0}},
-    {8273296047454106617ULL, 1, {40, 48, 0x0}},
-    {6807431033563129170ULL, 1, {24, 33, 0x0}},
-    {6504415798097342120ULL, 1, {51, 58, 0x0}},
-    {2082559453057686086ULL, 10, {44, 52, 0x0}},
-    {11214941578300297656ULL, 3, {21, 13, 0x0}},
-    {16166384984392802666ULL, 1, {36, 52, 0x2}},
-    {7599175378575683309ULL, 1, {26, 5, 0x0}},
-    {8479195570444980746ULL, 1, {34, 61, 0x0}},
-    {1833083610020604137ULL, 1, {19, 11, 0x0}},
-    {5546885415263509404ULL, 1, {43, 51, 0x0}},
-    {785780347201247457ULL, 1, {20, 2, 0x0}},
-    {11451299326710824824ULL, 1, {20, 34, 0x1}},
-    {17188657718858330447ULL, 1, {30, 14, 0x2}},
-    {5920345288413399044ULL, 1, {30, 37, 0x1}},
-    {14971796506751276884ULL, 1, {23, 15, 0x0}},
-    {4741353724612649763ULL, 1, {23, 30, 0x1}},
-    {3806967840195003067ULL, 1, {18, 1, 0x0}},
-    {5305173457097937315ULL, 1, {44, 52, 0x0}},
-    {8548383210840383514ULL, 1, {28, 12, 0x2}},
-    {5436452453872596321ULL, 1, {42, 57, 0x0}},
-    {9028429106017927757ULL, 8, {28, 12, 0x2}},
-    {2340727807478951554ULL, 7, {36, 52, 0x2}},
-    {15172674956200401904ULL, 6, {21, 6, 0x0}},
-    {5987116548675183042ULL, 6, {17, 9, 0x0}},
-    {39708040608214743ULL, 5, {29, 36, 0x1}},
-    {12213484500741002131ULL, 6, {46, 54, 0x0}},
-    {568641686053123874ULL, 2, {23, 15, 0x0}},
-    {9721996433120500896ULL, 2, {54, 61, 0x0}},
-    {10882245471034770558ULL, 2, {21, 6, 0x0}},
-    {7982469204463321955ULL, 1, {34, 50, 0x2}},
-    {2242403002665599670ULL, 1, {36, 28, 0x0}},
-    {5372682389148413984ULL, 1, {42, 57, 0x0}},
-    {6627323009912906888ULL, 2, {41, 49, 0x0}},
-    {3714368962528749510ULL, 2, {28, 12, 0x2}},
-    {7322654540511995377ULL, 2, {28, 37, 0x1}},
-    {3432668878026588473ULL, 2, {28, 21, 0x1}},
-    {13503268914470119261ULL, 2, {36, 52, 0x2}},
-    {5916316915344667034ULL, 1, {21, 6, 0x0}},
-    {14260321492544579168ULL, 1, {27, 36, 0x1}},
-    {5323941034666326580ULL, 2, {51, 57, 0x0}},
-    {17236358238867494427ULL, 1, {13, 4, 0x0}},
-    {9936666770913411379ULL, 1, {36, 52, 0x2}},
-    {12827528685899115972ULL, 3, {52, 62, 0x0}},
-    {16107828652757440362ULL, 2, {18, 1, 0x0}},
-    {5523003778063322324ULL, 2, {35, 51, 0x2}},
-    {2486675102585868444ULL, 3, {29, 2, 0x0}},
-    {16228966911907385688ULL, 4, {37, 53, 0x2}},
-    {9049309867220224155ULL, 4, {36, 28, 0x0}},
-    {13034166716182122047ULL, 58, {1, 3, 0x40}},
-    {7290140086683723472ULL, 56, {42, 57, 0x0}},
-    {11990030813302913792ULL, 2, {28, 12, 0x2}},
-    {17032071001735553489ULL, 1, {28, 35, 0x1}},
-    {10279891813135870892ULL, 15, {54, 61, 0x0}},
-    {6852069104017634040ULL, 14, {23, 15, 0x0}},
-    {18346640659412894586ULL, 27, {36, 52, 0x2}},
-    {777990396790851720ULL, 4, {41, 49, 0x0}},
-    {6426866533607652819ULL, 9, {21, 6, 0x0}},
-    {791381626753548550ULL, 8, {49, 58, 0x0}},
-    {2502997548444194087ULL, 1, {33, 5, 0x0}},
-    {8226991939579228103ULL, 1, {52, 62, 0x0}},
-    {2747418619995667084ULL, 1, {12, 4, 0x0}},
-    {4205261359251849504ULL, 1, {37, 53, 0x2}},
-    {2346112283035786720ULL, 3, {45, 62, 0x0}},
-    {9279904601962351389ULL, 8, {43, 51, 0x0}},
-    {7531827262477569249ULL, 2, {11, 1, 0x0}},
-    {5415374067267434735ULL, 1, {45, 62, 0x0}},
-    {195601555188867222ULL, 1, {28, 12, 0x2}},
-    {6547478190137428781ULL, 1, {28, 37, 0x1}},
-    {7821964313780039558ULL, 1, {28, 11, 0x1}},
-    {15703377938568828405ULL, 5, {45, 53, 0x0}},
-    {14814780719070473262ULL, 7, {29, 13, 0x2}},
-    {17002836538408447309ULL, 1, {29, 36, 0x1}},
-    {17421263965940890947ULL, 1, {19, 11, 0x0}},
-    {9823415812269941089ULL, 1, {43, 61, 0x0}},
-    {1030158606143655393ULL, 1, {31, 15, 0x2}},
-    {7924001067853808315ULL, 1, {47, 62, 0x0}},
-    {8938242349718636745ULL, 3, {21, 13, 0x0}},
-    {16215180617916230381ULL, 4, {45, 62, 0x0}},
-    {1684054587875387468ULL, 6, {12, 6, 0x0}},
-    {10822695363883662631ULL, 1, {25, 61, 0x0}},
-    {17757592753060749438ULL, 11, {36, 52, 0x2}},
-    {7041538582330705298ULL, 5, {36, 29, 0x1}},
-    {1314835731158487594ULL, 3, {18, 1, 0x0}},
-    {42473966088310528ULL, 2, {42, 57, 0x0}},
-    {13792971579311590148ULL, 4, {22, 14, 0x0}},
-    {17919781982015556637ULL, 4, {36, 52, 0x2}},
-    {11831913236398254565ULL, 4, {14, 5, 0x0}},
-    {3133931215092272447ULL, 1, {42, 57, 0x0}},
-    {2244976116532642201ULL, 1, {35, 27, 0x0}},
-    {6785647171258253619ULL, 1, {52, 42, 0x0}},
-    {1238287990873259640ULL, 1, {25, 4, 0x0}},
-    {5501489766183225896ULL, 1, {37, 53, 0x2}},
-    {14079786836315397439ULL, 14, {35, 51, 0x2}},
-    {1831608642613968858ULL, 13, {38, 28, 0x0}},
-    {1153511603875617215ULL, 12, {44, 52, 0x0}},
-    {16232682458722154997ULL, 1, {45, 62, 0x0}},
-    {17061177227525189947ULL, 1, {18, 1, 0x0}},
-    {14420659286376746430ULL, 1, {41, 49, 0x0}},
-    {4366402340776446994ULL, 1, {38, 2, 0x0}},
-    {11253518479063074997ULL, 1, {49, 58, 0x0}},
-    {7796665384395374801ULL, 1, {45, 38, 0x1}},
-    {17090941165623980138ULL, 1, {45, 54, 0x1}},
-    {14066936134873869619ULL, 8, {26, 5, 0x0}},
-    {2879564391707395409ULL, 8, {57, 59, 0x40}},
-    {11643672303704649343ULL, 6, {21, 13, 0x0}},
-    {15286775276627142884ULL, 6, {47, 55, 0x0}},
-    {15301545555950680705ULL, 6, {51, 58, 0x0}},
-    {3274043524460057271ULL, 2, {20, 2, 0x0}},
-    {15575963703591521702ULL, 2, {37, 53, 0x2}},
-    {9119075696001752425ULL, 2, {37, 28, 0x1}},
-    {8269788037623665106ULL, 2, {42, 57, 0x0}},
-    {17986255588715308102ULL, 5, {45, 53, 0x0}},
-    {15172674956200401904ULL, 1, {36, 29, 0x1}},
-    {4220449201395613495ULL, 30, {29, 13, 0x2}},
-    {18224467871734260357ULL, 9, {28, 36, 0x0}},
-    {3099917265084810194ULL, 3, {17, 9, 0x0}},
-    {12196434452444976124ULL, 2, {45, 62, 0x0}},
-    {9955457206893660079ULL, 2, {9, 2, 0x0}},
-    {4283152699752375935ULL, 2, {35, 51, 0x2}},
-    {7246458098420752933ULL, 1, {1, 3, 0x40}},
-    {15126395351075533218ULL, 1, {42, 57, 0x0}},
-    {6336426424493360561ULL, 6, {19, 5, 0x0}},
-    {49144678776494453ULL, 6, {43, 51, 0x0}},
-    {16122832041531010768ULL, 6, {12, 6, 0x0}},
-    {14074109456005363013ULL, 6, {52, 62, 0x0}},
-    {12432952356401683391ULL, 5, {36, 52, 0x2}},
-    {10232516574562256036ULL, 3, {43, 51, 0x0}},
-    {265221686384261250ULL, 9, {36, 52, 0x2}},
-    {8580484781380780869ULL, 9, {22, 29, 0x0}},
-    {16480701036339587402ULL, 2, {44, 58, 0x0}},
-    {1915407437674664021ULL, 5, {36, 27, 0x1}},
-    {12937267620201480720ULL, 5, {36, 43, 0x1}},
-    {13575927363730178196ULL, 5, {20, 2, 0x0}},
-    {15512160511713008513ULL, 1, {45, 53, 0x0}},
-    {9028429106017927757ULL, 8, {21, 6, 0x0}},
-    {738481242783714990ULL, 8, {36, 52, 0x2}},
-    {429595594317509877ULL, 5, {19, 11, 0x0}},
-    {11284174284759867902ULL, 9, {43, 51, 0x0}},
-    {17478679850864923970ULL, 7, {22, 14, 0x0}},
-    {3788825767152871394ULL, 3, {44, 58, 0x0}},
-    {12213484500741002131ULL, 4, {36, 52, 0x2}},
-    {5479084942456757243ULL, 5, {21, 6, 0x0}},
-    {1314835731158487594ULL, 1, {36, 29, 0x1}},
-    {15235974220639487864ULL, 1, {36, 43, 0x1}},
-    {5968094954592620232ULL, 1, {18, 1, 0x0}},
-    {1691396523111645273ULL, 1, {42, 57, 0x0}},
-    {15178710260014237150ULL, 5, {27, 11, 0x2}},
-    {1754985336426992241ULL, 5, {35, 51, 0x2}},
-    {4048679037753860083ULL, 1, {18, 1, 0x0}},
-    {1015942802288761523ULL, 1, {49, 58, 0x0}},
-    {951915624010270226ULL, 1, {28, 12, 0x2}},
-    {926315938177233362ULL, 2, {28, 35, 0x1}},
-    {10048144260725207770ULL, 2, {28, 18, 0x1}},
-    {4599915986949443236ULL, 2, {45, 62, 0x0}},
-    {4940966313009054159ULL, 12, {52, 62, 0x0}},
-    {14731085233408838516ULL, 5, {18, 1, 0x0}},
-    {7796805321234337857ULL, 4, {42, 57, 0x0}},
-    {1579516743148795256ULL, 20, {47, 55, 0x0}},
-    {16616484927163915605ULL, 3, {49, 58, 0x0}},
-    {4819542130482775027ULL, 3, {12, 4, 0x0}},
-    {12528464915675379864ULL, 2, {45, 53, 0x0}},
-    {12497160100107022887ULL, 4, {19, 11, 0x0}},
-    {17802624275651125141ULL, 4, {47, 55, 0x0}},
-    {14079786836315397439ULL, 8, {43, 51, 0x0}},
-    {7959766696922578202ULL, 9, {57, 59, 0x40}},
-    {14260802478759173411ULL, 7, {23, 15, 0x0}},
-    {8122679314503360853ULL, 7, {51, 30, 0x0}},
-    {6279419389070596696ULL, 5, {36, 52, 0x2}},
-    {14939675871350705947ULL, 5, {36, 29, 0x1}},
-    {12653617222608463422ULL, 5, {36, 42, 0x1}},
-    {16269742679473054840ULL, 2, {27, 11, 0x2}},
-    {11487168293450738346ULL, 2, {21, 36, 0x1}},
-    {10718471270559768394ULL, 2, {21, 14, 0x1}},
-    {383586812108119352ULL, 2, {41, 49, 0x0}},
-    {16584525557971222757ULL, 1, {27, 21, 0x1}},
-    {2488309896203338203ULL, 1, {27, 36, 0x1}},
-    {18313940594820593511ULL, 3, {45, 54, 0x1}},
-    {2775107915265966558ULL, 7, {37, 53, 0x2}},
-    {993910358365762845ULL, 6, {17, 9, 0x0}},
-    {2090097753326651100ULL, 19, {46, 54, 0x0}},
-    {2060468183472242728ULL, 17, {9, 2, 0x0}},
-    {9536713344732016770ULL, 17, {54, 61, 0x0}},
-    {2134500069948893010ULL, 3, {36, 27, 0x1}},
-    {3595488457908497284ULL, 3, {36, 60, 0x1}},
-    {16736625676928893282ULL, 3, {45, 53, 0x0}},
-    {14967932910556530892ULL, 3, {47, 55, 0x0}},
-    {1297921238066023508ULL, 5, {36, 29, 0x1}},
-    {18149191074949721952ULL, 5, {36, 43, 0x1}},
-    {13646887350657066253ULL, 4, {21, 6, 0x0}},
-    {5253188121204829967ULL, 2, {45, 53, 0x0}},
-    {4612158134553866464ULL, 1, {12, 30, 0x1}},
-    {17133496805546514110ULL, 1, {46, 54, 0x0}},
-    {11957554872739730731ULL, 9, {42, 57, 0x0}},
-    {1321407202641433633ULL, 9, {35, 27, 0x0}},
-    {8087794956009074420ULL, 9, {36, 42, 0x0}},
-    {10694357595669269835ULL, 9, {29, 2, 0x1}},
-    {6816682352644042484ULL, 9, {46, 36, 0x0}},
-    {12213484500741002131ULL, 8, {30, 58, 0x0}},
-    {7418201644531709246ULL, 4, {12, 5, 0x0}},
-    {14887904878691151812ULL, 2, {12, 30, 0x1}},
-    {17970138625296563989ULL, 2, {12, 4, 0x1}},
-    {17579846004372916489ULL, 1, {36, 52, 0x2}},
-    {971863090360397094ULL, 1, {21, 6, 0x0}},
-    {12414491915221784615ULL, 1, {42, 57, 0x0}},
-    {17192387111477417047ULL, 4, {20, 12, 0x0}},
-    {9500683017187650434ULL, 4, {42, 27, 0x0}},
-    {7637180607189499230ULL, 1, {37, 53, 0x2}},
-    {9226515466203221386ULL, 1, {17, 9, 0x0}},
-    {2337981651334467430ULL, 1, {28, 37, 0x1}},
-    {12083204878059596747ULL, 1, {28, 18, 0x1}},
-    {13033287008855191663ULL, 1, {36, 52, 0x2}},
-    {840766407050404543ULL, 11, {44, 52, 0x0}},
-    {4043274517640586716ULL, 10, {1, 3, 0x40}},
-    {11617035303467855949ULL, 10, {52, 61, 0x0}},
-    {993820064801540863ULL, 8, {3, 2, 0x0}},
-    {8969677330936906768ULL, 7, {42, 57, 0x0}},
-    {4762152482573493221ULL, 7, {20, 2, 0x0}},
-    {3504989790267432984ULL, 6, {52, 62, 0x0}},
-    {17442651412078622752ULL, 4, {54, 47, 0x0}},
-    {5943300442968134893ULL, 5, {42, 57, 0x0}},
-    {14242328808468415170ULL, 5, {21, 6, 0x0}},
-    {16178996912685084332ULL, 5, {28, 37, 0x1}},
-    {8470066044995744290ULL, 2, {18, 1, 0x0}},
-    {4559642504691816999ULL, 2, {27, 35, 0x0}},
-    {3468713065199436170ULL, 2, {28, 18, 0x0}},
-    {7097918641097378592ULL, 2, {46, 60, 0x0}},
-    {8449531528916247117ULL, 4, {30, 58, 0x0}},
-    {2436054827271930815ULL, 1, {36, 52, 0x2}},
-    {7766198405019522011ULL, 1, {19, 11, 0x0}},
-    {3803424649586861865ULL, 1, {34, 61, 0x0}},
-    {14943436764319225315ULL, 1, {25, 9, 0x2}},
-    {13891379262746357672ULL, 1, {35, 51, 0x2}},
-    {7072668093296210685ULL, 16, {28, 37, 0x1}},
-    {17482927045218093447ULL, 16, {28, 4, 0x1}},
-    {10741150533465332926ULL, 16, {47, 55, 0x0}},
-    {13034166716182122047ULL, 4, {21, 6, 0x0}},
-    {13178887867777009004ULL, 4, {42, 57, 0x0}},
-    {16795235038764463928ULL, 5, {20, 12, 0x0}},
-    {15767550864983308635ULL, 8, {44, 52, 0x0}},
-    {10769085544516845782ULL, 4, {36, 29, 0x1}},
-    {3191478979579164346ULL, 14, {1, 3, 0x40}},
-    {15931350434151818069ULL, 12, {47, 55, 0x0}},
-    {13049153587140103062ULL, 12, {20, 38, 0x0}},
-    {8991143333196672608ULL, 11, {42, 57, 0x0}},
-    {18258654199023794385ULL, 10, {45, 53, 0x0}},
-    {240565485146935938ULL, 15, {9, 2, 0x0}},
-    {17292134458140428200ULL, 15, {36, 52, 0x2}},
-    {6720658469582997910ULL, 5, {37, 53, 0x2}},
-    {3879444309163250034ULL, 1, {29, 13, 0x2}},
-    {12419643208187879390ULL, 1, {28, 36, 0x0}},
-    {128809315150337675ULL, 1, {19, 11, 0x0}},
-    {11857167452676648359ULL, 2, {45, 62, 0x0}},
-    {8069010056364992398ULL, 2, {28, 19, 0x1}},
-    {2295514213077824672ULL, 2, {28, 37, 0x1}},
-    {2870234735003405743ULL, 14, {29, 36, 0x1}},
-    {10599662912583544571ULL, 12, {18, 1, 0x0}},
-    {1579516743148795256ULL, 2, {52, 61, 0x0}},
-    {14878020546722721943ULL, 7, {28, 12, 0x2}},
-    {9351802580645735486ULL, 6, {36, 52, 0x2}},
-    {4429722800411233674ULL, 6, {43, 51, 0x0}},
-    {7233843201462449933ULL, 4, {27, 11, 0x2}},
-    {1867286230845612828ULL, 1, {36, 52, 0x2}},
-    {13466166913599912300ULL, 1, {36, 29, 0x1}},
-    {1390745537506924673ULL, 1, {36, 43, 0x1}},
-    {2843498529103349471ULL, 13, {44, 52, 0x0}},
-    {6742497247546110933ULL, 6, {33, 5, 0x0}},
-    {8100970276233269951ULL, 6, {30, 58, 0x0}},
-    {16533565529167163212ULL, 2, {21, 6, 0x0}},
-    {11471909942384048753ULL, 18, {18, 1, 0x0}},
-    {16100126992278844633ULL, 14, {43, 51, 0x0}},
-    {5704785486228255402ULL, 2, {47, 55, 0x0}},
-    {16826712543225336292ULL, 2, {22, 14, 0x0}},
-    {7142653815926515671ULL, 2, {37, 53, 0x2}},
-    {9720808026548882503ULL, 2, {26, 5, 0x0}},
-    {1813153526873961858ULL, 2, {45, 53, 0x0}},
-    {279475978515729115ULL, 1, {18, 1, 0x0}},
-    {8731431306718687948ULL, 1, {49, 58, 0x0}},
-    {6005901262839606125ULL, 2, {29, 36, 0x1}},
-    {5352034229397960676ULL, 7, {35, 27, 0x0}},
-    {4801615591348666253ULL, 7, {28, 36, 0x0}},
-    {12301135315750417779ULL, 7, {42, 35, 0x1}},
-    {4429203668650472249ULL, 7, {21, 28, 0x1}},
-    {4090227221675244617ULL, 14, {19, 11, 0x0}},
-    {10722375475619450329ULL, 11, {30, 58, 0x0}},
-    {11620353822385202653ULL, 11, {13, 4, 0x0}},
-    {18397927602723351586ULL, 10, {21, 30, 0x1}},
-    {3945733029276424557ULL, 8, {27, 11, 0x2}},
-    {5474483463039031077ULL, 8, {30, 36, 0x0}},
-    {5938379997229303409ULL, 4, {19, 11, 0x0}},
-    {17109414767797610316ULL, 2, {37, 53, 0x2}},
-    {17460674825607768299ULL, 1, {21, 6, 0x0}},
-    {1665519270960685263ULL, 2, {47, 55, 0x0}},
-    {14844827457311525070ULL, 10, {30, 58, 0x0}},
-    {14835784831661649549ULL, 2, {19, 11, 0x0}},
-    {6883373533979930721ULL, 1, {42, 57, 0x0}},
-    {3617488717091826541ULL, 1, {18, 1, 0x0}},
-    {9480136606271853425ULL, 7, {57, 59, 0x40}},
-    {14633532450326116898ULL, 5, {28, 12, 0x2}},
-    {17817375877441011151ULL, 8, {28, 37, 0x1}},
-    {7628618784391328219ULL, 9, {28, 18, 0x1}},
-    {17073980700669489392ULL, 2, {45, 62, 0x0}},
-    {5557366448656898951ULL, 5, {49, 58, 0x0}},
-    {17188657718858330447ULL, 4, {23, 6, 0x0}},
-    {15047779407645814786ULL, 1, {41, 49, 0x0}},
-    {6070212168191659662ULL, 1, {18, 1, 0x0}},
-    {3099868704944490787ULL, 1, {49, 58, 0x0}},
-    {4944432292337582387ULL, 1, {21, 13, 0x0}},
-    {1033864555778651999ULL, 1, {36, 52, 0x2}},
-    {5938265950095904367ULL, 1, {36, 27, 0x1}},
-    {16951514924685277679ULL, 1, {36, 60, 0x1}},
-    {11990030813302913792ULL, 53, {20, 12, 0x0}},
-    {1396439026737845388ULL, 31, {57, 59, 0x40}},
-    {2797284083970668928ULL, 3, {28, 12, 0x2}},
-    {17073980700669489392ULL, 5, {43, 51, 0x0}},
-    {362480684444977609ULL, 3, {17, 9, 0x0}},
-    {2228310023191286898ULL, 7, {30, 58, 0x0}},
-    {1177254642481836431ULL, 32, {42, 57, 0x0}},
-    {17368058752340016328ULL, 29, {45, 28, 0x1}},
-    {4055688012215861039ULL, 29, {45, 54, 0x1}},
-    {18160575012496129293ULL, 10, {22, 4, 0x0}},
-    {154804992783304073ULL, 10, {46, 60, 0x0}},
-    {8239232551187103096ULL, 10, {30, 58, 0x0}},
-    {10012751652114958081ULL, 46, {40, 48, 0x0}},
-    {2741397821981498825ULL, 18, {43, 51, 0x0}},
-    {14754085956677752251ULL, 3, {43, 51, 0x0}},
-    {8862819093315379337ULL, 2, {42, 57, 0x0}},
-    {14222378995784290494ULL, 10, {36, 60, 0x1}},
-    {6210545000529033810ULL, 1, {33, 5, 0x0}},
-    {16199821166319121980ULL, 1, {57, 59, 0x40}},
-    {8883769607788037463ULL, 107, {26, 5, 0x0}},
-    {13125857368287482849ULL, 108, {57, 59, 0x40}},
-    {7531827262477569249ULL, 5, {18, 1, 0x0}},
-    {2082559453057686086ULL, 6, {42, 57, 0x0}},
-    {16715324912760771006ULL, 3, {18, 1, 0x0}},
-    {4337050555495072347ULL, 3, {28, 37, 0x1}},
-    {6098663799531879423ULL, 3, {28, 18, 0x1}},
-    {14404609107317248067ULL, 1, {43, 51, 0x0}},
-    {6747563481170891826ULL, 4, {25, 61, 0x0}},
-    {16615435909344049583ULL, 3, {57, 59, 0x40}},
-    {13753623335365559994ULL, 3, {9, 2, 0x0}},
-    {17392497401996612697ULL, 2, {45, 53, 0x0}},
-    {9411031113065290682ULL, 5, {51, 58, 0x0}},
-    {1663832166159008451ULL, 6, {30, 58, 0x0}},
-    {2603494693372094541ULL, 5, {35, 27, 0x0}},
-    {12578075303643784382ULL, 5, {40, 48, 0x0}},
-    {7418201644531709246ULL, 3, {12, 6, 0x0}},
-    {11936595188737739218ULL, 1, {42, 57, 0x0}},
-    {14864224626361261496ULL, 1, {23, 15, 0x0}},
-    {8215473359783737097ULL, 1, {51, 30, 0x0}},
-    {3630336922432804397ULL, 1, {27, 11, 0x2}},
-    {12070063843818837725ULL, 1, {36, 52, 0x2}},
-    {2301175346920265746ULL, 12, {28, 12, 0x2}},
-    {12292065916342516581ULL, 11, {36, 52, 0x2}},
-    {9735890692923938283ULL, 9, {18, 1, 0x0}},
-    {7743772893405030460ULL, 2, {21, 6, 0x0}},
-    {5101714086375250729ULL, 4, {37, 58, 0x0}},
-    {13284220688029740438ULL, 1, {19, 11, 0x0}},
-    {4070652397580507647ULL, 1, {44, 52, 0x0}},
-    {6509190859630459318ULL, 1, {9, 2, 0x0}},
-    {3825571137250716563ULL, 2, {47, 55, 0x0}},
-    {14982825262317278076ULL, 8, {27, 11, 0x2}},
-    {2832125532970209181ULL, 2, {49, 58, 0x0}},
-    {366251873209608425ULL, 2, {28, 12, 0x2}},
-    {5465062024802220030ULL, 2, {44, 52, 0x0}},
-    {9994094141098002072ULL, 1, {42, 57, 0x0}},
-    {16890061432601373324ULL, 1, {11, 4, 0x0}},
-    {2800086832721075195ULL, 1, {57, 59, 0x40}},
-    {18224467871734260357ULL, 11, {45, 53, 0x0}},
-    {13463484867818734004ULL, 7, {19, 11, 0x0}},
-    {17268564348960552641ULL, 16, {42, 57, 0x0}},
-    {5687986392577020855ULL, 12, {21, 6, 0x0}},
-    {8427069443767115565ULL, 3, {28, 12, 0x2}},
-    {3448163897964331411ULL, 3, {49, 58, 0x0}},
-    {16901637410980053552ULL, 7, {42, 57, 0x0}},
-    {13589025151696207350ULL, 9, {28, 12, 0x2}},
-    {1508456233249733303ULL, 8, {28, 37, 0x1}},
-    {18224467871734260357ULL, 9, {43, 51, 0x0}},
-    {12485647287567712238ULL, 3, {28, 12, 0x2}},
-    {14410682677787280767ULL, 3, {42, 57, 0x0}},
-    {8188711911683670460ULL, 23, {52, 62, 0x0}},
-    {14786805514034792531ULL, 5, {33, 5, 0x0}},
-    {18160167639728243208ULL, 2, {30, 58, 0x0}},
-    {12624446126019701868ULL, 26, {18, 1, 0x0}},
-    {8777988894073005794ULL, 5, {17, 9, 0x0}},
-    {13284220688029740438ULL, 3, {9, 2, 0x0}},
-    {806414111042674181ULL, 1, {47, 55, 0x0}},
-    {1560698124830744504ULL, 1, {19, 11, 0x0}},
-    {10657927755384760386ULL, 1, {44, 52, 0x0}},
-    {15703377938568828405ULL, 1, {37, 53, 0x2}},
-    {822536358526948246ULL, 1, {29, 13, 0x2}},
-    {9575312428197695142ULL, 1, {29, 36, 0x1}},
-    {14912355268190249406ULL, 1, {27, 11, 0x2}},
-    {4926797222986109608ULL, 1, {28, 37, 0x1}},
-    {2600870248927308519ULL, 1, {28, 4, 0x1}},
-    {13593598267698154836ULL, 1, {52, 61, 0x0}},
-    {14143150030531999970ULL, 5, {13, 4, 0x0}},
-    {17104789744344844412ULL, 5, {54, 61, 0x0}},
-    {3176364777583782124ULL, 3, {24, 8, 0x2}},
-    {4273100315704762935ULL, 2, {21, 36, 0x1}},
-    {11208045346968085271ULL, 12, {51, 58, 0x0}},
-    {10012751652114958081ULL, 8, {57, 59, 0x40}},
-    {12624446126019701868ULL, 15, {36, 29, 0x1}},
-    {11032259002416654264ULL, 15, {36, 43, 0x1}},
-    {15425497357719736839ULL, 15, {26, 5, 0x0}},
-    {699446084867087395ULL, 14, {45, 53, 0x0}},
-    {14296547635220651976ULL, 3, {40, 48, 0x0}},
-    {14835784831661649549ULL, 6, {18, 1, 0x0}},
-    {3551152596911524438ULL, 5, {42, 57, 0x0}},
-    {12497160100107022887ULL, 2, {33, 5, 0x0}},
-    {18115655421454057521ULL, 2, {30, 58, 0x0}},
-    {14210434252865569227ULL, 3, {45, 62, 0x0}},
-    {13753117743094411742ULL, 7, {36, 52, 0x2}},
-    {8281950019485970242ULL, 4, {47, 55, 0x0}},
-    {12767304288290706910ULL, 4, {19, 11, 0x0}},
-    {16589910872415471765ULL, 3, {42, 57, 0x0}},
-    {13329902959846751766ULL, 1, {21, 6, 0x0}},
-    {1635983559685780572ULL, 2, {41, 49, 0x0}},
-    {14928208149731698549ULL, 1, {45, 62, 0x0}},
-    {1920595130209180302ULL, 1, {21, 13, 0x0}},
-    {11817617653855156940ULL, 1, {44, 58, 0x0}},
-    {15512160511713008513ULL, 2, {42, 57, 0x0}},
-    {1317269159200877694ULL, 1, {45, 53, 0x0}},
-    {6603484904864388936ULL, 1, {21, 6, 0x0}},
-    {4434603022270942794ULL, 1, {49, 58, 0x0}},
-    {13161278961864926647ULL, 1, {29, 2, 0x0}},
-    {14648690975691689926ULL, 1, {44, 52, 0x0}},
-    {3737259131514101563ULL, 1, {22, 29, 0x0}},
-    {5185543144284771276ULL, 1, {42, 57, 0x0}},
-    {17188657718858330447ULL, 4, {11, 1, 0x0}},
-    {2411697302306059610ULL, 2, {44, 52, 0x0}},
-    {53835828157541918ULL, 1, {21, 6, 0x0}},
-    {3291723229843673857ULL, 2, {47, 55, 0x0}},
-    {9031485652680936441ULL, 1, {41, 49, 0x0}},
-    {16042297656783649604ULL, 1, {9, 2, 0x0}},
-    {9927966217695942225ULL, 1, {49, 58, 0x0}},
-    {1396439026737845388ULL, 32, {44, 52, 0x0}},
-    {5979050373511178273ULL, 1, {26, 10, 0x2}},
-    {135000284066593612ULL, 1, {38, 54, 0x2}},
-    {13555015828291031229ULL, 2, {41, 49, 0x0}},
-    {6728472591679214005ULL, 2, {1, 3, 0x40}},
-    {15983423065043880832ULL, 2, {49, 58, 0x0}},
-    {10043568051984666171ULL, 9, {12, 6, 0x0}},
-    {12289416094396696866ULL, 7, {37, 53, 0x2}},
-    {259099318501819281ULL, 6, {23, 15, 0x0}},
-    {13037364759367479561ULL, 6, {12, 30, 0x1}},
-    {14754085956677752251ULL, 5, {47, 55, 0x0}},
-    {15149516132781732700ULL, 4, {19, 11, 0x0}},
-    {16618821404328432340ULL, 2, {25, 61, 0x0}},
-    {2316627217664730158ULL, 2, {29, 2, 0x1}},
-    {16165273987861084926ULL, 2, {43, 51, 0x0}},
-    {14901221747370452102ULL, 12, {9, 2, 0x0}},
-    {18251932868970671675ULL, 12, {36, 52, 0x2}},
-    {6720658469582997910ULL, 28, {41, 49, 0x0}},
-    {11250468789413619888ULL, 25, {9, 2, 0x0}},
-    {3520088882391715994ULL, 25, {49, 58, 0x0}},
-    {15001211505873965993ULL, 5, {1, 3, 0x40}},
-    {18207383455912074416ULL, 1, {42, 57, 0x0}},
-    {12735707120281114201ULL, 1, {29, 13, 0x2}},
-    {382982140990207870ULL, 1, {57, 59, 0x40}},
-    {14786805514034792531ULL, 7, {26, 5, 0x0}},
-    {11114685190635804084ULL, 6, {29, 36, 0x1}},
-    {1866326805214807779ULL, 1, {34, 61, 0x0}},
-    {5862500427039791725ULL, 1, {19, 11, 0x0}},
-    {16608119715830181707ULL, 1, {43, 51, 0x0}},
-    {11296161444605296414ULL, 1, {20, 2, 0x0}},
-    {6099132900998907640ULL, 1, {20, 34, 0x1}},
-    {8779947511640187365ULL, 1, {20, 4, 0x1}},
-    {11133516130806577752ULL, 1, {45, 53, 0x0}},
-    {3209144858891408054ULL, 10, {26, 5, 0x0}},
-    {16861246218397967427ULL, 5, {34, 61, 0x0}},
-    {9751664453903314766ULL, 5, {19, 11, 0x0}},
-    {14587904482859630682ULL, 5, {43, 51, 0x0}},
-    {3293031995871834272ULL, 3, {29, 13, 0x2}},
-    {17633405332301155400ULL, 3, {6, 34, 0x1}},
-    {2735451798568382007ULL, 22, {26, 5, 0x0}},
-    {10406819251234175889ULL, 22, {49, 58, 0x0}},
-    {11351876726249585025ULL, 21, {19, 11, 0x0}},
-    {14938120743895780849ULL, 9, {37, 53, 0x2}},
-    {1318184152444028073ULL, 22, {22, 14, 0x0}},
-    {4014187189509302547ULL, 8, {36, 52, 0x2}},
-    {17130578250547307224ULL, 6, {14, 5, 0x0}},
-    {2539549800177039240ULL, 2, {42, 57, 0x0}},
-    {9521019390151379158ULL, 1, {19, 11, 0x0}},
-    {11249441732865067336ULL, 1, {37, 53, 0x2}},
-    {2195763677651889364ULL, 1, {18, 1, 0x0}},
-    {15707452986165409210ULL, 1, {45, 62, 0x0}},
-    {12173654057204092496ULL, 2, {38, 2, 0x0}},
-    {14821169066879762562ULL, 1, {52, 61, 0x0}},
-    {8166857017631394197ULL, 12, {52, 62, 0x0}},
-    {7413384737443105225ULL, 5, {36, 29, 0x1}},
-    {3032034964129158385ULL, 5, {36, 45, 0x1}},
-    {6904871901544991906ULL, 12, {42, 57, 0x0}},
-    {6713950162534808854ULL, 10, {18, 1, 0x0}},
-    {15075727771507211283ULL, 6, {45, 53, 0x0}},
-    {12749293669328252047ULL, 3, {42, 57, 0x0}},
-    {15859321947168704758ULL, 3, {38, 2, 0x0}},
-    {13921072136224265788ULL, 1, {41, 49, 0x0}},
-    {15492099035118891757ULL, 1, {35, 27, 0x0}},
-    {17330799602674278462ULL, 1, {25, 42, 0x0}},
-    {6210545000529033810ULL, 5, {20, 2, 0x0}},
-    {8286859690536935807ULL, 5, {57, 59, 0x40}},
-    {1579516743148795256ULL, 16, {37, 53, 0x2}},
-    {15123715279150201890ULL, 1, {25, 9, 0x2}},
-    {8308757273903005807ULL, 1, {38, 54, 0x2}},
-    {16298428079989731722ULL, 1, {9, 2, 0x0}},
-    {17581902460901627761ULL, 1, {54, 61, 0x0}},
-    {3200315927029072543ULL, 1, {20, 12, 0x0}},
-    {11817631735782727976ULL, 1, {43, 51, 0x0}},
-    {4610926162051661550ULL, 12, {41, 49, 0x0}},
-    {11357975589073024167ULL, 9, {18, 1, 0x0}},
-    {8004815408765676276ULL, 10, {49, 58, 0x0}},
-    {5841479546949721253ULL, 1, {30, 14, 0x2}},
-    {4875360124742941048ULL, 1, {45, 62, 0x0}},
-    {17192387111477417047ULL, 6, {20, 2, 0x0}},
-    {8520385972645596394ULL, 6, {42, 27, 0x0}},
-    {7777793937139534802ULL, 1, {25, 9, 0x2}},
-    {12719348183936543019ULL, 1, {41, 34, 0x0}},
-    {3176364777583782124ULL, 12, {22, 4, 0x0}},
-    {5631285317553132652ULL, 12, {46, 36, 0x0}},
-    {9411031113065290682ULL, 1, {41, 49, 0x0}},
-    {7585785385337761577ULL, 6, {27, 11, 0x2}},
-    {9770712828427831827ULL, 2, {45, 62, 0x0}},
-    {11314503528844194739ULL, 1, {18, 1, 0x0}},
-    {13911437167912736206ULL, 1, {44, 52, 0x0}},
-    {17016705753342824920ULL, 1, {16, 8, 0x0}},
-    {13262752226857876095ULL, 1, {42, 57, 0x0}},
-    {591964673182378060ULL, 19, {42, 57, 0x0}},
-    {7894746036297525360ULL, 19, {21, 6, 0x0}},
-    {4357831450415185383ULL, 12, {44, 52, 0x0}},
-    {17812174044496671167ULL, 16, {45, 54, 0x1}},
-    {2431275971508840765ULL, 15, {1, 3, 0x40}},
-    {5310766221877018084ULL, 15, {49, 58, 0x0}},
-    {13906417954511346675ULL, 11, {28, 12, 0x2}},
-    {15647365035980378476ULL, 4, {29, 36, 0x1}},
-    {8826388458108771235ULL, 2, {20, 12, 0x0}},
-    {4236708405829551657ULL, 2, {44, 52, 0x0}},
-    {16764546303442426248ULL, 4, {27, 11, 0x2}},
-    {14556489766375680219ULL, 4, {36, 52, 0x2}},
-    {5323941034666326580ULL, 4, {52, 61, 0x0}},
-    {15212621752507211582ULL, 3, {37, 53, 0x2}},
-    {4427255842915037872ULL, 2, {30, 12, 0x1}},
-    {7599832281029390256ULL, 2, {30, 37, 0x1}},
-    {974579608276137956ULL, 7, {43, 51, 0x0}},
-    {1149462635247451623ULL, 23, {18, 10, 0x0}},
-    {7645748197340408214ULL, 10, {37, 53, 0x2}},
-    {2287405147878175990ULL, 10, {36, 28, 0x0}},
-    {199510913874117899ULL, 3, {38, 54, 0x2}},
-    {53917537757537769ULL, 11, {28, 45, 0x0}},
-    {1903286576231994809ULL, 11, {9, 2, 0x0}},
-    {193644954832032558ULL, 11, {18, 28, 0x1}},
-    {13991009012707108773ULL, 6, {37, 53, 0x2}},
-    {15678505194245743068ULL, 2, {23, 15, 0x0}},
-    {17230918052558009234ULL, 2, {21, 30, 0x1}},
-    {8261788701150145605ULL, 2, {49, 58, 0x0}},
-    {7418201644531709246ULL, 1, {21, 6, 0x0}},
-    {18191595766369024472ULL, 1, {46, 54, 0x0}},
-    {2487747288420277583ULL, 1, {19, 11, 0x0}},
-    {8644429972487150908ULL, 1, {54, 61, 0x0}},
-    {5532767636701226487ULL, 1, {11, 1, 0x0}},
-    {9605645272104905581ULL, 1, {34, 50, 0x2}},
-    {18124417442460565296ULL, 10, {18, 1, 0x0}},
-    {13748693895381142671ULL, 10, {28, 37, 0x1}},
-    {3140661512706915242ULL, 10, {28, 18, 0x1}},
-    {2228310023191286898ULL, 3, {53, 60, 0x0}},
-    {5466096304987133231ULL, 4, {33, 18, 0x0}},
-    {16992168441342409546ULL, 4, {36, 52, 0x2}},
-    {12657986276115343633ULL, 4, {36, 27, 0x1}},
-    {6764234055580338846ULL, 4, {39, 45, 0x0}},
-    {10331459553381165467ULL, 3, {42, 57, 0x0}},
-    {15199059705691937149ULL, 3, {35, 27, 0x0}},
-    {2195707318273697297ULL, 3, {36, 42, 0x0}},
-    {2440405679371428750ULL, 1, {28, 12, 0x2}},
-    {12876587257033340592ULL, 1, {28, 37, 0x1}},
-    {12506621179946518014ULL, 1, {28, 4, 0x1}},
-    {9840068184914441802ULL, 1, {43, 51, 0x0}},
-    {9829105923230151897ULL, 4, {19, 11, 0x0}},
-    {398715556815971940ULL, 4, {54, 61, 0x0}},
-    {13241423753991783522ULL, 3, {20, 2, 0x0}},
-    {18075131851039488572ULL, 3, {36, 52, 0x2}},
-    {2832125532970209181ULL, 6, {44, 52, 0x0}},
-    {746500785154792927ULL, 2, {29, 13, 0x2}},
-    {4198917847219920258ULL, 1, {49, 58, 0x0}},
-    {13103253879588266001ULL, 1, {28, 12, 0x2}},
-    {15160337380066147142ULL, 1, {25, 61, 0x0}},
-    {17442651412078622752ULL, 3, {38, 46, 0x0}},
-    {7645748197340408214ULL, 12, {36, 52, 0x2}},
-    {6801088934904276896ULL, 12, {23, 15, 0x0}},
-    {17812778394119697675ULL, 9, {21, 30, 0x1}},
-    {4762152482573493221ULL, 6, {22, 14, 0x0}},
-    {13348692867155800469ULL, 4, {52, 62, 0x0}},
-    {8449531528916247117ULL, 6, {37, 53, 0x2}},
-    {10257129069726795371ULL, 4, {28, 12, 0x2}},
-    {12876891438278381369ULL, 1, {36, 52, 0x2}},
-    {15999877143920231641ULL, 10, {32, 25, 0x0}},
-    {1579516743148795256ULL, 7, {30, 58, 0x0}},
-    {15208973919737899966ULL, 3, {46, 60, 0x0}},
-    {429595594317509877ULL, 3, {28, 12, 0x2}},
-    {1372678218068159611ULL, 1, {29, 36, 0x1}},
-    {12497160100107022887ULL, 3, {31, 4, 0x0}},
-    {16038750448179474883ULL, 2, {52, 62, 0x0}},
-    {14859532205576770013ULL, 5, {36, 52, 0x2}},
-    {951549080933073652ULL, 5, {36, 29, 0x1}},
-    {50795556832634171ULL, 5, {36, 42, 0x1}},
-    {13571954511580679232ULL, 4, {9, 2, 0x0}},
-    {930652702502442036ULL, 4, {45, 62, 0x0}},
-    {8166857017631394197ULL, 18, {51, 57, 0x0}},
-    {8883769607788037463ULL, 1, {25, 9, 0x2}},
-    {8499241019415141023ULL, 1, {57, 59, 0x40}},
-    {16616484927163915605ULL, 5, {47, 55, 0x0}},
-    {14418722352261270110ULL, 2, {12, 4, 0x0}},
-    {12404426048017099316ULL, 2, {38, 54, 0x2}},
-    {2769349522364596657ULL, 16, {20, 2, 0x0}},
-    {17126951192117276716ULL, 11, {45, 62, 0x0}},
-    {2116438952411349496ULL, 11, {21, 13, 0x0}},
-    {15538935877549568371ULL, 8, {42, 57, 0x0}},
-    {199510913874117899ULL, 6, {57, 59, 0x40}},
-    {17478679850864923970ULL, 3, {28, 12, 0x2}},
-    {9491049336051427072ULL, 2, {52, 62, 0x0}},
-    {1149462635247451623ULL, 2, {33, 5, 0x0}},
-    {27043506714000571ULL, 2, {40, 48, 0x0}},
-    {3693114083618975266ULL, 2, {24, 33, 0x0}},
-    {16997059719571608075ULL, 2, {37, 53, 0x2}},
-    {4831661732843981970ULL, 9, {36, 29, 0x1}},
-    {9237047603426361651ULL, 9, {36, 45, 0x1}},
-    {14786805514034792531ULL, 6, {36, 29, 0x1}},
-    {15417136991538114822ULL, 6, {36, 43, 0x1}},
-    {13645967238160397941ULL, 3, {28, 45, 0x0}},
-    {16038750448179474883ULL, 1, {45, 53, 0x0}},
-    {14052924361077828856ULL, 1, {47, 55, 0x0}},
-    {15242325501351020641ULL, 1, {21, 6, 0x0}},
-    {5652963652373749011ULL, 1, {36, 52, 0x2}},
-    {11514186445833415512ULL, 1, {36, 29, 0x1}},
-    {8485715794482045386ULL, 1, {36, 43, 0x1}},
-    {17109414767797610316ULL, 2, {51, 58, 0x0}},
-    {316014745272542487ULL, 2, {22, 14, 0x0}},
-    {1235929339188515014ULL, 2, {57, 59, 0x40}},
-    {8314746806995411380ULL, 3, {20, 12, 0x0}},
-    {17549429878562197331ULL, 1, {42, 57, 0x0}},
-    {13077459743159872663ULL, 1, {18, 1, 0x0}},
-    {4035054425921157265ULL, 1, {45, 62, 0x0}},
-    {2399964491846677222ULL, 1, {23, 15, 0x0}},
-    {323950280593765591ULL, 1, {44, 58, 0x0}},
-    {8782252516741021107ULL, 9, {44, 52, 0x0}},
-    {4198153015302602510ULL, 9, {22, 28, 0x0}},
-    {7676669516831202912ULL, 9, {46, 37, 0x0}},
-    {6279419389070596696ULL, 11, {37, 53, 0x2}},
-    {767016273656118985ULL, 7, {17, 9, 0x0}},
-    {15474891012771332789ULL, 7, {43, 51, 0x0}},
-    {17908098039236078199ULL, 6, {18, 1, 0x0}},
-    {5101714086375250729ULL, 2, {34, 50, 0x2}},
-    {6238136996356891524ULL, 1, {9, 2, 0x0}},
-    {8173285831059313999ULL, 1, {42, 57, 0x0}},
-    {4976894299185159540ULL, 1, {19, 11, 0x0}},
-    {8051334738018667157ULL, 1, {36, 52, 0x2}},
-    {4708117040037441050ULL, 5, {45, 62, 0x0}},
-    {2242200468607670578ULL, 1, {16, 8, 0x0}},
-    {405452168202430897ULL, 1, {51, 58, 0x0}},
-    {6816235727209850492ULL, 9, {12, 5, 0x0}},
-    {1528373090159759611ULL, 8, {51, 30, 0x0}},
-    {2587095624732631979ULL, 6, {29, 36, 0x1}},
-    {4667574601816522117ULL, 4, {31, 4, 0x0}},
-    {11701470989052549594ULL, 3, {52, 62, 0x0}},
-    {4951880791549063964ULL, 2, {29, 31, 0x1}},
-    {13361612893757841344ULL, 2, {47, 55, 0x0}},
-    {13830462267328348228ULL, 13, {36, 27, 0x1}},
-    {11538672534852821408ULL, 13, {36, 45, 0x1}},
-    {18278701602224634493ULL, 9, {28, 12, 0x2}},
-    {15191664019859527249ULL, 9, {42, 57, 0x0}},
-    {767016273656118985ULL, 4, {18, 1, 0x0}},
-    {3037644815974198949ULL, 11, {43, 51, 0x0}},
-    {14478622848732650059ULL, 3, {19, 11, 0x0}},
-    {15770984337311464306ULL, 1, {45, 62, 0x0}},
-    {4610926162051661550ULL, 4, {44, 52, 0x0}},
-    {4612649881682955571ULL, 4, {18, 1, 0x0}},
-    {2552807144255041100ULL, 4, {41, 49, 0x0}},
-    {11094558197747572915ULL, 4, {1, 3, 0x40}},
-    {5859473755817451731ULL, 4, {49, 58, 0x0}},
-    {14859532205576770013ULL, 6, {45, 62, 0x0}},
-    {4423570080327089207ULL, 4, {9, 2, 0x0}},
-    {3232472753245065220ULL, 2, {36, 52, 0x2}},
-    {16875726397009642708ULL, 1, {1, 3, 0x40}},
-    {10073660279682940313ULL, 1, {28, 36, 0x0}},
-    {5841479546949721253ULL, 10, {1, 3, 0x40}},
-    {17787125560235599109ULL, 10, {57, 59, 0x40}},
-    {605550243213857586ULL, 7, {19, 11, 0x0}},
-    {5033179728697155138ULL, 5, {37, 53, 0x2}},
-    {8618580108188990629ULL, 5, {42, 33, 0x1}},
-    {16980985132946108732ULL, 5, {42, 49, 0x1}},
-    {4197901149777274304ULL, 4, {37, 28, 0x1}},
-    {6133272759351824604ULL, 2, {43, 51, 0x0}},
-    {16264027291797640511ULL, 9, {52, 62, 0x0}},
-    {16228966911907385688ULL, 17, {36, 52, 0x2}},
-    {1848827282326176095ULL, 14, {36, 29, 0x1}},
-    {15001211505873965993ULL, 20, {28, 12, 0x2}},
-    {17932806170431131754ULL, 4, {45, 53, 0x0}},
-    {15136999190508813045ULL, 3, {1, 3, 0x40}},
-    {17687659119355474719ULL, 3, {42, 57, 0x0}},
-    {18302720294942730011ULL, 1, {11, 4, 0x0}},
-    {13019235115776008202ULL, 1, {37, 58, 0x0}},
-    {13488628011961912854ULL, 1, {21, 13, 0x0}},
-    {4327514769276438104ULL, 1, {57, 59, 0x40}},
-    {7167454292758700144ULL, 8, {37, 53, 0x2}},
-    {1621447650458680172ULL, 8, {9, 2, 0x0}},
-    {14126971901331892256ULL, 1, {41, 49, 0x0}},
-    {1076937151375403658ULL, 1, {29, 13, 0x2}},
-    {9484800340396816458ULL, 1, {49, 58, 0x0}},
-    {4031138078085941720ULL, 1, {28, 12, 0x2}},
-    {12741807527158836ULL, 3, {28, 37, 0x1}},
-    {1314071407186854557ULL, 2, {39, 55, 0x2}},
-    {14786805514034792531ULL, 2, {19, 11, 0x0}},
-    {1519460425088512788ULL, 2, {51, 58, 0x0}},
-    {6841954008926061468ULL, 8, {44, 52, 0x0}},
-    {13742937627030917489ULL, 7, {28, 12, 0x2}},
-    {12156651407697939319ULL, 1, {41, 49, 0x0}},
-    {7110736979523648927ULL, 1, {27, 11, 0x2}},
-    {7955214867060916029ULL, 1, {49, 58, 0x0}},
-    {12557464768465772210ULL, 2, {11, 2, 0x0}},
-    {17973348622245705243ULL, 1, {52, 62, 0x0}},
-    {8082906110243659097ULL, 1, {29, 13, 0x2}},
-    {16739788487491816234ULL, 1, {35, 51, 0x2}},
-    {6336426424493360561ULL, 8, {24, 8, 0x2}},
-    {10025382352593648631ULL, 7, {32, 48, 0x2}},
-    {16257097268434136104ULL, 3, {20, 2, 0x0}},
-    {11366480742890106359ULL, 3, {20, 34, 0x1}},
-    {17932806170431131754ULL, 15, {42, 57, 0x0}},
-    {2505803546339071536ULL, 13, {1, 3, 0x40}},
-    {7080920184175993483ULL, 16, {57, 59, 0x40}},
-    {1867286230845612828ULL, 3, {37, 53, 0x2}},
-    {4237306308015172055ULL, 3, {36, 28, 0x0}},
-    {9231382006437961500ULL, 3, {44, 52, 0x0}},
-    {15678505194245743068ULL, 2, {11, 1, 0x0}},
-    {7981819194257841306ULL, 2, {28, 37, 0x1}},
-    {4220449201395613495ULL, 18, {19, 11, 0x0}},
-    {2700327940194563397ULL, 18, {42, 57, 0x0}},
-    {16329127678136049248ULL, 17, {29, 13, 0x2}},
-    {5492901291724541284ULL, 14, {43, 51, 0x0}},
-    {13211197149147348207ULL, 2, {37, 53, 0x2}},
-    {4898711512496534509ULL, 2, {14, 5, 0x0}},
-    {3443581936448031789ULL, 2, {45, 62, 0x0}},
-    {188692947242122750ULL, 2, {30, 58, 0x0}},
-    {14835784831661649549ULL, 2, {23, 15, 0x0}},
-    {10723772379056411686ULL, 2, {21, 30, 0x1}},
-    {11550688068626905978ULL, 2, {21, 14, 0x1}},
-    {4840121162814772690ULL, 2, {42, 57, 0x0}},
-    {13034166716182122047ULL, 3, {30, 14, 0x2}},
-    {2344700836357712216ULL, 3, {30, 37, 0x1}},
-    {1974527729233180432ULL, 3, {21, 13, 0x0}},
-    {13749088889552319371ULL, 2, {39, 30, 0x0}},
-    {6627323009912906888ULL, 10, {36, 52, 0x2}},
-    {7493200292560095376ULL, 10, {36, 27, 0x1}},
-    {12057842364059863335ULL, 10, {36, 60, 0x1}},
-    {6442119805092351441ULL, 10, {28, 12, 0x2}},
-    {7678280131753579654ULL, 6, {42, 57, 0x0}},
-    {10381385124365134859ULL, 6, {18, 1, 0x0}},
-    {10670451292426932216ULL, 5, {43, 51, 0x0}},
-    {15208973919737899966ULL, 1, {35, 51, 0x2}},
-    {2301175346920265746ULL, 15, {18, 1, 0x0}},
-    {8918090554466187553ULL, 15, {36, 52, 0x2}},
-    {169171433229631623ULL, 9, {19, 11, 0x0}},
-    {9491049336051427072ULL, 1, {47, 55, 0x0}},
-    {17941578739202831579ULL, 14, {29, 13, 0x2}},
-    {17167283517864731557ULL, 14, {57, 59, 0x40}},
-    {17986255588715308102ULL, 4, {44, 52, 0x0}},
-    {9741325202530033938ULL, 1, {18, 1, 0x0}},
-    {4598383559416694014ULL, 1, {41, 49, 0x0}},
-    {6188961432683994652ULL, 2, {17, 9, 0x0}},
-    {15478333766059373126ULL, 2, {49, 58, 0x0}},
-    {13272501065890819408ULL, 2, {9, 2, 0x0}},
-    {6111041970417421142ULL, 2, {57, 59, 0x40}},
-    {4407573588513695826ULL, 1, {20, 2, 0x0}},
-    {4386237330162728504ULL, 1, {37, 58, 0x1}},
-    {14872605389211903863ULL, 8, {21, 6, 0x0}},
-    {5521450094658793946ULL, 8, {45, 62, 0x0}},
-    {3176364777583782124ULL, 5, {27, 11, 0x2}},
-    {16084342817045449268ULL, 5, {21, 36, 0x1}},
-    {188692947242122750ULL, 2, {37, 53, 0x2}},
-    {4112247143107604418ULL, 4, {36, 29, 0x1}},
-    {7117371857361274913ULL, 4, {36, 43, 0x1}},
-    {6952211137024786789ULL, 4, {18, 1, 0x0}},
-    {4014322990236889951ULL, 4, {45, 62, 0x0}},
-    {6880499474982597015ULL, 3, {37, 58, 0x0}},
-    {4805384987773859549ULL, 3, {21, 6, 0x0}},
-    {15310904340535262991ULL, 3, {45, 53, 0x0}},
-    {2357989876182534438ULL, 2, {19, 11, 0x0}},
-    {6614114454921487206ULL, 2, {57, 59, 0x40}},
-    {16576340125263318608ULL, 1, {51, 58, 0x0}},
-    {2917031049552900547ULL, 1, {1, 3, 0x40}},
-    {12734694975402032480ULL, 1, {42, 57, 0x0}},
-    {1003484777785739016ULL, 4, {9, 2, 0x0}},
-    {12827406069961229111ULL, 2, {45, 53, 0x0}},
-    {17324407511141808068ULL, 6, {29, 13, 0x2}},
-    {17529598866704190916ULL, 6, {36, 52, 0x2}},
-    {7537262777870219194ULL, 1, {18, 1, 0x0}},
-    {4180406523094238394ULL, 2, {42, 57, 0x0}},
-    {17635026690004585557ULL, 1, {18, 1, 0x0}},
-    {13829685675089804937ULL, 1, {42, 57, 0x0}},
-    {5916808714158458136ULL, 1, {21, 6, 0x0}},
-    {3601454187398330320ULL, 2, {37, 53, 0x2}},
-    {13749088889552319371ULL, 1, {44, 30, 0x0}},
-    {8883769607788037463ULL, 3, {13, 4, 0x0}},
-    {5370531455934950085ULL, 2, {37, 53, 0x2}},
-    {15178710260014237150ULL, 5, {21, 6, 0x0}},
-    {16732704055149426172ULL, 1, {49, 58, 0x0}},
-    {18019904443391595349ULL, 1, {17, 9, 0x0}},
-    {9845709079351953850ULL, 1, {37, 53, 0x2}},
-    {1329717847976010258ULL, 1, {9, 2, 0x0}},
-    {11406991152036004517ULL, 3, {19, 11, 0x0}},
-    {17168543931555136612ULL, 2, {35, 51, 0x2}},
-    {5426689571434376504ULL, 2, {42, 57, 0x0}},
-    {4335671656504277717ULL, 2, {35, 27, 0x0}},
-    {16893502116682396105ULL, 2, {27, 42, 0x0}},
-    {4814078030769672394ULL, 2, {11, 21, 0x0}},
-    {9446745124700044237ULL, 2, {46, 60, 0x0}},
-    {13623201159966729441ULL, 2, {13, 4, 0x0}},
-    {3836957407128921475ULL, 1, {25, 61, 0x0}},
-    {10198375359209752128ULL, 5, {18, 1, 0x0}},
-    {9975603925005967238ULL, 9, {34, 61, 0x0}},
-    {14801662614010119941ULL, 4, {20, 12, 0x0}},
-    {18203145635484479350ULL, 2, {40, 48, 0x0}},
-    {7030747919821981677ULL, 9, {11, 1, 0x0}},
-    {3291723229843673857ULL, 1, {41, 49, 0x0}},
-    {16566731121031870468ULL, 1, {28, 12, 0x2}},
-    {13336639436249145436ULL, 1, {28, 37, 0x1}},
-    {5919407591780574103ULL, 1, {28, 11, 0x1}},
-    {17852614301922414794ULL, 1, {42, 57, 0x0}},
-    {12943328154826809346ULL, 3, {36, 29, 0x1}},
-    {18302720294942730011ULL, 1, {28, 12, 0x2}},
-    {8969992664936869271ULL, 1, {28, 35, 0x1}},
-    {11218372797223840894ULL, 1, {1, 3, 0x40}},
-    {17395175703782566709ULL, 1, {51, 58, 0x0}},
-    {5606354080358853735ULL, 1, {45, 62, 0x0}},
-    {3390986101916190677ULL, 1, {21, 6, 0x0}},
-    {13716640496646620789ULL, 1, {44, 52, 0x0}},
-    {6168087577737131984ULL, 1, {6, 7, 0x0}},
-    {11414498824955190227ULL, 1, {35, 51, 0x2}},
-    {8987149673667085504ULL, 4, {1, 3, 0x40}},
-    {1610230505303374045ULL, 3, {45, 62, 0x0}},
-    {15340939793667601002ULL, 12, {27, 11, 0x2}},
-    {4916957321416261754ULL, 2, {44, 52, 0x0}},
-    {1510908925626784060ULL, 2, {41, 49, 0x0}},
-    {3782377025650532232ULL, 2, {28, 12, 0x2}},
-    {18146352535235649390ULL, 2, {28, 37, 0x1}},
-    {2742385162372852499ULL, 2, {28, 18, 0x1}},
-    {17026068999397319178ULL, 1, {49, 58, 0x0}},
-    {16884333245572098912ULL, 1, {27, 11, 0x2}},
-    {14431969694946982129ULL, 1, {45, 62, 0x0}},
-    {14897711322401616057ULL, 1, {45, 38, 0x1}},
-    {6114732627028003100ULL, 1, {45, 52, 0x1}},
-    {746500785154792927ULL, 4, {28, 12, 0x2}},
-    {8734052717918698342ULL, 3, {42, 57, 0x0}},
-    {412428947549267920ULL, 3, {21, 6, 0x0}},
-    {6883373533979930721ULL, 1, {37, 53, 0x2}},
-    {14707574055850480478ULL, 1, {18, 1, 0x0}},
-    {16133763465166766437ULL, 1, {42, 57, 0x0}},
-    {13141918964415820484ULL, 2, {25, 61, 0x0}},
-    {3504989790267432984ULL, 1, {29, 36, 0x1}},
-    {3020983148694912262ULL, 4, {37, 53, 0x2}},
-    {16328335030864989334ULL, 4, {36, 28, 0x0}},
-    {11046124094087346556ULL, 2, {38, 54, 0x2}},
-    {2823138037705687082ULL, 2, {38, 29, 0x1}},
-    {6246190945856957790ULL, 2, {47, 55, 0x0}},
-    {7750475974625958028ULL, 1, {21, 6, 0x0}},
-    {1665519270960685263ULL, 4, {45, 62, 0x0}},
-    {16533565529167163212ULL, 4, {12, 6, 0x0}},
-    {4457336635464661513ULL, 4, {29, 36, 0x1}},
-    {15419048708294904890ULL, 3, {42, 57, 0x0}},
-    {14052924361077828856ULL, 5, {46, 54, 0x0}},
-    {7684268610892084097ULL, 5, {9, 2, 0x0}},
-    {12087442756527777897ULL, 5, {54, 61, 0x0}},
-    {9609407496200168339ULL, 6, {1, 3, 0x40}},
-    {6102224732459341507ULL, 5, {51, 58, 0x0}},
-    {914637218120196131ULL, 16, {57, 59, 0x40}},
-    {8903149488731738733ULL, 12, {27, 11, 0x2}},
-    {16677033246745216219ULL, 12, {44, 52, 0x0}},
-    {11679719024517508790ULL, 1, {45, 62, 0x0}},
-    {7328389343944275548ULL, 2, {43, 36, 0x1}},
-    {14196129766178819830ULL, 2, {43, 50, 0x1}},
-    {17757592753060749438ULL, 7, {57, 59, 0x40}},
-    {4911607234890069264ULL, 1, {17, 9, 0x0}},
-    {15141013926365093219ULL, 1, {46, 54, 0x0}},
-    {53835828157541918ULL, 1, {17, 9, 0x0}},
-    {2332761655682740393ULL, 1, {42, 57, 0x0}},
-    {7523245497666978709ULL, 1, {9, 2, 0x0}},
-    {1783450099484711758ULL, 1, {45, 62, 0x0}},
-    {11430234580772313809ULL, 1, {21, 13, 0x0}},
-    {2463516896765616166ULL, 1, {35, 51, 0x2}},
-    {3291723229843673857ULL, 7, {42, 57, 0x0}},
-    {583571228840306217ULL, 6, {17, 9, 0x0}},
-    {5579608121418440609ULL, 1, {38, 54, 0x2}},
-    {271508887475678536ULL, 1, {9, 2, 0x0}},
-    {11360469730085715885ULL, 1, {54, 61, 0x0}},
-    {6689260125950577352ULL, 4, {44, 52, 0x0}},
-    {15067101762169750392ULL, 4, {28, 12, 0x2}},
-    {8448575242731240433ULL, 2, {28, 35, 0x1}},
-    {15437154050935256964ULL, 1, {28, 18, 0x1}},
-    {5633346526629069933ULL, 1, {42, 57, 0x0}},
-    {12147486203975073100ULL, 1, {21, 6, 0x0}},
-    {637968157394831788ULL, 1, {51, 58, 0x0}},
-    {11208045346968085271ULL, 3, {45, 53, 0x0}},
-    {6385102848399624523ULL, 1, {30, 58, 0x0}},
-    {14183952477480427245ULL, 1, {35, 18, 0x1}},
-    {12001075120018546901ULL, 1, {57, 59, 0x40}},
-    {15931350434151818069ULL, 2, {42, 57, 0x0}},
-    {14390437899162840020ULL, 2, {3, 2, 0x0}},
-    {559962089334016956ULL, 1, {35, 51, 0x2}},
-    {9131774160553666360ULL, 5, {30, 58, 0x0}},
-    {5072961277340380631ULL, 7, {42, 57, 0x0}},
-    {14168783488614219039ULL, 7, {35, 27, 0x0}},
-    {15765669759583131496ULL, 7, {36, 42, 0x0}},
-    {10990561595723709236ULL, 7, {28, 12, 0x2}},
-    {11839584330974405226ULL, 7, {44, 52, 0x0}},
-    {8407207392130568286ULL, 4, {29, 13, 0x2}},
-    {17041220566591979461ULL, 4, {46, 36, 0x0}},
-    {771915367429723165ULL, 4, {44, 35, 0x1}},
-    {4458899000737982224ULL, 2, {44, 51, 0x1}},
-    {4442527735552920965ULL, 7, {57, 59, 0x40}},
-    {7610836377752460079ULL, 2, {33, 5, 0x0}},
-    {14389992183858170758ULL, 2, {44, 52, 0x0}},
-    {14198307122025381492ULL, 3, {52, 62, 0x0}},
-    {1610230505303374045ULL, 1, {42, 57, 0x0}},
-    {749254599134020196ULL, 4, {45, 62, 0x0}},
-    {7110736979523648927ULL, 4, {17, 9, 0x0}},
-    {15781963881806604129ULL, 3, {49, 58, 0x0}},
-    {2025925735923245328ULL, 4, {9, 2, 0x0}},
-    {10501170017635283500ULL, 1, {42, 57, 0x0}},
-    {5573619307009465210ULL, 4, {1, 3, 0x40}},
-    {16653400019026269664ULL, 4, {57, 59, 0x40}},
-    {1668084767683326049ULL, 1, {22, 29, 0x0}},
-    {11170621022964906246ULL, 1, {57, 59, 0x40}},
-    {11333902720713066036ULL, 7, {21, 6, 0x0}},
-    {14731085233408838516ULL, 5, {33, 27, 0x0}},
-    {16858022554857852332ULL, 5, {42, 57, 0x0}},
-    {15319811241057226675ULL, 3, {21, 6, 0x0}},
-    {18278227007709910958ULL, 1, {43, 51, 0x0}},
-    {9720808026548882503ULL, 1, {16, 8, 0x0}},
-    {17227076540127596792ULL, 1, {49, 58, 0x0}},
-    {6562214958895417275ULL, 1, {19, 5, 0x0}},
-    {15646232861137070531ULL, 1, {45, 53, 0x0}},
-    {2859227840215654479ULL, 5, {21, 6, 0x0}},
-    {3176364777583782124ULL, 6, {31, 4, 0x0}},
-    {14656071041487488028ULL, 4, {52, 61, 0x0}},
-    {591964673182378060ULL, 1, {46, 60, 0x0}},
-    {13039260344206174103ULL, 1, {22, 28, 0x0}},
-    {16380852200735282901ULL, 1, {53, 46, 0x0}},
-    {10611652356716532963ULL, 5, {43, 51, 0x0}},
-    {2377697397716333952ULL, 3, {21, 6, 0x0}},
-    {42473966088310528ULL, 4, {29, 36, 0x1}},
-    {1346590116790759398ULL, 1, {19, 11, 0x0}},
-    {3869015987921299603ULL, 1, {38, 54, 0x2}},
-    {18278701602224634493ULL, 4, {36, 29, 0x1}},
-    {14671375724513095326ULL, 4, {21, 6, 0x0}},
-    {14724152048718621144ULL, 4, {36, 42, 0x1}},
-    {8422942228386859655ULL, 22, {57, 59, 0x40}},
-    {6122447396797997856ULL, 9, {49, 58, 0x0}},
-    {7739810275036596223ULL, 17, {54, 61, 0x0}},
-    {11316460293833947899ULL, 15, {21, 6, 0x0}},
-    {14478622848732650059ULL, 11, {17, 9, 0x0}},
-    {14982825262317278076ULL, 4, {29, 13, 0x2}},
-    {11122962306203757051ULL, 4, {49, 58, 0x0}},
-    {15853327233346339567ULL, 1, {27, 11, 0x2}},
-    {14909814228649404875ULL, 1, {35, 51, 0x2}},
-    {14262860762636867452ULL, 1, {28, 12, 0x2}},
-    {17062104511720056560ULL, 1, {23, 15, 0x0}},
-    {1974160215403994623ULL, 1, {21, 30, 0x1}},
-    {7959766696922578202ULL, 2, {36, 52, 0x2}},
-    {6084865322175809795ULL, 2, {31, 4, 0x0}},
-    {2530102193922880664ULL, 2, {45, 62, 0x0}},
-    {5253188121204829967ULL, 2, {42, 57, 0x0}},
-    {7233843201462449933ULL, 2, {21, 6, 0x0}},
-    {18034131540365824595ULL, 2, {37, 53, 0x2}},
-    {7228972487165871ULL, 2, {36, 28, 0x0}},
-    {9147797300444633922ULL, 3, {44, 52, 0x0}},
-    {14764886521043386317ULL, 5, {34, 50, 0x2}},
-    {15471780677375328054ULL, 1, {18, 1, 0x0}},
-    {9391953128620828480ULL, 1, {42, 57, 0x0}},
-    {3709317945283016017ULL, 1, {17, 9, 0x0}},
-    {14864118359694271395ULL, 1, {43, 51, 0x0}},
-    {15454196075117080876ULL, 1, {9, 2, 0x0}},
-    {14999619246349216546ULL, 1, {36, 52, 0x2}},
-    {11796615397294343783ULL, 1, {1, 3, 0x40}},
-    {15819976734682014716ULL, 1, {44, 58, 0x0}},
-    {17908098039236078199ULL, 1, {9, 2, 0x0}},
-    {9050707863558611114ULL, 1, {36, 52, 0x2}},
-    {9702525227242907313ULL, 1, {22, 4, 0x0}},
-    {1087829851705193483ULL, 1, {29, 36, 0x1}},
-    {16166384984392802666ULL, 1, {43, 51, 0x0}},
-    {13058784445151802878ULL, 1, {33, 5, 0x0}},
-    {1050224721378092142ULL, 1, {40, 48, 0x0}},
-    {10596548895527182865ULL, 1, {24, 33, 0x0}},
-    {15693833181435269755ULL, 1, {46, 54, 0x0}},
-    {1425020569049334742ULL, 1, {19, 11, 0x0}},
-    {10615626035952050941ULL, 1, {54, 61, 0x0}},
-    {188692947242122750ULL, 9, {51, 58, 0x0}},
-    {14066936134873869619ULL, 7, {24, 8, 0x2}},
-    {11817416701206178060ULL, 1, {57, 59, 0x40}},
-    {12872666619662034762ULL, 3, {57, 59, 0x40}},
-    {11520797421439669086ULL, 3, {9, 2, 0x0}},
-    {18107926669044681207ULL, 3, {36, 52, 0x2}},
-    {15178710260014237150ULL, 8, {28, 12, 0x2}},
-    {16769940570881657008ULL, 6, {42, 57, 0x0}},
-    {10331459553381165467ULL, 3, {47, 55, 0x0}},
-    {14035217114420712781ULL, 1, {29, 13, 0x2}},
-    {17522276463236900188ULL, 1, {45, 62, 0x0}},
-    {8807223388999043273ULL, 1, {28, 12, 0x2}},
-    {3167433037635495492ULL, 1, {28, 37, 0x1}},
-    {12488065952446216286ULL, 1, {28, 18, 0x1}},
-    {15085865362834083066ULL, 1, {35, 51, 0x2}},
-    {16737318500190807828ULL, 5, {18, 1, 0x0}},
-    {5072961277340380631ULL, 2, {45, 62, 0x0}},
-    {3097855899277558959ULL, 2, {18, 1, 0x0}},
-    {8579051395577469150ULL, 2, {35, 51, 0x2}},
-    {2678608122075465559ULL, 1, {29, 2, 0x0}},
-    {4014187189509302547ULL, 6, {35, 51, 0x2}},
-    {17194288512067949122ULL, 6, {14, 5, 0x0}},
-    {4307240967882649019ULL, 6, {45, 62, 0x0}},
-    {14124000791513400105ULL, 6, {19, 11, 0x0}},
-    {14627525796001050548ULL, 5, {42, 57, 0x0}},
-    {9844238094151158708ULL, 4, {38, 2, 0x0}},
-    {16079838069394318863ULL, 4, {44, 58, 0x0}},
-    {17563019226101926097ULL, 1, {11, 1, 0x0}},
-    {15284880592684687562ULL, 1, {47, 55, 0x0}},
-    {17009048183442145544ULL, 4, {18, 1, 0x0}},
-    {5479499687742859496ULL, 2, {43, 51, 0x0}},
-    {585650518667726309ULL, 2, {1, 3, 0x40}},
-    {11018936152478258673ULL, 2, {47, 55, 0x0}},
-    {2893989887187591113ULL, 1, {18, 1, 0x0}},
-    {10909025710599414903ULL, 1, {49, 58, 0x0}},
-    {3466013003869596279ULL, 1, {19, 11, 0x0}},
-    {17941578739202831579ULL, 9, {20, 12, 0x0}},
-    {9264254154950410274ULL, 7, {57, 59, 0x40}},
-    {672891751845276267ULL, 14, {1, 3, 0x40}},
-    {14801662614010119941ULL, 5, {29, 13, 0x2}},
-    {15870348251070444762ULL, 5, {43, 51, 0x0}},
-    {8704901504534309549ULL, 10, {36, 42, 0x1}},
-    {2186601588352686345ULL, 9, {27, 11, 0x2}},
-    {10229544222541881384ULL, 9, {21, 36, 0x1}},
-    {2340727807478951554ULL, 1, {38, 54, 0x2}},
-    {1317209463742482544ULL, 1, {12, 6, 0x0}},
-    {4006738480636222661ULL, 1, {29, 38, 0x1}},
-    {7862536910256076766ULL, 1, {29, 12, 0x1}},
-    {490804058541181186ULL, 1, {36, 52, 0x2}},
-    {14052924361077828856ULL, 1, {51, 58, 0x0}},
-    {18144441598318232976ULL, 1, {9, 2, 0x0}},
-    {15276424450704986580ULL, 1, {57, 59, 0x40}},
-    {2666486151169651262ULL, 1, {1, 3, 0x40}},
-    {7303407011012779371ULL, 1, {36, 52, 0x2}},
-    {5536440748729165775ULL, 2, {35, 51, 0x2}},
-    {17737043026969287528ULL, 2, {9, 2, 0x0}},
-    {6105018548052386563ULL, 1, {44, 52, 0x0}},
-    {3668402702173799431ULL, 1, {29, 13, 0x2}},
-    {16450512401097393990ULL, 1, {34, 50, 0x2}},
-    {14049785757474249596ULL, 1, {20, 12, 0x0}},
-    {17241590091840813457ULL, 1, {42, 57, 0x0}},
-    {8952849564472207391ULL, 1, {21, 6, 0x0}},
-    {4813249622833246509ULL, 1, {51, 58, 0x0}},
-    {1017817944632322248ULL, 9, {17, 9, 0x0}},
-    {17951311593127819798ULL, 6, {45, 62, 0x0}},
-    {9500368267546265977ULL, 6, {9, 2, 0x0}},
-    {14714912053868396420ULL, 2, {41, 49, 0x0}},
-    {6969967407822763305ULL, 1, {28, 12, 0x2}},
-    {4704326802047288427ULL, 1, {49, 58, 0x0}},
-    {1542558454087408499ULL, 3, {52, 62, 0x0}},
-    {16576340125263318608ULL, 1, {41, 49, 0x0}},
-    {12740151416612145407ULL, 1, {28, 12, 0x2}},
-    {16871081215536574553ULL, 1, {28, 35, 0x1}},
-    {8001711469908866168ULL, 1, {33, 5, 0x0}},
-    {11280399377595275433ULL, 1, {40, 48, 0x0}},
-    {15986124350959340318ULL, 1, {24, 33, 0x0}},
-    {5617848682939648388ULL, 1, {33, 49, 0x2}},
-    {973162462129454109ULL, 1, {19, 11, 0x0}},
-    {5023252946413158808ULL, 1, {49, 58, 0x0}},
-    {6786676026449314851ULL, 1, {17, 24, 0x0}},
-    {4165604219401622541ULL, 1, {44, 52, 0x0}},
-    {7513718561077675328ULL, 2, {26, 5, 0x0}},
-    {12884632225743054601ULL, 1, {41, 49, 0x0}},
-    {14124021295202225724ULL, 1, {21, 6, 0x0}},
-    {10035563739324593827ULL, 1, {49, 58, 0x0}},
-    {6620288593899286023ULL, 1, {27, 11, 0x2}},
-    {17541791095697374391ULL, 1, {45, 62, 0x0}},
-    {17733885169485483915ULL, 1, {36, 28, 0x0}},
-    {18064900660289856072ULL, 1, {62, 45, 0x0}},
-    {10342381966893010432ULL, 3, {49, 58, 0x0}},
-    {14005624384687253472ULL, 3, {21, 6, 0x0}},
-    {14046679179112457962ULL, 2, {45, 62, 0x0}},
-    {7727675296158958932ULL, 2, {36, 28, 0x0}},
-    {16023893542986799360ULL, 2, {35, 45, 0x0}},
-    {3300256014667870026ULL, 1, {46, 52, 0x0}},
-    {9028429106017927757ULL, 1, {17, 9, 0x0}},
-    {12568762684078236812ULL, 1, {41, 49, 0x0}},
-    {7930727457875207806ULL, 1, {22, 14, 0x0}},
-    {709261479398769638ULL, 1, {49, 58, 0x0}},
-    {1162655463028370313ULL, 1, {14, 5, 0x0}},
-    {2889929890316926011ULL, 1, {36, 52, 0x2}},
-    {12179545257381228895ULL, 1, {45, 62, 0x0}},
-    {13453866467402992141ULL, 1, {18, 1, 0x0}},
-    {2539549800177039240ULL, 3, {25, 61, 0x0}},
-    {15806064578058778728ULL, 1, {20, 12, 0x0}},
-    {12871896104873327407ULL, 1, {52, 62, 0x0}},
-    {1446729629158479017ULL, 1, {16, 8, 0x0}},
-    {14232161385168274452ULL, 1, {32, 25, 0x0}},
-    {8396167835030265523ULL, 1, {18, 1, 0x0}},
-    {6421891808251960010ULL, 1, {18, 32, 0x1}},
-    {1134272023716330017ULL, 5, {47, 55, 0x0}},
-    {9685414171162372639ULL, 5, {28, 12, 0x2}},
-    {74772303924730139ULL, 5, {28, 37, 0x1}},
-    {4570717200009951742ULL, 5, {28, 18, 0x1}},
-    {9176897335069304700ULL, 9, {17, 9, 0x0}},
-    {17713910236975932114ULL, 5, {45, 62, 0x0}},
-    {8327993303234700596ULL, 4, {9, 2, 0x0}},
-    {272309117818777353ULL, 3, {41, 49, 0x0}},
-    {14824081911839906707ULL, 1, {1, 3, 0x40}},
-    {8491811931117606660ULL, 1, {49, 58, 0x0}},
-    {1634911737309237060ULL, 3, {29, 13, 0x2}},
-    {13404751211069413523ULL, 2, {35, 51, 0x2}},
-    {4800344975375356952ULL, 1, {19, 11, 0x0}},
-    {13087764101110060548ULL, 1, {42, 57, 0x0}},
-    {15614808749553031970ULL, 1, {18, 1, 0x0}},
-    {5704785486228255402ULL, 2, {45, 53, 0x0}},
-    {3788825767152871394ULL, 4, {52, 62, 0x0}},
-    {17905593382394388158ULL, 1, {35, 51, 0x2}},
-    {11687089721146168058ULL, 1, {29, 2, 0x1}},
-    {13083736846456690667ULL, 1, {28, 35, 0x1}},
-    {6491736691617377108ULL, 1, {28, 19, 0x1}},
-    {18131455263535361834ULL, 1, {42, 57, 0x0}},
-    {13003266174063986401ULL, 12, {36, 52, 0x2}},
-    {10312605320040851985ULL, 12, {9, 2, 0x0}},
-    {5964162417892050927ULL, 2, {29, 36, 0x1}},
-    {9400639351158213387ULL, 2, {31, 4, 0x0}},
-    {14617925654710251079ULL, 2, {52, 62, 0x0}},
-    {943857438916438423ULL, 1, {18, 1, 0x0}},
-    {4417015104152959576ULL, 3, {47, 55, 0x0}},
-    {6279419389070596696ULL, 1, {45, 53, 0x0}},
-    {16910873182433450079ULL, 1, {27, 11, 0x2}},
-    {7656088573914937899ULL, 1, {35, 51, 0x2}},
-    {12918184429528605887ULL, 1, {18, 1, 0x0}},
-    {17936655032207322572ULL, 1, {30, 58, 0x0}},
-    {191698237389264788ULL, 1, {35, 18, 0x1}},
-    {15412508745311090809ULL, 1, {57, 59, 0x40}},
-    {8188711911683670460ULL, 5, {47, 55, 0x0}},
-    {6995287197769167681ULL, 1, {19, 11, 0x0}},
-    {6696381459632195095ULL, 1, {29, 36, 0x1}},
-    {13906417954511346675ULL, 5, {22, 14, 0x0}},
-    {6265808162910730257ULL, 2, {51, 58, 0x0}},
-    {12109889539175594993ULL, 1, {14, 5, 0x0}},
-    {2710747474936077997ULL, 1, {57, 59, 0x40}},
-    {6627323009912906888ULL, 1, {35, 51, 0x2}},
-    {5730627460335038324ULL, 1, {18, 1, 0x0}},
-    {12703853873740489485ULL, 1, {45, 62, 0x0}},
-    {3918232377858043104ULL, 1, {29, 2, 0x0}},
-    {6360856397742740939ULL, 1, {53, 60, 0x0}},
-    {1114990875089469523ULL, 1, {1, 3, 0x40}},
-    {16026139249690003329ULL, 1, {51, 58, 0x0}},
-    {9735890692923938283ULL, 1, {19, 11, 0x0}},
-    {8652740999533214637ULL, 2, {18, 1, 0x0}},
-    {4481191155974191812ULL, 3, {41, 49, 0x0}},
-    {12992500511682277152ULL, 8, {21, 6, 0x0}},
-    {12886379800431348820ULL, 4, {12, 6, 0x0}},
-    {17037432886962653192ULL, 2, {36, 52, 0x2}},
-    {13003905886516079745ULL, 2, {19, 11, 0x0}},
-    {5077746695879041030ULL, 1, {49, 58, 0x0}},
-    {15066403302076971087ULL, 1, {30, 14, 0x2}},
-    {13467217899929504323ULL, 1, {46, 54, 0x0}},
-    {7748692583649315031ULL, 4, {12, 4, 0x0}},
-    {7750887935427353486ULL, 2, {52, 62, 0x0}},
-    {4094399477551906857ULL, 1, {43, 51, 0x0}},
-    {11859271879377652880ULL, 1, {21, 6, 0x0}},
-    {15545691668011886600ULL, 2, {34, 50, 0x2}},
-    {310937205469418843ULL, 1, {12, 5, 0x0}},
-    {7590479122305006323ULL, 1, {42, 57, 0x0}},
-    {4762473953496873755ULL, 14, {36, 27, 0x1}},
-    {5626127625140137532ULL, 4, {36, 43, 0x1}},
-    {10124210662019022835ULL, 3, {18, 1, 0x0}},
-    {1084424692686883202ULL, 2, {45, 62, 0x0}},
-    {17791765001825661139ULL, 1, {29, 2, 0x0}},
-    {3596286517426049807ULL, 1, {42, 57, 0x0}},
-    {8822340984871530403ULL, 2, {1, 3, 0x40}},
-    {15292182069324320247ULL, 2, {27, 42, 0x1}},
-    {18199251077287288567ULL, 1, {32, 4, 0x0}},
-    {5728361461735919432ULL, 1, {37, 53, 0x2}},
-    {2895546725888111521ULL, 2, {59, 58, 0x0}},
-    {14079786836315397439ULL, 2, {53, 60, 0x0}},
-    {18379741013536072485ULL, 2, {21, 6, 0x0}},
-    {7556582420055430143ULL, 2, {43, 51, 0x0}},
-    {11214941578300297656ULL, 4, {17, 9, 0x0}},
-    {11871090834686981037ULL, 1, {37, 53, 0x2}},
-    {9074642151402171881ULL, 1, {36, 28, 0x0}},
-    {6448505379912021236ULL, 1, {43, 51, 0x0}},
-    {18291790701760524058ULL, 1, {29, 13, 0x2}},
-    {3037229842427146040ULL, 1, {36, 43, 0x1}},
-    {13627577292328807427ULL, 3, {38, 54, 0x2}},
-    {16875726397009642708ULL, 2, {36, 29, 0x1}},
-    {13551234666625468717ULL, 2, {36, 42, 0x1}},
-    {8328677879379439582ULL, 1, {36, 52, 0x2}},
-    {6880499474982597015ULL, 1, {44, 52, 0x0}},
-    {10591965684681029931ULL, 1, {21, 6, 0x0}},
-    {12291903886728591897ULL, 1, {41, 49, 0x0}},
-    {17839745566163824242ULL, 1, {18, 1, 0x0}},
-    {8194172460790505044ULL, 1, {49, 58, 0x0}},
-    {17002836538408447309ULL, 4, {43, 51, 0x0}},
-    {7890823158783700341ULL, 2, {34, 50, 0x2}},
-    {15844361954421418703ULL, 1, {20, 2, 0x0}},
-    {9719045727164459558ULL, 1, {42, 57, 0x0}},
-    {12876891438278381369ULL, 3, {42, 57, 0x0}},
-    {8001711469908866168ULL, 1, {27, 11, 0x2}},
-    {16806692610013496090ULL, 1, {27, 34, 0x1}},
-    {15543083409923230470ULL, 1, {21, 6, 0x0}},
-    {13827660929519993527ULL, 1, {42, 57, 0x0}},
-    {2327473275834213946ULL, 1, {33, 5, 0x0}},
-    {5320304692222912795ULL, 1, {45, 53, 0x0}},
-    {18138823188614086316ULL, 1, {18, 10, 0x0}},
-    {17022579313815396799ULL, 1, {36, 52, 0x2}},
-    {6098913703770649056ULL, 13, {21, 6, 0x0}},
-    {13469448620684297881ULL, 5, {17, 9, 0x0}},
-    {5157917732044078804ULL, 2, {29, 36, 0x1}},
-    {6493750555223827656ULL, 2, {9, 2, 0x0}},
-    {2918906726564822926ULL, 1, {41, 49, 0x0}},
-    {5626127625140137532ULL, 10, {36, 60, 0x1}},
-    {11332978746731708037ULL, 8, {18, 1, 0x0}},
-    {16835082142921762744ULL, 8, {28, 37, 0x1}},
-    {1017817944632322248ULL, 9, {21, 13, 0x0}},
-    {8022430359087953291ULL, 4, {42, 57, 0x0}},
-    {12308267893108481527ULL, 3, {35, 27, 0x0}},
-    {4347300704248868129ULL, 3, {36, 42, 0x0}},
-    {4253526023204947980ULL, 3, {29, 2, 0x0}},
-    {10201605747596130334ULL, 3, {44, 52, 0x0}},
-    {15466321103651634401ULL, 1, {26, 5, 0x0}},
-    {11590058485672957364ULL, 1, {46, 54, 0x0}},
-    {6719436621832520274ULL, 1, {36, 28, 0x0}},
-    {12865765256754819323ULL, 1, {51, 58, 0x0}},
-    {840229560024897761ULL, 1, {43, 36, 0x1}},
-    {17085492582626832488ULL, 1, {43, 52, 0x1}},
-    {8959450622482795558ULL, 11, {17, 9, 0x0}},
-    {7362059165797257699ULL, 4, {54, 61, 0x0}},
-    {13892679578175421177ULL, 4, {9, 2, 0x0}},
-    {9209746484468639587ULL, 2, {41, 49, 0x0}},
-    {18008241743026073344ULL, 1, {21, 6, 0x0}},
-    {2871554972380682933ULL, 1, {49, 58, 0x0}},
-    {1036574346454279426ULL, 2, {23, 6, 0x0}},
-    {1062510130089899290ULL, 2, {47, 55, 0x0}},
-    {7500539704247232345ULL, 2, {29, 13, 0x2}},
-    {14991919607099184822ULL, 2, {30, 38, 0x0}},
-    {12731542551486537385ULL, 1, {45, 53, 0x0}},
-    {15491542972227447805ULL, 1, {22, 4, 0x0}},
-    {12172219096012654311ULL, 1, {46, 60, 0x0}},
-    {9770712828427831827ULL, 3, {44, 52, 0x0}},
-    {13439581432322925387ULL, 2, {18, 1, 0x0}},
-    {12170501594698158657ULL, 1, {42, 57, 0x0}},
-    {15504074575115305555ULL, 2, {21, 6, 0x0}},
-    {10444527169228465763ULL, 4, {19, 11, 0x0}},
-    {6613898738838129281ULL, 4, {41, 49, 0x0}},
-    {1627082392457633904ULL, 4, {37, 53, 0x2}},
-    {4014187189509302547ULL, 5, {42, 57, 0x0}},
-    {9333145959374223398ULL, 5, {14, 5, 0x0}},
-    {5733586795510304179ULL, 4, {41, 49, 0x0}},
-    {14177085116817708326ULL, 1, {17, 9, 0x0}},
-    {694270502078510938ULL, 1, {49, 58, 0x0}},
-    {468899396897017307ULL, 1, {9, 2, 0x0}},
-    {7652396286484114399ULL, 1, {37, 53, 0x2}},
-    {18394644541088175796ULL, 1, {29, 13, 0x2}},
-    {16469233390820467603ULL, 1, {45, 62, 0x0}},
-    {1149462635247451623ULL, 5, {12, 5, 0x0}},
-    {2741996631957972976ULL, 3, {57, 59, 0x40}},
-    {6074837467034845662ULL, 3, {18, 1, 0x0}},
-    {9315794736652164644ULL, 2, {46, 54, 0x0}},
-    {12917418249858201547ULL, 1, {11, 2, 0x0}},
-    {6913380266718625943ULL, 1, {42, 57, 0x0}},
-    {3034012692994278010ULL, 1, {1, 3, 0x40}},
-    {510784499912859357ULL, 1, {36, 52, 0x2}},
-    {14912508655231223447ULL, 5, {22, 4, 0x0}},
-    {16949266855950069613ULL, 6, {37, 53, 0x2}},
-    {12537249603252538281ULL, 3, {29, 13, 0x2}},
-    {8232102181674860673ULL, 1, {44, 52, 0x0}},
-    {17188657718858330447ULL, 2, {20, 12, 0x0}},
-    {16696364381012711590ULL, 2, {45, 62, 0x0}},
-    {3667997072327665724ULL, 2, {17, 9, 0x0}},
-    {9533279594238364988ULL, 2, {41, 49, 0x0}},
-    {126397796215575843ULL, 2, {9, 2, 0x0}},
-    {6852949527352061021ULL, 2, {49, 58, 0x0}},
-    {7665478632396520177ULL, 2, {26, 10, 0x2}},
-    {12651340779952581467ULL, 2, {44, 52, 0x0}},
-    {3099917265084810194ULL, 6, {30, 14, 0x2}},
-    {16749991259957636350ULL, 1, {33, 49, 0x2}},
-    {9244673781332340026ULL, 1, {14, 5, 0x0}},
-    {15716178771344594499ULL, 1, {49, 58, 0x0}},
-    {13609340444917774953ULL, 1, {17, 9, 0x0}},
-    {1933723860680260813ULL, 1, {35, 51, 0x2}},
-    {8969677330936906768ULL, 1, {47, 55, 0x0}},
-    {9031485652680936441ULL, 2, {38, 54, 0x2}},
-    {18187600551419456123ULL, 1, {9, 2, 0x0}},
-    {3982791548421669148ULL, 1, {54, 61, 0x0}},
-    {17846851669840453769ULL, 2, {36, 43, 0x1}},
-    {1154708073608477002ULL, 2, {36, 29, 0x1}},
-    {7651834779555413340ULL, 2, {41, 49, 0x0}},
-    {887255215022334696ULL, 2, {27, 35, 0x0}},
-    {7927473974648057776ULL, 3, {17, 9, 0x0}},
-    {4423148137322828883ULL, 3, {49, 58, 0x0}},
-    {16936074908239813515ULL, 3, {9, 2, 0x0}},
-    {14454719697971791844ULL, 3, {44, 52, 0x0}},
-    {12073333035989350333ULL, 4, {27, 11, 0x2}},
-    {7926224147417557259ULL, 1, {42, 57, 0x0}},
-    {2945708095383972749ULL, 1, {11, 1, 0x0}},
-    {3593538930983823070ULL, 1, {57, 59, 0x40}},
-    {5157917732044078804ULL, 2, {34, 61, 0x0}},
-    {9908268964696375135ULL, 2, {21, 6, 0x0}},
-    {9620014142123153037ULL, 2, {43, 51, 0x0}},
-    {2219195368029115391ULL, 3, {42, 57, 0x0}},
-    {17021446775532186470ULL, 3, {20, 12, 0x0}},
-    {7587566075325499722ULL, 2, {35, 51, 0x2}},
-    {5661868455931379567ULL, 2, {18, 1, 0x0}},
-    {4035054425921157265ULL, 2, {44, 58, 0x0}},
-    {8311415289912472750ULL, 1, {1, 3, 0x40}},
-    {17867930500150545519ULL, 1, {57, 59, 0x40}},
-    {16736625676928893282ULL, 5, {36, 52, 0x2}},
-    {15897976919747503107ULL, 2, {21, 13, 0x0}},
-    {15349522559279031008ULL, 2, {44, 52, 0x0}},
-    {7949953625194153246ULL, 7, {17, 9, 0x0}},
-    {13568805724748171974ULL, 4, {57, 59, 0x40}},
-    {10075192261137697989ULL, 4, {9, 2, 0x0}},
-    {3957430868384523950ULL, 1, {52, 61, 0x0}},
-    {7961381793481255136ULL, 1, {1, 3, 0x40}},
-    {7401498540477490975ULL, 1, {49, 58, 0x0}},
-    {2769349522364596657ULL, 3, {18, 1, 0x0}},
-    {13597165472777856074ULL, 2, {45, 62, 0x0}},
-    {17822678757728540690ULL, 1, {21, 13, 0x0}},
-    {3205116026727247601ULL, 1, {42, 57, 0x0}},
-    {974579608276137956ULL, 3, {41, 49, 0x0}},
-    {2875828653044774410ULL, 1, {57, 42, 0x0}},
-    {12279448281110251876ULL, 1, {21, 13, 0x0}},
-    {9368555055973427104ULL, 1, {37, 53, 0x2}},
-    {7585785385337761577ULL, 3, {21, 6, 0x0}},
-    {4039853611623084364ULL, 3, {44, 52, 0x0}},
-    {12982068477291364801ULL, 3, {27, 11, 0x2}},
-    {3159960464857606070ULL, 1, {37, 53, 0x2}},
-    {9146050789513285294ULL, 1, {36, 28, 0x0}},
-    {7016855822895900839ULL, 2, {43, 51, 0x0}},
-    {5606354080358853735ULL, 5, {37, 53, 0x2}},
-    {8316916072923891653ULL, 5, {21, 6, 0x0}},
-    {4768491383048242903ULL, 1, {44, 52, 0x0}},
-    {545649488478738326ULL, 1, {23, 15, 0x0}},
-    {13031052076154028648ULL, 1, {45, 62, 0x0}},
-    {11702902790697243436ULL, 1, {12, 6, 0x0}},
-    {13060273225008306171ULL, 1, {57, 59, 0x40}},
-    {5964162417892050927ULL, 9, {42, 57, 0x0}},
-    {2257090688863118597ULL, 8, {18, 1, 0x0}},
-    {7973501314323608374ULL, 6, {28, 36, 0x0}},
-    {15259961909752990109ULL, 4, {1, 3, 0x40}},
-    {8930665223285187834ULL, 4, {37, 53, 0x2}},
-    {4429722800411233674ULL, 6, {49, 58, 0x0}},
-    {8345380376816833621ULL, 6, {27, 11, 0x2}},
-    {10255980655205209990ULL, 5, {44, 52, 0x0}},
-    {15601617251738118311ULL, 2, {19, 5, 0x0}},
-    {4821448688231228014ULL, 2, {57, 59, 0x40}},
-    {11250468789413619888ULL, 3, {29, 13, 0x2}},
-    {8768012393771337385ULL, 3, {29, 36, 0x1}},
-    {7265553120916877664ULL, 2, {23, 6, 0x0}},
-    {4942634458414707003ULL, 2, {49, 58, 0x0}},
-    {14110613860597664798ULL, 2, {29, 23, 0x1}},
-    {707686794693055316ULL, 2, {45, 62, 0x0}},
-    {9920121575557290596ULL, 1, {11, 1, 0x0}},
-    {6122228294476936540ULL, 2, {41, 49, 0x0}},
-    {8095319833244324667ULL, 2, {28, 12, 0x2}},
-    {11118614517342831262ULL, 2, {28, 37, 0x1}},
-    {16456659206539656905ULL, 2, {28, 11, 0x1}},
-    {672891751845276267ULL, 7, {21, 6, 0x0}},
-    {15767550864983308635ULL, 1, {40, 48, 0x0}},
-    {3274043524460057271ULL, 3, {18, 1, 0x0}},
-    {10100742339833871137ULL, 3, {42, 57, 0x0}},
-    {5932018617549272852ULL, 1, {20, 2, 0x0}},
-    {2117855134427549590ULL, 1, {37, 53, 0x2}},
-    {3952992680209769981ULL, 1, {45, 62, 0x0}},
-    {12724752286453741638ULL, 1, {19, 11, 0x0}},
-    {16627130665657605774ULL, 1, {36, 52, 0x2}},
-    {9720808026548882503ULL, 2, {33, 5, 0x0}},
-    {1223832161122134841ULL, 2, {49, 58, 0x0}},
-    {16044626701759485250ULL, 1, {12, 4, 0x0}},
-    {8108676267851086440ULL, 1, {40, 48, 0x0}},
-    {8163029570126985157ULL, 2, {22, 14, 0x0}},
-    {15024480724403556626ULL, 2, {49, 58, 0x0}},
-    {8080114785125192571ULL, 2, {14, 5, 0x0}},
-    {14317931068357060781ULL, 2, {57, 59, 0x40}},
-    {17291056249465375489ULL, 2, {17, 9, 0x0}},
-    {18414656148149789377ULL, 1, {46, 54, 0x0}},
-    {9169622694104440521ULL, 10, {28, 12, 0x2}},
-    {7620948258158937510ULL, 3, {43, 51, 0x0}},
-    {6803142323179306268ULL, 1, {37, 53, 0x2}},
-    {17717565933533024088ULL, 1, {9, 2, 0x0}},
-    {12820173554855631286ULL, 1, {45, 62, 0x0}},
-    {14712829162127049420ULL, 1, {21, 6, 0x0}},
-    {17634482788067829918ULL, 2, {41, 49, 0x0}},
-    {15446006290334099400ULL, 2, {18, 1, 0x0}},
-    {14210434252865569227ULL, 2, {35, 51, 0x2}},
-    {17973348622245705243ULL, 1, {42, 57, 0x0}},
-    {6421975591379017013ULL, 1, {21, 6, 0x0}},
-    {16479042260086204431ULL, 1, {35, 51, 0x2}},
-    {8102900898980577380ULL, 1, {36, 52, 0x2}},
-    {16844206851289119157ULL, 1, {18, 1, 0x0}},
-    {14830218056370896118ULL, 1, {49, 58, 0x0}},
-    {8742841718250770058ULL, 1, {31, 4, 0x0}},
-    {10280122802349018219ULL, 1, {45, 53, 0x0}},
-    {4043274517640586716ULL, 5, {45, 38, 0x1}},
-    {1569748732633614941ULL, 5, {45, 54, 0x1}},
-    {14414773230134547662ULL, 5, {1, 3, 0x40}},
-    {12070266678750962379ULL, 3, {35, 51, 0x2}},
-    {6995287197769167681ULL, 4, {36, 29, 0x1}},
-    {16312229832476337426ULL, 5, {36, 43, 0x1}},
-    {12772366688609568166ULL, 11, {45, 53, 0x0}},
-    {12363383796802578879ULL, 6, {1, 3, 0x40}},
-    {12691223179385516484ULL, 2, {43, 51, 0x0}},
-    {16933381364790634389ULL, 1, {16, 8, 0x0}},
-    {9799345702950957981ULL, 1, {32, 25, 0x0}},
-    {2090097753326651100ULL, 2, {45, 62, 0x0}},
-    {10890416690863827587ULL, 2, {51, 58, 0x0}},
-    {1831608642613968858ULL, 1, {22, 28, 0x0}},
-    {9968092597069882502ULL, 1, {30, 58, 0x0}},
-    {9975603925005967238ULL, 9, {25, 61, 0x0}},
-    {8320317449139256874ULL, 1, {28, 12, 0x2}},
-    {16244862923131964937ULL, 1, {52, 62, 0x0}},
-    {8001711469908866168ULL, 4, {29, 13, 0x2}},
-    {3006707632192664336ULL, 3, {42, 57, 0x0}},
-    {1793414711660541410ULL, 2, {21, 6, 0x0}},
-    {12000978952792533137ULL, 1, {44, 52, 0x0}},
-    {7930629300105257910ULL, 1, {33, 5, 0x0}},
-    {5639404259105870128ULL, 1, {52, 62, 0x0}},
-    {15764527119931704741ULL, 1, {13, 4, 0x0}},
-    {542533843308148873ULL, 1, {41, 49, 0x0}},
-    {7727470717747927906ULL, 2, {23, 15, 0x0}},
-    {3828013514560793586ULL, 1, {57, 59, 0x40}},
-    {3725861170738813190ULL, 1, {20, 12, 0x0}},
-    {8614909278967521129ULL, 1, {42, 57, 0x0}},
-    {7624903789096250637ULL, 1, {16, 8, 0x0}},
-    {12268314679961850814ULL, 1, {18, 25, 0x1}},
-    {16861246218397967427ULL, 8, {37, 53, 0x2}},
-    {3127575946449152423ULL, 3, {21, 13, 0x0}},
-    {2709471811406604004ULL, 2, {46, 60, 0x0}},
-    {16717052845333013480ULL, 2, {22, 4, 0x0}},
-    {6825444391811535011ULL, 1, {29, 37, 0x0}},
-    {15541371297749655392ULL, 1, {45, 53, 0x0}},
-    {11990030813302913792ULL, 1, {3, 2, 0x0}},
-    {499151131298753557ULL, 1, {57, 59, 0x40}},
-    {11214941578300297656ULL, 21, {26, 5, 0x0}},
-    {11091797539611590023ULL, 5, {41, 49, 0x0}},
-    {266018415002078424ULL, 4, {21, 6, 0x0}},
-    {8579612702522429523ULL, 3, {49, 58, 0x0}},
-    {14480999489121168428ULL, 3, {27, 11, 0x2}},
-    {13166198032920128500ULL, 3, {44, 52, 0x0}},
-    {15056516110695468934ULL, 3, {12, 4, 0x0}},
-    {3380289427257159865ULL, 3, {57, 59, 0x40}},
-    {8102900898980577380ULL, 2, {49, 58, 0x0}},
-    {7735770162046157210ULL, 2, {21, 6, 0x0}},
-    {6589658120041875759ULL, 4, {57, 59, 0x40}},
-    {176861427982192260ULL, 1, {18, 1, 0x0}},
-    {11050227760932339762ULL, 1, {42, 57, 0x0}},
-    {5987116548675183042ULL, 1, {36, 29, 0x1}},
-    {4119450019008373013ULL, 1, {36, 43, 0x1}},
-    {12767304288290706910ULL, 1, {22, 14, 0x0}},
-    {440508127501047343ULL, 1, {42, 57, 0x0}},
-    {238134598092198099ULL, 1, {14, 5, 0x0}},
-    {14357792636600166676ULL, 1, {41, 49, 0x0}},
-    {2420094605587132089ULL, 1, {17, 9, 0x0}},
-    {4470409286538879927ULL, 1, {49, 58, 0x0}},
-    {4762473953496873755ULL, 1, {37, 28, 0x1}},
-    {15370636574571035465ULL, 1, {37, 58, 0x1}},
-    {6570990682944158877ULL, 1, {20, 2, 0x0}},
-    {14396461202487592396ULL, 1, {42, 57, 0x0}},
-    {806414111042674181ULL, 3, {44, 52, 0x0}},
-    {2778451757734466873ULL, 1, {20, 12, 0x0}},
-    {6092508994023809536ULL, 1, {47, 55, 0x0}},
-    {6747563481170891826ULL, 2, {44, 58, 0x0}},
-    {7513718561077675328ULL, 2, {17, 9, 0x0}},
-    {14487355113066472336ULL, 1, {41, 49, 0x0}},
-    {5822382848509794852ULL, 1, {9, 2, 0x0}},
-    {2913630611276084946ULL, 1, {49, 58, 0x0}},
-    {7926224147417557259ULL, 3, {45, 62, 0x0}},
-    {8930855776196646118ULL, 2, {11, 1, 0x0}},
-    {12267341104108409050ULL, 2, {35, 51, 0x2}},
-    {4357831450415185383ULL, 7, {45, 62, 0x0}},
-    {15785635894244981277ULL, 2, {45, 53, 0x0}},
-    {7600728264160325511ULL, 1, {12, 4, 0x0}},
-    {1522984047018390892ULL, 1, {42, 57, 0x0}},
-    {267050811498992697ULL, 3, {9, 2, 0x0}},
-    {13083585178836028171ULL, 1, {43, 51, 0x0}},
-    {898350593499427121ULL, 1, {27, 11, 0x2}},
-    {17620414026409448408ULL, 1, {36, 52, 0x2}},
-    {2870350356154325745ULL, 1, {35, 27, 0x0}},
-    {5508400785683307929ULL, 1, {52, 42, 0x0}},
-    {818503067405763151ULL, 1, {28, 12, 0x2}},
-    {2369658747188698319ULL, 1, {37, 53, 0x2}},
-    {7820819144862538687ULL, 2, {40, 48, 0x0}},
-    {15415169050657797449ULL, 1, {24, 33, 0x0}},
-    {9728722266351763261ULL, 1, {37, 53, 0x2}},
-    {9045299272386944666ULL, 1, {21, 13, 0x0}},
-    {9605922559621454532ULL, 1, {28, 37, 0x1}},
-    {17188657718858330447ULL, 3, {28, 12, 0x2}},
-    {12966532663958330803ULL, 3, {28, 37, 0x1}},
-    {13899877989126732488ULL, 2, {21, 13, 0x0}},
-    {707544836056333417ULL, 2, {21, 28, 0x1}},
-    {10126947271593361913ULL, 2, {21, 6, 0x1}},
-    {9655661651228343898ULL, 2, {45, 62, 0x0}},
-    {4922837600851643802ULL, 2, {29, 2, 0x0}},
-    {16015634392320258500ULL, 1, {43, 51, 0x0}},
-    {4220449201395613495ULL, 10, {22, 14, 0x0}},
-    {12721892020941828192ULL, 2, {25, 61, 0x0}},
-    {8966535503725160205ULL, 1, {35, 18, 0x0}},
-    {18100485491562254856ULL, 1, {32, 48, 0x2}},
-    {6535633542894813682ULL, 1, {25, 35, 0x1}},
-    {3620415946655144319ULL, 1, {25, 32, 0x1}},
-    {1250290496170808361ULL, 1, {19, 11, 0x0}},
-    {10670303278068059726ULL, 1, {42, 57, 0x0}},
-    {16124679052965644032ULL, 2, {1, 3, 0x40}},
-    {17703487712236695804ULL, 2, {43, 51, 0x0}},
-    {15315089471151137809ULL, 1, {16, 8, 0x0}},
-    {16679501043875521942ULL, 1, {32, 25, 0x0}},
-    {13680638196083069633ULL, 1, {21, 6, 0x0}},
-    {15826433042280346140ULL, 1, {24, 60, 0x0}},
-    {1373502392525430976ULL, 1, {11, 3, 0x0}},
-    {889760765928911551ULL, 1, {36, 52, 0x2}},
-    {7118135978578133592ULL, 1, {36, 21, 0x1}},
-    {1475228825024038599ULL, 1, {25, 61, 0x0}},
-    {5012081711401034708ULL, 2, {45, 62, 0x0}},
-    {9565771135229060886ULL, 1, {19, 11, 0x0}},
-    {5311979506466491191ULL, 1, {49, 58, 0x0}},
-    {3348469090030635410ULL, 1, {11, 1, 0x0}},
-    {7111849112272597401ULL, 1, {42, 57, 0x0}},
-    {8285786309667566735ULL, 9, {21, 6, 0x0}},
-    {7941569667949779403ULL, 7, {42, 57, 0x0}},
-    {5712043622602678329ULL, 2, {26, 10, 0x2}},
-    {10243189234603087391ULL, 2, {36, 52, 0x2}},
-    {12972012448405967580ULL, 2, {35, 26, 0x1}},
-    {15170284939089610763ULL, 2, {27, 42, 0x1}},
-    {6895503189410844436ULL, 2, {18, 1, 0x0}},
-    {2093459012773544304ULL, 1, {25, 61, 0x0}},
-    {10501170017635283500ULL, 1, {34, 50, 0x2}},
-    {11792290227248666791ULL, 1, {1, 3, 0x40}},
-    {15258381758310631423ULL, 1, {42, 57, 0x0}},
-    {14126971901331892256ULL, 7, {45, 62, 0x0}},
-    {11241367456505373593ULL, 6, {1, 3, 0x40}},
-    {7781528071341571660ULL, 5, {35, 51, 0x2}},
-    {14370915807794977720ULL, 5, {27, 11, 0x2}},
-    {5323389033445942564ULL, 3, {44, 52, 0x0}},
-    {12156651407697939319ULL, 6, {42, 57, 0x0}},
-    {2589573158679575216ULL, 7, {29, 13, 0x2}},
-    {8377718131709258103ULL, 5, {41, 49, 0x0}},
-    {6188961432683994652ULL, 5, {21, 6, 0x0}},
-    {1011635998477884321ULL, 4, {34, 61, 0x0}},
-    {1604436361618913026ULL, 1, {33, 5, 0x0}},
-    {240099530838607068ULL, 1, {49, 58, 0x0}},
-    {17126951192117276716ULL, 5, {42, 57, 0x0}},
-    {9954553460155283446ULL, 2, {16, 8, 0x0}},
-    {11836117805244609758ULL, 2, {41, 49, 0x0}},
-    {12694204206617854514ULL, 1, {12, 6, 0x0}},
-    {6455934058614994713ULL, 1, {29, 38, 0x1}},
-    {17959475808500748152ULL, 1, {27, 11, 0x2}},
-    {3596685040299112750ULL, 1, {43, 51, 0x0}},
-    {7548622393127657459ULL, 6, {45, 38, 0x1}},
-    {1133601421156760151ULL, 6, {45, 54, 0x1}},
-    {5122769022160911303ULL, 1, {1, 3, 0x40}},
-    {5781340802398765730ULL, 1, {51, 57, 0x0}},
-    {14052924361077828856ULL, 1, {37, 53, 0x2}},
-    {5978595520403372684ULL, 1, {9, 2, 0x0}},
-    {1053059707166217041ULL, 1, {45, 62, 0x0}},
-    {4138905037975220805ULL, 1, {1, 3, 0x40}},
-    {2321907736621156045ULL, 1, {51, 58, 0x0}},
-    {2709471811406604004ULL, 1, {28, 37, 0x1}},
-    {3263596330734302859ULL, 1, {28, 21, 0x1}},
-    {5461682344064370318ULL, 1, {45, 62, 0x0}},
-    {4853601819725163340ULL, 3, {44, 52, 0x0}},
-    {3176364777583782124ULL, 2, {20, 12, 0x0}},
-    {16451047249412261588ULL, 1, {49, 58, 0x0}},
-    {12109531797814807584ULL, 3, {18, 10, 0x0}},
-    {5072474337651933047ULL, 3, {37, 53, 0x2}},
-    {12493866220134162234ULL, 1, {37, 28, 0x1}},
-    {17420342993121999225ULL, 1, {39, 60, 0x0}},
-    {10244116026888229872ULL, 1, {21, 6, 0x0}},
-    {11883256971673008338ULL, 1, {37, 39, 0x1}},
-    {1866326805214807779ULL, 4, {37, 53, 0x2}},
-    {9914374742516261955ULL, 4, {19, 11, 0x0}},
-    {261477852650716008ULL, 3, {45, 62, 0x0}},
-    {3763220057467455070ULL, 1, {21, 6, 0x0}},
-    {13467228824751132972ULL, 1, {28, 37, 0x1}},
-    {5413237604161225658ULL, 1, {28, 19, 0x1}},
-    {2304383845458167546ULL, 1, {47, 55, 0x0}},
-    {11091797539611590023ULL, 4, {37, 53, 0x2}},
-    {1684777482253352025ULL, 2, {36, 28, 0x0}},
-    {13627151637631030236ULL, 1, {44, 52, 0x0}},
-    {2366581133812214499ULL, 1, {21, 6, 0x0}},
-    {2082618502995050809ULL, 1, {47, 55, 0x0}},
-    {7899417245079091287ULL, 1, {31, 15, 0x2}},
-    {8245257606580703834ULL, 1, {35, 51, 0x2}},
-    {10825393252843202608ULL, 1, {28, 36, 0x0}},
-    {11091797539611590023ULL, 2, {43, 51, 0x0}},
-    {7890919460067679784ULL, 1, {12, 6, 0x0}},
-    {2209618419780457931ULL, 1, {54, 61, 0x0}},
-    {14182915815979105983ULL, 1, {18, 1, 0x0}},
-    {22949613504539651ULL, 1, {51, 58, 0x0}},
-    {16615435909344049583ULL, 2, {44, 52, 0x0}},
-    {3178329194637355050ULL, 2, {9, 2, 0x0}},
-    {15306871103187275123ULL, 2, {57, 59, 0x40}},
-    {14483204128172795756ULL, 1, {41, 49, 0x0}},
-    {17392497401996612697ULL, 2, {44, 52, 0x0}},
-    {17871351009244034742ULL, 2, {49, 58, 0x0}},
-    {14844827457311525070ULL, 1, {34, 50, 0x2}},
-    {6009114278758010141ULL, 1, {36, 29, 0x1}},
-    {3919627461027859428ULL, 1, {36, 43, 0x1}},
-    {3314718949377569420ULL, 1, {18, 1, 0x0}},
-    {15168939739780713753ULL, 1, {42, 57, 0x0}},
-    {13034166716182122047ULL, 20, {20, 12, 0x0}},
-    {14622593022499338218ULL, 20, {42, 57, 0x0}},
-    {15903038813817600414ULL, 4, {19, 11, 0x0}},
-    {8727702117965289336ULL, 4, {37, 53, 0x2}},
-    {10113385522770992919ULL, 2, {12, 6, 0x0}},
-    {5555672566170381665ULL, 2, {28, 37, 0x1}},
-    {16519416918840422655ULL, 2, {28, 19, 0x1}},
-    {7953550802410598424ULL, 1, {45, 62, 0x0}},
-    {6279419389070596696ULL, 1, {44, 52, 0x0}},
-    {13016127107112686685ULL, 1, {28, 12, 0x2}},
-    {7548845014752053825ULL, 1, {52, 62, 0x0}},
-    {18066325456659069058ULL, 1, {17, 9, 0x0}},
-    {10422262334597772738ULL, 1, {41, 49, 0x0}},
-    {10656492705057054683ULL, 1, {9, 2, 0x0}},
-    {15326223135747431274ULL, 1, {49, 58, 0x0}},
-    {17822678757728540690ULL, 1, {38, 2, 0x0}},
-    {2293604913627678471ULL, 1, {43, 51, 0x0}},
-    {8120541413462616762ULL, 9, {17, 9, 0x0}},
-    {12438349538819842921ULL, 4, {9, 2, 0x0}},
-    {7156292506547854630ULL, 3, {57, 59, 0x40}},
-    {10467889871248275274ULL, 3, {27, 11, 0x2}},
-    {16389658443756364938ULL, 3, {21, 30, 0x1}},
-    {3865680031249028750ULL, 2, {41, 49, 0x0}},
-    {14012520439647040014ULL, 1, {19, 11, 0x0}},
-    {8844009727778042359ULL, 1, {28, 37, 0x1}},
-    {15241546753085229888ULL, 1, {28, 19, 0x1}},
-    {8477201032121214403ULL, 1, {42, 57, 0x0}},
-    {1079616273192970146ULL, 1, {18, 1, 0x0}},
-    {4893734007807344968ULL, 1, {36, 52, 0x2}},
-    {12289416094396696866ULL, 1, {57, 59, 0x40}},
-    {8782460177020252998ULL, 1, {9, 2, 0x0}},
-    {1499260450206262455ULL, 1, {36, 52, 0x2}},
-    {7585785385337761577ULL, 1, {17, 9, 0x0}},
-    {17413182187553574573ULL, 1, {45, 53, 0x0}},
-    {1314635104228023857ULL, 1, {9, 2, 0x0}},
-    {5085586887257762953ULL, 1, {36, 52, 0x2}},
-    {663739779513221653ULL, 1, {36, 29, 0x1}},
-    {2673615978057517582ULL, 1, {36, 45, 0x1}},
-    {12886379800431348820ULL, 7, {26, 5, 0x0}},
-    {15931883991425908126ULL, 8, {49, 58, 0x0}},
-    {7704161653307979390ULL, 6, {19, 11, 0x0}},
-    {16184777448677083983ULL, 4, {57, 59, 0x40}},
-    {4696501130215246013ULL, 4, {11, 2, 0x0}},
-    {1110089781236343827ULL, 4, {44, 52, 0x0}},
-    {12721892020941828192ULL, 3, {42, 57, 0x0}},
-    {9844604606344174988ULL, 3, {14, 5, 0x0}},
-    {15375591455635873806ULL, 4, {43, 51, 0x0}},
-    {14185263731809176244ULL, 2, {17, 9, 0x0}},
-    {6035871590717364595ULL, 1, {51, 58, 0x0}},
-    {4266757054268296781ULL, 1, {9, 2, 0x0}},
-    {14007790439408489476ULL, 1, {57, 59, 0x40}},
-    {14500376946479100129ULL, 1, {46, 54, 0x0}},
-    {6726963395321946946ULL, 1, {27, 11, 0x2}},
-    {13610454907682602994ULL, 1, {37, 53, 0x2}},
-    {15437154050935256964ULL, 1, {28, 4, 0x1}},
-    {16010597998710671755ULL, 1, {45, 62, 0x0}},
-    {7510550525157357920ULL, 1, {38, 2, 0x0}},
-    {11957626478748590210ULL, 1, {52, 61, 0x0}},
-    {17569587732497452335ULL, 2, {12, 30, 0x1}},
-    {15678505194245743068ULL, 2, {20, 2, 0x0}},
-    {4387294570606605392ULL, 1, {21, 30, 0x1}},
-    {7982469204463321955ULL, 1, {36, 52, 0x2}},
-    {17244396857156160822ULL, 1, {36, 29, 0x1}},
-    {13567480777305120656ULL, 1, {36, 43, 0x1}},
-    {3191478979579164346ULL, 12, {21, 13, 0x0}},
-    {8783275223403311351ULL, 12, {42, 57, 0x0}},
-    {3721014726486387117ULL, 6, {20, 38, 0x0}},
-    {4633505339883673162ULL, 1, {41, 49, 0x0}},
-    {14404609107317248067ULL, 2, {45, 62, 0x0}},
-    {15375591455635873806ULL, 1, {37, 53, 0x2}},
-    {6636030340945991153ULL, 1, {19, 11, 0x0}},
-    {15707452986165409210ULL, 1, {43, 51, 0x0}},
-    {12649129848372953693ULL, 1, {29, 13, 0x2}},
-    {14175409078462047868ULL, 2, {45, 62, 0x0}},
-    {8328677879379439582ULL, 1, {37, 53, 0x2}},
-    {10475042040070915665ULL, 1, {17, 9, 0x0}},
-    {37537453654022859ULL, 1, {46, 54, 0x0}},
-    {16315039211288720736ULL, 1, {9, 2, 0x0}},
-    {7017485798467516809ULL, 1, {54, 61, 0x0}},
-    {3602389145463028219ULL, 1, {21, 6, 0x0}},
-    {3334828069241521733ULL, 1, {42, 57, 0x0}},
-    {169171433229631623ULL, 4, {17, 9, 0x0}},
-    {10231223605290625048ULL, 2, {25, 61, 0x0}},
-    {8739327024416649535ULL, 1, {9, 2, 0x0}},
-    {3746281589159749224ULL, 1, {43, 51, 0x0}},
-    {15244036935758725705ULL, 1, {36, 29, 0x1}},
-    {11220859364363063721ULL, 1, {18, 25, 0x1}},
-    {7587566075325499722ULL, 1, {37, 53, 0x2}},
-    {5949039013920863633ULL, 1, {18, 1, 0x0}},
-    {3443769833341624863ULL, 1, {45, 62, 0x0}},
-    {14425747161829689835ULL, 1, {1, 3, 0x40}},
-    {14804006501146087607ULL, 1, {41, 49, 0x0}},
-    {11871090834686981037ULL, 2, {41, 49, 0x0}},
-    {13118109070660017807ULL, 2, {9, 2, 0x0}},
-    {16119141201891496473ULL, 2, {36, 52, 0x2}},
-    {4325179797362092136ULL, 1, {29, 13, 0x2}},
-    {1887964693308686668ULL, 1, {45, 53, 0x0}},
-    {14349640613882398154ULL, 1, {31, 4, 0x0}},
-    {13056737717640939829ULL, 1, {34, 50, 0x2}},
-    {15909644112130344852ULL, 1, {28, 12, 0x2}},
-    {16343259991232979185ULL, 1, {42, 57, 0x0}},
-    {9861593963254953655ULL, 1, {13, 4, 0x0}},
-    {10929289742768591571ULL, 1, {43, 51, 0x0}},
-    {7273200659581926865ULL, 1, {18, 1, 0x0}},
-    {107126674516514419ULL, 1, {54, 61, 0x0}},
-    {9994094141098002072ULL, 1, {47, 55, 0x0}},
-    {14906832943242073855ULL, 1, {1, 3, 0x40}},
-    {9744492948846349019ULL, 1, {43, 51, 0x0}},
-    {568641686053123874ULL, 2, {27, 11, 0x2}},
-    {8213525703186570112ULL, 2, {54, 61, 0x0}},
-    {8559430163502506544ULL, 2, {20, 2, 0x0}},
-    {1673354095691437116ULL, 1, {34, 50, 0x2}},
-    {5695227468681863963ULL, 1, {34, 27, 0x1}},
-    {10174218304895669824ULL, 1, {30, 58, 0x0}},
-    {15897976919747503107ULL, 1, {21, 6, 0x0}},
-    {2957571602581058142ULL, 1, {44, 52, 0x0}},
-    {16715324912760771006ULL, 1, {29, 13, 0x2}},
-    {457739887388504019ULL, 1, {28, 37, 0x1}},
-    {13113832657941070234ULL, 1, {11, 1, 0x0}},
-    {17740310931603245709ULL, 1, {45, 62, 0x0}},
-    {4427255842915037872ULL, 1, {9, 2, 0x0}},
-    {1257171865369730828ULL, 1, {57, 59, 0x40}},
-    {15871311355326417738ULL, 1, {46, 54, 0x0}},
-    {17432009091388267619ULL, 1, {27, 11, 0x2}},
-    {1977369784090397672ULL, 1, {54, 61, 0x0}},
-    {10236836987246049810ULL, 1, {20, 2, 0x0}},
-    {6386867407666156985ULL, 1, {37, 53, 0x2}},
-    {8385786420915341331ULL, 1, {1, 3, 0x40}},
-    {11483996174646271070ULL, 1, {28, 37, 0x1}},
-    {14844827457311525070ULL, 3, {47, 55, 0x0}},
-    {12228907695749211395ULL, 3, {36, 29, 0x1}},
-    {18054640850853446350ULL, 3, {36, 43, 0x1}},
-    {6465019514951830235ULL, 3, {18, 1, 0x0}},
-    {5253188121204829967ULL, 1, {34, 61, 0x0}},
-    {3159960464857606070ULL, 1, {42, 57, 0x0}},
-    {9867796225464216286ULL, 1, {52, 62, 0x0}},
-    {196176948054795775ULL, 2, {28, 37, 0x1}},
-    {2399245229915384733ULL, 2, {28, 19, 0x1}},
-    {11555061940069480104ULL, 1, {51, 58, 0x0}},
-    {14912508655231223447ULL, 6, {19, 11, 0x0}},
-    {13448610030005351832ULL, 2, {51, 58, 0x0}},
-    {15358238678315362549ULL, 2, {18, 1, 0x0}},
-    {1730068856936562750ULL, 2, {44, 52, 0x0}},
-    {4612158134553866464ULL, 6, {44, 30, 0x0}},
-    {7167454292758700144ULL, 2, {43, 51, 0x0}},
-    {17525189418810427092ULL, 2, {9, 2, 0x0}},
-    {16828880233011369855ULL, 2, {36, 52, 0x2}},
-    {2758470280651048588ULL, 2, {1, 3, 0x40}},
-    {6880499474982597015ULL, 8, {45, 53, 0x0}},
-    {17289911072901296405ULL, 4, {18, 1, 0x0}},
-    {15165090375960782231ULL, 4, {27, 35, 0x0}},
-    {10485343718699915853ULL, 4, {28, 18, 0x0}},
-    {8164859315934580725ULL, 2, {36, 52, 0x2}},
-    {3133931215092272447ULL, 2, {27, 36, 0x1}},
-    {14791779790448904031ULL, 2, {21, 6, 0x0}},
-    {14125614834009875953ULL, 2, {42, 57, 0x0}},
-    {12686192301561948743ULL, 2, {11, 4, 0x0}},
-    {16299410025516671526ULL, 1, {30, 58, 0x0}},
-    {6880499474982597015ULL, 2, {45, 62, 0x0}},
-    {9865772571212174960ULL, 2, {21, 6, 0x0}},
-    {16900398627141144394ULL, 1, {37, 58, 0x0}},
-    {17157036753470320711ULL, 1, {31, 21, 0x0}},
-    {10045509492647265925ULL, 1, {51, 37, 0x0}},
-    {1540265533518731173ULL, 1, {42, 57, 0x0}},
-    {1555089724608855539ULL, 1, {1, 3, 0x40}},
-    {14237563128855007908ULL, 1, {27, 34, 0x1}},
-    {14968096081227615330ULL, 7, {21, 13, 0x0}},
-    {6242475919740069587ULL, 4, {41, 49, 0x0}},
-    {2741996631957972976ULL, 2, {36, 52, 0x2}},
-    {15502790568626811337ULL, 2, {19, 11, 0x0}},
-    {7528514683445416321ULL, 2, {57, 59, 0x40}},
-    {13521105088988198766ULL, 7, {11, 4, 0x0}},
-    {4424976813206090745ULL, 2, {44, 58, 0x0}},
-    {16295225101571396706ULL, 1, {18, 1, 0x0}},
-    {15415169050657797449ULL, 1, {42, 33, 0x1}},
-    {60137894477488568ULL, 1, {42, 60, 0x1}},
-    {2060636731246475643ULL, 1, {27, 11, 0x2}},
-    {13701414621336784360ULL, 1, {44, 52, 0x0}},
-    {6720658469582997910ULL, 14, {45, 53, 0x0}},
-    {15043013291014996652ULL, 12, {9, 2, 0x0}},
-    {8003316783715139215ULL, 6, {25, 61, 0x0}},
-    {12363383796802578879ULL, 3, {20, 12, 0x0}},
-    {16130821662079137114ULL, 3, {52, 62, 0x0}},
-    {15776296958963014783ULL, 2, {12, 6, 0x0}},
-    {17360513819293165133ULL, 2, {43, 51, 0x0}},
-    {1084424692686883202ULL, 1, {42, 57, 0x0}},
-    {7513718561077675328ULL, 2, {29, 13, 0x2}},
-    {10316887188644861750ULL, 1, {42, 57, 0x0}},
-    {9741325202530033938ULL, 4, {21, 6, 0x0}},
-    {7563903005326255250ULL, 1, {52, 62, 0x0}},
-    {18066325456659069058ULL, 1, {18, 1, 0x0}},
-    {14671226531620358975ULL, 2, {35, 51, 0x2}},
-    {2617186323517748223ULL, 1, {17, 9, 0x0}},
-    {10237110102514378008ULL, 1, {41, 49, 0x0}},
-    {8407207392130568286ULL, 3, {18, 1, 0x0}},
-    {13920466616400337751ULL, 1, {41, 49, 0x0}},
-    {2005715782051062960ULL, 1, {29, 2, 0x0}},
-    {4634856486459765769ULL, 1, {46, 36, 0x0}},
-    {5479499687742859496ULL, 2, {47, 55, 0x0}},
-    {4925991611868025555ULL, 2, {20, 38, 0x0}},
-    {7032094484578472912ULL, 1, {41, 49, 0x0}},
-    {2621311469583977504ULL, 7, {41, 49, 0x0}},
-    {5979050373511178273ULL, 2, {24, 8, 0x2}},
-    {5021107084728486798ULL, 1, {32, 48, 0x2}},
-    {8777988894073005794ULL, 9, {18, 1, 0x0}},
-    {10355716047744642808ULL, 3, {34, 50, 0x2}},
-    {13337726644178258082ULL, 2, {28, 12, 0x2}},
-    {5704390530224328382ULL, 2, {27, 35, 0x0}},
-    {11822765367294069552ULL, 2, {33, 18, 0x0}},
-    {3492063636436681165ULL, 2, {30, 58, 0x0}},
-    {9969281635438771999ULL, 1, {36, 29, 0x1}},
-    {1604759823097220428ULL, 1, {36, 43, 0x1}},
-    {10599938887266460788ULL, 1, {21, 6, 0x0}},
-    {17848420598769485460ULL, 1, {42, 57, 0x0}},
-    {11094558197747572915ULL, 1, {29, 13, 0x2}},
-    {6799229684255038486ULL, 1, {49, 58, 0x0}},
-    {14714912053868396420ULL, 3, {42, 57, 0x0}},
-    {7736557500735042026ULL, 2, {11, 4, 0x0}},
-    {2959447677840673346ULL, 2, {35, 43, 0x0}},
-    {11091797539611590023ULL, 9, {36, 52, 0x2}},
-    {18095802865463277208ULL, 1, {18, 1, 0x0}},
-    {3127575946449152423ULL, 5, {19, 11, 0x0}},
-    {4043335503973279249ULL, 5, {45, 62, 0x0}},
-    {16530246536931435579ULL, 2, {21, 13, 0x0}},
-    {16479042260086204431ULL, 1, {47, 55, 0x0}},
-    {3232472753245065220ULL, 1, {41, 49, 0x0}},
-    {197761400610507475ULL, 1, {1, 3, 0x40}},
-    {14141961364535097311ULL, 1, {49, 58, 0x0}},
-    {2621311469583977504ULL, 1, {45, 53, 0x0}},
-    {8683282126207643385ULL, 1, {26, 10, 0x2}},
-    {16108932566900142720ULL, 1, {41, 49, 0x0}},
-    {9939978112769882478ULL, 1, {18, 1, 0x0}},
-    {1901810363593289491ULL, 1, {25, 61, 0x0}},
-    {16160493143309711475ULL, 1, {21, 6, 0x0}},
-    {11116699351601477930ULL, 1, {49, 58, 0x0}},
-    {16749991259957636350ULL, 1, {42, 50, 0x0}},
-    {4030406613229140563ULL, 1, {14, 5, 0x0}},
-    {4441186849128331217ULL, 1, {35, 51, 0x2}},
-    {11967609595292221245ULL, 1, {23, 15, 0x0}},
-    {13053845434320040801ULL, 1, {37, 53, 0x2}},
-    {6841954008926061468ULL, 4, {34, 50, 0x2}},
-    {15307288739378316726ULL, 3, {28, 12, 0x2}},
-    {8940404056650607693ULL, 3, {42, 57, 0x0}},
-    {4354772271343285253ULL, 3, {26, 5, 0x0}},
-    {17851826671077016422ULL, 2, {43, 51, 0x0}},
-    {1122061931576278220ULL, 1, {19, 11, 0x0}},
-    {16632606767459348053ULL, 1, {51, 58, 0x0}},
-    {1639125510790579259ULL, 1, {16, 8, 0x0}},
-    {8863480504210838169ULL, 1, {44, 52, 0x0}},
-    {13004833892763861492ULL, 2, {46, 54, 0x0}},
-    {13021272002029992699ULL, 1, {26, 5, 0x0}},
-    {5191588625304065341ULL, 1, {54, 61, 0x0}},
-    {4350334345671768980ULL, 1, {19, 11, 0x0}},
-    {16047715529951033826ULL, 1, {32, 42, 0x0}},
-    {14627520605259659011ULL, 1, {33, 26, 0x0}},
-    {13993266110357345710ULL, 1, {40, 48, 0x0}},
-    {9264254154950410274ULL, 1, {46, 54, 0x0}},
-    {5171627440783890126ULL, 4, {45, 53, 0x0}},
-    {13611697232999170319ULL, 3, {34, 50, 0x2}},
-    {6180531476297621462ULL, 3, {17, 9, 0x0}},
-    {11120251933870579658ULL, 2, {42, 57, 0x0}},
-    {17478679850864923970ULL, 1, {13, 4, 0x0}},
-    {1464784652970415648ULL, 1, {44, 58, 0x0}},
-    {8327993303234700596ULL, 1, {29, 13, 0x2}},
-    {8097644592981452327ULL, 1, {41, 49, 0x0}},
-    {14667145161425173911ULL, 1, {21, 6, 0x0}},
-    {10423522414836861079ULL, 1, {49, 58, 0x0}},
-    {305766470211808875ULL, 3, {9, 2, 0x0}},
-    {11569242016875752350ULL, 3, {35, 51, 0x2}},
-    {5733586795510304179ULL, 1, {36, 52, 0x2}},
-    {14897174166951592272ULL, 1, {18, 1, 0x0}},
-    {14185263731809176244ULL, 2, {19, 11, 0x0}},
-    {6397105971888477125ULL, 3, {37, 53, 0x2}},
-    {16996868660896590625ULL, 1, {28, 12, 0x2}},
-    {3419013534184044935ULL, 1, {45, 62, 0x0}},
-    {17289678316442885910ULL, 4, {47, 55, 0x0}},
-    {1297921238066023508ULL, 2, {33, 5, 0x0}},
-    {15503994200331857815ULL, 1, {51, 58, 0x0}},
-    {14077451310617672247ULL, 1, {51, 33, 0x1}},
-    {16507145314165356464ULL, 1, {51, 60, 0x1}},
-    {14938120743895780849ULL, 1, {45, 53, 0x0}},
-    {16715324912760771006ULL, 1, {21, 13, 0x0}},
-    {15140853210569373028ULL, 1, {45, 62, 0x0}},
-    {6056692285711269483ULL, 1, {18, 1, 0x0}},
-    {18305210571277610901ULL, 1, {25, 61, 0x0}},
-    {13991009012707108773ULL, 5, {46, 54, 0x0}},
-    {5626951822377955140ULL, 4, {11, 1, 0x0}},
-    {489386553945989980ULL, 2, {27, 42, 0x0}},
-    {8022430359087953291ULL, 6, {36, 52, 0x2}},
-    {15403877859232085712ULL, 5, {36, 27, 0x1}},
-    {13231317052484295853ULL, 4, {36, 60, 0x1}},
-    {1577664516541516964ULL, 4, {28, 12, 0x2}},
-    {10785035394108415810ULL, 4, {42, 57, 0x0}},
-    {2704646598920888075ULL, 5, {28, 37, 0x1}},
-    {4078879476029418157ULL, 7, {3, 2, 0x0}},
-    {15662193920663234639ULL, 6, {35, 51, 0x2}},
-    {14835784831661649549ULL, 1, {36, 29, 0x1}},
-    {9433072018767196388ULL, 1, {36, 43, 0x1}},
-    {2495910114624708337ULL, 1, {26, 5, 0x0}},
-    {13416842735168230796ULL, 1, {42, 57, 0x0}},
-    {8003316783715139215ULL, 6, {42, 57, 0x0}},
-    {5426689571434376504ULL, 3, {27, 36, 0x1}},
-    {4676584128340783690ULL, 3, {27, 21, 0x1}},
-    {16619910677251611603ULL, 2, {42, 57, 0x0}},
-    {4104585741168292095ULL, 1, {42, 27, 0x1}},
-    {2150018918300696807ULL, 1, {42, 51, 0x1}},
-    {2170996588730705085ULL, 13, {30, 58, 0x0}},
-    {9957242614047002978ULL, 12, {36, 21, 0x0}},
-    {1935667290507147140ULL, 3, {39, 55, 0x2}},
-    {13761616721129093208ULL, 2, {18, 1, 0x0}},
-    {14481033195800986190ULL, 2, {44, 52, 0x0}},
-    {5678631479806726071ULL, 1, {17, 9, 0x0}},
-    {10779998226719959145ULL, 1, {45, 53, 0x0}},
-    {4940966313009054159ULL, 9, {42, 57, 0x0}},
-    {10282648441748663563ULL, 9, {42, 27, 0x1}},
-    {5692981133863823438ULL, 6, {42, 51, 0x1}},
-    {2307367954850281513ULL, 1, {22, 14, 0x0}},
-    {4620754247252905375ULL, 1, {28, 37, 0x1}},
-    {261477852650716008ULL, 1, {28, 37, 0x1}},
-    {8839837295941234735ULL, 1, {28, 19, 0x1}},
-    {598983951438645861ULL, 2, {45, 62, 0x0}},
-    {11319135651798731299ULL, 2, {21, 13, 0x0}},
-    {15843677581990472542ULL, 1, {34, 61, 0x0}},
-    {1422303883457906996ULL, 4, {42, 57, 0x0}},
-    {1604436361618913026ULL, 1, {16, 8, 0x0}},
-    {13773558618082194270ULL, 1, {27, 42, 0x0}},
-    {12363383796802578879ULL, 2, {16, 8, 0x0}},
-    {10091499456736254132ULL, 2, {32, 25, 0x0}},
-    {8485371629423630652ULL, 2, {1, 3, 0x40}},
-    {12841414637895120097ULL, 1, {43, 51, 0x0}},
-    {17585704880308186542ULL, 1, {47, 55, 0x0}},
-    {17731649927793641890ULL, 1, {17, 9, 0x0}},
-    {11940142500590187318ULL, 1, {25, 61, 0x0}},
-    {14651848586187801489ULL, 1, {9, 2, 0x0}},
-    {6678673095032707413ULL, 1, {45, 62, 0x0}},
-    {6035871590717364595ULL, 1, {46, 54, 0x0}},
-    {7772382204986234923ULL, 1, {9, 2, 0x0}},
-    {453060070234817587ULL, 1, {54, 61, 0x0}},
-    {12738464977685026107ULL, 1, {24, 33, 0x0}},
-    {13609012389010573043ULL, 1, {37, 53, 0x2}},
-    {3602269126110796755ULL, 1, {18, 10, 0x0}},
-    {12625668168912842043ULL, 1, {33, 49, 0x2}},
-    {13391340318730681367ULL, 1, {27, 18, 0x1}},
-    {12802186413587199892ULL, 1, {24, 33, 0x1}},
-    {9954553460155283446ULL, 3, {21, 13, 0x0}},
-    {4655829470863877910ULL, 2, {25, 61, 0x0}},
-    {489386553945989980ULL, 2, {37, 53, 0x2}},
-    {4916957321416261754ULL, 10, {36, 52, 0x2}},
-    {4633505339883673162ULL, 1, {46, 54, 0x0}},
-    {6720658469582997910ULL, 2, {52, 62, 0x0}},
-    {15367114905051249174ULL, 1, {28, 12, 0x2}},
-    {9768746727525077456ULL, 1, {38, 54, 0x2}},
-    {5547361544348361691ULL, 1, {9, 2, 0x0}},
-    {1391201500692976669ULL, 1, {54, 61, 0x0}},
-    {10830743459261025029ULL, 1, {1, 3, 0x40}},
-    {16600811901057831574ULL, 1, {43, 51, 0x0}},
-    {11316460293833947899ULL, 3, {26, 5, 0x0}},
-    {10455944315109352881ULL, 2, {41, 49, 0x0}},
-    {11359052761181115683ULL, 1, {20, 2, 0x0}},
-    {982401194560336134ULL, 1, {25, 61, 0x0}},
-    {3830694852070677904ULL, 1, {16, 8, 0x0}},
-    {9823551212273571450ULL, 1, {32, 25, 0x0}},
-    {14203952494545290658ULL, 1, {11, 4, 0x0}},
-    {4719456330804748706ULL, 1, {42, 57, 0x0}},
-    {10501357603794894182ULL, 1, {18, 1, 0x0}},
-    {14328201282560909952ULL, 1, {46, 54, 0x0}},
-    {15959453154989213789ULL, 1, {35, 27, 0x0}},
-    {16955422532604991171ULL, 1, {52, 42, 0x0}},
-    {14844827457311525070ULL, 3, {37, 53, 0x2}},
-    {5704785486228255402ULL, 5, {51, 58, 0x0}},
-    {8523682072765390941ULL, 3, {22, 14, 0x0}},
-    {10725821284904217232ULL, 3, {57, 59, 0x40}},
-    {8100970276233269951ULL, 1, {47, 55, 0x0}},
-    {5529947049306529443ULL, 1, {19, 11, 0x0}},
-    {9731477770957540885ULL, 1, {51, 58, 0x0}},
-    {5021107084728486798ULL, 1, {40, 48, 0x0}},
-    {9957242614047002978ULL, 1, {18, 1, 0x0}},
-    {2438367529030610867ULL, 1, {21, 30, 0x1}},
-    {2439967243300684255ULL, 1, {21, 14, 0x1}},
-    {14986506396781892174ULL, 1, {27, 35, 0x0}},
-    {16955102825490010288ULL, 1, {28, 18, 0x0}},
-    {15719478130720151829ULL, 1, {42, 57, 0x0}},
-    {4090227221675244617ULL, 2, {23, 15, 0x0}},
-    {13412747078393125663ULL, 1, {41, 49, 0x0}},
-    {3268214958399822074ULL, 1, {30, 14, 0x2}},
-    {396941067794379263ULL, 1, {44, 52, 0x0}},
-    {2185107376395608112ULL, 2, {16, 8, 0x0}},
-    {7870329594086584438ULL, 2, {57, 59, 0x40}},
-    {1552752966703351933ULL, 3, {46, 54, 0x0}},
-    {9055825625432016925ULL, 3, {20, 2, 0x0}},
-    {13093726084369964952ULL, 3, {54, 61, 0x0}},
-    {8204945710367479872ULL, 3, {1, 3, 0x40}},
-    {15025247643562535925ULL, 1, {51, 58, 0x0}},
-    {13211197149147348207ULL, 1, {44, 58, 0x0}},
-    {16553410113159219008ULL, 1, {14, 5, 0x0}},
-    {8560533169153626220ULL, 1, {46, 54, 0x0}},
-    {18095802865463277208ULL, 8, {19, 11, 0x0}},
-    {17313780895394783879ULL, 7, {43, 51, 0x0}},
-    {7122886126778725635ULL, 6, {18, 1, 0x0}},
-    {14723228151667756608ULL, 5, {37, 53, 0x2}},
-    {8437221067564911582ULL, 4, {21, 13, 0x0}},
-    {5450301859196339202ULL, 4, {45, 62, 0x0}},
-    {15871311355326417738ULL, 2, {37, 53, 0x2}},
-    {8019627590161824165ULL, 1, {29, 13, 0x2}},
-    {884585794311578292ULL, 1, {42, 57, 0x0}},
-    {17311312624053654560ULL, 1, {36, 28, 0x0}},
-    {3979068331136125196ULL, 1, {36, 43, 0x1}},
-    {3888513160075342839ULL, 1, {36, 52, 0x2}},
-    {16672290463834501663ULL, 1, {36, 27, 0x1}},
-    {4393845194311277261ULL, 1, {42, 57, 0x0}},
-    {11376358867852819541ULL, 1, {38, 2, 0x0}},
-    {14972968013596341006ULL, 1, {52, 62, 0x0}},
-    {17037432886962653192ULL, 2, {37, 53, 0x2}},
-    {11212446220642591057ULL, 2, {37, 28, 0x1}},
-    {10202916978351341277ULL, 2, {39, 60, 0x0}},
-    {13625994312215874154ULL, 2, {23, 15, 0x0}},
-    {14772672959407504852ULL, 2, {37, 39, 0x1}},
-    {3006707632192664336ULL, 1, {43, 51, 0x0}},
-    {16415819038032855212ULL, 1, {21, 6, 0x0}},
-    {12385964245234870348ULL, 1, {46, 54, 0x0}},
-    {7273200659581926865ULL, 1, {26, 5, 0x0}},
-    {6206697275568134836ULL, 1, {54, 61, 0x0}},
-    {16269742679473054840ULL, 2, {17, 9, 0x0}},
-    {14731993640651044091ULL, 1, {41, 49, 0x0}},
-    {11895720456737632104ULL, 1, {9, 2, 0x0}},
-    {9715792152606352957ULL, 1, {46, 36, 0x0}},
-    {12000978952792533137ULL, 1, {41, 49, 0x0}},
-    {698736825888526590ULL, 1, {17, 9, 0x0}},
-    {17790959118579486274ULL, 1, {49, 58, 0x0}},
-    {14821391139006363091ULL, 1, {9, 2, 0x0}},
-    {4236661581796139029ULL, 3, {57, 59, 0x40}},
-    {7820819144862538687ULL, 3, {37, 53, 0x2}},
-    {1596068348471084593ULL, 3, {19, 11, 0x0}},
-    {3993527924178739837ULL, 1, {46, 54, 0x0}},
-    {16341756237726457435ULL, 1, {21, 13, 0x0}},
-    {11309474048251305278ULL, 1, {54, 61, 0x0}},
-    {10972059542153044357ULL, 1, {16, 8, 0x0}},
-    {7128631585379117144ULL, 1, {45, 53, 0x0}},
-    {10670451292426932216ULL, 1, {25, 61, 0x0}},
-    {16286724957976613671ULL, 3, {37, 58, 0x0}},
-    {7347428375358090362ULL, 1, {20, 12, 0x0}},
-    {8826388458108771235ULL, 3, {19, 11, 0x0}},
-    {7538857440457673476ULL, 1, {51, 57, 0x0}},
-    {4109029209836402763ULL, 1, {32, 42, 0x0}},
-    {7741123578247310824ULL, 1, {12, 26, 0x0}},
-    {14922599690585216164ULL, 1, {36, 52, 0x2}},
-    {8617762976750451016ULL, 1, {29, 13, 0x2}},
-    {2281956486095792335ULL, 1, {52, 62, 0x0}},
-    {13792971579311590148ULL, 1, {18, 1, 0x0}},
-    {3808345165427803518ULL, 1, {46, 54, 0x0}},
-    {17251119358163868237ULL, 1, {21, 6, 0x0}},
-    {18064672796223636113ULL, 1, {54, 61, 0x0}},
-    {10929847423272114306ULL, 1, {29, 2, 0x0}},
-    {12583091244718122292ULL, 1, {30, 58, 0x0}},
-    {12803174305862358431ULL, 1, {11, 4, 0x0}},
-    {14398524719472129382ULL, 1, {51, 57, 0x0}},
-    {2931941168010677267ULL, 4, {37, 53, 0x2}},
-    {7134377741015126520ULL, 3, {1, 3, 0x40}},
-    {2848727678882463807ULL, 2, {43, 51, 0x0}},
-    {14443767795450437274ULL, 1, {29, 13, 0x2}},
-    {7589959192365085847ULL, 1, {51, 58, 0x0}},
-    {5415374067267434735ULL, 1, {47, 55, 0x0}},
-    {10244293071065420438ULL, 1, {17, 9, 0x0}},
-    {7766042888112013620ULL, 1, {38, 54, 0x2}},
-    {14384292426140356867ULL, 1, {9, 2, 0x0}},
-    {7016513796198807209ULL, 1, {54, 61, 0x0}},
-    {12884632225743054601ULL, 1, {52, 62, 0x0}},
-    {7649176520866260213ULL, 1, {18, 1, 0x0}},
-    {11129242678913131736ULL, 1, {37, 53, 0x2}},
-    {1278995236737474217ULL, 1, {19, 11, 0x0}},
-    {7275906402977549675ULL, 1, {42, 57, 0x0}},
-    {2290372404452956331ULL, 1, {16, 8, 0x0}},
-    {8053593255547984991ULL, 1, {41, 49, 0x0}},
-    {13211197149147348207ULL, 2, {46, 54, 0x0}},
-    {15011036628425524009ULL, 2, {14, 5, 0x0}},
-    {14927682680567575209ULL, 2, {54, 61, 0x0}},
-    {6689260125950577352ULL, 2, {34, 50, 0x2}},
-    {13138419210126537057ULL, 1, {28, 12, 0x2}},
-    {14840892961499343927ULL, 1, {27, 34, 0x1}},
-    {64945020755144558ULL, 1, {35, 18, 0x1}},
-    {1404087813864950984ULL, 1, {42, 57, 0x0}},
-    {8294246709451802626ULL, 1, {11, 2, 0x0}},
-    {728543612474183885ULL, 1, {44, 52, 0x0}},
-    {3632202504220565208ULL, 1, {47, 62, 0x0}},
-    {2431275971508840765ULL, 1, {28, 12, 0x2}},
-    {1106703767965429927ULL, 1, {49, 58, 0x0}},
-    {11284174284759867902ULL, 4, {47, 55, 0x0}},
-    {7709745360062743187ULL, 1, {22, 14, 0x0}},
-    {14206768912377336349ULL, 1, {34, 61, 0x0}},
-    {11214941578300297656ULL, 7, {21, 6, 0x0}},
-    {2276511703931911091ULL, 7, {36, 52, 0x2}},
-    {17253686817926314415ULL, 2, {33, 5, 0x0}},
-    {8447631713456297032ULL, 1, {40, 48, 0x0}},
-    {13358486058144120981ULL, 1, {42, 33, 0x1}},
-    {14140757465128189612ULL, 1, {42, 51, 0x1}},
-    {17752939435398844767ULL, 1, {19, 11, 0x0}},
-    {11888606348668777946ULL, 1, {45, 53, 0x0}},
-    {15781963881806604129ULL, 1, {34, 50, 0x2}},
-    {16304751831419734384ULL, 1, {9, 2, 0x0}},
-    {257449078822655243ULL, 1, {42, 57, 0x0}},
-    {12109889539175594993ULL, 1, {9, 2, 0x0}},
-    {5429424212188372399ULL, 1, {57, 59, 0x40}},
-    {13778814878623985577ULL, 1, {37, 53, 0x2}},
-    {12014913377586448057ULL, 1, {9, 2, 0x0}},
-    {2977727989287694999ULL, 1, {20, 12, 0x0}},
-    {6248572871068167475ULL, 1, {36, 52, 0x2}},
-    {3653067065990077373ULL, 1, {12, 6, 0x0}},
-    {16636188606338512643ULL, 1, {43, 61, 0x0}},
-    {9453127413630740743ULL, 1, {21, 13, 0x0}},
-    {1355504980991665714ULL, 1, {52, 60, 0x0}},
-    {9176897335069304700ULL, 1, {19, 11, 0x0}},
-    {7885047822713934717ULL, 1, {45, 62, 0x0}},
-    {5928803841124443528ULL, 1, {28, 12, 0x2}},
-    {498762593631972516ULL, 1, {36, 52, 0x2}},
-    {4019429537348496759ULL, 1, {29, 13, 0x2}},
-    {16715154846965558763ULL, 1, {28, 37, 0x1}},
-    {17796186028012732718ULL, 1, {28, 19, 0x1}},
-    {654547618348899302ULL, 1, {42, 57, 0x0}},
-    {14177085116817708326ULL, 1, {27, 11, 0x2}},
-    {4932496417307524909ULL, 1, {44, 52, 0x0}},
-    {17833411376931423680ULL, 1, {11, 4, 0x0}},
-    {4467868705360116561ULL, 1, {49, 58, 0x0}},
-    {6160594505044693097ULL, 1, {28, 12, 0x2}},
-    {1369597123192125423ULL, 1, {57, 59, 0x40}},
-    {3721014726486387117ULL, 6, {11, 4, 0x0}},
-    {1112989979303038866ULL, 6, {47, 55, 0x0}},
-    {1318184152444028073ULL, 5, {26, 10, 0x2}},
-    {767331346974661163ULL, 3, {36, 52, 0x2}},
-    {16846945141246388234ULL, 3, {18, 1, 0x0}},
-    {11409540246999345823ULL, 1, {37, 53, 0x2}},
-    {13277516893270027308ULL, 1, {17, 9, 0x0}},
-    {11543864845469016609ULL, 1, {45, 62, 0x0}},
-    {9551338453046040069ULL, 1, {9, 2, 0x0}},
-    {15935132093730882094ULL, 1, {43, 51, 0x0}},
-    {11361188557731282818ULL, 1, {1, 3, 0x40}},
-    {14770235951822320441ULL, 1, {44, 58, 0x0}},
-    {7736557500735042026ULL, 1, {21, 6, 0x0}},
-    {12117375981879930422ULL, 1, {51, 58, 0x0}},
-    {17368058752340016328ULL, 3, {21, 6, 0x0}},
-    {13521105088988198766ULL, 4, {21, 6, 0x0}},
-    {14452726620559641518ULL, 1, {51, 58, 0x0}},
-    {13004833892763861492ULL, 2, {37, 53, 0x2}},
-    {885043034793587232ULL, 2, {36, 28, 0x0}},
-    {14488793193427279900ULL, 1, {44, 52, 0x0}},
-    {1944062507852338972ULL, 1, {21, 6, 0x0}},
-    {6222956601307235780ULL, 1, {41, 49, 0x0}},
-    {12917227608353099029ULL, 1, {27, 11, 0x2}},
-    {1836087904478680691ULL, 1, {49, 58, 0x0}},
-    {16015634392320258500ULL, 1, {44, 52, 0x0}},
-    {12385723303618198603ULL, 2, {21, 6, 0x0}},
-    {5790572532107766419ULL, 2, {42, 57, 0x0}},
-    {9881040520078436919ULL, 2, {26, 5, 0x0}},
-    {2624576623075250299ULL, 4, {43, 51, 0x0}},
-    {9054033535219127931ULL, 3, {38, 21, 0x0}},
-    {12162206047403768019ULL, 3, {47, 62, 0x0}},
-    {11140054374450687746ULL, 2, {23, 15, 0x0}},
-    {16605777566982845551ULL, 1, {37, 53, 0x2}},
-    {6713950162534808854ULL, 1, {20, 2, 0x0}},
-    {13414393408884349377ULL, 1, {47, 55, 0x0}},
-    {500301882652361302ULL, 5, {28, 12, 0x2}},
-    {12827774755826471961ULL, 5, {57, 59, 0x40}},
-    {4286387923052900783ULL, 9, {41, 49, 0x0}},
-    {6887177516621924522ULL, 1, {28, 12, 0x2}},
-    {224602674935472842ULL, 1, {28, 35, 0x1}},
-    {13007957310933551404ULL, 1, {33, 5, 0x0}},
-    {15603296731805117512ULL, 1, {51, 58, 0x0}},
-    {14487355113066472336ULL, 1, {35, 51, 0x2}},
-    {1416411302705672528ULL, 1, {35, 28, 0x1}},
-    {18358590189847490574ULL, 1, {35, 44, 0x1}},
-    {9615046495773870518ULL, 1, {60, 4, 0x1}},
-    {3485708238611644193ULL, 1, {60, 59, 0x1}},
-    {3684949101368063177ULL, 1, {21, 6, 0x0}},
-    {4743073157588797438ULL, 1, {43, 61, 0x0}},
-    {11120251933870579658ULL, 1, {52, 62, 0x0}},
-    {4911607234890069264ULL, 3, {33, 5, 0x0}},
-    {11186767313689477381ULL, 1, {40, 48, 0x0}},
-    {14887904878691151812ULL, 2, {39, 55, 0x2}},
-    {877317167584490694ULL, 1, {17, 9, 0x0}},
-    {1978125847260466911ULL, 1, {36, 52, 0x2}},
-    {12022399877500531328ULL, 1, {9, 2, 0x0}},
-    {9503722984616622258ULL, 1, {29, 36, 0x1}},
-    {7637180607189499230ULL, 1, {44, 52, 0x0}},
-    {17192387111477417047ULL, 5, {29, 13, 0x2}},
-    {1989117655144510564ULL, 3, {45, 62, 0x0}},
-    {6242475919740069587ULL, 3, {52, 61, 0x0}},
-    {176861427982192260ULL, 3, {28, 12, 0x2}},
-    {1177556745673183075ULL, 3, {44, 52, 0x0}},
-    {10604165298643732127ULL, 1, {21, 13, 0x0}},
-    {6145707649618565349ULL, 1, {53, 60, 0x0}},
-    {1539899780551595346ULL, 1, {37, 28, 0x1}},
-    {18377189299910335032ULL, 1, {37, 53, 0x1}},
-    {2377697397716333952ULL, 2, {17, 9, 0x0}},
-    {6910027258430625301ULL, 2, {29, 36, 0x1}},
-    {5223064090103679930ULL, 2, {9, 2, 0x0}},
-    {7686159521179815058ULL, 1, {30, 58, 0x0}},
-    {10172808026173050809ULL, 1, {29, 36, 0x1}},
-    {15208067252259670207ULL, 3, {36, 52, 0x2}},
-    {2556933383735889692ULL, 3, {1, 3, 0x40}},
-    {14452726620559641518ULL, 1, {44, 52, 0x0}},
-    {15278193525252374643ULL, 1, {41, 49, 0x0}},
-    {14835784831661649549ULL, 1, {17, 9, 0x0}},
-    {1994812713343852265ULL, 1, {42, 57, 0x0}},
-    {17196095747006781747ULL, 1, {9, 2, 0x0}},
-    {595496304424714491ULL, 2, {57, 59, 0x40}},
-    {11679719024517508790ULL, 1, {44, 52, 0x0}},
-    {8100970276233269951ULL, 4, {51, 58, 0x0}},
-    {6468360512672987624ULL, 2, {19, 11, 0x0}},
-    {10592231325407589072ULL, 1, {52, 62, 0x0}},
-    {279475978515729115ULL, 1, {12, 4, 0x0}},
-    {8246521964232484986ULL, 1, {38, 54, 0x2}},
-    {18008241743026073344ULL, 1, {22, 14, 0x0}},
-    {12920806012044676448ULL, 1, {35, 51, 0x2}},
-    {11817416701206178060ULL, 4, {45, 53, 0x0}},
-    {8001711469908866168ULL, 5, {18, 1, 0x0}},
-    {12938293624500049951ULL, 5, {42, 57, 0x0}},
-    {4354772271343285253ULL, 2, {33, 5, 0x0}},
-    {17221150231857802054ULL, 2, {43, 51, 0x0}},
-    {7119681048077051017ULL, 2, {12, 6, 0x0}},
-    {2642573023987310214ULL, 1, {51, 58, 0x0}},
-    {93017998138498356ULL, 1, {19, 11, 0x0}},
-    {17283018314849349467ULL, 1, {57, 59, 0x40}},
-    {5466096304987133231ULL, 5, {28, 12, 0x2}},
-    {18186174444750110772ULL, 5, {28, 35, 0x1}},
-    {8822340984871530403ULL, 4, {35, 27, 0x0}},
-    {15157621670680083199ULL, 3, {36, 52, 0x2}},
-    {272309117818777353ULL, 1, {42, 57, 0x0}},
-    {7781528071341571660ULL, 1, {41, 49, 0x0}},
-    {1396206698255964812ULL, 1, {20, 12, 0x0}},
-    {6673441240963367917ULL, 1, {49, 58, 0x0}},
-    {9581962968419767339ULL, 2, {21, 6, 0x0}},
-    {15866307651598513401ULL, 1, {37, 53, 0x2}},
-    {5736792577259520223ULL, 1, {26, 10, 0x2}},
-    {1991589756165033547ULL, 2, {45, 62, 0x0}},
-    {8478818142849251329ULL, 2, {18, 1, 0x0}},
-    {5387360050822967584ULL, 2, {41, 49, 0x0}},
-    {12620683949554638034ULL, 1, {38, 2, 0x0}},
-    {1403560791400964691ULL, 1, {49, 58, 0x0}},
-    {16764546303442426248ULL, 3, {17, 9, 0x0}},
-    {11611524544203508143ULL, 2, {37, 53, 0x2}},
-    {14472648773346339563ULL, 2, {18, 1, 0x0}},
-    {1093597968709149650ULL, 2, {28, 37, 0x1}},
-    {15518809950485859356ULL, 2, {28, 18, 0x1}},
-    {6692650497847486526ULL, 2, {36, 52, 0x2}},
-    {9454198418484282279ULL, 2, {9, 2, 0x0}},
-    {12651959081434861347ULL, 2, {42, 57, 0x0}},
-    {1318184152444028073ULL, 1, {21, 6, 0x0}},
-    {18240185855572797018ULL, 1, {36, 52, 0x2}},
-    {2868350059753470263ULL, 1, {27, 11, 0x2}},
-    {15638827592237059351ULL, 1, {28, 36, 0x0}},
-    {5648008255583555519ULL, 1, {11, 21, 0x0}},
-    {6180121040166120176ULL, 1, {35, 51, 0x2}},
-    {8383009149158916268ULL, 1, {17, 11, 0x0}},
-    {1646359170475928634ULL, 1, {43, 61, 0x0}},
-    {8899259314254235730ULL, 1, {18, 1, 0x0}},
-    {7183135874366018526ULL, 1, {42, 50, 0x0}},
-    {17188657718858330447ULL, 2, {22, 14, 0x0}},
-    {6652472794184470861ULL, 1, {45, 62, 0x0}},
-    {4471627026556111146ULL, 1, {14, 5, 0x0}},
-    {16099841706347622851ULL, 1, {44, 52, 0x0}},
-    {14081609280607344676ULL, 1, {38, 2, 0x0}},
-    {3927878020741156490ULL, 1, {35, 51, 0x2}},
-    {17096585829321398356ULL, 1, {11, 1, 0x0}},
-    {2967359931513904858ULL, 1, {42, 57, 0x0}},
-    {4762152482573493221ULL, 1, {21, 6, 0x0}},
-    {15871311355326417738ULL, 1, {36, 52, 0x2}},
-    {7163204984779398005ULL, 1, {26, 5, 0x0}},
-    {12116399398039928123ULL, 1, {44, 58, 0x0}},
-    {15237947796287380224ULL, 1, {17, 26, 0x0}},
-    {14242785002680921748ULL, 1, {42, 57, 0x0}},
-    {13679358632021449128ULL, 1, {19, 11, 0x0}},
-    {14968096081227615330ULL, 1, {28, 12, 0x2}},
-    {3800075212325898108ULL, 1, {38, 54, 0x2}},
-    {16954522953539018144ULL, 1, {28, 12, 0x2}},
-    {14176456181683956893ULL, 1, {54, 61, 0x0}},
-    {5246516882433904536ULL, 1, {21, 6, 0x0}},
-    {15886828755460865057ULL, 1, {42, 57, 0x0}},
-    {16187175440247651594ULL, 1, {13, 4, 0x0}},
-    {18009342839269284110ULL, 1, {36, 52, 0x2}},
-    {13946451681863713327ULL, 1, {18, 1, 0x0}},
-    {8091539832430793125ULL, 1, {43, 51, 0x0}},
-    {8437221067564911582ULL, 1, {12, 6, 0x0}},
-    {15934269264400316572ULL, 1, {45, 62, 0x0}},
-    {4458899000737982224ULL, 2, {44, 53, 0x1}},
-    {3818204582793849347ULL, 2, {28, 12, 0x2}},
-    {14410682677787280767ULL, 1, {45, 53, 0x0}},
-    {7686159521179815058ULL, 1, {38, 54, 0x2}},
-    {1508456233249733303ULL, 1, {49, 58, 0x0}},
-    {2191941687698111428ULL, 1, {45, 62, 0x0}},
-    {13514239744859327346ULL, 1, {28, 12, 0x2}},
-    {15702359293752011661ULL, 1, {36, 52, 0x2}},
-    {18439627273315409172ULL, 1, {36, 27, 0x1}},
-    {11643996133513789576ULL, 1, {36, 60, 0x1}},
-    {18295344350778702024ULL, 2, {46, 54, 0x0}},
-    {9471853440028459599ULL, 1, {29, 13, 0x2}},
-    {3994901747340204867ULL, 1, {54, 61, 0x0}},
-    {5246516882433904536ULL, 1, {18, 1, 0x0}},
-    {4850926334648025187ULL, 1, {43, 51, 0x0}},
-    {14566983678749965803ULL, 1, {23, 15, 0x0}},
-    {14718917758933432890ULL, 1, {42, 57, 0x0}},
-    {8285786309667566735ULL, 1, {28, 12, 0x2}},
-    {12927158626141342593ULL, 1, {28, 35, 0x1}},
-    {13900714196598151155ULL, 1, {28, 4, 0x1}},
-    {10906808590339188965ULL, 1, {45, 62, 0x0}},
-    {10602114425754669417ULL, 1, {19, 28, 0x0}},
-    {8895314291255752262ULL, 1, {42, 57, 0x0}},
-    {11055582096299353930ULL, 1, {21, 6, 0x0}},
-    {17555407266575488267ULL, 1, {30, 58, 0x0}},
-    {17713910236975932114ULL, 3, {41, 49, 0x0}},
-    {1149003012592182808ULL, 2, {21, 13, 0x0}},
-    {10293064112923318870ULL, 1, {49, 58, 0x0}},
-    {14523082442014246235ULL, 1, {28, 12, 0x2}},
-    {1470919278463989711ULL, 1, {28, 37, 0x1}},
-    {7804374844919107187ULL, 1, {28, 21, 0x1}},
-    {2874965990308781633ULL, 1, {36, 52, 0x2}},
-    {11611524544203508143ULL, 1, {34, 50, 0x2}},
-    {4863431294739524082ULL, 1, {9, 2, 0x0}},
-    {5238004230522517807ULL, 1, {42, 57, 0x0}},
-    {18251266537852898417ULL, 1, {18, 1, 0x0}},
-    {14127752415649373968ULL, 2, {36, 52, 0x2}},
-    {4122614028101861856ULL, 2, {1, 3, 0x40}},
-    {16406053154587549829ULL, 2, {44, 58, 0x0}},
-    {16086452201153868928ULL, 3, {21, 13, 0x0}},
-    {8876299967437453441ULL, 1, {36, 52, 0x2}},
-    {5631908053379118479ULL, 1, {36, 27, 0x1}},
-    {8862983041753891354ULL, 1, {36, 60, 0x1}},
-    {5101143999414067907ULL, 1, {28, 12, 0x2}},
-    {2057198953508681063ULL, 1, {34, 61, 0x0}},
-    {6093706452326611260ULL, 2, {47, 55, 0x0}},
-    {1119690734407537288ULL, 1, {31, 15, 0x2}},
-    {14508358123612331416ULL, 1, {46, 54, 0x0}},
-    {1552752966703351933ULL, 2, {41, 49, 0x0}},
-    {15146299086823517605ULL, 1, {11, 2, 0x0}},
-    {7160114648651920381ULL, 1, {49, 58, 0x0}},
-    {1664268723224940363ULL, 1, {22, 14, 0x0}},
-    {11774951747560010935ULL, 1, {57, 59, 0x40}},
-    {14198307122025381492ULL, 1, {41, 49, 0x0}},
-    {17130578250547307224ULL, 1, {19, 11, 0x0}},
-    {13450818358182343641ULL, 1, {42, 57, 0x0}},
-    {9838281706629585666ULL, 1, {14, 5, 0x0}},
-    {11249441732865067336ULL, 1, {43, 51, 0x0}},
-    {12053455671755996505ULL, 1, {18, 1, 0x0}},
-    {16996868660896590625ULL, 1, {38, 2, 0x0}},
-    {14870775301755779030ULL, 1, {52, 61, 0x0}},
-    {17932806170431131754ULL, 1, {40, 57, 0x0}},
-    {409052978269739094ULL, 1, {29, 13, 0x2}},
-    {18170394284451623213ULL, 1, {45, 53, 0x0}},
-    {5288160281399232754ULL, 2, {17, 9, 0x0}},
-    {17631482829038658193ULL, 2, {41, 49, 0x0}},
-    {2734923663429704166ULL, 3, {9, 2, 0x0}},
-    {10320925982692753011ULL, 5, {49, 58, 0x0}},
-    {11406991152036004517ULL, 5, {22, 14, 0x0}},
-    {17343768162173374433ULL, 2, {35, 51, 0x2}},
-    {13469448620684297881ULL, 3, {12, 6, 0x0}},
-    {8154509512163913275ULL, 1, {43, 51, 0x0}},
-    {17355296761389975716ULL, 1, {17, 9, 0x0}},
-    {18365075640868446412ULL, 1, {52, 62, 0x0}},
-    {5492901291724541284ULL, 1, {29, 36, 0x1}},
-    {14633637952186163950ULL, 1, {29, 2, 0x1}},
-    {5925706632288704309ULL, 1, {43, 51, 0x0}},
-    {5705570606138229330ULL, 1, {11, 4, 0x0}},
-    {11705342989251849444ULL, 1, {47, 55, 0x0}},
-    {15853327233346339567ULL, 3, {28, 12, 0x2}},
-    {17693275005444399663ULL, 2, {42, 57, 0x0}},
-    {12943328154826809346ULL, 2, {33, 5, 0x0}},
-    {12886379800431348820ULL, 1, {22, 14, 0x0}},
-    {1301429158395191531ULL, 1, {37, 53, 0x2}},
-    {3969050325408919961ULL, 1, {19, 11, 0x0}},
-    {4606060508468885998ULL, 1, {49, 58, 0x0}},
-    {9606529299302046319ULL, 1, {14, 5, 0x0}},
-    {14449998722198719077ULL, 1, {57, 59, 0x40}},
-    {9130588288642540357ULL, 1, {14, 5, 0x0}},
-    {913890193328172239ULL, 1, {44, 52, 0x0}},
-    {1920747597139648146ULL, 2, {28, 12, 0x2}},
-    {14345698562420743639ULL, 1, {42, 57, 0x0}},
-    {4014187189509302547ULL, 1, {43, 51, 0x0}},
-    {16962532372017379917ULL, 1, {18, 1, 0x0}},
-    {2983811426470722456ULL, 2, {42, 57, 0x0}},
-    {12847611761441623937ULL, 2, {14, 5, 0x0}},
-    {11758981599465054020ULL, 1, {37, 53, 0x2}},
-    {4618644590145395242ULL, 1, {17, 9, 0x0}},
-    {7452598295915885065ULL, 1, {45, 62, 0x0}},
-    {10544030749811920538ULL, 1, {9, 2, 0x0}},
-    {11879362768000661207ULL, 1, {36, 52, 0x2}},
-    {16322081069638909478ULL, 1, {23, 15, 0x0}},
-    {12762228538126994535ULL, 1, {49, 58, 0x0}},
-    {8906331064969231832ULL, 1, {29, 2, 0x0}},
-    {14444130625228520336ULL, 1, {44, 52, 0x0}},
-    {1759454108154958090ULL, 2, {46, 60, 0x0}},
-    {18060155076760058546ULL, 1, {21, 6, 0x0}},
-    {572733763613406671ULL, 1, {27, 36, 0x1}},
-    {157066283693133558ULL, 1, {27, 18, 0x1}},
-    {14926494862855922616ULL, 1, {35, 51, 0x2}},
-    {14994908378016895015ULL, 3, {17, 9, 0x0}},
-    {10289342357699508150ULL, 1, {34, 50, 0x2}},
-    {9211230315028962120ULL, 1, {9, 2, 0x0}},
-    {12104912984681494265ULL, 1, {42, 57, 0x0}},
-    {311687939903173951ULL, 1, {1, 3, 0x40}},
-    {18352439132839590361ULL, 1, {51, 58, 0x0}},
-    {3372732088968193934ULL, 1, {20, 12, 0x0}},
-    {3980897712013693721ULL, 1, {57, 59, 0x40}},
-    {1782235634839136110ULL, 1, {29, 2, 0x0}},
-    {13085659146319210889ULL, 1, {43, 51, 0x0}},
-    {146406810737878701ULL, 1, {22, 29, 0x0}},
-    {11871009131701060214ULL, 1, {51, 57, 0x0}},
-    {7167454292758700144ULL, 3, {46, 54, 0x0}},
-    {913469295362187160ULL, 2, {9, 2, 0x0}},
-    {13305514923985005705ULL, 2, {54, 61, 0x0}},
-    {14252444554175421723ULL, 2, {1, 3, 0x40}},
-    {13810797048728656670ULL, 2, {43, 51, 0x0}},
-    {18160083601501715416ULL, 1, {28, 12, 0x2}},
-    {18240066192920204458ULL, 1, {37, 53, 0x2}},
-    {12557464768465772210ULL, 2, {21, 6, 0x0}},
-    {1119690734407537288ULL, 1, {19, 5, 0x0}},
-    {5451883719712186470ULL, 1, {52, 62, 0x0}},
-    {17253686817926314415ULL, 4, {26, 5, 0x0}},
-    {16605777566982845551ULL, 1, {45, 53, 0x0}},
-    {6102224732459341507ULL, 1, {37, 53, 0x2}},
-    {16954522953539018144ULL, 1, {27, 11, 0x2}},
-    {6328452954341734605ULL, 1, {54, 61, 0x0}},
-    {4644181404918903488ULL, 1, {21, 6, 0x0}},
-    {3496459055638593905ULL, 1, {43, 51, 0x0}},
-    {16108890653513171977ULL, 1, {18, 1, 0x0}},
-    {15911096888622699207ULL, 1, {37, 53, 0x2}},
-    {10413869897127853558ULL, 1, {28, 12, 0x2}},
-    {5416458353781675824ULL, 1, {28, 37, 0x1}},
-    {7265553120916877664ULL, 1, {31, 4, 0x0}},
-    {1178404172193311315ULL, 1, {45, 62, 0x0}},
-    {11361313322595327901ULL, 1, {9, 2, 0x0}},
-    {3722872288114826283ULL, 1, {49, 58, 0x0}},
-    {2170996588730705085ULL, 2, {44, 52, 0x0}},
-    {11958647162681943742ULL, 2, {17, 9, 0x0}},
-    {7450564160707493255ULL, 1, {34, 50, 0x2}},
-    {1113250227562366882ULL, 1, {28, 12, 0x2}},
-    {1572282735930126606ULL, 1, {51, 58, 0x0}},
-    {530743811310662493ULL, 1, {16, 2, 0x0}},
-    {3837818963606715418ULL, 1, {47, 62, 0x0}},
-    {14143150030531999970ULL, 4, {12, 5, 0x0}},
-    {5658798092240929581ULL, 3, {54, 61, 0x0}},
-    {7030747919821981677ULL, 2, {17, 9, 0x0}},
-    {2110323922119010944ULL, 1, {45, 62, 0x0}},
-    {10316855326288547454ULL, 1, {9, 2, 0x0}},
-    {3210723990256298192ULL, 1, {41, 49, 0x0}},
-    {18281442944788611966ULL, 1, {18, 1, 0x0}},
-    {687763605558314065ULL, 1, {49, 58, 0x0}},
-    {15471780677375328054ULL, 2, {28, 12, 0x2}},
-    {7381142007411899921ULL, 2, {42, 57, 0x0}},
-    {1793414711660541410ULL, 2, {17, 9, 0x0}},
-    {18372922676215202040ULL, 2, {41, 49, 0x0}},
-    {2331678092671162915ULL, 2, {9, 2, 0x0}},
-    {10664283175428672640ULL, 1, {44, 52, 0x0}},
-    {16826190534473732609ULL, 1, {18, 1, 0x0}},
-    {11744774966726310886ULL, 2, {49, 58, 0x0}},
-    {1604436361618913026ULL, 1, {33, 18, 0x0}},
-    {14016546289167904750ULL, 1, {40, 48, 0x0}},
-    {6475952180568536409ULL, 1, {44, 52, 0x0}},
-    {14787609022329154648ULL, 1, {28, 12, 0x2}},
-    {5315983078722168639ULL, 1, {28, 37, 0x1}},
-    {9930681686459555363ULL, 1, {28, 18, 0x1}},
-    {10250122215513434190ULL, 1, {41, 49, 0x0}},
-    {14037242545189244201ULL, 1, {27, 11, 0x2}},
-    {6803375547829743383ULL, 1, {45, 62, 0x0}},
-    {3448846763706090934ULL, 1, {37, 53, 0x2}},
-    {3725031456545187013ULL, 1, {26, 10, 0x2}},
-    {13892635447014917754ULL, 1, {45, 62, 0x0}},
-    {16149267697293473870ULL, 1, {18, 1, 0x0}},
-    {3588418666326726518ULL, 1, {36, 52, 0x2}},
-    {4643567040611849567ULL, 1, {11, 2, 0x0}},
-    {13478572495432542944ULL, 1, {41, 49, 0x0}},
-    {9185097134366520292ULL, 4, {45, 62, 0x0}},
-    {6815310747406727866ULL, 2, {18, 1, 0x0}},
-    {394886718395218886ULL, 1, {18, 1, 0x0}},
-    {4176599767348613019ULL, 1, {28, 37, 0x1}},
-    {362480684444977609ULL, 2, {21, 6, 0x0}},
-    {6803142323179306268ULL, 6, {43, 51, 0x0}},
-    {16751514426814786804ULL, 2, {28, 12, 0x2}},
-    {7103905845141117878ULL, 3, {30, 58, 0x0}},
-    {9169622694104440521ULL, 2, {22, 14, 0x0}},
-    {10971797325564283718ULL, 2, {41, 49, 0x0}},
-    {308371674062001263ULL, 2, {14, 5, 0x0}},
-    {4178512978711492830ULL, 3, {49, 58, 0x0}},
-    {670423311901730368ULL, 2, {17, 9, 0x0}},
-    {2657755876041350308ULL, 3, {57, 59, 0x40}},
-    {3086418755054110257ULL, 3, {9, 2, 0x0}},
-    {12680507026624180129ULL, 2, {44, 52, 0x0}},
-    {2859227840215654479ULL, 1, {20, 12, 0x0}},
-    {5590334923996294206ULL, 1, {41, 49, 0x0}},
-    {444833840364412887ULL, 1, {17, 9, 0x0}},
-    {11873796203175191951ULL, 1, {49, 58, 0x0}},
-    {11217326970563561046ULL, 1, {9, 2, 0x0}},
-    {11463200041191309665ULL, 1, {45, 62, 0x0}},
-    {14844834356083480465ULL, 1, {28, 37, 0x1}},
-    {2007615527468979127ULL, 1, {28, 18, 0x1}},
-    {15081721224437883785ULL, 1, {45, 62, 0x0}},
-    {9866328628075937741ULL, 5, {37, 53, 0x2}},
-    {7796805321234337857ULL, 1, {42, 52, 0x0}},
-    {12691223179385516484ULL, 4, {52, 62, 0x0}},
-    {13341375905411798442ULL, 3, {16, 8, 0x0}},
-    {7753035919048400824ULL, 1, {18, 25, 0x1}},
-    {16076012578906554498ULL, 2, {28, 12, 0x2}},
-    {8653803125951045468ULL, 1, {49, 58, 0x0}},
-    {7715834833786149323ULL, 1, {36, 52, 0x2}},
-    {15538935877549568371ULL, 3, {53, 60, 0x0}},
-    {4521472673423428096ULL, 5, {57, 59, 0x40}},
-    {8840099917782948998ULL, 5, {12, 6, 0x0}},
-    {7563903005326255250ULL, 1, {34, 61, 0x0}},
-    {6359676239665388636ULL, 1, {17, 9, 0x0}},
-    {9952868833896974028ULL, 1, {35, 51, 0x2}},
-    {5157075845287820477ULL, 1, {18, 1, 0x0}},
-    {13692516843910547909ULL, 1, {52, 62, 0x0}},
-    {18013332567305626445ULL, 1, {42, 57, 0x0}},
-    {11895088342976804120ULL, 1, {9, 2, 0x0}},
-    {12820173554855631286ULL, 1, {36, 52, 0x2}},
-    {15565403218451770049ULL, 1, {36, 29, 0x1}},
-    {8299687139110187801ULL, 1, {36, 42, 0x1}},
-    {16811225116065040740ULL, 1, {21, 6, 0x0}},
-    {16737506929071728267ULL, 1, {53, 36, 0x0}},
-    {7927473974648057776ULL, 4, {18, 1, 0x0}},
-    {8031042074188651395ULL, 4, {49, 58, 0x0}},
-    {14783785900967398601ULL, 1, {29, 13, 0x2}},
-    {5725786007155629831ULL, 1, {34, 50, 0x2}},
-    {12035433064777569368ULL, 2, {21, 6, 0x0}},
-    {8224049441686867358ULL, 2, {42, 57, 0x0}},
-    {1694407727868121980ULL, 1, {19, 11, 0x0}},
-    {12676833915877130296ULL, 1, {57, 59, 0x40}},
-    {14982825262317278076ULL, 3, {17, 9, 0x0}},
-    {7695310049649440923ULL, 3, {49, 58, 0x0}},
-    {7701977840509017943ULL, 1, {28, 12, 0x2}},
-    {14868657270310298543ULL, 1, {44, 52, 0x0}},
-    {10501170017635283500ULL, 2, {37, 53, 0x2}},
-    {14990841586627893834ULL, 2, {1, 3, 0x40}},
-    {11164015105271174732ULL, 1, {45, 62, 0x0}},
-    {4198153015302602510ULL, 7, {19, 5, 0x0}},
-    {9952147762914645191ULL, 7, {42, 60, 0x0}},
-    {13138419210126537057ULL, 1, {35, 18, 0x1}},
-    {7985150735303957812ULL, 1, {42, 60, 0x0}},
-    {11935894950140194168ULL, 1, {28, 12, 0x2}},
-    {12601564919408720165ULL, 1, {44, 52, 0x0}},
-    {15337927714156842584ULL, 1, {29, 35, 0x0}},
-    {587035072046783931ULL, 1, {27, 34, 0x1}},
-    {2797284083970668928ULL, 1, {22, 14, 0x0}},
-    {8677024398818576339ULL, 2, {41, 49, 0x0}},
-    {1866786483407906694ULL, 2, {14, 5, 0x0}},
-    {4418075441984575246ULL, 2, {49, 58, 0x0}},
-    {13959993333544701737ULL, 2, {17, 9, 0x0}},
-    {12694204206617854514ULL, 3, {18, 1, 0x0}},
-    {17518309165863011692ULL, 1, {54, 61, 0x0}},
-    {14127029306811574761ULL, 1, {21, 6, 0x0}},
-    {4589320676060802509ULL, 1, {30, 38, 0x0}},
-    {14928208149731698549ULL, 2, {51, 58, 0x0}},
-    {384452135516446838ULL, 2, {17, 9, 0x0}},
-    {10881042994673137523ULL, 1, {37, 53, 0x2}},
-    {14517200146087942421ULL, 1, {28, 12, 0x2}},
-    {12104678056871079147ULL, 1, {49, 58, 0x0}},
-    {16083454359407930157ULL, 1, {36, 52, 0x2}},
-    {9727971503483455233ULL, 1, {12, 6, 0x0}},
-    {2572225391431321841ULL, 1, {54, 61, 0x0}},
-    {3568581767632938472ULL, 3, {36, 28, 0x0}},
-    {14302680488846858708ULL, 1, {34, 50, 0x2}},
-    {17716716147889547255ULL, 1, {27, 11, 0x2}},
-    {13756233132790474790ULL, 1, {27, 34, 0x1}},
-    {1759304654378320633ULL, 1, {21, 6, 0x0}},
-    {6808731290387654335ULL, 1, {42, 57, 0x0}},
-    {3663523729227764811ULL, 1, {25, 9, 0x2}},
-    {3028771395365464983ULL, 1, {40, 48, 0x0}},
-    {8100970276233269951ULL, 1, {45, 53, 0x0}},
-    {7205173527211137269ULL, 1, {19, 11, 0x0}},
-    {5510446638222368955ULL, 1, {51, 58, 0x0}},
-    {10881042994673137523ULL, 1, {57, 59, 0x40}},
-    {6887177516621924522ULL, 5, {1, 3, 0x40}},
-    {2126653161014440036ULL, 5, {49, 58, 0x0}},
-    {14600983574997182927ULL, 5, {21, 13, 0x0}},
-    {7454100836064974569ULL, 5, {47, 55, 0x0}},
-    {9169622694104440521ULL, 1, {20, 12, 0x0}},
-    {5689738277423355132ULL, 1, {36, 52, 0x2}},
-    {151946528421529008ULL, 1, {12, 6, 0x0}},
-    {14584230869916330402ULL, 1, {43, 51, 0x0}},
-    {1420636047334169063ULL, 1, {17, 9, 0x0}},
-    {16834256498298395265ULL, 1, {37, 53, 0x2}},
-    {2675205998871724834ULL, 1, {9, 2, 0x0}},
-    {14649498753800946623ULL, 1, {45, 62, 0x0}},
-    {17905593382394388158ULL, 6, {42, 57, 0x0}},
-    {8014195774580633398ULL, 6, {29, 2, 0x1}},
-    {5061963274603856563ULL, 6, {43, 51, 0x0}},
-    {11787769092290583495ULL, 6, {18, 1, 0x0}},
-    {9185097134366520292ULL, 1, {36, 52, 0x2}},
-    {15130214919479486616ULL, 1, {36, 27, 0x1}},
-    {5815989514781190339ULL, 1, {36, 42, 0x1}},
-    {2402313572552456480ULL, 1, {18, 1, 0x0}},
-    {12556666928275919519ULL, 1, {45, 62, 0x0}},
-    {9920121575557290596ULL, 2, {26, 10, 0x2}},
-    {17410964988926628791ULL, 1, {43, 51, 0x0}},
-    {15080133942991294863ULL, 1, {18, 1, 0x0}},
-    {9724200707320908159ULL, 1, {44, 52, 0x0}},
-    {2567802458423663602ULL, 1, {29, 2, 0x0}},
-    {11265929304516735724ULL, 1, {42, 57, 0x0}},
-    {4014187189509302547ULL, 1, {37, 53, 0x2}},
-    {4156232714370462430ULL, 1, {14, 5, 0x0}},
-    {16339524873648102693ULL, 1, {45, 62, 0x0}},
-    {17691261484008082439ULL, 1, {18, 1, 0x0}},
-    {13452295439738373793ULL, 1, {42, 57, 0x0}},
-    {18233361358252252636ULL, 1, {19, 11, 0x0}},
-    {6663843875797161055ULL, 1, {43, 51, 0x0}},
-    {10822685812928616352ULL, 1, {29, 13, 0x2}},
-    {4784314245611081258ULL, 1, {46, 54, 0x0}},
-    {14722752504102510990ULL, 2, {34, 50, 0x2}},
-    {4727359872299454180ULL, 1, {9, 2, 0x0}},
-    {12946521733451100431ULL, 1, {42, 57, 0x0}},
-    {13361205947088884114ULL, 1, {28, 12, 0x2}},
-    {10661214832370973075ULL, 1, {28, 35, 0x1}},
-    {5816582285831007470ULL, 1, {28, 4, 0x1}},
-    {3699414432504008635ULL, 1, {45, 62, 0x0}},
-    {11569242016875752350ULL, 4, {43, 51, 0x0}},
-    {15866307651598513401ULL, 1, {41, 49, 0x0}},
-    {4495782780282520294ULL, 1, {28, 12, 0x2}},
-    {2792475244601652145ULL, 1, {42, 57, 0x0}},
-    {13004833892763861492ULL, 4, {44, 52, 0x0}},
-    {8377718131709258103ULL, 1, {52, 62, 0x0}},
-    {10311511755149628430ULL, 1, {21, 6, 0x0}},
-    {2617186323517748223ULL, 1, {27, 11, 0x2}},
-    {3587809130675807881ULL, 1, {51, 58, 0x0}},
-    {11314503528844194739ULL, 1, {19, 5, 0x0}},
-    {10453948261377118264ULL, 1, {44, 52, 0x0}},
-    {12692533639445378824ULL, 1, {21, 6, 0x0}},
-    {8854587472491768424ULL, 1, {42, 57, 0x0}},
-    {12604074158025521965ULL, 1, {29, 13, 0x2}},
-    {9007367709629722190ULL, 1, {43, 51, 0x0}},
-    {3980838960065995378ULL, 1, {43, 51, 0x0}},
-    {9462800290151167751ULL, 1, {17, 9, 0x0}},
-    {4071774761797541508ULL, 1, {42, 57, 0x0}},
-    {8448575242731240433ULL, 2, {52, 62, 0x0}},
-    {1631780662155416637ULL, 1, {21, 6, 0x0}},
-    {11764203874780763195ULL, 1, {42, 57, 0x0}},
-    {7748692583649315031ULL, 1, {18, 10, 0x0}},
-    {583072026002966787ULL, 1, {38, 54, 0x2}},
-    {16764546303442426248ULL, 1, {12, 6, 0x0}},
-    {12761815899475908269ULL, 1, {37, 53, 0x2}},
-    {6989685716348673765ULL, 1, {19, 11, 0x0}},
-    {5584213710445079593ULL, 1, {42, 57, 0x0}},
-    {4180925362546564933ULL, 1, {18, 1, 0x0}},
-    {3378492998177326433ULL, 1, {46, 54, 0x0}},
-    {3013905569081571243ULL, 1, {20, 2, 0x0}},
-    {5743952900217595174ULL, 1, {51, 58, 0x0}},
-    {8470066044995744290ULL, 1, {20, 12, 0x0}},
-    {15964596494731092581ULL, 1, {30, 58, 0x0}},
-    {6671818898598234695ULL, 1, {9, 2, 0x0}},
-    {6640441679568121010ULL, 1, {36, 52, 0x2}},
-    {8609301101699196205ULL, 1, {23, 15, 0x0}},
-    {13659617480291523371ULL, 1, {57, 59, 0x40}},
-    {6991759869702880635ULL, 3, {36, 52, 0x2}},
-    {2145754447149733268ULL, 2, {19, 11, 0x0}},
-    {8726460708508598003ULL, 2, {57, 59, 0x40}},
-    {9471853440028459599ULL, 1, {27, 11, 0x2}},
-    {730712018162289350ULL, 1, {54, 61, 0x0}},
-    {9140647452787248150ULL, 1, {20, 2, 0x0}},
-    {7877197296410592064ULL, 1, {43, 51, 0x0}},
-    {8762050583959427855ULL, 1, {29, 13, 0x2}},
-    {2160504995969215656ULL, 1, {30, 58, 0x0}},
-    {16330952840520217609ULL, 1, {2, 3, 0x0}},
-    {10098017608344450908ULL, 1, {51, 30, 0x0}},
-    {6627323009912906888ULL, 1, {44, 52, 0x0}},
-    {17620088045602845731ULL, 1, {28, 12, 0x2}},
-    {8659841589626431886ULL, 1, {52, 62, 0x0}},
-    {17019657236933890393ULL, 1, {19, 5, 0x0}},
-    {18043311450885669919ULL, 1, {42, 57, 0x0}},
-    {7101221365164624951ULL, 1, {12, 6, 0x0}},
-    {15513724526510473652ULL, 1, {43, 51, 0x0}},
-    {17343768162173374433ULL, 1, {44, 52, 0x0}},
-    {15767550864983308635ULL, 1, {57, 59, 0x40}},
-    {6426866533607652819ULL, 1, {19, 5, 0x0}},
-    {14851134896933763303ULL, 1, {49, 58, 0x0}},
-    {4864976291470472873ULL, 1, {21, 6, 0x0}},
-    {4491897023529820590ULL, 1, {40, 48, 0x0}},
-    {16125677912596589472ULL, 2, {28, 4, 0x1}},
-    {6711279977687720782ULL, 2, {42, 57, 0x0}},
-    {9168209492786967085ULL, 1, {21, 6, 0x0}},
-    {5782162683624352658ULL, 1, {45, 62, 0x0}},
-    {6336426424493360561ULL, 1, {20, 2, 0x0}},
-    {16383890876427829230ULL, 1, {20, 34, 0x1}},
-    {12508401380997725368ULL, 1, {20, 4, 0x1}},
-    {1099152746726700632ULL, 1, {43, 51, 0x0}},
-    {5536440748729165775ULL, 3, {37, 53, 0x2}},
-    {14279505864665860152ULL, 1, {29, 13, 0x2}},
-    {17072301288187539959ULL, 1, {45, 62, 0x0}},
-    {428678263658520080ULL, 1, {21, 6, 0x0}},
-    {17631482829038658193ULL, 1, {42, 57, 0x0}},
-    {17577781045043597180ULL, 1, {9, 2, 0x0}},
-    {1604436361618913026ULL, 1, {19, 11, 0x0}},
-    {12614104423051020356ULL, 1, {49, 58, 0x0}},
-    {13991009012707108773ULL, 1, {21, 30, 0x1}},
-    {6108324771026802591ULL, 1, {21, 14, 0x1}},
-    {10535983201947474063ULL, 1, {57, 59, 0x40}},
-    {2589573158679575216ULL, 3, {21, 6, 0x0}},
-    {10584405031101718194ULL, 2, {52, 62, 0x0}},
-    {160028484850521845ULL, 2, {27, 11, 0x2}},
-    {16170734905039444388ULL, 2, {35, 51, 0x2}},
-    {777990396790851720ULL, 1, {52, 62, 0x0}},
-    {12623279195391566658ULL, 1, {18, 1, 0x0}},
-    {2595882043065686363ULL, 1, {35, 51, 0x2}},
-    {12253590311650836938ULL, 1, {29, 2, 0x0}},
-    {1334449323420672656ULL, 1, {51, 58, 0x0}},
-    {11640251671858991824ULL, 1, {35, 28, 0x1}},
-    {15563614289196341224ULL, 1, {46, 52, 0x0}},
-    {11860608617220744156ULL, 2, {18, 1, 0x0}},
-    {491682638418130315ULL, 2, {27, 35, 0x0}},
-    {13456550584823013567ULL, 2, {28, 18, 0x0}},
-    {17298671013218249113ULL, 2, {45, 62, 0x0}},
-    {6426866533607652819ULL, 2, {18, 1, 0x0}},
-    {4954854639503694433ULL, 2, {49, 58, 0x0}},
-    {12557464768465772210ULL, 2, {21, 13, 0x0}},
-    {14495438768709609223ULL, 2, {42, 57, 0x0}},
-    {4265851414882591740ULL, 3, {20, 2, 0x0}},
-    {2637325078254515361ULL, 3, {57, 59, 0x40}},
-    {7620948258158937510ULL, 6, {41, 49, 0x0}},
-    {12827406069961229111ULL, 2, {52, 61, 0x0}},
-    {15988508608179915173ULL, 1, {1, 3, 0x40}},
-    {10716913298786750822ULL, 1, {51, 57, 0x0}},
-    {5042902563486555274ULL, 1, {44, 52, 0x0}},
-    {17047478063245314977ULL, 1, {14, 5, 0x0}},
-    {2954074423979448795ULL, 1, {45, 62, 0x0}},
-    {14345698562420743639ULL, 1, {28, 37, 0x1}},
-    {15301545555950680705ULL, 2, {47, 55, 0x0}},
-    {4138209972886916358ULL, 2, {20, 2, 0x0}},
-    {7765140717726829122ULL, 1, {42, 57, 0x0}},
-    {12161863026550030994ULL, 1, {35, 27, 0x0}},
-    {1151680779536203575ULL, 1, {52, 42, 0x0}},
-    {1967469480015213900ULL, 2, {46, 54, 0x0}},
-    {5869385635844162790ULL, 1, {25, 4, 0x0}},
-    {4977504983328923019ULL, 1, {58, 30, 0x0}},
-    {7538857440457673476ULL, 2, {44, 52, 0x0}},
-    {3133931215092272447ULL, 1, {37, 53, 0x2}},
-    {1853213078699427548ULL, 1, {36, 27, 0x1}},
-    {5305531818698032411ULL, 1, {36, 43, 0x1}},
-    {868190319056208210ULL, 1, {38, 2, 0x0}},
-    {10469710936235917113ULL, 1, {52, 61, 0x0}},
-    {15785635894244981277ULL, 2, {42, 57, 0x0}},
-    {4819542130482775027ULL, 1, {16, 8, 0x0}},
-    {15646232861137070531ULL, 1, {52, 62, 0x0}},
-    {7678280131753579654ULL, 1, {45, 62, 0x0}},
-    {1578435677420669396ULL, 1, {18, 1, 0x0}},
-    {9891031653519057358ULL, 1, {34, 61, 0x0}},
-    {3763220057467455070ULL, 2, {21, 13, 0x0}},
-    {4170846985360817091ULL, 2, {42, 57, 0x0}},
-    {10822695363883662631ULL, 2, {43, 51, 0x0}},
-    {17133496805546514110ULL, 5, {36, 52, 0x2}},
-    {10124210662019022835ULL, 1, {38, 2, 0x0}},
-    {11864985472886229329ULL, 1, {45, 62, 0x0}},
-    {2448743964428755036ULL, 1, {41, 49, 0x0}},
-    {6089610037671354878ULL, 1, {33, 5, 0x0}},
-    {2218778545920829921ULL, 1, {46, 60, 0x0}},
-    {12694204206617854514ULL, 1, {33, 5, 0x0}},
-    {14948307033173435213ULL, 1, {46, 60, 0x0}},
-    {8860805843273386487ULL, 1, {13, 4, 0x0}},
-    {15552395560254436786ULL, 1, {41, 49, 0x0}},
-    {8579612702522429523ULL, 1, {36, 52, 0x2}},
-    {18049956861693315839ULL, 1, {12, 4, 0x0}},
-    {15078526503536851862ULL, 1, {32, 48, 0x2}},
-    {8388064866067431519ULL, 1, {5, 3, 0x80}},
-    {16883991084228447582ULL, 1, {45, 53, 0x0}},
-    {10563597401517293534ULL, 2, {17, 9, 0x0}},
-    {3391644285989027401ULL, 1, {46, 54, 0x0}},
-    {6747314836421436586ULL, 1, {9, 2, 0x0}},
-    {14351165018859868986ULL, 1, {54, 61, 0x0}},
-    {2093459012773544304ULL, 1, {51, 58, 0x0}},
-    {7678280131753579654ULL, 1, {41, 49, 0x0}},
-    {2568362333663799763ULL, 1, {18, 1, 0x0}},
-    {7564604610615240487ULL, 1, {49, 58, 0x0}},
-    {3209144858891408054ULL, 2, {17, 9, 0x0}},
-    {17653127058113474043ULL, 2, {43, 51, 0x0}},
-    {4266676822898686648ULL, 2, {9, 2, 0x0}},
-    {18128335501968969319ULL, 1, {1, 3, 0x40}},
-    {4065295993434409997ULL, 1, {57, 59, 0x40}},
-    {16269969763765474400ULL, 6, {20, 12, 0x0}},
-    {1290824433729555758ULL, 1, {41, 49, 0x0}},
-    {16662848809926337071ULL, 1, {21, 6, 0x0}},
-    {7785863111250225368ULL, 1, {49, 58, 0x0}},
-    {1498514492536873048ULL, 1, {17, 9, 0x0}},
-    {1330528191143959034ULL, 1, {45, 62, 0x0}},
-    {3445526569978559419ULL, 1, {9, 2, 0x0}},
-    {14483204128172795756ULL, 7, {52, 61, 0x0}},
-    {4407573588513695826ULL, 1, {19, 5, 0x0}},
-    {14867991699566254505ULL, 1, {52, 62, 0x0}},
-    {1552752966703351933ULL, 1, {36, 52, 0x2}},
-    {14464778642202686683ULL, 1, {20, 2, 0x0}},
-    {4535249283800345235ULL, 2, {37, 53, 0x2}},
-    {11970921325575796007ULL, 1, {22, 14, 0x0}},
-    {4620754247252905375ULL, 1, {45, 62, 0x0}},
-    {14783785900967398601ULL, 1, {19, 11, 0x0}},
-    {9039607097023154439ULL, 1, {44, 52, 0x0}},
-    {17724737368881040068ULL, 1, {29, 13, 0x2}},
-    {8898096394377743800ULL, 1, {52, 62, 0x0}},
-    {1286666390796853609ULL, 1, {21, 6, 0x0}},
-    {17781208038847832262ULL, 1, {35, 51, 0x2}},
-    {15123715279150201890ULL, 1, {18, 1, 0x0}},
-    {13564849288240637491ULL, 1, {44, 52, 0x0}},
-    {17731649927793641890ULL, 1, {28, 12, 0x2}},
-    {5872442014914898408ULL, 1, {28, 37, 0x1}},
-    {14970792189213142989ULL, 1, {28, 18, 0x1}},
-    {12829857551425522296ULL, 1, {42, 57, 0x0}},
-    {6133301595152107456ULL, 3, {12, 6, 0x0}},
-    {15206908358190368903ULL, 2, {26, 44, 0x1}},
-    {13341375905411798442ULL, 1, {20, 12, 0x0}},
-    {7287402706837379573ULL, 1, {42, 57, 0x0}},
-    {8876299967437453441ULL, 2, {42, 57, 0x0}},
-    {7961805876300339029ULL, 2, {35, 27, 0x0}},
-    {17819148946066809180ULL, 2, {36, 42, 0x0}},
-    {9481557531746939739ULL, 4, {28, 12, 0x2}},
-    {12018773109623275322ULL, 4, {28, 37, 0x1}},
-    {11357975589073024167ULL, 3, {29, 13, 0x2}},
-    {14078588428665249774ULL, 3, {49, 58, 0x0}},
-    {10867419332723121473ULL, 2, {18, 1, 0x0}},
-    {3328655624250921066ULL, 3, {57, 59, 0x40}},
-    {3209144858891408054ULL, 2, {19, 11, 0x0}},
-    {10113385522770992919ULL, 2, {37, 28, 0x1}},
-    {13775277063001850550ULL, 1, {39, 60, 0x0}},
-    {7139518719204645528ULL, 1, {12, 6, 0x0}},
-    {6527989989505014588ULL, 1, {37, 39, 0x1}},
-    {13396606202090000715ULL, 1, {44, 58, 0x0}},
-    {18350285346017450764ULL, 1, {20, 2, 0x0}},
-    {9463267820597993626ULL, 1, {25, 61, 0x0}},
-    {4325179797362092136ULL, 1, {18, 1, 0x0}},
-    {14501919336883904322ULL, 1, {49, 58, 0x0}},
-    {14079786836315397439ULL, 1, {36, 52, 0x2}},
-    {11477906643496516861ULL, 1, {36, 27, 0x1}},
-    {6114789344166258153ULL, 1, {36, 60, 0x1}},
-    {1631780662155416637ULL, 1, {29, 2, 0x0}},
-    {1334449323420672656ULL, 1, {45, 53, 0x0}},
-    {3882922479985616845ULL, 1, {1, 3, 0x40}},
-    {15951628119734191741ULL, 1, {51, 58, 0x0}},
-    {7537262777870219194ULL, 5, {21, 6, 0x0}},
-    {953844205230307677ULL, 5, {42, 57, 0x0}},
-    {4475667876256774178ULL, 1, {47, 55, 0x0}},
-    {1848827282326176095ULL, 1, {18, 1, 0x0}},
-    {11963779754448401402ULL, 3, {38, 54, 0x2}},
-    {9777892005113345103ULL, 3, {33, 5, 0x0}},
-    {13487539935106092573ULL, 2, {54, 61, 0x0}},
-    {6681590582076721110ULL, 1, {19, 11, 0x0}},
-    {3412807013053522598ULL, 1, {40, 48, 0x0}},
-    {5524180836157283416ULL, 2, {21, 13, 0x0}},
-    {7742437498093908567ULL, 2, {21, 28, 0x1}},
-    {18320648813819720171ULL, 2, {21, 6, 0x1}},
-    {3286079214953590217ULL, 2, {44, 52, 0x0}},
-    {11409540246999345823ULL, 1, {41, 49, 0x0}},
-    {14986774971643466684ULL, 1, {17, 9, 0x0}},
-    {9995142488888414273ULL, 1, {49, 58, 0x0}},
-    {118460447067625493ULL, 1, {9, 2, 0x0}},
-    {7740297180846066251ULL, 1, {42, 57, 0x0}},
-    {15673585780861600043ULL, 2, {1, 3, 0x40}},
-    {10722546617560292181ULL, 1, {46, 54, 0x0}},
-    {310937205469418843ULL, 1, {32, 4, 0x0}},
-    {8138108260352889398ULL, 1, {41, 49, 0x0}},
-    {15471780677375328054ULL, 1, {21, 6, 0x0}},
-    {3796363722334826863ULL, 1, {42, 57, 0x0}},
-    {16577138756520837347ULL, 1, {17, 9, 0x0}},
-    {5273635759440664680ULL, 1, {41, 49, 0x0}},
-    {279738564591754543ULL, 1, {9, 2, 0x0}},
-    {12178954041838142204ULL, 1, {49, 58, 0x0}},
-    {6323382415598619836ULL, 1, {20, 12, 0x0}},
-    {10816217084266649711ULL, 1, {57, 59, 0x40}},
-    {15471780677375328054ULL, 1, {17, 9, 0x0}},
-    {344322533913026017ULL, 1, {42, 57, 0x0}},
-    {7356759880663256280ULL, 1, {9, 2, 0x0}},
-    {6526940000170854864ULL, 1, {44, 52, 0x0}},
-    {14434582203397238564ULL, 1, {21, 6, 0x0}},
-    {10938883588015284162ULL, 1, {41, 49, 0x0}},
-    {17880565821110250473ULL, 1, {20, 12, 0x0}},
-    {9066308518990209926ULL, 1, {49, 58, 0x0}},
-    {16086452201153868928ULL, 2, {20, 12, 0x0}},
-    {7080483635733032720ULL, 2, {41, 49, 0x0}},
-    {207893198937303978ULL, 2, {17, 9, 0x0}},
-    {3463559734294616496ULL, 2, {49, 58, 0x0}},
-    {11017586699975469576ULL, 2, {9, 2, 0x0}},
-    {12509190341018259449ULL, 2, {35, 51, 0x2}},
-    {17563019226101926097ULL, 1, {45, 38, 0x1}},
-    {4115168600060987560ULL, 1, {45, 52, 0x1}},
-    {17410964988926628791ULL, 1, {41, 49, 0x0}},
-    {6775666442335049669ULL, 1, {18, 1, 0x0}},
-    {2555499046706866079ULL, 1, {49, 58, 0x0}},
-    {13989414337124873909ULL, 1, {17, 9, 0x0}},
-    {17743348602524724461ULL, 1, {44, 52, 0x0}},
-    {6265808162910730257ULL, 1, {29, 36, 0x1}},
-    {12761876037875676435ULL, 1, {29, 22, 0x1}},
-    {15447249870531398245ULL, 1, {35, 43, 0x0}},
-    {12528464915675379864ULL, 1, {25, 42, 0x0}},
-    {10316887188644861750ULL, 1, {35, 51, 0x2}},
-    {4512977590302776984ULL, 1, {36, 28, 0x0}},
-    {2244789367302037848ULL, 1, {41, 49, 0x0}},
-    {11885037374987810415ULL, 1, {27, 11, 0x2}},
-    {3708659275266732826ULL, 1, {49, 58, 0x0}},
-    {10542793233048681832ULL, 1, {21, 6, 0x0}},
-    {271757610958949087ULL, 1, {39, 55, 0x2}},
-    {9336284102959383684ULL, 1, {21, 6, 0x0}},
-    {7299292445461117257ULL, 1, {28, 37, 0x1}},
-    {16100126992278844633ULL, 3, {41, 49, 0x0}},
-    {8163029570126985157ULL, 1, {19, 11, 0x0}},
-    {16860113988184620885ULL, 1, {49, 58, 0x0}},
-    {4761002714638917751ULL, 1, {28, 12, 0x2}},
-    {1000675813697508369ULL, 1, {37, 53, 0x2}},
-    {10207497352283568154ULL, 1, {36, 28, 0x0}},
-    {8969755738068746862ULL, 1, {44, 52, 0x0}},
-    {4286387923052900783ULL, 3, {37, 58, 0x0}},
-    {9619654411036369844ULL, 2, {1, 3, 0x40}},
-    {5859663732633032685ULL, 2, {42, 60, 0x0}},
-    {1878031429603911273ULL, 2, {21, 13, 0x0}},
-    {14809116808208455894ULL, 2, {51, 57, 0x0}},
-    {10822695363883662631ULL, 2, {34, 61, 0x0}},
-    {17518309165863011692ULL, 2, {41, 49, 0x0}},
-    {13885409755881270397ULL, 2, {38, 29, 0x1}},
-    {4013868063920575874ULL, 2, {47, 55, 0x0}},
-    {17062104511720056560ULL, 2, {12, 5, 0x0}},
-    {2300889168127978200ULL, 1, {46, 54, 0x0}},
-    {1915407437674664021ULL, 1, {23, 15, 0x0}},
-    {10562113108548526183ULL, 1, {21, 30, 0x1}},
-    {17576687542214718682ULL, 1, {21, 14, 0x1}},
-    {1978517871763870368ULL, 1, {27, 36, 0x1}},
-    {9941928836988309392ULL, 1, {36, 52, 0x2}},
-    {12674560156944829207ULL, 1, {12, 6, 0x0}},
-    {10215704189166924173ULL, 1, {45, 62, 0x0}},
-    {622438577339773979ULL, 1, {17, 9, 0x0}},
-    {7358187876155566949ULL, 1, {42, 57, 0x0}},
-    {6002176467628409345ULL, 1, {37, 53, 0x2}},
-    {7744981023904060931ULL, 1, {36, 28, 0x0}},
-    {2826594717985452824ULL, 1, {44, 52, 0x0}},
-    {1631512165894786039ULL, 1, {21, 6, 0x0}},
-    {12519747849473272058ULL, 1, {51, 58, 0x0}},
-    {10355716047744642808ULL, 1, {37, 58, 0x0}},
-    {15999491478527139252ULL, 1, {19, 11, 0x0}},
-    {2427479130227997270ULL, 1, {44, 52, 0x0}},
-    {12867406410077775715ULL, 1, {28, 12, 0x2}},
-    {8726859001062378535ULL, 1, {30, 37, 0x0}},
-    {3888513160075342839ULL, 3, {45, 53, 0x0}},
-    {13161278961864926647ULL, 2, {16, 8, 0x0}},
-    {11457799284235414758ULL, 1, {36, 52, 0x2}},
-    {8294850713922307019ULL, 1, {35, 27, 0x0}},
-    {18086612917388666306ULL, 1, {40, 57, 0x0}},
-    {16715324912760771006ULL, 2, {11, 1, 0x0}},
-    {10895887300347390449ULL, 2, {45, 62, 0x0}},
-    {15115408963333091691ULL, 2, {21, 13, 0x0}},
-    {1833656183454297770ULL, 1, {28, 37, 0x1}},
-    {17713910236975932114ULL, 1, {42, 57, 0x0}},
-    {9513236033384119543ULL, 1, {9, 2, 0x0}},
-    {14126971901331892256ULL, 1, {36, 52, 0x2}},
-    {16590627909913132959ULL, 1, {1, 3, 0x40}},
-    {14443767795450437274ULL, 1, {20, 12, 0x0}},
-    {3748078566998383098ULL, 1, {51, 58, 0x0}},
-    {10355716047744642808ULL, 4, {42, 57, 0x0}},
-    {8955599048947091230ULL, 2, {13, 4, 0x0}},
-    {8847582053468192663ULL, 2, {54, 47, 0x0}},
-    {13786902070151292447ULL, 1, {52, 62, 0x0}},
-    {14279505864665860152ULL, 2, {9, 2, 0x0}},
-    {914827623818171818ULL, 1, {36, 52, 0x2}},
-    {12199869835035801959ULL, 1, {18, 1, 0x0}},
-    {15600799605251911477ULL, 4, {45, 62, 0x0}},
-    {6169696536687634281ULL, 1, {1, 3, 0x40}},
-    {2933402362267935935ULL, 1, {35, 51, 0x2}},
-    {13416359777553781938ULL, 1, {20, 12, 0x0}},
-    {17222813472492065789ULL, 1, {51, 58, 0x0}},
-    {5101714086375250729ULL, 1, {41, 49, 0x0}},
-    {6120775995328749282ULL, 1, {9, 2, 0x0}},
-    {16322081069638909478ULL, 2, {38, 2, 0x0}},
-    {8386510791805715863ULL, 2, {49, 58, 0x0}},
-    {396811135010703028ULL, 2, {1, 3, 0x40}},
-    {6618985435219846823ULL, 1, {35, 51, 0x2}},
-    {10604165298643732127ULL, 1, {29, 13, 0x2}},
-    {14692076050605415250ULL, 1, {28, 37, 0x1}},
-    {16257097268434136104ULL, 4, {29, 13, 0x2}},
-    {1976467755240000960ULL, 4, {43, 51, 0x0}},
-    {17951311593127819798ULL, 1, {42, 57, 0x0}},
-    {5716014382120065911ULL, 1, {11, 4, 0x0}},
-    {11817251930449066489ULL, 1, {45, 62, 0x0}},
-    {2313230668809981331ULL, 1, {9, 2, 0x0}},
-    {2959447677840673346ULL, 1, {51, 58, 0x0}},
-    {993820064801540863ULL, 2, {21, 13, 0x0}},
-    {14890203626925552659ULL, 1, {47, 55, 0x0}},
-    {15903038813817600414ULL, 4, {26, 5, 0x0}},
-    {16530246536931435579ULL, 3, {12, 6, 0x0}},
-    {16483465824228383641ULL, 2, {43, 51, 0x0}},
-    {4109029209836402763ULL, 3, {46, 54, 0x0}},
-    {5698785368986343228ULL, 1, {16, 8, 0x0}},
-    {1653352079387579085ULL, 1, {54, 61, 0x0}},
-    {3166471370965575426ULL, 1, {19, 11, 0x0}},
-    {8550191678227079581ULL, 1, {37, 53, 0x2}},
-    {583571228840306217ULL, 1, {28, 12, 0x2}},
-    {2705603512700812536ULL, 1, {28, 37, 0x1}},
-    {7285684960846406376ULL, 1, {28, 11, 0x1}},
-    {9720808026548882503ULL, 1, {24, 8, 0x2}},
-    {6333163837910002517ULL, 1, {32, 48, 0x2}},
-    {3377171724317742455ULL, 1, {19, 5, 0x0}},
-    {10145484552411941822ULL, 1, {45, 53, 0x0}},
-    {1017817944632322248ULL, 3, {29, 13, 0x2}},
-    {11079445535311951363ULL, 3, {45, 62, 0x0}},
-    {9674855156149353128ULL, 3, {21, 6, 0x0}},
-    {12253653967179622131ULL, 3, {28, 45, 0x0}},
-    {10293055162037823311ULL, 2, {28, 18, 0x1}},
-    {8578247627682750578ULL, 2, {28, 37, 0x1}},
-    {7750887935427353486ULL, 2, {38, 54, 0x2}},
-    {1866326805214807779ULL, 1, {52, 62, 0x0}},
-    {9871669691468267076ULL, 1, {18, 1, 0x0}},
-    {13739125101880309120ULL, 1, {41, 49, 0x0}},
-    {16593662882796608773ULL, 1, {21, 6, 0x0}},
-    {12201017017452881748ULL, 1, {45, 53, 0x0}},
-    {9073386793767890390ULL, 1, {27, 11, 0x2}},
-    {58486561438437637ULL, 1, {27, 36, 0x1}},
-    {15871311355326417738ULL, 2, {42, 57, 0x0}},
-    {15025247643562535925ULL, 2, {37, 53, 0x2}},
-    {8523682072765390941ULL, 1, {28, 12, 0x2}},
-    {2862481100648688676ULL, 1, {57, 59, 0x40}},
-    {16838785698363190156ULL, 1, {17, 9, 0x0}},
-    {6721850083469771014ULL, 1, {42, 57, 0x0}},
-    {1989117655144510564ULL, 1, {51, 58, 0x0}},
-    {4978320699383804585ULL, 1, {27, 11, 0x2}},
-    {4218809110636770978ULL, 2, {44, 52, 0x0}},
-    {12242815701837609289ULL, 2, {28, 12, 0x2}},
-    {634493279953389634ULL, 2, {28, 37, 0x1}},
-    {3725861170738813190ULL, 1, {28, 12, 0x2}},
-    {14900568074434164175ULL, 1, {27, 36, 0x1}},
-    {17585359720448068750ULL, 1, {27, 21, 0x1}},
-    {2324544085686870754ULL, 1, {42, 57, 0x0}},
-    {13662260861317265669ULL, 3, {37, 45, 0x0}},
-    {14046679179112457962ULL, 1, {35, 51, 0x2}},
-    {2688759994930025472ULL, 1, {27, 11, 0x2}},
-    {110649379935606559ULL, 1, {45, 62, 0x0}},
-    {7347428375358090362ULL, 2, {1, 3, 0x40}},
-    {15995125720638228343ULL, 2, {57, 59, 0x40}},
-    {15712428185523199541ULL, 2, {21, 13, 0x0}},
-    {400219203320727273ULL, 1, {51, 57, 0x0}},
-    {8163029570126985157ULL, 1, {28, 12, 0x2}},
-    {11592845186346067347ULL, 1, {49, 58, 0x0}},
-    {15776296958963014783ULL, 1, {16, 8, 0x0}},
-    {11398227763728937270ULL, 1, {18, 25, 0x1}},
-    {16619910677251611603ULL, 1, {52, 62, 0x0}},
-    {10169313781915817832ULL, 1, {29, 2, 0x0}},
-    {16243519254601383454ULL, 1, {42, 57, 0x0}},
-    {4521472673423428096ULL, 1, {37, 53, 0x2}},
-    {1684232874745038522ULL, 1, {19, 11, 0x0}},
-    {16524922263705215308ULL, 1, {57, 59, 0x40}},
-    {7911383522077931103ULL, 1, {37, 53, 0x2}},
-    {12786536733888326792ULL, 1, {27, 11, 0x2}},
-    {12886379800431348820ULL, 1, {21, 13, 0x0}},
-    {16692775745952702739ULL, 1, {49, 58, 0x0}},
-    {15956672042873563650ULL, 1, {33, 5, 0x0}},
-    {12432952356401683391ULL, 2, {44, 52, 0x0}},
-    {1122061931576278220ULL, 1, {16, 8, 0x0}},
-    {11725694406054537771ULL, 1, {51, 58, 0x0}},
-    {11469529866255864730ULL, 1, {19, 11, 0x0}},
-    {8863480504210838169ULL, 1, {46, 54, 0x0}},
-    {6399184565892408140ULL, 1, {36, 21, 0x0}},
-    {10869508991817435374ULL, 1, {36, 42, 0x1}},
-    {12886379800431348820ULL, 1, {21, 6, 0x0}},
-    {2137984931330708089ULL, 1, {36, 52, 0x2}},
-    {4455928595891052414ULL, 1, {26, 5, 0x0}},
-    {6749863748952410002ULL, 1, {49, 58, 0x0}},
-    {5116264745546943020ULL, 1, {19, 11, 0x0}},
-    {11575862793401887408ULL, 1, {45, 53, 0x0}},
-    {3191478979579164346ULL, 2, {31, 38, 0x0}},
-    {11280962454691932597ULL, 2, {42, 57, 0x0}},
-    {3519099425877449069ULL, 2, {1, 3, 0x40}},
-    {2469568715001403338ULL, 1, {47, 55, 0x0}},
-    {14878020546722721943ULL, 3, {22, 14, 0x0}},
-    {5503580811491008221ULL, 1, {47, 55, 0x0}},
-    {10722899401987875133ULL, 1, {19, 11, 0x0}},
-    {17995935677730672616ULL, 1, {36, 52, 0x2}},
-    {15479692973268952471ULL, 1, {14, 5, 0x0}},
-    {17776891145295318630ULL, 1, {44, 58, 0x0}},
-    {6102227344327626433ULL, 1, {46, 54, 0x0}},
-    {6570991300764576178ULL, 1, {18, 1, 0x0}},
-    {7349185230965718355ULL, 1, {54, 61, 0x0}},
-    {2483736572461555677ULL, 1, {28, 12, 0x2}},
-    {2551569142855406141ULL, 1, {30, 58, 0x0}},
-    {2387677090272967736ULL, 1, {22, 4, 0x0}},
-    {1514990828456548224ULL, 1, {39, 55, 0x2}},
-    {6238136996356891524ULL, 1, {20, 12, 0x0}},
-    {15746471319844499519ULL, 1, {42, 57, 0x0}},
-    {4456538972177713685ULL, 1, {9, 2, 0x0}},
-    {17400354758213905207ULL, 1, {30, 58, 0x0}},
-    {13761616721129093208ULL, 1, {23, 15, 0x0}},
-    {17917986786552939606ULL, 1, {51, 30, 0x0}},
-    {15043045538022147528ULL, 1, {28, 12, 0x2}},
-    {7612928211204472827ULL, 1, {44, 52, 0x0}},
-    {4819542130482775027ULL, 1, {11, 2, 0x0}},
-    {1290254163418052278ULL, 1, {57, 59, 0x40}},
-    {11359052761181115683ULL, 1, {29, 2, 0x0}},
-    {17703459259886953412ULL, 1, {43, 51, 0x0}},
-    {3769603945553547819ULL, 1, {20, 12, 0x0}},
-    {1780921953423135554ULL, 1, {51, 58, 0x0}},
-    {16299410025516671526ULL, 1, {52, 62, 0x0}},
-    {13899877989126732488ULL, 1, {18, 1, 0x0}},
-    {6628171448697696ULL, 1, {45, 62, 0x0}},
-    {1149003012592182808ULL, 1, {9, 2, 0x0}},
-    {547391465646528483ULL, 1, {49, 58, 0x0}},
-    {16769639420264252993ULL, 1, {1, 3, 0x40}},
-    {7091729323697852133ULL, 2, {45, 62, 0x0}},
-    {13404751211069413523ULL, 1, {43, 51, 0x0}},
-    {18278227007709910958ULL, 2, {47, 55, 0x0}},
-    {15665118164579494709ULL, 1, {31, 15, 0x2}},
-    {4076108340303473637ULL, 1, {45, 62, 0x0}},
-    {8903149488731738733ULL, 3, {17, 9, 0x0}},
-    {8525850663299335419ULL, 1, {44, 52, 0x0}},
-    {15403877859232085712ULL, 1, {35, 27, 0x0}},
-    {4539308133701679017ULL, 1, {45, 62, 0x0}},
-    {17090598348757172286ULL, 1, {28, 12, 0x2}},
-    {1403819644670073295ULL, 1, {46, 60, 0x0}},
-    {14994908378016895015ULL, 1, {22, 14, 0x0}},
-    {11758981599465054020ULL, 1, {36, 52, 0x2}},
-    {6700179748625294699ULL, 1, {19, 11, 0x0}},
-    {6397105971888477125ULL, 1, {51, 58, 0x0}},
-    {67901588516764164ULL, 1, {20, 2, 0x0}},
-    {711339711237851540ULL, 1, {57, 59, 0x40}},
-    {6105018548052386563ULL, 1, {45, 62, 0x0}},
-    {5588840905901031889ULL, 1, {29, 13, 0x2}},
-    {18181360946000062474ULL, 1, {41, 49, 0x0}},
-    {4236708405829551657ULL, 1, {51, 57, 0x0}},
-    {3020983148694912262ULL, 2, {36, 52, 0x2}},
-    {6683413329642608899ULL, 2, {36, 29, 0x1}},
-    {983864879057238617ULL, 2, {36, 42, 0x1}},
-    {14574780443284142322ULL, 2, {9, 2, 0x0}},
-    {2776220879548718950ULL, 2, {49, 58, 0x0}},
-    {8930855776196646118ULL, 1, {19, 5, 0x0}},
-    {14039953157888891135ULL, 1, {35, 51, 0x2}},
-    {17253686817926314415ULL, 1, {27, 11, 0x2}},
-    {3947091181153065774ULL, 1, {27, 36, 0x1}},
-    {18357906187242215863ULL, 1, {29, 2, 0x0}},
-    {16465146174140577745ULL, 1, {25, 61, 0x0}},
-    {1919751839878199236ULL, 1, {11, 1, 0x0}},
-    {14933353866647537466ULL, 1, {43, 51, 0x0}},
-    {8782252516741021107ULL, 2, {45, 62, 0x0}},
-    {7531827262477569249ULL, 1, {26, 10, 0x2}},
-    {2369033366753316093ULL, 1, {51, 57, 0x0}},
-    {13116231867729143094ULL, 1, {18, 1, 0x0}},
-    {6454488397478818427ULL, 1, {45, 51, 0x0}},
-    {2933483170796615293ULL, 1, {29, 2, 0x0}},
-    {8122265391643684228ULL, 1, {51, 58, 0x0}},
-    {9920121575557290596ULL, 3, {18, 1, 0x0}},
-    {12749293669328252047ULL, 3, {44, 52, 0x0}},
-    {485365094009947338ULL, 3, {28, 12, 0x2}},
-    {15559759633509874702ULL, 3, {28, 37, 0x1}},
-    {6525368963414260409ULL, 3, {28, 18, 0x1}},
-    {8917516792249963565ULL, 2, {42, 57, 0x0}},
-    {12385723303618198603ULL, 2, {33, 5, 0x0}},
-    {17964464479095685126ULL, 1, {52, 62, 0x0}},
-    {7442589029917807455ULL, 1, {19, 11, 0x0}},
-    {8502442108831794280ULL, 1, {42, 57, 0x0}},
-    {5081574438969224558ULL, 1, {12, 6, 0x0}},
-    {8480836234384308368ULL, 1, {37, 53, 0x2}},
-    {11362858467447526888ULL, 1, {18, 1, 0x0}},
-    {4521206243472197377ULL, 1, {43, 51, 0x0}},
-    {6969967407822763305ULL, 1, {1, 3, 0x40}},
-    {15769808921365253392ULL, 1, {49, 58, 0x0}},
-    {14035217114420712781ULL, 1, {17, 9, 0x0}},
-    {76179935231401896ULL, 1, {38, 54, 0x2}},
-    {1395246973080635110ULL, 1, {9, 2, 0x0}},
-    {17579494662915593523ULL, 1, {54, 61, 0x0}},
-    {5153915744434061188ULL, 1, {11, 4, 0x0}},
-    {16086676465374949579ULL, 1, {43, 51, 0x0}},
-    {13569620647532257995ULL, 1, {44, 52, 0x0}},
-    {8748720130028927901ULL, 1, {1, 3, 0x40}},
-    {15259301564992274946ULL, 1, {40, 48, 0x0}},
-    {11523581824910725787ULL, 1, {21, 13, 0x0}},
-    {5519562321370165770ULL, 1, {42, 57, 0x0}},
-    {7796621468328471473ULL, 5, {17, 9, 0x0}},
-    {14987928705636380328ULL, 1, {34, 50, 0x2}},
-    {7321467535876368933ULL, 1, {24, 18, 0x0}},
-    {15536726938824368269ULL, 1, {41, 49, 0x0}},
-    {2539549800177039240ULL, 1, {34, 61, 0x0}},
-    {16809098110328476850ULL, 1, {18, 1, 0x0}},
-    {14799182543896006377ULL, 3, {43, 51, 0x0}},
-    {9727702507890721162ULL, 1, {19, 11, 0x0}},
-    {15253135747056524925ULL, 1, {42, 57, 0x0}},
-    {3251840631670739606ULL, 1, {24, 18, 0x0}},
-    {10685981777156373837ULL, 1, {25, 34, 0x0}},
-    {1396439026737845388ULL, 4, {47, 55, 0x0}},
-    {2228310023191286898ULL, 1, {45, 62, 0x0}},
-    {2589573158679575216ULL, 4, {17, 9, 0x0}},
-    {12284294287851770482ULL, 3, {41, 49, 0x0}},
-    {4463591738290073319ULL, 3, {9, 2, 0x0}},
-    {13712303114100584165ULL, 3, {49, 58, 0x0}},
-    {15307288739378316726ULL, 1, {20, 12, 0x0}},
-    {16185588438425045947ULL, 1, {44, 52, 0x0}},
-    {12869315064288850079ULL, 1, {27, 11, 0x2}},
-    {13756004670961073262ULL, 1, {35, 51, 0x2}},
-    {3416519711809590334ULL, 1, {21, 6, 0x0}},
-    {12594402223089237474ULL, 1, {42, 57, 0x0}},
-    {16999124547881171548ULL, 1, {34, 27, 0x1}},
-    {10094493505524731572ULL, 1, {34, 61, 0x1}},
-    {8955599048947091230ULL, 1, {22, 4, 0x0}},
-    {9598053961461650201ULL, 1, {36, 52, 0x2}},
-    {6720658469582997910ULL, 1, {45, 62, 0x0}},
-    {12617239697912785241ULL, 1, {28, 12, 0x2}},
-    {7491013324051048746ULL, 1, {25, 61, 0x0}},
-    {13193787331723329413ULL, 1, {9, 2, 0x0}},
-    {294447516637279088ULL, 1, {43, 51, 0x0}},
-    {1108873433279187738ULL, 1, {1, 3, 0x40}},
-    {5937910730736034284ULL, 1, {44, 58, 0x0}},
-    {7537262777870219194ULL, 2, {33, 5, 0x0}},
-    {6318803886637435247ULL, 1, {40, 48, 0x0}},
-    {2533751691898984409ULL, 1, {24, 33, 0x0}},
-    {1492120707547383600ULL, 1, {46, 60, 0x0}},
-    {196176948054795775ULL, 1, {45, 62, 0x0}},
-    {17035308851424784207ULL, 1, {21, 13, 0x0}},
-    {16627130665657605774ULL, 1, {46, 54, 0x0}},
-    {5704785486228255402ULL, 2, {46, 54, 0x0}},
-    {5621189709276204188ULL, 1, {30, 14, 0x2}},
-    {4504995389201361879ULL, 1, {54, 61, 0x0}},
-    {10293055162037823311ULL, 1, {17, 9, 0x0}},
-    {16819080869646010437ULL, 1, {51, 57, 0x0}},
-    {505234611596610632ULL, 1, {44, 52, 0x0}},
-    {16361063422069259355ULL, 1, {28, 12, 0x2}},
-    {18342381722415433794ULL, 1, {33, 49, 0x2}},
-    {7768966351266307150ULL, 1, {24, 8, 0x2}},
-    {3815715691124101920ULL, 1, {25, 33, 0x0}},
-    {8959450622482795558ULL, 1, {19, 11, 0x0}},
-    {16311738673844727407ULL, 1, {54, 61, 0x0}},
-    {5545313792472394485ULL, 1, {11, 2, 0x0}},
-    {2065113424820093588ULL, 1, {43, 51, 0x0}},
-    {10243169323347454696ULL, 1, {1, 3, 0x40}},
-    {14351330518235973048ULL, 1, {37, 53, 0x2}},
-    {15662193920663234639ULL, 1, {42, 57, 0x0}},
-    {5869385635844162790ULL, 1, {23, 15, 0x0}},
-    {2133389523756470536ULL, 1, {58, 30, 0x0}},
-    {7701977840509017943ULL, 2, {9, 2, 0x0}},
-    {15176747765653098988ULL, 1, {37, 53, 0x2}},
-    {13213591585482280267ULL, 1, {1, 3, 0x40}},
-    {6720658469582997910ULL, 1, {43, 51, 0x0}},
-    {6318846912658469930ULL, 1, {9, 2, 0x0}},
-    {13662012103396197378ULL, 1, {42, 57, 0x0}},
-    {2413318848762180534ULL, 1, {37, 53, 0x2}},
-    {11150419038426781978ULL, 1, {20, 12, 0x0}},
-    {3748078566998383098ULL, 1, {45, 62, 0x0}},
-    {14912508655231223447ULL, 2, {12, 5, 0x0}},
-    {3049815707414631977ULL, 1, {29, 36, 0x1}},
-    {7450564160707493255ULL, 1, {43, 61, 0x0}},
-    {2913244686925594615ULL, 1, {18, 1, 0x0}},
-    {8566474134460386068ULL, 1, {45, 62, 0x0}},
-    {12300131588700460585ULL, 1, {28, 12, 0x2}},
-    {17317031262156987225ULL, 1, {28, 35, 0x1}},
-    {8062892291652416076ULL, 1, {45, 62, 0x0}},
-    {9770712828427831827ULL, 1, {37, 53, 0x2}},
-    {6905805197361710038ULL, 1, {36, 28, 0x0}},
-    {14524731918890749867ULL, 1, {44, 52, 0x0}},
-    {13857362112515492628ULL, 1, {21, 6, 0x0}},
-    {18160575012496129293ULL, 1, {20, 2, 0x0}},
-    {11669050029105674037ULL, 1, {43, 51, 0x0}},
-    {7032094484578472912ULL, 1, {45, 28, 0x0}},
-    {11409540246999345823ULL, 1, {42, 57, 0x0}},
-    {13744904741815830085ULL, 1, {17, 9, 0x0}},
-    {4552569000938933318ULL, 1, {41, 49, 0x0}},
-    {13916262761760573882ULL, 1, {9, 2, 0x0}},
-    {14330686228400927699ULL, 1, {49, 58, 0x0}},
-    {10722546617560292181ULL, 1, {57, 59, 0x40}},
-    {5678631479806726071ULL, 1, {23, 15, 0x0}},
-    {15340834388669391950ULL, 1, {45, 53, 0x0}},
-    {3466013003869596279ULL, 1, {18, 1, 0x0}},
-    {7610836377752460079ULL, 4, {18, 1, 0x0}},
-    {2005761301455442609ULL, 3, {44, 52, 0x0}},
-    {15767550864983308635ULL, 2, {47, 55, 0x0}},
-    {1887387029694063607ULL, 1, {36, 52, 0x2}},
-    {3123622654575410142ULL, 1, {14, 5, 0x0}},
-    {15371739946319348890ULL, 1, {37, 53, 0x2}},
-    {17164272640709704176ULL, 1, {9, 2, 0x0}},
-    {17359497498319073023ULL, 1, {49, 58, 0x0}},
-    {767331346974661163ULL, 1, {37, 53, 0x2}},
-    {18337647927603569795ULL, 1, {18, 1, 0x0}},
-    {18298102107923659682ULL, 1, {45, 62, 0x0}},
-    {9921415127188313514ULL, 1, {17, 9, 0x0}},
-    {11658606534804213434ULL, 1, {41, 49, 0x0}},
-    {15728561661017244900ULL, 1, {9, 2, 0x0}},
-    {3872460250455736688ULL, 1, {49, 58, 0x0}},
-    {5578678075345439ULL, 1, {1, 3, 0x40}},
-    {12197272443545392687ULL, 1, {43, 51, 0x0}},
-    {9720808026548882503ULL, 1, {11, 2, 0x0}},
-    {12293079874361818557ULL, 1, {49, 58, 0x0}},
-    {8671698497451685868ULL, 1, {16, 8, 0x0}},
-    {13196157732437213838ULL, 1, {57, 59, 0x40}},
-    {3829185419407060211ULL, 1, {29, 2, 0x0}},
-    {18175628653502220633ULL, 1, {37, 58, 0x0}},
-    {8785894358676112783ULL, 1, {28, 12, 0x2}},
-    {5758437391155520846ULL, 1, {25, 61, 0x0}},
-    {6290376763383841339ULL, 1, {35, 18, 0x0}},
-    {14880471099355547514ULL, 1, {32, 25, 0x0}},
-    {14302680488846858708ULL, 1, {44, 52, 0x0}},
-    {8104688008126202800ULL, 1, {17, 9, 0x0}},
-    {2235228473008902572ULL, 1, {42, 57, 0x0}},
-    {15038002510990451730ULL, 1, {9, 2, 0x0}},
-    {9081828941600717791ULL, 1, {41, 49, 0x0}},
-    {9679474934641636197ULL, 1, {18, 1, 0x0}},
-    {5919202627442975580ULL, 1, {49, 58, 0x0}},
-    {10584405031101718194ULL, 1, {41, 49, 0x0}},
-    {9774111025520886845ULL, 1, {26, 5, 0x0}},
-    {1479126511852834093ULL, 1, {32, 42, 0x0}},
-    {12477087841899135350ULL, 1, {33, 26, 0x0}},
-    {343396118930473076ULL, 1, {40, 48, 0x0}},
-    {17188657718858330447ULL, 1, {23, 15, 0x0}},
-    {2945579612120563166ULL, 1, {41, 49, 0x0}},
-    {7922609371628585423ULL, 1, {21, 6, 0x0}},
-    {4143801226780587254ULL, 1, {49, 58, 0x0}},
-    {1270814368778546479ULL, 1, {29, 2, 0x0}},
-    {5622395453672221776ULL, 1, {45, 62, 0x0}},
-    {11255343805995882354ULL, 1, {18, 1, 0x0}},
-    {14444130625228520336ULL, 1, {43, 51, 0x0}},
-    {8164859315934580725ULL, 2, {46, 60, 0x0}},
-    {13710737241426338357ULL, 1, {1, 3, 0x40}},
-    {8637947276118386178ULL, 1, {28, 37, 0x1}},
-    {13646887350657066253ULL, 1, {33, 5, 0x0}},
-    {10233660860751628317ULL, 1, {42, 57, 0x0}},
-    {1673354095691437116ULL, 1, {30, 58, 0x0}},
-    {16330952840520217609ULL, 1, {12, 5, 0x0}},
-    {9693721429214505670ULL, 1, {12, 30, 0x1}},
-    {11406991152036004517ULL, 4, {23, 15, 0x0}},
-    {1457580596236909813ULL, 2, {43, 51, 0x0}},
-    {3191478979579164346ULL, 1, {31, 15, 0x2}},
-    {3192423015252793924ULL, 1, {42, 57, 0x0}},
-    {6080126204672774078ULL, 1, {21, 6, 0x0}},
-    {1519775354098768818ULL, 1, {47, 55, 0x0}},
-    {14177085116817708326ULL, 1, {18, 1, 0x0}},
-    {670423311901730368ULL, 1, {19, 11, 0x0}},
-    {4759967405207158852ULL, 1, {57, 59, 0x40}},
-    {5787815161418228002ULL, 1, {11, 2, 0x0}},
-    {17473064067654198323ULL, 1, {37, 53, 0x2}},
-    {15988508608179915173ULL, 1, {11, 4, 0x0}},
-    {1846392311451153017ULL, 1, {47, 55, 0x0}},
-    {2448743964428755036ULL, 1, {42, 57, 0x0}},
-    {18335840822313811106ULL, 1, {9, 2, 0x0}},
-    {436761732530329393ULL, 1, {51, 58, 0x0}},
-    {7122886126778725635ULL, 1, {12, 6, 0x0}},
-    {8076872985092206363ULL, 1, {37, 53, 0x2}},
-    {15713763924570285340ULL, 1, {21, 13, 0x0}},
-    {9246059222838258672ULL, 1, {44, 58, 0x0}},
-    {18160083601501715416ULL, 1, {20, 12, 0x0}},
-    {15061851387083764627ULL, 1, {36, 52, 0x2}},
-    {12721892020941828192ULL, 1, {45, 53, 0x0}},
-    {86674974960701987ULL, 1, {14, 5, 0x0}},
-    {12084693089587214679ULL, 1, {42, 57, 0x0}},
-    {3405160855717974887ULL, 1, {20, 12, 0x0}},
-    {2596822485337730129ULL, 1, {25, 61, 0x0}},
-    {693586347909885145ULL, 1, {12, 6, 0x0}},
-    {3892906432818256132ULL, 1, {39, 60, 0x0}},
-    {7587566075325499722ULL, 1, {41, 49, 0x0}},
-    {16411178209763373946ULL, 1, {26, 10, 0x2}},
-    {1202917210903513443ULL, 1, {45, 53, 0x0}},
-    {8093245832175190196ULL, 1, {18, 1, 0x0}},
-    {10009702127990462865ULL, 1, {46, 60, 0x0}},
-    {1866326805214807779ULL, 1, {43, 51, 0x0}},
-    {2855087534667142261ULL, 1, {19, 11, 0x0}},
-    {16333602040182766869ULL, 1, {42, 57, 0x0}},
-    {554085673995016712ULL, 1, {37, 53, 0x2}},
-    {9315794736652164644ULL, 1, {36, 52, 0x2}},
-    {13161278961864926647ULL, 1, {18, 1, 0x0}},
-    {18332224890112414164ULL, 1, {36, 52, 0x2}},
-    {4060009488479054818ULL, 1, {16, 8, 0x0}},
-    {10754466456382117973ULL, 1, {42, 57, 0x0}},
-    {8019627590161824165ULL, 1, {21, 13, 0x0}},
-    {16262840436507318387ULL, 1, {45, 62, 0x0}},
-    {9289050261327178778ULL, 1, {27, 11, 0x2}},
-    {10621945747604513276ULL, 1, {36, 52, 0x2}},
-    {12998258661136259501ULL, 1, {36, 27, 0x1}},
-    {9480824476495029918ULL, 1, {36, 60, 0x1}},
-    {993910358365762845ULL, 1, {19, 11, 0x0}},
-    {15770984337311464306ULL, 1, {51, 58, 0x0}},
-    {16683853709824873093ULL, 1, {22, 14, 0x0}},
-    {12884808331141251385ULL, 1, {57, 59, 0x40}},
-    {5704785486228255402ULL, 1, {37, 53, 0x2}},
-    {8436222137481077260ULL, 1, {36, 29, 0x1}},
-    {7867572196664512934ULL, 1, {36, 43, 0x1}},
-    {2931941168010677267ULL, 1, {34, 61, 0x0}},
-    {15445616416013213257ULL, 1, {1, 3, 0x40}},
-    {17066852164245255537ULL, 1, {43, 51, 0x0}},
-    {17619456107160643504ULL, 1, {20, 12, 0x0}},
-    {18044027928765360793ULL, 1, {51, 58, 0x0}},
-    {10722375475619450329ULL, 3, {36, 52, 0x2}},
-    {8986518298872283255ULL, 3, {36, 29, 0x1}},
-    {16457010074871104837ULL, 3, {36, 42, 0x1}},
-    {14764886521043386317ULL, 2, {44, 52, 0x0}},
-    {11943484803438507948ULL, 2, {21, 6, 0x0}},
-    {3180140306449991979ULL, 1, {41, 49, 0x0}},
-    {1780965510431463977ULL, 1, {17, 9, 0x0}},
-    {10984502004922594587ULL, 1, {49, 58, 0x0}},
-    {2089268798601220172ULL, 1, {9, 2, 0x0}},
-    {16576596393701968532ULL, 1, {42, 57, 0x0}},
-    {125064100473717949ULL, 1, {27, 11, 0x2}},
-    {1508237366667012845ULL, 1, {57, 59, 0x40}},
-    {1684777482253352025ULL, 1, {19, 11, 0x0}},
-    {8581475948901266669ULL, 1, {36, 52, 0x2}},
-    {4083235631829694316ULL, 1, {21, 13, 0x0}},
-    {12493866220134162234ULL, 2, {36, 28, 0x0}},
-    {9324308595813195517ULL, 2, {43, 51, 0x0}},
-    {8598919340171855927ULL, 2, {29, 13, 0x2}},
-    {17926373725211858890ULL, 1, {38, 54, 0x2}},
-    {15123715279150201890ULL, 1, {17, 9, 0x0}},
-    {2723831351951246258ULL, 1, {38, 54, 0x2}},
-    {14326773633869862730ULL, 1, {9, 2, 0x0}},
-    {15986676040456203442ULL, 1, {54, 61, 0x0}},
-    {5615283495990803939ULL, 1, {20, 12, 0x0}},
-    {767699526796321723ULL, 1, {44, 52, 0x0}},
-    {3715327064442691319ULL, 3, {21, 6, 0x0}},
-    {17920414189561426350ULL, 1, {45, 62, 0x0}},
-    {10193931810482912213ULL, 2, {20, 12, 0x0}},
-    {11676484541956161640ULL, 3, {39, 45, 0x0}},
-    {3052467680964930049ULL, 3, {11, 1, 0x0}},
-    {11850187137794325775ULL, 1, {45, 53, 0x0}},
-    {6265808162910730257ULL, 1, {28, 36, 0x0}},
-    {17264791390724112172ULL, 1, {9, 2, 0x0}},
-    {17584810569547362000ULL, 1, {37, 53, 0x2}},
-    {1011635998477884321ULL, 1, {49, 58, 0x0}},
-    {1942747963897999773ULL, 3, {29, 13, 0x2}},
-    {2605231684137122359ULL, 3, {51, 58, 0x0}},
-    {16480701036339587402ULL, 6, {30, 58, 0x0}},
-    {877317167584490694ULL, 1, {23, 15, 0x0}},
-    {1137288163704384321ULL, 1, {12, 30, 0x1}},
-    {1818639558808396037ULL, 1, {12, 4, 0x1}},
-    {11571830999789948611ULL, 1, {44, 52, 0x0}},
-    {12446057105285763466ULL, 1, {34, 61, 0x0}},
-    {811834998317915217ULL, 2, {1, 3, 0x40}},
-    {5783160974389134316ULL, 2, {43, 51, 0x0}},
-    {2185107376395608112ULL, 1, {26, 5, 0x0}},
-    {6185603913973472474ULL, 1, {45, 53, 0x0}},
-    {1935667290507147140ULL, 8, {37, 30, 0x0}},
-    {8005453946857088696ULL, 1, {30, 14, 0x2}},
-    {9473324903699384567ULL, 1, {51, 37, 0x0}},
-    {3222941032202117725ULL, 1, {14, 5, 0x0}},
-    {1809849071310066341ULL, 1, {44, 52, 0x0}},
-    {16480701036339587402ULL, 1, {39, 55, 0x2}},
-    {4354772271343285253ULL, 2, {29, 13, 0x2}},
-    {1879553055204147958ULL, 2, {41, 49, 0x0}},
-    {17428683693293653841ULL, 2, {17, 9, 0x0}},
-    {11048088471440869085ULL, 1, {49, 58, 0x0}},
-    {10328723259939760828ULL, 1, {9, 2, 0x0}},
-    {3945733029276424557ULL, 1, {17, 9, 0x0}},
-    {8999913007383507122ULL, 2, {45, 62, 0x0}},
-    {8523682072765390941ULL, 1, {13, 4, 0x0}},
-    {10835601232652587899ULL, 1, {57, 59, 0x40}},
-    {14722752504102510990ULL, 5, {45, 53, 0x0}},
-    {8216275757307206148ULL, 2, {28, 12, 0x2}},
-    {16904519284079334485ULL, 2, {27, 35, 0x0}},
-    {16881142848612127142ULL, 1, {21, 6, 0x0}},
-    {13702343412383323354ULL, 1, {30, 58, 0x0}},
-    {6947912443990203167ULL, 1, {22, 4, 0x0}},
-    {17053332901298631340ULL, 1, {39, 55, 0x2}},
-    {6468360512672987624ULL, 1, {21, 6, 0x0}},
-    {13742937627030917489ULL, 1, {30, 14, 0x2}},
-    {3055249017335433402ULL, 1, {35, 51, 0x2}},
-    {11303167849764649402ULL, 1, {14, 5, 0x0}},
-    {6747057275959521070ULL, 1, {34, 50, 0x2}},
-    {9807994137399993087ULL, 1, {29, 13, 0x2}},
-    {9694824510618658596ULL, 1, {42, 57, 0x0}},
-    {9501618451516792549ULL, 1, {19, 11, 0x0}},
-    {12234120508765605860ULL, 1, {51, 58, 0x0}},
-    {14517200146087942421ULL, 2, {17, 9, 0x0}},
-    {11717307210545708213ULL, 2, {49, 58, 0x0}},
-    {9927132291674351919ULL, 2, {9, 2, 0x0}},
-    {14302680488846858708ULL, 1, {41, 49, 0x0}},
-    {13959249871945833197ULL, 1, {27, 11, 0x2}},
-    {14276952446407585362ULL, 1, {49, 58, 0x0}},
-    {16200622695021112459ULL, 1, {18, 1, 0x0}},
-    {8741899078597527480ULL, 1, {44, 52, 0x0}},
-    {5623982917117126930ULL, 1, {38, 2, 0x0}},
-    {5525999096397230102ULL, 1, {52, 61, 0x0}},
-    {5916316915344667034ULL, 1, {35, 27, 0x0}},
-    {3790607021754198645ULL, 1, {45, 62, 0x0}},
-    {819755709118438304ULL, 4, {37, 27, 0x0}},
-    {14656071041487488028ULL, 2, {45, 62, 0x0}},
-    {9176897335069304700ULL, 3, {21, 13, 0x0}},
-    {6812211877174529023ULL, 2, {36, 52, 0x2}},
-    {143866687859111499ULL, 1, {28, 12, 0x2}},
-    {13545706527923978710ULL, 1, {28, 37, 0x1}},
-    {637236040279281993ULL, 1, {28, 21, 0x1}},
-    {10545336015550013711ULL, 9, {18, 1, 0x0}},
-    {9200999019149994016ULL, 6, {49, 58, 0x0}},
-    {18060155076760058546ULL, 1, {31, 15, 0x2}},
-    {14186092957451021001ULL, 1, {43, 51, 0x0}},
-    {4498072105937838293ULL, 1, {21, 13, 0x0}},
-    {11474980934160928547ULL, 1, {37, 45, 0x0}},
-    {1985071777532431226ULL, 3, {36, 29, 0x1}},
-    {521486461383523194ULL, 3, {36, 42, 0x1}},
-    {17579846004372916489ULL, 1, {42, 57, 0x0}},
-    {17713395013888759588ULL, 1, {18, 1, 0x0}},
-    {5369404352764686048ULL, 3, {57, 59, 0x40}},
-    {14319812193453475101ULL, 8, {49, 58, 0x0}},
-    {15349273696031743643ULL, 7, {42, 33, 0x1}},
-    {10713961083583451948ULL, 9, {42, 49, 0x1}},
-    {12620683949554638034ULL, 1, {28, 12, 0x2}},
-    {16823396082354798915ULL, 1, {28, 37, 0x1}},
-    {14243878172982361627ULL, 3, {38, 54, 0x2}},
-    {4446765079099501783ULL, 1, {1, 3, 0x40}},
-    {15612465643840114443ULL, 1, {37, 53, 0x2}},
-    {5692981133863823438ULL, 3, {42, 49, 0x1}},
-    {14488793193427279900ULL, 1, {41, 49, 0x0}},
-    {9917315240927512288ULL, 1, {21, 6, 0x0}},
-    {13668961710612854910ULL, 1, {49, 58, 0x0}},
-    {9719244438865608227ULL, 1, {27, 11, 0x2}},
-    {1302123661920026747ULL, 1, {44, 52, 0x0}},
-    {4094399477551906857ULL, 1, {34, 61, 0x0}},
-    {10204072588020062352ULL, 1, {21, 6, 0x0}},
-    {11556959428313550018ULL, 1, {43, 51, 0x0}},
-    {972861641801223415ULL, 1, {18, 1, 0x0}},
-    {1764548940812341223ULL, 1, {52, 62, 0x0}},
-    {3945733029276424557ULL, 4, {28, 12, 0x2}},
-    {13425082481361065513ULL, 4, {21, 36, 0x1}},
-    {11825779621770200243ULL, 3, {51, 58, 0x0}},
-    {12749293669328252047ULL, 2, {43, 51, 0x0}},
-    {11825779621770200243ULL, 2, {37, 27, 0x0}},
-    {4048679037753860083ULL, 3, {28, 12, 0x2}},
-    {17890944822367621545ULL, 3, {42, 57, 0x0}},
-    {9875951870204157246ULL, 2, {18, 1, 0x0}},
-    {7671511946693089235ULL, 1, {30, 58, 0x0}},
-    {768185629385316105ULL, 1, {21, 6, 0x0}},
-    {2642654650734252875ULL, 1, {28, 35, 0x1}},
-    {7362059165797257699ULL, 7, {37, 53, 0x2}},
-    {10498051552615419431ULL, 7, {9, 2, 0x0}},
-    {17027104306962652157ULL, 9, {54, 61, 0x0}},
-    {7127431207949756374ULL, 9, {1, 3, 0x40}},
-    {2686522839171844549ULL, 7, {43, 51, 0x0}},
-    {15080344919695872854ULL, 12, {21, 6, 0x0}},
-    {6372679499705114566ULL, 14, {46, 36, 0x0}},
-    {8862819093315379337ULL, 3, {37, 53, 0x2}},
-    {3842232505176170252ULL, 3, {29, 2, 0x1}},
-    {15646350575703943441ULL, 4, {47, 55, 0x0}},
-    {2060468183472242728ULL, 2, {27, 11, 0x2}},
-    {17113255786594379444ULL, 2, {54, 61, 0x0}},
-    {5615811326698465498ULL, 4, {46, 60, 0x0}},
-    {5635556337638635408ULL, 3, {19, 11, 0x0}},
-    {9527757239209639218ULL, 2, {25, 61, 0x0}},
-    {11643672303704649343ULL, 2, {28, 12, 0x2}},
-    {17532767241507462930ULL, 2, {28, 37, 0x1}},
-    {16618821404328432340ULL, 2, {38, 54, 0x2}},
-    {7244001139114413806ULL, 2, {31, 15, 0x2}},
-    {16583638763008261147ULL, 2, {54, 61, 0x0}},
-    {8166857017631394197ULL, 2, {42, 50, 0x0}},
-    {5323389033445942564ULL, 2, {51, 58, 0x0}},
-    {16972310216973429816ULL, 4, {18, 10, 0x0}},
-    {11162384367497173163ULL, 2, {35, 51, 0x2}},
-    {11241367456505373593ULL, 1, {28, 12, 0x2}},
-    {12389600695227509331ULL, 1, {28, 37, 0x1}},
-    {4744896538331404773ULL, 1, {28, 18, 0x1}},
-    {16770724318775481839ULL, 1, {35, 51, 0x2}},
-    {8785894358676112783ULL, 3, {29, 13, 0x2}},
-    {7791169941863327658ULL, 1, {34, 61, 0x0}},
-    {9844238094151158708ULL, 1, {16, 8, 0x0}},
-    {16845647299295107418ULL, 1, {36, 52, 0x2}},
-    {4873906910109691721ULL, 1, {38, 2, 0x0}},
-    {7559575970307981103ULL, 1, {44, 58, 0x0}},
-    {7620948258158937510ULL, 1, {36, 52, 0x2}},
-    {14711377200923721030ULL, 2, {45, 62, 0x0}},
-    {6937524313354368537ULL, 2, {35, 27, 0x0}},
-    {6807478816869129412ULL, 1, {51, 57, 0x0}},
-    {17997269033105695736ULL, 1, {18, 1, 0x0}},
-    {6975486719385332778ULL, 1, {52, 61, 0x0}},
-    {11091797539611590023ULL, 1, {46, 54, 0x0}},
-    {12675774201144913573ULL, 1, {29, 13, 0x2}},
-    {14015227174649208111ULL, 1, {54, 61, 0x0}},
-    {15567190529177856629ULL, 1, {21, 6, 0x0}},
-    {47267072779911495ULL, 1, {43, 51, 0x0}},
-    {16513153682045033525ULL, 1, {23, 15, 0x0}},
-    {15663093853200682021ULL, 1, {36, 52, 0x2}},
-    {2624576623075250299ULL, 2, {34, 61, 0x0}},
-    {16909523857707907783ULL, 2, {18, 10, 0x0}},
-    {201108877736929591ULL, 2, {43, 51, 0x0}},
-    {16338209616837166699ULL, 1, {25, 9, 0x2}},
-    {10288318382648746910ULL, 1, {41, 34, 0x0}},
-    {11092478349946713888ULL, 8, {12, 6, 0x0}},
-    {17601076987678586237ULL, 4, {57, 59, 0x40}},
-    {6807478816869129412ULL, 1, {52, 61, 0x0}},
-    {63822392791026881ULL, 1, {18, 1, 0x0}},
-    {16806484283425201541ULL, 1, {47, 55, 0x0}},
-    {7413384737443105225ULL, 1, {13, 4, 0x0}},
-    {17744495788526304343ULL, 1, {29, 36, 0x1}},
-    {14500376946479100129ULL, 1, {44, 52, 0x0}},
-    {15265788540523754003ULL, 1, {23, 15, 0x0}},
-    {4279623402023267379ULL, 1, {21, 30, 0x1}},
-    {12545354567470915424ULL, 2, {52, 61, 0x0}},
-    {1816532923153534333ULL, 2, {18, 1, 0x0}},
-    {4819727089999807136ULL, 2, {45, 52, 0x0}},
-    {14967932910556530892ULL, 3, {29, 36, 0x1}},
-    {11100349786942314973ULL, 1, {27, 11, 0x2}},
-    {7526719593406862156ULL, 1, {38, 54, 0x2}},
-    {2609441760426122135ULL, 1, {31, 15, 0x2}},
-    {8772940255083202425ULL, 1, {45, 53, 0x0}},
-    {14967932910556530892ULL, 1, {42, 57, 0x0}},
-    {7774923372170535490ULL, 4, {44, 52, 0x0}},
-    {1776932895691488072ULL, 4, {20, 12, 0x0}},
-    {5180106647844292634ULL, 4, {51, 58, 0x0}},
-    {4231103127187505784ULL, 1, {20, 12, 0x0}},
-    {13205829805726149399ULL, 1, {43, 51, 0x0}},
-    {14859532205576770013ULL, 2, {46, 54, 0x0}},
-    {5857685476532575911ULL, 2, {9, 2, 0x0}},
-    {1153511603875617215ULL, 1, {47, 55, 0x0}},
-    {1314071407186854557ULL, 3, {51, 30, 0x0}},
-    {9209746484468639587ULL, 1, {37, 53, 0x2}},
-    {15888249554963164362ULL, 1, {1, 3, 0x40}},
-    {2686522839171844549ULL, 3, {41, 49, 0x0}},
-    {14938120743895780849ULL, 11, {57, 59, 0x40}},
-    {17192387111477417047ULL, 3, {11, 4, 0x0}},
-    {4552902664739083189ULL, 3, {51, 60, 0x0}},
-    {4708117040037441050ULL, 2, {27, 42, 0x0}},
-    {13623201159966729441ULL, 4, {20, 2, 0x0}},
-    {7444051022280125296ULL, 4, {25, 61, 0x0}},
-    {15665118164579494709ULL, 1, {27, 11, 0x2}},
-    {11870620740482441467ULL, 1, {38, 54, 0x2}},
-    {15482817343018728520ULL, 5, {34, 61, 0x0}},
-    {11707367423980845857ULL, 2, {30, 58, 0x0}},
-    {2577906674093469537ULL, 1, {12, 5, 0x0}},
-    {3962153342190421379ULL, 1, {12, 30, 0x1}},
-    {7322700205443602857ULL, 7, {31, 4, 0x0}},
-    {8372779603301911613ULL, 7, {52, 61, 0x0}},
-    {5596182344359717633ULL, 7, {22, 31, 0x0}},
-    {1633935303523169139ULL, 7, {29, 36, 0x1}},
-    {4446765079099501783ULL, 1, {12, 6, 0x0}},
-    {2055663871327601170ULL, 1, {54, 61, 0x0}},
-    {4090227221675244617ULL, 1, {28, 12, 0x2}},
-    {12111989236528865754ULL, 1, {28, 35, 0x1}},
-    {8377854521578020560ULL, 1, {28, 18, 0x1}},
-    {5236254105324054686ULL, 1, {30, 58, 0x0}},
-    {15577658622448847543ULL, 1, {45, 53, 0x0}},
-    {9751489673746178941ULL, 1, {51, 58, 0x0}},
-    {9751489673746178941ULL, 1, {36, 52, 0x2}},
-    {13555015828291031229ULL, 1, {52, 61, 0x0}},
-    {4714532403036985548ULL, 1, {20, 12, 0x0}},
-    {3619119026038829692ULL, 1, {43, 51, 0x0}},
-    {15278193525252374643ULL, 1, {51, 57, 0x0}},
-    {13568805724748171974ULL, 2, {37, 53, 0x2}},
-    {7137085168647858108ULL, 1, {18, 1, 0x0}},
-    {2507386347591941379ULL, 1, {28, 37, 0x1}},
-    {1935667290507147140ULL, 1, {51, 30, 0x0}},
-    {2468128890256593983ULL, 1, {28, 12, 0x2}},
-    {8797904909323907878ULL, 1, {44, 52, 0x0}},
-    {12688345264380691315ULL, 1, {27, 11, 0x2}},
-    {2444896401675128976ULL, 1, {42, 57, 0x0}},
-    {13920466616400337751ULL, 2, {35, 44, 0x1}},
-    {12762529970314956119ULL, 2, {35, 18, 0x1}},
-    {6404683846195754275ULL, 2, {45, 53, 0x0}},
-    {4708117040037441050ULL, 1, {46, 54, 0x0}},
-    {12937686490474628778ULL, 1, {47, 55, 0x0}},
-    {4090227221675244617ULL, 8, {20, 12, 0x0}},
-    {16614960517351434890ULL, 7, {36, 52, 0x2}},
-    {16522893951470712735ULL, 7, {36, 29, 0x1}},
-    {7955331034860223947ULL, 7, {36, 42, 0x1}},
-    {14162427766673015610ULL, 2, {37, 53, 0x2}},
-    {9088043315682783747ULL, 2, {30, 12, 0x1}},
-    {16993932736707781992ULL, 2, {30, 37, 0x1}},
-    {8525850663299335419ULL, 2, {45, 53, 0x0}},
-    {10762195255169343249ULL, 2, {43, 61, 0x0}},
-    {15601617251738118311ULL, 2, {21, 6, 0x0}},
-    {12772366688609568166ULL, 2, {43, 51, 0x0}},
-    {14084816229754768952ULL, 1, {1, 3, 0x40}},
-    {9088969292631881460ULL, 1, {52, 62, 0x0}},
-    {15315089471151137809ULL, 1, {28, 12, 0x2}},
-    {10377471589249771234ULL, 1, {45, 53, 0x0}},
-    {8021248351717500261ULL, 2, {43, 51, 0x0}},
-    {15178710260014237150ULL, 1, {18, 1, 0x0}},
-    {10458022244611372125ULL, 1, {49, 58, 0x0}},
-    {4429722800411233674ULL, 2, {45, 62, 0x0}},
-    {6218083210109751075ULL, 1, {21, 6, 0x0}},
-    {7714278107617494199ULL, 1, {36, 52, 0x2}},
-    {14919724006323778645ULL, 1, {36, 29, 0x1}},
-    {7256974998989657809ULL, 1, {36, 42, 0x1}},
-    {3836957407128921475ULL, 1, {41, 49, 0x0}},
-    {5449587215307019566ULL, 4, {37, 58, 0x0}},
-    {6402264709200718483ULL, 2, {35, 18, 0x1}},
-    {9766341823793461473ULL, 2, {27, 42, 0x1}},
-    {1372678218068159611ULL, 1, {43, 51, 0x0}},
-    {13623201159966729441ULL, 2, {12, 5, 0x0}},
-    {12900014923416402515ULL, 2, {43, 51, 0x0}},
-    {5932018617549272852ULL, 2, {35, 27, 0x0}},
-    {16256756974938074554ULL, 2, {52, 42, 0x0}},
-    {9185097134366520292ULL, 3, {37, 58, 0x0}},
-    {3546025453032040871ULL, 2, {18, 1, 0x0}},
-    {16208295745117243424ULL, 1, {57, 59, 0x40}},
-    {155198839316167457ULL, 1, {21, 6, 0x0}},
-    {12264857412788177556ULL, 1, {44, 52, 0x0}},
-    {7072668093296210685ULL, 1, {47, 55, 0x0}},
-    {10891714806054268248ULL, 1, {52, 38, 0x1}},
-    {6847221352621119063ULL, 1, {52, 61, 0x1}},
-    {7041538582330705298ULL, 3, {31, 4, 0x0}},
-    {509134656474423740ULL, 1, {28, 12, 0x2}},
-    {12603458824210791445ULL, 1, {28, 37, 0x1}},
-    {8232102181674860673ULL, 2, {45, 53, 0x0}},
-    {166791874754328764ULL, 3, {43, 51, 0x0}},
-    {2941440076483545021ULL, 2, {33, 5, 0x0}},
-    {537191007345579813ULL, 2, {40, 48, 0x0}},
-    {6627323009912906888ULL, 1, {43, 51, 0x0}},
-    {17169962698603568783ULL, 1, {18, 1, 0x0}},
-    {13231317052484295853ULL, 1, {36, 43, 0x1}},
-    {12922136210548972958ULL, 1, {28, 12, 0x2}},
-    {7103059805183135412ULL, 1, {45, 62, 0x0}},
-    {12943328154826809346ULL, 1, {22, 4, 0x0}},
-    {4286387923052900783ULL, 2, {51, 57, 0x0}},
-    {5711333172288066496ULL, 2, {21, 6, 0x0}},
-    {13114443953114063339ULL, 2, {44, 52, 0x0}},
-    {14320542999715734684ULL, 2, {28, 12, 0x2}},
-    {9825375448642822892ULL, 2, {47, 55, 0x0}},
-    {2931941168010677267ULL, 8, {41, 49, 0x0}},
-    {16673458247004759612ULL, 2, {22, 14, 0x0}},
-    {2101411368492197004ULL, 2, {49, 58, 0x0}},
-    {18331364818771772703ULL, 2, {14, 5, 0x0}},
-    {5635356405803296385ULL, 1, {37, 53, 0x2}},
-    {10231223605290625048ULL, 1, {29, 36, 0x1}},
-    {14603809311528544428ULL, 1, {9, 2, 0x0}},
-    {7819307497225029022ULL, 1, {52, 62, 0x0}},
-    {7295887344322134749ULL, 1, {31, 15, 0x2}},
-    {8539174131121951348ULL, 1, {37, 52, 0x0}},
-    {11643672303704649343ULL, 1, {22, 14, 0x0}},
-    {17248235910084058812ULL, 2, {47, 55, 0x0}},
-    {12485647287567712238ULL, 5, {17, 9, 0x0}},
-    {14260802478759173411ULL, 1, {13, 4, 0x0}},
-    {1080883528570852895ULL, 1, {37, 53, 0x2}},
-    {16673458247004759612ULL, 4, {1, 3, 0x40}},
-    {10649162693161033211ULL, 4, {49, 58, 0x0}},
-    {12735707120281114201ULL, 1, {20, 12, 0x0}},
-    {6956120701638180359ULL, 1, {57, 59, 0x40}},
-    {2615527265235199523ULL, 2, {37, 27, 0x0}},
-    {1391607233297579990ULL, 1, {35, 51, 0x2}},
-    {6468360512672987624ULL, 1, {13, 4, 0x0}},
-    {2020357608620491316ULL, 1, {40, 48, 0x0}},
-    {6005901262839606125ULL, 1, {52, 42, 0x0}},
-    {3049815707414631977ULL, 1, {57, 59, 0x40}},
-    {12886379800431348820ULL, 2, {19, 11, 0x0}},
-    {6670996885255422075ULL, 2, {49, 58, 0x0}},
-    {7698083757109628667ULL, 1, {29, 13, 0x2}},
-    {9158195707032856613ULL, 1, {57, 59, 0x40}},
-    {16083454359407930157ULL, 2, {37, 53, 0x2}},
-    {16933381364790634389ULL, 1, {20, 12, 0x0}},
-    {15423599021888432283ULL, 1, {44, 58, 0x0}},
-    {15770984337311464306ULL, 2, {36, 52, 0x2}},
-    {17522253231117604952ULL, 1, {36, 29, 0x1}},
-    {7867572196664512934ULL, 1, {36, 42, 0x1}},
-    {1290824433729555758ULL, 1, {45, 62, 0x0}},
-    {341670719873924792ULL, 1, {18, 1, 0x0}},
-    {18015902995294015927ULL, 1, {34, 50, 0x2}},
-    {12110596459684989700ULL, 1, {17, 9, 0x0}},
-    {14206057971167956005ULL, 1, {42, 57, 0x0}},
-    {8955150090336585874ULL, 1, {9, 2, 0x0}},
-    {2430836147143309764ULL, 1, {30, 58, 0x0}},
-    {6133272759351824604ULL, 2, {45, 62, 0x0}},
-    {8005453946857088696ULL, 5, {18, 1, 0x0}},
-    {13227611174162611594ULL, 5, {45, 53, 0x0}},
-    {11369076158939109680ULL, 5, {21, 36, 0x0}},
-    {15750200314418573419ULL, 5, {44, 52, 0x0}},
-    {4167540962880983898ULL, 1, {29, 13, 0x2}},
-    {7317041130495273375ULL, 1, {37, 53, 0x2}},
-    {8727702117965289336ULL, 2, {43, 51, 0x0}},
-    {11058678876748203933ULL, 2, {20, 2, 0x0}},
-    {4535249283800345235ULL, 1, {46, 54, 0x0}},
-    {9430813952649828547ULL, 1, {1, 3, 0x40}},
-    {16985886788055541155ULL, 1, {54, 61, 0x0}},
-    {13346865458864431589ULL, 2, {11, 2, 0x0}},
-    {909804662710183496ULL, 3, {36, 52, 0x2}},
-    {16329127678136049248ULL, 1, {22, 14, 0x0}},
-    {18041017455324597307ULL, 1, {43, 51, 0x0}},
-    {10857224851901848540ULL, 1, {29, 13, 0x2}},
-    {16011285558988782754ULL, 1, {51, 58, 0x0}},
-    {4633505339883673162ULL, 2, {35, 52, 0x0}},
-    {5492901291724541284ULL, 2, {45, 53, 0x0}},
-    {5687986392577020855ULL, 1, {22, 14, 0x0}},
-    {6574073981316710854ULL, 1, {34, 61, 0x0}},
-    {2501479319975747029ULL, 1, {14, 5, 0x0}},
-    {2614032169125113677ULL, 1, {43, 51, 0x0}},
-    {14202440315533356840ULL, 1, {52, 61, 0x0}},
-    {4274442620135729156ULL, 1, {18, 1, 0x0}},
-    {15128029146107956783ULL, 1, {46, 60, 0x0}},
-    {9795222854442232821ULL, 9, {36, 52, 0x2}},
-    {10822695363883662631ULL, 1, {46, 60, 0x0}},
-    {13627151637631030236ULL, 1, {38, 54, 0x2}},
-    {4516004669506323558ULL, 1, {18, 10, 0x0}},
-    {11691988219905970677ULL, 1, {43, 51, 0x0}},
-    {9657094885283039738ULL, 1, {27, 11, 0x2}},
-    {12000744010546308371ULL, 1, {29, 37, 0x0}},
-    {7600728264160325511ULL, 1, {31, 15, 0x2}},
-    {10814050660054559519ULL, 1, {36, 44, 0x0}},
-    {13991009012707108773ULL, 1, {45, 62, 0x0}},
-    {9135797113855008411ULL, 1, {20, 2, 0x0}},
-    {10043584367905501670ULL, 1, {35, 43, 0x0}},
-    {11208045346968085271ULL, 1, {37, 53, 0x2}},
-    {14478622848732650059ULL, 1, {28, 12, 0x2}},
-    {2128476258471939020ULL, 1, {28, 37, 0x1}},
-    {2698255297296854847ULL, 1, {47, 55, 0x0}},
-    {7701453733410039243ULL, 3, {18, 1, 0x0}},
-    {3530860594165431057ULL, 1, {38, 54, 0x2}},
-    {7817461587773872977ULL, 2, {42, 57, 0x0}},
-    {7894771850653342765ULL, 2, {36, 27, 0x1}},
-    {2874650949772251881ULL, 1, {36, 43, 0x1}},
-    {14210563145996024942ULL, 1, {26, 5, 0x0}},
-    {8600008323576777217ULL, 1, {46, 60, 0x0}},
-    {16884930034854772929ULL, 1, {12, 4, 0x0}},
-    {13559794182747439537ULL, 1, {36, 52, 0x2}},
-    {8607671694041838903ULL, 1, {21, 6, 0x0}},
-    {15624494088192279308ULL, 1, {34, 61, 0x0}},
-    {15047779407645814786ULL, 2, {45, 62, 0x0}},
-    {308631616782599566ULL, 2, {38, 2, 0x0}},
-    {6072106927649988903ULL, 1, {53, 60, 0x0}},
-    {3478068450551787684ULL, 1, {18, 1, 0x0}},
-    {3905738755293390333ULL, 1, {41, 49, 0x0}},
-    {3450329105129692625ULL, 1, {21, 13, 0x0}},
-    {14064386342298776484ULL, 1, {47, 55, 0x0}},
-    {17289911072901296405ULL, 4, {28, 12, 0x2}},
-    {15643342750863056958ULL, 1, {30, 58, 0x0}},
-    {15261733116179973305ULL, 1, {12, 5, 0x0}},
-    {16944499736665105690ULL, 1, {12, 30, 0x1}},
-    {12070266678750962379ULL, 2, {25, 61, 0x0}},
-    {5087855683859097311ULL, 1, {38, 54, 0x2}},
-    {5331602436707500901ULL, 1, {53, 60, 0x0}},
-    {15047779407645814786ULL, 1, {43, 51, 0x0}},
-    {16285019043953964100ULL, 1, {21, 13, 0x0}},
-    {16799733167866954322ULL, 1, {36, 52, 0x2}},
-    {11292850865593852679ULL, 1, {35, 27, 0x0}},
-    {5122532887144286266ULL, 1, {45, 62, 0x0}},
-    {9502821411561653216ULL, 1, {18, 1, 0x0}},
-    {13207345842347313003ULL, 1, {52, 61, 0x0}},
-    {12196434452444976124ULL, 1, {37, 53, 0x2}},
-    {14791773550112962661ULL, 1, {19, 11, 0x0}},
-    {6072106927649988903ULL, 1, {41, 49, 0x0}},
-    {17961973800087387749ULL, 1, {45, 38, 0x1}},
-    {15959923360381684989ULL, 1, {45, 54, 0x1}},
-    {11660841045101695942ULL, 1, {20, 12, 0x0}},
-    {8350007970517678685ULL, 1, {49, 58, 0x0}},
-    {199510913874117899ULL, 1, {21, 30, 0x1}},
-    {4847744698071564754ULL, 7, {41, 49, 0x0}},
-    {15040715628957455570ULL, 4, {17, 9, 0x0}},
-    {14611490457702194744ULL, 6, {49, 58, 0x0}},
-    {8009564582597223271ULL, 6, {9, 2, 0x0}},
-    {11406991152036004517ULL, 1, {6, 7, 0x0}},
-    {14056969851178984767ULL, 1, {46, 54, 0x0}},
-    {7765140717726829122ULL, 1, {37, 53, 0x2}},
-    {7370664071932721704ULL, 1, {37, 28, 0x1}},
-    {14952938834640628275ULL, 1, {42, 57, 0x0}},
-    {12308267893108481527ULL, 1, {20, 12, 0x0}},
-    {6406245643920822379ULL, 1, {46, 54, 0x0}},
-    {13039338775187829568ULL, 1, {17, 9, 0x0}},
-    {17529522759103616866ULL, 1, {54, 61, 0x0}},
-    {8862819093315379337ULL, 1, {47, 55, 0x0}},
-    {13437231237267948002ULL, 1, {31, 15, 0x2}},
-    {873990700500893847ULL, 1, {42, 57, 0x0}},
-    {7504456281895907817ULL, 1, {45, 62, 0x0}},
-    {8449531528916247117ULL, 1, {45, 62, 0x0}},
-    {5122769022160911303ULL, 3, {20, 12, 0x0}},
-    {14588078623545708101ULL, 3, {51, 57, 0x0}},
-    {12438349538819842921ULL, 5, {18, 1, 0x0}},
-    {12645103491281740275ULL, 2, {21, 30, 0x1}},
-    {3658795600901705166ULL, 2, {21, 14, 0x1}},
-    {18245348601198315170ULL, 1, {27, 35, 0x0}},
-    {9200999019149994016ULL, 3, {36, 52, 0x2}},
-    {17875251600247296383ULL, 3, {22, 4, 0x0}},
-    {3207668383195850352ULL, 1, {29, 36, 0x1}},
-    {11457799284235414758ULL, 1, {44, 52, 0x0}},
-    {9897903941306362016ULL, 1, {19, 5, 0x0}},
-    {849562645685318368ULL, 1, {52, 62, 0x0}},
-    {17964464479095685126ULL, 1, {40, 48, 0x0}},
-    {5727393830878028585ULL, 1, {24, 33, 0x0}},
-    {8133951940637651611ULL, 1, {37, 53, 0x2}},
-    {2521888130374636711ULL, 1, {37, 28, 0x1}},
-    {7312236101448126268ULL, 1, {33, 49, 0x2}},
-    {9883326733017715268ULL, 1, {17, 24, 0x0}},
-    {6424785024834049124ULL, 1, {49, 58, 0x0}},
-    {15844361954421418703ULL, 1, {11, 2, 0x0}},
-    {13261686291023139710ULL, 1, {42, 57, 0x0}},
-    {3207668383195850352ULL, 2, {49, 58, 0x0}},
-    {3159960464857606070ULL, 1, {35, 51, 0x2}},
-    {10731432818401490417ULL, 1, {11, 1, 0x0}},
-    {4314706635388950511ULL, 1, {28, 35, 0x1}},
-    {4847744698071564754ULL, 1, {43, 51, 0x0}},
-    {6578064776317023238ULL, 1, {18, 1, 0x0}},
-    {6467794711089059040ULL, 4, {42, 57, 0x0}},
-    {17522253231117604952ULL, 1, {28, 12, 0x2}},
-    {3685726556084646336ULL, 1, {45, 62, 0x0}},
-    {143866687859111499ULL, 1, {19, 11, 0x0}},
-    {12438275813579183154ULL, 1, {42, 57, 0x0}},
-    {15378192192236028293ULL, 1, {28, 12, 0x2}},
-    {11493586022448577874ULL, 1, {43, 51, 0x0}},
-    {12886586689546471142ULL, 2, {12, 6, 0x0}},
-    {12267247003887369147ULL, 1, {44, 58, 0x0}},
-    {16295225101571396706ULL, 3, {12, 6, 0x0}},
-    {3901140644299306052ULL, 3, {40, 48, 0x0}},
-    {15405436995771174056ULL, 3, {24, 33, 0x0}},
-    {10184854780396745662ULL, 2, {36, 52, 0x2}},
-    {13756527652629741053ULL, 2, {19, 11, 0x0}},
-    {2819635267421188540ULL, 2, {37, 53, 0x2}},
-    {11351876726249585025ULL, 1, {18, 1, 0x0}},
-    {12570435042201213075ULL, 2, {41, 49, 0x0}},
-    {5087855683859097311ULL, 1, {25, 61, 0x0}},
-    {10232516574562256036ULL, 1, {41, 49, 0x0}},
-    {11643672303704649343ULL, 8, {3, 2, 0x0}},
-    {820529082993068353ULL, 5, {47, 55, 0x0}},
-    {3993527924178739837ULL, 1, {51, 58, 0x0}},
-    {9164552572524741758ULL, 1, {21, 13, 0x0}},
-    {14365593945777905556ULL, 1, {46, 54, 0x0}},
-    {14987928705636380328ULL, 4, {41, 49, 0x0}},
-    {17415752652186653249ULL, 4, {9, 2, 0x0}},
-    {3398778960058003390ULL, 4, {49, 58, 0x0}},
-    {6993440976739071748ULL, 1, {37, 53, 0x2}},
-    {202657220425937066ULL, 1, {29, 2, 0x1}},
-    {18279750071061608428ULL, 1, {43, 51, 0x0}},
-    {4198917847219920258ULL, 1, {25, 61, 0x0}},
-    {9832935274696900831ULL, 1, {28, 12, 0x2}},
-    {1952249319877166676ULL, 1, {18, 25, 0x1}},
-    {9801740033891154247ULL, 1, {18, 4, 0x1}},
-    {6981070375105943730ULL, 1, {49, 58, 0x0}},
-    {16184777448677083983ULL, 2, {44, 52, 0x0}},
-    {564139187858821347ULL, 2, {16, 8, 0x0}},
-    {5289978294856371695ULL, 2, {57, 59, 0x40}},
-    {15545691668011886600ULL, 2, {44, 58, 0x0}},
-    {2215314339641274837ULL, 1, {13, 4, 0x0}},
-    {5024811510876839359ULL, 1, {34, 50, 0x2}},
-    {4429722800411233674ULL, 5, {37, 53, 0x2}},
-    {15358987855667828897ULL, 5, {36, 28, 0x0}},
-    {14412623096363382726ULL, 1, {49, 58, 0x0}},
-    {6629457970691134813ULL, 1, {27, 11, 0x2}},
-    {7591084111927721275ULL, 1, {44, 52, 0x0}},
-    {259099318501819281ULL, 1, {37, 28, 0x1}},
-    {9700294168424148692ULL, 1, {37, 30, 0x1}},
-    {5987116548675183042ULL, 4, {20, 4, 0x0}},
-    {17752243117616576859ULL, 1, {52, 62, 0x0}},
-    {17002836538408447309ULL, 2, {42, 57, 0x0}},
-    {7041538582330705298ULL, 2, {33, 5, 0x0}},
-    {1229768859905630747ULL, 1, {51, 58, 0x0}},
-    {2735451798568382007ULL, 2, {19, 11, 0x0}},
-    {1539125002671694494ULL, 2, {49, 58, 0x0}},
-    {1789761910054058491ULL, 2, {22, 4, 0x0}},
-    {7796732727079369382ULL, 2, {43, 51, 0x0}},
-    {18099297388613665079ULL, 1, {45, 62, 0x0}},
-    {11701470989052549594ULL, 1, {45, 53, 0x0}},
-    {2655257308568914369ULL, 1, {29, 31, 0x1}},
-    {2451819560297695412ULL, 1, {38, 54, 0x2}},
-    {4951880791549063964ULL, 1, {9, 2, 0x0}},
-    {53917537757537769ULL, 3, {37, 58, 0x0}},
-    {11945800522816719341ULL, 3, {9, 2, 0x0}},
-    {2474217309553964944ULL, 3, {44, 52, 0x0}},
-    {15149516132781732700ULL, 1, {31, 15, 0x2}},
-    {9194957673547791660ULL, 1, {42, 57, 0x0}},
-    {7718477479613596483ULL, 1, {19, 11, 0x0}},
-    {8715216574703264762ULL, 1, {43, 51, 0x0}},
-    {5122769022160911303ULL, 2, {22, 14, 0x0}},
-    {6074180682625210914ULL, 2, {44, 52, 0x0}},
-    {3089809638989619779ULL, 2, {17, 9, 0x0}},
-    {14740734692331923815ULL, 2, {42, 57, 0x0}},
-    {12733805347311715613ULL, 1, {11, 2, 0x0}},
-    {11163913471918363646ULL, 1, {36, 42, 0x1}},
-    {7413384737443105225ULL, 2, {33, 5, 0x0}},
-    {4783214300430684799ULL, 2, {29, 36, 0x1}},
-    {13463484867818734004ULL, 2, {17, 9, 0x0}},
-    {8739327024416649535ULL, 2, {22, 4, 0x0}},
-    {17550743015418581110ULL, 1, {46, 60, 0x0}},
-    {1895010208471084100ULL, 1, {35, 18, 0x0}},
-    {6938430620719785530ULL, 1, {43, 25, 0x0}},
-    {7563903005326255250ULL, 2, {35, 51, 0x2}},
-    {574812388855976327ULL, 2, {18, 1, 0x0}},
-    {15407119587173273516ULL, 2, {27, 35, 0x0}},
-    {2144397341453709056ULL, 2, {12, 18, 0x0}},
-    {2726021575359244728ULL, 2, {51, 60, 0x0}},
-    {15545691668011886600ULL, 1, {52, 62, 0x0}},
-    {9202853169307199911ULL, 1, {18, 1, 0x0}},
-    {13695659470238995115ULL, 1, {34, 50, 0x2}},
-    {14084816229754768952ULL, 1, {29, 13, 0x2}},
-    {18336960009219471989ULL, 1, {45, 53, 0x0}},
-    {15244036935758725705ULL, 5, {1, 3, 0x40}},
-    {13171490845196327797ULL, 2, {52, 62, 0x0}},
-    {7548622393127657459ULL, 1, {22, 14, 0x0}},
-    {15915291554037386368ULL, 1, {51, 57, 0x0}},
-    {7076919194074142085ULL, 1, {1, 3, 0x40}},
-    {17752243117616576859ULL, 3, {29, 36, 0x1}},
-    {11936595188737739218ULL, 1, {37, 53, 0x2}},
-    {5371587003345658093ULL, 1, {23, 15, 0x0}},
-    {17466318604203947744ULL, 1, {12, 30, 0x1}},
-    {8507669343922548223ULL, 1, {12, 4, 0x1}},
-    {15296967767018441446ULL, 1, {28, 37, 0x1}},
-    {8320317449139256874ULL, 2, {29, 13, 0x2}},
-    {13816259637519136184ULL, 2, {43, 51, 0x0}},
-    {18355500386696156565ULL, 3, {57, 59, 0x40}},
-    {8062892291652416076ULL, 1, {41, 49, 0x0}},
-    {15307975612095806053ULL, 4, {49, 58, 0x0}},
-    {14716444764161147399ULL, 4, {27, 11, 0x2}},
-    {3725108069298277479ULL, 3, {44, 52, 0x0}},
-    {10455944315109352881ULL, 1, {44, 52, 0x0}},
-    {14731085233408838516ULL, 1, {21, 13, 0x0}},
-    {4576313070268149647ULL, 1, {42, 57, 0x0}},
-    {5964162417892050927ULL, 1, {45, 53, 0x0}},
-    {17394181685670745588ULL, 1, {13, 4, 0x0}},
-    {8315875334563304725ULL, 1, {42, 57, 0x0}},
-    {214722758561365591ULL, 1, {18, 1, 0x0}},
-    {7410897551518309051ULL, 1, {29, 36, 0x1}},
-    {13421171685228884160ULL, 1, {45, 53, 0x0}},
-    {17168543931555136612ULL, 1, {43, 51, 0x0}},
-    {15947404463563569580ULL, 2, {28, 37, 0x1}},
-    {6102227344327626433ULL, 3, {37, 53, 0x2}},
-    {11839714284731654093ULL, 3, {18, 1, 0x0}},
-    {14786805514034792531ULL, 3, {13, 4, 0x0}},
-    {8123386600714406937ULL, 1, {29, 36, 0x1}},
-    {4408286280941886435ULL, 1, {37, 53, 0x2}},
-    {3601454187398330320ULL, 2, {45, 62, 0x0}},
-    {5698785368986343228ULL, 2, {19, 11, 0x0}},
-    {2471150850997830812ULL, 3, {27, 42, 0x0}},
-    {16726239604249353934ULL, 1, {44, 52, 0x0}},
-    {14824081911839906707ULL, 1, {29, 13, 0x2}},
-    {4897093770206433914ULL, 1, {49, 58, 0x0}},
-    {16481155002993949900ULL, 3, {33, 5, 0x0}},
-    {6192581974320272500ULL, 1, {27, 42, 0x0}},
-    {17114006831059760528ULL, 1, {26, 33, 0x0}},
-    {10904033896098691255ULL, 1, {37, 53, 0x2}},
-    {5614025025071997159ULL, 1, {13, 4, 0x0}},
-    {466280551671976813ULL, 1, {39, 60, 0x0}},
-    {16749991259957636350ULL, 2, {25, 61, 0x0}},
-    {15711147837025501172ULL, 1, {22, 4, 0x0}},
-    {8095543352181798444ULL, 1, {42, 57, 0x0}},
-    {15023077491933563204ULL, 1, {17, 9, 0x0}},
-    {2821315960154176841ULL, 1, {39, 55, 0x2}},
-    {18160167639728243208ULL, 3, {40, 48, 0x0}},
-    {12731542551486537385ULL, 1, {45, 62, 0x0}},
-    {5244029204056220322ULL, 1, {26, 5, 0x0}},
-    {10318945034709608661ULL, 1, {44, 58, 0x0}},
-    {8320317449139256874ULL, 4, {20, 12, 0x0}},
-    {15142351408712457486ULL, 4, {52, 62, 0x0}},
-    {2698255297296854847ULL, 1, {36, 52, 0x2}},
-    {11186767313689477381ULL, 2, {37, 53, 0x2}},
-    {17582251946335691483ULL, 1, {24, 18, 0x0}},
-    {212672941293507424ULL, 1, {30, 58, 0x0}},
-    {14722752504102510990ULL, 2, {44, 52, 0x0}},
-    {13721285481016295266ULL, 2, {9, 2, 0x0}},
-    {9404636877234465253ULL, 1, {34, 50, 0x2}},
-    {14049785757474249596ULL, 1, {28, 12, 0x2}},
-    {1967491790859006191ULL, 1, {51, 58, 0x0}},
-    {6603283347943169322ULL, 1, {21, 6, 0x0}},
-    {2242970086618525753ULL, 1, {42, 57, 0x0}},
-    {12363383796802578879ULL, 5, {29, 13, 0x2}},
-    {9382696552662842693ULL, 4, {43, 51, 0x0}},
-    {13171490845196327797ULL, 3, {42, 57, 0x0}},
-    {16732704055149426172ULL, 4, {37, 53, 0x2}},
-    {5218752503498892073ULL, 3, {17, 9, 0x0}},
-    {8216275757307206148ULL, 3, {18, 1, 0x0}},
-    {7441920338381196569ULL, 3, {27, 35, 0x0}},
-    {18306281971566318449ULL, 3, {28, 18, 0x0}},
-    {7842756084519057494ULL, 3, {36, 52, 0x2}},
-    {4046563620992649633ULL, 2, {36, 29, 0x1}},
-    {7622467227487262731ULL, 2, {36, 60, 0x1}},
-    {9264254154950410274ULL, 1, {37, 53, 0x2}},
-    {13627577292328807427ULL, 1, {41, 49, 0x0}},
-    {4911607234890069264ULL, 3, {13, 4, 0x0}},
-    {17324407511141808068ULL, 5, {18, 1, 0x0}},
-    {12539722680070887462ULL, 4, {36, 52, 0x2}},
-    {427525171907568972ULL, 4, {21, 6, 0x0}},
-    {4104585741168292095ULL, 1, {11, 4, 0x0}},
-    {14674626862903495671ULL, 1, {27, 42, 0x1}},
-    {4078879476029418157ULL, 1, {21, 6, 0x0}},
-    {6618985435219846823ULL, 1, {44, 52, 0x0}},
-    {15643342750863056958ULL, 1, {28, 35, 0x1}},
-    {3000495139708900151ULL, 1, {28, 4, 0x1}},
-    {18308076639110698464ULL, 1, {36, 52, 0x2}},
-    {6803142323179306268ULL, 2, {35, 51, 0x2}},
-    {9150576106636513529ULL, 2, {9, 2, 0x0}},
-    {2603494693372094541ULL, 1, {36, 27, 0x1}},
-    {9587624557819991453ULL, 1, {36, 60, 0x1}},
-    {8005453946857088696ULL, 2, {19, 11, 0x0}},
-    {15874908871024349670ULL, 2, {42, 57, 0x0}},
-    {17559230284135454376ULL, 2, {30, 14, 0x2}},
-    {10023140576107619725ULL, 2, {36, 42, 0x1}},
-    {6192581974320272500ULL, 2, {49, 58, 0x0}},
-    {17453747397223256467ULL, 2, {21, 6, 0x0}},
-    {773111080218470867ULL, 2, {36, 52, 0x2}},
-    {12554786301056136599ULL, 2, {42, 33, 0x1}},
-    {4046563620992649633ULL, 1, {20, 12, 0x0}},
-    {2981303792849781299ULL, 1, {37, 58, 0x0}},
-    {2886669060342436932ULL, 2, {35, 51, 0x2}},
-    {7183206801803576046ULL, 2, {35, 18, 0x1}},
-    {9644546822295064762ULL, 2, {57, 59, 0x40}},
-    {15259961909752990109ULL, 2, {19, 11, 0x0}},
-    {3909303066927482053ULL, 1, {37, 53, 0x2}},
-    {8100970276233269951ULL, 3, {29, 36, 0x1}},
-    {13190822679211346468ULL, 1, {27, 11, 0x2}},
-    {1404346644154420985ULL, 1, {38, 54, 0x2}},
-    {2090097753326651100ULL, 2, {36, 52, 0x2}},
-    {13351582807328510659ULL, 2, {36, 29, 0x1}},
-    {13546686907497677169ULL, 2, {36, 43, 0x1}},
-    {7156292506547854630ULL, 1, {45, 62, 0x0}},
-    {4711707420081324055ULL, 1, {18, 1, 0x0}},
-    {4967810136213311215ULL, 1, {21, 30, 0x1}},
-    {5426689571434376504ULL, 2, {41, 49, 0x0}},
-    {1984178656767705762ULL, 2, {28, 12, 0x2}},
-    {68145160730046556ULL, 2, {49, 58, 0x0}},
-    {6294148628830015451ULL, 2, {16, 8, 0x0}},
-    {10754466456382117973ULL, 2, {27, 36, 0x1}},
-    {7698083757109628667ULL, 1, {11, 2, 0x0}},
-    {3470530584716825425ULL, 1, {57, 59, 0x40}},
-    {15072701915600022178ULL, 1, {1, 3, 0x40}},
-    {14454466804239274161ULL, 1, {44, 52, 0x0}},
-    {13487539935106092573ULL, 1, {36, 52, 0x2}},
-    {18044662772253459635ULL, 1, {12, 6, 0x0}},
-    {4176183661452507587ULL, 1, {51, 58, 0x0}},
-    {7941569667949779403ULL, 2, {45, 62, 0x0}},
-    {16500151240613196743ULL, 1, {29, 2, 0x0}},
-    {14227232172506534851ULL, 1, {42, 57, 0x0}},
-    {11850187137794325775ULL, 1, {51, 58, 0x0}},
-    {699446084867087395ULL, 1, {42, 57, 0x0}},
-    {17073980700669489392ULL, 1, {47, 55, 0x0}},
-    {11227514905063245032ULL, 1, {21, 6, 0x0}},
-    {13107922809615761091ULL, 1, {43, 51, 0x0}},
-    {6265808162910730257ULL, 1, {37, 53, 0x2}},
-    {11358826195486770144ULL, 1, {9, 2, 0x0}},
-    {16646725041303174077ULL, 1, {45, 62, 0x0}},
-    {819755709118438304ULL, 3, {12, 27, 0x1}},
-    {9720808026548882503ULL, 1, {17, 9, 0x0}},
-    {2534106938456727929ULL, 1, {49, 58, 0x0}},
-    {16044267728404670756ULL, 1, {9, 2, 0x0}},
-    {4328155238317176367ULL, 1, {57, 59, 0x40}},
-    {11114685190635804084ULL, 1, {30, 58, 0x0}},
-    {3849912855756839599ULL, 3, {29, 35, 0x0}},
-    {18365496232713548174ULL, 3, {27, 42, 0x1}},
-    {8184068324624961008ULL, 1, {21, 6, 0x0}},
-    {11453271064522487147ULL, 1, {21, 27, 0x1}},
-    {18203145635484479350ULL, 2, {43, 51, 0x0}},
-    {14786805514034792531ULL, 1, {23, 15, 0x0}},
-    {17201815950281226095ULL, 1, {51, 58, 0x0}},
-    {4792450617328695419ULL, 2, {36, 52, 0x2}},
-    {16808350629236749438ULL, 2, {28, 12, 0x2}},
-    {17193384353076523928ULL, 2, {45, 53, 0x0}},
-    {14210434252865569227ULL, 1, {41, 49, 0x0}},
-    {14890203626925552659ULL, 1, {42, 57, 0x0}},
-    {4727359872299454180ULL, 1, {28, 12, 0x2}},
-    {10614126628105346882ULL, 1, {28, 35, 0x1}},
-    {9129486555749733290ULL, 1, {18, 1, 0x0}},
-    {7767519942067016878ULL, 1, {30, 58, 0x0}},
-    {11914946870939471890ULL, 1, {12, 6, 0x0}},
-    {11243961568369571377ULL, 1, {42, 57, 0x0}},
-    {8166857017631394197ULL, 1, {40, 48, 0x0}},
-    {12680507026624180129ULL, 1, {36, 52, 0x2}},
-    {53917537757537769ULL, 3, {41, 49, 0x0}},
-    {3669750180153683402ULL, 2, {28, 12, 0x2}},
-    {8598123353510567253ULL, 2, {28, 35, 0x1}},
-    {4387294570606605392ULL, 1, {45, 62, 0x0}},
-    {18390433579275433556ULL, 1, {18, 1, 0x0}},
-    {16045615938218708456ULL, 1, {42, 57, 0x0}},
-    {1866326805214807779ULL, 1, {25, 61, 0x0}},
-    {6546839134721197283ULL, 1, {18, 10, 0x0}},
-    {9735288537322512972ULL, 1, {32, 25, 0x0}},
-    {2609093418223395632ULL, 1, {19, 11, 0x0}},
-    {8695987143359022308ULL, 1, {43, 51, 0x0}},
-    {14280312632572258542ULL, 1, {29, 13, 0x2}},
-    {2555131039920091715ULL, 1, {30, 58, 0x0}},
-    {16107828652757440362ULL, 1, {25, 9, 0x2}},
-    {206250348325931428ULL, 1, {40, 48, 0x0}},
-    {7294330812527679871ULL, 1, {16, 8, 0x0}},
-    {6546020266075728290ULL, 1, {35, 51, 0x2}},
-    {7413384737443105225ULL, 1, {16, 8, 0x0}},
-    {6636041302095576053ULL, 1, {43, 51, 0x0}},
-    {11986922613219215399ULL, 1, {11, 2, 0x0}},
-    {8211746768166564920ULL, 1, {42, 57, 0x0}},
-    {9829105923230151897ULL, 1, {26, 5, 0x0}},
-    {10836537231942177106ULL, 1, {30, 58, 0x0}},
-    {242764707041178255ULL, 1, {12, 18, 0x0}},
-    {4001955623819783701ULL, 1, {54, 61, 0x0}},
-    {13241423753991783522ULL, 1, {21, 6, 0x0}},
-    {16856978025533890793ULL, 1, {36, 52, 0x2}},
-    {4792450617328695419ULL, 3, {37, 53, 0x2}},
-    {711334360217230126ULL, 2, {21, 6, 0x0}},
-    {13362506628755188942ULL, 1, {42, 57, 0x0}},
-    {5509679116796244041ULL, 1, {21, 6, 0x0}},
-    {2510191260843429170ULL, 1, {45, 62, 0x0}},
-    {11936595188737739218ULL, 1, {46, 54, 0x0}},
-    {11040825155321494194ULL, 1, {23, 15, 0x0}},
-    {4861210416005788464ULL, 1, {12, 30, 0x1}},
-    {7568413501429773022ULL, 1, {12, 4, 0x1}},
-    {16591432098644532373ULL, 1, {54, 61, 0x0}},
-    {7579535807716578346ULL, 3, {37, 53, 0x2}},
-    {18059960452840564990ULL, 3, {36, 28, 0x0}},
-    {16395124007663035585ULL, 3, {57, 59, 0x40}},
-    {18397927602723351586ULL, 1, {57, 59, 0x40}},
-    {14162427766673015610ULL, 7, {12, 30, 0x1}},
-    {2821965866017399831ULL, 6, {12, 4, 0x1}},
-    {5369404352764686048ULL, 4, {36, 52, 0x2}},
-    {17926373725211858890ULL, 1, {36, 43, 0x1}},
-    {16900398627141144394ULL, 1, {30, 58, 0x0}},
-    {4711707420081324055ULL, 1, {36, 21, 0x0}},
-    {17768034571497458371ULL, 1, {37, 30, 0x0}},
-    {17905593382394388158ULL, 1, {43, 51, 0x0}},
-    {11049801842578934555ULL, 1, {29, 2, 0x1}},
-    {10497149760021827218ULL, 1, {37, 53, 0x2}},
-    {6201738590751326802ULL, 1, {18, 1, 0x0}},
-    {5370531455934950085ULL, 1, {57, 59, 0x40}},
-    {18187600551419456123ULL, 1, {28, 12, 0x2}},
-    {12799461543579361333ULL, 1, {28, 37, 0x1}},
-    {16286724957976613671ULL, 1, {44, 52, 0x0}},
-    {14329179100915416275ULL, 1, {28, 12, 0x2}},
-    {14793260641901885565ULL, 1, {52, 61, 0x0}},
-    {1017817944632322248ULL, 1, {11, 4, 0x0}},
-    {14455816853459088796ULL, 1, {45, 62, 0x0}},
-    {802071582117813795ULL, 1, {21, 13, 0x0}},
-    {7386420557329443177ULL, 1, {51, 57, 0x0}},
-    {5831039527322408896ULL, 1, {23, 6, 0x0}},
-    {2434597154343364861ULL, 1, {41, 49, 0x0}},
-    {840766407050404543ULL, 2, {35, 51, 0x2}},
-    {739253139473529713ULL, 2, {1, 3, 0x40}},
-    {12306994257515563500ULL, 1, {51, 57, 0x0}},
-    {11496813271285785452ULL, 1, {30, 14, 0x2}},
-    {12427063384443928683ULL, 1, {30, 37, 0x1}},
-    {3993527924178739837ULL, 1, {46, 60, 0x0}},
-    {4901927997645995292ULL, 1, {12, 6, 0x0}},
-    {5292154392513827219ULL, 1, {14, 46, 0x1}},
-    {8609301101699196205ULL, 2, {20, 12, 0x0}},
-    {3232801727254877021ULL, 2, {57, 59, 0x40}},
-    {7739810275036596223ULL, 1, {37, 53, 0x2}},
-    {8333270298575903634ULL, 1, {36, 28, 0x0}},
-    {10479348692070160747ULL, 1, {47, 61, 0x0}},
-    {17062104511720056560ULL, 2, {18, 1, 0x0}},
-    {7352815876482950210ULL, 1, {36, 52, 0x2}},
-    {5712043622602678329ULL, 4, {17, 9, 0x0}},
-    {15138223181120691840ULL, 3, {37, 58, 0x0}},
-    {17532501624377146179ULL, 3, {9, 2, 0x0}},
-    {11382597043359337162ULL, 1, {44, 52, 0x0}},
-    {8942395853409105120ULL, 1, {11, 1, 0x0}},
-    {3999600875195341211ULL, 1, {45, 62, 0x0}},
-    {16614960517351434890ULL, 1, {30, 58, 0x0}},
-    {12875237071653807172ULL, 1, {12, 5, 0x0}},
-    {10342471815169613874ULL, 1, {57, 59, 0x40}},
-    {11643672303704649343ULL, 2, {21, 6, 0x0}},
-    {10452654442985766426ULL, 2, {28, 45, 0x0}},
-    {17975516294966124570ULL, 1, {38, 2, 0x0}},
-    {17919444226408373708ULL, 1, {52, 61, 0x0}},
-    {12131354356191708030ULL, 1, {52, 38, 0x1}},
-    {18376748313569109242ULL, 1, {52, 60, 0x1}},
-    {990476394463937226ULL, 3, {42, 27, 0x0}},
-    {13463484867818734004ULL, 2, {28, 12, 0x2}},
-    {1764038960203411898ULL, 4, {42, 57, 0x0}},
-    {5587286139241334396ULL, 2, {41, 49, 0x0}},
-    {11455586873980940439ULL, 2, {26, 5, 0x0}},
-    {5162207186020208122ULL, 1, {29, 36, 0x1}},
-    {15922057144552798951ULL, 1, {36, 52, 0x2}},
-    {4574647628600670448ULL, 1, {36, 29, 0x1}},
-    {10374223023285144212ULL, 1, {36, 42, 0x1}},
-    {17345594780179071437ULL, 1, {9, 2, 0x0}},
-    {16519212885434601516ULL, 1, {49, 58, 0x0}},
-    {1606170700876046612ULL, 2, {44, 52, 0x0}},
-    {10638464564107361517ULL, 2, {44, 52, 0x0}},
-    {15075727771507211283ULL, 3, {41, 49, 0x0}},
-    {12645103491281740275ULL, 1, {51, 60, 0x0}},
-    {8434461227566091606ULL, 1, {9, 2, 0x0}},
-    {6604644068367150783ULL, 1, {57, 59, 0x40}},
-    {6681590582076721110ULL, 1, {12, 6, 0x0}},
-    {2915940882319717712ULL, 1, {37, 53, 0x2}},
-    {2843498529103349471ULL, 1, {43, 51, 0x0}},
-    {8883769607788037463ULL, 5, {36, 29, 0x1}},
-    {11958206501807302525ULL, 5, {36, 43, 0x1}},
-    {10184854780396745662ULL, 1, {37, 53, 0x2}},
-    {14408029037575055675ULL, 1, {27, 11, 0x2}},
-    {14187747429258027876ULL, 1, {36, 52, 0x2}},
-    {18245348601198315170ULL, 1, {44, 52, 0x0}},
-    {14162427766673015610ULL, 4, {39, 55, 0x2}},
-    {758624053701697952ULL, 2, {17, 9, 0x0}},
-    {584327104234301567ULL, 2, {44, 52, 0x0}},
-    {16584525557971222757ULL, 1, {24, 8, 0x2}},
-    {5525225392706140401ULL, 1, {49, 58, 0x0}},
-    {290539675022121757ULL, 1, {37, 58, 0x0}},
-    {1293254040617411021ULL, 1, {21, 6, 0x0}},
-    {2778451757734466873ULL, 2, {19, 11, 0x0}},
-    {3825571137250716563ULL, 1, {51, 57, 0x0}},
-    {14731993640651044091ULL, 1, {21, 36, 0x1}},
-    {9976119709407693894ULL, 1, {21, 14, 0x1}},
-    {813285245338786574ULL, 1, {41, 49, 0x0}},
-    {9735890692923938283ULL, 1, {36, 29, 0x1}},
-    {1464030157970685512ULL, 1, {42, 57, 0x0}},
-    {18414656148149789377ULL, 1, {44, 52, 0x0}},
-    {14260802478759173411ULL, 1, {19, 11, 0x0}},
-    {9299172483417347992ULL, 1, {36, 52, 0x2}},
-    {4633505339883673162ULL, 2, {43, 51, 0x0}},
-    {5687986392577020855ULL, 5, {28, 12, 0x2}},
-    {13992833005984236944ULL, 1, {34, 61, 0x0}},
-    {11208045346968085271ULL, 2, {52, 62, 0x0}},
-    {672891751845276267ULL, 2, {33, 5, 0x0}},
-    {15324289494485267632ULL, 2, {40, 48, 0x0}},
-    {13992833005984236944ULL, 4, {41, 49, 0x0}},
-    {9169622694104440521ULL, 1, {19, 11, 0x0}},
-    {8979267306839430703ULL, 1, {41, 49, 0x0}},
-    {7279959152793347955ULL, 1, {30, 14, 0x2}},
-    {12204361320252047181ULL, 1, {49, 58, 0x0}},
-    {11152061674626706547ULL, 1, {14, 5, 0x0}},
-    {16982306989595514134ULL, 1, {57, 59, 0x40}},
-    {433035109902440422ULL, 1, {29, 13, 0x2}},
-    {12584692931864256748ULL, 1, {46, 54, 0x0}},
-    {17812778394119697675ULL, 3, {51, 30, 0x0}},
-    {5157917732044078804ULL, 1, {41, 49, 0x0}},
-    {8236939912664644615ULL, 2, {9, 2, 0x0}},
-    {2469568715001403338ULL, 1, {35, 51, 0x2}},
-    {11092478349946713888ULL, 2, {31, 38, 0x0}},
-    {14266629522074821188ULL, 2, {57, 59, 0x40}},
-    {9521019390151379158ULL, 1, {18, 1, 0x0}},
-    {16996868660896590625ULL, 1, {29, 13, 0x2}},
-    {12485647287567712238ULL, 1, {22, 14, 0x0}},
-    {7373591883240179323ULL, 1, {42, 57, 0x0}},
-    {8394596984044258473ULL, 1, {14, 5, 0x0}},
-    {3032696441221770135ULL, 2, {51, 58, 0x0}},
-    {18073753960391981282ULL, 2, {19, 11, 0x0}},
-    {16481155002993949900ULL, 1, {24, 8, 0x2}},
-    {10225626838490766239ULL, 1, {37, 53, 0x2}},
-    {3984718688700613905ULL, 1, {36, 28, 0x0}},
-    {6014377655940361266ULL, 1, {38, 54, 0x2}},
-    {12225956461543463555ULL, 1, {38, 29, 0x1}},
-    {8021418103065545088ULL, 1, {47, 55, 0x0}},
-    {568641686053123874ULL, 1, {18, 1, 0x0}},
-    {11994650053958886480ULL, 1, {54, 61, 0x0}},
-    {14566983678749965803ULL, 1, {21, 6, 0x0}},
-    {2716975092955484280ULL, 1, {42, 57, 0x0}},
-    {18346640659412894586ULL, 1, {41, 49, 0x0}},
-    {3729409966781515091ULL, 9, {36, 29, 0x1}},
-    {15862321915084623075ULL, 9, {36, 42, 0x1}},
-    {8154509512163913275ULL, 2, {34, 61, 0x0}},
-    {18168730839155399966ULL, 2, {24, 18, 0x0}},
-    {3372033292794834983ULL, 2, {27, 34, 0x0}},
-    {13021272002029992699ULL, 1, {17, 9, 0x0}},
-    {16573562331880924586ULL, 1, {54, 61, 0x0}},
-    {11290673698745817799ULL, 2, {29, 13, 0x2}},
-    {6344071928342153599ULL, 1, {41, 49, 0x0}},
-    {12043293377401620766ULL, 1, {9, 2, 0x0}},
-    {13072482658505775128ULL, 1, {49, 58, 0x0}},
-    {14786805514034792531ULL, 1, {17, 9, 0x0}},
-    {3789798150508062379ULL, 1, {29, 36, 0x1}},
-    {2486675102585868444ULL, 1, {25, 9, 0x2}},
-    {3934101886758141875ULL, 1, {41, 49, 0x0}},
-    {18207383455912074416ULL, 4, {35, 51, 0x2}},
-    {11728233796398091329ULL, 4, {20, 12, 0x0}},
-    {1060592068099110234ULL, 3, {51, 57, 0x0}},
-    {559962089334016956ULL, 1, {47, 55, 0x0}},
-    {17601076987678586237ULL, 2, {44, 52, 0x0}},
-    {11154749178147782672ULL, 1, {34, 50, 0x2}},
-    {14243361845091838596ULL, 1, {28, 12, 0x2}},
-    {15902460390516786766ULL, 1, {27, 35, 0x0}},
-    {8938242349718636745ULL, 1, {37, 28, 0x1}},
-    {6368504814669820655ULL, 1, {45, 62, 0x0}},
-    {4180977352180739552ULL, 1, {38, 2, 0x0}},
-    {663771812892833879ULL, 1, {39, 60, 0x0}},
-    {711334360217230126ULL, 2, {28, 12, 0x2}},
-    {548173204504080986ULL, 1, {44, 52, 0x0}},
-    {13329902959846751766ULL, 2, {28, 12, 0x2}},
-    {4301917681705343796ULL, 2, {28, 37, 0x1}},
-    {11443851342001301099ULL, 2, {28, 19, 0x1}},
-    {1249779290147709267ULL, 2, {36, 52, 0x2}},
-    {5839849230185073442ULL, 1, {47, 55, 0x0}},
-    {17239054035929852610ULL, 1, {21, 6, 0x0}},
-    {13024257541838101782ULL, 1, {36, 52, 0x2}},
-    {11162384367497173163ULL, 2, {45, 62, 0x0}},
-    {14517200146087942421ULL, 1, {18, 1, 0x0}},
-    {11046124094087346556ULL, 2, {49, 58, 0x0}},
-    {13214640265658506661ULL, 2, {9, 2, 0x0}},
-    {1290824433729555758ULL, 2, {30, 58, 0x0}},
-    {11398825799978844088ULL, 2, {12, 6, 0x0}},
-    {9066330801809682239ULL, 2, {42, 57, 0x0}},
-    {9749055384458238857ULL, 2, {18, 1, 0x0}},
-    {11198330765029071558ULL, 1, {45, 62, 0x0}},
-    {18103518584862621543ULL, 1, {23, 15, 0x0}},
-    {5599443551454995430ULL, 1, {12, 30, 0x1}},
-    {5218752503498892073ULL, 1, {28, 12, 0x2}},
-    {13285007707746111701ULL, 1, {28, 37, 0x1}},
-    {3809750140016277467ULL, 1, {28, 4, 0x1}},
-    {679454699280679223ULL, 1, {42, 57, 0x0}},
-    {17932976855607244440ULL, 1, {26, 5, 0x0}},
-    {3977079200898697116ULL, 1, {45, 62, 0x0}},
-    {5579608121418440609ULL, 2, {41, 49, 0x0}},
-    {8703729809094209328ULL, 2, {9, 2, 0x0}},
-    {18139304532532527960ULL, 2, {45, 62, 0x0}},
-    {1177254642481836431ULL, 4, {30, 58, 0x0}},
-    {18302230291970547665ULL, 4, {21, 13, 0x0}},
-    {11950197826840997483ULL, 1, {51, 30, 0x0}},
-    {15206908358190368903ULL, 1, {37, 53, 0x2}},
-    {17073980700669489392ULL, 1, {36, 52, 0x2}},
-    {14357036702557591110ULL, 1, {36, 29, 0x1}},
-    {2482511705328299730ULL, 1, {36, 42, 0x1}},
-    {10592231325407589072ULL, 1, {57, 59, 0x40}},
-    {7774923372170535490ULL, 1, {41, 49, 0x0}},
-    {2623649743808520574ULL, 1, {24, 8, 0x2}},
-    {5559161046533035105ULL, 1, {40, 48, 0x0}},
-    {15670840758972587419ULL, 3, {28, 12, 0x2}},
-    {14207478506096487175ULL, 3, {30, 58, 0x0}},
-    {6102227344327626433ULL, 4, {30, 58, 0x0}},
-    {9391237068903057342ULL, 1, {17, 9, 0x0}},
-    {17668875459543967371ULL, 1, {42, 57, 0x0}},
-    {10654846987309365678ULL, 1, {9, 2, 0x0}},
-    {11328722041305251250ULL, 1, {57, 59, 0x40}},
-    {10976933457086256145ULL, 1, {18, 1, 0x0}},
-    {3787414086296480871ULL, 2, {36, 52, 0x2}},
-    {2941440076483545021ULL, 1, {17, 9, 0x0}},
-    {4319664030038642813ULL, 1, {29, 36, 0x1}},
-    {15541371297749655392ULL, 2, {29, 36, 0x1}},
-    {17289678316442885910ULL, 3, {37, 53, 0x2}},
-    {12223089041103792337ULL, 3, {36, 29, 0x1}},
-    {6458685675640504093ULL, 3, {36, 43, 0x1}},
-    {10258500671986593961ULL, 3, {17, 9, 0x0}},
-    {17089400723149794624ULL, 3, {45, 62, 0x0}},
-    {14102430483509011100ULL, 2, {29, 13, 0x2}},
-    {5739880578589168217ULL, 1, {57, 59, 0x40}},
-    {839368920358445451ULL, 1, {44, 52, 0x0}},
-    {767331346974661163ULL, 1, {42, 57, 0x0}},
-    {12622074763127431305ULL, 1, {18, 1, 0x0}},
-    {8830033881731483825ULL, 1, {46, 54, 0x0}},
-    {4131005834233970656ULL, 1, {22, 14, 0x0}},
-    {3396989240179752730ULL, 1, {54, 61, 0x0}},
-    {2314509911413071994ULL, 1, {19, 11, 0x0}},
-    {7958217533394501356ULL, 1, {41, 49, 0x0}},
-    {12552182001497412720ULL, 1, {14, 5, 0x0}},
-    {14089911426425302487ULL, 1, {49, 58, 0x0}},
-    {12284294287851770482ULL, 1, {52, 62, 0x0}},
-    {21474796097054202ULL, 1, {9, 2, 0x0}},
-    {3591855864418749080ULL, 1, {35, 51, 0x2}},
-    {11899282609017625835ULL, 1, {29, 13, 0x2}},
-    {14096955807076477037ULL, 1, {45, 53, 0x0}},
-    {3849912855756839599ULL, 3, {20, 35, 0x0}},
-    {12350287733633185617ULL, 3, {27, 42, 0x1}},
-    {13611430546585529523ULL, 3, {11, 4, 0x0}},
-    {6217809644610768984ULL, 3, {51, 60, 0x0}},
-    {15711147837025501172ULL, 1, {35, 18, 0x0}},
-    {4533356541811807111ULL, 1, {34, 25, 0x0}},
-    {10684235014474824364ULL, 1, {19, 11, 0x0}},
-    {9908538507690039063ULL, 1, {42, 57, 0x0}},
-    {15212621752507211582ULL, 2, {39, 55, 0x2}},
-    {15685543904367789952ULL, 2, {9, 2, 0x0}},
-    {5469165179342862445ULL, 2, {57, 59, 0x40}},
-    {1663832166159008451ULL, 2, {51, 58, 0x0}},
-    {3783178458094503621ULL, 2, {35, 27, 0x0}},
-    {11257056199598656161ULL, 2, {52, 42, 0x0}},
-    {2300889168127978200ULL, 1, {37, 53, 0x2}},
-    {15187880888391144940ULL, 3, {43, 51, 0x0}},
-    {4253526023204947980ULL, 3, {28, 12, 0x2}},
-    {781102422257846983ULL, 3, {28, 37, 0x1}},
-    {1177254642481836431ULL, 2, {42, 60, 0x0}},
-    {3036975654517428387ULL, 1, {22, 28, 0x0}},
-    {17151539045224789561ULL, 1, {41, 42, 0x0}},
-    {4090227221675244617ULL, 1, {27, 11, 0x2}},
-    {10480159902483854827ULL, 1, {30, 58, 0x0}},
-    {9152727282693182896ULL, 1, {20, 12, 0x0}},
-    {1322071795194128839ULL, 1, {44, 52, 0x0}},
-    {16737318500190807828ULL, 2, {33, 5, 0x0}},
-    {3002712427760557864ULL, 4, {51, 58, 0x0}},
-    {7759131694337121259ULL, 4, {19, 11, 0x0}},
-    {11667763873535526343ULL, 4, {40, 48, 0x0}},
-    {10293064112923318870ULL, 1, {36, 52, 0x2}},
-    {2643863403419545525ULL, 1, {9, 2, 0x0}},
-    {14811415758766476692ULL, 1, {42, 57, 0x0}},
-    {10528359510154954085ULL, 1, {28, 12, 0x2}},
-    {11940548257196313737ULL, 1, {52, 62, 0x0}},
-    {4369314115388502255ULL, 1, {36, 52, 0x2}},
-    {8181684569528728319ULL, 1, {18, 1, 0x0}},
-    {6133301595152107456ULL, 1, {11, 2, 0x0}},
-    {13116871659083913215ULL, 1, {57, 59, 0x40}},
-    {15157621670680083199ULL, 1, {27, 42, 0x0}},
-    {14633532450326116898ULL, 1, {22, 14, 0x0}},
-    {758624053701697952ULL, 1, {19, 11, 0x0}},
-    {3803254029935360307ULL, 1, {57, 59, 0x40}},
-    {8001711469908866168ULL, 1, {21, 6, 0x0}},
-    {11584655146564398707ULL, 1, {42, 57, 0x0}},
-    {1934715361502469078ULL, 1, {33, 5, 0x0}},
-    {1859323239144565687ULL, 1, {36, 52, 0x2}},
-    {17069874145698822359ULL, 1, {19, 11, 0x0}},
-    {9375886585275440852ULL, 1, {43, 51, 0x0}},
-    {13499872913583089425ULL, 1, {18, 1, 0x0}},
-    {4069006794225931185ULL, 1, {47, 55, 0x0}},
-    {14162427766673015610ULL, 1, {51, 30, 0x0}},
-    {4158898834383795682ULL, 1, {21, 6, 0x0}},
-    {5955233734146678549ULL, 1, {57, 59, 0x40}},
-    {7413384737443105225ULL, 2, {35, 18, 0x0}},
-    {3966753425611997272ULL, 1, {43, 51, 0x0}},
-    {11950197826840997483ULL, 3, {37, 30, 0x0}},
-    {4475667876256774178ULL, 2, {46, 60, 0x0}},
-    {3966753425611997272ULL, 1, {52, 62, 0x0}},
-    {2215314339641274837ULL, 1, {20, 2, 0x0}},
-    {1639643763898134869ULL, 1, {34, 50, 0x2}},
-    {7645748197340408214ULL, 1, {57, 59, 0x40}},
-    {7972564308217985773ULL, 1, {23, 15, 0x0}},
-    {11315272744901924059ULL, 1, {21, 30, 0x1}},
-    {17190097366240346434ULL, 1, {18, 1, 0x0}},
-    {10988119111600370586ULL, 1, {29, 36, 0x1}},
-    {13753117743094411742ULL, 2, {54, 47, 0x0}},
-    {15208067252259670207ULL, 1, {37, 53, 0x2}},
-    {6047595481661420425ULL, 1, {21, 13, 0x0}},
-    {17162645171949097006ULL, 1, {36, 52, 0x2}},
-    {2879564391707395409ULL, 1, {37, 53, 0x2}},
-    {9875951870204157246ULL, 1, {35, 28, 0x1}},
-    {6620451861452260368ULL, 1, {27, 42, 0x1}},
-    {13277373605911382122ULL, 1, {20, 2, 0x0}},
-    {16014969072354304645ULL, 1, {30, 58, 0x0}},
-    {12119748102978060678ULL, 1, {34, 61, 0x0}},
-    {3771628709515878253ULL, 1, {18, 1, 0x0}},
-    {6887177516621924522ULL, 3, {21, 13, 0x0}},
-    {9965038357994096050ULL, 3, {47, 55, 0x0}},
-    {16000773324480086114ULL, 3, {31, 38, 0x0}},
-    {460840698937291885ULL, 2, {44, 52, 0x0}},
-    {2893989887187591113ULL, 2, {31, 21, 0x0}},
-    {5345365394122846388ULL, 1, {35, 51, 0x2}},
-    {11569242016875752350ULL, 1, {40, 57, 0x0}},
-    {14731085233408838516ULL, 1, {29, 2, 0x0}},
-    {633778458766771913ULL, 1, {42, 57, 0x0}},
-    {7709745360062743187ULL, 1, {28, 12, 0x2}},
-    {2368873847492442997ULL, 1, {34, 61, 0x0}},
-    {15187880888391144940ULL, 1, {44, 52, 0x0}},
-    {14594296190564348847ULL, 1, {28, 12, 0x2}},
-    {14485013861825370416ULL, 1, {28, 37, 0x1}},
-    {4667574601816522117ULL, 2, {9, 2, 0x0}},
-    {3464089669568491538ULL, 1, {47, 55, 0x0}},
-    {18321024871398562447ULL, 1, {13, 4, 0x0}},
-    {16972105036193221050ULL, 1, {44, 58, 0x0}},
-    {11963779754448401402ULL, 1, {37, 53, 0x2}},
-    {5354207182214651668ULL, 1, {9, 2, 0x0}},
-    {6847000796457805277ULL, 2, {28, 37, 0x1}},
-    {3243627631654595273ULL, 2, {1, 3, 0x40}},
-    {1548708506675262952ULL, 1, {36, 52, 0x2}},
-    {14418722352261270110ULL, 1, {31, 15, 0x2}},
-    {9688422267938086863ULL, 1, {49, 58, 0x0}},
-    {914827623818171818ULL, 1, {45, 62, 0x0}},
-    {8518872762186084081ULL, 1, {29, 13, 0x2}},
-    {18387899818803381272ULL, 1, {41, 49, 0x0}},
-    {9565771135229060886ULL, 2, {21, 6, 0x0}},
-    {1457580596236909813ULL, 2, {44, 52, 0x0}},
-    {3191478979579164346ULL, 1, {29, 13, 0x2}},
-    {6218408705886042665ULL, 1, {42, 57, 0x0}},
-    {15059146169660328994ULL, 1, {21, 6, 0x0}},
-    {9000577122106676244ULL, 1, {41, 49, 0x0}},
-    {12841414637895120097ULL, 1, {52, 62, 0x0}},
-    {16861246218397967427ULL, 2, {43, 51, 0x0}},
-    {15729614969344158977ULL, 2, {19, 11, 0x0}},
-    {12872666619662034762ULL, 1, {36, 52, 0x2}},
-    {15849436527270876256ULL, 1, {9, 2, 0x0}},
-    {10231223605290625048ULL, 2, {41, 49, 0x0}},
-    {10302979330328154136ULL, 1, {31, 4, 0x0}},
-    {17587229113542786395ULL, 1, {28, 36, 0x0}},
-    {8982433921387038070ULL, 1, {19, 11, 0x0}},
-    {6511916568066537948ULL, 1, {19, 28, 0x1}},
-    {6803142323179306268ULL, 3, {45, 53, 0x0}},
-    {8626977525414508715ULL, 3, {9, 2, 0x0}},
-    {14164353473792241366ULL, 3, {36, 52, 0x2}},
-    {13398729801443659056ULL, 3, {18, 1, 0x0}},
-    {12735707120281114201ULL, 3, {28, 12, 0x2}},
-    {7805020125918525260ULL, 3, {57, 59, 0x40}},
-    {3879444309163250034ULL, 4, {9, 2, 0x0}},
-    {6169696536687634281ULL, 3, {28, 12, 0x2}},
-    {12257784396355947623ULL, 1, {42, 57, 0x0}},
-    {10717086832268720640ULL, 2, {1, 3, 0x40}},
-    {15428941850126800241ULL, 2, {43, 51, 0x0}},
-    {4407573588513695826ULL, 3, {23, 15, 0x0}},
-    {15728623238150956813ULL, 2, {37, 58, 0x1}},
-    {7753035919048400824ULL, 2, {32, 25, 0x0}},
-    {16589910872415471765ULL, 1, {43, 51, 0x0}},
-    {1875718771217360407ULL, 1, {28, 12, 0x2}},
-    {10501159566554330769ULL, 1, {36, 52, 0x2}},
-    {13450042728871674319ULL, 1, {36, 29, 0x1}},
-    {1979039845806718188ULL, 1, {36, 43, 0x1}},
-    {4967810136213311215ULL, 1, {44, 52, 0x0}},
-    {13412747078393125663ULL, 1, {36, 52, 0x2}},
-    {3215723270888588611ULL, 1, {36, 29, 0x1}},
-    {10310835337459187819ULL, 1, {36, 42, 0x1}},
-    {4138958925290388977ULL, 1, {20, 2, 0x0}},
-    {15655534216916741161ULL, 1, {44, 58, 0x0}},
-    {5503580811491008221ULL, 2, {36, 52, 0x2}},
-    {13206596365446255929ULL, 2, {14, 5, 0x0}},
-    {3032696441221770135ULL, 1, {37, 53, 0x2}},
-    {11757195965638891876ULL, 1, {36, 29, 0x1}},
-    {17378943678831727094ULL, 1, {36, 43, 0x1}},
-    {4831661732843981970ULL, 1, {22, 14, 0x0}},
-    {14440533680718379958ULL, 1, {49, 58, 0x0}},
-    {11817416701206178060ULL, 1, {29, 36, 0x1}},
-    {15398269115123770354ULL, 2, {28, 18, 0x1}},
-    {6093941527853937602ULL, 2, {28, 35, 0x1}},
-    {14412623096363382726ULL, 3, {44, 52, 0x0}},
-    {13871127374606016896ULL, 3, {27, 11, 0x2}},
-    {4923953463362391539ULL, 2, {43, 51, 0x0}},
-    {4112247143107604418ULL, 1, {19, 11, 0x0}},
-    {5568664523159430590ULL, 1, {42, 57, 0x0}},
-    {2807398840103583180ULL, 1, {18, 1, 0x0}},
-    {13190822679211346468ULL, 2, {31, 4, 0x0}},
-    {14611298026624942617ULL, 2, {52, 62, 0x0}},
-    {15728623238150956813ULL, 1, {45, 62, 0x0}},
-    {11198330765029071558ULL, 1, {44, 30, 0x0}},
-    {7284477486499441555ULL, 1, {23, 15, 0x0}},
-    {9310224577133119054ULL, 1, {57, 59, 0x40}},
-    {8062892291652416076ULL, 5, {43, 51, 0x0}},
-    {12363383796802578879ULL, 1, {28, 12, 0x2}},
-    {1413957399441262026ULL, 1, {52, 62, 0x0}},
-    {18283719482100206621ULL, 1, {29, 13, 0x2}},
-    {8701429678181947403ULL, 1, {43, 51, 0x0}},
-    {15043013291014996652ULL, 2, {29, 13, 0x2}},
-    {15507274552373016874ULL, 2, {25, 61, 0x0}},
-    {8739327024416649535ULL, 1, {35, 18, 0x0}},
-    {13436070059423381980ULL, 1, {43, 25, 0x0}},
-    {9174454309229643890ULL, 1, {9, 2, 0x0}},
-    {928693805656027844ULL, 1, {29, 36, 0x1}},
-    {15806064578058778728ULL, 1, {16, 8, 0x0}},
-    {17328174543632318266ULL, 1, {32, 25, 0x0}},
-    {12770466659933118255ULL, 1, {20, 12, 0x0}},
-    {16466491163319481834ULL, 1, {52, 62, 0x0}},
-    {8396167835030265523ULL, 1, {25, 9, 0x2}},
-    {17663833439775761853ULL, 1, {41, 32, 0x0}},
-    {4423570080327089207ULL, 2, {21, 6, 0x0}},
-    {7704161653307979390ULL, 2, {21, 13, 0x0}},
-    {10125303107540134921ULL, 1, {57, 59, 0x40}},
-    {12029778761923088085ULL, 1, {19, 11, 0x0}},
-    {9828935509944683463ULL, 1, {44, 52, 0x0}},
-    {1901106070116560627ULL, 1, {45, 62, 0x0}},
-    {4906975486543803143ULL, 1, {18, 1, 0x0}},
-    {18123477648210639119ULL, 1, {25, 61, 0x0}},
-    {3983138432817059200ULL, 2, {36, 29, 0x1}},
-    {10536147997559663440ULL, 2, {18, 25, 0x1}},
-    {8861511505067914185ULL, 2, {18, 9, 0x1}},
-    {15998500977716238897ULL, 2, {36, 60, 0x1}},
-    {5606354080358853735ULL, 1, {42, 57, 0x0}},
-    {7735770162046157210ULL, 1, {18, 1, 0x0}},
-    {4792450617328695419ULL, 2, {45, 53, 0x0}},
-    {18207604262266381598ULL, 1, {1, 3, 0x40}},
-    {15488000634527952533ULL, 1, {36, 52, 0x2}},
-    {16166384984392802666ULL, 1, {41, 49, 0x0}},
-    {14292005630350246568ULL, 1, {33, 5, 0x0}},
-    {10652168487226706053ULL, 1, {49, 58, 0x0}},
-    {6116848448814189756ULL, 1, {12, 6, 0x0}},
-    {15966386620841321481ULL, 1, {36, 52, 0x2}},
-    {11150782996442341653ULL, 1, {19, 11, 0x0}},
-    {9244656734522079779ULL, 1, {57, 59, 0x40}},
-    {9391237068903057342ULL, 3, {22, 4, 0x0}},
-    {8880538114463373688ULL, 1, {39, 55, 0x2}},
-    {9248388537246199705ULL, 1, {23, 15, 0x0}},
-    {18177636757166602576ULL, 1, {21, 30, 0x1}},
-    {13122240039880038859ULL, 1, {21, 22, 0x1}},
-    {9893878534809863978ULL, 1, {42, 57, 0x0}},
-    {14412623096363382726ULL, 1, {43, 51, 0x0}},
-    {4179988062268315253ULL, 1, {21, 6, 0x0}},
-    {12872666619662034762ULL, 1, {45, 62, 0x0}},
-    {8678813446254963662ULL, 1, {9, 2, 0x0}},
-    {3614283776249612116ULL, 1, {57, 59, 0x40}},
-    {8123386600714406937ULL, 2, {45, 53, 0x0}},
-    {14452726620559641518ULL, 1, {38, 54, 0x2}},
-    {15212621752507211582ULL, 1, {51, 60, 0x0}},
-    {14535759320407196794ULL, 1, {18, 1, 0x0}},
-    {15512160511713008513ULL, 1, {51, 57, 0x0}},
-    {12257784396355947623ULL, 2, {43, 51, 0x0}},
-    {13302645672444721779ULL, 2, {1, 3, 0x40}},
-    {16422536969269099167ULL, 2, {42, 57, 0x0}},
-    {12306994257515563500ULL, 1, {44, 58, 0x0}},
-    {1153711086512873939ULL, 1, {21, 13, 0x0}},
-    {995140149687482211ULL, 1, {47, 55, 0x0}},
-    {7817461587773872977ULL, 1, {45, 62, 0x0}},
-    {3288291246381348824ULL, 1, {38, 2, 0x0}},
-    {985949049086803927ULL, 1, {47, 55, 0x0}},
-    {9382696552662842693ULL, 1, {18, 25, 0x1}},
-    {3667706733383610692ULL, 1, {18, 9, 0x1}},
-    {15275757087742391819ULL, 1, {43, 51, 0x0}},
-    {13348692867155800469ULL, 1, {30, 58, 0x0}},
-    {15647365035980378476ULL, 2, {30, 58, 0x0}},
-    {3391644285989027401ULL, 1, {57, 59, 0x40}},
-    {15817298529433757170ULL, 1, {9, 2, 0x0}},
-    {450072722366051628ULL, 1, {24, 33, 0x0}},
-    {8526019735160087015ULL, 1, {29, 36, 0x1}},
-    {6815310747406727866ULL, 2, {21, 6, 0x0}},
-    {11850187137794325775ULL, 1, {29, 39, 0x1}},
-    {5987116548675183042ULL, 1, {22, 4, 0x0}},
-    {7166973640389991212ULL, 1, {29, 36, 0x1}},
-    {1372678218068159611ULL, 1, {47, 55, 0x0}},
-    {13680638196083069633ULL, 2, {29, 2, 0x0}},
-    {7658027954769996250ULL, 1, {42, 57, 0x0}},
-    {8903761106017082486ULL, 1, {21, 6, 0x0}},
-    {13258372258733050060ULL, 1, {45, 53, 0x0}},
-    {4938432648831328186ULL, 1, {22, 29, 0x0}},
-    {9678173733819541777ULL, 1, {36, 52, 0x2}},
-    {8903149488731738733ULL, 1, {26, 5, 0x0}},
-    {17445106151273050946ULL, 1, {44, 52, 0x0}},
-    {10563597401517293534ULL, 1, {28, 12, 0x2}},
-    {1424198990880039230ULL, 1, {37, 53, 0x2}},
-    {819755709118438304ULL, 1, {51, 58, 0x0}},
-    {4708117040037441050ULL, 1, {21, 30, 0x1}},
-    {5635556337638635408ULL, 1, {37, 29, 0x0}},
-    {3262678903805594319ULL, 1, {53, 46, 0x0}},
-    {14814780719070473262ULL, 1, {21, 13, 0x0}},
-    {85493357249464115ULL, 1, {34, 61, 0x0}},
-    {13028488112660535369ULL, 1, {22, 4, 0x0}},
-    {11755761063359312593ULL, 1, {61, 60, 0x0}},
-    {11777898590147796898ULL, 1, {26, 5, 0x0}},
-    {18092739918451552239ULL, 1, {43, 51, 0x0}},
-    {2412718457320762017ULL, 1, {17, 9, 0x0}},
-    {13285883394002734415ULL, 1, {42, 57, 0x0}},
-    {5824518216831573411ULL, 1, {9, 2, 0x0}},
-    {1765377045570075649ULL, 1, {45, 53, 0x0}},
-    {12119748102978060678ULL, 1, {25, 61, 0x0}},
-    {3711176409036077821ULL, 1, {18, 10, 0x0}},
-    {17891040775924183009ULL, 1, {43, 25, 0x0}},
-    {14783785900967398601ULL, 1, {21, 13, 0x0}},
-    {9766776839362488047ULL, 1, {44, 52, 0x0}},
-    {6550946086366465672ULL, 1, {27, 11, 0x2}},
-    {1445376715737942005ULL, 1, {42, 57, 0x0}},
-    {6993440976739071748ULL, 1, {47, 55, 0x0}},
-    {17192087352904672055ULL, 1, {29, 2, 0x1}},
-    {10715594497285721793ULL, 1, {43, 51, 0x0}},
-    {18224467871734260357ULL, 1, {29, 36, 0x1}},
-    {5943107510020347667ULL, 1, {23, 6, 0x0}},
-    {11553222298573149890ULL, 1, {47, 55, 0x0}},
-    {12062924084451543643ULL, 1, {29, 23, 0x1}},
-    {10893604662109916888ULL, 1, {38, 54, 0x2}},
-    {12372446729624088128ULL, 1, {19, 29, 0x0}},
-    {17016180258952233915ULL, 1, {54, 61, 0x0}},
-    {2110323922119010944ULL, 1, {41, 49, 0x0}},
-    {9610884969801400712ULL, 1, {9, 2, 0x0}},
-    {2072488761328328028ULL, 1, {49, 58, 0x0}},
-    {18368591231038986601ULL, 1, {11, 1, 0x0}},
-    {2363571776061342737ULL, 1, {45, 62, 0x0}},
-    {9404636877234465253ULL, 1, {41, 49, 0x0}},
-    {7780755938303252785ULL, 1, {21, 6, 0x0}},
-    {10010269448306746439ULL, 1, {49, 58, 0x0}},
-    {10959136273208966377ULL, 1, {20, 12, 0x0}},
-    {11345259063409242439ULL, 1, {34, 50, 0x2}},
-    {17026068999397319178ULL, 1, {45, 62, 0x0}},
-    {11555061940069480104ULL, 1, {46, 54, 0x0}},
-    {5626951822377955140ULL, 1, {20, 2, 0x0}},
-    {2341762999788705279ULL, 1, {54, 61, 0x0}},
-    {18207604262266381598ULL, 1, {22, 14, 0x0}},
-    {13626982525698986006ULL, 1, {36, 52, 0x2}},
-    {7709745360062743187ULL, 2, {13, 4, 0x0}},
-    {17777733629842685107ULL, 1, {38, 54, 0x2}},
-    {11702902790697243436ULL, 1, {21, 6, 0x0}},
-    {5525578076056028078ULL, 1, {57, 59, 0x40}},
-    {188692947242122750ULL, 3, {45, 53, 0x0}},
-    {12331730809702144593ULL, 2, {22, 14, 0x0}},
-    {3611132883002132808ULL, 1, {52, 62, 0x0}},
-    {6402264709200718483ULL, 2, {21, 13, 0x0}},
-    {13906399508673441675ULL, 3, {57, 59, 0x40}},
-    {2377697397716333952ULL, 3, {13, 4, 0x0}},
-    {11092304562866076695ULL, 2, {42, 57, 0x0}},
-    {11481338360563125614ULL, 2, {12, 6, 0x0}},
-    {14838341121397982214ULL, 1, {29, 36, 0x1}},
-    {16269969763765474400ULL, 2, {23, 15, 0x0}},
-    {4237606143574668704ULL, 2, {42, 57, 0x0}},
-    {12134404744492100026ULL, 2, {19, 11, 0x0}},
-    {10359386759467447352ULL, 2, {45, 53, 0x0}},
-    {8714554056806084529ULL, 2, {18, 1, 0x0}},
-    {2332296227316134300ULL, 2, {27, 35, 0x0}},
-    {12517351131716004921ULL, 2, {28, 18, 0x0}},
-    {8319998840099199312ULL, 2, {36, 52, 0x2}},
-    {15315089471151137809ULL, 1, {20, 12, 0x0}},
-    {10660438889997188431ULL, 1, {44, 58, 0x0}},
-    {17549429878562197331ULL, 1, {45, 62, 0x0}},
-    {18338535724100163188ULL, 1, {12, 6, 0x0}},
-    {1394309267880011347ULL, 1, {42, 57, 0x0}},
-    {16522763457632703514ULL, 1, {23, 15, 0x0}},
-    {1113754827731596810ULL, 1, {39, 55, 0x2}},
-    {6841954008926061468ULL, 2, {45, 53, 0x0}},
-    {2453279773812829633ULL, 2, {17, 9, 0x0}},
-    {10385932457051632280ULL, 2, {44, 52, 0x0}},
-    {324735531172022568ULL, 1, {9, 2, 0x0}},
-    {17489352742252499211ULL, 1, {42, 57, 0x0}},
-    {2330675613591654622ULL, 1, {29, 13, 0x2}},
-    {1085697776334408688ULL, 1, {35, 51, 0x2}},
-    {4906127729811442387ULL, 1, {1, 3, 0x40}},
-    {528105827702339079ULL, 1, {51, 58, 0x0}},
-    {5635356405803296385ULL, 1, {57, 59, 0x40}},
-    {18295344350778702024ULL, 2, {45, 53, 0x0}},
-    {13511606808887857926ULL, 2, {29, 13, 0x2}},
-    {1748283900397453389ULL, 1, {42, 57, 0x0}},
-    {3866080351849020521ULL, 1, {44, 52, 0x0}},
-    {9941425419619847227ULL, 1, {18, 1, 0x0}},
-    {8587749136546355201ULL, 1, {52, 62, 0x0}},
-    {337468742841996050ULL, 1, {27, 11, 0x2}},
-    {15624391706889586733ULL, 1, {35, 51, 0x2}},
-    {2502997548444194087ULL, 3, {26, 10, 0x2}},
-    {9344943471978817094ULL, 1, {42, 57, 0x0}},
-    {5606354080358853735ULL, 1, {34, 50, 0x2}},
-    {5167820231769872337ULL, 1, {21, 6, 0x0}},
-    {5227487485977633913ULL, 1, {42, 57, 0x0}},
-    {6323382415598619836ULL, 1, {28, 12, 0x2}},
-    {16461254064896954000ULL, 1, {57, 59, 0x40}},
-    {6825444391811535011ULL, 1, {45, 62, 0x0}},
-    {12721892020941828192ULL, 3, {37, 53, 0x2}},
-    {8737519850864663863ULL, 3, {19, 11, 0x0}},
-    {3602108563509331271ULL, 1, {41, 49, 0x0}},
-    {4639719523495219495ULL, 1, {14, 5, 0x0}},
-    {13159340431878718416ULL, 1, {42, 57, 0x0}},
-    {5308035162680352407ULL, 1, {29, 13, 0x2}},
-    {10112500969059324140ULL, 1, {29, 36, 0x1}},
-    {324735531172022568ULL, 1, {28, 12, 0x2}},
-    {3169412602522514014ULL, 1, {52, 62, 0x0}},
-    {14702853051016393964ULL, 1, {29, 13, 0x2}},
-    {6328327604529795189ULL, 1, {35, 51, 0x2}},
-    {9994668565250281806ULL, 1, {21, 6, 0x0}},
-    {1010420621366471411ULL, 1, {42, 57, 0x0}},
-    {9131774160553666360ULL, 1, {41, 49, 0x0}},
-    {14035217114420712781ULL, 1, {21, 13, 0x0}},
-    {13592069860347447070ULL, 1, {43, 51, 0x0}},
-    {11278369125315000038ULL, 1, {28, 12, 0x2}},
-    {11027359633715201247ULL, 1, {36, 52, 0x2}},
-    {11613749464827279880ULL, 1, {36, 27, 0x1}},
-    {15122923832611963526ULL, 1, {36, 43, 0x1}},
-    {13083585178836028171ULL, 1, {41, 49, 0x0}},
-    {16793891477578164676ULL, 1, {29, 13, 0x2}},
-    {8161931984283260320ULL, 1, {45, 53, 0x0}},
-    {145395755030321996ULL, 1, {27, 11, 0x2}},
-    {15247749791936861289ULL, 1, {36, 52, 0x2}},
-    {17168431791711507106ULL, 1, {35, 27, 0x0}},
-    {2935291307738895203ULL, 1, {52, 42, 0x0}},
-    {8966535503725160205ULL, 1, {19, 11, 0x0}},
-    {4697095400129467838ULL, 1, {43, 51, 0x0}},
-    {2132669888279692264ULL, 1, {14, 5, 0x0}},
-    {949463546822895009ULL, 1, {42, 57, 0x0}},
-    {3262483593097622570ULL, 1, {20, 12, 0x0}},
-    {16307306787979267051ULL, 1, {39, 55, 0x2}},
-    {15146299086823517605ULL, 1, {20, 2, 0x0}},
-    {4369651784913504447ULL, 1, {37, 53, 0x2}},
-    {6784683725277739689ULL, 1, {1, 3, 0x40}},
-    {15587781267113939558ULL, 1, {49, 58, 0x0}},
-    {8917516792249963565ULL, 1, {35, 51, 0x2}},
-    {2301175346920265746ULL, 1, {19, 11, 0x0}},
-    {4670805133053280453ULL, 1, {44, 52, 0x0}},
-    {1012905480992085559ULL, 1, {22, 14, 0x0}},
-    {5350892883620707258ULL, 1, {35, 51, 0x2}},
-    {17473868040356433141ULL, 1, {14, 5, 0x0}},
-    {8677518006023688458ULL, 1, {42, 57, 0x0}},
-    {11040382940387566686ULL, 1, {28, 12, 0x2}},
-    {12464834795103212444ULL, 1, {52, 62, 0x0}},
-    {12767304288290706910ULL, 1, {17, 9, 0x0}},
-    {1071109341579986032ULL, 1, {41, 49, 0x0}},
-    {7018414241491437706ULL, 1, {43, 51, 0x0}},
-    {15853327233346339567ULL, 1, {21, 6, 0x0}},
-    {10779659396067183830ULL, 1, {37, 53, 0x2}},
-    {14179432967541022071ULL, 1, {17, 9, 0x0}},
-    {1098243531482043858ULL, 2, {45, 62, 0x0}},
-    {3602108563509331271ULL, 2, {45, 62, 0x0}},
-    {16965590171753796382ULL, 1, {14, 5, 0x0}},
-    {18248890985497596581ULL, 1, {42, 57, 0x0}},
-    {14821169066879762562ULL, 1, {43, 51, 0x0}},
-    {15042907740151897088ULL, 1, {18, 1, 0x0}},
-    {15176747765653098988ULL, 1, {35, 51, 0x2}},
-    {1611723605530087445ULL, 1, {1, 3, 0x40}},
-    {9193297812429676933ULL, 1, {37, 53, 0x2}},
-    {2951681942150231560ULL, 1, {29, 13, 0x2}},
-    {1170254466237051344ULL, 1, {45, 62, 0x0}},
-    {8473730752022548436ULL, 1, {35, 51, 0x2}},
-    {450502636740431445ULL, 1, {18, 1, 0x0}},
-    {4172878783544850166ULL, 1, {44, 52, 0x0}},
-    {18444431847159111900ULL, 1, {28, 12, 0x2}},
-    {1815539299085708762ULL, 1, {52, 62, 0x0}},
-    {10746152264969777630ULL, 1, {21, 6, 0x0}},
-    {4708975306879792126ULL, 1, {42, 57, 0x0}},
-    {8785894358676112783ULL, 2, {20, 12, 0x0}},
-    {7947580586152224421ULL, 2, {25, 61, 0x0}},
-    {9096914098667035251ULL, 1, {22, 14, 0x0}},
-    {15343257037127173088ULL, 1, {52, 62, 0x0}},
-    {17109414767797610316ULL, 1, {47, 55, 0x0}},
-    {2872404793487096103ULL, 1, {22, 14, 0x0}},
-    {12079890062329786265ULL, 1, {37, 53, 0x2}},
-    {16736625676928893282ULL, 3, {37, 53, 0x2}},
-    {11164015105271174732ULL, 1, {28, 37, 0x1}},
-    {9096914098667035251ULL, 1, {12, 6, 0x0}},
-    {5176317588280895049ULL, 1, {52, 62, 0x0}},
-    {15040715628957455570ULL, 1, {19, 11, 0x0}},
-    {2267484175449666655ULL, 1, {42, 57, 0x0}},
-    {10819925966828592847ULL, 1, {28, 12, 0x2}},
-    {666616906691285750ULL, 1, {49, 58, 0x0}},
-    {4861926142282886787ULL, 1, {36, 28, 0x0}},
-    {7660987663510493929ULL, 1, {57, 59, 0x40}},
-    {13337726644178258082ULL, 1, {20, 12, 0x0}},
-    {2643608541490629217ULL, 1, {42, 57, 0x0}},
-    {17374786467211406040ULL, 1, {17, 9, 0x0}},
-    {6903244101024865841ULL, 1, {30, 58, 0x0}},
-    {3865680031249028750ULL, 1, {46, 60, 0x0}},
-    {8120541413462616762ULL, 2, {19, 11, 0x0}},
-    {13979787711670303538ULL, 1, {30, 58, 0x0}},
-    {11876449631175918924ULL, 1, {11, 1, 0x0}},
-    {3357702043860372037ULL, 1, {45, 53, 0x0}},
-    {8927218991875041931ULL, 1, {23, 15, 0x0}},
-    {5177180717739029614ULL, 1, {39, 30, 0x0}},
-    {3669750180153683402ULL, 1, {9, 2, 0x0}},
-    {3153074129709529824ULL, 1, {49, 58, 0x0}},
-    {2797284083970668928ULL, 1, {19, 11, 0x0}},
-    {17630799631603171513ULL, 1, {43, 51, 0x0}},
-    {5299146982517223296ULL, 1, {28, 12, 0x2}},
-    {12835078441313324512ULL, 1, {36, 52, 0x2}},
-    {3909303066927482053ULL, 1, {45, 62, 0x0}},
-    {8734052717918698342ULL, 1, {49, 58, 0x0}},
-    {2185107376395608112ULL, 1, {19, 5, 0x0}},
-    {853315467619629722ULL, 1, {47, 55, 0x0}},
-    {8653803125951045468ULL, 1, {36, 52, 0x2}},
-    {15763822734711992934ULL, 1, {29, 13, 0x2}},
-    {4155962301753465845ULL, 1, {45, 53, 0x0}},
-    {15503994200331857815ULL, 1, {42, 50, 0x0}},
-    {4394622772250732555ULL, 1, {12, 33, 0x0}},
-    {13698460425044770496ULL, 1, {29, 36, 0x1}},
-    {7122886126778725635ULL, 1, {21, 13, 0x0}},
-    {1221210769281259082ULL, 1, {37, 53, 0x2}},
-    {4101368096873955490ULL, 1, {12, 6, 0x0}},
-    {9246059222838258672ULL, 1, {45, 62, 0x0}},
-    {11382597043359337162ULL, 2, {45, 53, 0x0}},
-    {8737869653759538753ULL, 2, {11, 1, 0x0}},
-    {2127131855982589216ULL, 2, {36, 52, 0x2}},
-    {5615811326698465498ULL, 1, {41, 49, 0x0}},
-    {9050577108334555456ULL, 1, {36, 29, 0x1}},
-    {12142726453447033436ULL, 1, {36, 45, 0x1}},
-    {2440405679371428750ULL, 2, {21, 6, 0x0}},
-    {8148536751621930796ULL, 1, {21, 36, 0x1}},
-    {1773804940687752254ULL, 1, {21, 12, 0x1}},
-    {16077536440975265980ULL, 1, {45, 62, 0x0}},
-    {6812211877174529023ULL, 1, {42, 57, 0x0}},
-    {7018495528597784692ULL, 1, {28, 12, 0x2}},
-    {8623294716562397061ULL, 1, {28, 37, 0x1}},
-    {17519490298778175817ULL, 1, {28, 21, 0x1}},
-    {11949001648706773719ULL, 1, {36, 52, 0x2}},
-    {12894722589493139044ULL, 1, {21, 6, 0x0}},
-    {4923953463362391539ULL, 1, {49, 58, 0x0}},
-    {2501578675895032961ULL, 1, {29, 36, 0x1}},
-    {943857438916438423ULL, 1, {29, 31, 0x1}},
-    {8797109604463170742ULL, 1, {37, 53, 0x2}},
-    {10289342357699508150ULL, 1, {38, 54, 0x2}},
-    {8949585484049234942ULL, 1, {19, 11, 0x0}},
-    {11090655963914603170ULL, 1, {47, 55, 0x0}},
-    {8086473169122877085ULL, 1, {9, 2, 0x0}},
-    {4223151733703516863ULL, 1, {54, 61, 0x0}},
-    {5231336699538722339ULL, 1, {1, 3, 0x40}},
-    {5521289663563409989ULL, 1, {42, 57, 0x0}},
-    {12446057105285763466ULL, 1, {41, 49, 0x0}},
-    {15783997244443500505ULL, 1, {22, 14, 0x0}},
-    {10445272589269613096ULL, 1, {49, 58, 0x0}},
-    {3293031995871834272ULL, 1, {20, 2, 0x0}},
-    {12298979907845551979ULL, 1, {27, 42, 0x0}},
-    {4831661732843981970ULL, 2, {19, 11, 0x0}},
-    {4942783562595434079ULL, 2, {49, 58, 0x0}},
-    {1833656183454297770ULL, 1, {25, 61, 0x0}},
-    {14659149986332415082ULL, 1, {28, 4, 0x1}},
-    {8304293919102102295ULL, 1, {47, 55, 0x0}},
-    {266018415002078424ULL, 1, {18, 1, 0x0}},
-    {14611490457702194744ULL, 1, {45, 62, 0x0}},
-    {13393008549543341842ULL, 1, {42, 57, 0x0}},
-    {9548237298594179844ULL, 1, {21, 6, 0x0}},
-    {11966111657242112441ULL, 1, {41, 49, 0x0}},
-    {460840698937291885ULL, 1, {49, 58, 0x0}},
-    {11406991152036004517ULL, 3, {20, 12, 0x0}},
-    {8446784420751146235ULL, 2, {44, 52, 0x0}},
-    {2228310023191286898ULL, 2, {36, 52, 0x2}},
-    {2427767664370733664ULL, 1, {53, 60, 0x0}},
-    {11871090834686981037ULL, 1, {43, 51, 0x0}},
-    {2938365375707818714ULL, 1, {9, 2, 0x0}},
-    {4119793360745517646ULL, 1, {37, 53, 0x2}},
-    {17505916372964406442ULL, 1, {18, 1, 0x0}},
-    {1548708506675262952ULL, 1, {53, 60, 0x0}},
-    {8446784420751146235ULL, 1, {43, 51, 0x0}},
-    {1579516743148795256ULL, 1, {45, 53, 0x0}},
-    {3437205817293449776ULL, 3, {57, 59, 0x40}},
-    {15643342750863056958ULL, 2, {27, 35, 0x0}},
-    {16485997008729725944ULL, 1, {22, 4, 0x0}},
-    {2219891611449365355ULL, 1, {36, 52, 0x2}},
-    {1290824433729555758ULL, 2, {42, 57, 0x0}},
-    {9551472474573670967ULL, 2, {18, 1, 0x0}},
-    {16427702868890405999ULL, 2, {45, 62, 0x0}},
-    {11095128004004694589ULL, 2, {23, 15, 0x0}},
-    {11142467033247927999ULL, 1, {41, 49, 0x0}},
-    {5425489287689898963ULL, 1, {21, 6, 0x0}},
-    {17567275503093017253ULL, 1, {49, 58, 0x0}},
-    {2893989887187591113ULL, 1, {17, 9, 0x0}},
-    {11430794196804804055ULL, 1, {49, 58, 0x0}},
-    {7961381793481255136ULL, 1, {16, 8, 0x0}},
-    {14944237311422857184ULL, 1, {35, 51, 0x2}},
-    {10783425967204384441ULL, 1, {27, 11, 0x2}},
-    {16195965730362404735ULL, 1, {38, 54, 0x2}},
-    {15600799605251911477ULL, 1, {42, 57, 0x0}},
-    {9793882217960587039ULL, 1, {1, 3, 0x40}},
-    {2848727678882463807ULL, 1, {41, 49, 0x0}},
-    {16101180021102204228ULL, 1, {28, 12, 0x2}},
-    {2914686970445575431ULL, 1, {28, 37, 0x1}},
-    {3842513751841813357ULL, 1, {45, 62, 0x0}},
-    {13989414337124873909ULL, 1, {38, 2, 0x0}},
-    {16240091476247615721ULL, 1, {28, 45, 0x0}},
-    {3611132883002132808ULL, 1, {46, 54, 0x0}},
-    {3536559802224465222ULL, 1, {35, 51, 0x2}},
-    {16576340125263318608ULL, 1, {34, 50, 0x2}},
-    {11406859771477764992ULL, 1, {28, 12, 0x2}},
-    {4992538773212451219ULL, 1, {28, 35, 0x1}},
-    {13775277063001850550ULL, 1, {43, 51, 0x0}},
-    {12644259006307525552ULL, 1, {30, 14, 0x2}},
-    {18253633825973276994ULL, 1, {39, 55, 0x2}},
-    {8991143333196672608ULL, 1, {41, 49, 0x0}},
-    {3829185419407060211ULL, 1, {16, 8, 0x0}},
-    {5495942616813085413ULL, 1, {51, 58, 0x0}},
-    {8720278497729489067ULL, 1, {38, 2, 0x0}},
-    {12837822630179309120ULL, 1, {44, 52, 0x0}},
-    {1759454108154958090ULL, 1, {27, 36, 0x1}},
-    {15811544210704732222ULL, 1, {27, 18, 0x1}},
-    {11876020353740416369ULL, 1, {35, 51, 0x2}},
-    {17831064832500006385ULL, 1, {18, 1, 0x0}},
-    {1949802801493791928ULL, 1, {25, 61, 0x0}},
-    {869759129724362111ULL, 1, {45, 62, 0x0}},
-    {11489086244224187830ULL, 1, {28, 12, 0x2}},
-    {8676272330475684341ULL, 1, {28, 37, 0x1}},
-    {16447271290254097307ULL, 1, {28, 18, 0x1}},
-    {14198946862892319371ULL, 1, {42, 57, 0x0}},
-    {1759454108154958090ULL, 1, {41, 49, 0x0}},
-    {10287379299939105506ULL, 1, {21, 6, 0x0}},
-    {7755433793032905145ULL, 1, {49, 58, 0x0}},
-    {3965706284271499181ULL, 1, {35, 27, 0x0}},
-    {8627881762850431307ULL, 1, {37, 45, 0x0}},
-    {16749991259957636350ULL, 2, {37, 53, 0x2}},
-    {3528828767237227363ULL, 1, {37, 30, 0x1}},
-    {615997109668373059ULL, 1, {45, 62, 0x0}},
-    {14255997158565010695ULL, 1, {23, 5, 0x0}},
-    {310004554424643268ULL, 1, {35, 51, 0x2}},
-    {3037644815974198949ULL, 1, {46, 54, 0x0}},
-    {9727332601297506651ULL, 1, {19, 11, 0x0}},
-    {7871689313487738494ULL, 1, {41, 49, 0x0}},
-    {3264152854861966874ULL, 1, {28, 12, 0x2}},
-    {14269622014641597761ULL, 1, {49, 58, 0x0}},
-    {12827528685899115972ULL, 1, {45, 53, 0x0}},
-    {16042461870651309485ULL, 1, {18, 1, 0x0}},
-    {6101248211433792277ULL, 1, {25, 61, 0x0}},
-    {16536369538972414540ULL, 1, {16, 8, 0x0}},
-    {13615896662535816178ULL, 1, {32, 25, 0x0}},
-    {820529082993068353ULL, 2, {28, 45, 0x0}},
-    {4164044936573681678ULL, 1, {44, 58, 0x0}},
-    {16124679052965644032ULL, 1, {29, 13, 0x2}},
-    {5798245470178220433ULL, 1, {43, 51, 0x0}},
-    {438452299718572583ULL, 1, {36, 29, 0x1}},
-    {2652584088351654159ULL, 1, {36, 43, 0x1}},
-    {10302979330328154136ULL, 1, {9, 2, 0x0}},
-    {8125916443761679523ULL, 2, {49, 58, 0x0}},
-    {13887682881870634634ULL, 1, {1, 3, 0x40}},
-    {14569855992738094309ULL, 1, {42, 57, 0x0}},
-    {2191941687698111428ULL, 1, {36, 52, 0x2}},
-    {5455325221117840961ULL, 1, {36, 27, 0x1}},
-    {15428353735287155871ULL, 1, {36, 60, 0x1}},
-    {16795829264826714856ULL, 1, {28, 12, 0x2}},
-    {8034997011672614270ULL, 1, {42, 57, 0x0}},
-    {5579608121418440609ULL, 3, {45, 62, 0x0}},
-    {16467085625833133415ULL, 2, {9, 2, 0x0}},
-    {1475679628462735391ULL, 2, {41, 49, 0x0}},
-    {17549429878562197331ULL, 1, {45, 53, 0x0}},
-    {6067157186522853717ULL, 1, {18, 1, 0x0}},
-    {3518929532376982102ULL, 1, {44, 58, 0x0}},
-    {1736362201741511168ULL, 1, {1, 3, 0x40}},
-    {10343384054175991871ULL, 1, {42, 57, 0x0}},
-    {3551152596911524438ULL, 1, {29, 36, 0x1}},
-    {505013430571354046ULL, 1, {19, 11, 0x0}},
-    {17907342412799359363ULL, 1, {38, 54, 0x2}},
-    {2005761301455442609ULL, 1, {45, 53, 0x0}},
-    {2301175346920265746ULL, 1, {22, 14, 0x0}},
-    {5786959257679165473ULL, 1, {36, 52, 0x2}},
-    {8841020228770478731ULL, 1, {14, 5, 0x0}},
-    {7435513012675951121ULL, 1, {34, 61, 0x0}},
-    {3171330915962776416ULL, 1, {18, 1, 0x0}},
-    {11891952011560889439ULL, 1, {42, 57, 0x0}},
-    {11240875917165806144ULL, 1, {20, 12, 0x0}},
-    {5446751101491036632ULL, 1, {40, 48, 0x0}},
-    {2377697397716333952ULL, 1, {22, 14, 0x0}},
-    {6014928242435222069ULL, 1, {44, 58, 0x0}},
-    {3117948365308243081ULL, 1, {17, 9, 0x0}},
-    {1996032072773836353ULL, 1, {34, 50, 0x2}},
-    {6852069104017634040ULL, 2, {19, 11, 0x0}},
-    {16856978025533890793ULL, 1, {30, 58, 0x0}},
-    {16395124007663035585ULL, 2, {44, 52, 0x0}},
-    {14177085116817708326ULL, 2, {21, 6, 0x0}},
-    {6593964448649722376ULL, 2, {49, 58, 0x0}},
-    {12954643867641890494ULL, 2, {28, 12, 0x2}},
-    {13611605857618150832ULL, 2, {37, 53, 0x2}},
-    {2670599711321406629ULL, 2, {19, 11, 0x0}},
-    {4172208925619635455ULL, 2, {28, 37, 0x1}},
-    {15138223181120691840ULL, 1, {36, 52, 0x2}},
-    {14113686490968431664ULL, 1, {36, 27, 0x1}},
-    {14491830428617038326ULL, 1, {36, 42, 0x1}},
-    {8586775188470126379ULL, 1, {9, 2, 0x0}},
-    {4777643686146364946ULL, 1, {21, 36, 0x1}},
-    {2977727989287694999ULL, 1, {11, 2, 0x0}},
-    {12206713540845115255ULL, 1, {42, 57, 0x0}},
-    {6860967692601347612ULL, 1, {20, 12, 0x0}},
-    {12030387508924228803ULL, 1, {36, 52, 0x2}},
-    {4170450925713610135ULL, 1, {12, 6, 0x0}},
-    {13408101798746485241ULL, 1, {37, 58, 0x0}},
-    {8199754194772814436ULL, 1, {42, 57, 0x0}},
-    {11048088471440869085ULL, 1, {44, 52, 0x0}},
-    {6442640849711823585ULL, 1, {9, 2, 0x0}},
-    {17009048183442145544ULL, 1, {31, 15, 0x2}},
-    {17478352840886361180ULL, 1, {47, 55, 0x0}},
-    {9321333274018776774ULL, 1, {11, 38, 0x0}},
-    {2432950891659619128ULL, 1, {41, 49, 0x0}},
-    {2145754447149733268ULL, 1, {21, 13, 0x0}},
-    {12454650127587245166ULL, 1, {37, 53, 0x2}},
-    {17601076987678586237ULL, 2, {28, 45, 0x0}},
-    {2741397821981498825ULL, 1, {25, 61, 0x0}},
-    {1346590116790759398ULL, 2, {31, 15, 0x2}},
-    {5391897694672949799ULL, 2, {30, 58, 0x0}},
-    {18258654199023794385ULL, 3, {37, 53, 0x2}},
-    {4652607850972492938ULL, 3, {9, 2, 0x0}},
-    {12942050154810573329ULL, 1, {57, 59, 0x40}},
-    {17757592753060749438ULL, 2, {44, 52, 0x0}},
-    {13915678949711982208ULL, 2, {13, 4, 0x0}},
-    {15203645580215780451ULL, 2, {52, 62, 0x0}},
-    {17942696889218479070ULL, 2, {37, 58, 0x0}},
-    {17920414189561426350ULL, 2, {37, 58, 0x0}},
-    {9211845321325076354ULL, 2, {20, 12, 0x0}},
-    {15294123370353601410ULL, 1, {44, 52, 0x0}},
-    {17602522198243146145ULL, 1, {31, 21, 0x0}},
-    {3144766583436760674ULL, 1, {46, 37, 0x0}},
-    {10125303107540134921ULL, 1, {44, 52, 0x0}},
-    {17202862586476645642ULL, 1, {16, 8, 0x0}},
-    {18207760298088940676ULL, 1, {57, 59, 0x40}},
-    {14243878172982361627ULL, 1, {37, 53, 0x2}},
-    {2286439104079961803ULL, 1, {1, 3, 0x40}},
-    {8579053811411667553ULL, 1, {45, 62, 0x0}},
-    {12927324252494665270ULL, 2, {36, 52, 0x2}},
-    {5389197089277834969ULL, 2, {36, 29, 0x1}},
-    {14787146795040931219ULL, 2, {36, 42, 0x1}},
-    {11203613255893316790ULL, 2, {9, 2, 0x0}},
-    {4394942307833677123ULL, 1, {45, 53, 0x0}},
-    {11326467469624039402ULL, 1, {18, 1, 0x0}},
-    {3550150256631402734ULL, 1, {34, 61, 0x0}},
-    {2577906674093469537ULL, 1, {21, 6, 0x0}},
-    {2791689742260149624ULL, 1, {28, 35, 0x1}},
-    {4354772271343285253ULL, 1, {17, 9, 0x0}},
-    {6440242886014648904ULL, 1, {41, 49, 0x0}},
-    {14487611916473072118ULL, 1, {9, 2, 0x0}},
-    {3274043524460057271ULL, 1, {21, 13, 0x0}},
-    {7891604518545529557ULL, 1, {37, 53, 0x2}},
-    {15133698801703490053ULL, 1, {35, 27, 0x0}},
-    {18327866067212850889ULL, 1, {45, 62, 0x0}},
-    {8447631713456297032ULL, 1, {52, 62, 0x0}},
-    {7135703894480977587ULL, 1, {20, 4, 0x0}},
-    {8774324354527684973ULL, 1, {40, 48, 0x0}},
-    {1294491315707699565ULL, 1, {24, 33, 0x0}},
-    {1177663506289633593ULL, 1, {43, 51, 0x0}},
-    {4197901149777274304ULL, 1, {38, 2, 0x0}},
-    {156452330672155319ULL, 1, {52, 61, 0x0}},
-    {7671511946693089235ULL, 1, {28, 35, 0x1}},
-    {3771875052969260853ULL, 1, {35, 27, 0x0}},
-    {11715833558559144733ULL, 1, {27, 42, 0x0}},
-    {240565485146935938ULL, 1, {21, 6, 0x0}},
-    {18311852058031207883ULL, 1, {36, 52, 0x2}},
-    {4424976813206090745ULL, 4, {38, 54, 0x2}},
-    {3709447702243419339ULL, 3, {42, 57, 0x0}},
-    {14662569612601096289ULL, 2, {18, 1, 0x0}},
-    {2239876910941901166ULL, 2, {36, 42, 0x1}},
-    {5788885836947617653ULL, 2, {28, 12, 0x2}},
-    {10870327730388063012ULL, 1, {34, 61, 0x0}},
-    {11239871655048690443ULL, 1, {20, 2, 0x0}},
-    {12167516760378290512ULL, 1, {20, 34, 0x1}},
-    {7610836377752460079ULL, 1, {11, 2, 0x0}},
-    {13793411365554578045ULL, 1, {44, 52, 0x0}},
-    {7678280131753579654ULL, 2, {43, 51, 0x0}},
-    {17942642077315564241ULL, 2, {18, 1, 0x0}},
-    {3368769041531004970ULL, 2, {42, 57, 0x0}},
-    {1635983559685780572ULL, 1, {35, 51, 0x2}},
-    {9907437771093545100ULL, 1, {11, 2, 0x0}},
-    {9527757239209639218ULL, 1, {34, 61, 0x0}},
-    {9131774160553666360ULL, 1, {45, 53, 0x0}},
-    {4424976813206090745ULL, 1, {37, 58, 0x0}},
-    {15278193525252374643ULL, 1, {36, 52, 0x2}},
-    {6713950162534808854ULL, 1, {29, 2, 0x0}},
-    {12908898488334244561ULL, 1, {47, 55, 0x0}},
-    {15075727771507211283ULL, 1, {47, 55, 0x0}},
-    {8903149488731738733ULL, 2, {33, 5, 0x0}},
-    {10625060565898749570ULL, 1, {37, 53, 0x2}},
-    {2093600658088600321ULL, 1, {45, 62, 0x0}},
-    {6905038139103109554ULL, 1, {23, 15, 0x0}},
-    {16186271518977668026ULL, 1, {36, 52, 0x2}},
-    {5497339343509371663ULL, 1, {33, 5, 0x0}},
-    {9970243289577470513ULL, 1, {51, 58, 0x0}},
-    {2874650949772251881ULL, 1, {36, 42, 0x1}},
-    {16322081069638909478ULL, 1, {17, 9, 0x0}},
-    {13868679603657277097ULL, 1, {49, 58, 0x0}},
-    {13169631616131953290ULL, 1, {9, 2, 0x0}},
-    {14714039772444151352ULL, 1, {44, 52, 0x0}},
-    {13568805724748171974ULL, 1, {36, 52, 0x2}},
-    {9651650726527733689ULL, 1, {36, 29, 0x1}},
-    {7648650664919079203ULL, 1, {36, 42, 0x1}},
-    {16881142848612127142ULL, 1, {36, 28, 0x0}},
-    {8898366466542964046ULL, 1, {30, 58, 0x0}},
-    {6036012125726816154ULL, 1, {12, 5, 0x0}},
-    {7647598568667644387ULL, 1, {51, 60, 0x0}},
-    {6652472794184470861ULL, 1, {44, 52, 0x0}},
-    {7582564535987289885ULL, 1, {14, 5, 0x0}},
-    {744977712821158122ULL, 1, {42, 57, 0x0}},
-    {2478898424831934554ULL, 1, {38, 2, 0x0}},
-    {17541988205838967304ULL, 1, {52, 61, 0x0}},
-    {6527068165036213468ULL, 1, {52, 38, 0x1}},
-    {7936205956609999183ULL, 1, {52, 60, 0x1}},
-    {7454719158710978582ULL, 1, {30, 14, 0x2}},
-    {10315618396822137786ULL, 1, {46, 37, 0x0}},
-    {7137085168647858108ULL, 1, {36, 28, 0x0}},
-    {13134599628914872215ULL, 1, {57, 59, 0x40}},
-    {9209746484468639587ULL, 1, {43, 51, 0x0}},
-    {16269742679473054840ULL, 1, {28, 12, 0x2}},
-    {1959094261608666195ULL, 1, {41, 49, 0x0}},
-    {11050227760932339762ULL, 1, {46, 54, 0x0}},
-    {17975516294966124570ULL, 1, {17, 9, 0x0}},
-    {2292401931599415760ULL, 1, {45, 62, 0x0}},
-    {9170743332773724531ULL, 1, {9, 2, 0x0}},
-    {18384635556512858120ULL, 1, {41, 49, 0x0}},
-    {6991759869702880635ULL, 1, {44, 52, 0x0}},
-    {18215182970462999684ULL, 1, {27, 11, 0x2}},
-    {967663964112795283ULL, 1, {57, 59, 0x40}},
-    {17777733629842685107ULL, 1, {41, 49, 0x0}},
-    {17951311593127819798ULL, 2, {36, 52, 0x2}},
-    {17875765517209485034ULL, 2, {36, 27, 0x1}},
-    {18162769172309024673ULL, 2, {36, 43, 0x1}},
-    {16189382886871218125ULL, 2, {28, 12, 0x2}},
-    {8484280549169571066ULL, 2, {45, 62, 0x0}},
-    {169171433229631623ULL, 2, {28, 12, 0x2}},
-    {9619654411036369844ULL, 1, {21, 13, 0x0}},
-    {11387475046724860723ULL, 1, {42, 57, 0x0}},
-    {12612166236925936561ULL, 1, {1, 3, 0x40}},
-    {17032071001735553489ULL, 1, {28, 37, 0x1}},
-    {8184068324624961008ULL, 1, {28, 12, 0x2}},
-    {827117085685948540ULL, 1, {36, 44, 0x0}},
-    {1391607233297579990ULL, 1, {46, 54, 0x0}},
-    {1992228808461556049ULL, 1, {37, 53, 0x2}},
-    {334227015771889503ULL, 1, {23, 15, 0x0}},
-    {12415867405053777498ULL, 1, {39, 30, 0x0}},
-    {12942050154810573329ULL, 2, {28, 37, 0x1}},
-    {7791169941863327658ULL, 2, {29, 36, 0x1}},
-    {2301175346920265746ULL, 1, {21, 6, 0x0}},
-    {8414277889752303266ULL, 1, {36, 52, 0x2}},
-    {9193475372648755844ULL, 1, {28, 12, 0x2}},
-    {4478018007766024322ULL, 1, {42, 57, 0x0}},
-    {1989117655144510564ULL, 1, {45, 53, 0x0}},
-    {10355716047744642808ULL, 1, {41, 49, 0x0}},
-    {9424034450171614538ULL, 1, {17, 9, 0x0}},
-    {11287811900801337488ULL, 1, {49, 58, 0x0}},
-    {1610852965559855646ULL, 1, {9, 2, 0x0}},
-    {5980161654158998280ULL, 1, {44, 52, 0x0}},
-    {3209144858891408054ULL, 2, {21, 13, 0x0}},
-    {8089330645101166612ULL, 2, {37, 53, 0x2}},
-    {17497397403863889460ULL, 1, {37, 28, 0x1}},
-    {17082887491275607890ULL, 1, {41, 49, 0x0}},
-    {6413787878872082660ULL, 1, {17, 9, 0x0}},
-    {15050372857523882776ULL, 1, {49, 58, 0x0}},
-    {9735890692923938283ULL, 1, {21, 6, 0x0}},
-    {4032557597801673769ULL, 1, {43, 51, 0x0}},
-    {6272433479420686511ULL, 1, {11, 1, 0x0}},
-    {7405017722019434049ULL, 1, {42, 57, 0x0}},
-    {14662569612601096289ULL, 1, {28, 12, 0x2}},
-    {11694865277775004387ULL, 1, {25, 61, 0x0}},
-    {11976457732637055966ULL, 1, {18, 1, 0x0}},
-    {16512601130551205774ULL, 1, {36, 42, 0x1}},
-    {15466766153504069948ULL, 2, {16, 8, 0x0}},
-    {16742758461460848673ULL, 1, {18, 25, 0x1}},
-    {14418722352261270110ULL, 1, {11, 2, 0x0}},
-    {1405119382871225453ULL, 1, {49, 58, 0x0}},
-    {13521105088988198766ULL, 1, {45, 31, 0x1}},
-    {7650275624245944858ULL, 1, {45, 52, 0x1}},
-    {5087855683859097311ULL, 1, {41, 49, 0x0}},
-    {10867419332723121473ULL, 2, {21, 6, 0x0}},
-    {583571228840306217ULL, 1, {26, 10, 0x2}},
-    {11660463260406253355ULL, 1, {47, 55, 0x0}},
-    {17680840167867293803ULL, 1, {17, 9, 0x0}},
-    {16161882633132060663ULL, 1, {41, 49, 0x0}},
-    {14714912053868396420ULL, 1, {36, 52, 0x2}},
-    {9919051515755670211ULL, 1, {36, 27, 0x1}},
-    {7689128544585739604ULL, 1, {36, 43, 0x1}},
-    {13571954511580679232ULL, 1, {21, 6, 0x0}},
-    {1940781237270161209ULL, 1, {29, 2, 0x0}},
-    {6080981157935106695ULL, 1, {10, 27, 0x1}},
-    {4421049698786829563ULL, 1, {18, 1, 0x0}},
-    {522685015029278593ULL, 1, {25, 61, 0x0}},
-    {5894677859421006814ULL, 1, {11, 2, 0x0}},
-    {9550172561083282399ULL, 1, {45, 62, 0x0}},
-    {16638172470952839858ULL, 1, {16, 8, 0x0}},
-    {16513302113304306523ULL, 1, {18, 25, 0x1}},
-    {6618985435219846823ULL, 1, {42, 57, 0x0}},
-    {687394209600746243ULL, 1, {21, 6, 0x0}},
-    {15084134750932415803ULL, 1, {35, 51, 0x2}},
-    {15910529589739571861ULL, 1, {35, 28, 0x1}},
-    {4195724694515504237ULL, 1, {35, 44, 0x1}},
-    {758624053701697952ULL, 1, {21, 6, 0x0}},
-    {8895660024578348683ULL, 1, {46, 54, 0x0}},
-    {11284174284759867902ULL, 1, {52, 62, 0x0}},
-    {11623975145125036579ULL, 1, {13, 4, 0x0}},
-    {2560096435412964792ULL, 1, {43, 51, 0x0}},
-    {8522667962060215183ULL, 2, {37, 53, 0x2}},
-    {16838175850833517876ULL, 2, {35, 27, 0x0}},
-    {4869726043432423108ULL, 2, {57, 42, 0x0}},
-    {5804136506510852873ULL, 1, {18, 1, 0x0}},
-    {13041893452658833925ULL, 1, {45, 62, 0x0}},
-    {18199251077287288567ULL, 2, {11, 21, 0x0}},
-    {15854298750020998491ULL, 2, {37, 53, 0x2}},
-    {9344943471978817094ULL, 1, {47, 55, 0x0}},
-    {17517123737796866621ULL, 1, {18, 1, 0x0}},
-    {4248084906580760007ULL, 1, {38, 54, 0x2}},
-    {16451047249412261588ULL, 1, {21, 36, 0x1}},
-    {6218083210109751075ULL, 1, {36, 28, 0x0}},
-    {10935952384765419100ULL, 1, {35, 45, 0x0}},
-    {1333444859624965869ULL, 1, {27, 11, 0x2}},
-    {2689691912540931290ULL, 1, {44, 52, 0x0}},
-    {16576340125263318608ULL, 2, {51, 57, 0x0}},
-    {10614944971890586443ULL, 1, {21, 6, 0x0}},
-    {3046593449084903202ULL, 1, {44, 52, 0x0}},
-    {5171627440783890126ULL, 1, {45, 62, 0x0}},
-    {17397682677203836705ULL, 1, {29, 13, 0x2}},
-    {17178858327780990062ULL, 2, {25, 61, 0x0}},
-    {1346590116790759398ULL, 1, {17, 9, 0x0}},
-    {11283067654365381020ULL, 1, {38, 54, 0x2}},
-    {13778814878623985577ULL, 1, {45, 53, 0x0}},
-    {5811248792171892345ULL, 1, {18, 1, 0x0}},
-    {396813605489828815ULL, 1, {36, 52, 0x2}},
-    {15990993257115141661ULL, 1, {9, 2, 0x0}},
-    {13887682881870634634ULL, 1, {28, 12, 0x2}},
-    {4239100726863246344ULL, 1, {42, 57, 0x0}},
-    {14814780719070473262ULL, 1, {19, 11, 0x0}},
-    {2750588459937958277ULL, 1, {42, 57, 0x0}},
-    {17146566594920179803ULL, 1, {29, 13, 0x2}},
-    {8636271746137479860ULL, 1, {41, 49, 0x0}},
-    {11332978746731708037ULL, 2, {37, 28, 0x1}},
-    {7976598564363224668ULL, 2, {37, 36, 0x1}},
-    {1908771061529858395ULL, 2, {28, 12, 0x2}},
-    {12719473498257292402ULL, 2, {57, 59, 0x40}},
-    {10625060565898749570ULL, 1, {44, 52, 0x0}},
-    {1317269159200877694ULL, 1, {44, 52, 0x0}},
-    {791381626753548550ULL, 1, {42, 57, 0x0}},
-    {16044626701759485250ULL, 1, {35, 27, 0x0}},
-    {16735286565176590703ULL, 1, {52, 42, 0x0}},
-    {3232472753245065220ULL, 1, {44, 52, 0x0}},
-    {14410682677787280767ULL, 1, {51, 58, 0x0}},
-    {17761317798730265785ULL, 3, {37, 53, 0x2}},
-    {13103975594287743230ULL, 2, {42, 33, 0x1}},
-    {11179529604321537606ULL, 2, {42, 49, 0x1}},
-    {16931334825703414252ULL, 2, {36, 28, 0x0}},
-    {11025748936900684007ULL, 2, {46, 60, 0x0}},
-    {2113519253081794761ULL, 2, {5, 4, 0x0}},
-    {13439713055492419205ULL, 2, {34, 42, 0x0}},
-    {1793414711660541410ULL, 1, {18, 1, 0x0}},
-    {15287777072116580244ULL, 1, {43, 51, 0x0}},
-    {5916808714158458136ULL, 1, {17, 9, 0x0}},
-    {3619221109915656561ULL, 1, {51, 58, 0x0}},
-    {15903139063618070715ULL, 1, {9, 2, 0x0}},
-    {1730068856936562750ULL, 1, {57, 59, 0x40}},
-    {2642573023987310214ULL, 1, {36, 52, 0x2}},
-    {6725932529588938716ULL, 1, {19, 11, 0x0}},
-    {4971551875701509993ULL, 1, {51, 58, 0x0}},
-    {9131774160553666360ULL, 1, {37, 53, 0x2}},
-    {10567234733280494159ULL, 1, {44, 52, 0x0}},
-    {4446765079099501783ULL, 1, {21, 13, 0x0}},
-    {5139188245605611898ULL, 1, {39, 55, 0x2}},
-    {15466321103651634401ULL, 1, {17, 9, 0x0}},
-    {13828307502774228326ULL, 1, {42, 57, 0x0}},
-    {7096014380736882542ULL, 1, {9, 2, 0x0}},
-    {4048679037753860083ULL, 1, {21, 6, 0x0}},
-    {1057229673205956292ULL, 1, {49, 58, 0x0}},
-    {1394858949426150041ULL, 1, {17, 9, 0x0}},
-    {9987456692984017204ULL, 1, {44, 52, 0x0}},
-    {12179337199820200523ULL, 1, {11, 1, 0x0}},
-    {3473638809193039417ULL, 1, {37, 53, 0x2}},
-    {14166941894700718919ULL, 1, {18, 1, 0x0}},
-    {18258640459667608914ULL, 1, {49, 58, 0x0}},
-    {16714896181140333145ULL, 1, {28, 12, 0x2}},
-    {1340376004459581717ULL, 1, {28, 37, 0x1}},
-    {2471150850997830812ULL, 2, {57, 59, 0x40}},
-    {12645103491281740275ULL, 2, {27, 35, 0x0}},
-    {7010280274666017626ULL, 2, {28, 18, 0x0}},
-    {9174644835637754614ULL, 1, {45, 62, 0x0}},
-    {2977727989287694999ULL, 2, {21, 13, 0x0}},
-    {5499673848538393555ULL, 2, {42, 57, 0x0}},
-    {901014402399362476ULL, 2, {28, 12, 0x2}},
-    {13046713384054187762ULL, 1, {36, 52, 0x2}},
-    {2011886514712278198ULL, 1, {38, 2, 0x0}},
-    {1170921552094379838ULL, 1, {28, 35, 0x1}},
-    {2349425162729810088ULL, 1, {51, 58, 0x0}},
-    {15349273696031743643ULL, 1, {18, 1, 0x0}},
-    {17550743015418581110ULL, 1, {53, 60, 0x0}},
-    {8612975541637325212ULL, 1, {9, 2, 0x0}},
-    {3533692878971540998ULL, 1, {43, 51, 0x0}},
-    {4747103221187686127ULL, 1, {12, 5, 0x0}},
-    {10691630341856229967ULL, 1, {25, 61, 0x0}},
-    {11092304562866076695ULL, 1, {29, 36, 0x1}},
-    {83189246799326210ULL, 1, {29, 13, 0x1}},
-    {640788960734773440ULL, 1, {42, 57, 0x0}},
-    {10025382352593648631ULL, 1, {40, 48, 0x0}},
-    {8856568216388786776ULL, 1, {25, 9, 0x2}},
-    {15288264753121107849ULL, 1, {52, 34, 0x0}},
-    {13046713384054187762ULL, 1, {28, 35, 0x1}},
-    {10839752716759571801ULL, 1, {35, 27, 0x0}},
-    {12311970516199281272ULL, 1, {36, 42, 0x0}},
-    {10364255661490601026ULL, 1, {44, 52, 0x0}},
-    {3365502576606950045ULL, 1, {28, 12, 0x2}},
-    {15958486340765317228ULL, 1, {28, 37, 0x1}},
-    {5042902563486555274ULL, 1, {47, 55, 0x0}},
-    {14103900687199990370ULL, 1, {29, 13, 0x2}},
-    {10836903598385050042ULL, 1, {44, 52, 0x0}},
-    {11437648012243475097ULL, 1, {28, 12, 0x2}},
-    {11621551871224213325ULL, 1, {28, 37, 0x1}},
-    {5162207186020208122ULL, 1, {49, 58, 0x0}},
-    {820529082993068353ULL, 1, {41, 51, 0x0}},
-    {9351802580645735486ULL, 1, {46, 54, 0x0}},
-    {16673458247004759612ULL, 2, {29, 13, 0x2}},
-    {3212568664656852983ULL, 2, {29, 36, 0x1}},
-    {10616802043192185757ULL, 1, {31, 4, 0x0}},
-    {1453574963415163835ULL, 1, {52, 42, 0x0}},
-    {13083585178836028171ULL, 1, {36, 52, 0x2}},
-    {13708866175572207571ULL, 1, {20, 12, 0x0}},
-    {8311415289912472750ULL, 1, {21, 6, 0x0}},
-    {14757279523269334431ULL, 1, {45, 53, 0x0}},
-    {4987700965284032707ULL, 1, {35, 51, 0x2}},
-    {15957899179843692126ULL, 1, {36, 28, 0x0}},
-    {9798786589454190752ULL, 1, {32, 42, 0x0}},
-    {17563019226101926097ULL, 2, {23, 6, 0x0}},
-    {13885904927166342412ULL, 1, {47, 55, 0x0}},
-    {17986255588715308102ULL, 1, {35, 51, 0x2}},
-    {281355017912882417ULL, 1, {35, 28, 0x1}},
-    {11060575574778517123ULL, 1, {25, 42, 0x0}},
-    {3339547473133742872ULL, 1, {18, 1, 0x0}},
-    {16848848731687310581ULL, 1, {37, 58, 0x0}},
-    {16024616944124003698ULL, 1, {19, 11, 0x0}},
-    {6867668573769693038ULL, 1, {45, 62, 0x0}},
-    {7752577716901560103ULL, 1, {30, 58, 0x0}},
-    {13194467217726121205ULL, 1, {35, 27, 0x0}},
-    {17664890956102248178ULL, 1, {37, 45, 0x0}},
-    {10604165298643732127ULL, 1, {37, 28, 0x1}},
-    {5399978934741583194ULL, 1, {39, 60, 0x0}},
-    {4757060319868035250ULL, 1, {21, 13, 0x0}},
-    {162634743927082389ULL, 1, {37, 39, 0x1}},
-    {5033179728697155138ULL, 2, {52, 62, 0x0}},
-    {5081574438969224558ULL, 1, {18, 1, 0x0}},
-    {3115350044990308470ULL, 1, {40, 48, 0x0}},
-    {998085577977561236ULL, 1, {26, 33, 0x0}},
-    {2300916937070186717ULL, 1, {33, 49, 0x2}},
-    {100237571413659426ULL, 1, {21, 13, 0x0}},
-    {343232177200119441ULL, 1, {44, 52, 0x0}},
-    {15040715628957455570ULL, 1, {25, 9, 0x2}},
-    {4606547290425265993ULL, 1, {49, 58, 0x0}},
-    {17229666207499210875ULL, 1, {9, 2, 0x0}},
-    {11894869616091585288ULL, 1, {45, 62, 0x0}},
-    {18093754722816179813ULL, 1, {20, 12, 0x0}},
-    {15970501872635838508ULL, 1, {44, 52, 0x0}},
-    {14783785900967398601ULL, 1, {27, 11, 0x2}},
-    {543697548228545768ULL, 1, {44, 52, 0x0}},
-    {3606366423567729436ULL, 1, {42, 57, 0x0}},
-    {7134377741015126520ULL, 1, {28, 12, 0x2}},
-    {14006263877705367687ULL, 1, {45, 62, 0x0}},
-    {4758988849336851150ULL, 1, {28, 12, 0x2}},
-    {15042356376484466624ULL, 1, {27, 36, 0x1}},
-    {2615527265235199523ULL, 1, {18, 4, 0x0}},
-    {822250722042066999ULL, 1, {41, 34, 0x0}},
-    {17920414189561426350ULL, 1, {27, 42, 0x1}},
-    {1414748001910292073ULL, 1, {32, 4, 0x0}},
-    {9924956994583157599ULL, 1, {44, 27, 0x0}},
-    {5962495208508805036ULL, 1, {22, 29, 0x0}},
-    {13970850360503204835ULL, 1, {51, 58, 0x0}},
-    {12545354567470915424ULL, 1, {42, 57, 0x0}},
-    {14314974115377921439ULL, 1, {42, 27, 0x1}},
-    {16946774953133501958ULL, 1, {42, 49, 0x1}},
-    {1684777482253352025ULL, 1, {37, 28, 0x1}},
-    {7818688175709038321ULL, 1, {47, 62, 0x0}},
-    {11452116550830569730ULL, 1, {28, 4, 0x0}},
-    {4019918435336351046ULL, 1, {39, 60, 0x0}},
-    {4046924203422095779ULL, 1, {21, 6, 0x0}},
-    {2767908610041916497ULL, 1, {37, 47, 0x1}},
-    {16338209616837166699ULL, 1, {12, 4, 0x0}},
-    {9349584150933916654ULL, 1, {51, 58, 0x0}},
-    {605550243213857586ULL, 4, {12, 6, 0x0}},
-    {12285988249352388630ULL, 2, {37, 53, 0x2}},
-    {17833014464258215917ULL, 2, {37, 28, 0x1}},
-    {16778713838391386943ULL, 1, {39, 60, 0x0}},
-    {323860299227218192ULL, 1, {21, 13, 0x0}},
-    {4635170777852911814ULL, 1, {37, 39, 0x1}},
-    {9176897335069304700ULL, 1, {22, 14, 0x0}},
-    {17193123311850793042ULL, 1, {44, 52, 0x0}},
-    {8475884336097519025ULL, 1, {19, 11, 0x0}},
-    {15323034413739400682ULL, 1, {35, 51, 0x2}},
-    {14641983572121392330ULL, 1, {38, 2, 0x0}},
-    {1743269486396206791ULL, 1, {45, 62, 0x0}},
-    {11269861284407551678ULL, 1, {21, 6, 0x0}},
-    {6798737564795840729ULL, 1, {42, 57, 0x0}},
-    {10616802043192185757ULL, 1, {23, 6, 0x0}},
-    {14719051656280279842ULL, 1, {49, 58, 0x0}},
-    {17851826671077016422ULL, 1, {44, 52, 0x0}},
-    {625736165310701802ULL, 1, {19, 11, 0x0}},
-    {10246545488374935870ULL, 1, {40, 48, 0x0}},
-    {2550683291353002075ULL, 1, {16, 8, 0x0}},
-    {14429045445089026046ULL, 1, {33, 49, 0x2}},
-    {6093706452326611260ULL, 1, {45, 53, 0x0}},
-    {1103925742333866619ULL, 1, {19, 5, 0x0}},
-    {18061316503614821639ULL, 1, {53, 60, 0x0}},
-    {12170501594698158657ULL, 1, {35, 51, 0x2}},
-    {2635775079343458626ULL, 1, {21, 6, 0x0}},
-    {15552103752660043172ULL, 1, {45, 62, 0x0}},
-    {7290140086683723472ULL, 2, {44, 52, 0x0}},
-    {1932338063335811591ULL, 2, {21, 13, 0x0}},
-    {12406801520763776024ULL, 2, {42, 57, 0x0}},
-    {2411697302306059610ULL, 1, {45, 62, 0x0}},
-    {9009397116333335656ULL, 1, {21, 6, 0x0}},
-    {1036574346454279426ULL, 1, {22, 14, 0x0}},
-    {8532407763523832106ULL, 1, {41, 49, 0x0}},
-    {4513661098016525085ULL, 1, {29, 13, 0x2}},
-    {15425642385338135756ULL, 1, {29, 38, 0x1}},
-    {8377718131709258103ULL, 1, {34, 61, 0x0}},
-    {2266248750301247751ULL, 1, {21, 6, 0x0}},
-    {13522183610137157541ULL, 1, {40, 48, 0x0}},
-    {4016517420244496215ULL, 1, {17, 9, 0x0}},
-    {7598862482576260778ULL, 1, {52, 62, 0x0}},
-    {4770231800961963911ULL, 1, {30, 14, 0x2}},
-    {17031411106409820498ULL, 1, {49, 58, 0x0}},
-    {8854390551592155458ULL, 1, {14, 5, 0x0}},
-    {17296226348537621014ULL, 1, {39, 55, 0x2}},
-    {9168209492786967085ULL, 1, {35, 27, 0x0}},
-    {5982474482549182572ULL, 1, {45, 62, 0x0}},
-    {10664283175428672640ULL, 1, {49, 58, 0x0}},
-    {7890823158783700341ULL, 1, {42, 57, 0x0}},
-    {13348692867155800469ULL, 1, {46, 54, 0x0}},
-    {12285988249352388630ULL, 1, {52, 62, 0x0}},
-    {11709257482297059495ULL, 1, {18, 1, 0x0}},
-    {12838176464009258617ULL, 1, {43, 51, 0x0}},
-    {13694800412571344209ULL, 1, {19, 11, 0x0}},
-    {16238978743849595694ULL, 1, {37, 53, 0x2}},
-    {2411697302306059610ULL, 1, {42, 57, 0x0}},
-    {5634848134482122172ULL, 1, {21, 6, 0x0}},
-    {14972613275860998787ULL, 1, {44, 52, 0x0}},
-    {39708040608214743ULL, 1, {52, 62, 0x0}},
-    {7352815876482950210ULL, 1, {37, 53, 0x2}},
-    {4014187189509302547ULL, 1, {41, 49, 0x0}},
-    {8588073099267185681ULL, 1, {14, 5, 0x0}},
-    {17393542962966078266ULL, 1, {42, 57, 0x0}},
-    {8162407103885109136ULL, 1, {51, 30, 0x0}},
-    {3725108069298277479ULL, 1, {57, 59, 0x40}},
-    {9054033535219127931ULL, 1, {19, 11, 0x0}},
-    {5226700649956597150ULL, 1, {30, 58, 0x0}},
-    {16744290235474083177ULL, 1, {11, 1, 0x0}},
-    {2620305130306227513ULL, 1, {57, 59, 0x40}},
-    {14838341121397982214ULL, 1, {52, 62, 0x0}},
-    {16208295745117243424ULL, 1, {45, 62, 0x0}},
-    {2918906726564822926ULL, 1, {38, 54, 0x2}},
-    {15042907740151897088ULL, 1, {27, 11, 0x2}},
-    {3197367276469563849ULL, 1, {35, 51, 0x2}},
-    {16384781760165550587ULL, 1, {11, 1, 0x0}},
-    {1007163775921767157ULL, 1, {37, 53, 0x2}},
-    {4813035277464219313ULL, 1, {20, 12, 0x0}},
-    {15769421243249667203ULL, 1, {45, 62, 0x0}},
-    {1901106070116560627ULL, 1, {37, 53, 0x2}},
-    {12170803228958036792ULL, 1, {36, 29, 0x1}},
-    {4602478127674450049ULL, 1, {36, 60, 0x1}},
-    {11189629478988510620ULL, 1, {18, 1, 0x0}},
-    {4982999164732450051ULL, 1, {28, 37, 0x1}},
-    {8702407345901263353ULL, 1, {21, 6, 0x0}},
-    {8063630637541234414ULL, 1, {39, 36, 0x0}},
-    {6005901262839606125ULL, 2, {47, 55, 0x0}},
-    {5658798092240929581ULL, 1, {57, 59, 0x40}},
-    {7151533816882094737ULL, 1, {16, 8, 0x0}},
-    {8550191678227079581ULL, 1, {51, 58, 0x0}},
-    {12289416094396696866ULL, 1, {36, 52, 0x2}},
-    {12412657803222043206ULL, 1, {9, 2, 0x0}},
-    {14824081911839906707ULL, 1, {28, 12, 0x2}},
-    {4738827044696602065ULL, 1, {28, 37, 0x1}},
-    {8145848156428982443ULL, 1, {28, 18, 0x1}},
-    {265016303678952017ULL, 1, {49, 58, 0x0}},
-    {15806064578058778728ULL, 1, {17, 9, 0x0}},
-    {777582335856594137ULL, 1, {43, 51, 0x0}},
-    {10110280200755823749ULL, 1, {9, 2, 0x0}},
-    {7158642479030588423ULL, 1, {42, 57, 0x0}},
-    {16470920449103612852ULL, 1, {16, 8, 0x0}},
-    {14660863582033825102ULL, 1, {32, 25, 0x0}},
-    {16856978025533890793ULL, 1, {51, 58, 0x0}},
-    {4273100315704762935ULL, 1, {49, 58, 0x0}},
-    {10289342357699508150ULL, 1, {37, 53, 0x2}},
-    {5932046571378890575ULL, 1, {9, 2, 0x0}},
-    {15625356518698429226ULL, 1, {45, 62, 0x0}},
-    {15383242433690783130ULL, 1, {29, 13, 0x2}},
-    {2289433994606615773ULL, 1, {33, 49, 0x2}},
-    {5110305330130480705ULL, 1, {20, 12, 0x0}},
-    {1904045194613820949ULL, 1, {40, 48, 0x0}},
-    {13885904927166342412ULL, 1, {27, 35, 0x0}},
-    {857280651899350990ULL, 1, {43, 51, 0x0}},
-    {913469295362187160ULL, 1, {28, 12, 0x2}},
-    {5754448045919625811ULL, 1, {54, 61, 0x0}},
-    {6344071928342153599ULL, 1, {43, 51, 0x0}},
-    {265221686384261250ULL, 1, {44, 52, 0x0}},
-    {14720379952751003434ULL, 1, {1, 3, 0x40}},
-    {3298084789424837305ULL, 1, {51, 58, 0x0}},
-    {3036975654517428387ULL, 1, {18, 28, 0x0}},
-    {5900995483915836396ULL, 1, {30, 58, 0x0}},
-    {16467085625833133415ULL, 1, {28, 12, 0x2}},
-    {12589164932992315964ULL, 1, {28, 37, 0x1}},
-    {5739880578589168217ULL, 1, {37, 53, 0x2}},
-    {11644183791189424220ULL, 1, {36, 52, 0x2}},
-    {2093600658088600321ULL, 1, {47, 55, 0x0}},
-    {17086738202479737193ULL, 1, {21, 6, 0x0}},
-    {18203791206909501250ULL, 1, {36, 52, 0x2}},
-    {9136325523679480101ULL, 1, {36, 29, 0x1}},
-    {7658027954769996250ULL, 1, {36, 52, 0x2}},
-    {2098410748814205264ULL, 1, {36, 29, 0x1}},
-    {14521847278016548562ULL, 1, {42, 57, 0x0}},
-    {11077166674686471019ULL, 1, {21, 6, 0x0}},
-    {4027660973630416044ULL, 1, {36, 42, 0x1}},
-    {8184068324624961008ULL, 1, {11, 4, 0x0}},
-    {16796877881896341609ULL, 1, {51, 60, 0x0}},
-    {11970921325575796007ULL, 1, {21, 13, 0x0}},
-    {567261592823134366ULL, 1, {46, 54, 0x0}},
-    {1318184152444028073ULL, 1, {21, 13, 0x0}},
-    {17772974021590953202ULL, 1, {35, 51, 0x2}},
-    {14830014135872996429ULL, 1, {28, 12, 0x2}},
-    {101982889262933796ULL, 1, {28, 35, 0x1}},
-    {7635435082703527331ULL, 1, {28, 21, 0x1}},
-    {537712257431700094ULL, 1, {36, 52, 0x2}},
-    {1689501871275480901ULL, 1, {21, 6, 0x0}},
-    {17848420598769485460ULL, 1, {45, 53, 0x0}},
-    {5968094954592620232ULL, 1, {26, 5, 0x0}},
-    {13780194952797797348ULL, 1, {44, 58, 0x0}},
-    {568641686053123874ULL, 1, {21, 6, 0x0}},
-    {1573420170982959357ULL, 1, {30, 58, 0x0}},
-    {2487747288420277583ULL, 1, {13, 4, 0x0}},
-    {4396900569471152008ULL, 1, {54, 61, 0x0}},
-    {5952241067106006149ULL, 1, {23, 15, 0x0}},
-    {6554177081254610256ULL, 1, {21, 30, 0x1}},
-    {12721892020941828192ULL, 2, {34, 61, 0x0}},
-    {18367023779342783803ULL, 2, {14, 5, 0x0}},
-    {9727702507890721162ULL, 1, {20, 12, 0x0}},
-    {11277006107114141934ULL, 1, {40, 48, 0x0}},
-    {6693927444457773195ULL, 1, {12, 6, 0x0}},
-    {8728015458749989668ULL, 1, {42, 57, 0x0}},
-    {16500151240613196743ULL, 1, {17, 9, 0x0}},
-    {9777859573635561469ULL, 1, {41, 49, 0x0}},
-    {15055795237418400898ULL, 1, {9, 2, 0x0}},
-    {12258938014540838864ULL, 1, {49, 58, 0x0}},
-    {8630319734841893252ULL, 1, {20, 12, 0x0}},
-    {12924945509355531092ULL, 1, {44, 52, 0x0}},
-    {10870327730388063012ULL, 1, {25, 61, 0x0}},
-    {16742758461460848673ULL, 1, {32, 25, 0x0}},
-    {14627525796001050548ULL, 1, {41, 49, 0x0}},
-    {6977521205321468913ULL, 1, {18, 1, 0x0}},
-    {13407716090059049970ULL, 1, {49, 58, 0x0}},
-    {13228234276238145363ULL, 1, {29, 13, 0x2}},
-    {471672447676455080ULL, 1, {44, 52, 0x0}},
-    {12285988249352388630ULL, 1, {45, 53, 0x0}},
-    {4647048734785597148ULL, 1, {19, 11, 0x0}},
-    {8268137948316028728ULL, 1, {46, 60, 0x0}},
-    {15264982431224369264ULL, 1, {20, 2, 0x0}},
-    {9635145640716228590ULL, 1, {25, 61, 0x0}},
-    {13448610030005351832ULL, 1, {36, 52, 0x2}},
-    {1393511017668804963ULL, 1, {18, 1, 0x0}},
-    {18401970026704119080ULL, 1, {44, 58, 0x0}},
-    {11676484541956161640ULL, 1, {30, 58, 0x0}},
-    {15904034959124157414ULL, 1, {11, 1, 0x0}},
-    {7910978060492596682ULL, 1, {36, 52, 0x2}},
-    {1748283900397453389ULL, 1, {36, 52, 0x2}},
-    {10255980655205209990ULL, 1, {57, 59, 0x40}},
-    {12654574471691468832ULL, 1, {21, 6, 0x0}},
-    {12626511129311814245ULL, 1, {44, 52, 0x0}},
-    {16778713838391386943ULL, 1, {43, 51, 0x0}},
-    {8687986679435163630ULL, 1, {27, 11, 0x2}},
-    {7703475811722260879ULL, 1, {40, 48, 0x0}},
-    {13103975594287743230ULL, 1, {21, 6, 0x0}},
-    {9259936705239753165ULL, 1, {28, 37, 0x1}},
-    {10305955842787404696ULL, 1, {28, 4, 0x1}},
-    {12460291894695522988ULL, 1, {45, 62, 0x0}},
-    {7819005799692817203ULL, 1, {24, 28, 0x0}},
-    {15991670957458639058ULL, 1, {43, 51, 0x0}},
-    {8148536751621930796ULL, 1, {43, 51, 0x0}},
-    {15751813382882133113ULL, 1, {36, 21, 0x1}},
-    {5913552815726747421ULL, 1, {36, 43, 0x1}},
-    {8880538114463373688ULL, 1, {39, 30, 0x0}},
-    {4317872089520272464ULL, 1, {18, 1, 0x0}},
-    {9262579152981334469ULL, 1, {37, 53, 0x2}},
-    {6257337012647299978ULL, 1, {28, 12, 0x2}},
-    {13317439597603421731ULL, 1, {42, 57, 0x0}},
-    {15512160511713008513ULL, 1, {45, 62, 0x0}},
-    {2848727678882463807ULL, 2, {45, 62, 0x0}},
-    {16868496994491747704ULL, 1, {28, 12, 0x2}},
-    {1234161236451977705ULL, 1, {43, 51, 0x0}},
-    {3528828767237227363ULL, 1, {17, 9, 0x0}},
-    {170239141837889485ULL, 1, {30, 37, 0x1}},
-    {4397516755116033015ULL, 1, {23, 15, 0x0}},
-    {3845873487874787552ULL, 1, {22, 30, 0x0}},
-    {3180140306449991979ULL, 1, {35, 51, 0x2}},
-    {11963889636142932549ULL, 1, {17, 9, 0x0}},
-    {7450564160707493255ULL, 1, {51, 58, 0x0}},
-    {10559193035749965307ULL, 1, {9, 2, 0x0}},
-    {1779322786717772449ULL, 1, {34, 50, 0x2}},
-    {1717228968407346697ULL, 1, {28, 12, 0x2}},
-    {11854555866955845593ULL, 1, {42, 57, 0x0}},
-    {8320317449139256874ULL, 2, {16, 8, 0x0}},
-    {7228303785366148699ULL, 2, {32, 25, 0x0}},
-    {8880538114463373688ULL, 1, {37, 53, 0x2}},
-    {4278633864291768199ULL, 1, {38, 21, 0x0}},
-    {15402542490058345349ULL, 1, {45, 62, 0x0}},
-    {4412056625411621233ULL, 1, {44, 38, 0x0}},
-    {8684355943912874712ULL, 1, {58, 59, 0x0}},
-    {10599662912583544571ULL, 2, {31, 4, 0x0}},
-    {12742181459100440101ULL, 2, {52, 62, 0x0}},
-    {5704785486228255402ULL, 3, {29, 36, 0x1}},
-    {5356172736216213452ULL, 3, {29, 2, 0x1}},
-    {1157525919295043061ULL, 3, {47, 55, 0x0}},
-    {2186601588352686345ULL, 1, {19, 11, 0x0}},
-    {862114277394223689ULL, 1, {37, 53, 0x2}},
-    {1848827282326176095ULL, 2, {33, 5, 0x0}},
-    {2796280262426834101ULL, 1, {42, 57, 0x0}},
-    {672891751845276267ULL, 1, {31, 15, 0x2}},
-    {16051494761636724006ULL, 1, {44, 52, 0x0}},
-    {11241367456505373593ULL, 1, {29, 13, 0x2}},
-    {10427870678268969328ULL, 1, {36, 52, 0x2}},
-    {5077746695879041030ULL, 1, {45, 62, 0x0}},
-    {6734620648696787945ULL, 1, {22, 14, 0x0}},
-    {2718855981710391707ULL, 1, {49, 58, 0x0}},
-    {3491502442880202193ULL, 1, {47, 62, 0x0}},
-    {3293031995871834272ULL, 1, {12, 6, 0x0}},
-    {5173400514963383163ULL, 1, {44, 58, 0x0}},
-    {15040715628957455570ULL, 1, {18, 1, 0x0}},
-    {14729862132680739260ULL, 1, {49, 58, 0x0}},
-    {642893056931169229ULL, 1, {17, 9, 0x0}},
-    {16769940570881657008ULL, 2, {49, 58, 0x0}},
-    {447141404647627765ULL, 1, {43, 51, 0x0}},
-    {13597165472777856074ULL, 1, {42, 57, 0x0}},
-    {18343134245708614916ULL, 1, {35, 18, 0x0}},
-    {14102266913921608229ULL, 1, {45, 62, 0x0}},
-    {5621189709276204188ULL, 1, {22, 14, 0x0}},
-    {13815439749068769794ULL, 1, {54, 61, 0x0}},
-    {2257090688863118597ULL, 1, {28, 12, 0x2}},
-    {1528373090159759611ULL, 1, {44, 30, 0x0}},
-    {18097649239267738950ULL, 1, {28, 12, 0x2}},
-    {13499959356336054370ULL, 1, {43, 51, 0x0}},
-    {6884134526358793659ULL, 1, {33, 5, 0x0}},
-    {13487539935106092573ULL, 1, {37, 53, 0x2}},
-    {4626338968704802534ULL, 1, {36, 28, 0x0}},
-    {16089065205237898204ULL, 1, {39, 60, 0x0}},
-    {18346640659412894586ULL, 1, {27, 42, 0x0}},
-    {4655829470863877910ULL, 1, {53, 60, 0x0}},
-    {1060592068099110234ULL, 1, {45, 62, 0x0}},
-    {17343768162173374433ULL, 2, {43, 51, 0x0}},
-    {2769349522364596657ULL, 1, {26, 5, 0x0}},
-    {15843677581990472542ULL, 1, {42, 57, 0x0}},
-    {16076012578906554498ULL, 1, {29, 13, 0x2}},
-    {3014933705920257963ULL, 1, {49, 58, 0x0}},
-    {177579987036537401ULL, 1, {21, 6, 0x0}},
-    {17392497401996612697ULL, 1, {37, 53, 0x2}},
-    {11140054374450687746ULL, 1, {19, 11, 0x0}},
-    {12307818224246984118ULL, 1, {51, 58, 0x0}},
-    {3828013514560793586ULL, 1, {45, 62, 0x0}},
-    {2977727989287694999ULL, 1, {17, 9, 0x0}},
-    {6252022520114601050ULL, 1, {42, 57, 0x0}},
-    {18078478844053830260ULL, 1, {20, 12, 0x0}},
-    {14820519378191008295ULL, 1, {41, 49, 0x0}},
-    {7628436369218723477ULL, 1, {9, 2, 0x0}},
-    {12512053100186213943ULL, 1, {49, 58, 0x0}},
-    {3546025453032040871ULL, 1, {21, 6, 0x0}},
-    {15294123370353601410ULL, 2, {45, 53, 0x0}},
-    {10351403748523574585ULL, 1, {18, 1, 0x0}},
-    {16792392205774385321ULL, 1, {44, 52, 0x0}},
-    {11142467033247927999ULL, 1, {36, 52, 0x2}},
-    {12005665418405201502ULL, 1, {36, 29, 0x1}},
-    {529642544015009068ULL, 1, {36, 42, 0x1}},
-    {9727702507890721162ULL, 1, {17, 9, 0x0}},
-    {12823157554281570712ULL, 1, {40, 48, 0x0}},
-    {4761742658635847488ULL, 1, {20, 12, 0x0}},
-    {15270453753229027748ULL, 1, {42, 57, 0x0}},
-    {5253188121204829967ULL, 2, {40, 48, 0x0}},
-    {17497397403863889460ULL, 1, {19, 11, 0x0}},
-    {2239512097061721391ULL, 1, {43, 51, 0x0}},
-    {12267247003887369147ULL, 1, {52, 62, 0x0}},
-    {13549391744590295184ULL, 1, {12, 6, 0x0}},
-    {18245494263147143151ULL, 1, {45, 53, 0x0}},
-    {14452726620559641518ULL, 1, {37, 58, 0x0}},
-    {16868496994491747704ULL, 1, {20, 12, 0x0}},
-    {14804006501146087607ULL, 1, {35, 51, 0x2}},
-    {400219203320727273ULL, 1, {40, 48, 0x0}},
-    {14418722352261270110ULL, 1, {16, 8, 0x0}},
-    {8704711894625106225ULL, 1, {43, 51, 0x0}},
-    {1137187048104417131ULL, 1, {29, 13, 0x2}},
-    {3983138432817059200ULL, 1, {21, 6, 0x0}},
-    {4398553085975193106ULL, 1, {43, 51, 0x0}},
-    {623728077795383351ULL, 1, {19, 11, 0x0}},
-    {12371414959776943851ULL, 1, {42, 57, 0x0}},
-    {12539722680070887462ULL, 1, {41, 49, 0x0}},
-    {2001787312012367981ULL, 1, {28, 12, 0x2}},
-    {15186577159550313396ULL, 1, {49, 58, 0x0}},
-    {333617220323924000ULL, 1, {20, 2, 0x0}},
-    {9434333338229119324ULL, 1, {44, 52, 0x0}},
-    {728197801297986388ULL, 1, {1, 3, 0x40}},
-    {14889450273862703859ULL, 1, {42, 57, 0x0}},
-    {13979787711670303538ULL, 1, {45, 62, 0x0}},
-    {9917889939949577096ULL, 1, {22, 4, 0x0}},
-    {7616954055325226536ULL, 1, {41, 49, 0x0}},
-    {11992769739004327548ULL, 1, {18, 1, 0x0}},
-    {3474679215659661038ULL, 1, {49, 58, 0x0}},
-    {17950980260751052398ULL, 1, {28, 4, 0x1}},
-    {8402483572974599129ULL, 1, {28, 60, 0x1}},
-    {5804136506510852873ULL, 1, {28, 12, 0x2}},
-    {5521809617117088641ULL, 1, {28, 37, 0x1}},
-    {7041538582330705298ULL, 1, {22, 4, 0x0}},
-    {2357989876182534438ULL, 1, {18, 1, 0x0}},
-    {5266730490741287587ULL, 1, {27, 35, 0x0}},
-    {1606170700876046612ULL, 1, {45, 53, 0x0}},
-    {13439581432322925387ULL, 1, {21, 6, 0x0}},
-    {11096263494011468360ULL, 1, {35, 51, 0x2}},
-    {10731432818401490417ULL, 1, {36, 28, 0x0}},
-    {271757610958949087ULL, 1, {32, 48, 0x2}},
-    {2242200468607670578ULL, 1, {21, 13, 0x0}},
-    {364320063322903359ULL, 1, {47, 55, 0x0}},
-    {12292065916342516581ULL, 1, {42, 57, 0x0}},
-    {2812344339552456972ULL, 1, {33, 5, 0x0}},
-    {3147469747617919151ULL, 1, {28, 37, 0x1}},
-    {4286387923052900783ULL, 1, {28, 45, 0x0}},
-    {16568695407135634231ULL, 1, {28, 18, 0x1}},
-    {941795949107039717ULL, 1, {28, 35, 0x1}},
-    {1402221783907692117ULL, 1, {1, 3, 0x40}},
-    {2757588292824142729ULL, 1, {37, 58, 0x0}},
-    {16483465824228383641ULL, 1, {32, 42, 0x0}},
-    {6318803886637435247ULL, 1, {45, 62, 0x0}},
-    {11852355311902834536ULL, 1, {21, 6, 0x0}},
-    {16800596429760964118ULL, 1, {42, 57, 0x0}},
-    {15367114905051249174ULL, 1, {29, 13, 0x2}},
-    {16122756089936506516ULL, 1, {29, 36, 0x1}},
-    {9881217482077102354ULL, 1, {31, 4, 0x0}},
-    {4146891116569759794ULL, 1, {47, 55, 0x0}},
-    {13781081093259822025ULL, 1, {29, 31, 0x1}},
-    {11572880851018428606ULL, 1, {38, 54, 0x2}},
-    {7953550802410598424ULL, 1, {34, 61, 0x0}},
-    {16485997008729725944ULL, 1, {33, 5, 0x0}},
-    {101280502669386097ULL, 1, {36, 52, 0x2}},
-    {5345365394122846388ULL, 1, {34, 61, 0x0}},
-    {9711748395756806951ULL, 1, {18, 1, 0x0}},
-    {16124679052965644032ULL, 1, {16, 8, 0x0}},
-    {17146409829735757289ULL, 1, {18, 25, 0x1}},
-    {17356624092169913147ULL, 1, {18, 9, 0x1}},
-    {9920953626898096909ULL, 1, {42, 57, 0x0}},
-    {2821965866017399831ULL, 1, {12, 6, 0x1}},
-    {10213499708642959782ULL, 1, {44, 52, 0x0}},
-    {11817416701206178060ULL, 1, {37, 53, 0x2}},
-    {2678608122075465559ULL, 1, {38, 2, 0x0}},
-    {4948679547013045421ULL, 1, {39, 60, 0x0}},
-    {18276373860265583901ULL, 1, {21, 6, 0x0}},
-    {17624360114268537659ULL, 1, {44, 52, 0x0}},
-    {10614944971890586443ULL, 1, {21, 13, 0x0}},
-    {8920481828534561029ULL, 1, {41, 49, 0x0}},
-    {16100126992278844633ULL, 1, {37, 53, 0x2}},
-    {2887115534459666234ULL, 1, {21, 6, 0x0}},
-    {16649125457178183508ULL, 1, {42, 57, 0x0}},
-    {12943328154826809346ULL, 1, {31, 4, 0x0}},
-    {15136999190508813045ULL, 1, {29, 13, 0x2}},
-    {6816503978913380475ULL, 1, {29, 36, 0x1}},
-    {624465518644386062ULL, 1, {18, 1, 0x0}},
-    {1031239070906464819ULL, 1, {42, 57, 0x0}},
-    {14765216596881052415ULL, 1, {28, 12, 0x2}},
-    {13991562868505081203ULL, 1, {45, 53, 0x0}},
-    {7246458098420752933ULL, 1, {20, 12, 0x0}},
-    {16716312524870937345ULL, 1, {30, 58, 0x0}},
-    {5081574438969224558ULL, 1, {29, 13, 0x2}},
-    {15144069441444492452ULL, 1, {43, 51, 0x0}},
-    {217905742734033373ULL, 1, {21, 6, 0x0}},
-    {15019436083464122348ULL, 1, {30, 58, 0x0}},
-    {17693275005444399663ULL, 1, {34, 50, 0x2}},
-    {1694407727868121980ULL, 1, {17, 9, 0x0}},
-    {2903683551351501155ULL, 1, {57, 59, 0x40}},
-    {5712043622602678329ULL, 1, {29, 2, 0x0}},
-    {10351403748523574585ULL, 1, {33, 5, 0x0}},
-    {1651847224208382006ULL, 1, {40, 48, 0x0}},
-    {6742497247546110933ULL, 1, {19, 11, 0x0}},
-    {17460674825607768299ULL, 1, {36, 29, 0x1}},
-    {15176747765653098988ULL, 1, {34, 50, 0x2}},
-    {18351007843834764778ULL, 1, {28, 12, 0x2}},
-    {13463743400055512008ULL, 1, {42, 57, 0x0}},
-    {17130578250547307224ULL, 1, {18, 1, 0x0}},
-    {16965590171753796382ULL, 1, {38, 2, 0x0}},
-    {5463682016699286339ULL, 1, {42, 57, 0x0}},
-    {4171915001494897321ULL, 1, {45, 38, 0x1}},
-    {15250365695140994042ULL, 1, {45, 54, 0x1}},
-    {9174644835637754614ULL, 1, {57, 59, 0x40}},
-    {3464089669568491538ULL, 1, {52, 62, 0x0}},
-    {11924507355199851913ULL, 1, {31, 4, 0x0}},
-    {9344943471978817094ULL, 1, {45, 53, 0x0}},
-    {4325608445361446019ULL, 1, {18, 1, 0x0}},
-    {12065362780742202189ULL, 1, {38, 54, 0x2}},
-    {8248464237858819965ULL, 1, {38, 54, 0x2}},
-    {2657755876041350308ULL, 1, {37, 53, 0x2}},
-    {8050618659330609886ULL, 1, {9, 2, 0x0}},
-    {3389167733367218699ULL, 1, {57, 59, 0x40}}
+    {1585947895491903ULL, 1, MOVE(43, 36, 0x4)},
+    {5578678075345439ULL, 1, MOVE(3, 1, 0x2)},
+    {6628171448697696ULL, 1, MOVE(62, 45, 0x0)},
+    {7228972487165871ULL, 2, MOVE(28, 36, 0x0)},
+    {12741807527158836ULL, 3, MOVE(37, 28, 0x4)},
+    {21474796097054202ULL, 1, MOVE(2, 9, 0x0)},
+    {22949613504539651ULL, 1, MOVE(58, 51, 0x0)},
+    {25380838153886694ULL, 7, MOVE(61, 54, 0x0)},
+    {25380838153886694ULL, 4, MOVE(48, 40, 0x0)},
+    {27043506714000571ULL, 2, MOVE(48, 40, 0x0)},
+    {37537453654022859ULL, 1, MOVE(54, 46, 0x0)},
+    {39708040608214743ULL, 5, MOVE(36, 29, 0x4)},
+    {39708040608214743ULL, 1, MOVE(62, 52, 0x0)},
+    {42473966088310528ULL, 4, MOVE(36, 29, 0x4)},
+    {42473966088310528ULL, 2, MOVE(57, 42, 0x0)},
+    {47267072779911495ULL, 1, MOVE(51, 43, 0x0)},
+    {49144678776494453ULL, 6, MOVE(51, 43, 0x0)},
+    {49523499739340863ULL, 1, MOVE(61, 54, 0x0)},
+    {50795556832634171ULL, 5, MOVE(42, 36, 0x4)},
+    {53835828157541918ULL, 1, MOVE(6, 21, 0x0)},
+    {53835828157541918ULL, 1, MOVE(9, 17, 0x0)},
+    {53917537757537769ULL, 39, MOVE(52, 36, 0x1)},
+    {53917537757537769ULL, 16, MOVE(58, 30, 0x0)},
+    {53917537757537769ULL, 11, MOVE(45, 28, 0x0)},
+    {53917537757537769ULL, 3, MOVE(58, 37, 0x0)},
+    {53917537757537769ULL, 3, MOVE(49, 41, 0x0)},
+    {58486561438437637ULL, 1, MOVE(36, 27, 0x4)},
+    {60137894477488568ULL, 1, MOVE(60, 42, 0x4)},
+    {63822392791026881ULL, 1, MOVE(1, 18, 0x0)},
+    {64945020755144558ULL, 1, MOVE(18, 35, 0x4)},
+    {67901588516764164ULL, 1, MOVE(2, 20, 0x0)},
+    {68145160730046556ULL, 2, MOVE(58, 49, 0x0)},
+    {68195655605713027ULL, 2, MOVE(11, 19, 0x0)},
+    {74772303924730139ULL, 5, MOVE(37, 28, 0x4)},
+    {76179935231401896ULL, 1, MOVE(54, 38, 0x1)},
+    {83189246799326210ULL, 1, MOVE(13, 29, 0x4)},
+    {85493357249464115ULL, 1, MOVE(61, 34, 0x0)},
+    {86674974960701987ULL, 1, MOVE(5, 14, 0x0)},
+    {93017998138498356ULL, 1, MOVE(11, 19, 0x0)},
+    {97357755900603218ULL, 17, MOVE(54, 38, 0x1)},
+    {97357755900603218ULL, 7, MOVE(49, 41, 0x0)},
+    {97357755900603218ULL, 5, MOVE(51, 35, 0x1)},
+    {97357755900603218ULL, 4, MOVE(51, 43, 0x0)},
+    {100237571413659426ULL, 1, MOVE(6, 21, 0x0)},
+    {100237571413659426ULL, 1, MOVE(13, 21, 0x0)},
+    {101280502669386097ULL, 1, MOVE(52, 36, 0x1)},
+    {101982889262933796ULL, 1, MOVE(35, 28, 0x4)},
+    {103316315860200750ULL, 1, MOVE(62, 45, 0x0)},
+    {106046548944541306ULL, 4, MOVE(2, 38, 0x0)},
+    {106178352613734151ULL, 1, MOVE(45, 36, 0x4)},
+    {107126674516514419ULL, 1, MOVE(61, 54, 0x0)},
+    {110649379935606559ULL, 1, MOVE(62, 45, 0x0)},
+    {115560444758234360ULL, 1, MOVE(1, 18, 0x0)},
+    {118460447067625493ULL, 1, MOVE(2, 9, 0x0)},
+    {121128135302914303ULL, 18, MOVE(2, 9, 0x0)},
+    {125064100473717949ULL, 1, MOVE(11, 27, 0x1)},
+    {126397796215575843ULL, 2, MOVE(2, 9, 0x0)},
+    {128809315150337675ULL, 1, MOVE(11, 19, 0x0)},
+    {133458314977683586ULL, 3, MOVE(52, 36, 0x1)},
+    {135000284066593612ULL, 1, MOVE(54, 38, 0x1)},
+    {143866687859111499ULL, 1, MOVE(12, 28, 0x1)},
+    {143866687859111499ULL, 1, MOVE(11, 19, 0x0)},
+    {145395755030321996ULL, 1, MOVE(11, 27, 0x1)},
+    {146406810737878701ULL, 1, MOVE(29, 22, 0x0)},
+    {151946528421529008ULL, 1, MOVE(6, 12, 0x0)},
+    {154804992783304073ULL, 10, MOVE(60, 46, 0x0)},
+    {155198839316167457ULL, 1, MOVE(6, 21, 0x0)},
+    {155359140753283504ULL, 3, MOVE(61, 54, 0x0)},
+    {156452330672155319ULL, 1, MOVE(61, 52, 0x0)},
+    {157066283693133558ULL, 1, MOVE(18, 27, 0x4)},
+    {160028484850521845ULL, 2, MOVE(11, 27, 0x1)},
+    {162634743927082389ULL, 1, MOVE(39, 37, 0x4)},
+    {166791874754328764ULL, 6, MOVE(36, 29, 0x4)},
+    {166791874754328764ULL, 3, MOVE(51, 43, 0x0)},
+    {169171433229631623ULL, 9, MOVE(11, 19, 0x0)},
+    {169171433229631623ULL, 4, MOVE(9, 17, 0x0)},
+    {169171433229631623ULL, 2, MOVE(12, 28, 0x1)},
+    {170239141837889485ULL, 1, MOVE(37, 30, 0x4)},
+    {176861427982192260ULL, 3, MOVE(12, 28, 0x1)},
+    {176861427982192260ULL, 1, MOVE(1, 18, 0x0)},
+    {177579987036537401ULL, 4, MOVE(3, 1, 0x2)},
+    {177579987036537401ULL, 2, MOVE(12, 28, 0x1)},
+    {177579987036537401ULL, 1, MOVE(6, 21, 0x0)},
+    {188692947242122750ULL, 20, MOVE(57, 42, 0x0)},
+    {188692947242122750ULL, 9, MOVE(58, 51, 0x0)},
+    {188692947242122750ULL, 3, MOVE(53, 45, 0x0)},
+    {188692947242122750ULL, 2, MOVE(58, 30, 0x0)},
+    {188692947242122750ULL, 2, MOVE(53, 37, 0x1)},
+    {191698237389264788ULL, 1, MOVE(18, 35, 0x4)},
+    {193644954832032558ULL, 11, MOVE(28, 18, 0x4)},
+    {195601555188867222ULL, 1, MOVE(12, 28, 0x1)},
+    {196176948054795775ULL, 2, MOVE(54, 46, 0x0)},
+    {196176948054795775ULL, 2, MOVE(37, 28, 0x4)},
+    {196176948054795775ULL, 1, MOVE(62, 45, 0x0)},
+    {197761400610507475ULL, 1, MOVE(3, 1, 0x2)},
+    {199510913874117899ULL, 6, MOVE(59, 57, 0x2)},
+    {199510913874117899ULL, 3, MOVE(54, 38, 0x1)},
+    {199510913874117899ULL, 1, MOVE(30, 21, 0x4)},
+    {201108877736929591ULL, 2, MOVE(51, 43, 0x0)},
+    {202657220425937066ULL, 1, MOVE(2, 29, 0x4)},
+    {204286754603129889ULL, 2, MOVE(52, 44, 0x0)},
+    {206250348325931428ULL, 1, MOVE(48, 40, 0x0)},
+    {207893198937303978ULL, 2, MOVE(9, 17, 0x0)},
+    {212672941293507424ULL, 1, MOVE(58, 30, 0x0)},
+    {214722758561365591ULL, 1, MOVE(1, 18, 0x0)},
+    {217905742734033373ULL, 1, MOVE(6, 21, 0x0)},
+    {224602674935472842ULL, 1, MOVE(35, 28, 0x4)},
+    {236905469139159753ULL, 1, MOVE(59, 57, 0x2)},
+    {238134598092198099ULL, 1, MOVE(5, 14, 0x0)},
+    {240099530838607068ULL, 1, MOVE(58, 49, 0x0)},
+    {240565485146935938ULL, 15, MOVE(2, 9, 0x0)},
+    {240565485146935938ULL, 1, MOVE(6, 21, 0x0)},
+    {242764707041178255ULL, 1, MOVE(18, 12, 0x0)},
+    {257449078822655243ULL, 1, MOVE(57, 42, 0x0)},
+    {259099318501819281ULL, 6, MOVE(15, 23, 0x0)},
+    {259099318501819281ULL, 1, MOVE(28, 37, 0x4)},
+    {261477852650716008ULL, 3, MOVE(62, 45, 0x0)},
+    {261477852650716008ULL, 1, MOVE(37, 28, 0x4)},
+    {265016303678952017ULL, 1, MOVE(58, 49, 0x0)},
+    {265221686384261250ULL, 9, MOVE(52, 36, 0x1)},
+    {265221686384261250ULL, 3, MOVE(58, 51, 0x0)},
+    {265221686384261250ULL, 1, MOVE(52, 44, 0x0)},
+    {266018415002078424ULL, 4, MOVE(6, 21, 0x0)},
+    {266018415002078424ULL, 1, MOVE(1, 18, 0x0)},
+    {267050811498992697ULL, 3, MOVE(2, 9, 0x0)},
+    {267050811498992697ULL, 1, MOVE(1, 18, 0x0)},
+    {271508887475678536ULL, 1, MOVE(2, 9, 0x0)},
+    {271757610958949087ULL, 1, MOVE(55, 39, 0x1)},
+    {271757610958949087ULL, 1, MOVE(48, 32, 0x1)},
+    {272309117818777353ULL, 3, MOVE(49, 41, 0x0)},
+    {272309117818777353ULL, 1, MOVE(57, 42, 0x0)},
+    {278409118042173093ULL, 4, MOVE(51, 43, 0x0)},
+    {279475978515729115ULL, 1, MOVE(1, 18, 0x0)},
+    {279475978515729115ULL, 1, MOVE(4, 12, 0x0)},
+    {279738564591754543ULL, 1, MOVE(2, 9, 0x0)},
+    {281355017912882417ULL, 1, MOVE(28, 35, 0x4)},
+    {283656114870248381ULL, 1, MOVE(1, 18, 0x0)},
+    {290539675022121757ULL, 4, MOVE(49, 41, 0x0)},
+    {290539675022121757ULL, 1, MOVE(58, 37, 0x0)},
+    {293707353222029336ULL, 20, MOVE(57, 51, 0x0)},
+    {294447516637279088ULL, 1, MOVE(51, 43, 0x0)},
+    {304209884733681000ULL, 1, MOVE(59, 57, 0x2)},
+    {305766470211808875ULL, 3, MOVE(2, 9, 0x0)},
+    {308371674062001263ULL, 2, MOVE(5, 14, 0x0)},
+    {308631616782599566ULL, 2, MOVE(2, 38, 0x0)},
+    {310004554424643268ULL, 1, MOVE(51, 35, 0x1)},
+    {310937205469418843ULL, 1, MOVE(5, 12, 0x0)},
+    {310937205469418843ULL, 1, MOVE(4, 32, 0x0)},
+    {311687939903173951ULL, 1, MOVE(3, 1, 0x2)},
+    {316014745272542487ULL, 2, MOVE(14, 22, 0x0)},
+    {323860299227218192ULL, 1, MOVE(13, 21, 0x0)},
+    {323950280593765591ULL, 1, MOVE(58, 44, 0x0)},
+    {324735531172022568ULL, 1, MOVE(2, 9, 0x0)},
+    {324735531172022568ULL, 1, MOVE(12, 28, 0x1)},
+    {333617220323924000ULL, 1, MOVE(2, 20, 0x0)},
+    {334227015771889503ULL, 1, MOVE(15, 23, 0x0)},
+    {337468742841996050ULL, 1, MOVE(11, 27, 0x1)},
+    {341670719873924792ULL, 1, MOVE(1, 18, 0x0)},
+    {343232177200119441ULL, 1, MOVE(52, 44, 0x0)},
+    {343396118930473076ULL, 1, MOVE(48, 40, 0x0)},
+    {344322533913026017ULL, 1, MOVE(57, 42, 0x0)},
+    {354149070471230713ULL, 2, MOVE(14, 22, 0x0)},
+    {362480684444977609ULL, 3, MOVE(9, 17, 0x0)},
+    {362480684444977609ULL, 2, MOVE(6, 21, 0x0)},
+    {364320063322903359ULL, 1, MOVE(55, 47, 0x0)},
+    {366251873209608425ULL, 2, MOVE(12, 28, 0x1)},
+    {382982140990207870ULL, 1, MOVE(59, 57, 0x2)},
+    {383586812108119352ULL, 2, MOVE(49, 41, 0x0)},
+    {384452135516446838ULL, 2, MOVE(9, 17, 0x0)},
+    {385174634760044217ULL, 1, MOVE(6, 21, 0x0)},
+    {394886718395218886ULL, 33, MOVE(28, 36, 0x0)},
+    {394886718395218886ULL, 1, MOVE(1, 18, 0x0)},
+    {396811135010703028ULL, 2, MOVE(3, 1, 0x2)},
+    {396813605489828815ULL, 1, MOVE(52, 36, 0x1)},
+    {396941067794379263ULL, 1, MOVE(52, 44, 0x0)},
+    {398715556815971940ULL, 4, MOVE(61, 54, 0x0)},
+    {400219203320727273ULL, 1, MOVE(57, 51, 0x0)},
+    {400219203320727273ULL, 1, MOVE(48, 40, 0x0)},
+    {405452168202430897ULL, 1, MOVE(58, 51, 0x0)},
+    {409052978269739094ULL, 1, MOVE(13, 29, 0x1)},
+    {412428947549267920ULL, 3, MOVE(6, 21, 0x0)},
+    {427525171907568972ULL, 4, MOVE(6, 21, 0x0)},
+    {428678263658520080ULL, 3, MOVE(2, 9, 0x0)},
+    {428678263658520080ULL, 1, MOVE(6, 21, 0x0)},
+    {429595594317509877ULL, 5, MOVE(11, 19, 0x0)},
+    {429595594317509877ULL, 3, MOVE(12, 28, 0x1)},
+    {433035109902440422ULL, 1, MOVE(13, 29, 0x1)},
+    {436761732530329393ULL, 1, MOVE(58, 51, 0x0)},
+    {438452299718572583ULL, 1, MOVE(29, 36, 0x4)},
+    {440508127501047343ULL, 1, MOVE(57, 42, 0x0)},
+    {444833840364412887ULL, 1, MOVE(9, 17, 0x0)},
+    {447141404647627765ULL, 1, MOVE(57, 42, 0x0)},
+    {447141404647627765ULL, 1, MOVE(51, 43, 0x0)},
+    {450072722366051628ULL, 3, MOVE(33, 42, 0x4)},
+    {450072722366051628ULL, 1, MOVE(33, 24, 0x0)},
+    {450160377695859491ULL, 2, MOVE(53, 45, 0x0)},
+    {450502636740431445ULL, 1, MOVE(1, 18, 0x0)},
+    {453060070234817587ULL, 1, MOVE(61, 54, 0x0)},
+    {457739887388504019ULL, 1, MOVE(37, 28, 0x4)},
+    {460840698937291885ULL, 2, MOVE(52, 44, 0x0)},
+    {460840698937291885ULL, 1, MOVE(58, 49, 0x0)},
+    {466280551671976813ULL, 1, MOVE(60, 39, 0x0)},
+    {468899396897017307ULL, 1, MOVE(2, 9, 0x0)},
+    {471672447676455080ULL, 1, MOVE(52, 44, 0x0)},
+    {485365094009947338ULL, 3, MOVE(12, 28, 0x1)},
+    {489386553945989980ULL, 2, MOVE(42, 27, 0x0)},
+    {489386553945989980ULL, 2, MOVE(53, 37, 0x1)},
+    {490804058541181186ULL, 1, MOVE(52, 36, 0x1)},
+    {491682638418130315ULL, 2, MOVE(35, 27, 0x0)},
+    {498762593631972516ULL, 1, MOVE(52, 36, 0x1)},
+    {499151131298753557ULL, 1, MOVE(59, 57, 0x2)},
+    {500301882652361302ULL, 18, MOVE(3, 1, 0x2)},
+    {500301882652361302ULL, 5, MOVE(12, 28, 0x1)},
+    {505013430571354046ULL, 1, MOVE(11, 19, 0x0)},
+    {505234611596610632ULL, 1, MOVE(49, 33, 0x1)},
+    {505234611596610632ULL, 1, MOVE(52, 44, 0x0)},
+    {507879134194112219ULL, 1, MOVE(58, 49, 0x0)},
+    {509134656474423740ULL, 3, MOVE(2, 9, 0x0)},
+    {509134656474423740ULL, 1, MOVE(12, 28, 0x1)},
+    {510784499912859357ULL, 1, MOVE(52, 36, 0x1)},
+    {521486461383523194ULL, 3, MOVE(42, 36, 0x4)},
+    {522685015029278593ULL, 1, MOVE(61, 25, 0x0)},
+    {528105827702339079ULL, 1, MOVE(58, 51, 0x0)},
+    {528800069085439848ULL, 1, MOVE(2, 29, 0x0)},
+    {529642544015009068ULL, 1, MOVE(42, 36, 0x4)},
+    {530743811310662493ULL, 1, MOVE(2, 16, 0x0)},
+    {537191007345579813ULL, 2, MOVE(48, 40, 0x0)},
+    {537712257431700094ULL, 1, MOVE(52, 36, 0x1)},
+    {538741738609871893ULL, 1, MOVE(12, 20, 0x0)},
+    {542533843308148873ULL, 1, MOVE(49, 41, 0x0)},
+    {543697548228545768ULL, 1, MOVE(52, 44, 0x0)},
+    {545649488478738326ULL, 1, MOVE(15, 23, 0x0)},
+    {547391465646528483ULL, 1, MOVE(58, 49, 0x0)},
+    {548173204504080986ULL, 4, MOVE(58, 49, 0x0)},
+    {548173204504080986ULL, 1, MOVE(52, 44, 0x0)},
+    {554085673995016712ULL, 2, MOVE(59, 57, 0x2)},
+    {554085673995016712ULL, 1, MOVE(53, 37, 0x1)},
+    {559962089334016956ULL, 1, MOVE(51, 35, 0x1)},
+    {559962089334016956ULL, 1, MOVE(55, 47, 0x0)},
+    {564139187858821347ULL, 2, MOVE(8, 16, 0x0)},
+    {567261592823134366ULL, 1, MOVE(62, 45, 0x0)},
+    {567261592823134366ULL, 1, MOVE(54, 46, 0x0)},
+    {568641686053123874ULL, 2, MOVE(15, 23, 0x0)},
+    {568641686053123874ULL, 2, MOVE(11, 27, 0x1)},
+    {568641686053123874ULL, 1, MOVE(1, 18, 0x0)},
+    {568641686053123874ULL, 1, MOVE(6, 21, 0x0)},
+    {572603635893002343ULL, 7, MOVE(59, 57, 0x2)},
+    {572733763613406671ULL, 1, MOVE(36, 27, 0x4)},
+    {574542390866506722ULL, 16, MOVE(29, 36, 0x4)},
+    {574812388855976327ULL, 2, MOVE(1, 18, 0x0)},
+    {583072026002966787ULL, 1, MOVE(54, 38, 0x1)},
+    {583571228840306217ULL, 6, MOVE(9, 17, 0x0)},
+    {583571228840306217ULL, 1, MOVE(12, 28, 0x1)},
+    {583571228840306217ULL, 1, MOVE(10, 26, 0x1)},
+    {584327104234301567ULL, 2, MOVE(52, 44, 0x0)},
+    {585650518667726309ULL, 2, MOVE(3, 1, 0x2)},
+    {587035072046783931ULL, 1, MOVE(34, 27, 0x4)},
+    {591964673182378060ULL, 113, MOVE(62, 45, 0x0)},
+    {591964673182378060ULL, 56, MOVE(55, 47, 0x0)},
+    {591964673182378060ULL, 19, MOVE(57, 42, 0x0)},
+    {591964673182378060ULL, 1, MOVE(60, 46, 0x0)},
+    {595496304424714491ULL, 2, MOVE(59, 57, 0x2)},
+    {598983951438645861ULL, 2, MOVE(62, 45, 0x0)},
+    {605550243213857586ULL, 7, MOVE(11, 19, 0x0)},
+    {605550243213857586ULL, 4, MOVE(6, 12, 0x0)},
+    {605550243213857586ULL, 2, MOVE(33, 42, 0x4)},
+    {615997109668373059ULL, 1, MOVE(62, 45, 0x0)},
+    {622438577339773979ULL, 1, MOVE(9, 17, 0x0)},
+    {623728077795383351ULL, 1, MOVE(11, 19, 0x0)},
+    {624465518644386062ULL, 5, MOVE(12, 28, 0x1)},
+    {624465518644386062ULL, 1, MOVE(1, 18, 0x0)},
+    {625736165310701802ULL, 1, MOVE(11, 19, 0x0)},
+    {633778458766771913ULL, 1, MOVE(57, 42, 0x0)},
+    {634493279953389634ULL, 2, MOVE(37, 28, 0x4)},
+    {637236040279281993ULL, 1, MOVE(21, 28, 0x4)},
+    {637968157394831788ULL, 1, MOVE(58, 51, 0x0)},
+    {640788960734773440ULL, 1, MOVE(57, 42, 0x0)},
+    {642893056931169229ULL, 1, MOVE(9, 17, 0x0)},
+    {654547618348899302ULL, 1, MOVE(57, 42, 0x0)},
+    {661377698293930152ULL, 2, MOVE(59, 57, 0x2)},
+    {661549278697845199ULL, 1, MOVE(27, 35, 0x0)},
+    {663739779513221653ULL, 1, MOVE(29, 36, 0x4)},
+    {663771812892833879ULL, 1, MOVE(60, 39, 0x0)},
+    {666616906691285750ULL, 1, MOVE(58, 49, 0x0)},
+    {670423311901730368ULL, 2, MOVE(9, 17, 0x0)},
+    {670423311901730368ULL, 1, MOVE(11, 19, 0x0)},
+    {672891751845276267ULL, 14, MOVE(3, 1, 0x2)},
+    {672891751845276267ULL, 11, MOVE(13, 21, 0x0)},
+    {672891751845276267ULL, 7, MOVE(6, 21, 0x0)},
+    {672891751845276267ULL, 2, MOVE(29, 22, 0x0)},
+    {672891751845276267ULL, 2, MOVE(5, 33, 0x0)},
+    {672891751845276267ULL, 1, MOVE(15, 31, 0x1)},
+    {679454699280679223ULL, 1, MOVE(57, 42, 0x0)},
+    {687394209600746243ULL, 2, MOVE(11, 27, 0x1)},
+    {687394209600746243ULL, 1, MOVE(6, 21, 0x0)},
+    {687763605558314065ULL, 1, MOVE(58, 49, 0x0)},
+    {693586347909885145ULL, 1, MOVE(6, 12, 0x0)},
+    {694270502078510938ULL, 1, MOVE(58, 49, 0x0)},
+    {698736825888526590ULL, 1, MOVE(9, 17, 0x0)},
+    {699446084867087395ULL, 14, MOVE(53, 45, 0x0)},
+    {699446084867087395ULL, 1, MOVE(57, 42, 0x0)},
+    {707544836056333417ULL, 2, MOVE(28, 21, 0x4)},
+    {707686794693055316ULL, 2, MOVE(62, 45, 0x0)},
+    {709261479398769638ULL, 1, MOVE(58, 49, 0x0)},
+    {711334360217230126ULL, 2, MOVE(6, 21, 0x0)},
+    {711334360217230126ULL, 2, MOVE(12, 28, 0x1)},
+    {711339711237851540ULL, 1, MOVE(59, 57, 0x2)},
+    {728197801297986388ULL, 1, MOVE(3, 1, 0x2)},
+    {728543612474183885ULL, 1, MOVE(52, 44, 0x0)},
+    {730712018162289350ULL, 1, MOVE(61, 54, 0x0)},
+    {738481242783714990ULL, 8, MOVE(52, 36, 0x1)},
+    {739253139473529713ULL, 2, MOVE(3, 1, 0x2)},
+    {744977712821158122ULL, 1, MOVE(57, 42, 0x0)},
+    {746500785154792927ULL, 4, MOVE(12, 28, 0x1)},
+    {746500785154792927ULL, 2, MOVE(13, 29, 0x1)},
+    {749254599134020196ULL, 50, MOVE(62, 52, 0x0)},
+    {749254599134020196ULL, 25, MOVE(61, 52, 0x0)},
+    {749254599134020196ULL, 4, MOVE(62, 45, 0x0)},
+    {758624053701697952ULL, 2, MOVE(9, 17, 0x0)},
+    {758624053701697952ULL, 1, MOVE(11, 19, 0x0)},
+    {758624053701697952ULL, 1, MOVE(6, 21, 0x0)},
+    {767016273656118985ULL, 7, MOVE(9, 17, 0x0)},
+    {767016273656118985ULL, 4, MOVE(1, 18, 0x0)},
+    {767331346974661163ULL, 3, MOVE(52, 36, 0x1)},
+    {767331346974661163ULL, 1, MOVE(53, 37, 0x1)},
+    {767331346974661163ULL, 1, MOVE(57, 42, 0x0)},
+    {767699526796321723ULL, 1, MOVE(52, 44, 0x0)},
+    {768185629385316105ULL, 1, MOVE(6, 21, 0x0)},
+    {770971303097717231ULL, 27, MOVE(2, 9, 0x0)},
+    {771915367429723165ULL, 4, MOVE(35, 44, 0x4)},
+    {773111080218470867ULL, 2, MOVE(52, 36, 0x1)},
+    {773515506199458081ULL, 22, MOVE(18, 35, 0x4)},
+    {773515506199458081ULL, 8, MOVE(28, 35, 0x4)},
+    {777582335856594137ULL, 1, MOVE(51, 43, 0x0)},
+    {777990396790851720ULL, 6, MOVE(57, 42, 0x0)},
+    {777990396790851720ULL, 4, MOVE(49, 41, 0x0)},
+    {777990396790851720ULL, 1, MOVE(62, 52, 0x0)},
+    {781102422257846983ULL, 3, MOVE(37, 28, 0x4)},
+    {785780347201247457ULL, 1, MOVE(2, 20, 0x0)},
+    {791381626753548550ULL, 8, MOVE(58, 49, 0x0)},
+    {791381626753548550ULL, 1, MOVE(57, 42, 0x0)},
+    {800882841314085815ULL, 4, MOVE(13, 29, 0x1)},
+    {802071582117813795ULL, 1, MOVE(13, 21, 0x0)},
+    {806414111042674181ULL, 3, MOVE(52, 44, 0x0)},
+    {806414111042674181ULL, 1, MOVE(55, 47, 0x0)},
+    {811834998317915217ULL, 2, MOVE(3, 1, 0x2)},
+    {812840133700858392ULL, 1, MOVE(57, 42, 0x0)},
+    {813285245338786574ULL, 1, MOVE(49, 41, 0x0)},
+    {818503067405763151ULL, 1, MOVE(12, 28, 0x1)},
+    {819755709118438304ULL, 4, MOVE(27, 37, 0x0)},
+    {819755709118438304ULL, 3, MOVE(27, 12, 0x4)},
+    {819755709118438304ULL, 1, MOVE(60, 52, 0x0)},
+    {819755709118438304ULL, 1, MOVE(58, 51, 0x0)},
+    {820529082993068353ULL, 5, MOVE(55, 47, 0x0)},
+    {820529082993068353ULL, 2, MOVE(45, 28, 0x0)},
+    {820529082993068353ULL, 1, MOVE(51, 41, 0x0)},
+    {822250722042066999ULL, 1, MOVE(34, 41, 0x0)},
+    {822536358526948246ULL, 1, MOVE(13, 29, 0x1)},
+    {827117085685948540ULL, 1, MOVE(44, 36, 0x0)},
+    {839368920358445451ULL, 1, MOVE(53, 45, 0x0)},
+    {839368920358445451ULL, 1, MOVE(52, 44, 0x0)},
+    {840229560024897761ULL, 1, MOVE(36, 43, 0x4)},
+    {840766407050404543ULL, 56, MOVE(49, 41, 0x0)},
+    {840766407050404543ULL, 27, MOVE(51, 43, 0x0)},
+    {840766407050404543ULL, 11, MOVE(52, 44, 0x0)},
+    {840766407050404543ULL, 6, MOVE(57, 42, 0x0)},
+    {840766407050404543ULL, 2, MOVE(51, 35, 0x1)},
+    {849092312563254848ULL, 1, MOVE(21, 27, 0x4)},
+    {849562645685318368ULL, 1, MOVE(62, 52, 0x0)},
+    {853315467619629722ULL, 1, MOVE(55, 47, 0x0)},
+    {857280651899350990ULL, 2, MOVE(60, 46, 0x0)},
+    {857280651899350990ULL, 1, MOVE(51, 43, 0x0)},
+    {858928466479824022ULL, 2, MOVE(1, 18, 0x0)},
+    {858928466479824022ULL, 1, MOVE(27, 36, 0x4)},
+    {862114277394223689ULL, 1, MOVE(53, 37, 0x1)},
+    {868190319056208210ULL, 1, MOVE(2, 38, 0x0)},
+    {869759129724362111ULL, 3, MOVE(58, 49, 0x0)},
+    {869759129724362111ULL, 1, MOVE(62, 45, 0x0)},
+    {873990700500893847ULL, 1, MOVE(57, 42, 0x0)},
+    {877317167584490694ULL, 1, MOVE(9, 17, 0x0)},
+    {877317167584490694ULL, 1, MOVE(15, 23, 0x0)},
+    {884585794311578292ULL, 1, MOVE(57, 42, 0x0)},
+    {885043034793587232ULL, 2, MOVE(28, 36, 0x0)},
+    {887255215022334696ULL, 2, MOVE(30, 37, 0x0)},
+    {887255215022334696ULL, 2, MOVE(35, 27, 0x0)},
+    {887255215022334696ULL, 1, MOVE(55, 39, 0x1)},
+    {889760765928911551ULL, 1, MOVE(52, 36, 0x1)},
+    {898350593499427121ULL, 1, MOVE(11, 27, 0x1)},
+    {901014402399362476ULL, 2, MOVE(12, 28, 0x1)},
+    {907646101892257178ULL, 7, MOVE(59, 57, 0x2)},
+    {909804662710183496ULL, 3, MOVE(52, 36, 0x1)},
+    {913469295362187160ULL, 2, MOVE(2, 9, 0x0)},
+    {913469295362187160ULL, 1, MOVE(12, 28, 0x1)},
+    {913890193328172239ULL, 1, MOVE(52, 44, 0x0)},
+    {914637218120196131ULL, 16, MOVE(59, 57, 0x2)},
+    {914637218120196131ULL, 9, MOVE(52, 36, 0x1)},
+    {914637218120196131ULL, 4, MOVE(52, 44, 0x0)},
+    {914827623818171818ULL, 1, MOVE(52, 36, 0x1)},
+    {914827623818171818ULL, 1, MOVE(62, 45, 0x0)},
+    {919785641456212912ULL, 1, MOVE(27, 36, 0x4)},
+    {926315938177233362ULL, 2, MOVE(35, 28, 0x4)},
+    {926701955664750813ULL, 91, MOVE(61, 34, 0x0)},
+    {926701955664750813ULL, 22, MOVE(45, 37, 0x0)},
+    {928693805656027844ULL, 1, MOVE(36, 29, 0x4)},
+    {930652702502442036ULL, 4, MOVE(62, 45, 0x0)},
+    {941795949107039717ULL, 1, MOVE(35, 28, 0x4)},
+    {943857438916438423ULL, 1, MOVE(1, 18, 0x0)},
+    {943857438916438423ULL, 1, MOVE(31, 29, 0x4)},
+    {949463546822895009ULL, 1, MOVE(57, 42, 0x0)},
+    {950135029103736088ULL, 1, MOVE(12, 28, 0x1)},
+    {951549080933073652ULL, 5, MOVE(29, 36, 0x4)},
+    {951915624010270226ULL, 1, MOVE(12, 28, 0x1)},
+    {953844205230307677ULL, 5, MOVE(57, 42, 0x0)},
+    {960520148007230521ULL, 1, MOVE(1, 18, 0x0)},
+    {967663964112795283ULL, 1, MOVE(59, 57, 0x2)},
+    {971863090360397094ULL, 1, MOVE(6, 21, 0x0)},
+    {972090875215448539ULL, 23, MOVE(38, 52, 0x4)},
+    {972090875215448539ULL, 2, MOVE(13, 29, 0x1)},
+    {972861641801223415ULL, 1, MOVE(1, 18, 0x0)},
+    {973162462129454109ULL, 1, MOVE(11, 19, 0x0)},
+    {974579608276137956ULL, 11, MOVE(62, 45, 0x0)},
+    {974579608276137956ULL, 7, MOVE(51, 43, 0x0)},
+    {974579608276137956ULL, 3, MOVE(49, 41, 0x0)},
+    {982401194560336134ULL, 1, MOVE(61, 25, 0x0)},
+    {983864879057238617ULL, 2, MOVE(42, 36, 0x4)},
+    {985949049086803927ULL, 1, MOVE(55, 47, 0x0)},
+    {990476394463937226ULL, 80, MOVE(27, 21, 0x4)},
+    {990476394463937226ULL, 3, MOVE(27, 42, 0x0)},
+    {993118837056614295ULL, 17, MOVE(1, 18, 0x0)},
+    {993118837056614295ULL, 8, MOVE(4, 13, 0x0)},
+    {993820064801540863ULL, 8, MOVE(2, 3, 0x0)},
+    {993820064801540863ULL, 2, MOVE(13, 21, 0x0)},
+    {993910358365762845ULL, 6, MOVE(9, 17, 0x0)},
+    {993910358365762845ULL, 1, MOVE(11, 19, 0x0)},
+    {995140149687482211ULL, 1, MOVE(55, 47, 0x0)},
+    {998085577977561236ULL, 1, MOVE(33, 26, 0x0)},
+    {1000675813697508369ULL, 1, MOVE(53, 37, 0x1)},
+    {1003484777785739016ULL, 4, MOVE(2, 9, 0x0)},
+    {1003484777785739016ULL, 1, MOVE(12, 28, 0x1)},
+    {1007163775921767157ULL, 1, MOVE(53, 37, 0x1)},
+    {1010420621366471411ULL, 1, MOVE(57, 42, 0x0)},
+    {1011635998477884321ULL, 4, MOVE(61, 34, 0x0)},
+    {1011635998477884321ULL, 1, MOVE(58, 49, 0x0)},
+    {1012905480992085559ULL, 1, MOVE(14, 22, 0x0)},
+    {1015942802288761523ULL, 1, MOVE(58, 49, 0x0)},
+    {1017817944632322248ULL, 189, MOVE(12, 28, 0x1)},
+    {1017817944632322248ULL, 9, MOVE(9, 17, 0x0)},
+    {1017817944632322248ULL, 9, MOVE(13, 21, 0x0)},
+    {1017817944632322248ULL, 8, MOVE(6, 21, 0x0)},
+    {1017817944632322248ULL, 4, MOVE(12, 20, 0x0)},
+    {1017817944632322248ULL, 4, MOVE(14, 22, 0x0)},
+    {1017817944632322248ULL, 3, MOVE(13, 29, 0x1)},
+    {1017817944632322248ULL, 1, MOVE(4, 11, 0x0)},
+    {1026621960966324240ULL, 5, MOVE(3, 1, 0x2)},
+    {1030158606143655393ULL, 1, MOVE(15, 31, 0x1)},
+    {1031239070906464819ULL, 1, MOVE(57, 42, 0x0)},
+    {1033864555778651999ULL, 1, MOVE(52, 36, 0x1)},
+    {1036574346454279426ULL, 2, MOVE(6, 23, 0x0)},
+    {1036574346454279426ULL, 1, MOVE(3, 1, 0x2)},
+    {1036574346454279426ULL, 1, MOVE(14, 22, 0x0)},
+    {1038801348951046746ULL, 268, MOVE(52, 36, 0x1)},
+    {1038801348951046746ULL, 169, MOVE(58, 49, 0x0)},
+    {1045336252137225194ULL, 1, MOVE(37, 28, 0x4)},
+    {1050224721378092142ULL, 1, MOVE(48, 40, 0x0)},
+    {1053059707166217041ULL, 1, MOVE(62, 45, 0x0)},
+    {1057229673205956292ULL, 1, MOVE(58, 49, 0x0)},
+    {1060592068099110234ULL, 3, MOVE(57, 51, 0x0)},
+    {1060592068099110234ULL, 1, MOVE(62, 45, 0x0)},
+    {1062510130089899290ULL, 2, MOVE(55, 47, 0x0)},
+    {1068111835404379490ULL, 1, MOVE(8, 16, 0x0)},
+    {1071109341579986032ULL, 1, MOVE(49, 41, 0x0)},
+    {1076541696884820839ULL, 1, MOVE(52, 36, 0x1)},
+    {1076937151375403658ULL, 1, MOVE(13, 29, 0x1)},
+    {1079616273192970146ULL, 1, MOVE(1, 18, 0x0)},
+    {1080883528570852895ULL, 1, MOVE(53, 37, 0x1)},
+    {1084424692686883202ULL, 2, MOVE(62, 45, 0x0)},
+    {1084424692686883202ULL, 1, MOVE(57, 42, 0x0)},
+    {1085697776334408688ULL, 1, MOVE(51, 35, 0x1)},
+    {1087829851705193483ULL, 1, MOVE(36, 29, 0x4)},
+    {1093597968709149650ULL, 2, MOVE(37, 28, 0x4)},
+    {1093974392833597562ULL, 11, MOVE(20, 27, 0x4)},
+    {1098243531482043858ULL, 2, MOVE(62, 45, 0x0)},
+    {1099152746726700632ULL, 1, MOVE(51, 43, 0x0)},
+    {1102326585621353541ULL, 7, MOVE(58, 37, 0x4)},
+    {1103925742333866619ULL, 1, MOVE(5, 19, 0x0)},
+    {1106703767965429927ULL, 1, MOVE(58, 49, 0x0)},
+    {1108873433279187738ULL, 1, MOVE(3, 1, 0x2)},
+    {1110089781236343827ULL, 4, MOVE(52, 44, 0x0)},
+    {1112989979303038866ULL, 6, MOVE(55, 47, 0x0)},
+    {1113250227562366882ULL, 1, MOVE(12, 28, 0x1)},
+    {1113754827731596810ULL, 1, MOVE(55, 39, 0x1)},
+    {1114990875089469523ULL, 1, MOVE(3, 1, 0x2)},
+    {1119690734407537288ULL, 1, MOVE(15, 31, 0x1)},
+    {1119690734407537288ULL, 1, MOVE(5, 19, 0x0)},
+    {1122061931576278220ULL, 1, MOVE(11, 19, 0x0)},
+    {1122061931576278220ULL, 1, MOVE(8, 16, 0x0)},
+    {1129310601353224863ULL, 22, MOVE(62, 52, 0x0)},
+    {1133601421156760151ULL, 6, MOVE(54, 45, 0x4)},
+    {1134272023716330017ULL, 8, MOVE(62, 45, 0x0)},
+    {1134272023716330017ULL, 5, MOVE(55, 47, 0x0)},
+    {1137187048104417131ULL, 1, MOVE(9, 17, 0x0)},
+    {1137187048104417131ULL, 1, MOVE(13, 29, 0x1)},
+    {1137288163704384321ULL, 1, MOVE(30, 12, 0x4)},
+    {1148412694854180801ULL, 1, MOVE(52, 36, 0x1)},
+    {1149003012592182808ULL, 2, MOVE(13, 21, 0x0)},
+    {1149003012592182808ULL, 1, MOVE(2, 9, 0x0)},
+    {1149462635247451623ULL, 106, MOVE(4, 13, 0x0)},
+    {1149462635247451623ULL, 75, MOVE(11, 19, 0x0)},
+    {1149462635247451623ULL, 71, MOVE(1, 18, 0x0)},
+    {1149462635247451623ULL, 23, MOVE(10, 18, 0x0)},
+    {1149462635247451623ULL, 7, MOVE(9, 17, 0x0)},
+    {1149462635247451623ULL, 5, MOVE(5, 12, 0x0)},
+    {1149462635247451623ULL, 2, MOVE(5, 33, 0x0)},
+    {1151680779536203575ULL, 1, MOVE(42, 52, 0x0)},
+    {1153511603875617215ULL, 12, MOVE(52, 44, 0x0)},
+    {1153511603875617215ULL, 1, MOVE(55, 47, 0x0)},
+    {1153711086512873939ULL, 1, MOVE(13, 21, 0x0)},
+    {1154708073608477002ULL, 2, MOVE(29, 36, 0x4)},
+    {1157525919295043061ULL, 3, MOVE(55, 47, 0x0)},
+    {1162655463028370313ULL, 1, MOVE(5, 14, 0x0)},
+    {1170254466237051344ULL, 1, MOVE(62, 45, 0x0)},
+    {1170341815958351220ULL, 3, MOVE(61, 52, 0x0)},
+    {1170921552094379838ULL, 1, MOVE(35, 28, 0x4)},
+    {1177254642481836431ULL, 34, MOVE(58, 37, 0x0)},
+    {1177254642481836431ULL, 32, MOVE(57, 42, 0x0)},
+    {1177254642481836431ULL, 4, MOVE(58, 30, 0x0)},
+    {1177254642481836431ULL, 2, MOVE(60, 42, 0x0)},
+    {1177556745673183075ULL, 3, MOVE(52, 44, 0x0)},
+    {1177663506289633593ULL, 1, MOVE(51, 43, 0x0)},
+    {1178404172193311315ULL, 1, MOVE(62, 45, 0x0)},
+    {1202917210903513443ULL, 1, MOVE(53, 45, 0x0)},
+    {1221210769281259082ULL, 1, MOVE(53, 37, 0x1)},
+    {1223832161122134841ULL, 2, MOVE(58, 49, 0x0)},
+    {1229768859905630747ULL, 19, MOVE(47, 54, 0x0)},
+    {1229768859905630747ULL, 1, MOVE(58, 51, 0x0)},
+    {1234161236451977705ULL, 1, MOVE(51, 43, 0x0)},
+    {1235929339188515014ULL, 2, MOVE(59, 57, 0x2)},
+    {1238287990873259640ULL, 1, MOVE(4, 25, 0x0)},
+    {1249779290147709267ULL, 2, MOVE(52, 36, 0x1)},
+    {1250290496170808361ULL, 1, MOVE(11, 19, 0x0)},
+    {1253955909588988649ULL, 2, MOVE(1, 18, 0x0)},
+    {1257171865369730828ULL, 1, MOVE(59, 57, 0x2)},
+    {1268631091672386975ULL, 1, MOVE(12, 28, 0x1)},
+    {1270814368778546479ULL, 1, MOVE(2, 29, 0x0)},
+    {1276296526391476254ULL, 2, MOVE(43, 36, 0x4)},
+    {1278995236737474217ULL, 1, MOVE(11, 19, 0x0)},
+    {1283078865747651410ULL, 1, MOVE(27, 36, 0x4)},
+    {1286666390796853609ULL, 1, MOVE(6, 21, 0x0)},
+    {1290254163418052278ULL, 1, MOVE(59, 57, 0x2)},
+    {1290824433729555758ULL, 2, MOVE(58, 30, 0x0)},
+    {1290824433729555758ULL, 2, MOVE(57, 42, 0x0)},
+    {1290824433729555758ULL, 1, MOVE(49, 41, 0x0)},
+    {1290824433729555758ULL, 1, MOVE(62, 45, 0x0)},
+    {1293254040617411021ULL, 1, MOVE(6, 21, 0x0)},
+    {1294491315707699565ULL, 1, MOVE(33, 24, 0x0)},
+    {1297921238066023508ULL, 5, MOVE(29, 36, 0x4)},
+    {1297921238066023508ULL, 2, MOVE(5, 33, 0x0)},
+    {1301429158395191531ULL, 1, MOVE(53, 37, 0x1)},
+    {1302123661920026747ULL, 1, MOVE(52, 44, 0x0)},
+    {1314071407186854557ULL, 6, MOVE(30, 12, 0x4)},
+    {1314071407186854557ULL, 3, MOVE(30, 51, 0x0)},
+    {1314071407186854557ULL, 2, MOVE(55, 39, 0x1)},
+    {1314635104228023857ULL, 1, MOVE(2, 9, 0x0)},
+    {1314835731158487594ULL, 9, MOVE(11, 19, 0x0)},
+    {1314835731158487594ULL, 8, MOVE(11, 27, 0x1)},
+    {1314835731158487594ULL, 3, MOVE(1, 18, 0x0)},
+    {1314835731158487594ULL, 1, MOVE(29, 36, 0x4)},
+    {1317110858163818703ULL, 31, MOVE(52, 36, 0x1)},
+    {1317110858163818703ULL, 12, MOVE(53, 37, 0x1)},
+    {1317110858163818703ULL, 1, MOVE(52, 44, 0x0)},
+    {1317209463742482544ULL, 1, MOVE(6, 12, 0x0)},
+    {1317269159200877694ULL, 16, MOVE(58, 49, 0x0)},
+    {1317269159200877694ULL, 1, MOVE(53, 45, 0x0)},
+    {1317269159200877694ULL, 1, MOVE(52, 44, 0x0)},
+    {1318184152444028073ULL, 3499, MOVE(11, 27, 0x1)},
+    {1318184152444028073ULL, 2955, MOVE(12, 28, 0x1)},
+    {1318184152444028073ULL, 709, MOVE(1, 18, 0x0)},
+    {1318184152444028073ULL, 540, MOVE(13, 29, 0x1)},
+    {1318184152444028073ULL, 24, MOVE(9, 17, 0x0)},
+    {1318184152444028073ULL, 22, MOVE(14, 22, 0x0)},
+    {1318184152444028073ULL, 5, MOVE(10, 26, 0x1)},
+    {1318184152444028073ULL, 1, MOVE(6, 21, 0x0)},
+    {1318184152444028073ULL, 1, MOVE(13, 21, 0x0)},
+    {1321407202641433633ULL, 9, MOVE(27, 35, 0x0)},
+    {1322071795194128839ULL, 1, MOVE(52, 44, 0x0)},
+    {1329717847976010258ULL, 1, MOVE(2, 9, 0x0)},
+    {1330528191143959034ULL, 1, MOVE(62, 45, 0x0)},
+    {1333444859624965869ULL, 1, MOVE(11, 27, 0x1)},
+    {1334449323420672656ULL, 1, MOVE(58, 51, 0x0)},
+    {1334449323420672656ULL, 1, MOVE(53, 45, 0x0)},
+    {1340376004459581717ULL, 1, MOVE(37, 28, 0x4)},
+    {1346590116790759398ULL, 2, MOVE(15, 31, 0x1)},
+    {1346590116790759398ULL, 1, MOVE(11, 19, 0x0)},
+    {1346590116790759398ULL, 1, MOVE(9, 17, 0x0)},
+    {1355504980991665714ULL, 1, MOVE(60, 52, 0x0)},
+    {1369597123192125423ULL, 1, MOVE(59, 57, 0x2)},
+    {1369671539045391712ULL, 4, MOVE(15, 23, 0x0)},
+    {1372678218068159611ULL, 1, MOVE(36, 29, 0x4)},
+    {1372678218068159611ULL, 1, MOVE(51, 43, 0x0)},
+    {1372678218068159611ULL, 1, MOVE(55, 47, 0x0)},
+    {1373502392525430976ULL, 1, MOVE(3, 11, 0x0)},
+    {1390745537506924673ULL, 1, MOVE(43, 36, 0x4)},
+    {1391201500692976669ULL, 1, MOVE(61, 54, 0x0)},
+    {1391607233297579990ULL, 1, MOVE(51, 35, 0x1)},
+    {1391607233297579990ULL, 1, MOVE(54, 46, 0x0)},
+    {1393511017668804963ULL, 1, MOVE(1, 18, 0x0)},
+    {1394309267880011347ULL, 1, MOVE(57, 42, 0x0)},
+    {1394858949426150041ULL, 1, MOVE(9, 17, 0x0)},
+    {1395246973080635110ULL, 1, MOVE(2, 9, 0x0)},
+    {1396206698255964812ULL, 1, MOVE(12, 20, 0x0)},
+    {1396439026737845388ULL, 32, MOVE(52, 44, 0x0)},
+    {1396439026737845388ULL, 31, MOVE(59, 57, 0x2)},
+    {1396439026737845388ULL, 4, MOVE(55, 47, 0x0)},
+    {1402221783907692117ULL, 1, MOVE(3, 1, 0x2)},
+    {1403560791400964691ULL, 1, MOVE(58, 49, 0x0)},
+    {1403819644670073295ULL, 1, MOVE(60, 46, 0x0)},
+    {1404087813864950984ULL, 1, MOVE(57, 42, 0x0)},
+    {1404346644154420985ULL, 1, MOVE(54, 38, 0x1)},
+    {1405119382871225453ULL, 1, MOVE(58, 49, 0x0)},
+    {1406378603153108222ULL, 18, MOVE(2, 9, 0x0)},
+    {1413626396146629889ULL, 1, MOVE(36, 27, 0x4)},
+    {1413957399441262026ULL, 1, MOVE(62, 52, 0x0)},
+    {1414748001910292073ULL, 1, MOVE(4, 32, 0x0)},
+    {1416411302705672528ULL, 1, MOVE(28, 35, 0x4)},
+    {1420636047334169063ULL, 1, MOVE(9, 17, 0x0)},
+    {1422303883457906996ULL, 10, MOVE(49, 41, 0x0)},
+    {1422303883457906996ULL, 4, MOVE(57, 42, 0x0)},
+    {1424198990880039230ULL, 1, MOVE(53, 37, 0x1)},
+    {1425020569049334742ULL, 1, MOVE(11, 19, 0x0)},
+    {1445376715737942005ULL, 1, MOVE(57, 42, 0x0)},
+    {1446729629158479017ULL, 1, MOVE(8, 16, 0x0)},
+    {1453574963415163835ULL, 1, MOVE(42, 52, 0x0)},
+    {1455392966675295401ULL, 3, MOVE(6, 21, 0x0)},
+    {1455392966675295401ULL, 3, MOVE(38, 45, 0x4)},
+    {1457580596236909813ULL, 2, MOVE(51, 43, 0x0)},
+    {1457580596236909813ULL, 2, MOVE(52, 44, 0x0)},
+    {1464030157970685512ULL, 3, MOVE(51, 43, 0x0)},
+    {1464030157970685512ULL, 1, MOVE(57, 42, 0x0)},
+    {1464784652970415648ULL, 1, MOVE(58, 44, 0x0)},
+    {1470267459755539660ULL, 14, MOVE(36, 44, 0x0)},
+    {1470267459755539660ULL, 6, MOVE(36, 39, 0x0)},
+    {1470919278463989711ULL, 1, MOVE(37, 28, 0x4)},
+    {1474266377571258710ULL, 14, MOVE(1, 18, 0x0)},
+    {1474266377571258710ULL, 3, MOVE(1, 11, 0x0)},
+    {1474266377571258710ULL, 2, MOVE(28, 35, 0x4)},
+    {1475228825024038599ULL, 1, MOVE(61, 25, 0x0)},
+    {1475679628462735391ULL, 2, MOVE(49, 41, 0x0)},
+    {1478252545954910413ULL, 1, MOVE(62, 45, 0x0)},
+    {1479126511852834093ULL, 1, MOVE(42, 32, 0x0)},
+    {1488156328378533661ULL, 32, MOVE(42, 36, 0x4)},
+    {1492120707547383600ULL, 1, MOVE(60, 46, 0x0)},
+    {1498514492536873048ULL, 1, MOVE(9, 17, 0x0)},
+    {1499260450206262455ULL, 1, MOVE(52, 36, 0x1)},
+    {1508237366667012845ULL, 1, MOVE(59, 57, 0x2)},
+    {1508456233249733303ULL, 8, MOVE(37, 28, 0x4)},
+    {1508456233249733303ULL, 1, MOVE(58, 49, 0x0)},
+    {1510908925626784060ULL, 34, MOVE(62, 45, 0x0)},
+    {1510908925626784060ULL, 25, MOVE(57, 42, 0x0)},
+    {1510908925626784060ULL, 2, MOVE(49, 41, 0x0)},
+    {1514990828456548224ULL, 1, MOVE(55, 39, 0x1)},
+    {1519460425088512788ULL, 2, MOVE(58, 51, 0x0)},
+    {1519775354098768818ULL, 1, MOVE(55, 47, 0x0)},
+    {1522984047018390892ULL, 1, MOVE(57, 42, 0x0)},
+    {1528373090159759611ULL, 8, MOVE(30, 51, 0x0)},
+    {1528373090159759611ULL, 1, MOVE(30, 44, 0x0)},
+    {1539125002671694494ULL, 2, MOVE(58, 49, 0x0)},
+    {1539899780551595346ULL, 1, MOVE(28, 37, 0x4)},
+    {1540265533518731173ULL, 11, MOVE(34, 27, 0x4)},
+    {1540265533518731173ULL, 1, MOVE(57, 42, 0x0)},
+    {1542558454087408499ULL, 20, MOVE(53, 45, 0x0)},
+    {1542558454087408499ULL, 6, MOVE(58, 51, 0x0)},
+    {1542558454087408499ULL, 3, MOVE(62, 52, 0x0)},
+    {1548708506675262952ULL, 1, MOVE(52, 36, 0x1)},
+    {1548708506675262952ULL, 1, MOVE(60, 53, 0x0)},
+    {1552752966703351933ULL, 3, MOVE(53, 37, 0x1)},
+    {1552752966703351933ULL, 3, MOVE(54, 46, 0x0)},
+    {1552752966703351933ULL, 2, MOVE(49, 41, 0x0)},
+    {1552752966703351933ULL, 1, MOVE(52, 36, 0x1)},
+    {1555089724608855539ULL, 1, MOVE(3, 1, 0x2)},
+    {1558463254630670412ULL, 4, MOVE(51, 43, 0x0)},
+    {1560698124830744504ULL, 1, MOVE(11, 19, 0x0)},
+    {1569748732633614941ULL, 5, MOVE(54, 45, 0x4)},
+    {1572282735930126606ULL, 1, MOVE(58, 51, 0x0)},
+    {1573420170982959357ULL, 1, MOVE(58, 30, 0x0)},
+    {1577664516541516964ULL, 4, MOVE(12, 28, 0x1)},
+    {1578435677420669396ULL, 1, MOVE(1, 18, 0x0)},
+    {1579516743148795256ULL, 20, MOVE(55, 47, 0x0)},
+    {1579516743148795256ULL, 16, MOVE(53, 37, 0x1)},
+    {1579516743148795256ULL, 12, MOVE(62, 45, 0x0)},
+    {1579516743148795256ULL, 7, MOVE(58, 30, 0x0)},
+    {1579516743148795256ULL, 2, MOVE(61, 52, 0x0)},
+    {1579516743148795256ULL, 1, MOVE(53, 45, 0x0)},
+    {1596068348471084593ULL, 3, MOVE(11, 19, 0x0)},
+    {1604436361618913026ULL, 1, MOVE(5, 33, 0x0)},
+    {1604436361618913026ULL, 1, MOVE(8, 16, 0x0)},
+    {1604436361618913026ULL, 1, MOVE(18, 33, 0x0)},
+    {1604436361618913026ULL, 1, MOVE(11, 19, 0x0)},
+    {1604759823097220428ULL, 1, MOVE(43, 36, 0x4)},
+    {1606170700876046612ULL, 6, MOVE(58, 37, 0x0)},
+    {1606170700876046612ULL, 2, MOVE(52, 44, 0x0)},
+    {1606170700876046612ULL, 1, MOVE(53, 45, 0x0)},
+    {1610230505303374045ULL, 3, MOVE(62, 45, 0x0)},
+    {1610230505303374045ULL, 1, MOVE(57, 42, 0x0)},
+    {1610852965559855646ULL, 1, MOVE(2, 9, 0x0)},
+    {1611723605530087445ULL, 1, MOVE(3, 1, 0x2)},
+    {1621447650458680172ULL, 8, MOVE(2, 9, 0x0)},
+    {1627082392457633904ULL, 5, MOVE(59, 57, 0x2)},
+    {1627082392457633904ULL, 4, MOVE(53, 37, 0x1)},
+    {1631512165894786039ULL, 1, MOVE(6, 21, 0x0)},
+    {1631780662155416637ULL, 1, MOVE(6, 21, 0x0)},
+    {1631780662155416637ULL, 1, MOVE(2, 29, 0x0)},
+    {1633935303523169139ULL, 7, MOVE(36, 29, 0x4)},
+    {1634911737309237060ULL, 3, MOVE(13, 29, 0x1)},
+    {1635983559685780572ULL, 6, MOVE(51, 43, 0x0)},
+    {1635983559685780572ULL, 2, MOVE(49, 41, 0x0)},
+    {1635983559685780572ULL, 1, MOVE(51, 35, 0x1)},
+    {1639125510790579259ULL, 1, MOVE(8, 16, 0x0)},
+    {1639643763898134869ULL, 1, MOVE(50, 34, 0x1)},
+    {1646359170475928634ULL, 1, MOVE(61, 43, 0x0)},
+    {1651847224208382006ULL, 1, MOVE(48, 40, 0x0)},
+    {1653352079387579085ULL, 1, MOVE(61, 54, 0x0)},
+    {1663832166159008451ULL, 18, MOVE(36, 27, 0x4)},
+    {1663832166159008451ULL, 6, MOVE(58, 30, 0x0)},
+    {1663832166159008451ULL, 2, MOVE(58, 51, 0x0)},
+    {1664268723224940363ULL, 1, MOVE(14, 22, 0x0)},
+    {1665519270960685263ULL, 4, MOVE(62, 45, 0x0)},
+    {1665519270960685263ULL, 2, MOVE(55, 47, 0x0)},
+    {1665519270960685263ULL, 1, MOVE(36, 29, 0x4)},
+    {1668084767683326049ULL, 15, MOVE(3, 1, 0x2)},
+    {1668084767683326049ULL, 1, MOVE(29, 22, 0x0)},
+    {1673060906266845664ULL, 2, MOVE(35, 26, 0x4)},
+    {1673354095691437116ULL, 1, MOVE(50, 34, 0x1)},
+    {1673354095691437116ULL, 1, MOVE(58, 30, 0x0)},
+    {1680310096665698135ULL, 11, MOVE(2, 9, 0x0)},
+    {1680310096665698135ULL, 5, MOVE(21, 36, 0x0)},
+    {1684054587875387468ULL, 6, MOVE(6, 12, 0x0)},
+    {1684232874745038522ULL, 1, MOVE(11, 19, 0x0)},
+    {1684777482253352025ULL, 2, MOVE(28, 36, 0x0)},
+    {1684777482253352025ULL, 1, MOVE(11, 19, 0x0)},
+    {1684777482253352025ULL, 1, MOVE(28, 37, 0x4)},
+    {1689501871275480901ULL, 1, MOVE(6, 21, 0x0)},
+    {1691396523111645273ULL, 1, MOVE(57, 42, 0x0)},
+    {1694407727868121980ULL, 1, MOVE(11, 19, 0x0)},
+    {1694407727868121980ULL, 1, MOVE(9, 17, 0x0)},
+    {1704289629100926163ULL, 2, MOVE(14, 22, 0x0)},
+    {1714458505954375055ULL, 4, MOVE(57, 42, 0x0)},
+    {1714458505954375055ULL, 2, MOVE(52, 36, 0x1)},
+    {1717228968407346697ULL, 1, MOVE(12, 28, 0x1)},
+    {1728904685062386737ULL, 38, MOVE(48, 40, 0x0)},
+    {1728904685062386737ULL, 14, MOVE(62, 52, 0x0)},
+    {1728904685062386737ULL, 7, MOVE(36, 29, 0x4)},
+    {1728904685062386737ULL, 1, MOVE(59, 57, 0x2)},
+    {1730068856936562750ULL, 2, MOVE(52, 44, 0x0)},
+    {1730068856936562750ULL, 1, MOVE(59, 57, 0x2)},
+    {1736362201741511168ULL, 1, MOVE(3, 1, 0x2)},
+    {1743269486396206791ULL, 1, MOVE(62, 45, 0x0)},
+    {1748283900397453389ULL, 1, MOVE(57, 42, 0x0)},
+    {1748283900397453389ULL, 1, MOVE(52, 36, 0x1)},
+    {1754985336426992241ULL, 5, MOVE(51, 35, 0x1)},
+    {1759304654378320633ULL, 1, MOVE(6, 21, 0x0)},
+    {1759454108154958090ULL, 2, MOVE(60, 46, 0x0)},
+    {1759454108154958090ULL, 1, MOVE(51, 43, 0x0)},
+    {1759454108154958090ULL, 1, MOVE(36, 27, 0x4)},
+    {1759454108154958090ULL, 1, MOVE(49, 41, 0x0)},
+    {1764038960203411898ULL, 4, MOVE(57, 42, 0x0)},
+    {1764548940812341223ULL, 1, MOVE(62, 52, 0x0)},
+    {1765377045570075649ULL, 1, MOVE(53, 45, 0x0)},
+    {1773804940687752254ULL, 1, MOVE(12, 21, 0x4)},
+    {1776932895691488072ULL, 4, MOVE(12, 20, 0x0)},
+    {1779322786717772449ULL, 1, MOVE(50, 34, 0x1)},
+    {1780921953423135554ULL, 1, MOVE(58, 51, 0x0)},
+    {1780965510431463977ULL, 1, MOVE(9, 17, 0x0)},
+    {1782235634839136110ULL, 1, MOVE(12, 28, 0x1)},
+    {1782235634839136110ULL, 1, MOVE(2, 29, 0x0)},
+    {1783450099484711758ULL, 1, MOVE(62, 45, 0x0)},
+    {1789761910054058491ULL, 2, MOVE(4, 22, 0x0)},
+    {1793414711660541410ULL, 2, MOVE(6, 21, 0x0)},
+    {1793414711660541410ULL, 2, MOVE(9, 17, 0x0)},
+    {1793414711660541410ULL, 1, MOVE(1, 18, 0x0)},
+    {1809849071310066341ULL, 1, MOVE(52, 44, 0x0)},
+    {1813153526873961858ULL, 2, MOVE(53, 45, 0x0)},
+    {1815539299085708762ULL, 1, MOVE(62, 52, 0x0)},
+    {1816532923153534333ULL, 2, MOVE(1, 18, 0x0)},
+    {1818639558808396037ULL, 1, MOVE(4, 12, 0x4)},
+    {1831608642613968858ULL, 13, MOVE(28, 38, 0x0)},
+    {1831608642613968858ULL, 1, MOVE(28, 22, 0x0)},
+    {1833083610020604137ULL, 1, MOVE(11, 19, 0x0)},
+    {1833656183454297770ULL, 1, MOVE(37, 28, 0x4)},
+    {1833656183454297770ULL, 1, MOVE(61, 25, 0x0)},
+    {1836087904478680691ULL, 1, MOVE(58, 49, 0x0)},
+    {1846392311451153017ULL, 1, MOVE(55, 47, 0x0)},
+    {1848827282326176095ULL, 14, MOVE(29, 36, 0x4)},
+    {1848827282326176095ULL, 2, MOVE(5, 33, 0x0)},
+    {1848827282326176095ULL, 1, MOVE(1, 18, 0x0)},
+    {1853213078699427548ULL, 1, MOVE(27, 36, 0x4)},
+    {1854194660543656710ULL, 15, MOVE(58, 49, 0x0)},
+    {1859323239144565687ULL, 1, MOVE(52, 36, 0x1)},
+    {1866326805214807779ULL, 4, MOVE(57, 42, 0x0)},
+    {1866326805214807779ULL, 4, MOVE(53, 37, 0x1)},
+    {1866326805214807779ULL, 1, MOVE(61, 34, 0x0)},
+    {1866326805214807779ULL, 1, MOVE(62, 52, 0x0)},
+    {1866326805214807779ULL, 1, MOVE(51, 43, 0x0)},
+    {1866326805214807779ULL, 1, MOVE(61, 25, 0x0)},
+    {1866786483407906694ULL, 2, MOVE(5, 14, 0x0)},
+    {1867286230845612828ULL, 3, MOVE(53, 37, 0x1)},
+    {1867286230845612828ULL, 1, MOVE(52, 36, 0x1)},
+    {1868446406993437951ULL, 7, MOVE(45, 28, 0x0)},
+    {1868446406993437951ULL, 1, MOVE(51, 43, 0x0)},
+    {1875718771217360407ULL, 1, MOVE(12, 28, 0x1)},
+    {1878031429603911273ULL, 2, MOVE(13, 21, 0x0)},
+    {1879553055204147958ULL, 2, MOVE(49, 41, 0x0)},
+    {1887387029694063607ULL, 3, MOVE(58, 49, 0x0)},
+    {1887387029694063607ULL, 1, MOVE(52, 36, 0x1)},
+    {1887964693308686668ULL, 1, MOVE(53, 45, 0x0)},
+    {1894978136666100151ULL, 8, MOVE(29, 36, 0x4)},
+    {1895010208471084100ULL, 1, MOVE(18, 35, 0x0)},
+    {1900768854942377416ULL, 2, MOVE(5, 14, 0x0)},
+    {1901106070116560627ULL, 521, MOVE(53, 45, 0x0)},
+    {1901106070116560627ULL, 141, MOVE(51, 43, 0x0)},
+    {1901106070116560627ULL, 57, MOVE(36, 29, 0x4)},
+    {1901106070116560627ULL, 1, MOVE(62, 45, 0x0)},
+    {1901106070116560627ULL, 1, MOVE(53, 37, 0x1)},
+    {1901810363593289491ULL, 1, MOVE(61, 25, 0x0)},
+    {1903286576231994809ULL, 11, MOVE(2, 9, 0x0)},
+    {1904045194613820949ULL, 1, MOVE(48, 40, 0x0)},
+    {1908771061529858395ULL, 14, MOVE(11, 27, 0x1)},
+    {1908771061529858395ULL, 7, MOVE(9, 17, 0x0)},
+    {1908771061529858395ULL, 2, MOVE(12, 28, 0x1)},
+    {1909968632792283777ULL, 1, MOVE(18, 35, 0x0)},
+    {1909968632792283777ULL, 1, MOVE(29, 36, 0x4)},
+    {1914918688758184670ULL, 3, MOVE(61, 54, 0x0)},
+    {1915407437674664021ULL, 29, MOVE(27, 35, 0x0)},
+    {1915407437674664021ULL, 5, MOVE(27, 36, 0x4)},
+    {1915407437674664021ULL, 1, MOVE(15, 23, 0x0)},
+    {1919751839878199236ULL, 1, MOVE(1, 11, 0x0)},
+    {1920595130209180302ULL, 1, MOVE(13, 21, 0x0)},
+    {1920747597139648146ULL, 2, MOVE(12, 28, 0x1)},
+    {1932338063335811591ULL, 2, MOVE(13, 21, 0x0)},
+    {1933723860680260813ULL, 1, MOVE(51, 35, 0x1)},
+    {1934715361502469078ULL, 1, MOVE(5, 33, 0x0)},
+    {1935667290507147140ULL, 8, MOVE(30, 37, 0x0)},
+    {1935667290507147140ULL, 3, MOVE(55, 39, 0x1)},
+    {1935667290507147140ULL, 1, MOVE(30, 51, 0x0)},
+    {1940781237270161209ULL, 1, MOVE(4, 36, 0x0)},
+    {1940781237270161209ULL, 1, MOVE(2, 29, 0x0)},
+    {1942747963897999773ULL, 27, MOVE(3, 1, 0x2)},
+    {1942747963897999773ULL, 3, MOVE(13, 29, 0x1)},
+    {1943139704514941389ULL, 45, MOVE(42, 52, 0x0)},
+    {1944062507852338972ULL, 1, MOVE(6, 21, 0x0)},
+    {1949802801493791928ULL, 1, MOVE(61, 25, 0x0)},
+    {1952249319877166676ULL, 1, MOVE(25, 18, 0x4)},
+    {1959094261608666195ULL, 1, MOVE(49, 41, 0x0)},
+    {1967469480015213900ULL, 23, MOVE(53, 37, 0x1)},
+    {1967469480015213900ULL, 4, MOVE(57, 51, 0x0)},
+    {1967469480015213900ULL, 2, MOVE(54, 46, 0x0)},
+    {1967491790859006191ULL, 1, MOVE(58, 51, 0x0)},
+    {1974160215403994623ULL, 1, MOVE(30, 21, 0x4)},
+    {1974527729233180432ULL, 3, MOVE(13, 21, 0x0)},
+    {1976467755240000960ULL, 4, MOVE(51, 43, 0x0)},
+    {1977369784090397672ULL, 1, MOVE(61, 54, 0x0)},
+    {1978125847260466911ULL, 1, MOVE(52, 36, 0x1)},
+    {1978517871763870368ULL, 1, MOVE(36, 27, 0x4)},
+    {1979039845806718188ULL, 1, MOVE(43, 36, 0x4)},
+    {1984178656767705762ULL, 2, MOVE(12, 28, 0x1)},
+    {1985071777532431226ULL, 3, MOVE(2, 9, 0x0)},
+    {1985071777532431226ULL, 3, MOVE(29, 36, 0x4)},
+    {1989117655144510564ULL, 3, MOVE(62, 45, 0x0)},
+    {1989117655144510564ULL, 1, MOVE(58, 51, 0x0)},
+    {1989117655144510564ULL, 1, MOVE(53, 45, 0x0)},
+    {1991589756165033547ULL, 3, MOVE(49, 41, 0x0)},
+    {1991589756165033547ULL, 2, MOVE(62, 45, 0x0)},
+    {1992228808461556049ULL, 2, MOVE(59, 57, 0x2)},
+    {1992228808461556049ULL, 1, MOVE(53, 37, 0x1)},
+    {1994812713343852265ULL, 1, MOVE(57, 42, 0x0)},
+    {1996032072773836353ULL, 1, MOVE(50, 34, 0x1)},
+    {2001787312012367981ULL, 1, MOVE(12, 28, 0x1)},
+    {2005715782051062960ULL, 1, MOVE(2, 29, 0x0)},
+    {2005761301455442609ULL, 3, MOVE(52, 44, 0x0)},
+    {2005761301455442609ULL, 1, MOVE(53, 45, 0x0)},
+    {2007182963251330080ULL, 58, MOVE(51, 43, 0x0)},
+    {2007615527468979127ULL, 1, MOVE(18, 28, 0x4)},
+    {2011886514712278198ULL, 1, MOVE(2, 38, 0x0)},
+    {2015566470739782375ULL, 1, MOVE(2, 9, 0x0)},
+    {2020357608620491316ULL, 1, MOVE(48, 40, 0x0)},
+    {2025925735923245328ULL, 4, MOVE(2, 9, 0x0)},
+    {2030037965993528977ULL, 25, MOVE(3, 1, 0x2)},
+    {2036112602586856111ULL, 32, MOVE(13, 29, 0x1)},
+    {2036112602586856111ULL, 14, MOVE(5, 26, 0x0)},
+    {2036112602586856111ULL, 9, MOVE(9, 17, 0x0)},
+    {2036112602586856111ULL, 9, MOVE(11, 19, 0x0)},
+    {2036112602586856111ULL, 5, MOVE(5, 33, 0x0)},
+    {2055663871327601170ULL, 1, MOVE(61, 54, 0x0)},
+    {2057198953508681063ULL, 1, MOVE(61, 34, 0x0)},
+    {2060468183472242728ULL, 17, MOVE(2, 9, 0x0)},
+    {2060468183472242728ULL, 2, MOVE(11, 27, 0x1)},
+    {2060636731246475643ULL, 1, MOVE(11, 27, 0x1)},
+    {2063254687334640552ULL, 1, MOVE(57, 42, 0x0)},
+    {2065113424820093588ULL, 1, MOVE(51, 43, 0x0)},
+    {2072488761328328028ULL, 1, MOVE(58, 49, 0x0)},
+    {2082559453057686086ULL, 64, MOVE(60, 53, 0x0)},
+    {2082559453057686086ULL, 45, MOVE(55, 47, 0x0)},
+    {2082559453057686086ULL, 10, MOVE(52, 44, 0x0)},
+    {2082559453057686086ULL, 6, MOVE(57, 42, 0x0)},
+    {2082618502995050809ULL, 1, MOVE(55, 47, 0x0)},
+    {2082746201644327278ULL, 30, MOVE(2, 20, 0x0)},
+    {2082746201644327278ULL, 11, MOVE(28, 35, 0x4)},
+    {2089109217373219756ULL, 714, MOVE(1, 18, 0x0)},
+    {2089109217373219756ULL, 307, MOVE(6, 21, 0x0)},
+    {2089109217373219756ULL, 156, MOVE(9, 17, 0x0)},
+    {2089268798601220172ULL, 1, MOVE(2, 9, 0x0)},
+    {2090097753326651100ULL, 19, MOVE(54, 46, 0x0)},
+    {2090097753326651100ULL, 2, MOVE(62, 45, 0x0)},
+    {2090097753326651100ULL, 2, MOVE(52, 36, 0x1)},
+    {2093459012773544304ULL, 1, MOVE(61, 25, 0x0)},
+    {2093459012773544304ULL, 1, MOVE(58, 51, 0x0)},
+    {2093600658088600321ULL, 417, MOVE(52, 36, 0x1)},
+    {2093600658088600321ULL, 231, MOVE(54, 46, 0x0)},
+    {2093600658088600321ULL, 35, MOVE(58, 30, 0x0)},
+    {2093600658088600321ULL, 29, MOVE(53, 37, 0x1)},
+    {2093600658088600321ULL, 1, MOVE(62, 45, 0x0)},
+    {2093600658088600321ULL, 1, MOVE(55, 47, 0x0)},
+    {2098410748814205264ULL, 1, MOVE(29, 36, 0x4)},
+    {2101411368492197004ULL, 2, MOVE(58, 49, 0x0)},
+    {2104842608597774724ULL, 4, MOVE(12, 27, 0x4)},
+    {2110323922119010944ULL, 1, MOVE(62, 45, 0x0)},
+    {2110323922119010944ULL, 1, MOVE(49, 41, 0x0)},
+    {2113519253081794761ULL, 2, MOVE(4, 5, 0x0)},
+    {2116438952411349496ULL, 11, MOVE(13, 21, 0x0)},
+    {2117855134427549590ULL, 1, MOVE(53, 37, 0x1)},
+    {2126653161014440036ULL, 5, MOVE(58, 49, 0x0)},
+    {2127131855982589216ULL, 2, MOVE(52, 36, 0x1)},
+    {2128476258471939020ULL, 1, MOVE(37, 28, 0x4)},
+    {2132669888279692264ULL, 1, MOVE(5, 14, 0x0)},
+    {2133389523756470536ULL, 1, MOVE(30, 58, 0x0)},
+    {2134500069948893010ULL, 7, MOVE(18, 28, 0x4)},
+    {2134500069948893010ULL, 3, MOVE(27, 36, 0x4)},
+    {2137984931330708089ULL, 1, MOVE(52, 36, 0x1)},
+    {2144397341453709056ULL, 2, MOVE(18, 12, 0x0)},
+    {2145754447149733268ULL, 2, MOVE(11, 19, 0x0)},
+    {2145754447149733268ULL, 1, MOVE(13, 21, 0x0)},
+    {2150018918300696807ULL, 1, MOVE(51, 42, 0x4)},
+    {2160504995969215656ULL, 1, MOVE(58, 30, 0x0)},
+    {2161924089453353437ULL, 1, MOVE(2, 9, 0x0)},
+    {2170996588730705085ULL, 52, MOVE(57, 42, 0x0)},
+    {2170996588730705085ULL, 15, MOVE(62, 45, 0x0)},
+    {2170996588730705085ULL, 13, MOVE(58, 30, 0x0)},
+    {2170996588730705085ULL, 2, MOVE(52, 44, 0x0)},
+    {2185107376395608112ULL, 7, MOVE(2, 11, 0x0)},
+    {2185107376395608112ULL, 2, MOVE(8, 16, 0x0)},
+    {2185107376395608112ULL, 1, MOVE(5, 26, 0x0)},
+    {2185107376395608112ULL, 1, MOVE(5, 19, 0x0)},
+    {2186601588352686345ULL, 9, MOVE(11, 27, 0x1)},
+    {2186601588352686345ULL, 1, MOVE(11, 19, 0x0)},
+    {2191941687698111428ULL, 2, MOVE(58, 49, 0x0)},
+    {2191941687698111428ULL, 1, MOVE(62, 45, 0x0)},
+    {2191941687698111428ULL, 1, MOVE(52, 36, 0x1)},
+    {2191999413442801878ULL, 4, MOVE(52, 44, 0x0)},
+    {2195707318273697297ULL, 3, MOVE(42, 36, 0x0)},
+    {2195763677651889364ULL, 1, MOVE(1, 18, 0x0)},
+    {2209618419780457931ULL, 1, MOVE(61, 54, 0x0)},
+    {2215314339641274837ULL, 1, MOVE(4, 13, 0x0)},
+    {2215314339641274837ULL, 1, MOVE(2, 20, 0x0)},
+    {2218778545920829921ULL, 1, MOVE(60, 46, 0x0)},
+    {2219195368029115391ULL, 4, MOVE(51, 35, 0x1)},
+    {2219195368029115391ULL, 3, MOVE(57, 42, 0x0)},
+    {2219891611449365355ULL, 1, MOVE(52, 36, 0x1)},
+    {2228310023191286898ULL, 7, MOVE(58, 30, 0x0)},
+    {2228310023191286898ULL, 3, MOVE(60, 53, 0x0)},
+    {2228310023191286898ULL, 2, MOVE(52, 36, 0x1)},
+    {2228310023191286898ULL, 1, MOVE(62, 45, 0x0)},
+    {2235228473008902572ULL, 1, MOVE(57, 42, 0x0)},
+    {2239512097061721391ULL, 1, MOVE(51, 43, 0x0)},
+    {2239876910941901166ULL, 2, MOVE(42, 36, 0x4)},
+    {2242200468607670578ULL, 13, MOVE(3, 1, 0x2)},
+    {2242200468607670578ULL, 1, MOVE(6, 12, 0x0)},
+    {2242200468607670578ULL, 1, MOVE(8, 16, 0x0)},
+    {2242200468607670578ULL, 1, MOVE(13, 21, 0x0)},
+    {2242403002665599670ULL, 1, MOVE(28, 36, 0x0)},
+    {2242970086618525753ULL, 1, MOVE(57, 42, 0x0)},
+    {2244789367302037848ULL, 1, MOVE(49, 41, 0x0)},
+    {2244976116532642201ULL, 1, MOVE(27, 35, 0x0)},
+    {2249454939323824452ULL, 1, MOVE(13, 21, 0x0)},
+    {2257090688863118597ULL, 8, MOVE(1, 18, 0x0)},
+    {2257090688863118597ULL, 1, MOVE(12, 28, 0x1)},
+    {2266145346668704161ULL, 2, MOVE(57, 51, 0x0)},
+    {2266248750301247751ULL, 1, MOVE(6, 21, 0x0)},
+    {2267484175449666655ULL, 1, MOVE(57, 42, 0x0)},
+    {2276511703931911091ULL, 7, MOVE(52, 36, 0x1)},
+    {2281956486095792335ULL, 1, MOVE(62, 52, 0x0)},
+    {2286439104079961803ULL, 1, MOVE(3, 1, 0x2)},
+    {2287405147878175990ULL, 10, MOVE(28, 36, 0x0)},
+    {2289433994606615773ULL, 1, MOVE(49, 33, 0x1)},
+    {2290372404452956331ULL, 1, MOVE(8, 16, 0x0)},
+    {2292401931599415760ULL, 1, MOVE(62, 45, 0x0)},
+    {2293604913627678471ULL, 1, MOVE(51, 43, 0x0)},
+    {2295514213077824672ULL, 2, MOVE(37, 28, 0x4)},
+    {2300889168127978200ULL, 1, MOVE(54, 46, 0x0)},
+    {2300889168127978200ULL, 1, MOVE(53, 37, 0x1)},
+    {2300916937070186717ULL, 1, MOVE(49, 33, 0x1)},
+    {2301175346920265746ULL, 15, MOVE(1, 18, 0x0)},
+    {2301175346920265746ULL, 13, MOVE(11, 27, 0x1)},
+    {2301175346920265746ULL, 12, MOVE(12, 28, 0x1)},
+    {2301175346920265746ULL, 1, MOVE(9, 17, 0x0)},
+    {2301175346920265746ULL, 1, MOVE(11, 19, 0x0)},
+    {2301175346920265746ULL, 1, MOVE(14, 22, 0x0)},
+    {2301175346920265746ULL, 1, MOVE(6, 21, 0x0)},
+    {2301266309358357510ULL, 1, MOVE(29, 38, 0x4)},
+    {2304383845458167546ULL, 1, MOVE(55, 47, 0x0)},
+    {2307138913022321259ULL, 1, MOVE(6, 21, 0x0)},
+    {2307367954850281513ULL, 1, MOVE(13, 21, 0x0)},
+    {2307367954850281513ULL, 1, MOVE(14, 22, 0x0)},
+    {2310651779669703706ULL, 9, MOVE(2, 9, 0x0)},
+    {2313230668809981331ULL, 1, MOVE(2, 9, 0x0)},
+    {2314509911413071994ULL, 1, MOVE(11, 19, 0x0)},
+    {2316627217664730158ULL, 2, MOVE(2, 29, 0x4)},
+    {2321907736621156045ULL, 1, MOVE(58, 51, 0x0)},
+    {2324544085686870754ULL, 1, MOVE(57, 42, 0x0)},
+    {2327473275834213946ULL, 1, MOVE(5, 33, 0x0)},
+    {2330675613591654622ULL, 1, MOVE(13, 29, 0x1)},
+    {2331678092671162915ULL, 2, MOVE(2, 9, 0x0)},
+    {2332296227316134300ULL, 2, MOVE(35, 27, 0x0)},
+    {2332761655682740393ULL, 1, MOVE(57, 42, 0x0)},
+    {2337981651334467430ULL, 1, MOVE(37, 28, 0x4)},
+    {2338757539548132740ULL, 22, MOVE(42, 36, 0x4)},
+    {2340727807478951554ULL, 7, MOVE(52, 36, 0x1)},
+    {2340727807478951554ULL, 1, MOVE(54, 38, 0x1)},
+    {2341762999788705279ULL, 1, MOVE(61, 54, 0x0)},
+    {2344700836357712216ULL, 3, MOVE(37, 30, 0x4)},
+    {2346112283035786720ULL, 4, MOVE(57, 42, 0x0)},
+    {2346112283035786720ULL, 3, MOVE(62, 45, 0x0)},
+    {2349425162729810088ULL, 115, MOVE(44, 36, 0x0)},
+    {2349425162729810088ULL, 1, MOVE(58, 51, 0x0)},
+    {2357989876182534438ULL, 2, MOVE(11, 19, 0x0)},
+    {2357989876182534438ULL, 1, MOVE(1, 18, 0x0)},
+    {2363571776061342737ULL, 1, MOVE(62, 45, 0x0)},
+    {2364379553530036849ULL, 3, MOVE(38, 30, 0x0)},
+    {2366581133812214499ULL, 1, MOVE(6, 21, 0x0)},
+    {2368873847492442997ULL, 1, MOVE(61, 34, 0x0)},
+    {2369033366753316093ULL, 1, MOVE(57, 51, 0x0)},
+    {2369658747188698319ULL, 1, MOVE(53, 37, 0x1)},
+    {2377697397716333952ULL, 6, MOVE(11, 19, 0x0)},
+    {2377697397716333952ULL, 5, MOVE(6, 12, 0x0)},
+    {2377697397716333952ULL, 3, MOVE(6, 21, 0x0)},
+    {2377697397716333952ULL, 3, MOVE(4, 13, 0x0)},
+    {2377697397716333952ULL, 2, MOVE(9, 17, 0x0)},
+    {2377697397716333952ULL, 1, MOVE(14, 22, 0x0)},
+    {2387677090272967736ULL, 1, MOVE(4, 22, 0x0)},
+    {2399245229915384733ULL, 2, MOVE(19, 28, 0x4)},
+    {2399964491846677222ULL, 1, MOVE(15, 23, 0x0)},
+    {2402313572552456480ULL, 1, MOVE(1, 18, 0x0)},
+    {2411697302306059610ULL, 2, MOVE(52, 44, 0x0)},
+    {2411697302306059610ULL, 1, MOVE(62, 45, 0x0)},
+    {2411697302306059610ULL, 1, MOVE(57, 42, 0x0)},
+    {2412718457320762017ULL, 13, MOVE(12, 28, 0x1)},
+    {2412718457320762017ULL, 1, MOVE(9, 17, 0x0)},
+    {2413318848762180534ULL, 28, MOVE(58, 51, 0x0)},
+    {2413318848762180534ULL, 1, MOVE(53, 37, 0x1)},
+    {2420094605587132089ULL, 1, MOVE(9, 17, 0x0)},
+    {2427479130227997270ULL, 1, MOVE(52, 44, 0x0)},
+    {2427767664370733664ULL, 19, MOVE(58, 49, 0x0)},
+    {2427767664370733664ULL, 1, MOVE(60, 53, 0x0)},
+    {2428708951008651551ULL, 1, MOVE(1, 18, 0x0)},
+    {2430836147143309764ULL, 1, MOVE(58, 30, 0x0)},
+    {2431275971508840765ULL, 15, MOVE(3, 1, 0x2)},
+    {2431275971508840765ULL, 1, MOVE(12, 28, 0x1)},
+    {2432950891659619128ULL, 1, MOVE(49, 41, 0x0)},
+    {2434597154343364861ULL, 1, MOVE(49, 41, 0x0)},
+    {2435442547058127667ULL, 8, MOVE(52, 44, 0x0)},
+    {2436054827271930815ULL, 3, MOVE(53, 37, 0x1)},
+    {2436054827271930815ULL, 1, MOVE(52, 36, 0x1)},
+    {2438367529030610867ULL, 1, MOVE(30, 21, 0x4)},
+    {2439967243300684255ULL, 1, MOVE(14, 21, 0x4)},
+    {2440405679371428750ULL, 2, MOVE(6, 21, 0x0)},
+    {2440405679371428750ULL, 1, MOVE(12, 28, 0x1)},
+    {2444896401675128976ULL, 1, MOVE(57, 42, 0x0)},
+    {2448743964428755036ULL, 1, MOVE(57, 51, 0x0)},
+    {2448743964428755036ULL, 1, MOVE(49, 41, 0x0)},
+    {2448743964428755036ULL, 1, MOVE(57, 42, 0x0)},
+    {2451819560297695412ULL, 1, MOVE(54, 38, 0x1)},
+    {2453279773812829633ULL, 2, MOVE(9, 17, 0x0)},
+    {2463516896765616166ULL, 1, MOVE(51, 35, 0x1)},
+    {2468128890256593983ULL, 1, MOVE(12, 28, 0x1)},
+    {2469568715001403338ULL, 1, MOVE(55, 47, 0x0)},
+    {2469568715001403338ULL, 1, MOVE(51, 35, 0x1)},
+    {2471150850997830812ULL, 6, MOVE(61, 54, 0x0)},
+    {2471150850997830812ULL, 3, MOVE(42, 27, 0x0)},
+    {2471150850997830812ULL, 2, MOVE(59, 57, 0x2)},
+    {2474217309553964944ULL, 3, MOVE(52, 44, 0x0)},
+    {2478898424831934554ULL, 1, MOVE(2, 38, 0x0)},
+    {2482511705328299730ULL, 1, MOVE(42, 36, 0x4)},
+    {2483652895203617156ULL, 1, MOVE(54, 45, 0x4)},
+    {2483736572461555677ULL, 1, MOVE(12, 28, 0x1)},
+    {2486675102585868444ULL, 3, MOVE(2, 29, 0x0)},
+    {2486675102585868444ULL, 1, MOVE(9, 25, 0x1)},
+    {2487747288420277583ULL, 1, MOVE(11, 19, 0x0)},
+    {2487747288420277583ULL, 1, MOVE(4, 13, 0x0)},
+    {2488309896203338203ULL, 1, MOVE(36, 27, 0x4)},
+    {2495910114624708337ULL, 1, MOVE(5, 26, 0x0)},
+    {2501479319975747029ULL, 1, MOVE(5, 14, 0x0)},
+    {2501578675895032961ULL, 3, MOVE(53, 45, 0x0)},
+    {2501578675895032961ULL, 1, MOVE(36, 29, 0x4)},
+    {2502997548444194087ULL, 10, MOVE(5, 19, 0x0)},
+    {2502997548444194087ULL, 3, MOVE(1, 18, 0x0)},
+    {2502997548444194087ULL, 3, MOVE(10, 26, 0x1)},
+    {2502997548444194087ULL, 1, MOVE(5, 33, 0x0)},
+    {2505803546339071536ULL, 13, MOVE(3, 1, 0x2)},
+    {2505803546339071536ULL, 4, MOVE(13, 29, 0x1)},
+    {2507386347591941379ULL, 1, MOVE(37, 28, 0x4)},
+    {2510191260843429170ULL, 1, MOVE(62, 45, 0x0)},
+    {2521888130374636711ULL, 1, MOVE(28, 37, 0x4)},
+    {2530102193922880664ULL, 2, MOVE(62, 45, 0x0)},
+    {2533458225393825749ULL, 1, MOVE(9, 17, 0x0)},
+    {2533751691898984409ULL, 1, MOVE(33, 24, 0x0)},
+    {2534106938456727929ULL, 1, MOVE(58, 49, 0x0)},
+    {2538729223371410991ULL, 19, MOVE(27, 35, 0x0)},
+    {2539549800177039240ULL, 3, MOVE(61, 25, 0x0)},
+    {2539549800177039240ULL, 2, MOVE(57, 42, 0x0)},
+    {2539549800177039240ULL, 1, MOVE(61, 34, 0x0)},
+    {2550683291353002075ULL, 1, MOVE(8, 16, 0x0)},
+    {2551569142855406141ULL, 1, MOVE(58, 30, 0x0)},
+    {2552807144255041100ULL, 4, MOVE(49, 41, 0x0)},
+    {2555131039920091715ULL, 1, MOVE(58, 30, 0x0)},
+    {2555499046706866079ULL, 1, MOVE(58, 49, 0x0)},
+    {2556933383735889692ULL, 3, MOVE(3, 1, 0x2)},
+    {2560096435412964792ULL, 1, MOVE(51, 43, 0x0)},
+    {2563168401952395121ULL, 41, MOVE(30, 21, 0x4)},
+    {2567802458423663602ULL, 1, MOVE(2, 29, 0x0)},
+    {2568362333663799763ULL, 1, MOVE(1, 18, 0x0)},
+    {2569514779259505425ULL, 7, MOVE(58, 30, 0x0)},
+    {2572225391431321841ULL, 1, MOVE(61, 54, 0x0)},
+    {2577906674093469537ULL, 1, MOVE(5, 12, 0x0)},
+    {2577906674093469537ULL, 1, MOVE(6, 21, 0x0)},
+    {2587095624732631979ULL, 6, MOVE(36, 29, 0x4)},
+    {2587095624732631979ULL, 4, MOVE(57, 42, 0x0)},
+    {2589573158679575216ULL, 7, MOVE(13, 29, 0x1)},
+    {2589573158679575216ULL, 4, MOVE(9, 17, 0x0)},
+    {2589573158679575216ULL, 3, MOVE(6, 21, 0x0)},
+    {2591917515717564953ULL, 1, MOVE(57, 42, 0x0)},
+    {2595882043065686363ULL, 1, MOVE(51, 35, 0x1)},
+    {2596822485337730129ULL, 1, MOVE(61, 25, 0x0)},
+    {2600870248927308519ULL, 1, MOVE(4, 28, 0x4)},
+    {2603494693372094541ULL, 5, MOVE(27, 35, 0x0)},
+    {2603494693372094541ULL, 1, MOVE(27, 36, 0x4)},
+    {2605231684137122359ULL, 3, MOVE(58, 51, 0x0)},
+    {2609093418223395632ULL, 1, MOVE(11, 19, 0x0)},
+    {2609441760426122135ULL, 1, MOVE(15, 31, 0x1)},
+    {2614032169125113677ULL, 1, MOVE(51, 43, 0x0)},
+    {2615527265235199523ULL, 46, MOVE(27, 17, 0x0)},
+    {2615527265235199523ULL, 2, MOVE(27, 37, 0x0)},
+    {2615527265235199523ULL, 1, MOVE(4, 18, 0x0)},
+    {2617186323517748223ULL, 1, MOVE(9, 17, 0x0)},
+    {2617186323517748223ULL, 1, MOVE(11, 27, 0x1)},
+    {2620305130306227513ULL, 1, MOVE(59, 57, 0x2)},
+    {2621311469583977504ULL, 61, MOVE(57, 42, 0x0)},
+    {2621311469583977504ULL, 7, MOVE(49, 41, 0x0)},
+    {2621311469583977504ULL, 1, MOVE(53, 45, 0x0)},
+    {2623649743808520574ULL, 1, MOVE(8, 24, 0x1)},
+    {2624576623075250299ULL, 4, MOVE(51, 43, 0x0)},
+    {2624576623075250299ULL, 2, MOVE(61, 34, 0x0)},
+    {2635775079343458626ULL, 1, MOVE(6, 21, 0x0)},
+    {2637325078254515361ULL, 3, MOVE(59, 57, 0x2)},
+    {2642573023987310214ULL, 1, MOVE(58, 51, 0x0)},
+    {2642573023987310214ULL, 1, MOVE(52, 36, 0x1)},
+    {2642654650734252875ULL, 1, MOVE(35, 28, 0x4)},
+    {2643608541490629217ULL, 1, MOVE(57, 42, 0x0)},
+    {2643863403419545525ULL, 1, MOVE(2, 9, 0x0)},
+    {2646975902456156113ULL, 1, MOVE(49, 41, 0x0)},
+    {2649350018744866719ULL, 8, MOVE(57, 42, 0x0)},
+    {2652584088351654159ULL, 1, MOVE(43, 36, 0x4)},
+    {2655257308568914369ULL, 1, MOVE(31, 29, 0x4)},
+    {2657755876041350308ULL, 3, MOVE(59, 57, 0x2)},
+    {2657755876041350308ULL, 1, MOVE(52, 36, 0x1)},
+    {2657755876041350308ULL, 1, MOVE(53, 37, 0x1)},
+    {2666486151169651262ULL, 1, MOVE(3, 1, 0x2)},
+    {2670599711321406629ULL, 2, MOVE(11, 19, 0x0)},
+    {2673615978057517582ULL, 1, MOVE(45, 36, 0x4)},
+    {2674412997242402908ULL, 202, MOVE(52, 36, 0x1)},
+    {2675205998871724834ULL, 1, MOVE(2, 9, 0x0)},
+    {2678608122075465559ULL, 1, MOVE(2, 29, 0x0)},
+    {2678608122075465559ULL, 1, MOVE(2, 38, 0x0)},
+    {2680562559861720671ULL, 3, MOVE(9, 17, 0x0)},
+    {2686522839171844549ULL, 7, MOVE(51, 43, 0x0)},
+    {2686522839171844549ULL, 3, MOVE(49, 41, 0x0)},
+    {2688759994930025472ULL, 1, MOVE(11, 27, 0x1)},
+    {2689691912540931290ULL, 1, MOVE(52, 44, 0x0)},
+    {2698255297296854847ULL, 2, MOVE(58, 30, 0x0)},
+    {2698255297296854847ULL, 1, MOVE(55, 47, 0x0)},
+    {2698255297296854847ULL, 1, MOVE(52, 36, 0x1)},
+    {2700327940194563397ULL, 18, MOVE(57, 42, 0x0)},
+    {2704646598920888075ULL, 23, MOVE(42, 36, 0x4)},
+    {2704646598920888075ULL, 5, MOVE(37, 28, 0x4)},
+    {2705603512700812536ULL, 1, MOVE(37, 28, 0x4)},
+    {2709471811406604004ULL, 2, MOVE(60, 46, 0x0)},
+    {2709471811406604004ULL, 1, MOVE(62, 45, 0x0)},
+    {2709471811406604004ULL, 1, MOVE(37, 28, 0x4)},
+    {2710747474936077997ULL, 1, MOVE(59, 57, 0x2)},
+    {2716975092955484280ULL, 1, MOVE(57, 42, 0x0)},
+    {2717384055191503525ULL, 1, MOVE(51, 43, 0x0)},
+    {2718855981710391707ULL, 1, MOVE(58, 49, 0x0)},
+    {2719467177570820237ULL, 1, MOVE(49, 41, 0x0)},
+    {2723831351951246258ULL, 1, MOVE(54, 38, 0x1)},
+    {2726021575359244728ULL, 2, MOVE(60, 51, 0x0)},
+    {2734923663429704166ULL, 3, MOVE(2, 9, 0x0)},
+    {2735451798568382007ULL, 122, MOVE(29, 36, 0x4)},
+    {2735451798568382007ULL, 88, MOVE(1, 18, 0x0)},
+    {2735451798568382007ULL, 26, MOVE(5, 33, 0x0)},
+    {2735451798568382007ULL, 22, MOVE(5, 26, 0x0)},
+    {2735451798568382007ULL, 8, MOVE(4, 22, 0x0)},
+    {2735451798568382007ULL, 2, MOVE(11, 19, 0x0)},
+    {2741397821981498825ULL, 63, MOVE(61, 34, 0x0)},
+    {2741397821981498825ULL, 18, MOVE(51, 43, 0x0)},
+    {2741397821981498825ULL, 1, MOVE(61, 25, 0x0)},
+    {2741996631957972976ULL, 3, MOVE(59, 57, 0x2)},
+    {2741996631957972976ULL, 2, MOVE(52, 36, 0x1)},
+    {2742385162372852499ULL, 2, MOVE(18, 28, 0x4)},
+    {2747418619995667084ULL, 1, MOVE(4, 12, 0x0)},
+    {2750588459937958277ULL, 1, MOVE(57, 42, 0x0)},
+    {2757588292824142729ULL, 1, MOVE(58, 37, 0x0)},
+    {2758470280651048588ULL, 2, MOVE(3, 1, 0x2)},
+    {2762207527424417380ULL, 33, MOVE(2, 9, 0x0)},
+    {2767908610041916497ULL, 1, MOVE(47, 37, 0x4)},
+    {2769349522364596657ULL, 16, MOVE(2, 20, 0x0)},
+    {2769349522364596657ULL, 12, MOVE(13, 29, 0x1)},
+    {2769349522364596657ULL, 3, MOVE(1, 18, 0x0)},
+    {2769349522364596657ULL, 1, MOVE(5, 26, 0x0)},
+    {2775107915265966558ULL, 29, MOVE(52, 36, 0x1)},
+    {2775107915265966558ULL, 7, MOVE(53, 37, 0x1)},
+    {2775107915265966558ULL, 6, MOVE(58, 30, 0x0)},
+    {2776220879548718950ULL, 2, MOVE(58, 49, 0x0)},
+    {2778451757734466873ULL, 2, MOVE(11, 19, 0x0)},
+    {2778451757734466873ULL, 1, MOVE(12, 20, 0x0)},
+    {2791689742260149624ULL, 1, MOVE(35, 28, 0x4)},
+    {2792475244601652145ULL, 1, MOVE(57, 42, 0x0)},
+    {2796280262426834101ULL, 2, MOVE(53, 37, 0x1)},
+    {2796280262426834101ULL, 1, MOVE(57, 42, 0x0)},
+    {2797284083970668928ULL, 30, MOVE(6, 21, 0x0)},
+    {2797284083970668928ULL, 10, MOVE(9, 17, 0x0)},
+    {2797284083970668928ULL, 3, MOVE(12, 28, 0x1)},
+    {2797284083970668928ULL, 1, MOVE(14, 22, 0x0)},
+    {2797284083970668928ULL, 1, MOVE(11, 19, 0x0)},
+    {2800086832721075195ULL, 1, MOVE(59, 57, 0x2)},
+    {2807398840103583180ULL, 1, MOVE(1, 18, 0x0)},
+    {2812344339552456972ULL, 28, MOVE(29, 36, 0x4)},
+    {2812344339552456972ULL, 4, MOVE(11, 19, 0x0)},
+    {2812344339552456972ULL, 1, MOVE(5, 33, 0x0)},
+    {2819635267421188540ULL, 2, MOVE(53, 37, 0x1)},
+    {2821315960154176841ULL, 1, MOVE(55, 39, 0x1)},
+    {2821523153251970917ULL, 2, MOVE(52, 44, 0x0)},
+    {2821965866017399831ULL, 6, MOVE(4, 12, 0x4)},
+    {2821965866017399831ULL, 1, MOVE(6, 12, 0x4)},
+    {2823138037705687082ULL, 2, MOVE(29, 38, 0x4)},
+    {2826594717985452824ULL, 1, MOVE(52, 44, 0x0)},
+    {2832125532970209181ULL, 6, MOVE(52, 44, 0x0)},
+    {2832125532970209181ULL, 2, MOVE(58, 49, 0x0)},
+    {2843498529103349471ULL, 89, MOVE(51, 35, 0x1)},
+    {2843498529103349471ULL, 13, MOVE(52, 44, 0x0)},
+    {2843498529103349471ULL, 1, MOVE(51, 43, 0x0)},
+    {2848727678882463807ULL, 2, MOVE(51, 43, 0x0)},
+    {2848727678882463807ULL, 2, MOVE(62, 45, 0x0)},
+    {2848727678882463807ULL, 1, MOVE(49, 41, 0x0)},
+    {2855087534667142261ULL, 1, MOVE(11, 19, 0x0)},
+    {2859227840215654479ULL, 496, MOVE(12, 28, 0x1)},
+    {2859227840215654479ULL, 79, MOVE(2, 38, 0x0)},
+    {2859227840215654479ULL, 8, MOVE(13, 21, 0x0)},
+    {2859227840215654479ULL, 5, MOVE(6, 21, 0x0)},
+    {2859227840215654479ULL, 2, MOVE(2, 29, 0x0)},
+    {2859227840215654479ULL, 1, MOVE(12, 20, 0x0)},
+    {2862481100648688676ULL, 1, MOVE(59, 57, 0x2)},
+    {2868350059753470263ULL, 1, MOVE(11, 27, 0x1)},
+    {2870234735003405743ULL, 43, MOVE(58, 51, 0x0)},
+    {2870234735003405743ULL, 14, MOVE(36, 29, 0x4)},
+    {2870234735003405743ULL, 10, MOVE(58, 30, 0x0)},
+    {2870350356154325745ULL, 1, MOVE(27, 35, 0x0)},
+    {2871554972380682933ULL, 1, MOVE(58, 49, 0x0)},
+    {2872404793487096103ULL, 1, MOVE(14, 22, 0x0)},
+    {2874650949772251881ULL, 1, MOVE(43, 36, 0x4)},
+    {2874650949772251881ULL, 1, MOVE(42, 36, 0x4)},
+    {2874965990308781633ULL, 1, MOVE(52, 36, 0x1)},
+    {2875828653044774410ULL, 15, MOVE(42, 52, 0x0)},
+    {2875828653044774410ULL, 1, MOVE(42, 57, 0x0)},
+    {2879564391707395409ULL, 8, MOVE(59, 57, 0x2)},
+    {2879564391707395409ULL, 1, MOVE(53, 37, 0x1)},
+    {2879742079958877232ULL, 36, MOVE(36, 29, 0x4)},
+    {2886669060342436932ULL, 12, MOVE(52, 44, 0x0)},
+    {2886669060342436932ULL, 2, MOVE(51, 35, 0x1)},
+    {2887115534459666234ULL, 3, MOVE(11, 19, 0x0)},
+    {2887115534459666234ULL, 1, MOVE(6, 21, 0x0)},
+    {2889929890316926011ULL, 1, MOVE(52, 36, 0x1)},
+    {2893989887187591113ULL, 104, MOVE(11, 27, 0x1)},
+    {2893989887187591113ULL, 15, MOVE(5, 12, 0x0)},
+    {2893989887187591113ULL, 2, MOVE(21, 31, 0x0)},
+    {2893989887187591113ULL, 1, MOVE(1, 18, 0x0)},
+    {2893989887187591113ULL, 1, MOVE(9, 17, 0x0)},
+    {2894679736730455882ULL, 2, MOVE(58, 51, 0x0)},
+    {2895546725888111521ULL, 11, MOVE(52, 36, 0x1)},
+    {2895546725888111521ULL, 2, MOVE(58, 59, 0x0)},
+    {2903683551351501155ULL, 1, MOVE(59, 57, 0x2)},
+    {2913244686925594615ULL, 1, MOVE(1, 18, 0x0)},
+    {2913630611276084946ULL, 1, MOVE(58, 49, 0x0)},
+    {2914686970445575431ULL, 1, MOVE(37, 28, 0x4)},
+    {2915940882319717712ULL, 1, MOVE(53, 37, 0x1)},
+    {2917031049552900547ULL, 1, MOVE(3, 1, 0x2)},
+    {2918906726564822926ULL, 1, MOVE(49, 41, 0x0)},
+    {2918906726564822926ULL, 1, MOVE(54, 38, 0x1)},
+    {2923740835950709053ULL, 1, MOVE(52, 44, 0x0)},
+    {2931371582047688027ULL, 1, MOVE(52, 44, 0x0)},
+    {2931941168010677267ULL, 29, MOVE(51, 43, 0x0)},
+    {2931941168010677267ULL, 19, MOVE(53, 45, 0x0)},
+    {2931941168010677267ULL, 8, MOVE(49, 41, 0x0)},
+    {2931941168010677267ULL, 4, MOVE(53, 37, 0x1)},
+    {2931941168010677267ULL, 3, MOVE(61, 25, 0x0)},
+    {2931941168010677267ULL, 1, MOVE(62, 52, 0x0)},
+    {2931941168010677267ULL, 1, MOVE(61, 34, 0x0)},
+    {2933402362267935935ULL, 1, MOVE(51, 35, 0x1)},
+    {2933483170796615293ULL, 1, MOVE(2, 29, 0x0)},
+    {2935291307738895203ULL, 1, MOVE(42, 52, 0x0)},
+    {2938365375707818714ULL, 1, MOVE(2, 9, 0x0)},
+    {2940903930875650287ULL, 2, MOVE(18, 28, 0x4)},
+    {2941440076483545021ULL, 2, MOVE(5, 33, 0x0)},
+    {2941440076483545021ULL, 1, MOVE(9, 17, 0x0)},
+    {2945579612120563166ULL, 1, MOVE(49, 41, 0x0)},
+    {2945708095383972749ULL, 1, MOVE(1, 11, 0x0)},
+    {2951681942150231560ULL, 1, MOVE(13, 29, 0x1)},
+    {2954074423979448795ULL, 1, MOVE(62, 45, 0x0)},
+    {2956479477355012859ULL, 1, MOVE(52, 36, 0x1)},
+    {2957571602581058142ULL, 1, MOVE(52, 44, 0x0)},
+    {2959447677840673346ULL, 2, MOVE(43, 35, 0x0)},
+    {2959447677840673346ULL, 1, MOVE(58, 51, 0x0)},
+    {2967359931513904858ULL, 1, MOVE(57, 42, 0x0)},
+    {2967698932998918681ULL, 1, MOVE(3, 1, 0x2)},
+    {2972254706930812946ULL, 22, MOVE(29, 36, 0x4)},
+    {2977727989287694999ULL, 1021, MOVE(2, 38, 0x0)},
+    {2977727989287694999ULL, 223, MOVE(2, 29, 0x0)},
+    {2977727989287694999ULL, 73, MOVE(12, 28, 0x1)},
+    {2977727989287694999ULL, 44, MOVE(6, 21, 0x0)},
+    {2977727989287694999ULL, 2, MOVE(13, 21, 0x0)},
+    {2977727989287694999ULL, 1, MOVE(12, 20, 0x0)},
+    {2977727989287694999ULL, 1, MOVE(2, 11, 0x0)},
+    {2977727989287694999ULL, 1, MOVE(9, 17, 0x0)},
+    {2981303792849781299ULL, 1, MOVE(58, 37, 0x0)},
+    {2983811426470722456ULL, 2, MOVE(57, 42, 0x0)},
+    {3000495139708900151ULL, 1, MOVE(4, 28, 0x4)},
+    {3002712427760557864ULL, 4, MOVE(58, 51, 0x0)},
+    {3006707632192664336ULL, 3, MOVE(57, 42, 0x0)},
+    {3006707632192664336ULL, 1, MOVE(51, 43, 0x0)},
+    {3008848162440257535ULL, 8, MOVE(43, 36, 0x4)},
+    {3010295623396451285ULL, 41, MOVE(42, 27, 0x4)},
+    {3013905569081571243ULL, 1, MOVE(2, 20, 0x0)},
+    {3014933705920257963ULL, 1, MOVE(58, 49, 0x0)},
+    {3020983148694912262ULL, 32, MOVE(53, 45, 0x0)},
+    {3020983148694912262ULL, 27, MOVE(58, 49, 0x0)},
+    {3020983148694912262ULL, 4, MOVE(53, 37, 0x1)},
+    {3020983148694912262ULL, 2, MOVE(52, 36, 0x1)},
+    {3028771395365464983ULL, 1, MOVE(48, 40, 0x0)},
+    {3032034964129158385ULL, 5, MOVE(45, 36, 0x4)},
+    {3032696441221770135ULL, 2, MOVE(58, 51, 0x0)},
+    {3032696441221770135ULL, 1, MOVE(53, 37, 0x1)},
+    {3034012692994278010ULL, 1, MOVE(3, 1, 0x2)},
+    {3036975654517428387ULL, 1, MOVE(28, 22, 0x0)},
+    {3036975654517428387ULL, 1, MOVE(28, 18, 0x0)},
+    {3037229842427146040ULL, 1, MOVE(43, 36, 0x4)},
+    {3037644815974198949ULL, 32, MOVE(52, 36, 0x1)},
+    {3037644815974198949ULL, 28, MOVE(62, 45, 0x0)},
+    {3037644815974198949ULL, 11, MOVE(51, 43, 0x0)},
+    {3037644815974198949ULL, 3, MOVE(49, 41, 0x0)},
+    {3037644815974198949ULL, 1, MOVE(54, 46, 0x0)},
+    {3046593449084903202ULL, 1, MOVE(52, 44, 0x0)},
+    {3049815707414631977ULL, 1, MOVE(36, 29, 0x4)},
+    {3049815707414631977ULL, 1, MOVE(59, 57, 0x2)},
+    {3052467680964930049ULL, 3, MOVE(1, 11, 0x0)},
+    {3055249017335433402ULL, 1, MOVE(51, 35, 0x1)},
+    {3055345220471439193ULL, 12, MOVE(2, 9, 0x0)},
+    {3081624932332351129ULL, 8, MOVE(4, 12, 0x4)},
+    {3086418755054110257ULL, 3, MOVE(2, 9, 0x0)},
+    {3087532017135673061ULL, 4, MOVE(4, 28, 0x4)},
+    {3089809638989619779ULL, 2, MOVE(9, 17, 0x0)},
+    {3089809638989619779ULL, 1, MOVE(6, 21, 0x0)},
+    {3097742310711099765ULL, 5, MOVE(59, 57, 0x2)},
+    {3097855899277558959ULL, 2, MOVE(1, 18, 0x0)},
+    {3099868704944490787ULL, 1, MOVE(58, 49, 0x0)},
+    {3099917265084810194ULL, 6, MOVE(14, 30, 0x1)},
+    {3099917265084810194ULL, 3, MOVE(9, 17, 0x0)},
+    {3109977063751214413ULL, 63, MOVE(2, 9, 0x0)},
+    {3115350044990308470ULL, 1, MOVE(48, 40, 0x0)},
+    {3117948365308243081ULL, 1, MOVE(9, 17, 0x0)},
+    {3123622654575410142ULL, 1, MOVE(5, 14, 0x0)},
+    {3127575946449152423ULL, 5, MOVE(11, 19, 0x0)},
+    {3127575946449152423ULL, 3, MOVE(13, 21, 0x0)},
+    {3133931215092272447ULL, 2, MOVE(36, 27, 0x4)},
+    {3133931215092272447ULL, 1, MOVE(57, 42, 0x0)},
+    {3133931215092272447ULL, 1, MOVE(53, 37, 0x1)},
+    {3140661512706915242ULL, 10, MOVE(18, 28, 0x4)},
+    {3144766583436760674ULL, 1, MOVE(37, 46, 0x0)},
+    {3147469747617919151ULL, 1, MOVE(37, 28, 0x4)},
+    {3153074129709529824ULL, 1, MOVE(58, 49, 0x0)},
+    {3159960464857606070ULL, 1, MOVE(53, 37, 0x1)},
+    {3159960464857606070ULL, 1, MOVE(57, 42, 0x0)},
+    {3159960464857606070ULL, 1, MOVE(51, 35, 0x1)},
+    {3164809494600564886ULL, 1, MOVE(34, 27, 0x4)},
+    {3166471370965575426ULL, 1, MOVE(11, 19, 0x0)},
+    {3167216258108842344ULL, 1, MOVE(13, 21, 0x0)},
+    {3167433037635495492ULL, 1, MOVE(37, 28, 0x4)},
+    {3169412602522514014ULL, 1, MOVE(62, 52, 0x0)},
+    {3171330915962776416ULL, 1, MOVE(1, 18, 0x0)},
+    {3176364777583782124ULL, 12, MOVE(4, 22, 0x0)},
+    {3176364777583782124ULL, 6, MOVE(9, 17, 0x0)},
+    {3176364777583782124ULL, 6, MOVE(4, 31, 0x0)},
+    {3176364777583782124ULL, 5, MOVE(11, 27, 0x1)},
+    {3176364777583782124ULL, 3, MOVE(8, 24, 0x1)},
+    {3176364777583782124ULL, 2, MOVE(12, 20, 0x0)},
+    {3178329194637355050ULL, 2, MOVE(2, 9, 0x0)},
+    {3180140306449991979ULL, 1, MOVE(49, 41, 0x0)},
+    {3180140306449991979ULL, 1, MOVE(51, 35, 0x1)},
+    {3185008070414531576ULL, 1, MOVE(55, 47, 0x0)},
+    {3191478979579164346ULL, 20, MOVE(12, 28, 0x1)},
+    {3191478979579164346ULL, 14, MOVE(3, 1, 0x2)},
+    {3191478979579164346ULL, 12, MOVE(13, 21, 0x0)},
+    {3191478979579164346ULL, 2, MOVE(38, 31, 0x0)},
+    {3191478979579164346ULL, 1, MOVE(15, 31, 0x1)},
+    {3191478979579164346ULL, 1, MOVE(13, 29, 0x1)},
+    {3192423015252793924ULL, 1, MOVE(57, 42, 0x0)},
+    {3196136884870062599ULL, 11, MOVE(4, 31, 0x0)},
+    {3196818871982216944ULL, 1, MOVE(27, 35, 0x0)},
+    {3197367276469563849ULL, 1, MOVE(51, 35, 0x1)},
+    {3200315927029072543ULL, 1, MOVE(12, 20, 0x0)},
+    {3205116026727247601ULL, 1, MOVE(57, 42, 0x0)},
+    {3207668383195850352ULL, 2, MOVE(58, 49, 0x0)},
+    {3207668383195850352ULL, 1, MOVE(36, 29, 0x4)},
+    {3209144858891408054ULL, 127, MOVE(13, 29, 0x1)},
+    {3209144858891408054ULL, 10, MOVE(5, 26, 0x0)},
+    {3209144858891408054ULL, 2, MOVE(9, 17, 0x0)},
+    {3209144858891408054ULL, 2, MOVE(11, 19, 0x0)},
+    {3209144858891408054ULL, 2, MOVE(13, 21, 0x0)},
+    {3210723990256298192ULL, 1, MOVE(49, 41, 0x0)},
+    {3212568664656852983ULL, 2, MOVE(36, 29, 0x4)},
+    {3215723270888588611ULL, 1, MOVE(29, 36, 0x4)},
+    {3222941032202117725ULL, 1, MOVE(5, 14, 0x0)},
+    {3224743661667501963ULL, 8, MOVE(61, 34, 0x0)},
+    {3224743661667501963ULL, 5, MOVE(61, 25, 0x0)},
+    {3232472753245065220ULL, 2, MOVE(52, 36, 0x1)},
+    {3232472753245065220ULL, 1, MOVE(49, 41, 0x0)},
+    {3232472753245065220ULL, 1, MOVE(52, 44, 0x0)},
+    {3232801727254877021ULL, 2, MOVE(59, 57, 0x2)},
+    {3243627631654595273ULL, 2, MOVE(3, 1, 0x2)},
+    {3251840631670739606ULL, 1, MOVE(18, 24, 0x0)},
+    {3262483593097622570ULL, 1, MOVE(12, 20, 0x0)},
+    {3262678903805594319ULL, 1, MOVE(46, 53, 0x0)},
+    {3263596330734302859ULL, 1, MOVE(21, 28, 0x4)},
+    {3264152854861966874ULL, 1, MOVE(12, 28, 0x1)},
+    {3268214958399822074ULL, 1, MOVE(14, 30, 0x1)},
+    {3274043524460057271ULL, 3, MOVE(1, 18, 0x0)},
+    {3274043524460057271ULL, 2, MOVE(2, 20, 0x0)},
+    {3274043524460057271ULL, 1, MOVE(13, 21, 0x0)},
+    {3279538519127023954ULL, 113, MOVE(27, 35, 0x0)},
+    {3279538519127023954ULL, 46, MOVE(6, 21, 0x0)},
+    {3279538519127023954ULL, 32, MOVE(27, 36, 0x4)},
+    {3279538519127023954ULL, 24, MOVE(6, 12, 0x0)},
+    {3279538519127023954ULL, 5, MOVE(10, 18, 0x0)},
+    {3286079214953590217ULL, 2, MOVE(52, 44, 0x0)},
+    {3288291246381348824ULL, 1, MOVE(2, 38, 0x0)},
+    {3290796852604307161ULL, 6, MOVE(35, 27, 0x0)},
+    {3290796852604307161ULL, 2, MOVE(37, 28, 0x4)},
+    {3291723229843673857ULL, 7, MOVE(57, 42, 0x0)},
+    {3291723229843673857ULL, 2, MOVE(55, 47, 0x0)},
+    {3291723229843673857ULL, 1, MOVE(49, 41, 0x0)},
+    {3293031995871834272ULL, 3, MOVE(13, 29, 0x1)},
+    {3293031995871834272ULL, 1, MOVE(2, 20, 0x0)},
+    {3293031995871834272ULL, 1, MOVE(6, 12, 0x0)},
+    {3295156943371690905ULL, 1, MOVE(52, 36, 0x1)},
+    {3298084789424837305ULL, 1, MOVE(58, 51, 0x0)},
+    {3298527352984539554ULL, 1, MOVE(4, 12, 0x0)},
+    {3300256014667870026ULL, 16, MOVE(58, 51, 0x0)},
+    {3300256014667870026ULL, 1, MOVE(35, 28, 0x4)},
+    {3300256014667870026ULL, 1, MOVE(52, 46, 0x0)},
+    {3309964279440569268ULL, 3, MOVE(58, 49, 0x0)},
+    {3313732875402653305ULL, 2, MOVE(27, 36, 0x4)},
+    {3314718949377569420ULL, 1, MOVE(1, 18, 0x0)},
+    {3326158652882032720ULL, 3, MOVE(30, 12, 0x4)},
+    {3328655624250921066ULL, 3, MOVE(59, 57, 0x2)},
+    {3334828069241521733ULL, 1, MOVE(57, 42, 0x0)},
+    {3338049629144311765ULL, 3, MOVE(3, 1, 0x2)},
+    {3339547473133742872ULL, 1, MOVE(1, 18, 0x0)},
+    {3340141460419567022ULL, 98, MOVE(52, 36, 0x1)},
+    {3340141460419567022ULL, 36, MOVE(58, 30, 0x0)},
+    {3340141460419567022ULL, 22, MOVE(53, 37, 0x1)},
+    {3343172008136264873ULL, 9, MOVE(2, 9, 0x0)},
+    {3343666456905200021ULL, 12, MOVE(6, 21, 0x0)},
+    {3343666456905200021ULL, 5, MOVE(1, 18, 0x0)},
+    {3348469090030635410ULL, 1, MOVE(1, 11, 0x0)},
+    {3355138731290550218ULL, 12, MOVE(12, 28, 0x1)},
+    {3357054024295368751ULL, 25, MOVE(37, 28, 0x4)},
+    {3357702043860372037ULL, 1, MOVE(53, 45, 0x0)},
+    {3365502576606950045ULL, 1, MOVE(12, 28, 0x1)},
+    {3368769041531004970ULL, 2, MOVE(57, 42, 0x0)},
+    {3372033292794834983ULL, 2, MOVE(34, 27, 0x0)},
+    {3372732088968193934ULL, 1, MOVE(12, 20, 0x0)},
+    {3377171724317742455ULL, 1, MOVE(5, 19, 0x0)},
+    {3378492998177326433ULL, 1, MOVE(54, 46, 0x0)},
+    {3380289427257159865ULL, 3, MOVE(59, 57, 0x2)},
+    {3389167733367218699ULL, 1, MOVE(59, 57, 0x2)},
+    {3390986101916190677ULL, 1, MOVE(6, 21, 0x0)},
+    {3391644285989027401ULL, 1, MOVE(54, 46, 0x0)},
+    {3391644285989027401ULL, 1, MOVE(59, 57, 0x2)},
+    {3396989240179752730ULL, 1, MOVE(61, 54, 0x0)},
+    {3398778960058003390ULL, 4, MOVE(58, 49, 0x0)},
+    {3400429104195651552ULL, 24, MOVE(12, 27, 0x4)},
+    {3405160855717974887ULL, 1, MOVE(12, 20, 0x0)},
+    {3412807013053522598ULL, 1, MOVE(48, 40, 0x0)},
+    {3416519711809590334ULL, 1, MOVE(6, 21, 0x0)},
+    {3419013534184044935ULL, 1, MOVE(62, 45, 0x0)},
+    {3426955840866958320ULL, 43, MOVE(1, 18, 0x0)},
+    {3432668878026588473ULL, 2, MOVE(21, 28, 0x4)},
+    {3437205817293449776ULL, 3, MOVE(59, 57, 0x2)},
+    {3437205817293449776ULL, 2, MOVE(54, 38, 0x1)},
+    {3443581936448031789ULL, 2, MOVE(62, 45, 0x0)},
+    {3443769833341624863ULL, 1, MOVE(62, 45, 0x0)},
+    {3445526569978559419ULL, 1, MOVE(2, 9, 0x0)},
+    {3448163897964331411ULL, 3, MOVE(58, 49, 0x0)},
+    {3448846763706090934ULL, 5, MOVE(52, 36, 0x1)},
+    {3448846763706090934ULL, 1, MOVE(53, 37, 0x1)},
+    {3450329105129692625ULL, 1, MOVE(13, 21, 0x0)},
+    {3459559979807822615ULL, 3, MOVE(61, 54, 0x0)},
+    {3463559734294616496ULL, 2, MOVE(58, 49, 0x0)},
+    {3464089669568491538ULL, 1, MOVE(55, 47, 0x0)},
+    {3464089669568491538ULL, 1, MOVE(62, 52, 0x0)},
+    {3466013003869596279ULL, 2, MOVE(29, 36, 0x4)},
+    {3466013003869596279ULL, 1, MOVE(11, 19, 0x0)},
+    {3466013003869596279ULL, 1, MOVE(1, 18, 0x0)},
+    {3468713065199436170ULL, 2, MOVE(18, 28, 0x0)},
+    {3470530584716825425ULL, 1, MOVE(59, 57, 0x2)},
+    {3473638809193039417ULL, 1, MOVE(53, 37, 0x1)},
+    {3474679215659661038ULL, 1, MOVE(58, 49, 0x0)},
+    {3478068450551787684ULL, 1, MOVE(1, 18, 0x0)},
+    {3485708238611644193ULL, 1, MOVE(59, 60, 0x4)},
+    {3491502442880202193ULL, 14, MOVE(59, 57, 0x2)},
+    {3491502442880202193ULL, 1, MOVE(62, 47, 0x0)},
+    {3492063636436681165ULL, 2, MOVE(58, 30, 0x0)},
+    {3496459055638593905ULL, 1, MOVE(51, 43, 0x0)},
+    {3497726837187527558ULL, 4, MOVE(12, 28, 0x1)},
+    {3504989790267432984ULL, 6, MOVE(62, 52, 0x0)},
+    {3504989790267432984ULL, 1, MOVE(36, 29, 0x4)},
+    {3518929532376982102ULL, 1, MOVE(58, 44, 0x0)},
+    {3519099425877449069ULL, 2, MOVE(3, 1, 0x2)},
+    {3520088882391715994ULL, 25, MOVE(58, 49, 0x0)},
+    {3523090201300521019ULL, 1, MOVE(6, 21, 0x0)},
+    {3528828767237227363ULL, 1, MOVE(30, 37, 0x4)},
+    {3528828767237227363ULL, 1, MOVE(9, 17, 0x0)},
+    {3530860594165431057ULL, 2, MOVE(36, 29, 0x4)},
+    {3530860594165431057ULL, 1, MOVE(49, 41, 0x0)},
+    {3530860594165431057ULL, 1, MOVE(54, 38, 0x1)},
+    {3533692878971540998ULL, 1, MOVE(51, 43, 0x0)},
+    {3534813344148321571ULL, 1, MOVE(21, 27, 0x4)},
+    {3536559802224465222ULL, 8, MOVE(57, 42, 0x0)},
+    {3536559802224465222ULL, 1, MOVE(51, 35, 0x1)},
+    {3546025453032040871ULL, 2, MOVE(1, 18, 0x0)},
+    {3546025453032040871ULL, 1, MOVE(6, 21, 0x0)},
+    {3550150256631402734ULL, 1, MOVE(61, 34, 0x0)},
+    {3551152596911524438ULL, 5, MOVE(57, 42, 0x0)},
+    {3551152596911524438ULL, 1, MOVE(36, 29, 0x4)},
+    {3568581767632938472ULL, 3, MOVE(28, 36, 0x0)},
+    {3568581767632938472ULL, 1, MOVE(13, 21, 0x0)},
+    {3585995825695372266ULL, 2, MOVE(58, 30, 0x0)},
+    {3587809130675807881ULL, 1, MOVE(58, 51, 0x0)},
+    {3588418666326726518ULL, 1, MOVE(52, 36, 0x1)},
+    {3591855864418749080ULL, 1, MOVE(51, 35, 0x1)},
+    {3593538930983823070ULL, 1, MOVE(59, 57, 0x2)},
+    {3595488457908497284ULL, 3, MOVE(60, 36, 0x4)},
+    {3596286517426049807ULL, 1, MOVE(57, 42, 0x0)},
+    {3596685040299112750ULL, 1, MOVE(51, 43, 0x0)},
+    {3601454187398330320ULL, 12, MOVE(52, 44, 0x0)},
+    {3601454187398330320ULL, 2, MOVE(53, 37, 0x1)},
+    {3601454187398330320ULL, 2, MOVE(62, 45, 0x0)},
+    {3602108563509331271ULL, 2, MOVE(62, 45, 0x0)},
+    {3602108563509331271ULL, 1, MOVE(49, 41, 0x0)},
+    {3602269126110796755ULL, 1, MOVE(10, 18, 0x0)},
+    {3602389145463028219ULL, 1, MOVE(6, 21, 0x0)},
+    {3606366423567729436ULL, 1, MOVE(61, 25, 0x0)},
+    {3606366423567729436ULL, 1, MOVE(57, 42, 0x0)},
+    {3611072275150588425ULL, 3, MOVE(2, 20, 0x0)},
+    {3611132883002132808ULL, 1, MOVE(62, 52, 0x0)},
+    {3611132883002132808ULL, 1, MOVE(54, 46, 0x0)},
+    {3614283776249612116ULL, 1, MOVE(59, 57, 0x2)},
+    {3617488717091826541ULL, 1, MOVE(1, 18, 0x0)},
+    {3619119026038829692ULL, 1, MOVE(51, 43, 0x0)},
+    {3619221109915656561ULL, 1, MOVE(58, 51, 0x0)},
+    {3620415946655144319ULL, 1, MOVE(32, 25, 0x4)},
+    {3630336922432804397ULL, 1, MOVE(11, 27, 0x1)},
+    {3632202504220565208ULL, 1, MOVE(52, 36, 0x1)},
+    {3632202504220565208ULL, 1, MOVE(62, 47, 0x0)},
+    {3643562861573077371ULL, 9, MOVE(2, 20, 0x0)},
+    {3643562861573077371ULL, 4, MOVE(13, 21, 0x0)},
+    {3643562861573077371ULL, 2, MOVE(10, 26, 0x1)},
+    {3648410339936323360ULL, 2, MOVE(52, 36, 0x1)},
+    {3653067065990077373ULL, 1, MOVE(6, 12, 0x0)},
+    {3658795600901705166ULL, 2, MOVE(14, 21, 0x4)},
+    {3663523729227764811ULL, 1, MOVE(9, 25, 0x1)},
+    {3667706733383610692ULL, 1, MOVE(9, 18, 0x4)},
+    {3667997072327665724ULL, 2, MOVE(9, 17, 0x0)},
+    {3668402702173799431ULL, 1, MOVE(13, 29, 0x1)},
+    {3669750180153683402ULL, 2, MOVE(12, 28, 0x1)},
+    {3669750180153683402ULL, 1, MOVE(2, 9, 0x0)},
+    {3680904702241539980ULL, 1, MOVE(6, 21, 0x0)},
+    {3684949101368063177ULL, 1, MOVE(6, 21, 0x0)},
+    {3685726556084646336ULL, 1, MOVE(62, 45, 0x0)},
+    {3690195118672909497ULL, 130, MOVE(6, 21, 0x0)},
+    {3690195118672909497ULL, 59, MOVE(6, 12, 0x0)},
+    {3690195118672909497ULL, 14, MOVE(27, 35, 0x0)},
+    {3690195118672909497ULL, 3, MOVE(27, 36, 0x4)},
+    {3693114083618975266ULL, 2, MOVE(33, 24, 0x0)},
+    {3699414432504008635ULL, 1, MOVE(62, 45, 0x0)},
+    {3706630933671860971ULL, 2, MOVE(13, 29, 0x1)},
+    {3706630933671860971ULL, 1, MOVE(12, 20, 0x0)},
+    {3708659275266732826ULL, 1, MOVE(58, 49, 0x0)},
+    {3709317945283016017ULL, 1, MOVE(9, 17, 0x0)},
+    {3709447702243419339ULL, 21, MOVE(60, 36, 0x4)},
+    {3709447702243419339ULL, 3, MOVE(57, 42, 0x0)},
+    {3711176409036077821ULL, 1, MOVE(10, 18, 0x0)},
+    {3714368962528749510ULL, 2, MOVE(12, 28, 0x1)},
+    {3715327064442691319ULL, 22, MOVE(12, 20, 0x0)},
+    {3715327064442691319ULL, 3, MOVE(6, 21, 0x0)},
+    {3721014726486387117ULL, 6, MOVE(38, 20, 0x0)},
+    {3721014726486387117ULL, 6, MOVE(4, 11, 0x0)},
+    {3722872288114826283ULL, 1, MOVE(58, 49, 0x0)},
+    {3725031456545187013ULL, 1, MOVE(10, 26, 0x1)},
+    {3725108069298277479ULL, 3, MOVE(52, 44, 0x0)},
+    {3725108069298277479ULL, 1, MOVE(59, 57, 0x2)},
+    {3725392830567381942ULL, 1, MOVE(62, 45, 0x0)},
+    {3725861170738813190ULL, 4, MOVE(8, 16, 0x0)},
+    {3725861170738813190ULL, 1, MOVE(12, 20, 0x0)},
+    {3725861170738813190ULL, 1, MOVE(12, 28, 0x1)},
+    {3729409966781515091ULL, 9, MOVE(29, 36, 0x4)},
+    {3729409966781515091ULL, 6, MOVE(12, 28, 0x1)},
+    {3737259131514101563ULL, 1, MOVE(29, 22, 0x0)},
+    {3744328298212194984ULL, 1, MOVE(57, 42, 0x0)},
+    {3744328298212194984ULL, 1, MOVE(62, 45, 0x0)},
+    {3746281589159749224ULL, 1, MOVE(51, 43, 0x0)},
+    {3748078566998383098ULL, 1, MOVE(58, 51, 0x0)},
+    {3748078566998383098ULL, 1, MOVE(62, 45, 0x0)},
+    {3751359726665911200ULL, 23, MOVE(52, 36, 0x1)},
+    {3763220057467455070ULL, 2, MOVE(13, 21, 0x0)},
+    {3763220057467455070ULL, 1, MOVE(6, 21, 0x0)},
+    {3769603945553547819ULL, 1, MOVE(12, 20, 0x0)},
+    {3771628709515878253ULL, 1, MOVE(1, 18, 0x0)},
+    {3771875052969260853ULL, 1, MOVE(27, 35, 0x0)},
+    {3782377025650532232ULL, 2, MOVE(12, 28, 0x1)},
+    {3782377025650532232ULL, 1, MOVE(9, 17, 0x0)},
+    {3783178458094503621ULL, 2, MOVE(27, 35, 0x0)},
+    {3787414086296480871ULL, 2, MOVE(52, 36, 0x1)},
+    {3788825767152871394ULL, 4, MOVE(62, 52, 0x0)},
+    {3788825767152871394ULL, 3, MOVE(58, 44, 0x0)},
+    {3789798150508062379ULL, 1, MOVE(36, 29, 0x4)},
+    {3790607021754198645ULL, 1, MOVE(62, 45, 0x0)},
+    {3796363722334826863ULL, 1, MOVE(57, 42, 0x0)},
+    {3800075212325898108ULL, 1, MOVE(54, 38, 0x1)},
+    {3803254029935360307ULL, 1, MOVE(59, 57, 0x2)},
+    {3803424649586861865ULL, 1, MOVE(61, 34, 0x0)},
+    {3806967840195003067ULL, 1, MOVE(1, 18, 0x0)},
+    {3808345165427803518ULL, 1, MOVE(54, 46, 0x0)},
+    {3809750140016277467ULL, 1, MOVE(4, 28, 0x4)},
+    {3812764770462522928ULL, 2, MOVE(2, 9, 0x0)},
+    {3815715691124101920ULL, 1, MOVE(33, 25, 0x0)},
+    {3818204582793849347ULL, 7, MOVE(11, 19, 0x0)},
+    {3818204582793849347ULL, 5, MOVE(9, 17, 0x0)},
+    {3818204582793849347ULL, 2, MOVE(12, 28, 0x1)},
+    {3825571137250716563ULL, 2, MOVE(55, 47, 0x0)},
+    {3825571137250716563ULL, 1, MOVE(57, 51, 0x0)},
+    {3828013514560793586ULL, 1, MOVE(59, 57, 0x2)},
+    {3828013514560793586ULL, 1, MOVE(62, 45, 0x0)},
+    {3829185419407060211ULL, 34, MOVE(2, 38, 0x0)},
+    {3829185419407060211ULL, 16, MOVE(12, 28, 0x1)},
+    {3829185419407060211ULL, 1, MOVE(2, 29, 0x0)},
+    {3829185419407060211ULL, 1, MOVE(8, 16, 0x0)},
+    {3830694852070677904ULL, 1, MOVE(8, 16, 0x0)},
+    {3836957407128921475ULL, 1, MOVE(61, 25, 0x0)},
+    {3836957407128921475ULL, 1, MOVE(49, 41, 0x0)},
+    {3837818963606715418ULL, 1, MOVE(62, 47, 0x0)},
+    {3842232505176170252ULL, 3, MOVE(2, 29, 0x4)},
+    {3842513751841813357ULL, 1, MOVE(55, 47, 0x0)},
+    {3842513751841813357ULL, 1, MOVE(62, 45, 0x0)},
+    {3845873487874787552ULL, 1, MOVE(30, 22, 0x0)},
+    {3846853498848637681ULL, 1, MOVE(57, 42, 0x0)},
+    {3849912855756839599ULL, 217, MOVE(35, 18, 0x0)},
+    {3849912855756839599ULL, 3, MOVE(35, 29, 0x0)},
+    {3849912855756839599ULL, 3, MOVE(35, 20, 0x0)},
+    {3862702256675475552ULL, 11, MOVE(57, 42, 0x0)},
+    {3865680031249028750ULL, 25, MOVE(51, 43, 0x0)},
+    {3865680031249028750ULL, 2, MOVE(49, 41, 0x0)},
+    {3865680031249028750ULL, 1, MOVE(60, 46, 0x0)},
+    {3866080351849020521ULL, 4, MOVE(52, 36, 0x1)},
+    {3866080351849020521ULL, 1, MOVE(52, 44, 0x0)},
+    {3869015987921299603ULL, 1, MOVE(54, 38, 0x1)},
+    {3872460250455736688ULL, 1, MOVE(58, 49, 0x0)},
+    {3879444309163250034ULL, 4, MOVE(2, 9, 0x0)},
+    {3879444309163250034ULL, 1, MOVE(13, 29, 0x1)},
+    {3882922479985616845ULL, 1, MOVE(3, 1, 0x2)},
+    {3884314137641379252ULL, 1, MOVE(6, 12, 0x0)},
+    {3886053172307272152ULL, 8, MOVE(57, 42, 0x0)},
+    {3888513160075342839ULL, 9, MOVE(52, 44, 0x0)},
+    {3888513160075342839ULL, 3, MOVE(53, 45, 0x0)},
+    {3888513160075342839ULL, 1, MOVE(52, 36, 0x1)},
+    {3892906432818256132ULL, 1, MOVE(60, 39, 0x0)},
+    {3901140644299306052ULL, 3, MOVE(48, 40, 0x0)},
+    {3905738755293390333ULL, 1, MOVE(49, 41, 0x0)},
+    {3909303066927482053ULL, 1, MOVE(53, 37, 0x1)},
+    {3909303066927482053ULL, 1, MOVE(62, 45, 0x0)},
+    {3918232377858043104ULL, 1, MOVE(2, 29, 0x0)},
+    {3919627461027859428ULL, 1, MOVE(43, 36, 0x4)},
+    {3920963583253172205ULL, 3, MOVE(60, 42, 0x4)},
+    {3927878020741156490ULL, 1, MOVE(51, 35, 0x1)},
+    {3934101886758141875ULL, 1, MOVE(49, 41, 0x0)},
+    {3945733029276424557ULL, 19, MOVE(11, 19, 0x0)},
+    {3945733029276424557ULL, 8, MOVE(11, 27, 0x1)},
+    {3945733029276424557ULL, 4, MOVE(12, 28, 0x1)},
+    {3945733029276424557ULL, 1, MOVE(9, 17, 0x0)},
+    {3947091181153065774ULL, 1, MOVE(36, 27, 0x4)},
+    {3950652040008493277ULL, 5, MOVE(35, 26, 0x4)},
+    {3950652040008493277ULL, 2, MOVE(52, 36, 0x1)},
+    {3952992680209769981ULL, 2, MOVE(54, 46, 0x0)},
+    {3952992680209769981ULL, 1, MOVE(62, 45, 0x0)},
+    {3957430868384523950ULL, 411, MOVE(55, 47, 0x0)},
+    {3957430868384523950ULL, 45, MOVE(49, 41, 0x0)},
+    {3957430868384523950ULL, 22, MOVE(62, 45, 0x0)},
+    {3957430868384523950ULL, 9, MOVE(51, 43, 0x0)},
+    {3957430868384523950ULL, 1, MOVE(61, 52, 0x0)},
+    {3962153342190421379ULL, 1, MOVE(30, 12, 0x4)},
+    {3965706284271499181ULL, 1, MOVE(27, 35, 0x0)},
+    {3966753425611997272ULL, 1, MOVE(51, 43, 0x0)},
+    {3966753425611997272ULL, 1, MOVE(62, 52, 0x0)},
+    {3969050325408919961ULL, 1, MOVE(11, 19, 0x0)},
+    {3977079200898697116ULL, 1, MOVE(62, 45, 0x0)},
+    {3979068331136125196ULL, 1, MOVE(38, 30, 0x0)},
+    {3979068331136125196ULL, 1, MOVE(43, 36, 0x4)},
+    {3980838960065995378ULL, 21, MOVE(57, 42, 0x0)},
+    {3980838960065995378ULL, 3, MOVE(49, 41, 0x0)},
+    {3980838960065995378ULL, 1, MOVE(51, 43, 0x0)},
+    {3980897712013693721ULL, 1, MOVE(59, 57, 0x2)},
+    {3982791548421669148ULL, 1, MOVE(61, 54, 0x0)},
+    {3983138432817059200ULL, 2, MOVE(29, 36, 0x4)},
+    {3983138432817059200ULL, 1, MOVE(6, 21, 0x0)},
+    {3984718688700613905ULL, 1, MOVE(28, 36, 0x0)},
+    {3993527924178739837ULL, 1, MOVE(54, 46, 0x0)},
+    {3993527924178739837ULL, 1, MOVE(58, 51, 0x0)},
+    {3993527924178739837ULL, 1, MOVE(60, 46, 0x0)},
+    {3994901747340204867ULL, 1, MOVE(61, 54, 0x0)},
+    {3999600875195341211ULL, 1, MOVE(62, 45, 0x0)},
+    {4001955623819783701ULL, 1, MOVE(61, 54, 0x0)},
+    {4002273626804530579ULL, 2, MOVE(4, 60, 0x4)},
+    {4006738480636222661ULL, 1, MOVE(38, 29, 0x4)},
+    {4013868063920575874ULL, 2, MOVE(55, 47, 0x0)},
+    {4014187189509302547ULL, 8, MOVE(52, 36, 0x1)},
+    {4014187189509302547ULL, 6, MOVE(51, 35, 0x1)},
+    {4014187189509302547ULL, 5, MOVE(57, 42, 0x0)},
+    {4014187189509302547ULL, 1, MOVE(51, 43, 0x0)},
+    {4014187189509302547ULL, 1, MOVE(53, 37, 0x1)},
+    {4014187189509302547ULL, 1, MOVE(49, 41, 0x0)},
+    {4014322990236889951ULL, 4, MOVE(62, 45, 0x0)},
+    {4016517420244496215ULL, 1, MOVE(9, 17, 0x0)},
+    {4018728438201559389ULL, 2, MOVE(27, 35, 0x0)},
+    {4019429537348496759ULL, 1, MOVE(13, 29, 0x1)},
+    {4019918435336351046ULL, 1, MOVE(60, 39, 0x0)},
+    {4027660973630416044ULL, 1, MOVE(42, 36, 0x4)},
+    {4030406613229140563ULL, 1, MOVE(5, 14, 0x0)},
+    {4031138078085941720ULL, 1, MOVE(12, 28, 0x1)},
+    {4032557597801673769ULL, 1, MOVE(57, 42, 0x0)},
+    {4032557597801673769ULL, 1, MOVE(51, 43, 0x0)},
+    {4035054425921157265ULL, 2, MOVE(58, 44, 0x0)},
+    {4035054425921157265ULL, 1, MOVE(62, 45, 0x0)},
+    {4039853611623084364ULL, 3, MOVE(52, 44, 0x0)},
+    {4043274517640586716ULL, 10, MOVE(3, 1, 0x2)},
+    {4043274517640586716ULL, 5, MOVE(38, 45, 0x4)},
+    {4043335503973279249ULL, 5, MOVE(62, 45, 0x0)},
+    {4046563620992649633ULL, 2, MOVE(29, 36, 0x4)},
+    {4046563620992649633ULL, 1, MOVE(12, 20, 0x0)},
+    {4046924203422095779ULL, 1, MOVE(6, 21, 0x0)},
+    {4048679037753860083ULL, 3, MOVE(12, 28, 0x1)},
+    {4048679037753860083ULL, 1, MOVE(1, 18, 0x0)},
+    {4048679037753860083ULL, 1, MOVE(6, 21, 0x0)},
+    {4055688012215861039ULL, 29, MOVE(54, 45, 0x4)},
+    {4060009488479054818ULL, 1, MOVE(8, 16, 0x0)},
+    {4065295993434409997ULL, 1, MOVE(59, 57, 0x2)},
+    {4069006794225931185ULL, 1, MOVE(55, 47, 0x0)},
+    {4070652397580507647ULL, 1, MOVE(52, 44, 0x0)},
+    {4071774761797541508ULL, 1, MOVE(57, 42, 0x0)},
+    {4076108340303473637ULL, 1, MOVE(62, 45, 0x0)},
+    {4078879476029418157ULL, 9, MOVE(13, 21, 0x0)},
+    {4078879476029418157ULL, 7, MOVE(2, 3, 0x0)},
+    {4078879476029418157ULL, 1, MOVE(38, 45, 0x4)},
+    {4078879476029418157ULL, 1, MOVE(6, 21, 0x0)},
+    {4083235631829694316ULL, 1, MOVE(13, 21, 0x0)},
+    {4090227221675244617ULL, 72, MOVE(9, 17, 0x0)},
+    {4090227221675244617ULL, 14, MOVE(11, 19, 0x0)},
+    {4090227221675244617ULL, 8, MOVE(12, 20, 0x0)},
+    {4090227221675244617ULL, 2, MOVE(15, 23, 0x0)},
+    {4090227221675244617ULL, 1, MOVE(12, 28, 0x1)},
+    {4090227221675244617ULL, 1, MOVE(11, 27, 0x1)},
+    {4094399477551906857ULL, 5, MOVE(57, 42, 0x0)},
+    {4094399477551906857ULL, 1, MOVE(51, 43, 0x0)},
+    {4094399477551906857ULL, 1, MOVE(61, 34, 0x0)},
+    {4101368096873955490ULL, 1, MOVE(6, 12, 0x0)},
+    {4104585741168292095ULL, 1, MOVE(27, 42, 0x4)},
+    {4104585741168292095ULL, 1, MOVE(4, 11, 0x0)},
+    {4108408489730703649ULL, 14, MOVE(13, 21, 0x0)},
+    {4109029209836402763ULL, 8, MOVE(53, 37, 0x1)},
+    {4109029209836402763ULL, 3, MOVE(54, 46, 0x0)},
+    {4109029209836402763ULL, 2, MOVE(52, 36, 0x1)},
+    {4109029209836402763ULL, 1, MOVE(42, 32, 0x0)},
+    {4112247143107604418ULL, 4, MOVE(29, 36, 0x4)},
+    {4112247143107604418ULL, 1, MOVE(11, 19, 0x0)},
+    {4115168600060987560ULL, 1, MOVE(52, 45, 0x4)},
+    {4119450019008373013ULL, 1, MOVE(43, 36, 0x4)},
+    {4119793360745517646ULL, 1, MOVE(53, 37, 0x1)},
+    {4122614028101861856ULL, 2, MOVE(3, 1, 0x2)},
+    {4131005834233970656ULL, 1, MOVE(14, 22, 0x0)},
+    {4136386675948814492ULL, 6, MOVE(45, 36, 0x4)},
+    {4138209972886916358ULL, 2, MOVE(2, 20, 0x0)},
+    {4138905037975220805ULL, 1, MOVE(3, 1, 0x2)},
+    {4138958925290388977ULL, 1, MOVE(5, 33, 0x0)},
+    {4138958925290388977ULL, 1, MOVE(2, 20, 0x0)},
+    {4143801226780587254ULL, 1, MOVE(58, 49, 0x0)},
+    {4146891116569759794ULL, 1, MOVE(55, 47, 0x0)},
+    {4150445350212146872ULL, 6, MOVE(9, 17, 0x0)},
+    {4155452502290639426ULL, 1, MOVE(55, 47, 0x0)},
+    {4155962301753465845ULL, 1, MOVE(53, 45, 0x0)},
+    {4156232714370462430ULL, 1, MOVE(5, 14, 0x0)},
+    {4158898834383795682ULL, 1, MOVE(6, 21, 0x0)},
+    {4164044936573681678ULL, 2, MOVE(45, 37, 0x0)},
+    {4164044936573681678ULL, 1, MOVE(62, 52, 0x0)},
+    {4164044936573681678ULL, 1, MOVE(58, 44, 0x0)},
+    {4165604219401622541ULL, 1, MOVE(52, 44, 0x0)},
+    {4167540962880983898ULL, 7, MOVE(3, 1, 0x2)},
+    {4167540962880983898ULL, 1, MOVE(13, 29, 0x1)},
+    {4170450925713610135ULL, 1, MOVE(6, 12, 0x0)},
+    {4170846985360817091ULL, 2, MOVE(57, 42, 0x0)},
+    {4171915001494897321ULL, 1, MOVE(38, 45, 0x4)},
+    {4172208925619635455ULL, 2, MOVE(37, 28, 0x4)},
+    {4172513772854032499ULL, 1, MOVE(1, 18, 0x0)},
+    {4172878783544850166ULL, 1, MOVE(52, 44, 0x0)},
+    {4176183661452507587ULL, 1, MOVE(58, 51, 0x0)},
+    {4176599767348613019ULL, 1, MOVE(37, 28, 0x4)},
+    {4178512978711492830ULL, 3, MOVE(58, 49, 0x0)},
+    {4179988062268315253ULL, 1, MOVE(6, 21, 0x0)},
+    {4180406523094238394ULL, 2, MOVE(57, 42, 0x0)},
+    {4180925362546564933ULL, 1, MOVE(1, 18, 0x0)},
+    {4180977352180739552ULL, 1, MOVE(2, 38, 0x0)},
+    {4195724694515504237ULL, 1, MOVE(44, 35, 0x4)},
+    {4197901149777274304ULL, 4, MOVE(28, 37, 0x4)},
+    {4197901149777274304ULL, 1, MOVE(2, 38, 0x0)},
+    {4198153015302602510ULL, 18, MOVE(28, 45, 0x4)},
+    {4198153015302602510ULL, 9, MOVE(28, 22, 0x0)},
+    {4198153015302602510ULL, 7, MOVE(5, 19, 0x0)},
+    {4198917847219920258ULL, 1, MOVE(58, 49, 0x0)},
+    {4198917847219920258ULL, 1, MOVE(61, 25, 0x0)},
+    {4205261359251849504ULL, 1, MOVE(53, 37, 0x1)},
+    {4214986889140312976ULL, 38, MOVE(9, 17, 0x0)},
+    {4214986889140312976ULL, 19, MOVE(6, 21, 0x0)},
+    {4214986889140312976ULL, 9, MOVE(11, 19, 0x0)},
+    {4218809110636770978ULL, 2, MOVE(52, 44, 0x0)},
+    {4220306397011959743ULL, 4, MOVE(2, 9, 0x0)},
+    {4220449201395613495ULL, 108, MOVE(12, 28, 0x1)},
+    {4220449201395613495ULL, 97, MOVE(9, 17, 0x0)},
+    {4220449201395613495ULL, 30, MOVE(13, 29, 0x1)},
+    {4220449201395613495ULL, 18, MOVE(11, 19, 0x0)},
+    {4220449201395613495ULL, 10, MOVE(14, 22, 0x0)},
+    {4223151733703516863ULL, 1, MOVE(61, 54, 0x0)},
+    {4226166395749929724ULL, 1, MOVE(52, 45, 0x4)},
+    {4231103127187505784ULL, 2, MOVE(3, 1, 0x2)},
+    {4231103127187505784ULL, 1, MOVE(12, 20, 0x0)},
+    {4236661581796139029ULL, 3, MOVE(59, 57, 0x2)},
+    {4236708405829551657ULL, 2, MOVE(52, 44, 0x0)},
+    {4236708405829551657ULL, 1, MOVE(57, 51, 0x0)},
+    {4237306308015172055ULL, 3, MOVE(28, 36, 0x0)},
+    {4237606143574668704ULL, 2, MOVE(57, 42, 0x0)},
+    {4239100726863246344ULL, 1, MOVE(57, 42, 0x0)},
+    {4248084906580760007ULL, 1, MOVE(54, 38, 0x1)},
+    {4250077511963411789ULL, 1, MOVE(57, 42, 0x0)},
+    {4253526023204947980ULL, 3, MOVE(2, 29, 0x0)},
+    {4253526023204947980ULL, 3, MOVE(12, 28, 0x1)},
+    {4256888552973700056ULL, 1, MOVE(42, 52, 0x0)},
+    {4265851414882591740ULL, 3, MOVE(2, 20, 0x0)},
+    {4266133425356937549ULL, 1, MOVE(12, 28, 0x1)},
+    {4266676822898686648ULL, 2, MOVE(2, 9, 0x0)},
+    {4266757054268296781ULL, 1, MOVE(2, 9, 0x0)},
+    {4273100315704762935ULL, 2, MOVE(36, 21, 0x4)},
+    {4273100315704762935ULL, 1, MOVE(58, 49, 0x0)},
+    {4274442620135729156ULL, 1, MOVE(1, 18, 0x0)},
+    {4278633864291768199ULL, 1, MOVE(21, 38, 0x0)},
+    {4279623402023267379ULL, 1, MOVE(30, 21, 0x4)},
+    {4283152699752375935ULL, 2, MOVE(51, 35, 0x1)},
+    {4286387923052900783ULL, 660, MOVE(55, 47, 0x0)},
+    {4286387923052900783ULL, 329, MOVE(57, 42, 0x0)},
+    {4286387923052900783ULL, 18, MOVE(50, 34, 0x1)},
+    {4286387923052900783ULL, 9, MOVE(49, 41, 0x0)},
+    {4286387923052900783ULL, 3, MOVE(58, 37, 0x0)},
+    {4286387923052900783ULL, 2, MOVE(57, 51, 0x0)},
+    {4286387923052900783ULL, 1, MOVE(45, 28, 0x0)},
+    {4301917681705343796ULL, 2, MOVE(37, 28, 0x4)},
+    {4307240967882649019ULL, 6, MOVE(62, 45, 0x0)},
+    {4314706635388950511ULL, 1, MOVE(35, 28, 0x4)},
+    {4317872089520272464ULL, 1, MOVE(1, 18, 0x0)},
+    {4319664030038642813ULL, 1, MOVE(36, 29, 0x4)},
+    {4325179797362092136ULL, 1, MOVE(13, 29, 0x1)},
+    {4325179797362092136ULL, 1, MOVE(1, 18, 0x0)},
+    {4325608445361446019ULL, 1, MOVE(1, 18, 0x0)},
+    {4327514769276438104ULL, 1, MOVE(59, 57, 0x2)},
+    {4328155238317176367ULL, 1, MOVE(59, 57, 0x2)},
+    {4335671656504277717ULL, 2, MOVE(27, 35, 0x0)},
+    {4337050555495072347ULL, 3, MOVE(37, 28, 0x4)},
+    {4338179277917135841ULL, 3, MOVE(11, 27, 0x1)},
+    {4338179277917135841ULL, 2, MOVE(9, 17, 0x0)},
+    {4342413917885567123ULL, 1, MOVE(57, 42, 0x0)},
+    {4347300704248868129ULL, 3, MOVE(42, 36, 0x0)},
+    {4350334345671768980ULL, 1, MOVE(11, 19, 0x0)},
+    {4354772271343285253ULL, 3, MOVE(5, 26, 0x0)},
+    {4354772271343285253ULL, 2, MOVE(5, 33, 0x0)},
+    {4354772271343285253ULL, 2, MOVE(13, 29, 0x1)},
+    {4354772271343285253ULL, 1, MOVE(9, 17, 0x0)},
+    {4357831450415185383ULL, 12, MOVE(52, 44, 0x0)},
+    {4357831450415185383ULL, 7, MOVE(62, 45, 0x0)},
+    {4366402340776446994ULL, 1, MOVE(2, 38, 0x0)},
+    {4369314115388502255ULL, 2, MOVE(54, 46, 0x0)},
+    {4369314115388502255ULL, 1, MOVE(52, 36, 0x1)},
+    {4369651784913504447ULL, 1, MOVE(53, 37, 0x1)},
+    {4386237330162728504ULL, 1, MOVE(58, 37, 0x4)},
+    {4387294570606605392ULL, 1, MOVE(30, 21, 0x4)},
+    {4387294570606605392ULL, 1, MOVE(62, 45, 0x0)},
+    {4393845194311277261ULL, 1, MOVE(57, 42, 0x0)},
+    {4394622772250732555ULL, 1, MOVE(33, 12, 0x0)},
+    {4394942307833677123ULL, 4, MOVE(57, 42, 0x0)},
+    {4394942307833677123ULL, 1, MOVE(53, 45, 0x0)},
+    {4396900569471152008ULL, 1, MOVE(61, 54, 0x0)},
+    {4397516755116033015ULL, 1, MOVE(15, 23, 0x0)},
+    {4398019156501779114ULL, 1, MOVE(61, 52, 0x0)},
+    {4398553085975193106ULL, 1, MOVE(51, 43, 0x0)},
+    {4403761404333435418ULL, 1, MOVE(60, 53, 0x0)},
+    {4407573588513695826ULL, 7, MOVE(1, 18, 0x0)},
+    {4407573588513695826ULL, 3, MOVE(15, 23, 0x0)},
+    {4407573588513695826ULL, 1, MOVE(2, 20, 0x0)},
+    {4407573588513695826ULL, 1, MOVE(5, 19, 0x0)},
+    {4408286280941886435ULL, 2, MOVE(36, 29, 0x4)},
+    {4408286280941886435ULL, 1, MOVE(53, 37, 0x1)},
+    {4412056625411621233ULL, 1, MOVE(38, 44, 0x0)},
+    {4417015104152959576ULL, 3, MOVE(55, 47, 0x0)},
+    {4418075441984575246ULL, 2, MOVE(58, 49, 0x0)},
+    {4421049698786829563ULL, 20, MOVE(6, 21, 0x0)},
+    {4421049698786829563ULL, 1, MOVE(1, 18, 0x0)},
+    {4423148137322828883ULL, 3, MOVE(58, 49, 0x0)},
+    {4423570080327089207ULL, 4, MOVE(2, 9, 0x0)},
+    {4423570080327089207ULL, 2, MOVE(6, 21, 0x0)},
+    {4424976813206090745ULL, 4, MOVE(54, 38, 0x1)},
+    {4424976813206090745ULL, 2, MOVE(58, 44, 0x0)},
+    {4424976813206090745ULL, 1, MOVE(58, 37, 0x0)},
+    {4427255842915037872ULL, 2, MOVE(12, 30, 0x4)},
+    {4427255842915037872ULL, 1, MOVE(2, 9, 0x0)},
+    {4429203668650472249ULL, 7, MOVE(28, 21, 0x4)},
+    {4429722800411233674ULL, 16, MOVE(52, 36, 0x1)},
+    {4429722800411233674ULL, 6, MOVE(51, 43, 0x0)},
+    {4429722800411233674ULL, 6, MOVE(58, 49, 0x0)},
+    {4429722800411233674ULL, 5, MOVE(53, 37, 0x1)},
+    {4429722800411233674ULL, 3, MOVE(52, 44, 0x0)},
+    {4429722800411233674ULL, 2, MOVE(62, 45, 0x0)},
+    {4434603022270942794ULL, 1, MOVE(58, 49, 0x0)},
+    {4441186849128331217ULL, 1, MOVE(51, 35, 0x1)},
+    {4442527735552920965ULL, 146, MOVE(52, 44, 0x0)},
+    {4442527735552920965ULL, 7, MOVE(59, 57, 0x2)},
+    {4446765079099501783ULL, 1, MOVE(3, 1, 0x2)},
+    {4446765079099501783ULL, 1, MOVE(6, 12, 0x0)},
+    {4446765079099501783ULL, 1, MOVE(13, 21, 0x0)},
+    {4455928595891052414ULL, 1, MOVE(5, 26, 0x0)},
+    {4456538972177713685ULL, 1, MOVE(2, 9, 0x0)},
+    {4457336635464661513ULL, 4, MOVE(36, 29, 0x4)},
+    {4458899000737982224ULL, 2, MOVE(51, 44, 0x4)},
+    {4458899000737982224ULL, 2, MOVE(53, 44, 0x4)},
+    {4460831227017018309ULL, 1, MOVE(11, 27, 0x1)},
+    {4463591738290073319ULL, 3, MOVE(2, 9, 0x0)},
+    {4464733142327551964ULL, 5, MOVE(51, 43, 0x0)},
+    {4467868705360116561ULL, 1, MOVE(58, 49, 0x0)},
+    {4470409286538879927ULL, 1, MOVE(58, 49, 0x0)},
+    {4471627026556111146ULL, 1, MOVE(5, 14, 0x0)},
+    {4475667876256774178ULL, 6, MOVE(62, 45, 0x0)},
+    {4475667876256774178ULL, 2, MOVE(60, 46, 0x0)},
+    {4475667876256774178ULL, 1, MOVE(55, 47, 0x0)},
+    {4478018007766024322ULL, 1, MOVE(57, 42, 0x0)},
+    {4481191155974191812ULL, 49, MOVE(61, 34, 0x0)},
+    {4481191155974191812ULL, 39, MOVE(61, 25, 0x0)},
+    {4481191155974191812ULL, 25, MOVE(55, 47, 0x0)},
+    {4481191155974191812ULL, 15, MOVE(51, 43, 0x0)},
+    {4481191155974191812ULL, 3, MOVE(49, 41, 0x0)},
+    {4491897023529820590ULL, 2, MOVE(57, 42, 0x0)},
+    {4491897023529820590ULL, 1, MOVE(48, 40, 0x0)},
+    {4495782780282520294ULL, 1, MOVE(12, 28, 0x1)},
+    {4498072105937838293ULL, 1, MOVE(13, 21, 0x0)},
+    {4504995389201361879ULL, 1, MOVE(61, 54, 0x0)},
+    {4512977590302776984ULL, 1, MOVE(28, 36, 0x0)},
+    {4513661098016525085ULL, 1, MOVE(13, 29, 0x1)},
+    {4516004669506323558ULL, 1, MOVE(10, 18, 0x0)},
+    {4521206243472197377ULL, 1, MOVE(51, 43, 0x0)},
+    {4521472673423428096ULL, 5, MOVE(59, 57, 0x2)},
+    {4521472673423428096ULL, 1, MOVE(48, 40, 0x0)},
+    {4521472673423428096ULL, 1, MOVE(53, 37, 0x1)},
+    {4533356541811807111ULL, 1, MOVE(25, 34, 0x0)},
+    {4535249283800345235ULL, 2, MOVE(53, 37, 0x1)},
+    {4535249283800345235ULL, 1, MOVE(54, 46, 0x0)},
+    {4536785660751313020ULL, 5, MOVE(11, 19, 0x0)},
+    {4536785660751313020ULL, 3, MOVE(13, 21, 0x0)},
+    {4539308133701679017ULL, 1, MOVE(62, 45, 0x0)},
+    {4552569000938933318ULL, 1, MOVE(49, 41, 0x0)},
+    {4552902664739083189ULL, 3, MOVE(60, 51, 0x0)},
+    {4559642504691816999ULL, 2, MOVE(35, 27, 0x0)},
+    {4570717200009951742ULL, 5, MOVE(18, 28, 0x4)},
+    {4574647628600670448ULL, 1, MOVE(29, 36, 0x4)},
+    {4576313070268149647ULL, 1, MOVE(57, 42, 0x0)},
+    {4589320676060802509ULL, 1, MOVE(38, 30, 0x0)},
+    {4598383559416694014ULL, 1, MOVE(49, 41, 0x0)},
+    {4599915986949443236ULL, 2, MOVE(62, 45, 0x0)},
+    {4602478127674450049ULL, 1, MOVE(60, 36, 0x4)},
+    {4606060508468885998ULL, 1, MOVE(58, 49, 0x0)},
+    {4606547290425265993ULL, 1, MOVE(58, 49, 0x0)},
+    {4610926162051661550ULL, 12, MOVE(49, 41, 0x0)},
+    {4610926162051661550ULL, 4, MOVE(52, 44, 0x0)},
+    {4610926162051661550ULL, 2, MOVE(51, 43, 0x0)},
+    {4612158134553866464ULL, 51, MOVE(30, 51, 0x0)},
+    {4612158134553866464ULL, 6, MOVE(30, 44, 0x0)},
+    {4612158134553866464ULL, 1, MOVE(30, 12, 0x4)},
+    {4612649881682955571ULL, 4, MOVE(1, 18, 0x0)},
+    {4618644590145395242ULL, 1, MOVE(9, 17, 0x0)},
+    {4620754247252905375ULL, 1, MOVE(37, 28, 0x4)},
+    {4620754247252905375ULL, 1, MOVE(62, 45, 0x0)},
+    {4626338968704802534ULL, 1, MOVE(28, 36, 0x0)},
+    {4633505339883673162ULL, 2, MOVE(52, 35, 0x0)},
+    {4633505339883673162ULL, 2, MOVE(51, 43, 0x0)},
+    {4633505339883673162ULL, 1, MOVE(49, 41, 0x0)},
+    {4633505339883673162ULL, 1, MOVE(54, 46, 0x0)},
+    {4634856486459765769ULL, 1, MOVE(36, 46, 0x0)},
+    {4635170777852911814ULL, 1, MOVE(39, 37, 0x4)},
+    {4639719523495219495ULL, 1, MOVE(5, 14, 0x0)},
+    {4643567040611849567ULL, 1, MOVE(2, 11, 0x0)},
+    {4644181404918903488ULL, 1, MOVE(6, 21, 0x0)},
+    {4647048734785597148ULL, 1, MOVE(11, 19, 0x0)},
+    {4649591379722895290ULL, 4, MOVE(6, 21, 0x0)},
+    {4652607850972492938ULL, 3, MOVE(2, 9, 0x0)},
+    {4655829470863877910ULL, 2, MOVE(61, 25, 0x0)},
+    {4655829470863877910ULL, 1, MOVE(60, 53, 0x0)},
+    {4667574601816522117ULL, 4, MOVE(4, 31, 0x0)},
+    {4667574601816522117ULL, 2, MOVE(2, 9, 0x0)},
+    {4670805133053280453ULL, 1, MOVE(52, 44, 0x0)},
+    {4676584128340783690ULL, 3, MOVE(21, 27, 0x4)},
+    {4687596134951815932ULL, 115, MOVE(6, 21, 0x0)},
+    {4687596134951815932ULL, 5, MOVE(28, 38, 0x0)},
+    {4687596134951815932ULL, 1, MOVE(28, 45, 0x4)},
+    {4696501130215246013ULL, 4, MOVE(2, 11, 0x0)},
+    {4697095400129467838ULL, 1, MOVE(51, 43, 0x0)},
+    {4704326802047288427ULL, 1, MOVE(58, 49, 0x0)},
+    {4708117040037441050ULL, 17, MOVE(37, 28, 0x4)},
+    {4708117040037441050ULL, 5, MOVE(62, 45, 0x0)},
+    {4708117040037441050ULL, 4, MOVE(59, 57, 0x2)},
+    {4708117040037441050ULL, 2, MOVE(42, 27, 0x0)},
+    {4708117040037441050ULL, 1, MOVE(52, 36, 0x1)},
+    {4708117040037441050ULL, 1, MOVE(54, 46, 0x0)},
+    {4708117040037441050ULL, 1, MOVE(30, 21, 0x4)},
+    {4708975306879792126ULL, 1, MOVE(57, 42, 0x0)},
+    {4711707420081324055ULL, 1, MOVE(1, 18, 0x0)},
+    {4711707420081324055ULL, 1, MOVE(21, 36, 0x0)},
+    {4714532403036985548ULL, 1, MOVE(12, 20, 0x0)},
+    {4719456330804748706ULL, 1, MOVE(57, 42, 0x0)},
+    {4727359872299454180ULL, 1, MOVE(2, 9, 0x0)},
+    {4727359872299454180ULL, 1, MOVE(12, 28, 0x1)},
+    {4738827044696602065ULL, 1, MOVE(37, 28, 0x4)},
+    {4741353724612649763ULL, 1, MOVE(30, 23, 0x4)},
+    {4743073157588797438ULL, 1, MOVE(61, 43, 0x0)},
+    {4744896538331404773ULL, 1, MOVE(18, 28, 0x4)},
+    {4747103221187686127ULL, 3, MOVE(1, 18, 0x0)},
+    {4747103221187686127ULL, 1, MOVE(5, 12, 0x0)},
+    {4757060319868035250ULL, 1, MOVE(13, 21, 0x0)},
+    {4758988849336851150ULL, 9, MOVE(1, 18, 0x0)},
+    {4758988849336851150ULL, 1, MOVE(12, 28, 0x1)},
+    {4759967405207158852ULL, 1, MOVE(59, 57, 0x2)},
+    {4761002714638917751ULL, 1, MOVE(12, 28, 0x1)},
+    {4761742658635847488ULL, 1, MOVE(12, 20, 0x0)},
+    {4762152482573493221ULL, 7, MOVE(2, 20, 0x0)},
+    {4762152482573493221ULL, 6, MOVE(14, 22, 0x0)},
+    {4762152482573493221ULL, 2, MOVE(6, 12, 0x0)},
+    {4762152482573493221ULL, 1, MOVE(6, 21, 0x0)},
+    {4762473953496873755ULL, 14, MOVE(27, 36, 0x4)},
+    {4762473953496873755ULL, 13, MOVE(1, 18, 0x0)},
+    {4762473953496873755ULL, 1, MOVE(28, 37, 0x4)},
+    {4768491383048242903ULL, 21, MOVE(62, 45, 0x0)},
+    {4768491383048242903ULL, 1, MOVE(52, 44, 0x0)},
+    {4770231800961963911ULL, 2, MOVE(6, 21, 0x0)},
+    {4770231800961963911ULL, 1, MOVE(14, 30, 0x1)},
+    {4777643686146364946ULL, 1, MOVE(36, 21, 0x4)},
+    {4781295671017670434ULL, 2, MOVE(33, 42, 0x4)},
+    {4783214300430684799ULL, 2, MOVE(36, 29, 0x4)},
+    {4784314245611081258ULL, 1, MOVE(54, 46, 0x0)},
+    {4784794009544478618ULL, 1, MOVE(57, 42, 0x0)},
+    {4792450617328695419ULL, 6, MOVE(59, 57, 0x2)},
+    {4792450617328695419ULL, 3, MOVE(53, 37, 0x1)},
+    {4792450617328695419ULL, 2, MOVE(52, 36, 0x1)},
+    {4792450617328695419ULL, 2, MOVE(53, 45, 0x0)},
+    {4799157966916021975ULL, 5, MOVE(9, 17, 0x0)},
+    {4799157966916021975ULL, 1, MOVE(15, 31, 0x1)},
+    {4799307488805448735ULL, 8, MOVE(36, 29, 0x4)},
+    {4800344975375356952ULL, 36, MOVE(12, 28, 0x1)},
+    {4800344975375356952ULL, 1, MOVE(11, 19, 0x0)},
+    {4801615591348666253ULL, 7, MOVE(36, 28, 0x0)},
+    {4804627023261683682ULL, 14, MOVE(54, 38, 0x1)},
+    {4804627023261683682ULL, 14, MOVE(52, 44, 0x0)},
+    {4804627023261683682ULL, 6, MOVE(58, 37, 0x0)},
+    {4805384987773859549ULL, 3, MOVE(6, 21, 0x0)},
+    {4813035277464219313ULL, 1, MOVE(12, 20, 0x0)},
+    {4813249622833246509ULL, 1, MOVE(58, 51, 0x0)},
+    {4814078030769672394ULL, 2, MOVE(21, 11, 0x0)},
+    {4819542130482775027ULL, 3, MOVE(4, 12, 0x0)},
+    {4819542130482775027ULL, 1, MOVE(8, 16, 0x0)},
+    {4819542130482775027ULL, 1, MOVE(2, 11, 0x0)},
+    {4819727089999807136ULL, 2, MOVE(52, 45, 0x0)},
+    {4821448688231228014ULL, 2, MOVE(59, 57, 0x2)},
+    {4831661732843981970ULL, 9, MOVE(29, 36, 0x4)},
+    {4831661732843981970ULL, 7, MOVE(4, 31, 0x0)},
+    {4831661732843981970ULL, 4, MOVE(1, 18, 0x0)},
+    {4831661732843981970ULL, 2, MOVE(11, 19, 0x0)},
+    {4831661732843981970ULL, 1, MOVE(14, 22, 0x0)},
+    {4840121162814772690ULL, 2, MOVE(57, 42, 0x0)},
+    {4847744698071564754ULL, 7, MOVE(49, 41, 0x0)},
+    {4847744698071564754ULL, 3, MOVE(62, 45, 0x0)},
+    {4847744698071564754ULL, 1, MOVE(51, 43, 0x0)},
+    {4850926334648025187ULL, 1, MOVE(51, 43, 0x0)},
+    {4853601819725163340ULL, 3, MOVE(52, 44, 0x0)},
+    {4853601819725163340ULL, 1, MOVE(53, 37, 0x1)},
+    {4853624536339282574ULL, 20, MOVE(5, 12, 0x0)},
+    {4853624536339282574ULL, 18, MOVE(6, 12, 0x0)},
+    {4861210416005788464ULL, 1, MOVE(30, 12, 0x4)},
+    {4861926142282886787ULL, 1, MOVE(28, 36, 0x0)},
+    {4863431294739524082ULL, 1, MOVE(2, 9, 0x0)},
+    {4864449671301378125ULL, 1, MOVE(28, 22, 0x0)},
+    {4864976291470472873ULL, 1, MOVE(6, 21, 0x0)},
+    {4869726043432423108ULL, 2, MOVE(42, 57, 0x0)},
+    {4873906910109691721ULL, 1, MOVE(2, 38, 0x0)},
+    {4875360124742941048ULL, 1, MOVE(62, 45, 0x0)},
+    {4893734007807344968ULL, 1, MOVE(52, 36, 0x1)},
+    {4897093770206433914ULL, 1, MOVE(58, 49, 0x0)},
+    {4898711512496534509ULL, 2, MOVE(5, 14, 0x0)},
+    {4901927997645995292ULL, 1, MOVE(6, 12, 0x0)},
+    {4906127729811442387ULL, 1, MOVE(3, 1, 0x2)},
+    {4906975486543803143ULL, 1, MOVE(1, 18, 0x0)},
+    {4911607234890069264ULL, 3, MOVE(5, 33, 0x0)},
+    {4911607234890069264ULL, 3, MOVE(4, 13, 0x0)},
+    {4911607234890069264ULL, 1, MOVE(9, 17, 0x0)},
+    {4916957321416261754ULL, 10, MOVE(52, 36, 0x1)},
+    {4916957321416261754ULL, 2, MOVE(52, 44, 0x0)},
+    {4922837600851643802ULL, 2, MOVE(2, 29, 0x0)},
+    {4923953463362391539ULL, 2, MOVE(51, 43, 0x0)},
+    {4923953463362391539ULL, 1, MOVE(58, 49, 0x0)},
+    {4925991611868025555ULL, 2, MOVE(38, 20, 0x0)},
+    {4926797222986109608ULL, 1, MOVE(37, 28, 0x4)},
+    {4932496417307524909ULL, 1, MOVE(52, 44, 0x0)},
+    {4938432648831328186ULL, 1, MOVE(29, 22, 0x0)},
+    {4940966313009054159ULL, 49, MOVE(61, 34, 0x0)},
+    {4940966313009054159ULL, 12, MOVE(62, 52, 0x0)},
+    {4940966313009054159ULL, 9, MOVE(57, 42, 0x0)},
+    {4942634458414707003ULL, 2, MOVE(58, 49, 0x0)},
+    {4942783562595434079ULL, 2, MOVE(58, 49, 0x0)},
+    {4944432292337582387ULL, 1, MOVE(13, 21, 0x0)},
+    {4948679547013045421ULL, 2, MOVE(37, 28, 0x4)},
+    {4948679547013045421ULL, 1, MOVE(60, 39, 0x0)},
+    {4951880791549063964ULL, 2, MOVE(31, 29, 0x4)},
+    {4951880791549063964ULL, 1, MOVE(2, 9, 0x0)},
+    {4954854639503694433ULL, 2, MOVE(58, 49, 0x0)},
+    {4967810136213311215ULL, 10, MOVE(59, 57, 0x2)},
+    {4967810136213311215ULL, 1, MOVE(30, 21, 0x4)},
+    {4967810136213311215ULL, 1, MOVE(52, 44, 0x0)},
+    {4968300091572422469ULL, 1, MOVE(3, 1, 0x2)},
+    {4971551875701509993ULL, 1, MOVE(58, 51, 0x0)},
+    {4976894299185159540ULL, 1, MOVE(11, 19, 0x0)},
+    {4977504983328923019ULL, 1, MOVE(30, 58, 0x0)},
+    {4978320699383804585ULL, 2, MOVE(12, 28, 0x1)},
+    {4978320699383804585ULL, 1, MOVE(11, 27, 0x1)},
+    {4982999164732450051ULL, 1, MOVE(37, 28, 0x4)},
+    {4987309759649196530ULL, 1, MOVE(61, 34, 0x0)},
+    {4987700965284032707ULL, 1, MOVE(58, 49, 0x0)},
+    {4987700965284032707ULL, 1, MOVE(51, 35, 0x1)},
+    {4989403225331577077ULL, 1, MOVE(36, 29, 0x4)},
+    {4992538773212451219ULL, 1, MOVE(35, 28, 0x4)},
+    {5012081711401034708ULL, 2, MOVE(58, 49, 0x0)},
+    {5012081711401034708ULL, 2, MOVE(62, 45, 0x0)},
+    {5020138937822598730ULL, 1, MOVE(2, 29, 0x4)},
+    {5021107084728486798ULL, 1, MOVE(48, 32, 0x1)},
+    {5021107084728486798ULL, 1, MOVE(48, 40, 0x0)},
+    {5022897622865659534ULL, 1, MOVE(61, 34, 0x0)},
+    {5023252946413158808ULL, 1, MOVE(58, 49, 0x0)},
+    {5024811510876839359ULL, 1, MOVE(50, 34, 0x1)},
+    {5033179728697155138ULL, 5, MOVE(53, 37, 0x1)},
+    {5033179728697155138ULL, 2, MOVE(62, 52, 0x0)},
+    {5042902563486555274ULL, 2, MOVE(62, 45, 0x0)},
+    {5042902563486555274ULL, 1, MOVE(52, 44, 0x0)},
+    {5042902563486555274ULL, 1, MOVE(55, 47, 0x0)},
+    {5046030979849798653ULL, 11, MOVE(42, 27, 0x0)},
+    {5056650811953932498ULL, 25, MOVE(52, 45, 0x4)},
+    {5061963274603856563ULL, 6, MOVE(51, 43, 0x0)},
+    {5072474337651933047ULL, 3, MOVE(53, 37, 0x1)},
+    {5072961277340380631ULL, 1687, MOVE(51, 35, 0x1)},
+    {5072961277340380631ULL, 1232, MOVE(53, 37, 0x1)},
+    {5072961277340380631ULL, 244, MOVE(53, 45, 0x0)},
+    {5072961277340380631ULL, 214, MOVE(51, 43, 0x0)},
+    {5072961277340380631ULL, 71, MOVE(52, 44, 0x0)},
+    {5072961277340380631ULL, 24, MOVE(52, 36, 0x1)},
+    {5072961277340380631ULL, 18, MOVE(49, 41, 0x0)},
+    {5072961277340380631ULL, 7, MOVE(57, 42, 0x0)},
+    {5072961277340380631ULL, 2, MOVE(62, 45, 0x0)},
+    {5077746695879041030ULL, 1, MOVE(58, 49, 0x0)},
+    {5077746695879041030ULL, 1, MOVE(62, 45, 0x0)},
+    {5081574438969224558ULL, 1, MOVE(6, 12, 0x0)},
+    {5081574438969224558ULL, 1, MOVE(1, 18, 0x0)},
+    {5081574438969224558ULL, 1, MOVE(13, 29, 0x1)},
+    {5085586887257762953ULL, 1, MOVE(52, 36, 0x1)},
+    {5087855683859097311ULL, 5, MOVE(51, 43, 0x0)},
+    {5087855683859097311ULL, 1, MOVE(54, 38, 0x1)},
+    {5087855683859097311ULL, 1, MOVE(61, 25, 0x0)},
+    {5087855683859097311ULL, 1, MOVE(49, 41, 0x0)},
+    {5101143999414067907ULL, 1, MOVE(12, 28, 0x1)},
+    {5101714086375250729ULL, 4, MOVE(58, 37, 0x0)},
+    {5101714086375250729ULL, 2, MOVE(50, 34, 0x1)},
+    {5101714086375250729ULL, 1, MOVE(49, 41, 0x0)},
+    {5102092696111592600ULL, 3, MOVE(52, 45, 0x4)},
+    {5110305330130480705ULL, 1, MOVE(12, 20, 0x0)},
+    {5116264745546943020ULL, 1, MOVE(11, 19, 0x0)},
+    {5120058751335183637ULL, 58, MOVE(58, 30, 0x0)},
+    {5120058751335183637ULL, 55, MOVE(58, 51, 0x0)},
+    {5120058751335183637ULL, 44, MOVE(36, 29, 0x4)},
+    {5122532887144286266ULL, 1, MOVE(62, 45, 0x0)},
+    {5122769022160911303ULL, 3, MOVE(12, 20, 0x0)},
+    {5122769022160911303ULL, 2, MOVE(14, 22, 0x0)},
+    {5122769022160911303ULL, 1, MOVE(3, 1, 0x2)},
+    {5139188245605611898ULL, 1, MOVE(55, 39, 0x1)},
+    {5150116533860079001ULL, 8, MOVE(45, 36, 0x4)},
+    {5153915744434061188ULL, 1, MOVE(4, 11, 0x0)},
+    {5157075845287820477ULL, 1, MOVE(1, 18, 0x0)},
+    {5157917732044078804ULL, 2, MOVE(36, 29, 0x4)},
+    {5157917732044078804ULL, 2, MOVE(61, 34, 0x0)},
+    {5157917732044078804ULL, 1, MOVE(49, 41, 0x0)},
+    {5162207186020208122ULL, 1, MOVE(36, 29, 0x4)},
+    {5162207186020208122ULL, 1, MOVE(58, 49, 0x0)},
+    {5167820231769872337ULL, 1, MOVE(6, 21, 0x0)},
+    {5171627440783890126ULL, 49, MOVE(57, 42, 0x0)},
+    {5171627440783890126ULL, 5, MOVE(51, 43, 0x0)},
+    {5171627440783890126ULL, 4, MOVE(53, 45, 0x0)},
+    {5171627440783890126ULL, 1, MOVE(62, 45, 0x0)},
+    {5173219973096022835ULL, 10, MOVE(2, 11, 0x0)},
+    {5173400514963383163ULL, 1, MOVE(58, 44, 0x0)},
+    {5176317588280895049ULL, 1, MOVE(62, 52, 0x0)},
+    {5177180717739029614ULL, 1, MOVE(30, 39, 0x0)},
+    {5180106647844292634ULL, 4, MOVE(58, 51, 0x0)},
+    {5185543144284771276ULL, 1, MOVE(57, 42, 0x0)},
+    {5191588625304065341ULL, 1, MOVE(61, 54, 0x0)},
+    {5214082631592432688ULL, 4, MOVE(45, 28, 0x0)},
+    {5218752503498892073ULL, 3, MOVE(9, 17, 0x0)},
+    {5218752503498892073ULL, 1, MOVE(12, 28, 0x1)},
+    {5223064090103679930ULL, 2, MOVE(2, 9, 0x0)},
+    {5226700649956597150ULL, 1, MOVE(58, 30, 0x0)},
+    {5227487485977633913ULL, 1, MOVE(57, 42, 0x0)},
+    {5231336699538722339ULL, 1, MOVE(3, 1, 0x2)},
+    {5236254105324054686ULL, 1, MOVE(58, 30, 0x0)},
+    {5238004230522517807ULL, 1, MOVE(57, 42, 0x0)},
+    {5244029204056220322ULL, 1, MOVE(5, 26, 0x0)},
+    {5246516882433904536ULL, 1, MOVE(6, 21, 0x0)},
+    {5246516882433904536ULL, 1, MOVE(1, 18, 0x0)},
+    {5253188121204829967ULL, 2, MOVE(53, 45, 0x0)},
+    {5253188121204829967ULL, 2, MOVE(57, 42, 0x0)},
+    {5253188121204829967ULL, 2, MOVE(48, 40, 0x0)},
+    {5253188121204829967ULL, 1, MOVE(61, 34, 0x0)},
+    {5266730490741287587ULL, 1, MOVE(35, 27, 0x0)},
+    {5273635759440664680ULL, 1, MOVE(49, 41, 0x0)},
+    {5288160281399232754ULL, 2, MOVE(9, 17, 0x0)},
+    {5288160281399232754ULL, 1, MOVE(1, 18, 0x0)},
+    {5289978294856371695ULL, 2, MOVE(59, 57, 0x2)},
+    {5291462465963502586ULL, 3, MOVE(1, 18, 0x0)},
+    {5292154392513827219ULL, 1, MOVE(46, 14, 0x4)},
+    {5299146982517223296ULL, 1, MOVE(12, 28, 0x1)},
+    {5305173457097937315ULL, 1, MOVE(52, 44, 0x0)},
+    {5305531818698032411ULL, 1, MOVE(43, 36, 0x4)},
+    {5308035162680352407ULL, 1, MOVE(13, 29, 0x1)},
+    {5310766221877018084ULL, 15, MOVE(58, 49, 0x0)},
+    {5311979506466491191ULL, 1, MOVE(58, 49, 0x0)},
+    {5315983078722168639ULL, 1, MOVE(37, 28, 0x4)},
+    {5318238419023606241ULL, 44, MOVE(57, 42, 0x0)},
+    {5320304692222912795ULL, 1, MOVE(53, 45, 0x0)},
+    {5323389033445942564ULL, 3, MOVE(52, 44, 0x0)},
+    {5323389033445942564ULL, 2, MOVE(58, 51, 0x0)},
+    {5323941034666326580ULL, 7, MOVE(60, 46, 0x0)},
+    {5323941034666326580ULL, 4, MOVE(61, 52, 0x0)},
+    {5323941034666326580ULL, 2, MOVE(57, 51, 0x0)},
+    {5327852733952340572ULL, 220, MOVE(52, 36, 0x1)},
+    {5331602436707500901ULL, 6, MOVE(59, 57, 0x2)},
+    {5331602436707500901ULL, 1, MOVE(60, 53, 0x0)},
+    {5345365394122846388ULL, 1, MOVE(51, 35, 0x1)},
+    {5345365394122846388ULL, 1, MOVE(61, 34, 0x0)},
+    {5350892883620707258ULL, 1, MOVE(51, 35, 0x1)},
+    {5352034229397960676ULL, 7, MOVE(27, 35, 0x0)},
+    {5352034229397960676ULL, 6, MOVE(29, 36, 0x4)},
+    {5354207182214651668ULL, 1, MOVE(2, 9, 0x0)},
+    {5356172736216213452ULL, 3, MOVE(2, 29, 0x4)},
+    {5369404352764686048ULL, 4, MOVE(52, 36, 0x1)},
+    {5369404352764686048ULL, 3, MOVE(59, 57, 0x2)},
+    {5370531455934950085ULL, 2, MOVE(53, 37, 0x1)},
+    {5370531455934950085ULL, 1, MOVE(59, 57, 0x2)},
+    {5371587003345658093ULL, 1, MOVE(15, 23, 0x0)},
+    {5372682389148413984ULL, 1, MOVE(57, 42, 0x0)},
+    {5379048569990581756ULL, 5, MOVE(51, 43, 0x0)},
+    {5387360050822967584ULL, 2, MOVE(49, 41, 0x0)},
+    {5389197089277834969ULL, 2, MOVE(29, 36, 0x4)},
+    {5391897694672949799ULL, 2, MOVE(58, 30, 0x0)},
+    {5393527823492562986ULL, 2, MOVE(52, 44, 0x0)},
+    {5393528153754143595ULL, 18, MOVE(59, 57, 0x2)},
+    {5399978934741583194ULL, 1, MOVE(60, 39, 0x0)},
+    {5413237604161225658ULL, 1, MOVE(19, 28, 0x4)},
+    {5415374067267434735ULL, 1, MOVE(62, 45, 0x0)},
+    {5415374067267434735ULL, 1, MOVE(55, 47, 0x0)},
+    {5416458353781675824ULL, 1, MOVE(37, 28, 0x4)},
+    {5425489287689898963ULL, 1, MOVE(6, 21, 0x0)},
+    {5426689571434376504ULL, 6, MOVE(61, 25, 0x0)},
+    {5426689571434376504ULL, 3, MOVE(36, 27, 0x4)},
+    {5426689571434376504ULL, 2, MOVE(57, 42, 0x0)},
+    {5426689571434376504ULL, 2, MOVE(49, 41, 0x0)},
+    {5429424212188372399ULL, 1, MOVE(59, 57, 0x2)},
+    {5436452453872596321ULL, 1, MOVE(57, 42, 0x0)},
+    {5446751101491036632ULL, 1, MOVE(48, 40, 0x0)},
+    {5449587215307019566ULL, 192, MOVE(42, 27, 0x4)},
+    {5449587215307019566ULL, 4, MOVE(58, 37, 0x0)},
+    {5450301859196339202ULL, 4, MOVE(62, 45, 0x0)},
+    {5451883719712186470ULL, 1, MOVE(62, 52, 0x0)},
+    {5455325221117840961ULL, 1, MOVE(27, 36, 0x4)},
+    {5461682344064370318ULL, 1, MOVE(62, 45, 0x0)},
+    {5463682016699286339ULL, 1, MOVE(57, 42, 0x0)},
+    {5465062024802220030ULL, 2, MOVE(52, 44, 0x0)},
+    {5466096304987133231ULL, 37, MOVE(12, 20, 0x0)},
+    {5466096304987133231ULL, 5, MOVE(12, 28, 0x1)},
+    {5466096304987133231ULL, 4, MOVE(18, 33, 0x0)},
+    {5469165179342862445ULL, 2, MOVE(59, 57, 0x2)},
+    {5474483463039031077ULL, 8, MOVE(36, 30, 0x0)},
+    {5479084942456757243ULL, 5, MOVE(6, 21, 0x0)},
+    {5479499687742859496ULL, 2, MOVE(51, 43, 0x0)},
+    {5479499687742859496ULL, 2, MOVE(55, 47, 0x0)},
+    {5492901291724541284ULL, 14, MOVE(51, 43, 0x0)},
+    {5492901291724541284ULL, 2, MOVE(53, 45, 0x0)},
+    {5492901291724541284ULL, 1, MOVE(36, 29, 0x4)},
+    {5495942616813085413ULL, 1, MOVE(58, 51, 0x0)},
+    {5497339343509371663ULL, 1, MOVE(5, 33, 0x0)},
+    {5499673848538393555ULL, 2, MOVE(57, 42, 0x0)},
+    {5501489766183225896ULL, 1, MOVE(53, 37, 0x1)},
+    {5503580811491008221ULL, 2, MOVE(52, 36, 0x1)},
+    {5503580811491008221ULL, 1, MOVE(55, 47, 0x0)},
+    {5508400785683307929ULL, 1, MOVE(42, 52, 0x0)},
+    {5509679116796244041ULL, 1, MOVE(6, 21, 0x0)},
+    {5510446638222368955ULL, 1, MOVE(58, 51, 0x0)},
+    {5511004320492376252ULL, 5, MOVE(57, 42, 0x0)},
+    {5511004320492376252ULL, 4, MOVE(52, 44, 0x0)},
+    {5517498278492602745ULL, 1, MOVE(6, 21, 0x0)},
+    {5519562321370165770ULL, 1, MOVE(57, 42, 0x0)},
+    {5521289663563409989ULL, 1, MOVE(57, 42, 0x0)},
+    {5521450094658793946ULL, 8, MOVE(62, 45, 0x0)},
+    {5521809617117088641ULL, 1, MOVE(37, 28, 0x4)},
+    {5523003778063322324ULL, 2, MOVE(51, 35, 0x1)},
+    {5524180836157283416ULL, 148, MOVE(18, 28, 0x4)},
+    {5524180836157283416ULL, 2, MOVE(13, 21, 0x0)},
+    {5525225392706140401ULL, 1, MOVE(58, 49, 0x0)},
+    {5525578076056028078ULL, 1, MOVE(59, 57, 0x2)},
+    {5525999096397230102ULL, 1, MOVE(61, 52, 0x0)},
+    {5529947049306529443ULL, 1, MOVE(11, 19, 0x0)},
+    {5532767636701226487ULL, 1, MOVE(1, 11, 0x0)},
+    {5536440748729165775ULL, 12, MOVE(52, 36, 0x1)},
+    {5536440748729165775ULL, 4, MOVE(57, 42, 0x0)},
+    {5536440748729165775ULL, 3, MOVE(49, 41, 0x0)},
+    {5536440748729165775ULL, 3, MOVE(53, 37, 0x1)},
+    {5536440748729165775ULL, 2, MOVE(51, 35, 0x1)},
+    {5545313792472394485ULL, 1, MOVE(2, 11, 0x0)},
+    {5546885415263509404ULL, 1, MOVE(51, 43, 0x0)},
+    {5547361544348361691ULL, 1, MOVE(2, 9, 0x0)},
+    {5555672566170381665ULL, 2, MOVE(37, 28, 0x4)},
+    {5557366448656898951ULL, 5, MOVE(58, 49, 0x0)},
+    {5557366448656898951ULL, 1, MOVE(36, 29, 0x4)},
+    {5559161046533035105ULL, 1, MOVE(48, 40, 0x0)},
+    {5568664523159430590ULL, 1, MOVE(57, 42, 0x0)},
+    {5573619307009465210ULL, 4, MOVE(3, 1, 0x2)},
+    {5579608121418440609ULL, 3, MOVE(62, 45, 0x0)},
+    {5579608121418440609ULL, 2, MOVE(49, 41, 0x0)},
+    {5579608121418440609ULL, 1, MOVE(54, 38, 0x1)},
+    {5584213710445079593ULL, 1, MOVE(57, 42, 0x0)},
+    {5587286139241334396ULL, 7, MOVE(36, 29, 0x4)},
+    {5587286139241334396ULL, 2, MOVE(49, 41, 0x0)},
+    {5588840905901031889ULL, 1, MOVE(13, 29, 0x1)},
+    {5590334923996294206ULL, 1, MOVE(49, 41, 0x0)},
+    {5596182344359717633ULL, 7, MOVE(31, 22, 0x0)},
+    {5599443551454995430ULL, 1, MOVE(30, 12, 0x4)},
+    {5606354080358853735ULL, 5, MOVE(53, 37, 0x1)},
+    {5606354080358853735ULL, 1, MOVE(52, 44, 0x0)},
+    {5606354080358853735ULL, 1, MOVE(62, 45, 0x0)},
+    {5606354080358853735ULL, 1, MOVE(57, 42, 0x0)},
+    {5606354080358853735ULL, 1, MOVE(50, 34, 0x1)},
+    {5614025025071997159ULL, 1, MOVE(4, 13, 0x0)},
+    {5614207512099928577ULL, 4, MOVE(54, 46, 0x0)},
+    {5615283495990803939ULL, 1, MOVE(12, 20, 0x0)},
+    {5615811326698465498ULL, 153, MOVE(51, 43, 0x0)},
+    {5615811326698465498ULL, 82, MOVE(36, 29, 0x4)},
+    {5615811326698465498ULL, 78, MOVE(55, 47, 0x0)},
+    {5615811326698465498ULL, 4, MOVE(60, 46, 0x0)},
+    {5615811326698465498ULL, 1, MOVE(49, 41, 0x0)},
+    {5617810014797473686ULL, 3, MOVE(57, 42, 0x0)},
+    {5617848682939648388ULL, 1, MOVE(49, 33, 0x1)},
+    {5621189709276204188ULL, 1, MOVE(14, 30, 0x1)},
+    {5621189709276204188ULL, 1, MOVE(14, 22, 0x0)},
+    {5622395453672221776ULL, 1, MOVE(62, 45, 0x0)},
+    {5623982917117126930ULL, 1, MOVE(2, 38, 0x0)},
+    {5626127625140137532ULL, 10, MOVE(60, 36, 0x4)},
+    {5626127625140137532ULL, 4, MOVE(43, 36, 0x4)},
+    {5626951822377955140ULL, 4, MOVE(1, 11, 0x0)},
+    {5626951822377955140ULL, 1, MOVE(2, 20, 0x0)},
+    {5631285317553132652ULL, 12, MOVE(36, 46, 0x0)},
+    {5631908053379118479ULL, 1, MOVE(27, 36, 0x4)},
+    {5633346526629069933ULL, 1, MOVE(57, 42, 0x0)},
+    {5634848134482122172ULL, 1, MOVE(6, 21, 0x0)},
+    {5635356405803296385ULL, 1, MOVE(53, 37, 0x1)},
+    {5635356405803296385ULL, 1, MOVE(59, 57, 0x2)},
+    {5635556337638635408ULL, 3, MOVE(11, 19, 0x0)},
+    {5635556337638635408ULL, 1, MOVE(29, 37, 0x0)},
+    {5639404259105870128ULL, 1, MOVE(62, 52, 0x0)},
+    {5648008255583555519ULL, 1, MOVE(21, 11, 0x0)},
+    {5652963652373749011ULL, 1, MOVE(52, 36, 0x1)},
+    {5658798092240929581ULL, 3, MOVE(61, 54, 0x0)},
+    {5658798092240929581ULL, 1, MOVE(59, 57, 0x2)},
+    {5661518234690268547ULL, 4, MOVE(1, 18, 0x0)},
+    {5661868455931379567ULL, 2, MOVE(1, 18, 0x0)},
+    {5669295284370306900ULL, 15, MOVE(2, 29, 0x0)},
+    {5678631479806726071ULL, 1, MOVE(9, 17, 0x0)},
+    {5678631479806726071ULL, 1, MOVE(15, 23, 0x0)},
+    {5687986392577020855ULL, 12, MOVE(6, 21, 0x0)},
+    {5687986392577020855ULL, 5, MOVE(12, 28, 0x1)},
+    {5687986392577020855ULL, 1, MOVE(14, 22, 0x0)},
+    {5689738277423355132ULL, 1, MOVE(52, 36, 0x1)},
+    {5692981133863823438ULL, 6, MOVE(51, 42, 0x4)},
+    {5692981133863823438ULL, 3, MOVE(49, 42, 0x4)},
+    {5695227468681863963ULL, 1, MOVE(27, 34, 0x4)},
+    {5698785368986343228ULL, 2, MOVE(11, 19, 0x0)},
+    {5698785368986343228ULL, 1, MOVE(8, 16, 0x0)},
+    {5704390530224328382ULL, 2, MOVE(35, 27, 0x0)},
+    {5704785486228255402ULL, 5, MOVE(58, 51, 0x0)},
+    {5704785486228255402ULL, 3, MOVE(36, 29, 0x4)},
+    {5704785486228255402ULL, 2, MOVE(58, 44, 0x0)},
+    {5704785486228255402ULL, 2, MOVE(55, 47, 0x0)},
+    {5704785486228255402ULL, 2, MOVE(53, 45, 0x0)},
+    {5704785486228255402ULL, 2, MOVE(54, 46, 0x0)},
+    {5704785486228255402ULL, 1, MOVE(53, 37, 0x1)},
+    {5705570606138229330ULL, 1, MOVE(4, 11, 0x0)},
+    {5711333172288066496ULL, 2, MOVE(6, 21, 0x0)},
+    {5712043622602678329ULL, 4, MOVE(9, 17, 0x0)},
+    {5712043622602678329ULL, 2, MOVE(10, 26, 0x1)},
+    {5712043622602678329ULL, 1, MOVE(2, 29, 0x0)},
+    {5716014382120065911ULL, 1, MOVE(4, 11, 0x0)},
+    {5725786007155629831ULL, 1, MOVE(50, 34, 0x1)},
+    {5727393830878028585ULL, 1, MOVE(33, 24, 0x0)},
+    {5728361461735919432ULL, 1, MOVE(53, 37, 0x1)},
+    {5730627460335038324ULL, 1, MOVE(1, 18, 0x0)},
+    {5733586795510304179ULL, 4, MOVE(49, 41, 0x0)},
+    {5733586795510304179ULL, 1, MOVE(52, 36, 0x1)},
+    {5736792577259520223ULL, 1, MOVE(10, 26, 0x1)},
+    {5737912747907144810ULL, 10, MOVE(62, 45, 0x0)},
+    {5739880578589168217ULL, 1, MOVE(59, 57, 0x2)},
+    {5739880578589168217ULL, 1, MOVE(53, 37, 0x1)},
+    {5743952900217595174ULL, 1, MOVE(58, 51, 0x0)},
+    {5754448045919625811ULL, 1, MOVE(61, 54, 0x0)},
+    {5758437391155520846ULL, 1, MOVE(61, 25, 0x0)},
+    {5767964915664738883ULL, 18, MOVE(6, 21, 0x0)},
+    {5767964915664738883ULL, 5, MOVE(9, 17, 0x0)},
+    {5781340802398765730ULL, 1, MOVE(57, 51, 0x0)},
+    {5782162683624352658ULL, 1, MOVE(62, 45, 0x0)},
+    {5783160974389134316ULL, 2, MOVE(51, 43, 0x0)},
+    {5786959257679165473ULL, 1, MOVE(52, 36, 0x1)},
+    {5787815161418228002ULL, 1, MOVE(2, 11, 0x0)},
+    {5788885836947617653ULL, 2, MOVE(12, 28, 0x1)},
+    {5790572532107766419ULL, 2, MOVE(57, 42, 0x0)},
+    {5792817998996072220ULL, 1, MOVE(28, 34, 0x0)},
+    {5798245470178220433ULL, 1, MOVE(51, 43, 0x0)},
+    {5799671569739277097ULL, 1, MOVE(9, 17, 0x0)},
+    {5804136506510852873ULL, 1, MOVE(1, 18, 0x0)},
+    {5804136506510852873ULL, 1, MOVE(12, 28, 0x1)},
+    {5807311083072943038ULL, 4, MOVE(59, 57, 0x2)},
+    {5807311083072943038ULL, 2, MOVE(52, 44, 0x0)},
+    {5811248792171892345ULL, 1, MOVE(1, 18, 0x0)},
+    {5811751137337086653ULL, 1, MOVE(62, 45, 0x0)},
+    {5815989514781190339ULL, 1, MOVE(42, 36, 0x4)},
+    {5816582285831007470ULL, 1, MOVE(4, 28, 0x4)},
+    {5822382848509794852ULL, 1, MOVE(2, 9, 0x0)},
+    {5824518216831573411ULL, 1, MOVE(2, 9, 0x0)},
+    {5828343441854373965ULL, 1, MOVE(52, 44, 0x0)},
+    {5829757181024350118ULL, 1, MOVE(52, 36, 0x1)},
+    {5831039527322408896ULL, 1, MOVE(6, 23, 0x0)},
+    {5839849230185073442ULL, 2, MOVE(52, 36, 0x1)},
+    {5839849230185073442ULL, 1, MOVE(55, 47, 0x0)},
+    {5841479546949721253ULL, 10, MOVE(3, 1, 0x2)},
+    {5841479546949721253ULL, 1, MOVE(14, 30, 0x1)},
+    {5857685476532575911ULL, 2, MOVE(2, 9, 0x0)},
+    {5859473755817451731ULL, 4, MOVE(58, 49, 0x0)},
+    {5859663732633032685ULL, 2, MOVE(60, 42, 0x0)},
+    {5862500427039791725ULL, 1, MOVE(11, 19, 0x0)},
+    {5869385635844162790ULL, 1, MOVE(4, 25, 0x0)},
+    {5869385635844162790ULL, 1, MOVE(15, 23, 0x0)},
+    {5872442014914898408ULL, 1, MOVE(37, 28, 0x4)},
+    {5884204378543251602ULL, 1, MOVE(1, 18, 0x0)},
+    {5894677859421006814ULL, 1, MOVE(2, 11, 0x0)},
+    {5900995483915836396ULL, 1, MOVE(58, 30, 0x0)},
+    {5908257543455764165ULL, 1, MOVE(58, 49, 0x0)},
+    {5913552815726747421ULL, 1, MOVE(43, 36, 0x4)},
+    {5916316915344667034ULL, 1, MOVE(6, 21, 0x0)},
+    {5916316915344667034ULL, 1, MOVE(27, 35, 0x0)},
+    {5916808714158458136ULL, 1, MOVE(6, 21, 0x0)},
+    {5916808714158458136ULL, 1, MOVE(9, 17, 0x0)},
+    {5919202627442975580ULL, 1, MOVE(58, 49, 0x0)},
+    {5919407591780574103ULL, 1, MOVE(11, 28, 0x4)},
+    {5920345288413399044ULL, 1, MOVE(37, 30, 0x4)},
+    {5925706632288704309ULL, 1, MOVE(51, 43, 0x0)},
+    {5928803841124443528ULL, 1, MOVE(12, 28, 0x1)},
+    {5931596520312635387ULL, 2, MOVE(59, 57, 0x2)},
+    {5932018617549272852ULL, 2, MOVE(27, 35, 0x0)},
+    {5932018617549272852ULL, 1, MOVE(2, 20, 0x0)},
+    {5932046571378890575ULL, 1, MOVE(2, 9, 0x0)},
+    {5934393962861427507ULL, 42, MOVE(53, 37, 0x1)},
+    {5937910730736034284ULL, 1, MOVE(58, 44, 0x0)},
+    {5938265950095904367ULL, 1, MOVE(27, 36, 0x4)},
+    {5938379997229303409ULL, 325, MOVE(6, 21, 0x0)},
+    {5938379997229303409ULL, 85, MOVE(9, 17, 0x0)},
+    {5938379997229303409ULL, 15, MOVE(5, 33, 0x0)},
+    {5938379997229303409ULL, 4, MOVE(11, 19, 0x0)},
+    {5943107510020347667ULL, 1, MOVE(6, 23, 0x0)},
+    {5943300442968134893ULL, 491, MOVE(37, 28, 0x4)},
+    {5943300442968134893ULL, 5, MOVE(57, 42, 0x0)},
+    {5949039013920863633ULL, 1, MOVE(1, 18, 0x0)},
+    {5952241067106006149ULL, 1, MOVE(15, 23, 0x0)},
+    {5955233734146678549ULL, 1, MOVE(59, 57, 0x2)},
+    {5959230123311104082ULL, 5, MOVE(34, 41, 0x0)},
+    {5962495208508805036ULL, 1, MOVE(29, 22, 0x0)},
+    {5964162417892050927ULL, 9, MOVE(57, 42, 0x0)},
+    {5964162417892050927ULL, 2, MOVE(36, 29, 0x4)},
+    {5964162417892050927ULL, 1, MOVE(53, 45, 0x0)},
+    {5968094954592620232ULL, 1, MOVE(1, 18, 0x0)},
+    {5968094954592620232ULL, 1, MOVE(5, 26, 0x0)},
+    {5978595520403372684ULL, 1, MOVE(2, 9, 0x0)},
+    {5979050373511178273ULL, 3, MOVE(15, 31, 0x1)},
+    {5979050373511178273ULL, 2, MOVE(8, 24, 0x1)},
+    {5979050373511178273ULL, 1, MOVE(10, 26, 0x1)},
+    {5980161654158998280ULL, 1, MOVE(52, 44, 0x0)},
+    {5982474482549182572ULL, 1, MOVE(62, 45, 0x0)},
+    {5987116548675183042ULL, 108, MOVE(5, 33, 0x0)},
+    {5987116548675183042ULL, 92, MOVE(11, 19, 0x0)},
+    {5987116548675183042ULL, 6, MOVE(9, 17, 0x0)},
+    {5987116548675183042ULL, 4, MOVE(4, 20, 0x0)},
+    {5987116548675183042ULL, 1, MOVE(29, 36, 0x4)},
+    {5987116548675183042ULL, 1, MOVE(4, 22, 0x0)},
+    {6002176467628409345ULL, 2, MOVE(48, 40, 0x0)},
+    {6002176467628409345ULL, 1, MOVE(53, 37, 0x1)},
+    {6005901262839606125ULL, 3, MOVE(58, 49, 0x0)},
+    {6005901262839606125ULL, 2, MOVE(36, 29, 0x4)},
+    {6005901262839606125ULL, 2, MOVE(55, 47, 0x0)},
+    {6005901262839606125ULL, 1, MOVE(42, 52, 0x0)},
+    {6009114278758010141ULL, 1, MOVE(29, 36, 0x4)},
+    {6014377655940361266ULL, 1, MOVE(54, 38, 0x1)},
+    {6014928242435222069ULL, 1, MOVE(58, 44, 0x0)},
+    {6033719119731001948ULL, 34, MOVE(58, 30, 0x0)},
+    {6033719119731001948ULL, 4, MOVE(54, 38, 0x1)},
+    {6035871590717364595ULL, 1, MOVE(58, 51, 0x0)},
+    {6035871590717364595ULL, 1, MOVE(54, 46, 0x0)},
+    {6036012125726816154ULL, 1, MOVE(5, 12, 0x0)},
+    {6045171391468466416ULL, 16, MOVE(51, 35, 0x1)},
+    {6045171391468466416ULL, 9, MOVE(49, 41, 0x0)},
+    {6045171391468466416ULL, 9, MOVE(57, 42, 0x0)},
+    {6047595481661420425ULL, 1, MOVE(13, 21, 0x0)},
+    {6056692285711269483ULL, 1, MOVE(1, 18, 0x0)},
+    {6067157186522853717ULL, 1, MOVE(1, 18, 0x0)},
+    {6070212168191659662ULL, 1, MOVE(1, 18, 0x0)},
+    {6072106927649988903ULL, 1, MOVE(60, 53, 0x0)},
+    {6072106927649988903ULL, 1, MOVE(49, 41, 0x0)},
+    {6074180682625210914ULL, 2, MOVE(52, 44, 0x0)},
+    {6074837467034845662ULL, 3, MOVE(1, 18, 0x0)},
+    {6080126204672774078ULL, 1, MOVE(6, 21, 0x0)},
+    {6080981157935106695ULL, 1, MOVE(27, 10, 0x4)},
+    {6084865322175809795ULL, 2, MOVE(4, 31, 0x0)},
+    {6089610037671354878ULL, 1, MOVE(5, 33, 0x0)},
+    {6092508994023809536ULL, 1, MOVE(55, 47, 0x0)},
+    {6093706452326611260ULL, 2, MOVE(57, 42, 0x0)},
+    {6093706452326611260ULL, 2, MOVE(55, 47, 0x0)},
+    {6093706452326611260ULL, 1, MOVE(53, 45, 0x0)},
+    {6093801372723278857ULL, 16, MOVE(58, 51, 0x0)},
+    {6093801372723278857ULL, 16, MOVE(58, 37, 0x0)},
+    {6093801372723278857ULL, 7, MOVE(48, 40, 0x0)},
+    {6093941527853937602ULL, 2, MOVE(35, 28, 0x4)},
+    {6094161083065346371ULL, 15, MOVE(62, 45, 0x0)},
+    {6098663799531879423ULL, 3, MOVE(18, 28, 0x4)},
+    {6098913703770649056ULL, 13, MOVE(6, 21, 0x0)},
+    {6098913703770649056ULL, 8, MOVE(14, 22, 0x0)},
+    {6099132900998907640ULL, 1, MOVE(34, 20, 0x4)},
+    {6101248211433792277ULL, 1, MOVE(61, 25, 0x0)},
+    {6102224732459341507ULL, 5, MOVE(58, 51, 0x0)},
+    {6102224732459341507ULL, 1, MOVE(53, 37, 0x1)},
+    {6102227344327626433ULL, 37, MOVE(52, 36, 0x1)},
+    {6102227344327626433ULL, 4, MOVE(58, 30, 0x0)},
+    {6102227344327626433ULL, 3, MOVE(53, 37, 0x1)},
+    {6102227344327626433ULL, 2, MOVE(57, 42, 0x0)},
+    {6102227344327626433ULL, 1, MOVE(54, 46, 0x0)},
+    {6105018548052386563ULL, 1, MOVE(52, 44, 0x0)},
+    {6105018548052386563ULL, 1, MOVE(62, 45, 0x0)},
+    {6108324771026802591ULL, 1, MOVE(14, 21, 0x4)},
+    {6110199738464616719ULL, 155, MOVE(57, 42, 0x0)},
+    {6110199738464616719ULL, 7, MOVE(36, 29, 0x4)},
+    {6111041970417421142ULL, 2, MOVE(59, 57, 0x2)},
+    {6114732627028003100ULL, 1, MOVE(52, 45, 0x4)},
+    {6114789344166258153ULL, 1, MOVE(60, 36, 0x4)},
+    {6116848448814189756ULL, 1, MOVE(6, 12, 0x0)},
+    {6119325312330059491ULL, 1, MOVE(58, 51, 0x0)},
+    {6120775995328749282ULL, 1, MOVE(2, 9, 0x0)},
+    {6121481513974814369ULL, 9, MOVE(52, 36, 0x1)},
+    {6121481513974814369ULL, 2, MOVE(58, 37, 0x0)},
+    {6122228294476936540ULL, 2, MOVE(49, 41, 0x0)},
+    {6122447396797997856ULL, 9, MOVE(58, 49, 0x0)},
+    {6122447396797997856ULL, 6, MOVE(36, 46, 0x0)},
+    {6133272759351824604ULL, 2, MOVE(51, 43, 0x0)},
+    {6133272759351824604ULL, 2, MOVE(62, 45, 0x0)},
+    {6133301595152107456ULL, 3, MOVE(6, 12, 0x0)},
+    {6133301595152107456ULL, 2, MOVE(26, 17, 0x0)},
+    {6133301595152107456ULL, 1, MOVE(2, 11, 0x0)},
+    {6145707649618565349ULL, 1, MOVE(60, 53, 0x0)},
+    {6148795439238606372ULL, 4, MOVE(54, 38, 0x1)},
+    {6159264229901429919ULL, 4, MOVE(25, 18, 0x4)},
+    {6160594505044693097ULL, 1, MOVE(12, 28, 0x1)},
+    {6162882846702653527ULL, 1, MOVE(57, 42, 0x0)},
+    {6168087577737131984ULL, 1, MOVE(7, 6, 0x0)},
+    {6169696536687634281ULL, 3, MOVE(12, 28, 0x1)},
+    {6169696536687634281ULL, 1, MOVE(3, 1, 0x2)},
+    {6174515128114182479ULL, 1, MOVE(21, 28, 0x4)},
+    {6180121040166120176ULL, 1, MOVE(51, 35, 0x1)},
+    {6180531476297621462ULL, 3, MOVE(9, 17, 0x0)},
+    {6185603913973472474ULL, 1, MOVE(53, 45, 0x0)},
+    {6188961432683994652ULL, 5, MOVE(6, 21, 0x0)},
+    {6188961432683994652ULL, 2, MOVE(9, 17, 0x0)},
+    {6192581974320272500ULL, 2, MOVE(58, 49, 0x0)},
+    {6192581974320272500ULL, 1, MOVE(42, 27, 0x0)},
+    {6199532930025342549ULL, 7, MOVE(52, 36, 0x1)},
+    {6201738590751326802ULL, 1, MOVE(1, 18, 0x0)},
+    {6206697275568134836ULL, 1, MOVE(61, 54, 0x0)},
+    {6210545000529033810ULL, 88, MOVE(1, 18, 0x0)},
+    {6210545000529033810ULL, 20, MOVE(2, 11, 0x0)},
+    {6210545000529033810ULL, 15, MOVE(10, 18, 0x0)},
+    {6210545000529033810ULL, 15, MOVE(8, 16, 0x0)},
+    {6210545000529033810ULL, 5, MOVE(1, 11, 0x0)},
+    {6210545000529033810ULL, 5, MOVE(2, 20, 0x0)},
+    {6210545000529033810ULL, 2, MOVE(10, 26, 0x1)},
+    {6210545000529033810ULL, 1, MOVE(5, 33, 0x0)},
+    {6217809644610768984ULL, 3, MOVE(60, 51, 0x0)},
+    {6218083210109751075ULL, 1, MOVE(6, 21, 0x0)},
+    {6218083210109751075ULL, 1, MOVE(28, 36, 0x0)},
+    {6218408705886042665ULL, 1, MOVE(57, 42, 0x0)},
+    {6219142053654397957ULL, 1, MOVE(13, 21, 0x0)},
+    {6222956601307235780ULL, 1, MOVE(49, 41, 0x0)},
+    {6238136996356891524ULL, 1, MOVE(2, 9, 0x0)},
+    {6238136996356891524ULL, 1, MOVE(12, 20, 0x0)},
+    {6242475919740069587ULL, 4, MOVE(49, 41, 0x0)},
+    {6242475919740069587ULL, 3, MOVE(61, 52, 0x0)},
+    {6246190945856957790ULL, 2, MOVE(55, 47, 0x0)},
+    {6248572871068167475ULL, 1, MOVE(52, 36, 0x1)},
+    {6252022520114601050ULL, 1, MOVE(57, 42, 0x0)},
+    {6257337012647299978ULL, 1, MOVE(12, 28, 0x1)},
+    {6265808162910730257ULL, 2, MOVE(58, 51, 0x0)},
+    {6265808162910730257ULL, 1, MOVE(36, 29, 0x4)},
+    {6265808162910730257ULL, 1, MOVE(36, 28, 0x0)},
+    {6265808162910730257ULL, 1, MOVE(53, 37, 0x1)},
+    {6272273757919023540ULL, 2, MOVE(11, 19, 0x0)},
+    {6272433479420686511ULL, 1, MOVE(1, 11, 0x0)},
+    {6279419389070596696ULL, 58, MOVE(51, 35, 0x1)},
+    {6279419389070596696ULL, 21, MOVE(51, 43, 0x0)},
+    {6279419389070596696ULL, 11, MOVE(53, 37, 0x1)},
+    {6279419389070596696ULL, 8, MOVE(49, 41, 0x0)},
+    {6279419389070596696ULL, 5, MOVE(52, 36, 0x1)},
+    {6279419389070596696ULL, 1, MOVE(53, 45, 0x0)},
+    {6279419389070596696ULL, 1, MOVE(52, 44, 0x0)},
+    {6290376763383841339ULL, 1, MOVE(18, 35, 0x0)},
+    {6294148628830015451ULL, 2, MOVE(8, 16, 0x0)},
+    {6303982029310930464ULL, 25, MOVE(18, 28, 0x4)},
+    {6318803886637435247ULL, 1, MOVE(48, 40, 0x0)},
+    {6318803886637435247ULL, 1, MOVE(62, 45, 0x0)},
+    {6318846912658469930ULL, 1, MOVE(2, 9, 0x0)},
+    {6323382415598619836ULL, 1, MOVE(12, 20, 0x0)},
+    {6323382415598619836ULL, 1, MOVE(12, 28, 0x1)},
+    {6328327604529795189ULL, 1, MOVE(51, 35, 0x1)},
+    {6328452954341734605ULL, 1, MOVE(61, 54, 0x0)},
+    {6333163837910002517ULL, 1, MOVE(48, 32, 0x1)},
+    {6336426424493360561ULL, 58, MOVE(1, 18, 0x0)},
+    {6336426424493360561ULL, 13, MOVE(6, 12, 0x0)},
+    {6336426424493360561ULL, 8, MOVE(8, 24, 0x1)},
+    {6336426424493360561ULL, 6, MOVE(5, 19, 0x0)},
+    {6336426424493360561ULL, 5, MOVE(6, 21, 0x0)},
+    {6336426424493360561ULL, 1, MOVE(2, 20, 0x0)},
+    {6344071928342153599ULL, 1, MOVE(49, 41, 0x0)},
+    {6344071928342153599ULL, 1, MOVE(51, 43, 0x0)},
+    {6356945566280843511ULL, 1, MOVE(51, 43, 0x0)},
+    {6359676239665388636ULL, 1, MOVE(9, 17, 0x0)},
+    {6360856397742740939ULL, 1, MOVE(60, 53, 0x0)},
+    {6361401850376070727ULL, 1, MOVE(35, 27, 0x0)},
+    {6365250423035260639ULL, 1, MOVE(62, 52, 0x0)},
+    {6368504814669820655ULL, 1, MOVE(62, 45, 0x0)},
+    {6372679499705114566ULL, 14, MOVE(36, 46, 0x0)},
+    {6385102848399624523ULL, 15, MOVE(35, 28, 0x4)},
+    {6385102848399624523ULL, 1, MOVE(58, 30, 0x0)},
+    {6386867407666156985ULL, 1, MOVE(53, 37, 0x1)},
+    {6392777289878072855ULL, 2, MOVE(59, 57, 0x2)},
+    {6393060314176663196ULL, 1, MOVE(53, 37, 0x1)},
+    {6397105971888477125ULL, 3, MOVE(53, 37, 0x1)},
+    {6397105971888477125ULL, 1, MOVE(58, 51, 0x0)},
+    {6399184565892408140ULL, 12, MOVE(3, 1, 0x2)},
+    {6399184565892408140ULL, 1, MOVE(21, 36, 0x0)},
+    {6402264709200718483ULL, 2, MOVE(18, 35, 0x4)},
+    {6402264709200718483ULL, 2, MOVE(13, 21, 0x0)},
+    {6404683846195754275ULL, 2, MOVE(53, 45, 0x0)},
+    {6406245643920822379ULL, 1, MOVE(54, 46, 0x0)},
+    {6413787878872082660ULL, 1, MOVE(9, 17, 0x0)},
+    {6421891808251960010ULL, 1, MOVE(32, 18, 0x4)},
+    {6421975591379017013ULL, 1, MOVE(6, 21, 0x0)},
+    {6424785024834049124ULL, 1, MOVE(58, 49, 0x0)},
+    {6426866533607652819ULL, 9, MOVE(6, 21, 0x0)},
+    {6426866533607652819ULL, 2, MOVE(1, 18, 0x0)},
+    {6426866533607652819ULL, 1, MOVE(5, 19, 0x0)},
+    {6434299344458721954ULL, 1, MOVE(58, 49, 0x0)},
+    {6440242886014648904ULL, 1, MOVE(49, 41, 0x0)},
+    {6442119805092351441ULL, 10, MOVE(12, 28, 0x1)},
+    {6442640849711823585ULL, 1, MOVE(2, 9, 0x0)},
+    {6448505379912021236ULL, 1, MOVE(51, 43, 0x0)},
+    {6454488397478818427ULL, 1, MOVE(51, 45, 0x0)},
+    {6455934058614994713ULL, 1, MOVE(38, 29, 0x4)},
+    {6458685675640504093ULL, 3, MOVE(43, 36, 0x4)},
+    {6460619418394365507ULL, 1, MOVE(13, 21, 0x0)},
+    {6462129320683039070ULL, 1, MOVE(25, 18, 0x4)},
+    {6465019514951830235ULL, 3, MOVE(1, 18, 0x0)},
+    {6467201969773744832ULL, 3, MOVE(43, 36, 0x4)},
+    {6467794711089059040ULL, 4, MOVE(57, 42, 0x0)},
+    {6468360512672987624ULL, 2, MOVE(11, 19, 0x0)},
+    {6468360512672987624ULL, 1, MOVE(6, 21, 0x0)},
+    {6468360512672987624ULL, 1, MOVE(4, 13, 0x0)},
+    {6475952180568536409ULL, 30, MOVE(62, 45, 0x0)},
+    {6475952180568536409ULL, 20, MOVE(57, 42, 0x0)},
+    {6475952180568536409ULL, 1, MOVE(49, 41, 0x0)},
+    {6475952180568536409ULL, 1, MOVE(52, 44, 0x0)},
+    {6491736691617377108ULL, 1, MOVE(19, 28, 0x4)},
+    {6493750555223827656ULL, 2, MOVE(2, 9, 0x0)},
+    {6499654851304846777ULL, 15, MOVE(1, 18, 0x0)},
+    {6499654851304846777ULL, 7, MOVE(9, 17, 0x0)},
+    {6499654851304846777ULL, 1, MOVE(2, 20, 0x0)},
+    {6504415798097342120ULL, 1, MOVE(58, 51, 0x0)},
+    {6504743862482812212ULL, 46, MOVE(21, 27, 0x4)},
+    {6509190859630459318ULL, 1, MOVE(2, 9, 0x0)},
+    {6511916568066537948ULL, 1, MOVE(28, 19, 0x4)},
+    {6524392516040585523ULL, 3, MOVE(1, 18, 0x0)},
+    {6525368963414260409ULL, 3, MOVE(18, 28, 0x4)},
+    {6526940000170854864ULL, 1, MOVE(52, 44, 0x0)},
+    {6527068165036213468ULL, 1, MOVE(38, 52, 0x4)},
+    {6527989989505014588ULL, 1, MOVE(39, 37, 0x4)},
+    {6529626200979590115ULL, 3, MOVE(27, 42, 0x0)},
+    {6535633542894813682ULL, 1, MOVE(35, 25, 0x4)},
+    {6546020266075728290ULL, 1, MOVE(51, 35, 0x1)},
+    {6546839134721197283ULL, 1, MOVE(10, 18, 0x0)},
+    {6547478190137428781ULL, 1, MOVE(37, 28, 0x4)},
+    {6550946086366465672ULL, 1, MOVE(11, 27, 0x1)},
+    {6554177081254610256ULL, 1, MOVE(30, 21, 0x4)},
+    {6562214958895417275ULL, 1, MOVE(5, 19, 0x0)},
+    {6570990682944158877ULL, 1, MOVE(2, 20, 0x0)},
+    {6570991300764576178ULL, 1, MOVE(1, 18, 0x0)},
+    {6574073981316710854ULL, 1, MOVE(61, 34, 0x0)},
+    {6578064776317023238ULL, 1, MOVE(1, 18, 0x0)},
+    {6585822173527842533ULL, 2, MOVE(2, 9, 0x0)},
+    {6589658120041875759ULL, 4, MOVE(59, 57, 0x2)},
+    {6593964448649722376ULL, 2, MOVE(58, 49, 0x0)},
+    {6603283347943169322ULL, 1, MOVE(6, 21, 0x0)},
+    {6603484904864388936ULL, 1, MOVE(6, 21, 0x0)},
+    {6604644068367150783ULL, 1, MOVE(59, 57, 0x2)},
+    {6613898738838129281ULL, 4, MOVE(49, 41, 0x0)},
+    {6614114454921487206ULL, 2, MOVE(59, 57, 0x2)},
+    {6618985435219846823ULL, 1, MOVE(51, 35, 0x1)},
+    {6618985435219846823ULL, 1, MOVE(52, 44, 0x0)},
+    {6618985435219846823ULL, 1, MOVE(57, 42, 0x0)},
+    {6620288593899286023ULL, 1, MOVE(11, 27, 0x1)},
+    {6620451861452260368ULL, 1, MOVE(42, 27, 0x4)},
+    {6627323009912906888ULL, 19, MOVE(57, 42, 0x0)},
+    {6627323009912906888ULL, 10, MOVE(52, 36, 0x1)},
+    {6627323009912906888ULL, 2, MOVE(49, 41, 0x0)},
+    {6627323009912906888ULL, 1, MOVE(51, 35, 0x1)},
+    {6627323009912906888ULL, 1, MOVE(52, 44, 0x0)},
+    {6627323009912906888ULL, 1, MOVE(51, 43, 0x0)},
+    {6629457970691134813ULL, 1, MOVE(11, 27, 0x1)},
+    {6636030340945991153ULL, 1, MOVE(11, 19, 0x0)},
+    {6636041302095576053ULL, 1, MOVE(51, 43, 0x0)},
+    {6640441679568121010ULL, 1, MOVE(52, 36, 0x1)},
+    {6652472794184470861ULL, 1, MOVE(62, 45, 0x0)},
+    {6652472794184470861ULL, 1, MOVE(52, 44, 0x0)},
+    {6663843875797161055ULL, 1, MOVE(51, 43, 0x0)},
+    {6665738033459067864ULL, 77, MOVE(49, 41, 0x0)},
+    {6665738033459067864ULL, 71, MOVE(51, 43, 0x0)},
+    {6665738033459067864ULL, 52, MOVE(53, 37, 0x1)},
+    {6665738033459067864ULL, 20, MOVE(54, 46, 0x0)},
+    {6665738033459067864ULL, 18, MOVE(53, 45, 0x0)},
+    {6665738033459067864ULL, 1, MOVE(52, 44, 0x0)},
+    {6666530347622905259ULL, 7, MOVE(52, 44, 0x0)},
+    {6670730662602215091ULL, 1, MOVE(61, 52, 0x0)},
+    {6670996885255422075ULL, 2, MOVE(58, 49, 0x0)},
+    {6671818898598234695ULL, 1, MOVE(2, 9, 0x0)},
+    {6673441240963367917ULL, 1, MOVE(58, 49, 0x0)},
+    {6678673095032707413ULL, 1, MOVE(62, 45, 0x0)},
+    {6681590582076721110ULL, 1, MOVE(11, 19, 0x0)},
+    {6681590582076721110ULL, 1, MOVE(6, 12, 0x0)},
+    {6683413329642608899ULL, 2, MOVE(29, 36, 0x4)},
+    {6689260125950577352ULL, 1366, MOVE(62, 45, 0x0)},
+    {6689260125950577352ULL, 272, MOVE(57, 42, 0x0)},
+    {6689260125950577352ULL, 4, MOVE(52, 44, 0x0)},
+    {6689260125950577352ULL, 2, MOVE(50, 34, 0x1)},
+    {6692650497847486526ULL, 2, MOVE(52, 36, 0x1)},
+    {6693927444457773195ULL, 1, MOVE(6, 12, 0x0)},
+    {6696381459632195095ULL, 1, MOVE(36, 29, 0x4)},
+    {6700179748625294699ULL, 1, MOVE(11, 19, 0x0)},
+    {6711279977687720782ULL, 2, MOVE(57, 42, 0x0)},
+    {6713950162534808854ULL, 10, MOVE(1, 18, 0x0)},
+    {6713950162534808854ULL, 1, MOVE(2, 20, 0x0)},
+    {6713950162534808854ULL, 1, MOVE(2, 29, 0x0)},
+    {6716062724244528433ULL, 84, MOVE(51, 43, 0x0)},
+    {6716062724244528433ULL, 51, MOVE(53, 45, 0x0)},
+    {6716062724244528433ULL, 16, MOVE(36, 29, 0x4)},
+    {6719436621832520274ULL, 1, MOVE(28, 36, 0x0)},
+    {6720658469582997910ULL, 33, MOVE(57, 42, 0x0)},
+    {6720658469582997910ULL, 28, MOVE(49, 41, 0x0)},
+    {6720658469582997910ULL, 18, MOVE(61, 25, 0x0)},
+    {6720658469582997910ULL, 14, MOVE(53, 45, 0x0)},
+    {6720658469582997910ULL, 5, MOVE(53, 37, 0x1)},
+    {6720658469582997910ULL, 2, MOVE(62, 52, 0x0)},
+    {6720658469582997910ULL, 1, MOVE(62, 45, 0x0)},
+    {6720658469582997910ULL, 1, MOVE(51, 43, 0x0)},
+    {6721006963003085742ULL, 1, MOVE(61, 25, 0x0)},
+    {6721850083469771014ULL, 1, MOVE(57, 42, 0x0)},
+    {6725932529588938716ULL, 1, MOVE(11, 19, 0x0)},
+    {6726963395321946946ULL, 1, MOVE(11, 27, 0x1)},
+    {6728472591679214005ULL, 2, MOVE(3, 1, 0x2)},
+    {6731332181414880213ULL, 1, MOVE(62, 52, 0x0)},
+    {6734620648696787945ULL, 1, MOVE(14, 22, 0x0)},
+    {6742497247546110933ULL, 79, MOVE(6, 21, 0x0)},
+    {6742497247546110933ULL, 41, MOVE(9, 17, 0x0)},
+    {6742497247546110933ULL, 6, MOVE(5, 33, 0x0)},
+    {6742497247546110933ULL, 1, MOVE(11, 19, 0x0)},
+    {6747057275959521070ULL, 1, MOVE(50, 34, 0x1)},
+    {6747314836421436586ULL, 1, MOVE(2, 9, 0x0)},
+    {6747563481170891826ULL, 7, MOVE(60, 42, 0x0)},
+    {6747563481170891826ULL, 7, MOVE(50, 42, 0x0)},
+    {6747563481170891826ULL, 5, MOVE(58, 51, 0x0)},
+    {6747563481170891826ULL, 4, MOVE(61, 25, 0x0)},
+    {6747563481170891826ULL, 2, MOVE(58, 44, 0x0)},
+    {6749863748952410002ULL, 1, MOVE(58, 49, 0x0)},
+    {6764234055580338846ULL, 4, MOVE(45, 39, 0x0)},
+    {6775666442335049669ULL, 1, MOVE(1, 18, 0x0)},
+    {6784683725277739689ULL, 1, MOVE(3, 1, 0x2)},
+    {6785647171258253619ULL, 1, MOVE(42, 52, 0x0)},
+    {6786676026449314851ULL, 1, MOVE(24, 17, 0x0)},
+    {6791526722481098964ULL, 1, MOVE(51, 43, 0x0)},
+    {6798737564795840729ULL, 1, MOVE(57, 42, 0x0)},
+    {6799229684255038486ULL, 1, MOVE(58, 49, 0x0)},
+    {6801088934904276896ULL, 12, MOVE(15, 23, 0x0)},
+    {6803142323179306268ULL, 6, MOVE(51, 43, 0x0)},
+    {6803142323179306268ULL, 4, MOVE(49, 41, 0x0)},
+    {6803142323179306268ULL, 3, MOVE(53, 45, 0x0)},
+    {6803142323179306268ULL, 2, MOVE(51, 35, 0x1)},
+    {6803142323179306268ULL, 1, MOVE(53, 37, 0x1)},
+    {6803375547829743383ULL, 1, MOVE(62, 45, 0x0)},
+    {6804668624446428026ULL, 10, MOVE(57, 42, 0x0)},
+    {6807431033563129170ULL, 1, MOVE(33, 24, 0x0)},
+    {6807478816869129412ULL, 1, MOVE(57, 51, 0x0)},
+    {6807478816869129412ULL, 1, MOVE(61, 52, 0x0)},
+    {6808731290387654335ULL, 1, MOVE(57, 42, 0x0)},
+    {6812211877174529023ULL, 2, MOVE(52, 36, 0x1)},
+    {6812211877174529023ULL, 1, MOVE(57, 42, 0x0)},
+    {6815310747406727866ULL, 2, MOVE(1, 18, 0x0)},
+    {6815310747406727866ULL, 2, MOVE(6, 21, 0x0)},
+    {6816235727209850492ULL, 9, MOVE(5, 12, 0x0)},
+    {6816235727209850492ULL, 4, MOVE(6, 12, 0x0)},
+    {6816503978913380475ULL, 1, MOVE(36, 29, 0x4)},
+    {6816682352644042484ULL, 9, MOVE(36, 46, 0x0)},
+    {6819904985226900455ULL, 3, MOVE(61, 25, 0x0)},
+    {6825444391811535011ULL, 1, MOVE(37, 29, 0x0)},
+    {6825444391811535011ULL, 1, MOVE(62, 45, 0x0)},
+    {6841954008926061468ULL, 319, MOVE(57, 42, 0x0)},
+    {6841954008926061468ULL, 263, MOVE(52, 36, 0x1)},
+    {6841954008926061468ULL, 90, MOVE(53, 37, 0x1)},
+    {6841954008926061468ULL, 16, MOVE(49, 41, 0x0)},
+    {6841954008926061468ULL, 8, MOVE(52, 44, 0x0)},
+    {6841954008926061468ULL, 7, MOVE(51, 43, 0x0)},
+    {6841954008926061468ULL, 4, MOVE(50, 34, 0x1)},
+    {6841954008926061468ULL, 2, MOVE(53, 45, 0x0)},
+    {6847000796457805277ULL, 2, MOVE(37, 28, 0x4)},
+    {6847221352621119063ULL, 1, MOVE(61, 52, 0x4)},
+    {6852069104017634040ULL, 14, MOVE(15, 23, 0x0)},
+    {6852069104017634040ULL, 4, MOVE(5, 33, 0x0)},
+    {6852069104017634040ULL, 2, MOVE(11, 19, 0x0)},
+    {6852949527352061021ULL, 2, MOVE(58, 49, 0x0)},
+    {6860967692601347612ULL, 1, MOVE(12, 20, 0x0)},
+    {6867668573769693038ULL, 1, MOVE(62, 45, 0x0)},
+    {6871736350725988592ULL, 4, MOVE(1, 18, 0x0)},
+    {6880499474982597015ULL, 22, MOVE(52, 36, 0x1)},
+    {6880499474982597015ULL, 8, MOVE(53, 45, 0x0)},
+    {6880499474982597015ULL, 4, MOVE(48, 40, 0x0)},
+    {6880499474982597015ULL, 3, MOVE(58, 37, 0x0)},
+    {6880499474982597015ULL, 2, MOVE(62, 45, 0x0)},
+    {6880499474982597015ULL, 1, MOVE(52, 44, 0x0)},
+    {6883373533979930721ULL, 1, MOVE(57, 42, 0x0)},
+    {6883373533979930721ULL, 1, MOVE(53, 37, 0x1)},
+    {6884134526358793659ULL, 1, MOVE(5, 33, 0x0)},
+    {6887177516621924522ULL, 5, MOVE(3, 1, 0x2)},
+    {6887177516621924522ULL, 3, MOVE(13, 21, 0x0)},
+    {6887177516621924522ULL, 1, MOVE(12, 28, 0x1)},
+    {6895503189410844436ULL, 2, MOVE(1, 18, 0x0)},
+    {6903244101024865841ULL, 1, MOVE(58, 30, 0x0)},
+    {6904871901544991906ULL, 12, MOVE(57, 42, 0x0)},
+    {6904871901544991906ULL, 1, MOVE(53, 45, 0x0)},
+    {6905038139103109554ULL, 1, MOVE(15, 23, 0x0)},
+    {6905805197361710038ULL, 1, MOVE(28, 36, 0x0)},
+    {6909972647279467544ULL, 9, MOVE(53, 37, 0x1)},
+    {6910027258430625301ULL, 2, MOVE(36, 29, 0x4)},
+    {6913380266718625943ULL, 1, MOVE(57, 42, 0x0)},
+    {6937524313354368537ULL, 2, MOVE(27, 35, 0x0)},
+    {6938430620719785530ULL, 1, MOVE(25, 43, 0x0)},
+    {6944955422330938788ULL, 1, MOVE(3, 1, 0x2)},
+    {6947912443990203167ULL, 1, MOVE(4, 22, 0x0)},
+    {6952211137024786789ULL, 4, MOVE(1, 18, 0x0)},
+    {6956120701638180359ULL, 1, MOVE(59, 57, 0x2)},
+    {6969967407822763305ULL, 1, MOVE(12, 28, 0x1)},
+    {6969967407822763305ULL, 1, MOVE(3, 1, 0x2)},
+    {6975486719385332778ULL, 1, MOVE(61, 52, 0x0)},
+    {6977521205321468913ULL, 1, MOVE(1, 18, 0x0)},
+    {6981070375105943730ULL, 1, MOVE(58, 49, 0x0)},
+    {6984518816488383184ULL, 1, MOVE(52, 43, 0x4)},
+    {6989685716348673765ULL, 1, MOVE(11, 19, 0x0)},
+    {6991759869702880635ULL, 5, MOVE(59, 57, 0x2)},
+    {6991759869702880635ULL, 3, MOVE(52, 36, 0x1)},
+    {6991759869702880635ULL, 1, MOVE(52, 44, 0x0)},
+    {6993440976739071748ULL, 25, MOVE(51, 43, 0x0)},
+    {6993440976739071748ULL, 1, MOVE(53, 37, 0x1)},
+    {6993440976739071748ULL, 1, MOVE(55, 47, 0x0)},
+    {6995287197769167681ULL, 4, MOVE(29, 36, 0x4)},
+    {6995287197769167681ULL, 1, MOVE(11, 19, 0x0)},
+    {7005397799315745482ULL, 2, MOVE(37, 28, 0x4)},
+    {7006831277103232781ULL, 16, MOVE(27, 35, 0x0)},
+    {7010280274666017626ULL, 2, MOVE(18, 28, 0x0)},
+    {7011946785873280527ULL, 6, MOVE(21, 27, 0x4)},
+    {7016513796198807209ULL, 1, MOVE(61, 54, 0x0)},
+    {7016855822895900839ULL, 2, MOVE(51, 43, 0x0)},
+    {7017485798467516809ULL, 1, MOVE(61, 54, 0x0)},
+    {7018414241491437706ULL, 1, MOVE(52, 44, 0x0)},
+    {7018414241491437706ULL, 1, MOVE(51, 43, 0x0)},
+    {7018495528597784692ULL, 1, MOVE(12, 28, 0x1)},
+    {7027421162547560469ULL, 342, MOVE(1, 18, 0x0)},
+    {7027421162547560469ULL, 161, MOVE(6, 21, 0x0)},
+    {7027421162547560469ULL, 12, MOVE(29, 36, 0x4)},
+    {7027421162547560469ULL, 6, MOVE(11, 19, 0x0)},
+    {7030747919821981677ULL, 9, MOVE(1, 11, 0x0)},
+    {7030747919821981677ULL, 4, MOVE(12, 28, 0x1)},
+    {7030747919821981677ULL, 4, MOVE(10, 26, 0x1)},
+    {7030747919821981677ULL, 2, MOVE(1, 18, 0x0)},
+    {7030747919821981677ULL, 2, MOVE(9, 17, 0x0)},
+    {7032094484578472912ULL, 1, MOVE(49, 41, 0x0)},
+    {7032094484578472912ULL, 1, MOVE(28, 45, 0x0)},
+    {7041538582330705298ULL, 5, MOVE(29, 36, 0x4)},
+    {7041538582330705298ULL, 3, MOVE(4, 31, 0x0)},
+    {7041538582330705298ULL, 2, MOVE(5, 33, 0x0)},
+    {7041538582330705298ULL, 1, MOVE(4, 22, 0x0)},
+    {7042899123922595835ULL, 1, MOVE(11, 19, 0x0)},
+    {7068691384629058992ULL, 1, MOVE(62, 45, 0x0)},
+    {7070369653830339942ULL, 3, MOVE(49, 41, 0x0)},
+    {7071296602228129401ULL, 12, MOVE(12, 20, 0x0)},
+    {7071296602228129401ULL, 6, MOVE(6, 21, 0x0)},
+    {7072668093296210685ULL, 16, MOVE(37, 28, 0x4)},
+    {7072668093296210685ULL, 3, MOVE(57, 42, 0x0)},
+    {7072668093296210685ULL, 1, MOVE(55, 47, 0x0)},
+    {7076919194074142085ULL, 1, MOVE(3, 1, 0x2)},
+    {7080483635733032720ULL, 2, MOVE(49, 41, 0x0)},
+    {7080920184175993483ULL, 16, MOVE(59, 57, 0x2)},
+    {7090549624570246630ULL, 122, MOVE(42, 36, 0x4)},
+    {7091729323697852133ULL, 2, MOVE(62, 45, 0x0)},
+    {7096014380736882542ULL, 1, MOVE(2, 9, 0x0)},
+    {7097918641097378592ULL, 2, MOVE(60, 46, 0x0)},
+    {7101221365164624951ULL, 1, MOVE(6, 12, 0x0)},
+    {7103059805183135412ULL, 1, MOVE(62, 45, 0x0)},
+    {7103905845141117878ULL, 3, MOVE(58, 30, 0x0)},
+    {7110736979523648927ULL, 6, MOVE(13, 29, 0x1)},
+    {7110736979523648927ULL, 4, MOVE(9, 17, 0x0)},
+    {7110736979523648927ULL, 1, MOVE(11, 27, 0x1)},
+    {7111849112272597401ULL, 1, MOVE(57, 42, 0x0)},
+    {7117371857361274913ULL, 4, MOVE(43, 36, 0x4)},
+    {7118135978578133592ULL, 1, MOVE(21, 36, 0x4)},
+    {7119681048077051017ULL, 2, MOVE(6, 12, 0x0)},
+    {7122886126778725635ULL, 6, MOVE(1, 18, 0x0)},
+    {7122886126778725635ULL, 1, MOVE(6, 12, 0x0)},
+    {7122886126778725635ULL, 1, MOVE(13, 21, 0x0)},
+    {7127431207949756374ULL, 9, MOVE(3, 1, 0x2)},
+    {7128631585379117144ULL, 1, MOVE(53, 45, 0x0)},
+    {7134377741015126520ULL, 3, MOVE(3, 1, 0x2)},
+    {7134377741015126520ULL, 1, MOVE(12, 28, 0x1)},
+    {7135703894480977587ULL, 1, MOVE(4, 20, 0x0)},
+    {7137085168647858108ULL, 1, MOVE(1, 18, 0x0)},
+    {7137085168647858108ULL, 1, MOVE(28, 36, 0x0)},
+    {7139518719204645528ULL, 1, MOVE(6, 12, 0x0)},
+    {7142653815926515671ULL, 2, MOVE(53, 37, 0x1)},
+    {7149637445512971273ULL, 1, MOVE(36, 27, 0x4)},
+    {7151533816882094737ULL, 2, MOVE(2, 20, 0x0)},
+    {7151533816882094737ULL, 1, MOVE(8, 16, 0x0)},
+    {7152911819642134194ULL, 3, MOVE(49, 41, 0x0)},
+    {7156292506547854630ULL, 3, MOVE(59, 57, 0x2)},
+    {7156292506547854630ULL, 1, MOVE(62, 45, 0x0)},
+    {7158642479030588423ULL, 1, MOVE(57, 42, 0x0)},
+    {7160114648651920381ULL, 1, MOVE(58, 49, 0x0)},
+    {7163204984779398005ULL, 1, MOVE(5, 26, 0x0)},
+    {7166973640389991212ULL, 1, MOVE(36, 29, 0x4)},
+    {7167454292758700144ULL, 33, MOVE(52, 36, 0x1)},
+    {7167454292758700144ULL, 16, MOVE(49, 41, 0x0)},
+    {7167454292758700144ULL, 8, MOVE(53, 37, 0x1)},
+    {7167454292758700144ULL, 5, MOVE(54, 38, 0x1)},
+    {7167454292758700144ULL, 3, MOVE(54, 46, 0x0)},
+    {7167454292758700144ULL, 2, MOVE(51, 43, 0x0)},
+    {7183135874366018526ULL, 1, MOVE(50, 42, 0x0)},
+    {7183206801803576046ULL, 2, MOVE(18, 35, 0x4)},
+    {7197946325623443479ULL, 7, MOVE(28, 37, 0x4)},
+    {7200547854315650862ULL, 13, MOVE(29, 36, 0x4)},
+    {7205173527211137269ULL, 1, MOVE(11, 19, 0x0)},
+    {7228303785366148699ULL, 2, MOVE(25, 32, 0x0)},
+    {7233843201462449933ULL, 4, MOVE(11, 27, 0x1)},
+    {7233843201462449933ULL, 2, MOVE(6, 21, 0x0)},
+    {7244001139114413806ULL, 2, MOVE(15, 31, 0x1)},
+    {7246458098420752933ULL, 1, MOVE(3, 1, 0x2)},
+    {7246458098420752933ULL, 1, MOVE(12, 20, 0x0)},
+    {7256974998989657809ULL, 1, MOVE(42, 36, 0x4)},
+    {7265553120916877664ULL, 2, MOVE(6, 23, 0x0)},
+    {7265553120916877664ULL, 1, MOVE(4, 31, 0x0)},
+    {7273200659581926865ULL, 1, MOVE(1, 18, 0x0)},
+    {7273200659581926865ULL, 1, MOVE(5, 26, 0x0)},
+    {7275906402977549675ULL, 1, MOVE(57, 42, 0x0)},
+    {7276851524171976983ULL, 103, MOVE(6, 21, 0x0)},
+    {7279959152793347955ULL, 1, MOVE(14, 30, 0x1)},
+    {7284477486499441555ULL, 1, MOVE(15, 23, 0x0)},
+    {7285684960846406376ULL, 1, MOVE(11, 28, 0x4)},
+    {7287402706837379573ULL, 1, MOVE(57, 42, 0x0)},
+    {7290140086683723472ULL, 56, MOVE(57, 42, 0x0)},
+    {7290140086683723472ULL, 2, MOVE(52, 44, 0x0)},
+    {7294330812527679871ULL, 1, MOVE(8, 16, 0x0)},
+    {7295887344322134749ULL, 1, MOVE(15, 31, 0x1)},
+    {7299292445461117257ULL, 1, MOVE(37, 28, 0x4)},
+    {7303407011012779371ULL, 1, MOVE(52, 36, 0x1)},
+    {7309004960025897548ULL, 1, MOVE(5, 26, 0x0)},
+    {7312236101448126268ULL, 1, MOVE(49, 33, 0x1)},
+    {7317041130495273375ULL, 1, MOVE(53, 37, 0x1)},
+    {7321467535876368933ULL, 1, MOVE(18, 24, 0x0)},
+    {7322654540511995377ULL, 2, MOVE(37, 28, 0x4)},
+    {7322700205443602857ULL, 34, MOVE(29, 36, 0x4)},
+    {7322700205443602857ULL, 7, MOVE(4, 31, 0x0)},
+    {7328389343944275548ULL, 2, MOVE(5, 33, 0x0)},
+    {7328389343944275548ULL, 2, MOVE(36, 43, 0x4)},
+    {7331386490102310482ULL, 3, MOVE(58, 49, 0x0)},
+    {7347428375358090362ULL, 2, MOVE(3, 1, 0x2)},
+    {7347428375358090362ULL, 1, MOVE(12, 20, 0x0)},
+    {7349185230965718355ULL, 1, MOVE(61, 54, 0x0)},
+    {7352815876482950210ULL, 1, MOVE(52, 36, 0x1)},
+    {7352815876482950210ULL, 1, MOVE(53, 37, 0x1)},
+    {7356759880663256280ULL, 1, MOVE(2, 9, 0x0)},
+    {7358187876155566949ULL, 1, MOVE(57, 42, 0x0)},
+    {7362059165797257699ULL, 7, MOVE(53, 37, 0x1)},
+    {7362059165797257699ULL, 4, MOVE(61, 54, 0x0)},
+    {7367330988849436548ULL, 1, MOVE(1, 18, 0x0)},
+    {7370664071932721704ULL, 1, MOVE(28, 37, 0x4)},
+    {7373591883240179323ULL, 1, MOVE(57, 42, 0x0)},
+    {7380097971405230941ULL, 2, MOVE(57, 42, 0x0)},
+    {7381142007411899921ULL, 2, MOVE(57, 42, 0x0)},
+    {7386420557329443177ULL, 1, MOVE(57, 51, 0x0)},
+    {7401498540477490975ULL, 1, MOVE(58, 49, 0x0)},
+    {7405017722019434049ULL, 1, MOVE(57, 42, 0x0)},
+    {7410897551518309051ULL, 1, MOVE(36, 29, 0x4)},
+    {7413384737443105225ULL, 27, MOVE(11, 19, 0x0)},
+    {7413384737443105225ULL, 18, MOVE(29, 37, 0x0)},
+    {7413384737443105225ULL, 18, MOVE(15, 31, 0x1)},
+    {7413384737443105225ULL, 5, MOVE(29, 36, 0x4)},
+    {7413384737443105225ULL, 4, MOVE(9, 17, 0x0)},
+    {7413384737443105225ULL, 2, MOVE(5, 33, 0x0)},
+    {7413384737443105225ULL, 2, MOVE(18, 35, 0x0)},
+    {7413384737443105225ULL, 1, MOVE(4, 22, 0x0)},
+    {7413384737443105225ULL, 1, MOVE(4, 13, 0x0)},
+    {7413384737443105225ULL, 1, MOVE(8, 16, 0x0)},
+    {7418201644531709246ULL, 4, MOVE(5, 12, 0x0)},
+    {7418201644531709246ULL, 3, MOVE(6, 12, 0x0)},
+    {7418201644531709246ULL, 1, MOVE(6, 21, 0x0)},
+    {7418432720018372881ULL, 10, MOVE(58, 49, 0x0)},
+    {7422060213042019910ULL, 18, MOVE(21, 27, 0x4)},
+    {7435513012675951121ULL, 1, MOVE(61, 34, 0x0)},
+    {7441920338381196569ULL, 3, MOVE(35, 27, 0x0)},
+    {7442589029917807455ULL, 1, MOVE(11, 19, 0x0)},
+    {7444051022280125296ULL, 4, MOVE(61, 25, 0x0)},
+    {7450564160707493255ULL, 1, MOVE(50, 34, 0x1)},
+    {7450564160707493255ULL, 1, MOVE(61, 43, 0x0)},
+    {7450564160707493255ULL, 1, MOVE(58, 51, 0x0)},
+    {7452598295915885065ULL, 1, MOVE(62, 45, 0x0)},
+    {7454100836064974569ULL, 5, MOVE(55, 47, 0x0)},
+    {7454719158710978582ULL, 77, MOVE(12, 20, 0x0)},
+    {7454719158710978582ULL, 15, MOVE(12, 28, 0x1)},
+    {7454719158710978582ULL, 1, MOVE(14, 30, 0x1)},
+    {7484879384508194744ULL, 67, MOVE(2, 9, 0x0)},
+    {7484879384508194744ULL, 31, MOVE(1, 18, 0x0)},
+    {7487534372056117100ULL, 2, MOVE(60, 42, 0x4)},
+    {7491013324051048746ULL, 1, MOVE(61, 25, 0x0)},
+    {7493200292560095376ULL, 10, MOVE(27, 36, 0x4)},
+    {7498740239830171489ULL, 16, MOVE(42, 36, 0x4)},
+    {7500539704247232345ULL, 2, MOVE(13, 29, 0x1)},
+    {7504456281895907817ULL, 12, MOVE(60, 53, 0x0)},
+    {7504456281895907817ULL, 4, MOVE(54, 38, 0x1)},
+    {7504456281895907817ULL, 2, MOVE(52, 44, 0x0)},
+    {7504456281895907817ULL, 1, MOVE(62, 45, 0x0)},
+    {7510550525157357920ULL, 1, MOVE(2, 38, 0x0)},
+    {7513718561077675328ULL, 14, MOVE(1, 18, 0x0)},
+    {7513718561077675328ULL, 11, MOVE(11, 27, 0x1)},
+    {7513718561077675328ULL, 2, MOVE(5, 26, 0x0)},
+    {7513718561077675328ULL, 2, MOVE(9, 17, 0x0)},
+    {7513718561077675328ULL, 2, MOVE(13, 29, 0x1)},
+    {7523245497666978709ULL, 1, MOVE(2, 9, 0x0)},
+    {7526719593406862156ULL, 1, MOVE(54, 38, 0x1)},
+    {7528514683445416321ULL, 2, MOVE(59, 57, 0x2)},
+    {7531827262477569249ULL, 5, MOVE(1, 18, 0x0)},
+    {7531827262477569249ULL, 2, MOVE(1, 11, 0x0)},
+    {7531827262477569249ULL, 1, MOVE(10, 26, 0x1)},
+    {7537262777870219194ULL, 5, MOVE(5, 26, 0x0)},
+    {7537262777870219194ULL, 5, MOVE(6, 21, 0x0)},
+    {7537262777870219194ULL, 2, MOVE(5, 33, 0x0)},
+    {7537262777870219194ULL, 1, MOVE(1, 18, 0x0)},
+    {7538857440457673476ULL, 2, MOVE(52, 44, 0x0)},
+    {7538857440457673476ULL, 1, MOVE(57, 51, 0x0)},
+    {7548622393127657459ULL, 20, MOVE(3, 1, 0x2)},
+    {7548622393127657459ULL, 6, MOVE(38, 45, 0x4)},
+    {7548622393127657459ULL, 1, MOVE(14, 22, 0x0)},
+    {7548845014752053825ULL, 1, MOVE(62, 52, 0x0)},
+    {7556582420055430143ULL, 2, MOVE(51, 43, 0x0)},
+    {7559575970307981103ULL, 1, MOVE(58, 44, 0x0)},
+    {7563903005326255250ULL, 2, MOVE(51, 35, 0x1)},
+    {7563903005326255250ULL, 1, MOVE(62, 52, 0x0)},
+    {7563903005326255250ULL, 1, MOVE(61, 34, 0x0)},
+    {7564604610615240487ULL, 1, MOVE(58, 49, 0x0)},
+    {7568413501429773022ULL, 1, MOVE(4, 12, 0x4)},
+    {7579535807716578346ULL, 17, MOVE(59, 57, 0x2)},
+    {7579535807716578346ULL, 6, MOVE(52, 36, 0x1)},
+    {7579535807716578346ULL, 3, MOVE(53, 37, 0x1)},
+    {7579535807716578346ULL, 1, MOVE(52, 44, 0x0)},
+    {7582564535987289885ULL, 1, MOVE(5, 14, 0x0)},
+    {7585785385337761577ULL, 6, MOVE(11, 27, 0x1)},
+    {7585785385337761577ULL, 3, MOVE(1, 18, 0x0)},
+    {7585785385337761577ULL, 3, MOVE(6, 21, 0x0)},
+    {7585785385337761577ULL, 1, MOVE(9, 17, 0x0)},
+    {7587566075325499722ULL, 2, MOVE(51, 35, 0x1)},
+    {7587566075325499722ULL, 1, MOVE(53, 37, 0x1)},
+    {7587566075325499722ULL, 1, MOVE(49, 41, 0x0)},
+    {7589959192365085847ULL, 1, MOVE(58, 51, 0x0)},
+    {7590479122305006323ULL, 1, MOVE(57, 42, 0x0)},
+    {7591084111927721275ULL, 1, MOVE(52, 44, 0x0)},
+    {7598522870607799602ULL, 1, MOVE(52, 36, 0x1)},
+    {7598862482576260778ULL, 1, MOVE(62, 52, 0x0)},
+    {7599175378575683309ULL, 1, MOVE(5, 26, 0x0)},
+    {7599832281029390256ULL, 2, MOVE(37, 30, 0x4)},
+    {7600728264160325511ULL, 1, MOVE(4, 12, 0x0)},
+    {7600728264160325511ULL, 1, MOVE(15, 31, 0x1)},
+    {7610836377752460079ULL, 4, MOVE(1, 18, 0x0)},
+    {7610836377752460079ULL, 2, MOVE(5, 33, 0x0)},
+    {7610836377752460079ULL, 1, MOVE(2, 11, 0x0)},
+    {7612928211204472827ULL, 1, MOVE(52, 44, 0x0)},
+    {7616954055325226536ULL, 1, MOVE(49, 41, 0x0)},
+    {7620948258158937510ULL, 6, MOVE(49, 41, 0x0)},
+    {7620948258158937510ULL, 3, MOVE(51, 43, 0x0)},
+    {7620948258158937510ULL, 1, MOVE(52, 36, 0x1)},
+    {7622467227487262731ULL, 2, MOVE(60, 36, 0x4)},
+    {7624903789096250637ULL, 1, MOVE(8, 16, 0x0)},
+    {7628436369218723477ULL, 1, MOVE(2, 9, 0x0)},
+    {7628618784391328219ULL, 9, MOVE(18, 28, 0x4)},
+    {7632094953397738153ULL, 5, MOVE(52, 44, 0x0)},
+    {7635435082703527331ULL, 1, MOVE(21, 28, 0x4)},
+    {7637180607189499230ULL, 24, MOVE(58, 49, 0x0)},
+    {7637180607189499230ULL, 1, MOVE(53, 37, 0x1)},
+    {7637180607189499230ULL, 1, MOVE(52, 44, 0x0)},
+    {7645748197340408214ULL, 12, MOVE(52, 36, 0x1)},
+    {7645748197340408214ULL, 10, MOVE(53, 37, 0x1)},
+    {7645748197340408214ULL, 1, MOVE(59, 57, 0x2)},
+    {7647598568667644387ULL, 1, MOVE(60, 51, 0x0)},
+    {7648650664919079203ULL, 1, MOVE(42, 36, 0x4)},
+    {7649176520866260213ULL, 1, MOVE(1, 18, 0x0)},
+    {7650275624245944858ULL, 1, MOVE(52, 45, 0x4)},
+    {7651834779555413340ULL, 2, MOVE(49, 41, 0x0)},
+    {7652396286484114399ULL, 1, MOVE(53, 37, 0x1)},
+    {7656088573914937899ULL, 1, MOVE(51, 35, 0x1)},
+    {7657735767223613411ULL, 2, MOVE(3, 1, 0x2)},
+    {7657735767223613411ULL, 2, MOVE(6, 21, 0x0)},
+    {7658027954769996250ULL, 1, MOVE(57, 42, 0x0)},
+    {7658027954769996250ULL, 1, MOVE(52, 36, 0x1)},
+    {7660987663510493929ULL, 1, MOVE(59, 57, 0x2)},
+    {7665478632396520177ULL, 2, MOVE(10, 26, 0x1)},
+    {7671511946693089235ULL, 1, MOVE(58, 30, 0x0)},
+    {7671511946693089235ULL, 1, MOVE(35, 28, 0x4)},
+    {7676669516831202912ULL, 9, MOVE(37, 46, 0x0)},
+    {7678280131753579654ULL, 6, MOVE(57, 42, 0x0)},
+    {7678280131753579654ULL, 2, MOVE(51, 43, 0x0)},
+    {7678280131753579654ULL, 1, MOVE(62, 45, 0x0)},
+    {7678280131753579654ULL, 1, MOVE(49, 41, 0x0)},
+    {7684268610892084097ULL, 5, MOVE(2, 9, 0x0)},
+    {7686159521179815058ULL, 1, MOVE(58, 30, 0x0)},
+    {7686159521179815058ULL, 1, MOVE(54, 38, 0x1)},
+    {7689128544585739604ULL, 1, MOVE(43, 36, 0x4)},
+    {7690522187008051288ULL, 1, MOVE(34, 20, 0x4)},
+    {7695310049649440923ULL, 3, MOVE(58, 49, 0x0)},
+    {7698083757109628667ULL, 1, MOVE(13, 29, 0x1)},
+    {7698083757109628667ULL, 1, MOVE(2, 11, 0x0)},
+    {7701453733410039243ULL, 8, MOVE(5, 26, 0x0)},
+    {7701453733410039243ULL, 3, MOVE(1, 18, 0x0)},
+    {7701977840509017943ULL, 2, MOVE(2, 9, 0x0)},
+    {7701977840509017943ULL, 1, MOVE(12, 28, 0x1)},
+    {7703475811722260879ULL, 1, MOVE(48, 40, 0x0)},
+    {7704161653307979390ULL, 6, MOVE(11, 19, 0x0)},
+    {7704161653307979390ULL, 2, MOVE(13, 21, 0x0)},
+    {7709745360062743187ULL, 2, MOVE(4, 13, 0x0)},
+    {7709745360062743187ULL, 1, MOVE(14, 22, 0x0)},
+    {7709745360062743187ULL, 1, MOVE(12, 28, 0x1)},
+    {7714278107617494199ULL, 1, MOVE(52, 36, 0x1)},
+    {7715834833786149323ULL, 6, MOVE(52, 44, 0x0)},
+    {7715834833786149323ULL, 1, MOVE(52, 36, 0x1)},
+    {7718477479613596483ULL, 1, MOVE(11, 19, 0x0)},
+    {7727470717747927906ULL, 9, MOVE(1, 18, 0x0)},
+    {7727470717747927906ULL, 5, MOVE(2, 20, 0x0)},
+    {7727470717747927906ULL, 2, MOVE(15, 23, 0x0)},
+    {7727675296158958932ULL, 2, MOVE(28, 36, 0x0)},
+    {7735114798968513524ULL, 3, MOVE(52, 36, 0x1)},
+    {7735770162046157210ULL, 2, MOVE(6, 21, 0x0)},
+    {7735770162046157210ULL, 1, MOVE(1, 18, 0x0)},
+    {7736557500735042026ULL, 2, MOVE(4, 11, 0x0)},
+    {7736557500735042026ULL, 1, MOVE(6, 21, 0x0)},
+    {7739810275036596223ULL, 17, MOVE(61, 54, 0x0)},
+    {7739810275036596223ULL, 4, MOVE(61, 47, 0x0)},
+    {7739810275036596223ULL, 1, MOVE(53, 37, 0x1)},
+    {7740297180846066251ULL, 1, MOVE(57, 42, 0x0)},
+    {7741123578247310824ULL, 1, MOVE(26, 12, 0x0)},
+    {7742437498093908567ULL, 2, MOVE(28, 21, 0x4)},
+    {7743772893405030460ULL, 5, MOVE(2, 9, 0x0)},
+    {7743772893405030460ULL, 2, MOVE(6, 21, 0x0)},
+    {7744981023904060931ULL, 1, MOVE(28, 36, 0x0)},
+    {7745143358504352076ULL, 4, MOVE(38, 30, 0x0)},
+    {7747084087736085174ULL, 1, MOVE(52, 44, 0x0)},
+    {7748692583649315031ULL, 4, MOVE(4, 12, 0x0)},
+    {7748692583649315031ULL, 1, MOVE(1, 18, 0x0)},
+    {7748692583649315031ULL, 1, MOVE(10, 18, 0x0)},
+    {7750475974625958028ULL, 2, MOVE(29, 36, 0x4)},
+    {7750475974625958028ULL, 1, MOVE(6, 21, 0x0)},
+    {7750542552379145765ULL, 10, MOVE(58, 49, 0x0)},
+    {7750887935427353486ULL, 2, MOVE(62, 52, 0x0)},
+    {7750887935427353486ULL, 2, MOVE(54, 38, 0x1)},
+    {7752577716901560103ULL, 7, MOVE(36, 27, 0x4)},
+    {7752577716901560103ULL, 1, MOVE(58, 30, 0x0)},
+    {7753035919048400824ULL, 2, MOVE(25, 32, 0x0)},
+    {7753035919048400824ULL, 1, MOVE(25, 18, 0x4)},
+    {7755433793032905145ULL, 1, MOVE(58, 49, 0x0)},
+    {7759131694337121259ULL, 4, MOVE(11, 19, 0x0)},
+    {7765140717726829122ULL, 1, MOVE(57, 42, 0x0)},
+    {7765140717726829122ULL, 1, MOVE(53, 37, 0x1)},
+    {7766042888112013620ULL, 1, MOVE(54, 38, 0x1)},
+    {7766198405019522011ULL, 1, MOVE(11, 19, 0x0)},
+    {7767519942067016878ULL, 1, MOVE(58, 30, 0x0)},
+    {7768966351266307150ULL, 1, MOVE(8, 24, 0x1)},
+    {7772382204986234923ULL, 1, MOVE(2, 9, 0x0)},
+    {7774923372170535490ULL, 9, MOVE(58, 51, 0x0)},
+    {7774923372170535490ULL, 4, MOVE(52, 44, 0x0)},
+    {7774923372170535490ULL, 1, MOVE(49, 41, 0x0)},
+    {7777793937139534802ULL, 12, MOVE(12, 22, 0x0)},
+    {7777793937139534802ULL, 1, MOVE(9, 25, 0x1)},
+    {7780755938303252785ULL, 1, MOVE(6, 21, 0x0)},
+    {7781528071341571660ULL, 5, MOVE(51, 35, 0x1)},
+    {7781528071341571660ULL, 1, MOVE(49, 41, 0x0)},
+    {7785863111250225368ULL, 1, MOVE(58, 49, 0x0)},
+    {7791169941863327658ULL, 2, MOVE(36, 29, 0x4)},
+    {7791169941863327658ULL, 1, MOVE(61, 34, 0x0)},
+    {7796621468328471473ULL, 11, MOVE(11, 19, 0x0)},
+    {7796621468328471473ULL, 5, MOVE(9, 17, 0x0)},
+    {7796665384395374801ULL, 1, MOVE(38, 45, 0x4)},
+    {7796732727079369382ULL, 2, MOVE(51, 43, 0x0)},
+    {7796805321234337857ULL, 4, MOVE(57, 42, 0x0)},
+    {7796805321234337857ULL, 1, MOVE(52, 42, 0x0)},
+    {7804374844919107187ULL, 1, MOVE(21, 28, 0x4)},
+    {7805020125918525260ULL, 3, MOVE(59, 57, 0x2)},
+    {7817461587773872977ULL, 10, MOVE(37, 28, 0x4)},
+    {7817461587773872977ULL, 2, MOVE(57, 42, 0x0)},
+    {7817461587773872977ULL, 1, MOVE(62, 45, 0x0)},
+    {7818688175709038321ULL, 1, MOVE(62, 47, 0x0)},
+    {7819005799692817203ULL, 1, MOVE(28, 24, 0x0)},
+    {7819307497225029022ULL, 1, MOVE(62, 52, 0x0)},
+    {7820819144862538687ULL, 3, MOVE(53, 37, 0x1)},
+    {7820819144862538687ULL, 2, MOVE(48, 40, 0x0)},
+    {7820819144862538687ULL, 1, MOVE(52, 36, 0x1)},
+    {7821964313780039558ULL, 1, MOVE(11, 28, 0x4)},
+    {7842756084519057494ULL, 3, MOVE(52, 36, 0x1)},
+    {7855320497807264259ULL, 1, MOVE(2, 9, 0x0)},
+    {7862536910256076766ULL, 1, MOVE(12, 29, 0x4)},
+    {7867572196664512934ULL, 1, MOVE(43, 36, 0x4)},
+    {7867572196664512934ULL, 1, MOVE(42, 36, 0x4)},
+    {7870329594086584438ULL, 2, MOVE(59, 57, 0x2)},
+    {7871689313487738494ULL, 1, MOVE(49, 41, 0x0)},
+    {7877197296410592064ULL, 1, MOVE(51, 43, 0x0)},
+    {7881001148496703780ULL, 32, MOVE(45, 36, 0x4)},
+    {7885047822713934717ULL, 1, MOVE(62, 45, 0x0)},
+    {7890823158783700341ULL, 3, MOVE(58, 44, 0x0)},
+    {7890823158783700341ULL, 2, MOVE(50, 34, 0x1)},
+    {7890823158783700341ULL, 1, MOVE(57, 42, 0x0)},
+    {7890919460067679784ULL, 1, MOVE(1, 18, 0x0)},
+    {7890919460067679784ULL, 1, MOVE(6, 12, 0x0)},
+    {7891106867928632660ULL, 12, MOVE(51, 43, 0x0)},
+    {7891106867928632660ULL, 3, MOVE(62, 45, 0x0)},
+    {7891604518545529557ULL, 1, MOVE(53, 37, 0x1)},
+    {7893644188203796787ULL, 1, MOVE(59, 57, 0x2)},
+    {7894746036297525360ULL, 19, MOVE(6, 21, 0x0)},
+    {7894771850653342765ULL, 2, MOVE(27, 36, 0x4)},
+    {7899417245079091287ULL, 1, MOVE(15, 31, 0x1)},
+    {7907110843853411900ULL, 1, MOVE(3, 1, 0x2)},
+    {7910978060492596682ULL, 1, MOVE(52, 36, 0x1)},
+    {7911383522077931103ULL, 41, MOVE(52, 36, 0x1)},
+    {7911383522077931103ULL, 23, MOVE(58, 49, 0x0)},
+    {7911383522077931103ULL, 1, MOVE(53, 37, 0x1)},
+    {7922609371628585423ULL, 1, MOVE(6, 21, 0x0)},
+    {7924001067853808315ULL, 1, MOVE(62, 47, 0x0)},
+    {7926224147417557259ULL, 3, MOVE(62, 45, 0x0)},
+    {7926224147417557259ULL, 1, MOVE(57, 42, 0x0)},
+    {7927473974648057776ULL, 11, MOVE(13, 29, 0x1)},
+    {7927473974648057776ULL, 4, MOVE(11, 27, 0x1)},
+    {7927473974648057776ULL, 4, MOVE(1, 18, 0x0)},
+    {7927473974648057776ULL, 3, MOVE(9, 17, 0x0)},
+    {7930296744177730525ULL, 1, MOVE(58, 51, 0x0)},
+    {7930629300105257910ULL, 1, MOVE(5, 33, 0x0)},
+    {7930727457875207806ULL, 1, MOVE(14, 22, 0x0)},
+    {7936205956609999183ULL, 1, MOVE(60, 52, 0x4)},
+    {7941569667949779403ULL, 7, MOVE(57, 42, 0x0)},
+    {7941569667949779403ULL, 2, MOVE(62, 45, 0x0)},
+    {7947580586152224421ULL, 2, MOVE(61, 25, 0x0)},
+    {7949953625194153246ULL, 153, MOVE(11, 27, 0x1)},
+    {7949953625194153246ULL, 10, MOVE(1, 18, 0x0)},
+    {7949953625194153246ULL, 7, MOVE(9, 17, 0x0)},
+    {7953550802410598424ULL, 1, MOVE(62, 45, 0x0)},
+    {7953550802410598424ULL, 1, MOVE(61, 34, 0x0)},
+    {7955214867060916029ULL, 1, MOVE(58, 49, 0x0)},
+    {7955331034860223947ULL, 7, MOVE(42, 36, 0x4)},
+    {7958217533394501356ULL, 1, MOVE(49, 41, 0x0)},
+    {7959766696922578202ULL, 9, MOVE(59, 57, 0x2)},
+    {7959766696922578202ULL, 5, MOVE(54, 46, 0x0)},
+    {7959766696922578202ULL, 2, MOVE(55, 39, 0x1)},
+    {7959766696922578202ULL, 2, MOVE(52, 36, 0x1)},
+    {7961381793481255136ULL, 20, MOVE(12, 20, 0x0)},
+    {7961381793481255136ULL, 1, MOVE(3, 1, 0x2)},
+    {7961381793481255136ULL, 1, MOVE(8, 16, 0x0)},
+    {7961805876300339029ULL, 2, MOVE(27, 35, 0x0)},
+    {7962322369552991508ULL, 1, MOVE(37, 28, 0x4)},
+    {7970692074950612299ULL, 26, MOVE(11, 27, 0x1)},
+    {7970692074950612299ULL, 22, MOVE(1, 18, 0x0)},
+    {7970692074950612299ULL, 9, MOVE(11, 19, 0x0)},
+    {7972564308217985773ULL, 1, MOVE(15, 23, 0x0)},
+    {7973501314323608374ULL, 20, MOVE(58, 51, 0x0)},
+    {7973501314323608374ULL, 11, MOVE(36, 29, 0x4)},
+    {7973501314323608374ULL, 6, MOVE(36, 28, 0x0)},
+    {7976598564363224668ULL, 2, MOVE(36, 37, 0x4)},
+    {7981819194257841306ULL, 2, MOVE(37, 28, 0x4)},
+    {7982469204463321955ULL, 1, MOVE(50, 34, 0x1)},
+    {7982469204463321955ULL, 1, MOVE(52, 36, 0x1)},
+    {7985150735303957812ULL, 1, MOVE(60, 42, 0x0)},
+    {8001711469908866168ULL, 18, MOVE(9, 17, 0x0)},
+    {8001711469908866168ULL, 5, MOVE(1, 18, 0x0)},
+    {8001711469908866168ULL, 4, MOVE(13, 29, 0x1)},
+    {8001711469908866168ULL, 1, MOVE(5, 33, 0x0)},
+    {8001711469908866168ULL, 1, MOVE(11, 27, 0x1)},
+    {8001711469908866168ULL, 1, MOVE(6, 21, 0x0)},
+    {8003316783715139215ULL, 6, MOVE(61, 25, 0x0)},
+    {8003316783715139215ULL, 6, MOVE(57, 42, 0x0)},
+    {8004815408765676276ULL, 10, MOVE(58, 49, 0x0)},
+    {8005453946857088696ULL, 5, MOVE(1, 18, 0x0)},
+    {8005453946857088696ULL, 2, MOVE(11, 19, 0x0)},
+    {8005453946857088696ULL, 1, MOVE(14, 30, 0x1)},
+    {8009564582597223271ULL, 6, MOVE(2, 9, 0x0)},
+    {8014195774580633398ULL, 6, MOVE(2, 29, 0x4)},
+    {8019627590161824165ULL, 1, MOVE(13, 29, 0x1)},
+    {8019627590161824165ULL, 1, MOVE(13, 21, 0x0)},
+    {8021248351717500261ULL, 7, MOVE(36, 46, 0x0)},
+    {8021248351717500261ULL, 2, MOVE(51, 43, 0x0)},
+    {8021418103065545088ULL, 1, MOVE(55, 47, 0x0)},
+    {8022430359087953291ULL, 6, MOVE(52, 36, 0x1)},
+    {8022430359087953291ULL, 4, MOVE(57, 42, 0x0)},
+    {8031042074188651395ULL, 4, MOVE(58, 49, 0x0)},
+    {8034997011672614270ULL, 1, MOVE(57, 42, 0x0)},
+    {8050618659330609886ULL, 1, MOVE(2, 9, 0x0)},
+    {8051334738018667157ULL, 1, MOVE(52, 36, 0x1)},
+    {8053593255547984991ULL, 1, MOVE(49, 41, 0x0)},
+    {8062892291652416076ULL, 12, MOVE(36, 21, 0x4)},
+    {8062892291652416076ULL, 5, MOVE(51, 43, 0x0)},
+    {8062892291652416076ULL, 1, MOVE(62, 45, 0x0)},
+    {8062892291652416076ULL, 1, MOVE(49, 41, 0x0)},
+    {8063630637541234414ULL, 1, MOVE(36, 39, 0x0)},
+    {8069010056364992398ULL, 2, MOVE(19, 28, 0x4)},
+    {8073873576878319402ULL, 2, MOVE(62, 45, 0x0)},
+    {8076872985092206363ULL, 1, MOVE(53, 37, 0x1)},
+    {8080114785125192571ULL, 2, MOVE(5, 14, 0x0)},
+    {8082906110243659097ULL, 1, MOVE(13, 29, 0x1)},
+    {8086473169122877085ULL, 1, MOVE(2, 9, 0x0)},
+    {8087794956009074420ULL, 9, MOVE(42, 36, 0x0)},
+    {8089330645101166612ULL, 2, MOVE(53, 37, 0x1)},
+    {8091539832430793125ULL, 1, MOVE(51, 43, 0x0)},
+    {8093245832175190196ULL, 1, MOVE(1, 18, 0x0)},
+    {8095319833244324667ULL, 2, MOVE(12, 28, 0x1)},
+    {8095543352181798444ULL, 1, MOVE(57, 42, 0x0)},
+    {8097644592981452327ULL, 1, MOVE(49, 41, 0x0)},
+    {8100970276233269951ULL, 6, MOVE(58, 30, 0x0)},
+    {8100970276233269951ULL, 4, MOVE(48, 40, 0x0)},
+    {8100970276233269951ULL, 4, MOVE(58, 51, 0x0)},
+    {8100970276233269951ULL, 3, MOVE(36, 29, 0x4)},
+    {8100970276233269951ULL, 2, MOVE(62, 52, 0x0)},
+    {8100970276233269951ULL, 1, MOVE(55, 47, 0x0)},
+    {8100970276233269951ULL, 1, MOVE(53, 45, 0x0)},
+    {8102900898980577380ULL, 2, MOVE(58, 49, 0x0)},
+    {8102900898980577380ULL, 1, MOVE(53, 37, 0x1)},
+    {8102900898980577380ULL, 1, MOVE(52, 36, 0x1)},
+    {8104688008126202800ULL, 1, MOVE(9, 17, 0x0)},
+    {8108676267851086440ULL, 1, MOVE(48, 40, 0x0)},
+    {8112777327794963562ULL, 3, MOVE(15, 31, 0x1)},
+    {8115729475355106385ULL, 8, MOVE(59, 57, 0x2)},
+    {8120541413462616762ULL, 47, MOVE(1, 18, 0x0)},
+    {8120541413462616762ULL, 9, MOVE(9, 17, 0x0)},
+    {8120541413462616762ULL, 2, MOVE(11, 19, 0x0)},
+    {8122265391643684228ULL, 1, MOVE(58, 51, 0x0)},
+    {8122679314503360853ULL, 7, MOVE(30, 51, 0x0)},
+    {8123386600714406937ULL, 2, MOVE(53, 45, 0x0)},
+    {8123386600714406937ULL, 1, MOVE(36, 29, 0x4)},
+    {8125916443761679523ULL, 2, MOVE(58, 49, 0x0)},
+    {8133951940637651611ULL, 1, MOVE(53, 37, 0x1)},
+    {8138108260352889398ULL, 1, MOVE(49, 41, 0x0)},
+    {8145848156428982443ULL, 1, MOVE(18, 28, 0x4)},
+    {8148536751621930796ULL, 1, MOVE(36, 21, 0x4)},
+    {8148536751621930796ULL, 1, MOVE(51, 43, 0x0)},
+    {8154509512163913275ULL, 2, MOVE(61, 34, 0x0)},
+    {8154509512163913275ULL, 1, MOVE(51, 43, 0x0)},
+    {8161931984283260320ULL, 1, MOVE(53, 45, 0x0)},
+    {8162407103885109136ULL, 1, MOVE(30, 12, 0x4)},
+    {8162407103885109136ULL, 1, MOVE(30, 51, 0x0)},
+    {8163029570126985157ULL, 64, MOVE(6, 21, 0x0)},
+    {8163029570126985157ULL, 12, MOVE(9, 17, 0x0)},
+    {8163029570126985157ULL, 2, MOVE(14, 22, 0x0)},
+    {8163029570126985157ULL, 1, MOVE(11, 19, 0x0)},
+    {8163029570126985157ULL, 1, MOVE(12, 28, 0x1)},
+    {8164859315934580725ULL, 2, MOVE(52, 36, 0x1)},
+    {8164859315934580725ULL, 2, MOVE(60, 46, 0x0)},
+    {8165671717154344545ULL, 1, MOVE(11, 27, 0x1)},
+    {8166857017631394197ULL, 22, MOVE(45, 37, 0x0)},
+    {8166857017631394197ULL, 18, MOVE(57, 51, 0x0)},
+    {8166857017631394197ULL, 12, MOVE(62, 52, 0x0)},
+    {8166857017631394197ULL, 2, MOVE(50, 42, 0x0)},
+    {8166857017631394197ULL, 1, MOVE(34, 41, 0x0)},
+    {8166857017631394197ULL, 1, MOVE(48, 40, 0x0)},
+    {8173285831059313999ULL, 1, MOVE(57, 42, 0x0)},
+    {8181684569528728319ULL, 1, MOVE(1, 18, 0x0)},
+    {8184068324624961008ULL, 1, MOVE(6, 21, 0x0)},
+    {8184068324624961008ULL, 1, MOVE(12, 28, 0x1)},
+    {8184068324624961008ULL, 1, MOVE(4, 11, 0x0)},
+    {8184610935273486613ULL, 1, MOVE(1, 11, 0x0)},
+    {8188711911683670460ULL, 141, MOVE(58, 51, 0x0)},
+    {8188711911683670460ULL, 111, MOVE(58, 30, 0x0)},
+    {8188711911683670460ULL, 53, MOVE(53, 45, 0x0)},
+    {8188711911683670460ULL, 45, MOVE(36, 29, 0x4)},
+    {8188711911683670460ULL, 32, MOVE(53, 37, 0x1)},
+    {8188711911683670460ULL, 23, MOVE(62, 52, 0x0)},
+    {8188711911683670460ULL, 5, MOVE(55, 47, 0x0)},
+    {8194172460790505044ULL, 1, MOVE(58, 49, 0x0)},
+    {8199754194772814436ULL, 3, MOVE(61, 52, 0x0)},
+    {8199754194772814436ULL, 1, MOVE(57, 42, 0x0)},
+    {8204945710367479872ULL, 3, MOVE(3, 1, 0x2)},
+    {8210569864270191849ULL, 137, MOVE(12, 28, 0x1)},
+    {8210569864270191849ULL, 55, MOVE(2, 3, 0x0)},
+    {8211746768166564920ULL, 1, MOVE(57, 42, 0x0)},
+    {8213525703186570112ULL, 2, MOVE(61, 54, 0x0)},
+    {8215473359783737097ULL, 1, MOVE(30, 51, 0x0)},
+    {8216275757307206148ULL, 3, MOVE(1, 18, 0x0)},
+    {8216275757307206148ULL, 2, MOVE(12, 28, 0x1)},
+    {8219265671452526402ULL, 14, MOVE(62, 52, 0x0)},
+    {8219435077874981154ULL, 3, MOVE(5, 14, 0x0)},
+    {8224049441686867358ULL, 2, MOVE(57, 42, 0x0)},
+    {8226991939579228103ULL, 1, MOVE(62, 52, 0x0)},
+    {8232102181674860673ULL, 2, MOVE(53, 45, 0x0)},
+    {8232102181674860673ULL, 1, MOVE(52, 44, 0x0)},
+    {8236939912664644615ULL, 2, MOVE(2, 9, 0x0)},
+    {8239232551187103096ULL, 10, MOVE(58, 30, 0x0)},
+    {8239232551187103096ULL, 4, MOVE(62, 45, 0x0)},
+    {8243767295012507784ULL, 1, MOVE(1, 18, 0x0)},
+    {8245257606580703834ULL, 1, MOVE(51, 35, 0x1)},
+    {8246521964232484986ULL, 1, MOVE(54, 38, 0x1)},
+    {8248464237858819965ULL, 4, MOVE(62, 52, 0x0)},
+    {8248464237858819965ULL, 1, MOVE(54, 38, 0x1)},
+    {8261788701150145605ULL, 2, MOVE(57, 42, 0x0)},
+    {8261788701150145605ULL, 2, MOVE(58, 49, 0x0)},
+    {8268137948316028728ULL, 1, MOVE(60, 46, 0x0)},
+    {8269788037623665106ULL, 2, MOVE(57, 42, 0x0)},
+    {8273296047454106617ULL, 1, MOVE(48, 40, 0x0)},
+    {8281950019485970242ULL, 46, MOVE(51, 43, 0x0)},
+    {8281950019485970242ULL, 4, MOVE(55, 47, 0x0)},
+    {8285786309667566735ULL, 1644, MOVE(1, 18, 0x0)},
+    {8285786309667566735ULL, 26, MOVE(2, 29, 0x0)},
+    {8285786309667566735ULL, 9, MOVE(6, 21, 0x0)},
+    {8285786309667566735ULL, 7, MOVE(10, 26, 0x1)},
+    {8285786309667566735ULL, 1, MOVE(12, 28, 0x1)},
+    {8286859690536935807ULL, 5, MOVE(59, 57, 0x2)},
+    {8294246709451802626ULL, 1, MOVE(2, 11, 0x0)},
+    {8294850713922307019ULL, 1, MOVE(27, 35, 0x0)},
+    {8299687139110187801ULL, 1, MOVE(42, 36, 0x4)},
+    {8304293919102102295ULL, 1, MOVE(55, 47, 0x0)},
+    {8308757273903005807ULL, 1, MOVE(54, 38, 0x1)},
+    {8311415289912472750ULL, 1, MOVE(3, 1, 0x2)},
+    {8311415289912472750ULL, 1, MOVE(6, 21, 0x0)},
+    {8314746806995411380ULL, 3, MOVE(12, 20, 0x0)},
+    {8314746806995411380ULL, 1, MOVE(13, 21, 0x0)},
+    {8315875334563304725ULL, 1, MOVE(57, 42, 0x0)},
+    {8316916072923891653ULL, 5, MOVE(6, 21, 0x0)},
+    {8318498027237316353ULL, 1, MOVE(53, 45, 0x0)},
+    {8319998840099199312ULL, 2, MOVE(52, 36, 0x1)},
+    {8320317449139256874ULL, 4, MOVE(12, 20, 0x0)},
+    {8320317449139256874ULL, 2, MOVE(13, 29, 0x1)},
+    {8320317449139256874ULL, 2, MOVE(8, 16, 0x0)},
+    {8320317449139256874ULL, 1, MOVE(12, 28, 0x1)},
+    {8322776912128133000ULL, 4, MOVE(15, 31, 0x1)},
+    {8327993303234700596ULL, 4, MOVE(2, 9, 0x0)},
+    {8327993303234700596ULL, 1, MOVE(13, 29, 0x1)},
+    {8328677879379439582ULL, 1, MOVE(57, 42, 0x0)},
+    {8328677879379439582ULL, 1, MOVE(52, 36, 0x1)},
+    {8328677879379439582ULL, 1, MOVE(53, 37, 0x1)},
+    {8333270298575903634ULL, 1, MOVE(28, 36, 0x0)},
+    {8345380376816833621ULL, 6, MOVE(11, 27, 0x1)},
+    {8345469821715418428ULL, 10, MOVE(6, 21, 0x0)},
+    {8348902176758671749ULL, 1, MOVE(2, 9, 0x0)},
+    {8350007970517678685ULL, 1, MOVE(58, 49, 0x0)},
+    {8354904400468729281ULL, 1, MOVE(61, 54, 0x0)},
+    {8372779603301911613ULL, 7, MOVE(61, 52, 0x0)},
+    {8377718131709258103ULL, 5, MOVE(49, 41, 0x0)},
+    {8377718131709258103ULL, 1, MOVE(62, 52, 0x0)},
+    {8377718131709258103ULL, 1, MOVE(61, 34, 0x0)},
+    {8377854521578020560ULL, 1, MOVE(18, 28, 0x4)},
+    {8383009149158916268ULL, 1, MOVE(11, 17, 0x0)},
+    {8385786420915341331ULL, 1, MOVE(3, 1, 0x2)},
+    {8386510791805715863ULL, 2, MOVE(58, 49, 0x0)},
+    {8388064866067431519ULL, 1, MOVE(3, 5, 0x3)},
+    {8394596984044258473ULL, 1, MOVE(5, 14, 0x0)},
+    {8395160467009063010ULL, 12, MOVE(2, 9, 0x0)},
+    {8396167835030265523ULL, 1, MOVE(1, 18, 0x0)},
+    {8396167835030265523ULL, 1, MOVE(9, 25, 0x1)},
+    {8401568749159558518ULL, 2, MOVE(61, 43, 0x0)},
+    {8402483572974599129ULL, 1, MOVE(60, 28, 0x4)},
+    {8403970559007440406ULL, 1, MOVE(38, 45, 0x4)},
+    {8407207392130568286ULL, 4, MOVE(13, 29, 0x1)},
+    {8407207392130568286ULL, 3, MOVE(1, 18, 0x0)},
+    {8414277889752303266ULL, 1, MOVE(52, 36, 0x1)},
+    {8415331870334822986ULL, 8, MOVE(22, 29, 0x4)},
+    {8422942228386859655ULL, 48, MOVE(52, 44, 0x0)},
+    {8422942228386859655ULL, 22, MOVE(59, 57, 0x2)},
+    {8422942228386859655ULL, 18, MOVE(55, 47, 0x0)},
+    {8427069443767115565ULL, 3, MOVE(12, 28, 0x1)},
+    {8427069443767115565ULL, 1, MOVE(2, 11, 0x0)},
+    {8430424817324327995ULL, 1, MOVE(57, 42, 0x0)},
+    {8434461227566091606ULL, 1, MOVE(2, 9, 0x0)},
+    {8436222137481077260ULL, 1, MOVE(29, 36, 0x4)},
+    {8437221067564911582ULL, 4, MOVE(13, 21, 0x0)},
+    {8437221067564911582ULL, 1, MOVE(6, 12, 0x0)},
+    {8446784420751146235ULL, 2, MOVE(52, 44, 0x0)},
+    {8446784420751146235ULL, 1, MOVE(51, 43, 0x0)},
+    {8447631713456297032ULL, 1, MOVE(48, 40, 0x0)},
+    {8447631713456297032ULL, 1, MOVE(62, 52, 0x0)},
+    {8448575242731240433ULL, 2, MOVE(35, 28, 0x4)},
+    {8448575242731240433ULL, 2, MOVE(62, 52, 0x0)},
+    {8449531528916247117ULL, 20, MOVE(47, 54, 0x0)},
+    {8449531528916247117ULL, 6, MOVE(53, 37, 0x1)},
+    {8449531528916247117ULL, 4, MOVE(58, 30, 0x0)},
+    {8449531528916247117ULL, 1, MOVE(62, 45, 0x0)},
+    {8470066044995744290ULL, 2, MOVE(12, 28, 0x1)},
+    {8470066044995744290ULL, 2, MOVE(1, 18, 0x0)},
+    {8470066044995744290ULL, 1, MOVE(12, 20, 0x0)},
+    {8473730752022548436ULL, 12, MOVE(52, 36, 0x1)},
+    {8473730752022548436ULL, 1, MOVE(51, 35, 0x1)},
+    {8474826304192585091ULL, 2, MOVE(52, 36, 0x1)},
+    {8475884336097519025ULL, 1, MOVE(11, 19, 0x0)},
+    {8477201032121214403ULL, 1, MOVE(57, 42, 0x0)},
+    {8478818142849251329ULL, 2, MOVE(1, 18, 0x0)},
+    {8479195570444980746ULL, 1, MOVE(53, 45, 0x0)},
+    {8479195570444980746ULL, 1, MOVE(61, 34, 0x0)},
+    {8479464403566310891ULL, 4, MOVE(55, 47, 0x0)},
+    {8479464403566310891ULL, 4, MOVE(62, 45, 0x0)},
+    {8480836234384308368ULL, 1, MOVE(53, 37, 0x1)},
+    {8481625270009182845ULL, 6, MOVE(58, 49, 0x0)},
+    {8484280549169571066ULL, 2, MOVE(62, 45, 0x0)},
+    {8485371629423630652ULL, 2, MOVE(3, 1, 0x2)},
+    {8485715794482045386ULL, 1, MOVE(43, 36, 0x4)},
+    {8491811931117606660ULL, 1, MOVE(58, 49, 0x0)},
+    {8499241019415141023ULL, 1, MOVE(59, 57, 0x2)},
+    {8502442108831794280ULL, 1, MOVE(57, 42, 0x0)},
+    {8507669343922548223ULL, 1, MOVE(4, 12, 0x4)},
+    {8518872762186084081ULL, 1, MOVE(13, 29, 0x1)},
+    {8519506059000683964ULL, 1, MOVE(1, 18, 0x0)},
+    {8520385972645596394ULL, 6, MOVE(27, 42, 0x0)},
+    {8522667962060215183ULL, 13, MOVE(52, 36, 0x1)},
+    {8522667962060215183ULL, 2, MOVE(53, 37, 0x1)},
+    {8523682072765390941ULL, 3, MOVE(14, 22, 0x0)},
+    {8523682072765390941ULL, 1, MOVE(12, 28, 0x1)},
+    {8523682072765390941ULL, 1, MOVE(4, 13, 0x0)},
+    {8525850663299335419ULL, 2, MOVE(53, 45, 0x0)},
+    {8525850663299335419ULL, 1, MOVE(52, 44, 0x0)},
+    {8526019735160087015ULL, 1, MOVE(36, 29, 0x4)},
+    {8532407763523832106ULL, 1, MOVE(49, 41, 0x0)},
+    {8539174131121951348ULL, 1, MOVE(52, 37, 0x0)},
+    {8548383210840383514ULL, 1, MOVE(12, 28, 0x1)},
+    {8550191678227079581ULL, 1, MOVE(53, 37, 0x1)},
+    {8550191678227079581ULL, 1, MOVE(58, 51, 0x0)},
+    {8559430163502506544ULL, 2, MOVE(2, 20, 0x0)},
+    {8560533169153626220ULL, 1, MOVE(54, 46, 0x0)},
+    {8561402197627218569ULL, 1, MOVE(58, 51, 0x0)},
+    {8566474134460386068ULL, 1, MOVE(62, 45, 0x0)},
+    {8578247627682750578ULL, 2, MOVE(37, 28, 0x4)},
+    {8579051395577469150ULL, 2, MOVE(51, 35, 0x1)},
+    {8579053811411667553ULL, 1, MOVE(62, 45, 0x0)},
+    {8579612702522429523ULL, 3, MOVE(58, 49, 0x0)},
+    {8579612702522429523ULL, 1, MOVE(52, 36, 0x1)},
+    {8580484781380780869ULL, 9, MOVE(29, 22, 0x0)},
+    {8581475948901266669ULL, 1, MOVE(52, 36, 0x1)},
+    {8581667194222942950ULL, 45, MOVE(27, 35, 0x0)},
+    {8581667194222942950ULL, 26, MOVE(5, 33, 0x0)},
+    {8586775188470126379ULL, 1, MOVE(2, 9, 0x0)},
+    {8587749136546355201ULL, 1, MOVE(62, 52, 0x0)},
+    {8588073099267185681ULL, 1, MOVE(5, 14, 0x0)},
+    {8598123353510567253ULL, 2, MOVE(35, 28, 0x4)},
+    {8598919340171855927ULL, 2, MOVE(13, 29, 0x1)},
+    {8600008323576777217ULL, 1, MOVE(60, 46, 0x0)},
+    {8604448727084761388ULL, 1, MOVE(37, 28, 0x4)},
+    {8607671694041838903ULL, 1, MOVE(6, 21, 0x0)},
+    {8608987003803134410ULL, 46, MOVE(2, 9, 0x0)},
+    {8608987003803134410ULL, 2, MOVE(4, 31, 0x0)},
+    {8609301101699196205ULL, 2, MOVE(12, 20, 0x0)},
+    {8609301101699196205ULL, 1, MOVE(12, 28, 0x1)},
+    {8609301101699196205ULL, 1, MOVE(15, 23, 0x0)},
+    {8612975541637325212ULL, 1, MOVE(2, 9, 0x0)},
+    {8614909278967521129ULL, 1, MOVE(57, 42, 0x0)},
+    {8617762976750451016ULL, 1, MOVE(13, 29, 0x1)},
+    {8618580108188990629ULL, 5, MOVE(33, 42, 0x4)},
+    {8623294716562397061ULL, 1, MOVE(37, 28, 0x4)},
+    {8626977525414508715ULL, 3, MOVE(2, 9, 0x0)},
+    {8627881762850431307ULL, 1, MOVE(45, 37, 0x0)},
+    {8630319734841893252ULL, 1, MOVE(12, 20, 0x0)},
+    {8636271746137479860ULL, 1, MOVE(49, 41, 0x0)},
+    {8637947276118386178ULL, 1, MOVE(37, 28, 0x4)},
+    {8644429972487150908ULL, 1, MOVE(61, 54, 0x0)},
+    {8649008993049352522ULL, 8, MOVE(61, 52, 0x0)},
+    {8652740999533214637ULL, 3, MOVE(6, 21, 0x0)},
+    {8652740999533214637ULL, 2, MOVE(1, 18, 0x0)},
+    {8653803125951045468ULL, 1, MOVE(58, 49, 0x0)},
+    {8653803125951045468ULL, 1, MOVE(52, 36, 0x1)},
+    {8659841589626431886ULL, 1, MOVE(62, 52, 0x0)},
+    {8671698497451685868ULL, 1, MOVE(8, 16, 0x0)},
+    {8676272330475684341ULL, 1, MOVE(37, 28, 0x4)},
+    {8677024398818576339ULL, 2, MOVE(49, 41, 0x0)},
+    {8677518006023688458ULL, 1, MOVE(57, 42, 0x0)},
+    {8678813446254963662ULL, 1, MOVE(2, 9, 0x0)},
+    {8682102834439549420ULL, 21, MOVE(6, 21, 0x0)},
+    {8683282126207643385ULL, 1, MOVE(10, 26, 0x1)},
+    {8684355943912874712ULL, 1, MOVE(59, 58, 0x0)},
+    {8687986679435163630ULL, 1, MOVE(11, 27, 0x1)},
+    {8695987143359022308ULL, 1, MOVE(51, 43, 0x0)},
+    {8701429678181947403ULL, 1, MOVE(51, 43, 0x0)},
+    {8702407345901263353ULL, 1, MOVE(6, 21, 0x0)},
+    {8703729809094209328ULL, 2, MOVE(2, 9, 0x0)},
+    {8704711894625106225ULL, 1, MOVE(51, 43, 0x0)},
+    {8704901504534309549ULL, 28, MOVE(43, 36, 0x4)},
+    {8704901504534309549ULL, 10, MOVE(42, 36, 0x4)},
+    {8714554056806084529ULL, 2, MOVE(1, 18, 0x0)},
+    {8715216574703264762ULL, 1, MOVE(51, 43, 0x0)},
+    {8719313362175360439ULL, 3, MOVE(58, 49, 0x0)},
+    {8720278497729489067ULL, 1, MOVE(2, 38, 0x0)},
+    {8726460708508598003ULL, 2, MOVE(59, 57, 0x2)},
+    {8726859001062378535ULL, 1, MOVE(37, 30, 0x0)},
+    {8727702117965289336ULL, 4, MOVE(53, 37, 0x1)},
+    {8727702117965289336ULL, 2, MOVE(51, 43, 0x0)},
+    {8728015458749989668ULL, 1, MOVE(57, 42, 0x0)},
+    {8731431306718687948ULL, 1, MOVE(58, 49, 0x0)},
+    {8733794996227375186ULL, 14, MOVE(2, 29, 0x0)},
+    {8734052717918698342ULL, 3, MOVE(57, 42, 0x0)},
+    {8734052717918698342ULL, 1, MOVE(58, 49, 0x0)},
+    {8737519850864663863ULL, 3, MOVE(11, 19, 0x0)},
+    {8737869653759538753ULL, 2, MOVE(1, 11, 0x0)},
+    {8739327024416649535ULL, 2, MOVE(4, 22, 0x0)},
+    {8739327024416649535ULL, 1, MOVE(2, 9, 0x0)},
+    {8739327024416649535ULL, 1, MOVE(18, 35, 0x0)},
+    {8741899078597527480ULL, 1, MOVE(52, 44, 0x0)},
+    {8742841718250770058ULL, 1, MOVE(4, 31, 0x0)},
+    {8748720130028927901ULL, 1, MOVE(3, 1, 0x2)},
+    {8762050583959427855ULL, 1, MOVE(13, 29, 0x1)},
+    {8763854933737976437ULL, 23, MOVE(15, 23, 0x0)},
+    {8768012393771337385ULL, 3, MOVE(36, 29, 0x4)},
+    {8772940255083202425ULL, 1, MOVE(53, 45, 0x0)},
+    {8774324354527684973ULL, 1, MOVE(48, 40, 0x0)},
+    {8777988894073005794ULL, 9, MOVE(1, 18, 0x0)},
+    {8777988894073005794ULL, 5, MOVE(9, 17, 0x0)},
+    {8777988894073005794ULL, 1, MOVE(11, 19, 0x0)},
+    {8779947511640187365ULL, 1, MOVE(4, 20, 0x4)},
+    {8782252516741021107ULL, 9, MOVE(52, 44, 0x0)},
+    {8782252516741021107ULL, 4, MOVE(51, 43, 0x0)},
+    {8782252516741021107ULL, 2, MOVE(62, 45, 0x0)},
+    {8782460177020252998ULL, 1, MOVE(2, 9, 0x0)},
+    {8783275223403311351ULL, 12, MOVE(57, 42, 0x0)},
+    {8785894358676112783ULL, 19, MOVE(3, 1, 0x2)},
+    {8785894358676112783ULL, 3, MOVE(13, 29, 0x1)},
+    {8785894358676112783ULL, 2, MOVE(12, 20, 0x0)},
+    {8785894358676112783ULL, 1, MOVE(12, 28, 0x1)},
+    {8786119498380586920ULL, 1, MOVE(57, 42, 0x0)},
+    {8796440348712422494ULL, 29, MOVE(9, 17, 0x0)},
+    {8797109604463170742ULL, 1, MOVE(53, 37, 0x1)},
+    {8797904909323907878ULL, 1, MOVE(52, 44, 0x0)},
+    {8807223388999043273ULL, 1, MOVE(12, 28, 0x1)},
+    {8817193211456690718ULL, 1, MOVE(53, 37, 0x1)},
+    {8822340984871530403ULL, 4, MOVE(27, 35, 0x0)},
+    {8822340984871530403ULL, 2, MOVE(3, 1, 0x2)},
+    {8826388458108771235ULL, 3, MOVE(11, 19, 0x0)},
+    {8826388458108771235ULL, 2, MOVE(12, 20, 0x0)},
+    {8826388458108771235ULL, 1, MOVE(11, 27, 0x1)},
+    {8826506160819367355ULL, 46, MOVE(43, 36, 0x4)},
+    {8830033881731483825ULL, 1, MOVE(54, 46, 0x0)},
+    {8839837295941234735ULL, 1, MOVE(19, 28, 0x4)},
+    {8840099917782948998ULL, 5, MOVE(6, 12, 0x0)},
+    {8841020228770478731ULL, 1, MOVE(5, 14, 0x0)},
+    {8844009727778042359ULL, 1, MOVE(37, 28, 0x4)},
+    {8847582053468192663ULL, 2, MOVE(47, 54, 0x0)},
+    {8854390551592155458ULL, 1, MOVE(5, 14, 0x0)},
+    {8854587472491768424ULL, 1, MOVE(57, 42, 0x0)},
+    {8856568216388786776ULL, 1, MOVE(9, 25, 0x1)},
+    {8860805843273386487ULL, 1, MOVE(4, 13, 0x0)},
+    {8861511505067914185ULL, 2, MOVE(9, 18, 0x4)},
+    {8862819093315379337ULL, 3, MOVE(53, 37, 0x1)},
+    {8862819093315379337ULL, 2, MOVE(57, 42, 0x0)},
+    {8862819093315379337ULL, 1, MOVE(54, 38, 0x1)},
+    {8862819093315379337ULL, 1, MOVE(55, 47, 0x0)},
+    {8862983041753891354ULL, 1, MOVE(60, 36, 0x4)},
+    {8863480504210838169ULL, 1, MOVE(52, 44, 0x0)},
+    {8863480504210838169ULL, 1, MOVE(54, 46, 0x0)},
+    {8876299967437453441ULL, 2, MOVE(57, 42, 0x0)},
+    {8876299967437453441ULL, 1, MOVE(52, 36, 0x1)},
+    {8880538114463373688ULL, 1, MOVE(55, 39, 0x1)},
+    {8880538114463373688ULL, 1, MOVE(30, 39, 0x0)},
+    {8880538114463373688ULL, 1, MOVE(53, 37, 0x1)},
+    {8883769607788037463ULL, 107, MOVE(5, 26, 0x0)},
+    {8883769607788037463ULL, 55, MOVE(5, 33, 0x0)},
+    {8883769607788037463ULL, 9, MOVE(9, 17, 0x0)},
+    {8883769607788037463ULL, 5, MOVE(29, 36, 0x4)},
+    {8883769607788037463ULL, 3, MOVE(4, 13, 0x0)},
+    {8883769607788037463ULL, 1, MOVE(9, 25, 0x1)},
+    {8895314291255752262ULL, 1, MOVE(57, 42, 0x0)},
+    {8895660024578348683ULL, 1, MOVE(54, 46, 0x0)},
+    {8898096394377743800ULL, 1, MOVE(62, 52, 0x0)},
+    {8898366466542964046ULL, 1, MOVE(58, 30, 0x0)},
+    {8899259314254235730ULL, 1, MOVE(1, 18, 0x0)},
+    {8903149488731738733ULL, 12, MOVE(11, 27, 0x1)},
+    {8903149488731738733ULL, 3, MOVE(9, 17, 0x0)},
+    {8903149488731738733ULL, 2, MOVE(5, 33, 0x0)},
+    {8903149488731738733ULL, 1, MOVE(5, 26, 0x0)},
+    {8903761106017082486ULL, 1, MOVE(6, 21, 0x0)},
+    {8906331064969231832ULL, 1, MOVE(2, 29, 0x0)},
+    {8917516792249963565ULL, 2, MOVE(57, 42, 0x0)},
+    {8917516792249963565ULL, 1, MOVE(51, 35, 0x1)},
+    {8918090554466187553ULL, 15, MOVE(52, 36, 0x1)},
+    {8920481828534561029ULL, 1, MOVE(49, 41, 0x0)},
+    {8927218991875041931ULL, 1, MOVE(15, 23, 0x0)},
+    {8927232463280915272ULL, 9, MOVE(6, 12, 0x0)},
+    {8930665223285187834ULL, 4, MOVE(53, 37, 0x1)},
+    {8930855776196646118ULL, 2, MOVE(1, 11, 0x0)},
+    {8930855776196646118ULL, 1, MOVE(5, 19, 0x0)},
+    {8936134001505145787ULL, 1, MOVE(58, 51, 0x0)},
+    {8938242349718636745ULL, 3, MOVE(13, 21, 0x0)},
+    {8938242349718636745ULL, 1, MOVE(6, 21, 0x0)},
+    {8938242349718636745ULL, 1, MOVE(28, 37, 0x4)},
+    {8940404056650607693ULL, 3, MOVE(57, 42, 0x0)},
+    {8942395853409105120ULL, 1, MOVE(1, 11, 0x0)},
+    {8949585484049234942ULL, 1, MOVE(11, 19, 0x0)},
+    {8952849564472207391ULL, 1, MOVE(6, 21, 0x0)},
+    {8955150090336585874ULL, 1, MOVE(2, 9, 0x0)},
+    {8955599048947091230ULL, 2, MOVE(4, 13, 0x0)},
+    {8955599048947091230ULL, 1, MOVE(11, 19, 0x0)},
+    {8955599048947091230ULL, 1, MOVE(4, 22, 0x0)},
+    {8957568966247469475ULL, 26, MOVE(12, 28, 0x1)},
+    {8957568966247469475ULL, 3, MOVE(11, 19, 0x0)},
+    {8959450622482795558ULL, 11, MOVE(9, 17, 0x0)},
+    {8959450622482795558ULL, 5, MOVE(12, 28, 0x1)},
+    {8959450622482795558ULL, 3, MOVE(6, 21, 0x0)},
+    {8959450622482795558ULL, 1, MOVE(11, 19, 0x0)},
+    {8966535503725160205ULL, 1, MOVE(18, 35, 0x0)},
+    {8966535503725160205ULL, 1, MOVE(11, 19, 0x0)},
+    {8969677330936906768ULL, 7, MOVE(57, 42, 0x0)},
+    {8969677330936906768ULL, 1, MOVE(55, 47, 0x0)},
+    {8969755738068746862ULL, 1, MOVE(52, 44, 0x0)},
+    {8969992664936869271ULL, 1, MOVE(35, 28, 0x4)},
+    {8979267306839430703ULL, 1, MOVE(49, 41, 0x0)},
+    {8982433921387038070ULL, 1, MOVE(11, 19, 0x0)},
+    {8986518298872283255ULL, 3, MOVE(29, 36, 0x4)},
+    {8987149673667085504ULL, 15, MOVE(13, 29, 0x1)},
+    {8987149673667085504ULL, 4, MOVE(3, 1, 0x2)},
+    {8991143333196672608ULL, 11, MOVE(57, 42, 0x0)},
+    {8991143333196672608ULL, 1, MOVE(49, 41, 0x0)},
+    {8992354472741281074ULL, 13, MOVE(42, 36, 0x4)},
+    {8999913007383507122ULL, 2, MOVE(62, 45, 0x0)},
+    {9000577122106676244ULL, 1, MOVE(49, 41, 0x0)},
+    {9001587623109235175ULL, 1, MOVE(62, 52, 0x0)},
+    {9003258572621751899ULL, 2, MOVE(4, 22, 0x0)},
+    {9007367709629722190ULL, 1, MOVE(51, 43, 0x0)},
+    {9009397116333335656ULL, 1, MOVE(6, 21, 0x0)},
+    {9010705165428670877ULL, 1, MOVE(61, 54, 0x0)},
+    {9024235308395511945ULL, 4, MOVE(13, 29, 0x1)},
+    {9028429106017927757ULL, 8, MOVE(12, 28, 0x1)},
+    {9028429106017927757ULL, 8, MOVE(6, 21, 0x0)},
+    {9028429106017927757ULL, 1, MOVE(11, 19, 0x0)},
+    {9028429106017927757ULL, 1, MOVE(9, 17, 0x0)},
+    {9031485652680936441ULL, 2, MOVE(57, 42, 0x0)},
+    {9031485652680936441ULL, 2, MOVE(54, 38, 0x1)},
+    {9031485652680936441ULL, 1, MOVE(49, 41, 0x0)},
+    {9039607097023154439ULL, 1, MOVE(52, 44, 0x0)},
+    {9045299272386944666ULL, 1, MOVE(13, 21, 0x0)},
+    {9049309867220224155ULL, 4, MOVE(28, 36, 0x0)},
+    {9050577108334555456ULL, 1, MOVE(29, 36, 0x4)},
+    {9050707863558611114ULL, 1, MOVE(52, 36, 0x1)},
+    {9054033535219127931ULL, 3, MOVE(21, 38, 0x0)},
+    {9054033535219127931ULL, 1, MOVE(11, 19, 0x0)},
+    {9055825625432016925ULL, 3, MOVE(2, 20, 0x0)},
+    {9066308518990209926ULL, 1, MOVE(58, 49, 0x0)},
+    {9066330801809682239ULL, 2, MOVE(57, 42, 0x0)},
+    {9073386793767890390ULL, 1, MOVE(11, 27, 0x1)},
+    {9074642151402171881ULL, 1, MOVE(28, 36, 0x0)},
+    {9081828941600717791ULL, 1, MOVE(49, 41, 0x0)},
+    {9088043315682783747ULL, 2, MOVE(12, 30, 0x4)},
+    {9088969292631881460ULL, 1, MOVE(62, 52, 0x0)},
+    {9091132709694184297ULL, 5, MOVE(2, 9, 0x0)},
+    {9096914098667035251ULL, 1, MOVE(14, 22, 0x0)},
+    {9096914098667035251ULL, 1, MOVE(6, 12, 0x0)},
+    {9119075696001752425ULL, 2, MOVE(28, 37, 0x4)},
+    {9127470429296041650ULL, 4, MOVE(37, 28, 0x4)},
+    {9129486555749733290ULL, 1, MOVE(1, 18, 0x0)},
+    {9130588288642540357ULL, 1, MOVE(2, 38, 0x0)},
+    {9130588288642540357ULL, 1, MOVE(5, 14, 0x0)},
+    {9131774160553666360ULL, 32, MOVE(58, 51, 0x0)},
+    {9131774160553666360ULL, 5, MOVE(58, 30, 0x0)},
+    {9131774160553666360ULL, 1, MOVE(49, 41, 0x0)},
+    {9131774160553666360ULL, 1, MOVE(53, 45, 0x0)},
+    {9131774160553666360ULL, 1, MOVE(53, 37, 0x1)},
+    {9135797113855008411ULL, 1, MOVE(2, 20, 0x0)},
+    {9136325523679480101ULL, 1, MOVE(29, 36, 0x4)},
+    {9140647452787248150ULL, 1, MOVE(2, 20, 0x0)},
+    {9145870416929855859ULL, 5, MOVE(57, 42, 0x0)},
+    {9145870416929855859ULL, 1, MOVE(60, 53, 0x0)},
+    {9146050789513285294ULL, 1, MOVE(28, 36, 0x0)},
+    {9147797300444633922ULL, 3, MOVE(52, 44, 0x0)},
+    {9150576106636513529ULL, 2, MOVE(2, 9, 0x0)},
+    {9151149934221896231ULL, 1, MOVE(12, 28, 0x1)},
+    {9152727282693182896ULL, 1, MOVE(12, 20, 0x0)},
+    {9158195707032856613ULL, 1, MOVE(59, 57, 0x2)},
+    {9164552572524741758ULL, 1, MOVE(13, 21, 0x0)},
+    {9168209492786967085ULL, 1, MOVE(6, 21, 0x0)},
+    {9168209492786967085ULL, 1, MOVE(27, 35, 0x0)},
+    {9169622694104440521ULL, 239, MOVE(13, 29, 0x1)},
+    {9169622694104440521ULL, 66, MOVE(9, 17, 0x0)},
+    {9169622694104440521ULL, 10, MOVE(12, 28, 0x1)},
+    {9169622694104440521ULL, 2, MOVE(14, 22, 0x0)},
+    {9169622694104440521ULL, 1, MOVE(12, 20, 0x0)},
+    {9169622694104440521ULL, 1, MOVE(11, 19, 0x0)},
+    {9170743332773724531ULL, 1, MOVE(2, 9, 0x0)},
+    {9172695510878081810ULL, 2, MOVE(52, 44, 0x0)},
+    {9174454309229643890ULL, 1, MOVE(2, 9, 0x0)},
+    {9174644835637754614ULL, 1, MOVE(62, 45, 0x0)},
+    {9174644835637754614ULL, 1, MOVE(59, 57, 0x2)},
+    {9176897335069304700ULL, 61, MOVE(13, 29, 0x1)},
+    {9176897335069304700ULL, 15, MOVE(11, 27, 0x1)},
+    {9176897335069304700ULL, 9, MOVE(9, 17, 0x0)},
+    {9176897335069304700ULL, 3, MOVE(13, 21, 0x0)},
+    {9176897335069304700ULL, 1, MOVE(11, 19, 0x0)},
+    {9176897335069304700ULL, 1, MOVE(14, 22, 0x0)},
+    {9185097134366520292ULL, 14, MOVE(53, 45, 0x0)},
+    {9185097134366520292ULL, 4, MOVE(62, 45, 0x0)},
+    {9185097134366520292ULL, 3, MOVE(58, 37, 0x0)},
+    {9185097134366520292ULL, 1, MOVE(52, 36, 0x1)},
+    {9193297812429676933ULL, 1, MOVE(53, 37, 0x1)},
+    {9193475372648755844ULL, 1, MOVE(12, 28, 0x1)},
+    {9194957673547791660ULL, 1, MOVE(57, 42, 0x0)},
+    {9200999019149994016ULL, 6, MOVE(58, 49, 0x0)},
+    {9200999019149994016ULL, 3, MOVE(52, 36, 0x1)},
+    {9202853169307199911ULL, 1, MOVE(1, 18, 0x0)},
+    {9209746484468639587ULL, 2, MOVE(49, 41, 0x0)},
+    {9209746484468639587ULL, 1, MOVE(53, 37, 0x1)},
+    {9209746484468639587ULL, 1, MOVE(51, 43, 0x0)},
+    {9211230315028962120ULL, 1, MOVE(2, 9, 0x0)},
+    {9211845321325076354ULL, 2, MOVE(12, 20, 0x0)},
+    {9226515466203221386ULL, 1, MOVE(9, 17, 0x0)},
+    {9231382006437961500ULL, 3, MOVE(52, 44, 0x0)},
+    {9237047603426361651ULL, 9, MOVE(45, 36, 0x4)},
+    {9244656734522079779ULL, 1, MOVE(59, 57, 0x2)},
+    {9244673781332340026ULL, 1, MOVE(5, 14, 0x0)},
+    {9246059222838258672ULL, 1, MOVE(58, 44, 0x0)},
+    {9246059222838258672ULL, 1, MOVE(62, 45, 0x0)},
+    {9248388537246199705ULL, 1, MOVE(15, 23, 0x0)},
+    {9259936705239753165ULL, 1, MOVE(37, 28, 0x4)},
+    {9262579152981334469ULL, 1, MOVE(53, 37, 0x1)},
+    {9263271353037574102ULL, 3, MOVE(15, 23, 0x0)},
+    {9263271353037574102ULL, 1, MOVE(9, 17, 0x0)},
+    {9263271353037574102ULL, 1, MOVE(11, 19, 0x0)},
+    {9264254154950410274ULL, 7, MOVE(59, 57, 0x2)},
+    {9264254154950410274ULL, 1, MOVE(54, 46, 0x0)},
+    {9264254154950410274ULL, 1, MOVE(53, 37, 0x1)},
+    {9271587882275132323ULL, 1, MOVE(9, 17, 0x0)},
+    {9279904601962351389ULL, 21, MOVE(52, 44, 0x0)},
+    {9279904601962351389ULL, 14, MOVE(62, 45, 0x0)},
+    {9279904601962351389ULL, 8, MOVE(51, 43, 0x0)},
+    {9279904601962351389ULL, 7, MOVE(55, 47, 0x0)},
+    {9279904601962351389ULL, 3, MOVE(49, 41, 0x0)},
+    {9289050261327178778ULL, 1, MOVE(11, 27, 0x1)},
+    {9299172483417347992ULL, 1, MOVE(52, 36, 0x1)},
+    {9310224577133119054ULL, 1, MOVE(59, 57, 0x2)},
+    {9315794736652164644ULL, 2, MOVE(54, 46, 0x0)},
+    {9315794736652164644ULL, 1, MOVE(52, 36, 0x1)},
+    {9321333274018776774ULL, 1, MOVE(38, 11, 0x0)},
+    {9324308595813195517ULL, 2, MOVE(51, 43, 0x0)},
+    {9333145959374223398ULL, 5, MOVE(5, 14, 0x0)},
+    {9335905268941726859ULL, 22, MOVE(43, 36, 0x4)},
+    {9335905268941726859ULL, 1, MOVE(49, 41, 0x0)},
+    {9336284102959383684ULL, 1, MOVE(8, 16, 0x0)},
+    {9336284102959383684ULL, 1, MOVE(6, 21, 0x0)},
+    {9344943471978817094ULL, 1, MOVE(57, 42, 0x0)},
+    {9344943471978817094ULL, 1, MOVE(55, 47, 0x0)},
+    {9344943471978817094ULL, 1, MOVE(53, 45, 0x0)},
+    {9349488048243500653ULL, 2, MOVE(58, 49, 0x0)},
+    {9349584150933916654ULL, 1, MOVE(58, 51, 0x0)},
+    {9351802580645735486ULL, 6, MOVE(52, 36, 0x1)},
+    {9351802580645735486ULL, 1, MOVE(54, 46, 0x0)},
+    {9368555055973427104ULL, 1, MOVE(53, 37, 0x1)},
+    {9375886585275440852ULL, 1, MOVE(51, 43, 0x0)},
+    {9382696552662842693ULL, 4, MOVE(51, 43, 0x0)},
+    {9382696552662842693ULL, 1, MOVE(25, 18, 0x4)},
+    {9388005635330423822ULL, 7, MOVE(21, 27, 0x4)},
+    {9391237068903057342ULL, 3, MOVE(4, 22, 0x0)},
+    {9391237068903057342ULL, 1, MOVE(9, 17, 0x0)},
+    {9391953128620828480ULL, 1, MOVE(57, 42, 0x0)},
+    {9400639351158213387ULL, 2, MOVE(4, 31, 0x0)},
+    {9404636877234465253ULL, 1, MOVE(50, 34, 0x1)},
+    {9404636877234465253ULL, 1, MOVE(49, 41, 0x0)},
+    {9409728825916657066ULL, 1, MOVE(57, 42, 0x0)},
+    {9411031113065290682ULL, 7, MOVE(61, 52, 0x0)},
+    {9411031113065290682ULL, 5, MOVE(58, 51, 0x0)},
+    {9411031113065290682ULL, 1, MOVE(49, 41, 0x0)},
+    {9424034450171614538ULL, 1, MOVE(9, 17, 0x0)},
+    {9427672685962674790ULL, 1, MOVE(58, 51, 0x0)},
+    {9430813952649828547ULL, 1, MOVE(3, 1, 0x2)},
+    {9433072018767196388ULL, 1, MOVE(43, 36, 0x4)},
+    {9434333338229119324ULL, 1, MOVE(52, 44, 0x0)},
+    {9446745124700044237ULL, 2, MOVE(60, 46, 0x0)},
+    {9453127413630740743ULL, 1, MOVE(13, 21, 0x0)},
+    {9454198418484282279ULL, 2, MOVE(2, 9, 0x0)},
+    {9459438636499422140ULL, 2, MOVE(52, 44, 0x0)},
+    {9459660023428820087ULL, 1, MOVE(57, 42, 0x0)},
+    {9462800290151167751ULL, 1, MOVE(9, 17, 0x0)},
+    {9463267820597993626ULL, 1, MOVE(61, 25, 0x0)},
+    {9471853440028459599ULL, 1, MOVE(13, 29, 0x1)},
+    {9471853440028459599ULL, 1, MOVE(11, 27, 0x1)},
+    {9473324903699384567ULL, 1, MOVE(37, 51, 0x0)},
+    {9480136606271853425ULL, 7, MOVE(59, 57, 0x2)},
+    {9480824476495029918ULL, 1, MOVE(60, 36, 0x4)},
+    {9481557531746939739ULL, 9, MOVE(2, 29, 0x0)},
+    {9481557531746939739ULL, 4, MOVE(12, 28, 0x1)},
+    {9484800340396816458ULL, 1, MOVE(58, 49, 0x0)},
+    {9488121084213675024ULL, 1, MOVE(61, 54, 0x0)},
+    {9491049336051427072ULL, 2, MOVE(62, 52, 0x0)},
+    {9491049336051427072ULL, 1, MOVE(55, 47, 0x0)},
+    {9495592592238646496ULL, 9, MOVE(58, 49, 0x0)},
+    {9500368267546265977ULL, 6, MOVE(2, 9, 0x0)},
+    {9500683017187650434ULL, 4, MOVE(27, 42, 0x0)},
+    {9501618451516792549ULL, 1, MOVE(11, 19, 0x0)},
+    {9502821411561653216ULL, 1, MOVE(1, 18, 0x0)},
+    {9503722984616622258ULL, 1, MOVE(36, 29, 0x4)},
+    {9513236033384119543ULL, 1, MOVE(2, 9, 0x0)},
+    {9514755543312572244ULL, 10, MOVE(12, 28, 0x1)},
+    {9514755543312572244ULL, 4, MOVE(13, 21, 0x0)},
+    {9514755543312572244ULL, 4, MOVE(13, 29, 0x1)},
+    {9519051506726767542ULL, 4, MOVE(58, 49, 0x0)},
+    {9521019390151379158ULL, 1, MOVE(11, 19, 0x0)},
+    {9521019390151379158ULL, 1, MOVE(1, 18, 0x0)},
+    {9527671046628839996ULL, 4, MOVE(57, 42, 0x0)},
+    {9527757239209639218ULL, 2, MOVE(61, 25, 0x0)},
+    {9527757239209639218ULL, 1, MOVE(61, 34, 0x0)},
+    {9533279594238364988ULL, 2, MOVE(49, 41, 0x0)},
+    {9536713344732016770ULL, 17, MOVE(61, 54, 0x0)},
+    {9548237298594179844ULL, 1, MOVE(6, 21, 0x0)},
+    {9549965178660595352ULL, 6, MOVE(29, 36, 0x4)},
+    {9550172561083282399ULL, 1, MOVE(62, 45, 0x0)},
+    {9551338453046040069ULL, 1, MOVE(2, 9, 0x0)},
+    {9551472474573670967ULL, 2, MOVE(1, 18, 0x0)},
+    {9559182597749349740ULL, 1, MOVE(58, 49, 0x0)},
+    {9565771135229060886ULL, 2, MOVE(6, 21, 0x0)},
+    {9565771135229060886ULL, 1, MOVE(1, 18, 0x0)},
+    {9565771135229060886ULL, 1, MOVE(11, 19, 0x0)},
+    {9566539845835681766ULL, 2, MOVE(58, 30, 0x0)},
+    {9568627263453093670ULL, 1, MOVE(58, 49, 0x0)},
+    {9569009031069948786ULL, 19, MOVE(9, 17, 0x0)},
+    {9569009031069948786ULL, 10, MOVE(12, 28, 0x1)},
+    {9569009031069948786ULL, 8, MOVE(11, 19, 0x0)},
+    {9575312428197695142ULL, 1, MOVE(36, 29, 0x4)},
+    {9581962968419767339ULL, 69, MOVE(12, 28, 0x1)},
+    {9581962968419767339ULL, 2, MOVE(6, 21, 0x0)},
+    {9587624557819991453ULL, 1, MOVE(60, 36, 0x4)},
+    {9598053961461650201ULL, 1, MOVE(52, 36, 0x1)},
+    {9598795231784767581ULL, 4, MOVE(11, 19, 0x0)},
+    {9598795231784767581ULL, 3, MOVE(11, 27, 0x1)},
+    {9605645272104905581ULL, 1, MOVE(50, 34, 0x1)},
+    {9605922559621454532ULL, 1, MOVE(37, 28, 0x4)},
+    {9606529299302046319ULL, 1, MOVE(5, 14, 0x0)},
+    {9609407496200168339ULL, 6, MOVE(3, 1, 0x2)},
+    {9610884969801400712ULL, 1, MOVE(2, 9, 0x0)},
+    {9615046495773870518ULL, 1, MOVE(4, 60, 0x4)},
+    {9619654411036369844ULL, 2, MOVE(3, 1, 0x2)},
+    {9619654411036369844ULL, 1, MOVE(13, 21, 0x0)},
+    {9620014142123153037ULL, 2, MOVE(51, 43, 0x0)},
+    {9635145640716228590ULL, 1, MOVE(61, 25, 0x0)},
+    {9644546822295064762ULL, 2, MOVE(59, 57, 0x2)},
+    {9651650726527733689ULL, 1, MOVE(29, 36, 0x4)},
+    {9654280728768681035ULL, 1, MOVE(54, 38, 0x1)},
+    {9655661651228343898ULL, 2, MOVE(62, 45, 0x0)},
+    {9657094885283039738ULL, 1, MOVE(11, 27, 0x1)},
+    {9671896366334917969ULL, 22, MOVE(21, 27, 0x4)},
+    {9674855156149353128ULL, 3, MOVE(6, 21, 0x0)},
+    {9678173733819541777ULL, 1, MOVE(52, 36, 0x1)},
+    {9679474934641636197ULL, 1, MOVE(1, 18, 0x0)},
+    {9685414171162372639ULL, 5, MOVE(12, 28, 0x1)},
+    {9688422267938086863ULL, 1, MOVE(58, 49, 0x0)},
+    {9693721429214505670ULL, 1, MOVE(30, 12, 0x4)},
+    {9694824510618658596ULL, 1, MOVE(57, 42, 0x0)},
+    {9700294168424148692ULL, 1, MOVE(30, 37, 0x4)},
+    {9702525227242907313ULL, 1, MOVE(4, 22, 0x0)},
+    {9711748395756806951ULL, 7, MOVE(11, 19, 0x0)},
+    {9711748395756806951ULL, 1, MOVE(1, 18, 0x0)},
+    {9715792152606352957ULL, 1, MOVE(36, 46, 0x0)},
+    {9719045727164459558ULL, 1, MOVE(57, 42, 0x0)},
+    {9719244438865608227ULL, 1, MOVE(11, 27, 0x1)},
+    {9720808026548882503ULL, 15, MOVE(10, 26, 0x1)},
+    {9720808026548882503ULL, 14, MOVE(5, 19, 0x0)},
+    {9720808026548882503ULL, 6, MOVE(1, 18, 0x0)},
+    {9720808026548882503ULL, 2, MOVE(5, 26, 0x0)},
+    {9720808026548882503ULL, 2, MOVE(5, 33, 0x0)},
+    {9720808026548882503ULL, 1, MOVE(8, 16, 0x0)},
+    {9720808026548882503ULL, 1, MOVE(8, 24, 0x1)},
+    {9720808026548882503ULL, 1, MOVE(2, 11, 0x0)},
+    {9720808026548882503ULL, 1, MOVE(9, 17, 0x0)},
+    {9721996433120500896ULL, 2, MOVE(61, 54, 0x0)},
+    {9724200707320908159ULL, 1, MOVE(52, 44, 0x0)},
+    {9725560077456088598ULL, 1, MOVE(33, 24, 0x0)},
+    {9727332601297506651ULL, 1, MOVE(11, 19, 0x0)},
+    {9727702507890721162ULL, 1, MOVE(11, 19, 0x0)},
+    {9727702507890721162ULL, 1, MOVE(12, 20, 0x0)},
+    {9727702507890721162ULL, 1, MOVE(9, 17, 0x0)},
+    {9727971503483455233ULL, 1, MOVE(11, 19, 0x0)},
+    {9727971503483455233ULL, 1, MOVE(6, 12, 0x0)},
+    {9728722266351763261ULL, 1, MOVE(53, 37, 0x1)},
+    {9731477770957540885ULL, 1, MOVE(58, 51, 0x0)},
+    {9735288537322512972ULL, 1, MOVE(25, 32, 0x0)},
+    {9735890692923938283ULL, 9, MOVE(1, 18, 0x0)},
+    {9735890692923938283ULL, 1, MOVE(11, 19, 0x0)},
+    {9735890692923938283ULL, 1, MOVE(29, 36, 0x4)},
+    {9735890692923938283ULL, 1, MOVE(6, 21, 0x0)},
+    {9741325202530033938ULL, 4, MOVE(6, 21, 0x0)},
+    {9741325202530033938ULL, 1, MOVE(1, 18, 0x0)},
+    {9744492948846349019ULL, 1, MOVE(51, 43, 0x0)},
+    {9749055384458238857ULL, 2, MOVE(1, 18, 0x0)},
+    {9750818109215314719ULL, 2, MOVE(12, 28, 0x1)},
+    {9751489673746178941ULL, 4, MOVE(62, 45, 0x0)},
+    {9751489673746178941ULL, 1, MOVE(58, 51, 0x0)},
+    {9751489673746178941ULL, 1, MOVE(52, 36, 0x1)},
+    {9751664453903314766ULL, 5, MOVE(11, 19, 0x0)},
+    {9766341823793461473ULL, 2, MOVE(42, 27, 0x4)},
+    {9766776839362488047ULL, 1, MOVE(52, 44, 0x0)},
+    {9768746727525077456ULL, 1, MOVE(54, 38, 0x1)},
+    {9770712828427831827ULL, 3, MOVE(52, 44, 0x0)},
+    {9770712828427831827ULL, 2, MOVE(62, 45, 0x0)},
+    {9770712828427831827ULL, 1, MOVE(53, 37, 0x1)},
+    {9774111025520886845ULL, 1, MOVE(5, 26, 0x0)},
+    {9777859573635561469ULL, 1, MOVE(49, 41, 0x0)},
+    {9777892005113345103ULL, 3, MOVE(5, 33, 0x0)},
+    {9793882217960587039ULL, 1, MOVE(3, 1, 0x2)},
+    {9795222854442232821ULL, 28, MOVE(59, 57, 0x2)},
+    {9795222854442232821ULL, 9, MOVE(52, 36, 0x1)},
+    {9798786589454190752ULL, 1, MOVE(42, 32, 0x0)},
+    {9799345702950957981ULL, 1, MOVE(25, 32, 0x0)},
+    {9801740033891154247ULL, 1, MOVE(4, 18, 0x4)},
+    {9804118428399689026ULL, 6, MOVE(27, 35, 0x0)},
+    {9804492220063593050ULL, 18, MOVE(30, 21, 0x4)},
+    {9804492220063593050ULL, 5, MOVE(30, 39, 0x0)},
+    {9807994137399993087ULL, 1, MOVE(13, 29, 0x1)},
+    {9823415812269941089ULL, 1, MOVE(61, 43, 0x0)},
+    {9823551212273571450ULL, 1, MOVE(25, 32, 0x0)},
+    {9825375448642822892ULL, 2, MOVE(55, 47, 0x0)},
+    {9828935509944683463ULL, 1, MOVE(52, 44, 0x0)},
+    {9829105923230151897ULL, 200, MOVE(9, 17, 0x0)},
+    {9829105923230151897ULL, 30, MOVE(6, 21, 0x0)},
+    {9829105923230151897ULL, 22, MOVE(15, 23, 0x0)},
+    {9829105923230151897ULL, 4, MOVE(11, 19, 0x0)},
+    {9829105923230151897ULL, 1, MOVE(5, 26, 0x0)},
+    {9832935274696900831ULL, 1, MOVE(12, 28, 0x1)},
+    {9838234650818906495ULL, 2, MOVE(1, 18, 0x0)},
+    {9838281706629585666ULL, 1, MOVE(5, 14, 0x0)},
+    {9839418138689436173ULL, 1, MOVE(61, 25, 0x0)},
+    {9840068184914441802ULL, 1, MOVE(51, 43, 0x0)},
+    {9844238094151158708ULL, 4, MOVE(2, 38, 0x0)},
+    {9844238094151158708ULL, 1, MOVE(8, 16, 0x0)},
+    {9844604606344174988ULL, 3, MOVE(5, 14, 0x0)},
+    {9845709079351953850ULL, 1, MOVE(53, 37, 0x1)},
+    {9848279537485177373ULL, 5, MOVE(27, 36, 0x4)},
+    {9861593963254953655ULL, 1, MOVE(4, 13, 0x0)},
+    {9865772571212174960ULL, 2, MOVE(6, 21, 0x0)},
+    {9866328628075937741ULL, 5, MOVE(53, 37, 0x1)},
+    {9866328628075937741ULL, 2, MOVE(55, 39, 0x1)},
+    {9867796225464216286ULL, 1, MOVE(50, 34, 0x1)},
+    {9867796225464216286ULL, 1, MOVE(62, 52, 0x0)},
+    {9871669691468267076ULL, 1, MOVE(1, 18, 0x0)},
+    {9875951870204157246ULL, 2, MOVE(1, 18, 0x0)},
+    {9875951870204157246ULL, 1, MOVE(28, 35, 0x4)},
+    {9881040520078436919ULL, 2, MOVE(5, 26, 0x0)},
+    {9881217482077102354ULL, 1, MOVE(4, 31, 0x0)},
+    {9883326733017715268ULL, 1, MOVE(24, 17, 0x0)},
+    {9891031653519057358ULL, 1, MOVE(61, 34, 0x0)},
+    {9893878534809863978ULL, 1, MOVE(57, 42, 0x0)},
+    {9897903941306362016ULL, 1, MOVE(5, 19, 0x0)},
+    {9907437771093545100ULL, 1, MOVE(2, 11, 0x0)},
+    {9908268964696375135ULL, 2, MOVE(6, 21, 0x0)},
+    {9908538507690039063ULL, 1, MOVE(57, 42, 0x0)},
+    {9914374742516261955ULL, 4, MOVE(11, 19, 0x0)},
+    {9917315240927512288ULL, 1, MOVE(6, 21, 0x0)},
+    {9917889939949577096ULL, 1, MOVE(4, 22, 0x0)},
+    {9919051515755670211ULL, 1, MOVE(27, 36, 0x4)},
+    {9920121575557290596ULL, 8, MOVE(2, 38, 0x0)},
+    {9920121575557290596ULL, 3, MOVE(1, 18, 0x0)},
+    {9920121575557290596ULL, 2, MOVE(10, 26, 0x1)},
+    {9920121575557290596ULL, 1, MOVE(1, 11, 0x0)},
+    {9920953626898096909ULL, 1, MOVE(57, 42, 0x0)},
+    {9921415127188313514ULL, 1, MOVE(9, 17, 0x0)},
+    {9924956994583157599ULL, 1, MOVE(27, 44, 0x0)},
+    {9927132291674351919ULL, 2, MOVE(2, 9, 0x0)},
+    {9927966217695942225ULL, 1, MOVE(58, 49, 0x0)},
+    {9930681686459555363ULL, 1, MOVE(18, 28, 0x4)},
+    {9936666770913411379ULL, 1, MOVE(52, 36, 0x1)},
+    {9939978112769882478ULL, 1, MOVE(1, 18, 0x0)},
+    {9941425419619847227ULL, 1, MOVE(1, 18, 0x0)},
+    {9941928836988309392ULL, 3, MOVE(62, 45, 0x0)},
+    {9941928836988309392ULL, 1, MOVE(52, 36, 0x1)},
+    {9952147762914645191ULL, 7, MOVE(60, 42, 0x0)},
+    {9952868833896974028ULL, 1, MOVE(51, 35, 0x1)},
+    {9954553460155283446ULL, 3, MOVE(13, 21, 0x0)},
+    {9954553460155283446ULL, 2, MOVE(8, 16, 0x0)},
+    {9955457206893660079ULL, 2, MOVE(2, 9, 0x0)},
+    {9957242614047002978ULL, 12, MOVE(21, 36, 0x0)},
+    {9957242614047002978ULL, 1, MOVE(1, 18, 0x0)},
+    {9965038357994096050ULL, 3, MOVE(55, 47, 0x0)},
+    {9968092597069882502ULL, 1, MOVE(58, 30, 0x0)},
+    {9969281635438771999ULL, 81, MOVE(6, 21, 0x0)},
+    {9969281635438771999ULL, 59, MOVE(1, 18, 0x0)},
+    {9969281635438771999ULL, 1, MOVE(29, 36, 0x4)},
+    {9970243289577470513ULL, 1, MOVE(58, 51, 0x0)},
+    {9970987918424216689ULL, 19, MOVE(37, 28, 0x4)},
+    {9975603925005967238ULL, 9, MOVE(61, 34, 0x0)},
+    {9975603925005967238ULL, 9, MOVE(61, 25, 0x0)},
+    {9975603925005967238ULL, 1, MOVE(49, 41, 0x0)},
+    {9976119709407693894ULL, 1, MOVE(14, 21, 0x4)},
+    {9976399992468034644ULL, 17, MOVE(1, 18, 0x0)},
+    {9986732514127811056ULL, 1, MOVE(55, 47, 0x0)},
+    {9987456692984017204ULL, 1, MOVE(52, 44, 0x0)},
+    {9994094141098002072ULL, 4, MOVE(51, 43, 0x0)},
+    {9994094141098002072ULL, 1, MOVE(57, 42, 0x0)},
+    {9994094141098002072ULL, 1, MOVE(55, 47, 0x0)},
+    {9994668565250281806ULL, 1, MOVE(6, 21, 0x0)},
+    {9995142488888414273ULL, 1, MOVE(58, 49, 0x0)},
+    {10009702127990462865ULL, 1, MOVE(60, 46, 0x0)},
+    {10010269448306746439ULL, 1, MOVE(58, 49, 0x0)},
+    {10012751652114958081ULL, 46, MOVE(48, 40, 0x0)},
+    {10012751652114958081ULL, 8, MOVE(59, 57, 0x2)},
+    {10012751652114958081ULL, 2, MOVE(62, 52, 0x0)},
+    {10023140576107619725ULL, 2, MOVE(42, 36, 0x4)},
+    {10025382352593648631ULL, 7, MOVE(48, 32, 0x1)},
+    {10025382352593648631ULL, 1, MOVE(48, 40, 0x0)},
+    {10035563739324593827ULL, 1, MOVE(58, 49, 0x0)},
+    {10043568051984666171ULL, 27, MOVE(5, 12, 0x0)},
+    {10043568051984666171ULL, 9, MOVE(6, 12, 0x0)},
+    {10043584367905501670ULL, 1, MOVE(43, 35, 0x0)},
+    {10045509492647265925ULL, 1, MOVE(37, 51, 0x0)},
+    {10048144260725207770ULL, 2, MOVE(18, 28, 0x4)},
+    {10048159195367972858ULL, 3, MOVE(58, 49, 0x0)},
+    {10063191438050824045ULL, 1, MOVE(5, 33, 0x0)},
+    {10073660279682940313ULL, 1, MOVE(36, 28, 0x0)},
+    {10075192261137697989ULL, 4, MOVE(2, 9, 0x0)},
+    {10091499456736254132ULL, 2, MOVE(25, 32, 0x0)},
+    {10093040266006802083ULL, 40, MOVE(2, 9, 0x0)},
+    {10094493505524731572ULL, 1, MOVE(61, 34, 0x4)},
+    {10097232864235156991ULL, 1, MOVE(57, 42, 0x0)},
+    {10098017608344450908ULL, 1, MOVE(30, 51, 0x0)},
+    {10100742339833871137ULL, 3, MOVE(57, 42, 0x0)},
+    {10108691043913349969ULL, 104, MOVE(36, 21, 0x4)},
+    {10110280200755823749ULL, 1, MOVE(2, 9, 0x0)},
+    {10112500969059324140ULL, 1, MOVE(36, 29, 0x4)},
+    {10113385522770992919ULL, 2, MOVE(6, 12, 0x0)},
+    {10113385522770992919ULL, 2, MOVE(28, 37, 0x4)},
+    {10124210662019022835ULL, 3, MOVE(1, 18, 0x0)},
+    {10124210662019022835ULL, 1, MOVE(2, 38, 0x0)},
+    {10125303107540134921ULL, 1, MOVE(59, 57, 0x2)},
+    {10125303107540134921ULL, 1, MOVE(52, 44, 0x0)},
+    {10126947271593361913ULL, 2, MOVE(6, 21, 0x4)},
+    {10145484552411941822ULL, 1, MOVE(53, 45, 0x0)},
+    {10169313781915817832ULL, 1, MOVE(2, 29, 0x0)},
+    {10172808026173050809ULL, 5, MOVE(59, 57, 0x2)},
+    {10172808026173050809ULL, 1, MOVE(36, 29, 0x4)},
+    {10174218304895669824ULL, 1, MOVE(58, 30, 0x0)},
+    {10184854780396745662ULL, 2, MOVE(52, 36, 0x1)},
+    {10184854780396745662ULL, 1, MOVE(53, 37, 0x1)},
+    {10193931810482912213ULL, 2, MOVE(12, 20, 0x0)},
+    {10198375359209752128ULL, 7, MOVE(2, 9, 0x0)},
+    {10198375359209752128ULL, 5, MOVE(1, 18, 0x0)},
+    {10201605747596130334ULL, 3, MOVE(52, 44, 0x0)},
+    {10202916978351341277ULL, 2, MOVE(60, 39, 0x0)},
+    {10204072588020062352ULL, 1, MOVE(6, 21, 0x0)},
+    {10207497352283568154ULL, 1, MOVE(28, 36, 0x0)},
+    {10213499708642959782ULL, 1, MOVE(52, 44, 0x0)},
+    {10215704189166924173ULL, 1, MOVE(62, 45, 0x0)},
+    {10225626838490766239ULL, 1, MOVE(53, 37, 0x1)},
+    {10229544222541881384ULL, 9, MOVE(36, 21, 0x4)},
+    {10231223605290625048ULL, 2, MOVE(57, 42, 0x0)},
+    {10231223605290625048ULL, 2, MOVE(61, 25, 0x0)},
+    {10231223605290625048ULL, 2, MOVE(49, 41, 0x0)},
+    {10231223605290625048ULL, 1, MOVE(36, 29, 0x4)},
+    {10232516574562256036ULL, 3, MOVE(53, 45, 0x0)},
+    {10232516574562256036ULL, 3, MOVE(51, 43, 0x0)},
+    {10232516574562256036ULL, 1, MOVE(49, 41, 0x0)},
+    {10233660860751628317ULL, 1, MOVE(57, 42, 0x0)},
+    {10236836987246049810ULL, 1, MOVE(2, 20, 0x0)},
+    {10237110102514378008ULL, 1, MOVE(49, 41, 0x0)},
+    {10243169323347454696ULL, 1, MOVE(3, 1, 0x2)},
+    {10243189234603087391ULL, 2, MOVE(52, 36, 0x1)},
+    {10244116026888229872ULL, 1, MOVE(6, 21, 0x0)},
+    {10244293071065420438ULL, 1, MOVE(9, 17, 0x0)},
+    {10246545488374935870ULL, 1, MOVE(48, 40, 0x0)},
+    {10250122215513434190ULL, 1, MOVE(49, 41, 0x0)},
+    {10255980655205209990ULL, 5, MOVE(52, 44, 0x0)},
+    {10255980655205209990ULL, 1, MOVE(59, 57, 0x2)},
+    {10257129069726795371ULL, 47, MOVE(6, 21, 0x0)},
+    {10257129069726795371ULL, 16, MOVE(9, 17, 0x0)},
+    {10257129069726795371ULL, 16, MOVE(1, 18, 0x0)},
+    {10257129069726795371ULL, 4, MOVE(12, 28, 0x1)},
+    {10258500671986593961ULL, 3, MOVE(9, 17, 0x0)},
+    {10267711863099617736ULL, 1, MOVE(13, 29, 0x1)},
+    {10279891813135870892ULL, 15, MOVE(58, 30, 0x0)},
+    {10279891813135870892ULL, 15, MOVE(61, 54, 0x0)},
+    {10280122802349018219ULL, 1, MOVE(53, 45, 0x0)},
+    {10282648441748663563ULL, 9, MOVE(27, 42, 0x4)},
+    {10287379299939105506ULL, 1, MOVE(6, 21, 0x0)},
+    {10288318382648746910ULL, 1, MOVE(34, 41, 0x0)},
+    {10289342357699508150ULL, 1, MOVE(50, 34, 0x1)},
+    {10289342357699508150ULL, 1, MOVE(54, 38, 0x1)},
+    {10289342357699508150ULL, 1, MOVE(53, 37, 0x1)},
+    {10293055162037823311ULL, 2, MOVE(18, 28, 0x4)},
+    {10293055162037823311ULL, 1, MOVE(9, 17, 0x0)},
+    {10293064112923318870ULL, 1, MOVE(58, 49, 0x0)},
+    {10293064112923318870ULL, 1, MOVE(52, 36, 0x1)},
+    {10302979330328154136ULL, 1, MOVE(4, 31, 0x0)},
+    {10302979330328154136ULL, 1, MOVE(2, 9, 0x0)},
+    {10305955842787404696ULL, 1, MOVE(4, 28, 0x4)},
+    {10310835337459187819ULL, 1, MOVE(42, 36, 0x4)},
+    {10311511755149628430ULL, 1, MOVE(6, 21, 0x0)},
+    {10312605320040851985ULL, 12, MOVE(2, 9, 0x0)},
+    {10315618396822137786ULL, 1, MOVE(37, 46, 0x0)},
+    {10316855326288547454ULL, 1, MOVE(2, 9, 0x0)},
+    {10316887188644861750ULL, 1, MOVE(57, 42, 0x0)},
+    {10316887188644861750ULL, 1, MOVE(51, 35, 0x1)},
+    {10318945034709608661ULL, 1, MOVE(58, 44, 0x0)},
+    {10320925982692753011ULL, 5, MOVE(58, 49, 0x0)},
+    {10328723259939760828ULL, 1, MOVE(2, 9, 0x0)},
+    {10331459553381165467ULL, 582, MOVE(52, 44, 0x0)},
+    {10331459553381165467ULL, 296, MOVE(62, 45, 0x0)},
+    {10331459553381165467ULL, 223, MOVE(51, 43, 0x0)},
+    {10331459553381165467ULL, 18, MOVE(49, 41, 0x0)},
+    {10331459553381165467ULL, 3, MOVE(57, 42, 0x0)},
+    {10331459553381165467ULL, 3, MOVE(55, 47, 0x0)},
+    {10331459553381165467ULL, 1, MOVE(54, 46, 0x0)},
+    {10342381966893010432ULL, 3, MOVE(50, 34, 0x1)},
+    {10342381966893010432ULL, 3, MOVE(58, 49, 0x0)},
+    {10342471815169613874ULL, 1, MOVE(59, 57, 0x2)},
+    {10343384054175991871ULL, 1, MOVE(57, 42, 0x0)},
+    {10351403748523574585ULL, 1, MOVE(1, 18, 0x0)},
+    {10351403748523574585ULL, 1, MOVE(5, 33, 0x0)},
+    {10355716047744642808ULL, 4, MOVE(57, 42, 0x0)},
+    {10355716047744642808ULL, 3, MOVE(50, 34, 0x1)},
+    {10355716047744642808ULL, 1, MOVE(58, 37, 0x0)},
+    {10355716047744642808ULL, 1, MOVE(49, 41, 0x0)},
+    {10359386759467447352ULL, 2, MOVE(53, 45, 0x0)},
+    {10364255661490601026ULL, 15, MOVE(52, 36, 0x1)},
+    {10364255661490601026ULL, 4, MOVE(49, 41, 0x0)},
+    {10364255661490601026ULL, 1, MOVE(51, 43, 0x0)},
+    {10364255661490601026ULL, 1, MOVE(52, 44, 0x0)},
+    {10374223023285144212ULL, 1, MOVE(42, 36, 0x4)},
+    {10376842152009751076ULL, 9, MOVE(57, 42, 0x0)},
+    {10377471589249771234ULL, 1, MOVE(53, 45, 0x0)},
+    {10381385124365134859ULL, 6, MOVE(1, 18, 0x0)},
+    {10385932457051632280ULL, 2, MOVE(52, 44, 0x0)},
+    {10400805827133179929ULL, 1, MOVE(45, 28, 0x4)},
+    {10406819251234175889ULL, 22, MOVE(58, 49, 0x0)},
+    {10413869897127853558ULL, 1, MOVE(12, 28, 0x1)},
+    {10422262334597772738ULL, 1, MOVE(49, 41, 0x0)},
+    {10423522414836861079ULL, 1, MOVE(58, 49, 0x0)},
+    {10427870678268969328ULL, 1, MOVE(52, 36, 0x1)},
+    {10428603308154157834ULL, 1, MOVE(37, 28, 0x4)},
+    {10434380230358141736ULL, 2, MOVE(53, 45, 0x0)},
+    {10444527169228465763ULL, 6, MOVE(38, 47, 0x4)},
+    {10444527169228465763ULL, 4, MOVE(11, 19, 0x0)},
+    {10444527169228465763ULL, 2, MOVE(38, 46, 0x0)},
+    {10445272589269613096ULL, 1, MOVE(58, 49, 0x0)},
+    {10446376483992331032ULL, 15, MOVE(58, 49, 0x0)},
+    {10452654442985766426ULL, 2, MOVE(45, 28, 0x0)},
+    {10453948261377118264ULL, 1, MOVE(52, 44, 0x0)},
+    {10455944315109352881ULL, 2, MOVE(49, 41, 0x0)},
+    {10455944315109352881ULL, 1, MOVE(52, 44, 0x0)},
+    {10458022244611372125ULL, 1, MOVE(58, 49, 0x0)},
+    {10467889871248275274ULL, 3, MOVE(11, 27, 0x1)},
+    {10469710936235917113ULL, 1, MOVE(61, 52, 0x0)},
+    {10475042040070915665ULL, 1, MOVE(9, 17, 0x0)},
+    {10479348692070160747ULL, 1, MOVE(61, 47, 0x0)},
+    {10480159902483854827ULL, 1, MOVE(58, 30, 0x0)},
+    {10485343718699915853ULL, 4, MOVE(18, 28, 0x0)},
+    {10497149760021827218ULL, 1, MOVE(53, 37, 0x1)},
+    {10498051552615419431ULL, 7, MOVE(2, 9, 0x0)},
+    {10501159566554330769ULL, 1, MOVE(52, 36, 0x1)},
+    {10501170017635283500ULL, 2, MOVE(53, 37, 0x1)},
+    {10501170017635283500ULL, 1, MOVE(57, 42, 0x0)},
+    {10501170017635283500ULL, 1, MOVE(50, 34, 0x1)},
+    {10501357603794894182ULL, 1, MOVE(1, 18, 0x0)},
+    {10528359510154954085ULL, 1, MOVE(12, 28, 0x1)},
+    {10531215677618469210ULL, 1, MOVE(62, 45, 0x0)},
+    {10535983201947474063ULL, 1, MOVE(59, 57, 0x2)},
+    {10536147997559663440ULL, 2, MOVE(25, 18, 0x4)},
+    {10542793233048681832ULL, 1, MOVE(6, 21, 0x0)},
+    {10544030749811920538ULL, 1, MOVE(2, 9, 0x0)},
+    {10545336015550013711ULL, 23, MOVE(2, 9, 0x0)},
+    {10545336015550013711ULL, 9, MOVE(1, 18, 0x0)},
+    {10545344780971900685ULL, 39, MOVE(42, 36, 0x4)},
+    {10556237788187991416ULL, 28, MOVE(28, 36, 0x0)},
+    {10556237788187991416ULL, 3, MOVE(11, 19, 0x0)},
+    {10556237788187991416ULL, 1, MOVE(6, 21, 0x0)},
+    {10559193035749965307ULL, 1, MOVE(2, 9, 0x0)},
+    {10562113108548526183ULL, 1, MOVE(30, 21, 0x4)},
+    {10563597401517293534ULL, 3, MOVE(4, 13, 0x0)},
+    {10563597401517293534ULL, 2, MOVE(9, 17, 0x0)},
+    {10563597401517293534ULL, 1, MOVE(12, 28, 0x1)},
+    {10567234733280494159ULL, 1, MOVE(49, 41, 0x0)},
+    {10567234733280494159ULL, 1, MOVE(52, 44, 0x0)},
+    {10584405031101718194ULL, 2, MOVE(62, 52, 0x0)},
+    {10584405031101718194ULL, 1, MOVE(49, 41, 0x0)},
+    {10586808458295039916ULL, 27, MOVE(57, 42, 0x0)},
+    {10591965684681029931ULL, 1, MOVE(6, 21, 0x0)},
+    {10592231325407589072ULL, 1, MOVE(62, 52, 0x0)},
+    {10592231325407589072ULL, 1, MOVE(59, 57, 0x2)},
+    {10596548895527182865ULL, 1, MOVE(33, 24, 0x0)},
+    {10599662912583544571ULL, 12, MOVE(1, 18, 0x0)},
+    {10599662912583544571ULL, 2, MOVE(4, 31, 0x0)},
+    {10599938887266460788ULL, 1, MOVE(6, 21, 0x0)},
+    {10602114425754669417ULL, 1, MOVE(28, 19, 0x0)},
+    {10604165298643732127ULL, 1, MOVE(6, 21, 0x0)},
+    {10604165298643732127ULL, 1, MOVE(13, 21, 0x0)},
+    {10604165298643732127ULL, 1, MOVE(13, 29, 0x1)},
+    {10604165298643732127ULL, 1, MOVE(28, 37, 0x4)},
+    {10604510914748698550ULL, 1, MOVE(51, 43, 0x0)},
+    {10611652356716532963ULL, 346, MOVE(57, 42, 0x0)},
+    {10611652356716532963ULL, 5, MOVE(51, 43, 0x0)},
+    {10614126628105346882ULL, 1, MOVE(35, 28, 0x4)},
+    {10614944971890586443ULL, 1, MOVE(6, 21, 0x0)},
+    {10614944971890586443ULL, 1, MOVE(13, 21, 0x0)},
+    {10615626035952050941ULL, 1, MOVE(61, 54, 0x0)},
+    {10616802043192185757ULL, 1, MOVE(4, 31, 0x0)},
+    {10616802043192185757ULL, 1, MOVE(6, 23, 0x0)},
+    {10621945747604513276ULL, 1, MOVE(52, 36, 0x1)},
+    {10625060565898749570ULL, 1, MOVE(53, 37, 0x1)},
+    {10625060565898749570ULL, 1, MOVE(52, 44, 0x0)},
+    {10637443691682725580ULL, 9, MOVE(11, 19, 0x0)},
+    {10638464564107361517ULL, 429, MOVE(58, 51, 0x0)},
+    {10638464564107361517ULL, 65, MOVE(54, 38, 0x1)},
+    {10638464564107361517ULL, 54, MOVE(42, 27, 0x4)},
+    {10638464564107361517ULL, 16, MOVE(58, 37, 0x0)},
+    {10638464564107361517ULL, 2, MOVE(52, 44, 0x0)},
+    {10649162693161033211ULL, 4, MOVE(58, 49, 0x0)},
+    {10652168487226706053ULL, 1, MOVE(58, 49, 0x0)},
+    {10653774156151461578ULL, 13, MOVE(1, 18, 0x0)},
+    {10654846987309365678ULL, 1, MOVE(2, 9, 0x0)},
+    {10656492705057054683ULL, 1, MOVE(2, 9, 0x0)},
+    {10657927755384760386ULL, 1, MOVE(52, 44, 0x0)},
+    {10660438889997188431ULL, 1, MOVE(58, 44, 0x0)},
+    {10661214832370973075ULL, 1, MOVE(35, 28, 0x4)},
+    {10664283175428672640ULL, 1, MOVE(52, 44, 0x0)},
+    {10664283175428672640ULL, 1, MOVE(58, 49, 0x0)},
+    {10670303278068059726ULL, 1, MOVE(57, 42, 0x0)},
+    {10670451292426932216ULL, 5, MOVE(51, 43, 0x0)},
+    {10670451292426932216ULL, 1, MOVE(61, 25, 0x0)},
+    {10681212387779320195ULL, 3, MOVE(62, 45, 0x0)},
+    {10684235014474824364ULL, 1, MOVE(11, 19, 0x0)},
+    {10685981777156373837ULL, 1, MOVE(34, 25, 0x0)},
+    {10691630341856229967ULL, 1, MOVE(61, 25, 0x0)},
+    {10694357595669269835ULL, 9, MOVE(2, 29, 0x4)},
+    {10713961083583451948ULL, 9, MOVE(49, 42, 0x4)},
+    {10715594497285721793ULL, 1, MOVE(51, 43, 0x0)},
+    {10716913298786750822ULL, 1, MOVE(57, 51, 0x0)},
+    {10717086832268720640ULL, 2, MOVE(3, 1, 0x2)},
+    {10718471270559768394ULL, 2, MOVE(14, 21, 0x4)},
+    {10722375475619450329ULL, 11, MOVE(58, 30, 0x0)},
+    {10722375475619450329ULL, 3, MOVE(52, 36, 0x1)},
+    {10722546617560292181ULL, 1, MOVE(54, 46, 0x0)},
+    {10722546617560292181ULL, 1, MOVE(59, 57, 0x2)},
+    {10722899401987875133ULL, 1, MOVE(11, 19, 0x0)},
+    {10723772379056411686ULL, 2, MOVE(30, 21, 0x4)},
+    {10725821284904217232ULL, 3, MOVE(59, 57, 0x2)},
+    {10731432818401490417ULL, 1, MOVE(1, 11, 0x0)},
+    {10731432818401490417ULL, 1, MOVE(28, 36, 0x0)},
+    {10741150533465332926ULL, 16, MOVE(55, 47, 0x0)},
+    {10743518969449421535ULL, 2, MOVE(62, 52, 0x0)},
+    {10743518969449421535ULL, 1, MOVE(58, 51, 0x0)},
+    {10746152264969777630ULL, 1, MOVE(6, 21, 0x0)},
+    {10754466456382117973ULL, 2, MOVE(36, 27, 0x4)},
+    {10754466456382117973ULL, 1, MOVE(57, 42, 0x0)},
+    {10758381565394943214ULL, 18, MOVE(30, 21, 0x4)},
+    {10762195255169343249ULL, 6, MOVE(58, 49, 0x0)},
+    {10762195255169343249ULL, 2, MOVE(61, 43, 0x0)},
+    {10769085544516845782ULL, 86, MOVE(11, 19, 0x0)},
+    {10769085544516845782ULL, 66, MOVE(1, 18, 0x0)},
+    {10769085544516845782ULL, 4, MOVE(29, 36, 0x4)},
+    {10779614103892708249ULL, 8, MOVE(13, 29, 0x1)},
+    {10779614103892708249ULL, 1, MOVE(9, 17, 0x0)},
+    {10779659396067183830ULL, 1, MOVE(53, 37, 0x1)},
+    {10779998226719959145ULL, 1, MOVE(53, 45, 0x0)},
+    {10783425967204384441ULL, 82, MOVE(15, 31, 0x1)},
+    {10783425967204384441ULL, 1, MOVE(11, 27, 0x1)},
+    {10785035394108415810ULL, 4, MOVE(57, 42, 0x0)},
+    {10814050660054559519ULL, 1, MOVE(44, 36, 0x0)},
+    {10815366673686397951ULL, 1, MOVE(51, 43, 0x0)},
+    {10816217084266649711ULL, 1, MOVE(59, 57, 0x2)},
+    {10819925966828592847ULL, 1, MOVE(12, 28, 0x1)},
+    {10822685812928616352ULL, 1, MOVE(13, 29, 0x1)},
+    {10822695363883662631ULL, 2, MOVE(51, 43, 0x0)},
+    {10822695363883662631ULL, 2, MOVE(61, 34, 0x0)},
+    {10822695363883662631ULL, 1, MOVE(61, 25, 0x0)},
+    {10822695363883662631ULL, 1, MOVE(60, 46, 0x0)},
+    {10825393252843202608ULL, 2, MOVE(51, 35, 0x1)},
+    {10825393252843202608ULL, 1, MOVE(36, 28, 0x0)},
+    {10830743459261025029ULL, 1, MOVE(3, 1, 0x2)},
+    {10835601232652587899ULL, 1, MOVE(59, 57, 0x2)},
+    {10836537231942177106ULL, 1, MOVE(58, 30, 0x0)},
+    {10836903598385050042ULL, 1, MOVE(52, 44, 0x0)},
+    {10839752716759571801ULL, 1, MOVE(27, 35, 0x0)},
+    {10857224851901848540ULL, 1, MOVE(13, 29, 0x1)},
+    {10867419332723121473ULL, 2, MOVE(1, 18, 0x0)},
+    {10867419332723121473ULL, 2, MOVE(6, 21, 0x0)},
+    {10869508991817435374ULL, 1, MOVE(42, 36, 0x4)},
+    {10870327730388063012ULL, 1, MOVE(61, 34, 0x0)},
+    {10870327730388063012ULL, 1, MOVE(61, 25, 0x0)},
+    {10881042994673137523ULL, 1, MOVE(53, 37, 0x1)},
+    {10881042994673137523ULL, 1, MOVE(59, 57, 0x2)},
+    {10882245471034770558ULL, 2, MOVE(6, 21, 0x0)},
+    {10890416690863827587ULL, 2, MOVE(58, 51, 0x0)},
+    {10890416690863827587ULL, 1, MOVE(52, 36, 0x1)},
+    {10891714806054268248ULL, 1, MOVE(38, 52, 0x4)},
+    {10893604662109916888ULL, 1, MOVE(54, 38, 0x1)},
+    {10895887300347390449ULL, 2, MOVE(62, 45, 0x0)},
+    {10904033896098691255ULL, 1, MOVE(53, 37, 0x1)},
+    {10906808590339188965ULL, 1, MOVE(62, 45, 0x0)},
+    {10907661118049216360ULL, 3, MOVE(1, 18, 0x0)},
+    {10909025710599414903ULL, 1, MOVE(58, 49, 0x0)},
+    {10927591739302886766ULL, 3, MOVE(53, 45, 0x0)},
+    {10929289742768591571ULL, 1, MOVE(51, 43, 0x0)},
+    {10929847423272114306ULL, 1, MOVE(2, 29, 0x0)},
+    {10935952384765419100ULL, 1, MOVE(45, 35, 0x0)},
+    {10938883588015284162ULL, 1, MOVE(49, 41, 0x0)},
+    {10952697430594757534ULL, 1, MOVE(55, 47, 0x0)},
+    {10954363195010390302ULL, 4, MOVE(62, 52, 0x0)},
+    {10959136273208966377ULL, 1, MOVE(12, 20, 0x0)},
+    {10971797325564283718ULL, 2, MOVE(49, 41, 0x0)},
+    {10972059542153044357ULL, 1, MOVE(9, 17, 0x0)},
+    {10972059542153044357ULL, 1, MOVE(8, 16, 0x0)},
+    {10976933457086256145ULL, 1, MOVE(1, 18, 0x0)},
+    {10984502004922594587ULL, 1, MOVE(58, 49, 0x0)},
+    {10988119111600370586ULL, 1, MOVE(36, 29, 0x4)},
+    {10990561595723709236ULL, 7, MOVE(12, 28, 0x1)},
+    {11017586699975469576ULL, 2, MOVE(2, 9, 0x0)},
+    {11018936152478258673ULL, 2, MOVE(55, 47, 0x0)},
+    {11025748936900684007ULL, 2, MOVE(60, 46, 0x0)},
+    {11027359633715201247ULL, 1, MOVE(52, 36, 0x1)},
+    {11032259002416654264ULL, 15, MOVE(43, 36, 0x4)},
+    {11035919610801287067ULL, 3, MOVE(60, 39, 0x0)},
+    {11040382940387566686ULL, 1, MOVE(12, 28, 0x1)},
+    {11040825155321494194ULL, 1, MOVE(15, 23, 0x0)},
+    {11046124094087346556ULL, 2, MOVE(54, 38, 0x1)},
+    {11046124094087346556ULL, 2, MOVE(58, 49, 0x0)},
+    {11048088471440869085ULL, 1, MOVE(58, 49, 0x0)},
+    {11048088471440869085ULL, 1, MOVE(52, 44, 0x0)},
+    {11048650874918221550ULL, 20, MOVE(59, 57, 0x2)},
+    {11049801842578934555ULL, 1, MOVE(2, 29, 0x4)},
+    {11050227760932339762ULL, 5, MOVE(58, 51, 0x0)},
+    {11050227760932339762ULL, 1, MOVE(57, 42, 0x0)},
+    {11050227760932339762ULL, 1, MOVE(54, 46, 0x0)},
+    {11055582096299353930ULL, 1, MOVE(6, 21, 0x0)},
+    {11056931898895136148ULL, 1, MOVE(9, 17, 0x0)},
+    {11058678876748203933ULL, 2, MOVE(2, 20, 0x0)},
+    {11060575574778517123ULL, 1, MOVE(42, 25, 0x0)},
+    {11070070598919302487ULL, 88, MOVE(58, 49, 0x0)},
+    {11076711113738808353ULL, 4, MOVE(62, 45, 0x0)},
+    {11077166674686471019ULL, 1, MOVE(6, 21, 0x0)},
+    {11079445535311951363ULL, 3, MOVE(62, 45, 0x0)},
+    {11081432967022332892ULL, 5, MOVE(52, 44, 0x0)},
+    {11090655963914603170ULL, 1, MOVE(55, 47, 0x0)},
+    {11091797539611590023ULL, 9, MOVE(52, 36, 0x1)},
+    {11091797539611590023ULL, 5, MOVE(49, 41, 0x0)},
+    {11091797539611590023ULL, 4, MOVE(53, 37, 0x1)},
+    {11091797539611590023ULL, 2, MOVE(51, 43, 0x0)},
+    {11091797539611590023ULL, 1, MOVE(54, 46, 0x0)},
+    {11092304562866076695ULL, 2, MOVE(57, 42, 0x0)},
+    {11092304562866076695ULL, 1, MOVE(36, 29, 0x4)},
+    {11092478349946713888ULL, 48, MOVE(38, 45, 0x4)},
+    {11092478349946713888ULL, 37, MOVE(13, 21, 0x0)},
+    {11092478349946713888ULL, 12, MOVE(3, 1, 0x2)},
+    {11092478349946713888ULL, 8, MOVE(6, 12, 0x0)},
+    {11092478349946713888ULL, 5, MOVE(6, 21, 0x0)},
+    {11092478349946713888ULL, 2, MOVE(38, 31, 0x0)},
+    {11094558197747572915ULL, 4, MOVE(3, 1, 0x2)},
+    {11094558197747572915ULL, 1, MOVE(13, 29, 0x1)},
+    {11095128004004694589ULL, 2, MOVE(15, 23, 0x0)},
+    {11096263494011468360ULL, 1, MOVE(51, 35, 0x1)},
+    {11100349786942314973ULL, 7, MOVE(11, 19, 0x0)},
+    {11100349786942314973ULL, 1, MOVE(11, 27, 0x1)},
+    {11106906716939014875ULL, 2, MOVE(4, 28, 0x4)},
+    {11114685190635804084ULL, 6, MOVE(36, 29, 0x4)},
+    {11114685190635804084ULL, 1, MOVE(58, 30, 0x0)},
+    {11116699351601477930ULL, 1, MOVE(58, 49, 0x0)},
+    {11118614517342831262ULL, 2, MOVE(37, 28, 0x4)},
+    {11120251933870579658ULL, 2, MOVE(57, 42, 0x0)},
+    {11120251933870579658ULL, 1, MOVE(62, 52, 0x0)},
+    {11122962306203757051ULL, 4, MOVE(58, 49, 0x0)},
+    {11129242678913131736ULL, 1, MOVE(53, 37, 0x1)},
+    {11133516130806577752ULL, 1, MOVE(53, 45, 0x0)},
+    {11140054374450687746ULL, 2, MOVE(15, 23, 0x0)},
+    {11140054374450687746ULL, 1, MOVE(11, 19, 0x0)},
+    {11142467033247927999ULL, 1, MOVE(49, 41, 0x0)},
+    {11142467033247927999ULL, 1, MOVE(52, 36, 0x1)},
+    {11150419038426781978ULL, 1, MOVE(12, 20, 0x0)},
+    {11150782996442341653ULL, 1, MOVE(11, 19, 0x0)},
+    {11152061674626706547ULL, 1, MOVE(5, 14, 0x0)},
+    {11154749178147782672ULL, 10, MOVE(57, 42, 0x0)},
+    {11154749178147782672ULL, 1, MOVE(50, 34, 0x1)},
+    {11162384367497173163ULL, 2, MOVE(51, 35, 0x1)},
+    {11162384367497173163ULL, 2, MOVE(62, 45, 0x0)},
+    {11163913471918363646ULL, 1, MOVE(42, 36, 0x4)},
+    {11164015105271174732ULL, 1, MOVE(62, 45, 0x0)},
+    {11164015105271174732ULL, 1, MOVE(37, 28, 0x4)},
+    {11170621022964906246ULL, 1, MOVE(59, 57, 0x2)},
+    {11179529604321537606ULL, 2, MOVE(49, 42, 0x4)},
+    {11186767313689477381ULL, 2, MOVE(53, 37, 0x1)},
+    {11186767313689477381ULL, 1, MOVE(48, 40, 0x0)},
+    {11189629478988510620ULL, 1, MOVE(1, 18, 0x0)},
+    {11198330765029071558ULL, 1, MOVE(62, 45, 0x0)},
+    {11198330765029071558ULL, 1, MOVE(30, 44, 0x0)},
+    {11203613255893316790ULL, 2, MOVE(2, 9, 0x0)},
+    {11208045346968085271ULL, 12, MOVE(58, 51, 0x0)},
+    {11208045346968085271ULL, 6, MOVE(58, 30, 0x0)},
+    {11208045346968085271ULL, 3, MOVE(53, 45, 0x0)},
+    {11208045346968085271ULL, 2, MOVE(36, 29, 0x4)},
+    {11208045346968085271ULL, 2, MOVE(62, 52, 0x0)},
+    {11208045346968085271ULL, 1, MOVE(53, 37, 0x1)},
+    {11212446220642591057ULL, 2, MOVE(28, 37, 0x4)},
+    {11214941578300297656ULL, 1772, MOVE(13, 29, 0x1)},
+    {11214941578300297656ULL, 164, MOVE(1, 18, 0x0)},
+    {11214941578300297656ULL, 28, MOVE(5, 33, 0x0)},
+    {11214941578300297656ULL, 21, MOVE(5, 26, 0x0)},
+    {11214941578300297656ULL, 7, MOVE(6, 21, 0x0)},
+    {11214941578300297656ULL, 4, MOVE(9, 17, 0x0)},
+    {11214941578300297656ULL, 3, MOVE(13, 21, 0x0)},
+    {11217326970563561046ULL, 1, MOVE(2, 9, 0x0)},
+    {11218372797223840894ULL, 1, MOVE(3, 1, 0x2)},
+    {11220859364363063721ULL, 1, MOVE(25, 18, 0x4)},
+    {11227514905063245032ULL, 1, MOVE(6, 21, 0x0)},
+    {11234064057812682911ULL, 1, MOVE(18, 28, 0x4)},
+    {11239871655048690443ULL, 1, MOVE(2, 20, 0x0)},
+    {11240875917165806144ULL, 1, MOVE(12, 20, 0x0)},
+    {11241367456505373593ULL, 6, MOVE(3, 1, 0x2)},
+    {11241367456505373593ULL, 1, MOVE(12, 28, 0x1)},
+    {11241367456505373593ULL, 1, MOVE(13, 29, 0x1)},
+    {11243961568369571377ULL, 1, MOVE(57, 42, 0x0)},
+    {11249441732865067336ULL, 1, MOVE(53, 37, 0x1)},
+    {11249441732865067336ULL, 1, MOVE(51, 43, 0x0)},
+    {11250468789413619888ULL, 25, MOVE(2, 9, 0x0)},
+    {11250468789413619888ULL, 3, MOVE(13, 29, 0x1)},
+    {11253518479063074997ULL, 1, MOVE(58, 49, 0x0)},
+    {11255343805995882354ULL, 1, MOVE(1, 18, 0x0)},
+    {11257056199598656161ULL, 2, MOVE(42, 52, 0x0)},
+    {11265929304516735724ULL, 1, MOVE(57, 42, 0x0)},
+    {11269861284407551678ULL, 1, MOVE(6, 21, 0x0)},
+    {11273556764671010133ULL, 1, MOVE(53, 45, 0x0)},
+    {11277006107114141934ULL, 1, MOVE(48, 40, 0x0)},
+    {11278369125315000038ULL, 1, MOVE(12, 28, 0x1)},
+    {11280399377595275433ULL, 1, MOVE(48, 40, 0x0)},
+    {11280962454691932597ULL, 2, MOVE(57, 42, 0x0)},
+    {11283067654365381020ULL, 1, MOVE(54, 38, 0x1)},
+    {11284108459412079929ULL, 13, MOVE(51, 43, 0x0)},
+    {11284174284759867902ULL, 9, MOVE(51, 43, 0x0)},
+    {11284174284759867902ULL, 4, MOVE(49, 41, 0x0)},
+    {11284174284759867902ULL, 4, MOVE(55, 47, 0x0)},
+    {11284174284759867902ULL, 1, MOVE(62, 52, 0x0)},
+    {11287811900801337488ULL, 1, MOVE(58, 49, 0x0)},
+    {11290673698745817799ULL, 2, MOVE(13, 29, 0x1)},
+    {11292850865593852679ULL, 1, MOVE(27, 35, 0x0)},
+    {11296161444605296414ULL, 1, MOVE(2, 20, 0x0)},
+    {11303167849764649402ULL, 1, MOVE(5, 14, 0x0)},
+    {11309474048251305278ULL, 1, MOVE(61, 54, 0x0)},
+    {11314503528844194739ULL, 1, MOVE(1, 18, 0x0)},
+    {11314503528844194739ULL, 1, MOVE(5, 19, 0x0)},
+    {11315272744901924059ULL, 1, MOVE(30, 21, 0x4)},
+    {11316460293833947899ULL, 15, MOVE(6, 21, 0x0)},
+    {11316460293833947899ULL, 3, MOVE(5, 26, 0x0)},
+    {11319135651798731299ULL, 2, MOVE(13, 21, 0x0)},
+    {11326467469624039402ULL, 1, MOVE(1, 18, 0x0)},
+    {11328722041305251250ULL, 1, MOVE(59, 57, 0x2)},
+    {11332978746731708037ULL, 8, MOVE(1, 18, 0x0)},
+    {11332978746731708037ULL, 2, MOVE(28, 37, 0x4)},
+    {11333902720713066036ULL, 14, MOVE(13, 29, 0x1)},
+    {11333902720713066036ULL, 7, MOVE(6, 21, 0x0)},
+    {11345259063409242439ULL, 1, MOVE(62, 45, 0x0)},
+    {11345259063409242439ULL, 1, MOVE(50, 34, 0x1)},
+    {11351876726249585025ULL, 21, MOVE(11, 19, 0x0)},
+    {11351876726249585025ULL, 1, MOVE(1, 18, 0x0)},
+    {11357975589073024167ULL, 9, MOVE(1, 18, 0x0)},
+    {11357975589073024167ULL, 3, MOVE(13, 29, 0x1)},
+    {11358826195486770144ULL, 1, MOVE(2, 9, 0x0)},
+    {11359052761181115683ULL, 6, MOVE(2, 11, 0x0)},
+    {11359052761181115683ULL, 1, MOVE(2, 20, 0x0)},
+    {11359052761181115683ULL, 1, MOVE(2, 29, 0x0)},
+    {11360469730085715885ULL, 1, MOVE(61, 54, 0x0)},
+    {11361188557731282818ULL, 1, MOVE(3, 1, 0x2)},
+    {11361313322595327901ULL, 1, MOVE(2, 9, 0x0)},
+    {11362858467447526888ULL, 1, MOVE(1, 18, 0x0)},
+    {11366480742890106359ULL, 3, MOVE(34, 20, 0x4)},
+    {11368999790208975023ULL, 3, MOVE(6, 12, 0x0)},
+    {11369076158939109680ULL, 5, MOVE(36, 21, 0x0)},
+    {11376358867852819541ULL, 1, MOVE(2, 38, 0x0)},
+    {11377745320027862815ULL, 30, MOVE(52, 36, 0x1)},
+    {11381350357955504225ULL, 1, MOVE(58, 30, 0x0)},
+    {11382597043359337162ULL, 2, MOVE(53, 45, 0x0)},
+    {11382597043359337162ULL, 1, MOVE(52, 44, 0x0)},
+    {11387475046724860723ULL, 1, MOVE(57, 42, 0x0)},
+    {11398227763728937270ULL, 1, MOVE(25, 18, 0x4)},
+    {11398825799978844088ULL, 2, MOVE(6, 12, 0x0)},
+    {11406859771477764992ULL, 1, MOVE(12, 28, 0x1)},
+    {11406991152036004517ULL, 10, MOVE(1, 18, 0x0)},
+    {11406991152036004517ULL, 5, MOVE(14, 22, 0x0)},
+    {11406991152036004517ULL, 4, MOVE(15, 23, 0x0)},
+    {11406991152036004517ULL, 3, MOVE(11, 19, 0x0)},
+    {11406991152036004517ULL, 3, MOVE(12, 20, 0x0)},
+    {11406991152036004517ULL, 1, MOVE(7, 6, 0x0)},
+    {11409540246999345823ULL, 1, MOVE(53, 37, 0x1)},
+    {11409540246999345823ULL, 1, MOVE(49, 41, 0x0)},
+    {11409540246999345823ULL, 1, MOVE(57, 42, 0x0)},
+    {11414498824955190227ULL, 1, MOVE(51, 35, 0x1)},
+    {11430234580772313809ULL, 1, MOVE(13, 21, 0x0)},
+    {11430794196804804055ULL, 1, MOVE(58, 49, 0x0)},
+    {11437648012243475097ULL, 1, MOVE(12, 28, 0x1)},
+    {11443851342001301099ULL, 2, MOVE(19, 28, 0x4)},
+    {11451299326710824824ULL, 1, MOVE(34, 20, 0x4)},
+    {11452116550830569730ULL, 1, MOVE(4, 28, 0x0)},
+    {11453271064522487147ULL, 1, MOVE(27, 21, 0x4)},
+    {11455586873980940439ULL, 2, MOVE(5, 26, 0x0)},
+    {11457799284235414758ULL, 1, MOVE(52, 36, 0x1)},
+    {11457799284235414758ULL, 1, MOVE(52, 44, 0x0)},
+    {11460514359407261666ULL, 1, MOVE(6, 21, 0x0)},
+    {11463200041191309665ULL, 1, MOVE(62, 45, 0x0)},
+    {11469529866255864730ULL, 1, MOVE(11, 19, 0x0)},
+    {11471909942384048753ULL, 105, MOVE(6, 21, 0x0)},
+    {11471909942384048753ULL, 18, MOVE(1, 18, 0x0)},
+    {11471909942384048753ULL, 16, MOVE(9, 17, 0x0)},
+    {11471909942384048753ULL, 7, MOVE(12, 28, 0x1)},
+    {11474980934160928547ULL, 1, MOVE(45, 37, 0x0)},
+    {11477906643496516861ULL, 1, MOVE(27, 36, 0x4)},
+    {11481338360563125614ULL, 2, MOVE(6, 12, 0x0)},
+    {11483741222968857236ULL, 1, MOVE(11, 19, 0x0)},
+    {11483996174646271070ULL, 1, MOVE(37, 28, 0x4)},
+    {11487168293450738346ULL, 2, MOVE(36, 21, 0x4)},
+    {11489086244224187830ULL, 1, MOVE(12, 28, 0x1)},
+    {11489100509247893810ULL, 10, MOVE(18, 28, 0x4)},
+    {11493586022448577874ULL, 1, MOVE(51, 43, 0x0)},
+    {11496813271285785452ULL, 1, MOVE(14, 30, 0x1)},
+    {11514186445833415512ULL, 1, MOVE(29, 36, 0x4)},
+    {11519129908340649398ULL, 1, MOVE(36, 60, 0x0)},
+    {11520797421439669086ULL, 3, MOVE(2, 9, 0x0)},
+    {11523581824910725787ULL, 1, MOVE(13, 21, 0x0)},
+    {11538672534852821408ULL, 13, MOVE(45, 36, 0x4)},
+    {11543864845469016609ULL, 1, MOVE(62, 45, 0x0)},
+    {11550688068626905978ULL, 2, MOVE(14, 21, 0x4)},
+    {11553222298573149890ULL, 1, MOVE(55, 47, 0x0)},
+    {11555061940069480104ULL, 1, MOVE(58, 51, 0x0)},
+    {11555061940069480104ULL, 1, MOVE(54, 46, 0x0)},
+    {11556959428313550018ULL, 1, MOVE(51, 43, 0x0)},
+    {11569242016875752350ULL, 7, MOVE(52, 44, 0x0)},
+    {11569242016875752350ULL, 4, MOVE(51, 43, 0x0)},
+    {11569242016875752350ULL, 3, MOVE(51, 35, 0x1)},
+    {11569242016875752350ULL, 1, MOVE(57, 40, 0x0)},
+    {11571830999789948611ULL, 1, MOVE(52, 44, 0x0)},
+    {11572880851018428606ULL, 1, MOVE(54, 38, 0x1)},
+    {11575862793401887408ULL, 1, MOVE(53, 45, 0x0)},
+    {11584655146564398707ULL, 1, MOVE(57, 42, 0x0)},
+    {11590058485672957364ULL, 1, MOVE(54, 46, 0x0)},
+    {11592845186346067347ULL, 1, MOVE(58, 49, 0x0)},
+    {11611524544203508143ULL, 2, MOVE(53, 37, 0x1)},
+    {11611524544203508143ULL, 1, MOVE(50, 34, 0x1)},
+    {11613749464827279880ULL, 1, MOVE(27, 36, 0x4)},
+    {11617035303467855949ULL, 10, MOVE(61, 52, 0x0)},
+    {11620353822385202653ULL, 11, MOVE(4, 13, 0x0)},
+    {11621551871224213325ULL, 1, MOVE(37, 28, 0x4)},
+    {11623975145125036579ULL, 1, MOVE(4, 13, 0x0)},
+    {11637746991010981505ULL, 1, MOVE(61, 54, 0x0)},
+    {11640251671858991824ULL, 1, MOVE(28, 35, 0x4)},
+    {11643672303704649343ULL, 8, MOVE(2, 3, 0x0)},
+    {11643672303704649343ULL, 6, MOVE(13, 21, 0x0)},
+    {11643672303704649343ULL, 2, MOVE(12, 28, 0x1)},
+    {11643672303704649343ULL, 2, MOVE(6, 21, 0x0)},
+    {11643672303704649343ULL, 1, MOVE(38, 31, 0x0)},
+    {11643672303704649343ULL, 1, MOVE(14, 22, 0x0)},
+    {11643996133513789576ULL, 1, MOVE(60, 36, 0x4)},
+    {11644183791189424220ULL, 2, MOVE(59, 57, 0x2)},
+    {11644183791189424220ULL, 1, MOVE(52, 36, 0x1)},
+    {11645006896589516280ULL, 7, MOVE(6, 21, 0x0)},
+    {11658606534804213434ULL, 1, MOVE(49, 41, 0x0)},
+    {11660463260406253355ULL, 1, MOVE(55, 47, 0x0)},
+    {11660841045101695942ULL, 1, MOVE(12, 20, 0x0)},
+    {11667757937158994662ULL, 6, MOVE(22, 29, 0x4)},
+    {11667763873535526343ULL, 4, MOVE(48, 40, 0x0)},
+    {11669050029105674037ULL, 1, MOVE(51, 43, 0x0)},
+    {11676484541956161640ULL, 3, MOVE(45, 39, 0x0)},
+    {11676484541956161640ULL, 1, MOVE(58, 30, 0x0)},
+    {11679719024517508790ULL, 2, MOVE(51, 43, 0x0)},
+    {11679719024517508790ULL, 1, MOVE(62, 45, 0x0)},
+    {11679719024517508790ULL, 1, MOVE(52, 44, 0x0)},
+    {11687089721146168058ULL, 1, MOVE(2, 29, 0x4)},
+    {11687213399843804468ULL, 1, MOVE(55, 47, 0x0)},
+    {11688404403997700044ULL, 90, MOVE(59, 57, 0x2)},
+    {11691988219905970677ULL, 1, MOVE(51, 43, 0x0)},
+    {11693809640101141234ULL, 38, MOVE(2, 9, 0x0)},
+    {11693809640101141234ULL, 4, MOVE(6, 21, 0x0)},
+    {11694865277775004387ULL, 1, MOVE(61, 25, 0x0)},
+    {11701470989052549594ULL, 3, MOVE(62, 52, 0x0)},
+    {11701470989052549594ULL, 1, MOVE(53, 45, 0x0)},
+    {11702902790697243436ULL, 58, MOVE(5, 12, 0x0)},
+    {11702902790697243436ULL, 1, MOVE(6, 12, 0x0)},
+    {11702902790697243436ULL, 1, MOVE(6, 21, 0x0)},
+    {11705342989251849444ULL, 1, MOVE(55, 47, 0x0)},
+    {11707367423980845857ULL, 15, MOVE(35, 28, 0x4)},
+    {11707367423980845857ULL, 2, MOVE(58, 30, 0x0)},
+    {11709257482297059495ULL, 1, MOVE(1, 18, 0x0)},
+    {11715833558559144733ULL, 1, MOVE(42, 27, 0x0)},
+    {11717307210545708213ULL, 2, MOVE(58, 49, 0x0)},
+    {11725694406054537771ULL, 1, MOVE(58, 51, 0x0)},
+    {11728233796398091329ULL, 4, MOVE(12, 20, 0x0)},
+    {11744774966726310886ULL, 2, MOVE(58, 49, 0x0)},
+    {11755761063359312593ULL, 1, MOVE(60, 61, 0x0)},
+    {11757195965638891876ULL, 1, MOVE(29, 36, 0x4)},
+    {11758981599465054020ULL, 1, MOVE(53, 37, 0x1)},
+    {11758981599465054020ULL, 1, MOVE(52, 36, 0x1)},
+    {11764203874780763195ULL, 1, MOVE(57, 42, 0x0)},
+    {11774951747560010935ULL, 1, MOVE(59, 57, 0x2)},
+    {11777898590147796898ULL, 1, MOVE(5, 26, 0x0)},
+    {11787769092290583495ULL, 6, MOVE(1, 18, 0x0)},
+    {11792290227248666791ULL, 1, MOVE(3, 1, 0x2)},
+    {11796615397294343783ULL, 1, MOVE(3, 1, 0x2)},
+    {11800671333116129597ULL, 12, MOVE(57, 42, 0x0)},
+    {11817251930449066489ULL, 1, MOVE(62, 45, 0x0)},
+    {11817416701206178060ULL, 4, MOVE(53, 45, 0x0)},
+    {11817416701206178060ULL, 1, MOVE(59, 57, 0x2)},
+    {11817416701206178060ULL, 1, MOVE(36, 29, 0x4)},
+    {11817416701206178060ULL, 1, MOVE(53, 37, 0x1)},
+    {11817617653855156940ULL, 1, MOVE(58, 44, 0x0)},
+    {11817631735782727976ULL, 1, MOVE(51, 43, 0x0)},
+    {11822765367294069552ULL, 2, MOVE(18, 33, 0x0)},
+    {11825779621770200243ULL, 3, MOVE(62, 45, 0x0)},
+    {11825779621770200243ULL, 3, MOVE(58, 51, 0x0)},
+    {11825779621770200243ULL, 2, MOVE(27, 37, 0x0)},
+    {11831913236398254565ULL, 4, MOVE(5, 14, 0x0)},
+    {11836117805244609758ULL, 2, MOVE(49, 41, 0x0)},
+    {11839584330974405226ULL, 7, MOVE(52, 44, 0x0)},
+    {11839714284731654093ULL, 3, MOVE(1, 18, 0x0)},
+    {11850187137794325775ULL, 1, MOVE(53, 45, 0x0)},
+    {11850187137794325775ULL, 1, MOVE(58, 51, 0x0)},
+    {11850187137794325775ULL, 1, MOVE(39, 29, 0x4)},
+    {11852355311902834536ULL, 1, MOVE(6, 21, 0x0)},
+    {11854555866955845593ULL, 1, MOVE(57, 42, 0x0)},
+    {11857167452676648359ULL, 2, MOVE(62, 45, 0x0)},
+    {11859271879377652880ULL, 1, MOVE(6, 21, 0x0)},
+    {11860608617220744156ULL, 2, MOVE(6, 21, 0x0)},
+    {11860608617220744156ULL, 2, MOVE(1, 18, 0x0)},
+    {11861434908048214061ULL, 24, MOVE(27, 36, 0x4)},
+    {11864985472886229329ULL, 1, MOVE(62, 45, 0x0)},
+    {11870620740482441467ULL, 1, MOVE(54, 38, 0x1)},
+    {11871009131701060214ULL, 1, MOVE(57, 51, 0x0)},
+    {11871090834686981037ULL, 2, MOVE(49, 41, 0x0)},
+    {11871090834686981037ULL, 1, MOVE(53, 37, 0x1)},
+    {11871090834686981037ULL, 1, MOVE(51, 43, 0x0)},
+    {11873796203175191951ULL, 1, MOVE(58, 49, 0x0)},
+    {11876020353740416369ULL, 1, MOVE(51, 35, 0x1)},
+    {11876449631175918924ULL, 1, MOVE(1, 11, 0x0)},
+    {11879362768000661207ULL, 1, MOVE(52, 36, 0x1)},
+    {11883256971673008338ULL, 1, MOVE(39, 37, 0x4)},
+    {11885037374987810415ULL, 1, MOVE(11, 27, 0x1)},
+    {11888606348668777946ULL, 1, MOVE(53, 45, 0x0)},
+    {11891952011560889439ULL, 1, MOVE(57, 42, 0x0)},
+    {11894869616091585288ULL, 1, MOVE(62, 45, 0x0)},
+    {11895088342976804120ULL, 1, MOVE(2, 9, 0x0)},
+    {11895720456737632104ULL, 1, MOVE(2, 9, 0x0)},
+    {11899282609017625835ULL, 1, MOVE(13, 29, 0x1)},
+    {11914946870939471890ULL, 1, MOVE(6, 12, 0x0)},
+    {11924507355199851913ULL, 1, MOVE(4, 31, 0x0)},
+    {11935894950140194168ULL, 1, MOVE(12, 28, 0x1)},
+    {11936595188737739218ULL, 1, MOVE(57, 42, 0x0)},
+    {11936595188737739218ULL, 1, MOVE(53, 37, 0x1)},
+    {11936595188737739218ULL, 1, MOVE(54, 46, 0x0)},
+    {11940142500590187318ULL, 1, MOVE(61, 25, 0x0)},
+    {11940548257196313737ULL, 1, MOVE(62, 52, 0x0)},
+    {11943484803438507948ULL, 2, MOVE(6, 21, 0x0)},
+    {11945800522816719341ULL, 3, MOVE(2, 9, 0x0)},
+    {11949001648706773719ULL, 1, MOVE(52, 36, 0x1)},
+    {11950197826840997483ULL, 3, MOVE(30, 37, 0x0)},
+    {11950197826840997483ULL, 1, MOVE(30, 51, 0x0)},
+    {11957554872739730731ULL, 17, MOVE(51, 35, 0x1)},
+    {11957554872739730731ULL, 9, MOVE(57, 42, 0x0)},
+    {11957626478748590210ULL, 1, MOVE(61, 52, 0x0)},
+    {11958206501807302525ULL, 5, MOVE(43, 36, 0x4)},
+    {11958647162681943742ULL, 2, MOVE(9, 17, 0x0)},
+    {11963779754448401402ULL, 5, MOVE(52, 36, 0x1)},
+    {11963779754448401402ULL, 3, MOVE(54, 38, 0x1)},
+    {11963779754448401402ULL, 1, MOVE(53, 37, 0x1)},
+    {11963889636142932549ULL, 1, MOVE(9, 17, 0x0)},
+    {11966111657242112441ULL, 2, MOVE(57, 42, 0x0)},
+    {11966111657242112441ULL, 1, MOVE(49, 41, 0x0)},
+    {11967609595292221245ULL, 1, MOVE(15, 23, 0x0)},
+    {11970921325575796007ULL, 1, MOVE(14, 22, 0x0)},
+    {11970921325575796007ULL, 1, MOVE(13, 21, 0x0)},
+    {11976457732637055966ULL, 1, MOVE(1, 18, 0x0)},
+    {11986922613219215399ULL, 2, MOVE(2, 20, 0x0)},
+    {11986922613219215399ULL, 1, MOVE(2, 11, 0x0)},
+    {11990030813302913792ULL, 53, MOVE(12, 20, 0x0)},
+    {11990030813302913792ULL, 2, MOVE(12, 28, 0x1)},
+    {11990030813302913792ULL, 1, MOVE(2, 3, 0x0)},
+    {11992421264978900135ULL, 1, MOVE(2, 20, 0x0)},
+    {11992769739004327548ULL, 1, MOVE(1, 18, 0x0)},
+    {11994650053958886480ULL, 1, MOVE(61, 54, 0x0)},
+    {12000744010546308371ULL, 1, MOVE(37, 29, 0x0)},
+    {12000978952792533137ULL, 1, MOVE(52, 44, 0x0)},
+    {12000978952792533137ULL, 1, MOVE(49, 41, 0x0)},
+    {12001075120018546901ULL, 1, MOVE(59, 57, 0x2)},
+    {12005665418405201502ULL, 1, MOVE(29, 36, 0x4)},
+    {12012657410847535054ULL, 14, MOVE(62, 45, 0x0)},
+    {12014913377586448057ULL, 1, MOVE(2, 9, 0x0)},
+    {12018773109623275322ULL, 4, MOVE(37, 28, 0x4)},
+    {12021186080624265295ULL, 9, MOVE(58, 49, 0x0)},
+    {12022399877500531328ULL, 1, MOVE(2, 9, 0x0)},
+    {12026498250778304545ULL, 13, MOVE(27, 21, 0x4)},
+    {12026498250778304545ULL, 3, MOVE(53, 37, 0x1)},
+    {12029778761923088085ULL, 1, MOVE(11, 19, 0x0)},
+    {12030387508924228803ULL, 1, MOVE(52, 36, 0x1)},
+    {12031766022652374246ULL, 15, MOVE(1, 18, 0x0)},
+    {12031766022652374246ULL, 4, MOVE(12, 28, 0x1)},
+    {12035433064777569368ULL, 2, MOVE(6, 21, 0x0)},
+    {12043293377401620766ULL, 1, MOVE(2, 9, 0x0)},
+    {12053455671755996505ULL, 1, MOVE(1, 18, 0x0)},
+    {12057842364059863335ULL, 10, MOVE(60, 36, 0x4)},
+    {12062924084451543643ULL, 1, MOVE(23, 29, 0x4)},
+    {12065362780742202189ULL, 1, MOVE(54, 38, 0x1)},
+    {12070063843818837725ULL, 1, MOVE(52, 36, 0x1)},
+    {12070266678750962379ULL, 3, MOVE(51, 35, 0x1)},
+    {12070266678750962379ULL, 2, MOVE(61, 25, 0x0)},
+    {12073333035989350333ULL, 4, MOVE(11, 27, 0x1)},
+    {12079890062329786265ULL, 1, MOVE(53, 37, 0x1)},
+    {12083204878059596747ULL, 1, MOVE(18, 28, 0x4)},
+    {12084693089587214679ULL, 1, MOVE(57, 42, 0x0)},
+    {12087442756527777897ULL, 5, MOVE(61, 54, 0x0)},
+    {12104179740467917825ULL, 20, MOVE(54, 46, 0x0)},
+    {12104179740467917825ULL, 6, MOVE(52, 36, 0x1)},
+    {12104179740467917825ULL, 3, MOVE(53, 37, 0x1)},
+    {12104179740467917825ULL, 3, MOVE(58, 30, 0x0)},
+    {12104678056871079147ULL, 1, MOVE(58, 49, 0x0)},
+    {12104912984681494265ULL, 1, MOVE(57, 42, 0x0)},
+    {12109531797814807584ULL, 64, MOVE(6, 21, 0x0)},
+    {12109531797814807584ULL, 3, MOVE(10, 18, 0x0)},
+    {12109889539175594993ULL, 1, MOVE(5, 14, 0x0)},
+    {12109889539175594993ULL, 1, MOVE(2, 9, 0x0)},
+    {12110596459684989700ULL, 1, MOVE(9, 17, 0x0)},
+    {12111989236528865754ULL, 1, MOVE(35, 28, 0x4)},
+    {12116399398039928123ULL, 1, MOVE(58, 44, 0x0)},
+    {12117375981879930422ULL, 1, MOVE(58, 51, 0x0)},
+    {12119748102978060678ULL, 49, MOVE(51, 43, 0x0)},
+    {12119748102978060678ULL, 25, MOVE(55, 47, 0x0)},
+    {12119748102978060678ULL, 14, MOVE(49, 41, 0x0)},
+    {12119748102978060678ULL, 1, MOVE(61, 34, 0x0)},
+    {12119748102978060678ULL, 1, MOVE(61, 25, 0x0)},
+    {12129859749492972866ULL, 2, MOVE(15, 23, 0x0)},
+    {12131354356191708030ULL, 1, MOVE(38, 52, 0x4)},
+    {12134404744492100026ULL, 2, MOVE(11, 19, 0x0)},
+    {12142726453447033436ULL, 1, MOVE(45, 36, 0x4)},
+    {12147486203975073100ULL, 1, MOVE(6, 21, 0x0)},
+    {12156651407697939319ULL, 6, MOVE(57, 42, 0x0)},
+    {12156651407697939319ULL, 1, MOVE(49, 41, 0x0)},
+    {12161863026550030994ULL, 1, MOVE(27, 35, 0x0)},
+    {12162206047403768019ULL, 3, MOVE(62, 47, 0x0)},
+    {12167516760378290512ULL, 1, MOVE(34, 20, 0x4)},
+    {12170501594698158657ULL, 1, MOVE(57, 42, 0x0)},
+    {12170501594698158657ULL, 1, MOVE(51, 35, 0x1)},
+    {12170803228958036792ULL, 1, MOVE(29, 36, 0x4)},
+    {12172219096012654311ULL, 1, MOVE(60, 46, 0x0)},
+    {12173654057204092496ULL, 2, MOVE(2, 38, 0x0)},
+    {12178954041838142204ULL, 1, MOVE(58, 49, 0x0)},
+    {12179337199820200523ULL, 1, MOVE(1, 11, 0x0)},
+    {12179545257381228895ULL, 25, MOVE(57, 42, 0x0)},
+    {12179545257381228895ULL, 1, MOVE(62, 45, 0x0)},
+    {12196434452444976124ULL, 2, MOVE(62, 45, 0x0)},
+    {12196434452444976124ULL, 1, MOVE(53, 37, 0x1)},
+    {12197272443545392687ULL, 1, MOVE(51, 43, 0x0)},
+    {12199869835035801959ULL, 1, MOVE(1, 18, 0x0)},
+    {12201017017452881748ULL, 1, MOVE(53, 45, 0x0)},
+    {12204361320252047181ULL, 1, MOVE(58, 49, 0x0)},
+    {12206713540845115255ULL, 1, MOVE(57, 42, 0x0)},
+    {12209062772473466690ULL, 4, MOVE(52, 44, 0x0)},
+    {12213484500741002131ULL, 18, MOVE(57, 42, 0x0)},
+    {12213484500741002131ULL, 8, MOVE(50, 34, 0x1)},
+    {12213484500741002131ULL, 8, MOVE(58, 30, 0x0)},
+    {12213484500741002131ULL, 6, MOVE(54, 46, 0x0)},
+    {12213484500741002131ULL, 4, MOVE(52, 36, 0x1)},
+    {12213484500741002131ULL, 3, MOVE(53, 37, 0x1)},
+    {12223089041103792337ULL, 3, MOVE(29, 36, 0x4)},
+    {12224413131823439633ULL, 5, MOVE(6, 21, 0x0)},
+    {12225956461543463555ULL, 1, MOVE(29, 38, 0x4)},
+    {12228907695749211395ULL, 3, MOVE(29, 36, 0x4)},
+    {12234120508765605860ULL, 1, MOVE(58, 51, 0x0)},
+    {12242530732107952140ULL, 3, MOVE(59, 57, 0x2)},
+    {12242815701837609289ULL, 2, MOVE(12, 28, 0x1)},
+    {12253590311650836938ULL, 1, MOVE(2, 29, 0x0)},
+    {12253653967179622131ULL, 3, MOVE(45, 28, 0x0)},
+    {12256943519400572148ULL, 12, MOVE(55, 47, 0x0)},
+    {12257784396355947623ULL, 2, MOVE(51, 43, 0x0)},
+    {12257784396355947623ULL, 1, MOVE(57, 42, 0x0)},
+    {12258938014540838864ULL, 1, MOVE(58, 49, 0x0)},
+    {12264857412788177556ULL, 1, MOVE(52, 44, 0x0)},
+    {12267247003887369147ULL, 1, MOVE(58, 44, 0x0)},
+    {12267247003887369147ULL, 1, MOVE(62, 52, 0x0)},
+    {12267341104108409050ULL, 2, MOVE(51, 35, 0x1)},
+    {12268314679961850814ULL, 1, MOVE(25, 18, 0x4)},
+    {12279448281110251876ULL, 1, MOVE(13, 21, 0x0)},
+    {12281488578048362893ULL, 1, MOVE(54, 45, 0x4)},
+    {12284294287851770482ULL, 3, MOVE(49, 41, 0x0)},
+    {12284294287851770482ULL, 1, MOVE(62, 52, 0x0)},
+    {12285988249352388630ULL, 2, MOVE(53, 37, 0x1)},
+    {12285988249352388630ULL, 1, MOVE(62, 52, 0x0)},
+    {12285988249352388630ULL, 1, MOVE(53, 45, 0x0)},
+    {12289416094396696866ULL, 7, MOVE(53, 37, 0x1)},
+    {12289416094396696866ULL, 1, MOVE(59, 57, 0x2)},
+    {12289416094396696866ULL, 1, MOVE(52, 36, 0x1)},
+    {12290004925374514634ULL, 22, MOVE(53, 37, 0x1)},
+    {12290004925374514634ULL, 11, MOVE(55, 47, 0x0)},
+    {12291903886728591897ULL, 1, MOVE(49, 41, 0x0)},
+    {12292065916342516581ULL, 11, MOVE(52, 36, 0x1)},
+    {12292065916342516581ULL, 1, MOVE(57, 42, 0x0)},
+    {12293079874361818557ULL, 1, MOVE(58, 49, 0x0)},
+    {12298979907845551979ULL, 1, MOVE(42, 27, 0x0)},
+    {12300131588700460585ULL, 1, MOVE(12, 28, 0x1)},
+    {12301135315750417779ULL, 7, MOVE(35, 42, 0x4)},
+    {12306994257515563500ULL, 1, MOVE(57, 51, 0x0)},
+    {12306994257515563500ULL, 1, MOVE(58, 44, 0x0)},
+    {12307818224246984118ULL, 1, MOVE(58, 51, 0x0)},
+    {12308267893108481527ULL, 3, MOVE(27, 35, 0x0)},
+    {12308267893108481527ULL, 1, MOVE(12, 20, 0x0)},
+    {12311970516199281272ULL, 1, MOVE(42, 36, 0x0)},
+    {12324854824352036840ULL, 14, MOVE(1, 18, 0x0)},
+    {12329374850386920957ULL, 2, MOVE(59, 60, 0x4)},
+    {12331730809702144593ULL, 51, MOVE(1, 18, 0x0)},
+    {12331730809702144593ULL, 2, MOVE(14, 22, 0x0)},
+    {12331730809702144593ULL, 1, MOVE(5, 12, 0x0)},
+    {12350287733633185617ULL, 3, MOVE(42, 27, 0x4)},
+    {12363383796802578879ULL, 6, MOVE(3, 1, 0x2)},
+    {12363383796802578879ULL, 5, MOVE(13, 29, 0x1)},
+    {12363383796802578879ULL, 3, MOVE(12, 20, 0x0)},
+    {12363383796802578879ULL, 2, MOVE(8, 16, 0x0)},
+    {12363383796802578879ULL, 1, MOVE(12, 28, 0x1)},
+    {12371414959776943851ULL, 1, MOVE(57, 42, 0x0)},
+    {12372446729624088128ULL, 1, MOVE(29, 19, 0x0)},
+    {12385723303618198603ULL, 721, MOVE(13, 29, 0x1)},
+    {12385723303618198603ULL, 59, MOVE(1, 18, 0x0)},
+    {12385723303618198603ULL, 12, MOVE(5, 26, 0x0)},
+    {12385723303618198603ULL, 2, MOVE(6, 21, 0x0)},
+    {12385723303618198603ULL, 2, MOVE(5, 33, 0x0)},
+    {12385723303618198603ULL, 1, MOVE(13, 21, 0x0)},
+    {12385964245234870348ULL, 1, MOVE(58, 51, 0x0)},
+    {12385964245234870348ULL, 1, MOVE(54, 46, 0x0)},
+    {12389600695227509331ULL, 1, MOVE(37, 28, 0x4)},
+    {12404426048017099316ULL, 2, MOVE(54, 38, 0x1)},
+    {12406801520763776024ULL, 2, MOVE(57, 42, 0x0)},
+    {12412657803222043206ULL, 1, MOVE(2, 9, 0x0)},
+    {12413195510696745595ULL, 29, MOVE(5, 33, 0x0)},
+    {12414491915221784615ULL, 1, MOVE(57, 42, 0x0)},
+    {12415867405053777498ULL, 1, MOVE(30, 39, 0x0)},
+    {12419643208187879390ULL, 1, MOVE(36, 28, 0x0)},
+    {12427063384443928683ULL, 1, MOVE(37, 30, 0x4)},
+    {12432952356401683391ULL, 5, MOVE(52, 36, 0x1)},
+    {12432952356401683391ULL, 2, MOVE(52, 44, 0x0)},
+    {12432952356401683391ULL, 1, MOVE(48, 40, 0x0)},
+    {12438275813579183154ULL, 1, MOVE(57, 42, 0x0)},
+    {12438349538819842921ULL, 5, MOVE(1, 18, 0x0)},
+    {12438349538819842921ULL, 4, MOVE(2, 9, 0x0)},
+    {12438349538819842921ULL, 2, MOVE(11, 27, 0x1)},
+    {12446057105285763466ULL, 3, MOVE(36, 29, 0x4)},
+    {12446057105285763466ULL, 1, MOVE(61, 34, 0x0)},
+    {12446057105285763466ULL, 1, MOVE(49, 41, 0x0)},
+    {12454650127587245166ULL, 1, MOVE(53, 37, 0x1)},
+    {12460291894695522988ULL, 1, MOVE(62, 45, 0x0)},
+    {12464834795103212444ULL, 1, MOVE(62, 52, 0x0)},
+    {12477087841899135350ULL, 1, MOVE(26, 33, 0x0)},
+    {12479429775323201874ULL, 5, MOVE(2, 9, 0x0)},
+    {12485647287567712238ULL, 5, MOVE(9, 17, 0x0)},
+    {12485647287567712238ULL, 3, MOVE(12, 28, 0x1)},
+    {12485647287567712238ULL, 1, MOVE(14, 22, 0x0)},
+    {12488065952446216286ULL, 1, MOVE(18, 28, 0x4)},
+    {12493866220134162234ULL, 2, MOVE(28, 36, 0x0)},
+    {12493866220134162234ULL, 1, MOVE(28, 37, 0x4)},
+    {12497160100107022887ULL, 38, MOVE(11, 27, 0x1)},
+    {12497160100107022887ULL, 4, MOVE(11, 19, 0x0)},
+    {12497160100107022887ULL, 3, MOVE(4, 31, 0x0)},
+    {12497160100107022887ULL, 2, MOVE(5, 33, 0x0)},
+    {12497160100107022887ULL, 1, MOVE(9, 17, 0x0)},
+    {12506621179946518014ULL, 1, MOVE(4, 28, 0x4)},
+    {12508401380997725368ULL, 1, MOVE(4, 20, 0x4)},
+    {12509190341018259449ULL, 2, MOVE(51, 35, 0x1)},
+    {12512053100186213943ULL, 1, MOVE(58, 49, 0x0)},
+    {12517351131716004921ULL, 2, MOVE(18, 28, 0x0)},
+    {12519747849473272058ULL, 1, MOVE(58, 51, 0x0)},
+    {12527706986486010701ULL, 12, MOVE(59, 57, 0x2)},
+    {12528464915675379864ULL, 2, MOVE(53, 45, 0x0)},
+    {12528464915675379864ULL, 1, MOVE(42, 25, 0x0)},
+    {12528487787489454684ULL, 3, MOVE(52, 44, 0x0)},
+    {12528487787489454684ULL, 1, MOVE(52, 36, 0x1)},
+    {12537249603252538281ULL, 4, MOVE(12, 28, 0x1)},
+    {12537249603252538281ULL, 3, MOVE(13, 29, 0x1)},
+    {12539722680070887462ULL, 4, MOVE(52, 36, 0x1)},
+    {12539722680070887462ULL, 1, MOVE(49, 41, 0x0)},
+    {12545354567470915424ULL, 23, MOVE(62, 52, 0x0)},
+    {12545354567470915424ULL, 2, MOVE(61, 52, 0x0)},
+    {12545354567470915424ULL, 1, MOVE(57, 42, 0x0)},
+    {12545752070711262764ULL, 4, MOVE(6, 21, 0x0)},
+    {12552182001497412720ULL, 1, MOVE(5, 14, 0x0)},
+    {12554786301056136599ULL, 2, MOVE(33, 42, 0x4)},
+    {12556666928275919519ULL, 1, MOVE(62, 45, 0x0)},
+    {12557464768465772210ULL, 6, MOVE(2, 29, 0x0)},
+    {12557464768465772210ULL, 2, MOVE(13, 29, 0x1)},
+    {12557464768465772210ULL, 2, MOVE(2, 11, 0x0)},
+    {12557464768465772210ULL, 2, MOVE(6, 21, 0x0)},
+    {12557464768465772210ULL, 2, MOVE(13, 21, 0x0)},
+    {12568762684078236812ULL, 1, MOVE(49, 41, 0x0)},
+    {12570435042201213075ULL, 8, MOVE(62, 52, 0x0)},
+    {12570435042201213075ULL, 8, MOVE(61, 34, 0x0)},
+    {12570435042201213075ULL, 2, MOVE(49, 41, 0x0)},
+    {12578075303643784382ULL, 5, MOVE(48, 40, 0x0)},
+    {12583091244718122292ULL, 1, MOVE(58, 30, 0x0)},
+    {12584692931864256748ULL, 1, MOVE(54, 46, 0x0)},
+    {12589164932992315964ULL, 1, MOVE(37, 28, 0x4)},
+    {12590278638344084256ULL, 1, MOVE(1, 11, 0x0)},
+    {12594402223089237474ULL, 1, MOVE(57, 42, 0x0)},
+    {12601444150436945129ULL, 5, MOVE(57, 42, 0x0)},
+    {12601564919408720165ULL, 1, MOVE(52, 44, 0x0)},
+    {12603458824210791445ULL, 1, MOVE(37, 28, 0x4)},
+    {12604074158025521965ULL, 32, MOVE(2, 9, 0x0)},
+    {12604074158025521965ULL, 1, MOVE(13, 29, 0x1)},
+    {12612166236925936561ULL, 1, MOVE(3, 1, 0x2)},
+    {12614104423051020356ULL, 1, MOVE(58, 49, 0x0)},
+    {12615713685532767200ULL, 2, MOVE(30, 21, 0x4)},
+    {12617239697912785241ULL, 1, MOVE(12, 28, 0x1)},
+    {12620683949554638034ULL, 1, MOVE(2, 38, 0x0)},
+    {12620683949554638034ULL, 1, MOVE(12, 28, 0x1)},
+    {12622074763127431305ULL, 1, MOVE(1, 18, 0x0)},
+    {12623279195391566658ULL, 1, MOVE(1, 18, 0x0)},
+    {12624302281362513461ULL, 3, MOVE(11, 19, 0x0)},
+    {12624446126019701868ULL, 26, MOVE(1, 18, 0x0)},
+    {12624446126019701868ULL, 15, MOVE(29, 36, 0x4)},
+    {12624446126019701868ULL, 8, MOVE(5, 26, 0x0)},
+    {12625668168912842043ULL, 1, MOVE(49, 33, 0x1)},
+    {12626511129311814245ULL, 1, MOVE(52, 44, 0x0)},
+    {12641107388846704544ULL, 3, MOVE(1, 18, 0x0)},
+    {12644259006307525552ULL, 1, MOVE(14, 30, 0x1)},
+    {12645103491281740275ULL, 2, MOVE(30, 21, 0x4)},
+    {12645103491281740275ULL, 2, MOVE(35, 27, 0x0)},
+    {12645103491281740275ULL, 1, MOVE(60, 51, 0x0)},
+    {12649129848372953693ULL, 1, MOVE(13, 29, 0x1)},
+    {12651340779952581467ULL, 2, MOVE(52, 44, 0x0)},
+    {12651959081434861347ULL, 2, MOVE(57, 42, 0x0)},
+    {12653617222608463422ULL, 5, MOVE(42, 36, 0x4)},
+    {12654574471691468832ULL, 1, MOVE(6, 21, 0x0)},
+    {12654722711022386266ULL, 4, MOVE(37, 28, 0x4)},
+    {12657986276115343633ULL, 4, MOVE(27, 36, 0x4)},
+    {12674560156944829207ULL, 1, MOVE(6, 12, 0x0)},
+    {12675774201144913573ULL, 1, MOVE(13, 29, 0x1)},
+    {12676833915877130296ULL, 1, MOVE(59, 57, 0x2)},
+    {12680507026624180129ULL, 2, MOVE(52, 44, 0x0)},
+    {12680507026624180129ULL, 1, MOVE(52, 36, 0x1)},
+    {12686192301561948743ULL, 2, MOVE(4, 11, 0x0)},
+    {12688187564676735892ULL, 23, MOVE(6, 21, 0x0)},
+    {12688345264380691315ULL, 1, MOVE(11, 27, 0x1)},
+    {12691223179385516484ULL, 4, MOVE(62, 52, 0x0)},
+    {12691223179385516484ULL, 2, MOVE(51, 43, 0x0)},
+    {12692533639445378824ULL, 1, MOVE(6, 21, 0x0)},
+    {12694204206617854514ULL, 12, MOVE(29, 38, 0x4)},
+    {12694204206617854514ULL, 3, MOVE(1, 18, 0x0)},
+    {12694204206617854514ULL, 1, MOVE(6, 12, 0x0)},
+    {12694204206617854514ULL, 1, MOVE(5, 33, 0x0)},
+    {12703853873740489485ULL, 1, MOVE(62, 45, 0x0)},
+    {12711790140574267462ULL, 78, MOVE(14, 22, 0x0)},
+    {12711790140574267462ULL, 31, MOVE(4, 13, 0x0)},
+    {12711790140574267462ULL, 20, MOVE(4, 31, 0x0)},
+    {12711790140574267462ULL, 13, MOVE(6, 12, 0x0)},
+    {12711790140574267462ULL, 6, MOVE(4, 22, 0x0)},
+    {12719348183936543019ULL, 1, MOVE(34, 41, 0x0)},
+    {12719473498257292402ULL, 2, MOVE(59, 57, 0x2)},
+    {12721134832249602215ULL, 7, MOVE(13, 29, 0x4)},
+    {12721892020941828192ULL, 3, MOVE(57, 42, 0x0)},
+    {12721892020941828192ULL, 3, MOVE(53, 37, 0x1)},
+    {12721892020941828192ULL, 2, MOVE(61, 25, 0x0)},
+    {12721892020941828192ULL, 2, MOVE(61, 34, 0x0)},
+    {12721892020941828192ULL, 1, MOVE(53, 45, 0x0)},
+    {12724752286453741638ULL, 1, MOVE(11, 19, 0x0)},
+    {12731542551486537385ULL, 2, MOVE(57, 42, 0x0)},
+    {12731542551486537385ULL, 1, MOVE(53, 45, 0x0)},
+    {12731542551486537385ULL, 1, MOVE(62, 45, 0x0)},
+    {12733805347311715613ULL, 1, MOVE(2, 29, 0x0)},
+    {12733805347311715613ULL, 1, MOVE(2, 11, 0x0)},
+    {12734694975402032480ULL, 1, MOVE(57, 42, 0x0)},
+    {12735707120281114201ULL, 3, MOVE(12, 28, 0x1)},
+    {12735707120281114201ULL, 1, MOVE(13, 29, 0x1)},
+    {12735707120281114201ULL, 1, MOVE(12, 20, 0x0)},
+    {12738464977685026107ULL, 4, MOVE(33, 26, 0x0)},
+    {12738464977685026107ULL, 1, MOVE(33, 24, 0x0)},
+    {12740151416612145407ULL, 1, MOVE(12, 28, 0x1)},
+    {12742181459100440101ULL, 2, MOVE(62, 52, 0x0)},
+    {12749293669328252047ULL, 23, MOVE(49, 41, 0x0)},
+    {12749293669328252047ULL, 14, MOVE(51, 35, 0x1)},
+    {12749293669328252047ULL, 3, MOVE(57, 42, 0x0)},
+    {12749293669328252047ULL, 3, MOVE(52, 44, 0x0)},
+    {12749293669328252047ULL, 2, MOVE(51, 43, 0x0)},
+    {12761815899475908269ULL, 1, MOVE(53, 37, 0x1)},
+    {12761876037875676435ULL, 1, MOVE(22, 29, 0x4)},
+    {12762228538126994535ULL, 1, MOVE(58, 49, 0x0)},
+    {12762529970314956119ULL, 2, MOVE(18, 35, 0x4)},
+    {12767304288290706910ULL, 33, MOVE(6, 21, 0x0)},
+    {12767304288290706910ULL, 25, MOVE(12, 28, 0x1)},
+    {12767304288290706910ULL, 4, MOVE(11, 19, 0x0)},
+    {12767304288290706910ULL, 1, MOVE(14, 22, 0x0)},
+    {12767304288290706910ULL, 1, MOVE(9, 17, 0x0)},
+    {12767371061115616523ULL, 32, MOVE(29, 36, 0x4)},
+    {12770466659933118255ULL, 1, MOVE(12, 20, 0x0)},
+    {12772366688609568166ULL, 11, MOVE(53, 45, 0x0)},
+    {12772366688609568166ULL, 5, MOVE(62, 52, 0x0)},
+    {12772366688609568166ULL, 2, MOVE(51, 43, 0x0)},
+    {12786536733888326792ULL, 1, MOVE(11, 27, 0x1)},
+    {12799461543579361333ULL, 1, MOVE(37, 28, 0x4)},
+    {12800229300540056417ULL, 217, MOVE(42, 27, 0x4)},
+    {12802186413587199892ULL, 1, MOVE(33, 24, 0x4)},
+    {12803174305862358431ULL, 1, MOVE(4, 11, 0x0)},
+    {12806733296467991187ULL, 2, MOVE(51, 43, 0x0)},
+    {12820173554855631286ULL, 1, MOVE(62, 45, 0x0)},
+    {12820173554855631286ULL, 1, MOVE(52, 36, 0x1)},
+    {12823157554281570712ULL, 1, MOVE(48, 40, 0x0)},
+    {12827406069961229111ULL, 7, MOVE(62, 52, 0x0)},
+    {12827406069961229111ULL, 2, MOVE(53, 45, 0x0)},
+    {12827406069961229111ULL, 2, MOVE(61, 52, 0x0)},
+    {12827528685899115972ULL, 41, MOVE(49, 41, 0x0)},
+    {12827528685899115972ULL, 19, MOVE(51, 35, 0x1)},
+    {12827528685899115972ULL, 3, MOVE(62, 52, 0x0)},
+    {12827528685899115972ULL, 1, MOVE(53, 45, 0x0)},
+    {12827774755826471961ULL, 5, MOVE(59, 57, 0x2)},
+    {12829857551425522296ULL, 1, MOVE(57, 42, 0x0)},
+    {12835078441313324512ULL, 1, MOVE(52, 36, 0x1)},
+    {12837822630179309120ULL, 1, MOVE(52, 44, 0x0)},
+    {12838176464009258617ULL, 1, MOVE(51, 43, 0x0)},
+    {12841414637895120097ULL, 1, MOVE(51, 43, 0x0)},
+    {12841414637895120097ULL, 1, MOVE(62, 52, 0x0)},
+    {12847611761441623937ULL, 2, MOVE(5, 14, 0x0)},
+    {12865765256754819323ULL, 1, MOVE(58, 51, 0x0)},
+    {12867406410077775715ULL, 1, MOVE(12, 28, 0x1)},
+    {12869315064288850079ULL, 1, MOVE(11, 27, 0x1)},
+    {12871896104873327407ULL, 1, MOVE(62, 52, 0x0)},
+    {12871989951295209753ULL, 45, MOVE(36, 27, 0x4)},
+    {12871989951295209753ULL, 1, MOVE(49, 41, 0x0)},
+    {12872666619662034762ULL, 3, MOVE(59, 57, 0x2)},
+    {12872666619662034762ULL, 2, MOVE(53, 37, 0x1)},
+    {12872666619662034762ULL, 1, MOVE(52, 36, 0x1)},
+    {12872666619662034762ULL, 1, MOVE(62, 45, 0x0)},
+    {12875237071653807172ULL, 1, MOVE(5, 12, 0x0)},
+    {12876587257033340592ULL, 1, MOVE(37, 28, 0x4)},
+    {12876891438278381369ULL, 3, MOVE(57, 42, 0x0)},
+    {12876891438278381369ULL, 1, MOVE(52, 36, 0x1)},
+    {12884632225743054601ULL, 1, MOVE(49, 41, 0x0)},
+    {12884632225743054601ULL, 1, MOVE(62, 52, 0x0)},
+    {12884808331141251385ULL, 1, MOVE(59, 57, 0x2)},
+    {12886379800431348820ULL, 26, MOVE(13, 29, 0x1)},
+    {12886379800431348820ULL, 15, MOVE(5, 33, 0x0)},
+    {12886379800431348820ULL, 10, MOVE(9, 17, 0x0)},
+    {12886379800431348820ULL, 7, MOVE(5, 26, 0x0)},
+    {12886379800431348820ULL, 4, MOVE(6, 12, 0x0)},
+    {12886379800431348820ULL, 2, MOVE(11, 19, 0x0)},
+    {12886379800431348820ULL, 1, MOVE(14, 22, 0x0)},
+    {12886379800431348820ULL, 1, MOVE(13, 21, 0x0)},
+    {12886379800431348820ULL, 1, MOVE(6, 21, 0x0)},
+    {12886586689546471142ULL, 2, MOVE(6, 12, 0x0)},
+    {12892961079757915258ULL, 1, MOVE(57, 42, 0x0)},
+    {12894722589493139044ULL, 1, MOVE(6, 21, 0x0)},
+    {12897490993319664343ULL, 3, MOVE(9, 17, 0x0)},
+    {12900014923416402515ULL, 2, MOVE(51, 43, 0x0)},
+    {12908898488334244561ULL, 1, MOVE(55, 47, 0x0)},
+    {12917227608353099029ULL, 1, MOVE(11, 27, 0x1)},
+    {12917418249858201547ULL, 9, MOVE(12, 28, 0x1)},
+    {12917418249858201547ULL, 1, MOVE(2, 11, 0x0)},
+    {12918184429528605887ULL, 1, MOVE(1, 18, 0x0)},
+    {12920806012044676448ULL, 1, MOVE(51, 35, 0x1)},
+    {12922136210548972958ULL, 1, MOVE(12, 28, 0x1)},
+    {12924945509355531092ULL, 1, MOVE(52, 44, 0x0)},
+    {12927158626141342593ULL, 1, MOVE(35, 28, 0x4)},
+    {12927324252494665270ULL, 11, MOVE(58, 30, 0x0)},
+    {12927324252494665270ULL, 5, MOVE(53, 45, 0x0)},
+    {12927324252494665270ULL, 2, MOVE(52, 36, 0x1)},
+    {12934391977925429749ULL, 1, MOVE(59, 57, 0x2)},
+    {12937267620201480720ULL, 5, MOVE(43, 36, 0x4)},
+    {12937686490474628778ULL, 136, MOVE(27, 44, 0x0)},
+    {12937686490474628778ULL, 1, MOVE(55, 47, 0x0)},
+    {12938293624500049951ULL, 5, MOVE(57, 42, 0x0)},
+    {12942050154810573329ULL, 2, MOVE(37, 28, 0x4)},
+    {12942050154810573329ULL, 1, MOVE(59, 57, 0x2)},
+    {12943328154826809346ULL, 3, MOVE(29, 36, 0x4)},
+    {12943328154826809346ULL, 2, MOVE(11, 19, 0x0)},
+    {12943328154826809346ULL, 2, MOVE(5, 33, 0x0)},
+    {12943328154826809346ULL, 1, MOVE(4, 22, 0x0)},
+    {12943328154826809346ULL, 1, MOVE(4, 31, 0x0)},
+    {12946521733451100431ULL, 1, MOVE(57, 42, 0x0)},
+    {12954643867641890494ULL, 2, MOVE(12, 28, 0x1)},
+    {12966532663958330803ULL, 3, MOVE(37, 28, 0x4)},
+    {12970923876143208755ULL, 4, MOVE(57, 42, 0x0)},
+    {12972012448405967580ULL, 2, MOVE(26, 35, 0x4)},
+    {12982068477291364801ULL, 3, MOVE(11, 27, 0x1)},
+    {12992500511682277152ULL, 8, MOVE(6, 21, 0x0)},
+    {12998258661136259501ULL, 1, MOVE(27, 36, 0x4)},
+    {13003266174063986401ULL, 12, MOVE(52, 36, 0x1)},
+    {13003266174063986401ULL, 3, MOVE(57, 42, 0x0)},
+    {13003266174063986401ULL, 1, MOVE(50, 34, 0x1)},
+    {13003905886516079745ULL, 2, MOVE(11, 19, 0x0)},
+    {13004833892763861492ULL, 64, MOVE(51, 43, 0x0)},
+    {13004833892763861492ULL, 61, MOVE(49, 41, 0x0)},
+    {13004833892763861492ULL, 31, MOVE(52, 36, 0x1)},
+    {13004833892763861492ULL, 4, MOVE(52, 44, 0x0)},
+    {13004833892763861492ULL, 2, MOVE(54, 46, 0x0)},
+    {13004833892763861492ULL, 2, MOVE(53, 37, 0x1)},
+    {13007957310933551404ULL, 1, MOVE(5, 33, 0x0)},
+    {13016127107112686685ULL, 1, MOVE(12, 28, 0x1)},
+    {13019235115776008202ULL, 1, MOVE(58, 37, 0x0)},
+    {13021272002029992699ULL, 1, MOVE(5, 26, 0x0)},
+    {13021272002029992699ULL, 1, MOVE(9, 17, 0x0)},
+    {13024257541838101782ULL, 1, MOVE(52, 36, 0x1)},
+    {13028488112660535369ULL, 1, MOVE(4, 22, 0x0)},
+    {13031052076154028648ULL, 1, MOVE(62, 45, 0x0)},
+    {13033287008855191663ULL, 1, MOVE(52, 36, 0x1)},
+    {13034166716182122047ULL, 93, MOVE(13, 21, 0x0)},
+    {13034166716182122047ULL, 58, MOVE(3, 1, 0x2)},
+    {13034166716182122047ULL, 20, MOVE(12, 20, 0x0)},
+    {13034166716182122047ULL, 4, MOVE(6, 21, 0x0)},
+    {13034166716182122047ULL, 3, MOVE(14, 30, 0x1)},
+    {13037364759367479561ULL, 6, MOVE(30, 12, 0x4)},
+    {13039260344206174103ULL, 1, MOVE(28, 22, 0x0)},
+    {13039338775187829568ULL, 1, MOVE(9, 17, 0x0)},
+    {13041893452658833925ULL, 1, MOVE(62, 45, 0x0)},
+    {13046713384054187762ULL, 1, MOVE(52, 36, 0x1)},
+    {13046713384054187762ULL, 1, MOVE(35, 28, 0x4)},
+    {13049153587140103062ULL, 12, MOVE(38, 20, 0x0)},
+    {13053845434320040801ULL, 1, MOVE(53, 37, 0x1)},
+    {13056737717640939829ULL, 3, MOVE(61, 54, 0x0)},
+    {13056737717640939829ULL, 1, MOVE(50, 34, 0x1)},
+    {13058784445151802878ULL, 1, MOVE(5, 33, 0x0)},
+    {13060273225008306171ULL, 1, MOVE(59, 57, 0x2)},
+    {13065428591627326893ULL, 2, MOVE(51, 42, 0x4)},
+    {13072482658505775128ULL, 1, MOVE(58, 49, 0x0)},
+    {13077459743159872663ULL, 1, MOVE(1, 18, 0x0)},
+    {13083585178836028171ULL, 1, MOVE(51, 43, 0x0)},
+    {13083585178836028171ULL, 1, MOVE(49, 41, 0x0)},
+    {13083585178836028171ULL, 1, MOVE(52, 36, 0x1)},
+    {13083736846456690667ULL, 1, MOVE(35, 28, 0x4)},
+    {13085659146319210889ULL, 1, MOVE(51, 43, 0x0)},
+    {13087764101110060548ULL, 1, MOVE(57, 42, 0x0)},
+    {13093726084369964952ULL, 3, MOVE(61, 54, 0x0)},
+    {13103253879588266001ULL, 1, MOVE(12, 28, 0x1)},
+    {13103975594287743230ULL, 2, MOVE(33, 42, 0x4)},
+    {13103975594287743230ULL, 1, MOVE(6, 21, 0x0)},
+    {13107922809615761091ULL, 1, MOVE(51, 43, 0x0)},
+    {13113832657941070234ULL, 1, MOVE(1, 11, 0x0)},
+    {13114443953114063339ULL, 2, MOVE(52, 44, 0x0)},
+    {13116231867729143094ULL, 1, MOVE(1, 18, 0x0)},
+    {13116871659083913215ULL, 1, MOVE(59, 57, 0x2)},
+    {13118109070660017807ULL, 2, MOVE(2, 9, 0x0)},
+    {13120146567935649473ULL, 1, MOVE(58, 44, 0x0)},
+    {13122240039880038859ULL, 1, MOVE(22, 21, 0x4)},
+    {13125857368287482849ULL, 108, MOVE(59, 57, 0x2)},
+    {13134599628914872215ULL, 1, MOVE(59, 57, 0x2)},
+    {13138419210126537057ULL, 1, MOVE(12, 28, 0x1)},
+    {13138419210126537057ULL, 1, MOVE(18, 35, 0x4)},
+    {13141918964415820484ULL, 2, MOVE(61, 25, 0x0)},
+    {13141918964415820484ULL, 1, MOVE(42, 52, 0x0)},
+    {13154287382139801668ULL, 2, MOVE(11, 27, 0x1)},
+    {13159340431878718416ULL, 1, MOVE(57, 42, 0x0)},
+    {13161278961864926647ULL, 2, MOVE(8, 16, 0x0)},
+    {13161278961864926647ULL, 1, MOVE(2, 29, 0x0)},
+    {13161278961864926647ULL, 1, MOVE(1, 18, 0x0)},
+    {13162821910944742601ULL, 49, MOVE(6, 21, 0x0)},
+    {13162821910944742601ULL, 1, MOVE(29, 36, 0x4)},
+    {13166198032920128500ULL, 3, MOVE(52, 44, 0x0)},
+    {13169631616131953290ULL, 1, MOVE(2, 9, 0x0)},
+    {13171490845196327797ULL, 3, MOVE(57, 42, 0x0)},
+    {13171490845196327797ULL, 2, MOVE(62, 52, 0x0)},
+    {13178887867777009004ULL, 4, MOVE(57, 42, 0x0)},
+    {13190822679211346468ULL, 2, MOVE(4, 31, 0x0)},
+    {13190822679211346468ULL, 1, MOVE(11, 27, 0x1)},
+    {13193787331723329413ULL, 1, MOVE(2, 9, 0x0)},
+    {13194467217726121205ULL, 1, MOVE(27, 35, 0x0)},
+    {13195742579694599230ULL, 2, MOVE(49, 41, 0x0)},
+    {13196157732437213838ULL, 1, MOVE(59, 57, 0x2)},
+    {13205829805726149399ULL, 1, MOVE(51, 43, 0x0)},
+    {13206596365446255929ULL, 2, MOVE(5, 14, 0x0)},
+    {13207345842347313003ULL, 1, MOVE(61, 52, 0x0)},
+    {13211197149147348207ULL, 3, MOVE(58, 51, 0x0)},
+    {13211197149147348207ULL, 2, MOVE(53, 37, 0x1)},
+    {13211197149147348207ULL, 2, MOVE(54, 46, 0x0)},
+    {13211197149147348207ULL, 1, MOVE(58, 44, 0x0)},
+    {13213591585482280267ULL, 1, MOVE(3, 1, 0x2)},
+    {13214640265658506661ULL, 2, MOVE(2, 9, 0x0)},
+    {13227611174162611594ULL, 5, MOVE(53, 45, 0x0)},
+    {13228234276238145363ULL, 1, MOVE(13, 29, 0x1)},
+    {13228923320843567014ULL, 3, MOVE(18, 28, 0x4)},
+    {13231317052484295853ULL, 4, MOVE(60, 36, 0x4)},
+    {13231317052484295853ULL, 1, MOVE(43, 36, 0x4)},
+    {13241423753991783522ULL, 3, MOVE(2, 20, 0x0)},
+    {13241423753991783522ULL, 1, MOVE(6, 21, 0x0)},
+    {13242493330680669223ULL, 3, MOVE(10, 18, 0x0)},
+    {13246440738786193900ULL, 1, MOVE(36, 43, 0x4)},
+    {13258372258733050060ULL, 1, MOVE(53, 45, 0x0)},
+    {13261686291023139710ULL, 1, MOVE(57, 42, 0x0)},
+    {13262752226857876095ULL, 1, MOVE(57, 42, 0x0)},
+    {13272501065890819408ULL, 2, MOVE(2, 9, 0x0)},
+    {13277373605911382122ULL, 1, MOVE(2, 20, 0x0)},
+    {13277516893270027308ULL, 1, MOVE(9, 17, 0x0)},
+    {13284220688029740438ULL, 3, MOVE(2, 9, 0x0)},
+    {13284220688029740438ULL, 1, MOVE(11, 19, 0x0)},
+    {13285007707746111701ULL, 1, MOVE(37, 28, 0x4)},
+    {13285883394002734415ULL, 1, MOVE(57, 42, 0x0)},
+    {13302645672444721779ULL, 2, MOVE(3, 1, 0x2)},
+    {13305514923985005705ULL, 2, MOVE(61, 54, 0x0)},
+    {13317439597603421731ULL, 1, MOVE(57, 42, 0x0)},
+    {13329902959846751766ULL, 2, MOVE(12, 28, 0x1)},
+    {13329902959846751766ULL, 1, MOVE(6, 21, 0x0)},
+    {13336639436249145436ULL, 1, MOVE(37, 28, 0x4)},
+    {13337726644178258082ULL, 2, MOVE(12, 28, 0x1)},
+    {13337726644178258082ULL, 1, MOVE(12, 20, 0x0)},
+    {13341375905411798442ULL, 3, MOVE(8, 16, 0x0)},
+    {13341375905411798442ULL, 1, MOVE(12, 20, 0x0)},
+    {13346865458864431589ULL, 8, MOVE(12, 28, 0x1)},
+    {13346865458864431589ULL, 2, MOVE(2, 11, 0x0)},
+    {13348692867155800469ULL, 4, MOVE(62, 52, 0x0)},
+    {13348692867155800469ULL, 1, MOVE(58, 30, 0x0)},
+    {13348692867155800469ULL, 1, MOVE(54, 46, 0x0)},
+    {13351582807328510659ULL, 2, MOVE(29, 36, 0x4)},
+    {13358486058144120981ULL, 1, MOVE(33, 42, 0x4)},
+    {13361205947088884114ULL, 1, MOVE(12, 28, 0x1)},
+    {13361612893757841344ULL, 2, MOVE(55, 47, 0x0)},
+    {13362506628755188942ULL, 1, MOVE(52, 38, 0x4)},
+    {13362506628755188942ULL, 1, MOVE(57, 42, 0x0)},
+    {13368116288615836385ULL, 2, MOVE(52, 36, 0x1)},
+    {13368116288615836385ULL, 1, MOVE(54, 46, 0x0)},
+    {13373322070656627055ULL, 1, MOVE(52, 36, 0x1)},
+    {13386777882781345417ULL, 2, MOVE(44, 35, 0x4)},
+    {13391340318730681367ULL, 1, MOVE(18, 27, 0x4)},
+    {13393008549543341842ULL, 4, MOVE(62, 45, 0x0)},
+    {13393008549543341842ULL, 1, MOVE(57, 42, 0x0)},
+    {13396606202090000715ULL, 2, MOVE(57, 42, 0x0)},
+    {13396606202090000715ULL, 1, MOVE(58, 44, 0x0)},
+    {13398729801443659056ULL, 3, MOVE(1, 18, 0x0)},
+    {13404751211069413523ULL, 2, MOVE(51, 35, 0x1)},
+    {13404751211069413523ULL, 1, MOVE(51, 43, 0x0)},
+    {13407716090059049970ULL, 1, MOVE(58, 49, 0x0)},
+    {13408101798746485241ULL, 1, MOVE(58, 37, 0x0)},
+    {13409395657452281824ULL, 3, MOVE(13, 21, 0x0)},
+    {13412747078393125663ULL, 1, MOVE(49, 41, 0x0)},
+    {13412747078393125663ULL, 1, MOVE(52, 36, 0x1)},
+    {13414393408884349377ULL, 1, MOVE(55, 47, 0x0)},
+    {13416359777553781938ULL, 1, MOVE(12, 20, 0x0)},
+    {13416842735168230796ULL, 1, MOVE(57, 42, 0x0)},
+    {13421171685228884160ULL, 1, MOVE(59, 57, 0x2)},
+    {13421171685228884160ULL, 1, MOVE(53, 45, 0x0)},
+    {13425082481361065513ULL, 4, MOVE(36, 21, 0x4)},
+    {13428633108021623929ULL, 2, MOVE(62, 45, 0x0)},
+    {13436070059423381980ULL, 1, MOVE(25, 43, 0x0)},
+    {13437231237267948002ULL, 1, MOVE(15, 31, 0x1)},
+    {13439581432322925387ULL, 2, MOVE(1, 18, 0x0)},
+    {13439581432322925387ULL, 1, MOVE(6, 21, 0x0)},
+    {13439713055492419205ULL, 2, MOVE(42, 34, 0x0)},
+    {13448610030005351832ULL, 2, MOVE(53, 45, 0x0)},
+    {13448610030005351832ULL, 2, MOVE(58, 51, 0x0)},
+    {13448610030005351832ULL, 1, MOVE(52, 36, 0x1)},
+    {13450042728871674319ULL, 1, MOVE(29, 36, 0x4)},
+    {13450818358182343641ULL, 1, MOVE(57, 42, 0x0)},
+    {13452295439738373793ULL, 1, MOVE(57, 42, 0x0)},
+    {13453866467402992141ULL, 1, MOVE(1, 18, 0x0)},
+    {13456550584823013567ULL, 2, MOVE(18, 28, 0x0)},
+    {13463484867818734004ULL, 7, MOVE(11, 19, 0x0)},
+    {13463484867818734004ULL, 2, MOVE(9, 17, 0x0)},
+    {13463484867818734004ULL, 2, MOVE(12, 28, 0x1)},
+    {13463743400055512008ULL, 1, MOVE(57, 42, 0x0)},
+    {13466166913599912300ULL, 1, MOVE(29, 36, 0x4)},
+    {13466262426645202598ULL, 4, MOVE(52, 44, 0x0)},
+    {13467217899929504323ULL, 1, MOVE(54, 46, 0x0)},
+    {13467228824751132972ULL, 1, MOVE(37, 28, 0x4)},
+    {13469448620684297881ULL, 245, MOVE(6, 21, 0x0)},
+    {13469448620684297881ULL, 125, MOVE(11, 19, 0x0)},
+    {13469448620684297881ULL, 9, MOVE(4, 22, 0x0)},
+    {13469448620684297881ULL, 9, MOVE(4, 13, 0x0)},
+    {13469448620684297881ULL, 7, MOVE(29, 36, 0x4)},
+    {13469448620684297881ULL, 5, MOVE(9, 17, 0x0)},
+    {13469448620684297881ULL, 3, MOVE(6, 12, 0x0)},
+    {13478572495432542944ULL, 1, MOVE(49, 41, 0x0)},
+    {13487539935106092573ULL, 2, MOVE(61, 54, 0x0)},
+    {13487539935106092573ULL, 1, MOVE(52, 36, 0x1)},
+    {13487539935106092573ULL, 1, MOVE(53, 37, 0x1)},
+    {13488628011961912854ULL, 1, MOVE(13, 21, 0x0)},
+    {13499872913583089425ULL, 1, MOVE(1, 18, 0x0)},
+    {13499959356336054370ULL, 1, MOVE(51, 43, 0x0)},
+    {13503268914470119261ULL, 2, MOVE(52, 36, 0x1)},
+    {13506578415349676552ULL, 19, MOVE(42, 36, 0x0)},
+    {13511606808887857926ULL, 2, MOVE(13, 29, 0x1)},
+    {13514239744859327346ULL, 1, MOVE(12, 28, 0x1)},
+    {13521105088988198766ULL, 566, MOVE(3, 1, 0x2)},
+    {13521105088988198766ULL, 34, MOVE(12, 20, 0x0)},
+    {13521105088988198766ULL, 7, MOVE(4, 11, 0x0)},
+    {13521105088988198766ULL, 4, MOVE(6, 21, 0x0)},
+    {13521105088988198766ULL, 1, MOVE(31, 45, 0x4)},
+    {13522183610137157541ULL, 1, MOVE(48, 40, 0x0)},
+    {13545706527923978710ULL, 1, MOVE(37, 28, 0x4)},
+    {13546686907497677169ULL, 2, MOVE(43, 36, 0x4)},
+    {13549391744590295184ULL, 1, MOVE(9, 17, 0x0)},
+    {13549391744590295184ULL, 1, MOVE(6, 12, 0x0)},
+    {13551234666625468717ULL, 2, MOVE(42, 36, 0x4)},
+    {13555015828291031229ULL, 3, MOVE(61, 25, 0x0)},
+    {13555015828291031229ULL, 2, MOVE(49, 41, 0x0)},
+    {13555015828291031229ULL, 1, MOVE(61, 52, 0x0)},
+    {13559794182747439537ULL, 1, MOVE(52, 36, 0x1)},
+    {13564849288240637491ULL, 1, MOVE(52, 44, 0x0)},
+    {13567480777305120656ULL, 1, MOVE(43, 36, 0x4)},
+    {13568805724748171974ULL, 4, MOVE(59, 57, 0x2)},
+    {13568805724748171974ULL, 2, MOVE(53, 37, 0x1)},
+    {13568805724748171974ULL, 1, MOVE(52, 36, 0x1)},
+    {13569620647532257995ULL, 178, MOVE(58, 37, 0x0)},
+    {13569620647532257995ULL, 46, MOVE(57, 42, 0x0)},
+    {13569620647532257995ULL, 1, MOVE(52, 44, 0x0)},
+    {13571954511580679232ULL, 4, MOVE(2, 9, 0x0)},
+    {13571954511580679232ULL, 1, MOVE(6, 21, 0x0)},
+    {13574086720261976204ULL, 34, MOVE(42, 36, 0x4)},
+    {13575927363730178196ULL, 5, MOVE(2, 20, 0x0)},
+    {13589025151696207350ULL, 9, MOVE(12, 28, 0x1)},
+    {13592069860347447070ULL, 1, MOVE(51, 43, 0x0)},
+    {13593598267698154836ULL, 1, MOVE(61, 52, 0x0)},
+    {13594745439207162141ULL, 2, MOVE(57, 42, 0x0)},
+    {13597165472777856074ULL, 2, MOVE(62, 45, 0x0)},
+    {13597165472777856074ULL, 1, MOVE(57, 42, 0x0)},
+    {13609012389010573043ULL, 1, MOVE(53, 37, 0x1)},
+    {13609340444917774953ULL, 1, MOVE(9, 17, 0x0)},
+    {13610454907682602994ULL, 1, MOVE(53, 37, 0x1)},
+    {13611430546585529523ULL, 3, MOVE(4, 11, 0x0)},
+    {13611605857618150832ULL, 2, MOVE(53, 37, 0x1)},
+    {13611697232999170319ULL, 3, MOVE(50, 34, 0x1)},
+    {13611697232999170319ULL, 2, MOVE(57, 42, 0x0)},
+    {13615835569174439546ULL, 3, MOVE(54, 38, 0x1)},
+    {13615896662535816178ULL, 1, MOVE(25, 32, 0x0)},
+    {13623201159966729441ULL, 15, MOVE(6, 21, 0x0)},
+    {13623201159966729441ULL, 4, MOVE(2, 20, 0x0)},
+    {13623201159966729441ULL, 2, MOVE(6, 12, 0x0)},
+    {13623201159966729441ULL, 2, MOVE(4, 13, 0x0)},
+    {13623201159966729441ULL, 2, MOVE(5, 12, 0x0)},
+    {13625994312215874154ULL, 2, MOVE(15, 23, 0x0)},
+    {13626982525698986006ULL, 1, MOVE(52, 36, 0x1)},
+    {13627151637631030236ULL, 1, MOVE(52, 44, 0x0)},
+    {13627151637631030236ULL, 1, MOVE(54, 38, 0x1)},
+    {13627577292328807427ULL, 9, MOVE(52, 44, 0x0)},
+    {13627577292328807427ULL, 3, MOVE(54, 38, 0x1)},
+    {13627577292328807427ULL, 1, MOVE(49, 41, 0x0)},
+    {13645967238160397941ULL, 9, MOVE(52, 44, 0x0)},
+    {13645967238160397941ULL, 3, MOVE(45, 28, 0x0)},
+    {13646887350657066253ULL, 4, MOVE(6, 21, 0x0)},
+    {13646887350657066253ULL, 1, MOVE(5, 33, 0x0)},
+    {13659617480291523371ULL, 1, MOVE(59, 57, 0x2)},
+    {13662012103396197378ULL, 1, MOVE(57, 42, 0x0)},
+    {13662260861317265669ULL, 9, MOVE(62, 52, 0x0)},
+    {13662260861317265669ULL, 3, MOVE(45, 37, 0x0)},
+    {13668961710612854910ULL, 1, MOVE(58, 49, 0x0)},
+    {13673103394040306596ULL, 1, MOVE(57, 42, 0x0)},
+    {13679358632021449128ULL, 1, MOVE(11, 19, 0x0)},
+    {13680638196083069633ULL, 2, MOVE(1, 18, 0x0)},
+    {13680638196083069633ULL, 2, MOVE(2, 29, 0x0)},
+    {13680638196083069633ULL, 1, MOVE(6, 21, 0x0)},
+    {13686315263580342902ULL, 3, MOVE(57, 42, 0x0)},
+    {13692516843910547909ULL, 1, MOVE(62, 52, 0x0)},
+    {13694800412571344209ULL, 1, MOVE(11, 19, 0x0)},
+    {13695659470238995115ULL, 1, MOVE(50, 34, 0x1)},
+    {13698460425044770496ULL, 1, MOVE(36, 29, 0x4)},
+    {13701414621336784360ULL, 1, MOVE(52, 44, 0x0)},
+    {13702343412383323354ULL, 1, MOVE(58, 30, 0x0)},
+    {13708866175572207571ULL, 1, MOVE(12, 20, 0x0)},
+    {13710737241426338357ULL, 2, MOVE(6, 21, 0x0)},
+    {13710737241426338357ULL, 1, MOVE(3, 1, 0x2)},
+    {13712061606645507650ULL, 19, MOVE(2, 9, 0x0)},
+    {13712303114100584165ULL, 3, MOVE(58, 49, 0x0)},
+    {13716640496646620789ULL, 1, MOVE(52, 44, 0x0)},
+    {13721285481016295266ULL, 2, MOVE(2, 9, 0x0)},
+    {13739125101880309120ULL, 1, MOVE(49, 41, 0x0)},
+    {13742937627030917489ULL, 7, MOVE(12, 28, 0x1)},
+    {13742937627030917489ULL, 1, MOVE(14, 30, 0x1)},
+    {13744904741815830085ULL, 1, MOVE(9, 17, 0x0)},
+    {13748693895381142671ULL, 10, MOVE(37, 28, 0x4)},
+    {13749088889552319371ULL, 2, MOVE(30, 39, 0x0)},
+    {13749088889552319371ULL, 1, MOVE(30, 44, 0x0)},
+    {13753117743094411742ULL, 7, MOVE(52, 36, 0x1)},
+    {13753117743094411742ULL, 4, MOVE(58, 30, 0x0)},
+    {13753117743094411742ULL, 2, MOVE(47, 54, 0x0)},
+    {13753623335365559994ULL, 3, MOVE(2, 9, 0x0)},
+    {13756004670961073262ULL, 1, MOVE(51, 35, 0x1)},
+    {13756233132790474790ULL, 1, MOVE(34, 27, 0x4)},
+    {13756527652629741053ULL, 2, MOVE(11, 19, 0x0)},
+    {13761616721129093208ULL, 2, MOVE(1, 18, 0x0)},
+    {13761616721129093208ULL, 1, MOVE(15, 23, 0x0)},
+    {13764528106604442583ULL, 1, MOVE(53, 37, 0x1)},
+    {13772048944206015654ULL, 15, MOVE(57, 42, 0x0)},
+    {13773558618082194270ULL, 1, MOVE(42, 27, 0x0)},
+    {13775277063001850550ULL, 1, MOVE(60, 39, 0x0)},
+    {13775277063001850550ULL, 1, MOVE(51, 43, 0x0)},
+    {13778814878623985577ULL, 9, MOVE(58, 49, 0x0)},
+    {13778814878623985577ULL, 1, MOVE(53, 37, 0x1)},
+    {13778814878623985577ULL, 1, MOVE(53, 45, 0x0)},
+    {13780194952797797348ULL, 1, MOVE(58, 44, 0x0)},
+    {13781081093259822025ULL, 1, MOVE(31, 29, 0x4)},
+    {13786902070151292447ULL, 1, MOVE(62, 45, 0x0)},
+    {13786902070151292447ULL, 1, MOVE(62, 52, 0x0)},
+    {13792971579311590148ULL, 202, MOVE(12, 28, 0x1)},
+    {13792971579311590148ULL, 6, MOVE(12, 20, 0x0)},
+    {13792971579311590148ULL, 4, MOVE(14, 22, 0x0)},
+    {13792971579311590148ULL, 1, MOVE(6, 21, 0x0)},
+    {13792971579311590148ULL, 1, MOVE(1, 18, 0x0)},
+    {13793411365554578045ULL, 1, MOVE(52, 44, 0x0)},
+    {13810797048728656670ULL, 2, MOVE(51, 43, 0x0)},
+    {13815439749068769794ULL, 1, MOVE(61, 54, 0x0)},
+    {13816259637519136184ULL, 2, MOVE(51, 43, 0x0)},
+    {13816452686897890834ULL, 635, MOVE(38, 31, 0x0)},
+    {13816452686897890834ULL, 25, MOVE(38, 45, 0x4)},
+    {13818699683759293321ULL, 73, MOVE(35, 28, 0x4)},
+    {13827660929519993527ULL, 1, MOVE(57, 42, 0x0)},
+    {13828307502774228326ULL, 1, MOVE(57, 42, 0x0)},
+    {13829685675089804937ULL, 1, MOVE(57, 42, 0x0)},
+    {13830462267328348228ULL, 13, MOVE(27, 36, 0x4)},
+    {13830462267328348228ULL, 5, MOVE(29, 36, 0x4)},
+    {13833902189638692957ULL, 1, MOVE(51, 43, 0x0)},
+    {13843369711056426321ULL, 15, MOVE(35, 28, 0x4)},
+    {13856607936477302279ULL, 7, MOVE(12, 28, 0x1)},
+    {13857362112515492628ULL, 1, MOVE(6, 21, 0x0)},
+    {13858232775334722139ULL, 9, MOVE(2, 9, 0x0)},
+    {13868679603657277097ULL, 1, MOVE(58, 49, 0x0)},
+    {13871127374606016896ULL, 3, MOVE(11, 27, 0x1)},
+    {13885409755881270397ULL, 2, MOVE(29, 38, 0x4)},
+    {13885904927166342412ULL, 1, MOVE(55, 47, 0x0)},
+    {13885904927166342412ULL, 1, MOVE(35, 27, 0x0)},
+    {13887682881870634634ULL, 1, MOVE(3, 1, 0x2)},
+    {13887682881870634634ULL, 1, MOVE(12, 28, 0x1)},
+    {13891379262746357672ULL, 1, MOVE(51, 35, 0x1)},
+    {13892635447014917754ULL, 1, MOVE(62, 45, 0x0)},
+    {13892679578175421177ULL, 4, MOVE(2, 9, 0x0)},
+    {13899877989126732488ULL, 2, MOVE(13, 21, 0x0)},
+    {13899877989126732488ULL, 1, MOVE(1, 18, 0x0)},
+    {13900714196598151155ULL, 1, MOVE(4, 28, 0x4)},
+    {13906399508673441675ULL, 3, MOVE(59, 57, 0x2)},
+    {13906417954511346675ULL, 18, MOVE(2, 9, 0x0)},
+    {13906417954511346675ULL, 11, MOVE(12, 28, 0x1)},
+    {13906417954511346675ULL, 5, MOVE(14, 22, 0x0)},
+    {13911437167912736206ULL, 1, MOVE(52, 44, 0x0)},
+    {13915678949711982208ULL, 2, MOVE(4, 13, 0x0)},
+    {13916262761760573882ULL, 1, MOVE(2, 9, 0x0)},
+    {13920466616400337751ULL, 2, MOVE(44, 35, 0x4)},
+    {13920466616400337751ULL, 1, MOVE(49, 41, 0x0)},
+    {13921072136224265788ULL, 5, MOVE(60, 53, 0x0)},
+    {13921072136224265788ULL, 1, MOVE(49, 41, 0x0)},
+    {13923575865640161044ULL, 18, MOVE(58, 49, 0x0)},
+    {13932234736183596501ULL, 18, MOVE(12, 28, 0x1)},
+    {13946451681863713327ULL, 1, MOVE(1, 18, 0x0)},
+    {13959249871945833197ULL, 1, MOVE(11, 27, 0x1)},
+    {13959993333544701737ULL, 2, MOVE(9, 17, 0x0)},
+    {13970850360503204835ULL, 1, MOVE(58, 51, 0x0)},
+    {13979787711670303538ULL, 1, MOVE(58, 30, 0x0)},
+    {13979787711670303538ULL, 1, MOVE(62, 45, 0x0)},
+    {13989414337124873909ULL, 1, MOVE(9, 17, 0x0)},
+    {13989414337124873909ULL, 1, MOVE(2, 38, 0x0)},
+    {13991009012707108773ULL, 62, MOVE(59, 57, 0x2)},
+    {13991009012707108773ULL, 6, MOVE(53, 37, 0x1)},
+    {13991009012707108773ULL, 5, MOVE(54, 46, 0x0)},
+    {13991009012707108773ULL, 1, MOVE(30, 21, 0x4)},
+    {13991009012707108773ULL, 1, MOVE(62, 45, 0x0)},
+    {13991562868505081203ULL, 1, MOVE(53, 45, 0x0)},
+    {13992497681083233895ULL, 4, MOVE(30, 21, 0x4)},
+    {13992833005984236944ULL, 4, MOVE(49, 41, 0x0)},
+    {13992833005984236944ULL, 1, MOVE(61, 34, 0x0)},
+    {13993266110357345710ULL, 1, MOVE(48, 40, 0x0)},
+    {14005624384687253472ULL, 3, MOVE(6, 21, 0x0)},
+    {14006263877705367687ULL, 1, MOVE(62, 45, 0x0)},
+    {14007790439408489476ULL, 1, MOVE(59, 57, 0x2)},
+    {14012520439647040014ULL, 2, MOVE(28, 36, 0x0)},
+    {14012520439647040014ULL, 1, MOVE(11, 19, 0x0)},
+    {14015227174649208111ULL, 1, MOVE(61, 54, 0x0)},
+    {14016546289167904750ULL, 1, MOVE(48, 40, 0x0)},
+    {14026909596115215971ULL, 1, MOVE(35, 28, 0x4)},
+    {14035217114420712781ULL, 1, MOVE(13, 29, 0x1)},
+    {14035217114420712781ULL, 1, MOVE(9, 17, 0x0)},
+    {14035217114420712781ULL, 1, MOVE(13, 21, 0x0)},
+    {14037242545189244201ULL, 1, MOVE(11, 27, 0x1)},
+    {14039953157888891135ULL, 1, MOVE(51, 35, 0x1)},
+    {14046679179112457962ULL, 2, MOVE(62, 45, 0x0)},
+    {14046679179112457962ULL, 1, MOVE(51, 35, 0x1)},
+    {14049785757474249596ULL, 1, MOVE(12, 20, 0x0)},
+    {14049785757474249596ULL, 1, MOVE(12, 28, 0x1)},
+    {14052924361077828856ULL, 34, MOVE(52, 36, 0x1)},
+    {14052924361077828856ULL, 5, MOVE(54, 46, 0x0)},
+    {14052924361077828856ULL, 1, MOVE(55, 47, 0x0)},
+    {14052924361077828856ULL, 1, MOVE(58, 51, 0x0)},
+    {14052924361077828856ULL, 1, MOVE(53, 37, 0x1)},
+    {14056969851178984767ULL, 1, MOVE(54, 46, 0x0)},
+    {14064386342298776484ULL, 1, MOVE(55, 47, 0x0)},
+    {14066936134873869619ULL, 35, MOVE(4, 22, 0x0)},
+    {14066936134873869619ULL, 12, MOVE(11, 19, 0x0)},
+    {14066936134873869619ULL, 10, MOVE(29, 36, 0x4)},
+    {14066936134873869619ULL, 8, MOVE(5, 33, 0x0)},
+    {14066936134873869619ULL, 8, MOVE(5, 26, 0x0)},
+    {14066936134873869619ULL, 7, MOVE(4, 31, 0x0)},
+    {14066936134873869619ULL, 7, MOVE(8, 24, 0x1)},
+    {14066936134873869619ULL, 1, MOVE(8, 16, 0x0)},
+    {14068689509844757436ULL, 223, MOVE(52, 44, 0x0)},
+    {14074109456005363013ULL, 6, MOVE(62, 52, 0x0)},
+    {14076723074167027940ULL, 1, MOVE(9, 17, 0x0)},
+    {14077451310617672247ULL, 1, MOVE(33, 51, 0x4)},
+    {14078588428665249774ULL, 3, MOVE(58, 49, 0x0)},
+    {14079786836315397439ULL, 103, MOVE(57, 42, 0x0)},
+    {14079786836315397439ULL, 19, MOVE(49, 41, 0x0)},
+    {14079786836315397439ULL, 14, MOVE(51, 35, 0x1)},
+    {14079786836315397439ULL, 8, MOVE(51, 43, 0x0)},
+    {14079786836315397439ULL, 2, MOVE(60, 53, 0x0)},
+    {14079786836315397439ULL, 1, MOVE(60, 46, 0x0)},
+    {14079786836315397439ULL, 1, MOVE(52, 36, 0x1)},
+    {14081609280607344676ULL, 1, MOVE(2, 38, 0x0)},
+    {14083272988971352998ULL, 2, MOVE(12, 21, 0x4)},
+    {14083572275049291516ULL, 1, MOVE(3, 1, 0x2)},
+    {14084816229754768952ULL, 1, MOVE(3, 1, 0x2)},
+    {14084816229754768952ULL, 1, MOVE(13, 29, 0x1)},
+    {14089911426425302487ULL, 1, MOVE(58, 49, 0x0)},
+    {14096955807076477037ULL, 1, MOVE(53, 45, 0x0)},
+    {14099342430382020470ULL, 4, MOVE(3, 1, 0x2)},
+    {14102266913921608229ULL, 1, MOVE(62, 45, 0x0)},
+    {14102430483509011100ULL, 7, MOVE(3, 1, 0x2)},
+    {14102430483509011100ULL, 2, MOVE(13, 29, 0x1)},
+    {14103900687199990370ULL, 1, MOVE(13, 29, 0x1)},
+    {14109056509716853776ULL, 4, MOVE(52, 36, 0x1)},
+    {14110613860597664798ULL, 2, MOVE(23, 29, 0x4)},
+    {14113686490968431664ULL, 1, MOVE(27, 36, 0x4)},
+    {14116875082459419049ULL, 1, MOVE(58, 49, 0x0)},
+    {14124000791513400105ULL, 6, MOVE(11, 19, 0x0)},
+    {14124021295202225724ULL, 1, MOVE(6, 21, 0x0)},
+    {14124627038352913409ULL, 6, MOVE(34, 27, 0x4)},
+    {14125614834009875953ULL, 2, MOVE(57, 42, 0x0)},
+    {14126971901331892256ULL, 7, MOVE(62, 45, 0x0)},
+    {14126971901331892256ULL, 1, MOVE(49, 41, 0x0)},
+    {14126971901331892256ULL, 1, MOVE(52, 36, 0x1)},
+    {14127029306811574761ULL, 1, MOVE(6, 21, 0x0)},
+    {14127752415649373968ULL, 2, MOVE(52, 36, 0x1)},
+    {14140757465128189612ULL, 1, MOVE(51, 42, 0x4)},
+    {14141961364535097311ULL, 1, MOVE(58, 49, 0x0)},
+    {14143150030531999970ULL, 11, MOVE(5, 33, 0x0)},
+    {14143150030531999970ULL, 11, MOVE(11, 19, 0x0)},
+    {14143150030531999970ULL, 7, MOVE(4, 22, 0x0)},
+    {14143150030531999970ULL, 5, MOVE(4, 13, 0x0)},
+    {14143150030531999970ULL, 4, MOVE(5, 12, 0x0)},
+    {14162427766673015610ULL, 7, MOVE(30, 12, 0x4)},
+    {14162427766673015610ULL, 6, MOVE(60, 51, 0x0)},
+    {14162427766673015610ULL, 4, MOVE(55, 39, 0x1)},
+    {14162427766673015610ULL, 2, MOVE(53, 37, 0x1)},
+    {14162427766673015610ULL, 1, MOVE(30, 51, 0x0)},
+    {14164353473792241366ULL, 3, MOVE(52, 36, 0x1)},
+    {14166941894700718919ULL, 2, MOVE(10, 26, 0x1)},
+    {14166941894700718919ULL, 1, MOVE(1, 18, 0x0)},
+    {14168783488614219039ULL, 7, MOVE(27, 35, 0x0)},
+    {14175409078462047868ULL, 2, MOVE(62, 45, 0x0)},
+    {14176456181683956893ULL, 1, MOVE(61, 54, 0x0)},
+    {14177085116817708326ULL, 2, MOVE(6, 21, 0x0)},
+    {14177085116817708326ULL, 1, MOVE(9, 17, 0x0)},
+    {14177085116817708326ULL, 1, MOVE(11, 27, 0x1)},
+    {14177085116817708326ULL, 1, MOVE(1, 18, 0x0)},
+    {14179432967541022071ULL, 1, MOVE(9, 17, 0x0)},
+    {14182915815979105983ULL, 1, MOVE(1, 18, 0x0)},
+    {14183952477480427245ULL, 1, MOVE(18, 35, 0x4)},
+    {14185263731809176244ULL, 2, MOVE(9, 17, 0x0)},
+    {14185263731809176244ULL, 2, MOVE(11, 19, 0x0)},
+    {14186092957451021001ULL, 1, MOVE(51, 43, 0x0)},
+    {14187747429258027876ULL, 1, MOVE(52, 36, 0x1)},
+    {14194279687717433392ULL, 1, MOVE(12, 20, 0x0)},
+    {14196129766178819830ULL, 2, MOVE(50, 43, 0x4)},
+    {14198307122025381492ULL, 3, MOVE(62, 52, 0x0)},
+    {14198307122025381492ULL, 1, MOVE(58, 51, 0x0)},
+    {14198307122025381492ULL, 1, MOVE(49, 41, 0x0)},
+    {14198946862892319371ULL, 1, MOVE(57, 42, 0x0)},
+    {14202440315533356840ULL, 13, MOVE(62, 45, 0x0)},
+    {14202440315533356840ULL, 1, MOVE(61, 52, 0x0)},
+    {14203952494545290658ULL, 4, MOVE(6, 12, 0x0)},
+    {14203952494545290658ULL, 1, MOVE(4, 11, 0x0)},
+    {14206057971167956005ULL, 1, MOVE(57, 42, 0x0)},
+    {14206768912377336349ULL, 1, MOVE(61, 34, 0x0)},
+    {14207478506096487175ULL, 3, MOVE(58, 30, 0x0)},
+    {14210434252865569227ULL, 9, MOVE(57, 42, 0x0)},
+    {14210434252865569227ULL, 3, MOVE(62, 45, 0x0)},
+    {14210434252865569227ULL, 2, MOVE(51, 35, 0x1)},
+    {14210434252865569227ULL, 1, MOVE(49, 41, 0x0)},
+    {14210563145996024942ULL, 5, MOVE(6, 21, 0x0)},
+    {14210563145996024942ULL, 4, MOVE(1, 18, 0x0)},
+    {14210563145996024942ULL, 1, MOVE(5, 26, 0x0)},
+    {14212825924053235854ULL, 93, MOVE(57, 42, 0x0)},
+    {14222169435220960465ULL, 1, MOVE(43, 36, 0x4)},
+    {14222378995784290494ULL, 10, MOVE(60, 36, 0x4)},
+    {14222378995784290494ULL, 7, MOVE(43, 36, 0x4)},
+    {14227232172506534851ULL, 1, MOVE(57, 42, 0x0)},
+    {14232161385168274452ULL, 1, MOVE(25, 32, 0x0)},
+    {14237563128855007908ULL, 1, MOVE(34, 27, 0x4)},
+    {14242328808468415170ULL, 5, MOVE(6, 21, 0x0)},
+    {14242785002680921748ULL, 1, MOVE(57, 42, 0x0)},
+    {14243361845091838596ULL, 1, MOVE(12, 28, 0x1)},
+    {14243878172982361627ULL, 3, MOVE(58, 51, 0x0)},
+    {14243878172982361627ULL, 3, MOVE(54, 38, 0x1)},
+    {14243878172982361627ULL, 1, MOVE(53, 37, 0x1)},
+    {14252444554175421723ULL, 2, MOVE(3, 1, 0x2)},
+    {14255997158565010695ULL, 1, MOVE(5, 23, 0x0)},
+    {14260321492544579168ULL, 1, MOVE(36, 27, 0x4)},
+    {14260802478759173411ULL, 7, MOVE(15, 23, 0x0)},
+    {14260802478759173411ULL, 1, MOVE(4, 13, 0x0)},
+    {14260802478759173411ULL, 1, MOVE(11, 19, 0x0)},
+    {14261056271690753593ULL, 2, MOVE(4, 13, 0x0)},
+    {14261056271690753593ULL, 1, MOVE(1, 18, 0x0)},
+    {14262860762636867452ULL, 1, MOVE(12, 28, 0x1)},
+    {14266629522074821188ULL, 2, MOVE(59, 57, 0x2)},
+    {14269622014641597761ULL, 1, MOVE(58, 49, 0x0)},
+    {14276952446407585362ULL, 1, MOVE(58, 49, 0x0)},
+    {14279505864665860152ULL, 2, MOVE(2, 9, 0x0)},
+    {14279505864665860152ULL, 1, MOVE(13, 29, 0x1)},
+    {14280312632572258542ULL, 1, MOVE(13, 29, 0x1)},
+    {14280573367926136120ULL, 5, MOVE(9, 25, 0x1)},
+    {14292005630350246568ULL, 1, MOVE(5, 33, 0x0)},
+    {14296547635220651976ULL, 3, MOVE(48, 40, 0x0)},
+    {14296547635220651976ULL, 1, MOVE(58, 51, 0x0)},
+    {14302680488846858708ULL, 1, MOVE(50, 34, 0x1)},
+    {14302680488846858708ULL, 1, MOVE(52, 44, 0x0)},
+    {14302680488846858708ULL, 1, MOVE(49, 41, 0x0)},
+    {14314974115377921439ULL, 1, MOVE(27, 42, 0x4)},
+    {14317931068357060781ULL, 2, MOVE(59, 57, 0x2)},
+    {14319812193453475101ULL, 18, MOVE(42, 27, 0x0)},
+    {14319812193453475101ULL, 8, MOVE(58, 49, 0x0)},
+    {14320542999715734684ULL, 2, MOVE(12, 28, 0x1)},
+    {14326773633869862730ULL, 1, MOVE(2, 9, 0x0)},
+    {14328201282560909952ULL, 1, MOVE(54, 46, 0x0)},
+    {14329179100915416275ULL, 1, MOVE(12, 28, 0x1)},
+    {14330686228400927699ULL, 1, MOVE(58, 49, 0x0)},
+    {14345698562420743639ULL, 1, MOVE(57, 42, 0x0)},
+    {14345698562420743639ULL, 1, MOVE(37, 28, 0x4)},
+    {14349640613882398154ULL, 1, MOVE(4, 31, 0x0)},
+    {14351165018859868986ULL, 1, MOVE(61, 54, 0x0)},
+    {14351330518235973048ULL, 1, MOVE(53, 37, 0x1)},
+    {14357036702557591110ULL, 1, MOVE(29, 36, 0x4)},
+    {14357792636600166676ULL, 1, MOVE(49, 41, 0x0)},
+    {14365593945777905556ULL, 1, MOVE(54, 46, 0x0)},
+    {14370915807794977720ULL, 5, MOVE(11, 27, 0x1)},
+    {14384292426140356867ULL, 1, MOVE(2, 9, 0x0)},
+    {14389992183858170758ULL, 2, MOVE(52, 44, 0x0)},
+    {14390437899162840020ULL, 2, MOVE(2, 3, 0x0)},
+    {14396461202487592396ULL, 1, MOVE(57, 42, 0x0)},
+    {14398524719472129382ULL, 1, MOVE(57, 51, 0x0)},
+    {14404609107317248067ULL, 2, MOVE(62, 45, 0x0)},
+    {14404609107317248067ULL, 1, MOVE(51, 43, 0x0)},
+    {14408029037575055675ULL, 1, MOVE(11, 27, 0x1)},
+    {14408368519134467182ULL, 1, MOVE(59, 57, 0x2)},
+    {14410682677787280767ULL, 3, MOVE(57, 42, 0x0)},
+    {14410682677787280767ULL, 1, MOVE(53, 45, 0x0)},
+    {14410682677787280767ULL, 1, MOVE(58, 51, 0x0)},
+    {14412623096363382726ULL, 3, MOVE(52, 44, 0x0)},
+    {14412623096363382726ULL, 1, MOVE(58, 49, 0x0)},
+    {14412623096363382726ULL, 1, MOVE(51, 43, 0x0)},
+    {14413491166405804459ULL, 75, MOVE(48, 40, 0x0)},
+    {14413491166405804459ULL, 16, MOVE(62, 52, 0x0)},
+    {14413491166405804459ULL, 14, MOVE(36, 29, 0x4)},
+    {14413491166405804459ULL, 3, MOVE(58, 51, 0x0)},
+    {14414773230134547662ULL, 5, MOVE(3, 1, 0x2)},
+    {14417823256763608663ULL, 47, MOVE(1, 18, 0x0)},
+    {14417823256763608663ULL, 5, MOVE(9, 17, 0x0)},
+    {14418722352261270110ULL, 2, MOVE(4, 12, 0x0)},
+    {14418722352261270110ULL, 1, MOVE(15, 31, 0x1)},
+    {14418722352261270110ULL, 1, MOVE(2, 11, 0x0)},
+    {14418722352261270110ULL, 1, MOVE(8, 16, 0x0)},
+    {14420659286376746430ULL, 1, MOVE(49, 41, 0x0)},
+    {14425747161829689835ULL, 1, MOVE(3, 1, 0x2)},
+    {14429045445089026046ULL, 1, MOVE(49, 33, 0x1)},
+    {14431444792400727475ULL, 1, MOVE(55, 47, 0x0)},
+    {14431969694946982129ULL, 1, MOVE(62, 45, 0x0)},
+    {14434582203397238564ULL, 1, MOVE(6, 21, 0x0)},
+    {14438512631938665073ULL, 1, MOVE(1, 18, 0x0)},
+    {14440533680718379958ULL, 1, MOVE(58, 49, 0x0)},
+    {14443767795450437274ULL, 1, MOVE(13, 29, 0x1)},
+    {14443767795450437274ULL, 1, MOVE(12, 20, 0x0)},
+    {14444130625228520336ULL, 1, MOVE(52, 44, 0x0)},
+    {14444130625228520336ULL, 1, MOVE(51, 43, 0x0)},
+    {14449998722198719077ULL, 1, MOVE(59, 57, 0x2)},
+    {14452726620559641518ULL, 1, MOVE(58, 51, 0x0)},
+    {14452726620559641518ULL, 1, MOVE(52, 44, 0x0)},
+    {14452726620559641518ULL, 1, MOVE(54, 38, 0x1)},
+    {14452726620559641518ULL, 1, MOVE(58, 37, 0x0)},
+    {14454466804239274161ULL, 1, MOVE(52, 44, 0x0)},
+    {14454719697971791844ULL, 3, MOVE(52, 44, 0x0)},
+    {14455816853459088796ULL, 1, MOVE(62, 45, 0x0)},
+    {14464778642202686683ULL, 1, MOVE(2, 20, 0x0)},
+    {14472648773346339563ULL, 2, MOVE(1, 18, 0x0)},
+    {14478323156919206081ULL, 1, MOVE(52, 44, 0x0)},
+    {14478622848732650059ULL, 11, MOVE(9, 17, 0x0)},
+    {14478622848732650059ULL, 3, MOVE(11, 19, 0x0)},
+    {14478622848732650059ULL, 1, MOVE(12, 28, 0x1)},
+    {14480999489121168428ULL, 3, MOVE(11, 27, 0x1)},
+    {14481033195800986190ULL, 2, MOVE(52, 44, 0x0)},
+    {14483204128172795756ULL, 7, MOVE(61, 52, 0x0)},
+    {14483204128172795756ULL, 2, MOVE(61, 25, 0x0)},
+    {14483204128172795756ULL, 1, MOVE(49, 41, 0x0)},
+    {14485013861825370416ULL, 1, MOVE(37, 28, 0x4)},
+    {14487355113066472336ULL, 1, MOVE(49, 41, 0x0)},
+    {14487355113066472336ULL, 1, MOVE(51, 35, 0x1)},
+    {14487611916473072118ULL, 1, MOVE(2, 9, 0x0)},
+    {14488793193427279900ULL, 1, MOVE(52, 44, 0x0)},
+    {14488793193427279900ULL, 1, MOVE(49, 41, 0x0)},
+    {14491830428617038326ULL, 1, MOVE(42, 36, 0x4)},
+    {14495438768709609223ULL, 2, MOVE(57, 42, 0x0)},
+    {14496368617218115988ULL, 1, MOVE(57, 42, 0x0)},
+    {14497967459763721915ULL, 7, MOVE(57, 42, 0x0)},
+    {14499287725172837034ULL, 2, MOVE(52, 44, 0x0)},
+    {14500376946479100129ULL, 61, MOVE(59, 57, 0x2)},
+    {14500376946479100129ULL, 36, MOVE(52, 36, 0x1)},
+    {14500376946479100129ULL, 7, MOVE(53, 37, 0x1)},
+    {14500376946479100129ULL, 1, MOVE(54, 46, 0x0)},
+    {14500376946479100129ULL, 1, MOVE(52, 44, 0x0)},
+    {14501919336883904322ULL, 1, MOVE(58, 49, 0x0)},
+    {14508358123612331416ULL, 1, MOVE(54, 46, 0x0)},
+    {14517200146087942421ULL, 4, MOVE(11, 27, 0x1)},
+    {14517200146087942421ULL, 2, MOVE(9, 17, 0x0)},
+    {14517200146087942421ULL, 1, MOVE(12, 28, 0x1)},
+    {14517200146087942421ULL, 1, MOVE(1, 18, 0x0)},
+    {14521847278016548562ULL, 1, MOVE(57, 42, 0x0)},
+    {14523082442014246235ULL, 1, MOVE(12, 28, 0x1)},
+    {14524731918890749867ULL, 1, MOVE(52, 44, 0x0)},
+    {14535759320407196794ULL, 1, MOVE(1, 18, 0x0)},
+    {14556489766375680219ULL, 4, MOVE(52, 36, 0x1)},
+    {14563831968270906750ULL, 18, MOVE(58, 30, 0x0)},
+    {14566983678749965803ULL, 1, MOVE(15, 23, 0x0)},
+    {14566983678749965803ULL, 1, MOVE(6, 21, 0x0)},
+    {14569855992738094309ULL, 1, MOVE(57, 42, 0x0)},
+    {14574780443284142322ULL, 2, MOVE(2, 9, 0x0)},
+    {14577919608128022166ULL, 1, MOVE(58, 44, 0x0)},
+    {14581970808641791994ULL, 1, MOVE(58, 44, 0x0)},
+    {14584230869916330402ULL, 1, MOVE(51, 43, 0x0)},
+    {14587904482859630682ULL, 5, MOVE(51, 43, 0x0)},
+    {14588078623545708101ULL, 3, MOVE(57, 51, 0x0)},
+    {14588135369666616740ULL, 19, MOVE(18, 28, 0x4)},
+    {14594296190564348847ULL, 1, MOVE(12, 28, 0x1)},
+    {14596593045753694941ULL, 4, MOVE(12, 28, 0x1)},
+    {14600436452788189562ULL, 9, MOVE(59, 57, 0x2)},
+    {14600983574997182927ULL, 5, MOVE(13, 21, 0x0)},
+    {14603809311528544428ULL, 1, MOVE(2, 9, 0x0)},
+    {14611298026624942617ULL, 2, MOVE(62, 52, 0x0)},
+    {14611490457702194744ULL, 6, MOVE(58, 49, 0x0)},
+    {14611490457702194744ULL, 1, MOVE(62, 45, 0x0)},
+    {14617925654710251079ULL, 2, MOVE(62, 52, 0x0)},
+    {14622593022499338218ULL, 20, MOVE(57, 42, 0x0)},
+    {14627520605259659011ULL, 1, MOVE(26, 33, 0x0)},
+    {14627525796001050548ULL, 5, MOVE(57, 42, 0x0)},
+    {14627525796001050548ULL, 1, MOVE(49, 41, 0x0)},
+    {14632348881051229564ULL, 1, MOVE(25, 32, 0x0)},
+    {14633532450326116898ULL, 41, MOVE(6, 21, 0x0)},
+    {14633532450326116898ULL, 6, MOVE(9, 17, 0x0)},
+    {14633532450326116898ULL, 5, MOVE(12, 28, 0x1)},
+    {14633532450326116898ULL, 1, MOVE(14, 22, 0x0)},
+    {14633637952186163950ULL, 1, MOVE(2, 29, 0x4)},
+    {14641472080953146293ULL, 5, MOVE(45, 36, 0x4)},
+    {14641983572121392330ULL, 1, MOVE(2, 38, 0x0)},
+    {14648690975691689926ULL, 1, MOVE(52, 44, 0x0)},
+    {14649498753800946623ULL, 1, MOVE(62, 45, 0x0)},
+    {14651848586187801489ULL, 1, MOVE(2, 9, 0x0)},
+    {14655298396420834627ULL, 4, MOVE(61, 54, 0x0)},
+    {14656071041487488028ULL, 4, MOVE(61, 52, 0x0)},
+    {14656071041487488028ULL, 2, MOVE(62, 45, 0x0)},
+    {14659149986332415082ULL, 8, MOVE(18, 28, 0x4)},
+    {14659149986332415082ULL, 1, MOVE(4, 28, 0x4)},
+    {14660863582033825102ULL, 1, MOVE(25, 32, 0x0)},
+    {14662569612601096289ULL, 2, MOVE(1, 18, 0x0)},
+    {14662569612601096289ULL, 1, MOVE(12, 28, 0x1)},
+    {14667145161425173911ULL, 2, MOVE(2, 9, 0x0)},
+    {14667145161425173911ULL, 1, MOVE(6, 21, 0x0)},
+    {14671226531620358975ULL, 2, MOVE(51, 35, 0x1)},
+    {14671375724513095326ULL, 4, MOVE(4, 31, 0x0)},
+    {14671375724513095326ULL, 4, MOVE(6, 21, 0x0)},
+    {14671375724513095326ULL, 1, MOVE(2, 38, 0x0)},
+    {14674626862903495671ULL, 1, MOVE(42, 27, 0x4)},
+    {14676951179810983636ULL, 1, MOVE(58, 37, 0x0)},
+    {14692076050605415250ULL, 1, MOVE(37, 28, 0x4)},
+    {14697636540982072933ULL, 1, MOVE(62, 52, 0x0)},
+    {14702853051016393964ULL, 1, MOVE(13, 29, 0x1)},
+    {14707574055850480478ULL, 1, MOVE(1, 18, 0x0)},
+    {14711377200923721030ULL, 71, MOVE(57, 42, 0x0)},
+    {14711377200923721030ULL, 35, MOVE(58, 30, 0x0)},
+    {14711377200923721030ULL, 22, MOVE(36, 27, 0x4)},
+    {14711377200923721030ULL, 2, MOVE(62, 45, 0x0)},
+    {14712829162127049420ULL, 1, MOVE(6, 21, 0x0)},
+    {14714039772444151352ULL, 1, MOVE(52, 44, 0x0)},
+    {14714912053868396420ULL, 3, MOVE(57, 42, 0x0)},
+    {14714912053868396420ULL, 2, MOVE(49, 41, 0x0)},
+    {14714912053868396420ULL, 1, MOVE(52, 36, 0x1)},
+    {14716444764161147399ULL, 4, MOVE(11, 27, 0x1)},
+    {14718917758933432890ULL, 1, MOVE(57, 42, 0x0)},
+    {14719051656280279842ULL, 1, MOVE(58, 49, 0x0)},
+    {14720379952751003434ULL, 1, MOVE(3, 1, 0x2)},
+    {14722752504102510990ULL, 42, MOVE(57, 42, 0x0)},
+    {14722752504102510990ULL, 7, MOVE(62, 45, 0x0)},
+    {14722752504102510990ULL, 5, MOVE(53, 45, 0x0)},
+    {14722752504102510990ULL, 2, MOVE(50, 34, 0x1)},
+    {14722752504102510990ULL, 2, MOVE(52, 44, 0x0)},
+    {14723228151667756608ULL, 6, MOVE(58, 44, 0x0)},
+    {14723228151667756608ULL, 5, MOVE(53, 37, 0x1)},
+    {14724152048718621144ULL, 4, MOVE(42, 36, 0x4)},
+    {14729862132680739260ULL, 1, MOVE(58, 49, 0x0)},
+    {14731085233408838516ULL, 5, MOVE(1, 18, 0x0)},
+    {14731085233408838516ULL, 5, MOVE(27, 33, 0x0)},
+    {14731085233408838516ULL, 1, MOVE(13, 21, 0x0)},
+    {14731085233408838516ULL, 1, MOVE(2, 29, 0x0)},
+    {14731993640651044091ULL, 1, MOVE(49, 41, 0x0)},
+    {14731993640651044091ULL, 1, MOVE(36, 21, 0x4)},
+    {14732534521533457304ULL, 2, MOVE(11, 27, 0x1)},
+    {14738180685062386979ULL, 2, MOVE(60, 51, 0x0)},
+    {14740734692331923815ULL, 2, MOVE(57, 42, 0x0)},
+    {14754085956677752251ULL, 14, MOVE(57, 42, 0x0)},
+    {14754085956677752251ULL, 5, MOVE(55, 47, 0x0)},
+    {14754085956677752251ULL, 3, MOVE(51, 43, 0x0)},
+    {14757279523269334431ULL, 1, MOVE(53, 45, 0x0)},
+    {14764886521043386317ULL, 148, MOVE(51, 35, 0x1)},
+    {14764886521043386317ULL, 146, MOVE(57, 42, 0x0)},
+    {14764886521043386317ULL, 83, MOVE(51, 43, 0x0)},
+    {14764886521043386317ULL, 76, MOVE(53, 37, 0x1)},
+    {14764886521043386317ULL, 44, MOVE(53, 45, 0x0)},
+    {14764886521043386317ULL, 30, MOVE(49, 41, 0x0)},
+    {14764886521043386317ULL, 6, MOVE(54, 46, 0x0)},
+    {14764886521043386317ULL, 5, MOVE(50, 34, 0x1)},
+    {14764886521043386317ULL, 2, MOVE(52, 44, 0x0)},
+    {14765216596881052415ULL, 1, MOVE(12, 28, 0x1)},
+    {14770235951822320441ULL, 1, MOVE(58, 44, 0x0)},
+    {14772672959407504852ULL, 2, MOVE(39, 37, 0x4)},
+    {14781214604342801071ULL, 2, MOVE(58, 49, 0x0)},
+    {14783785900967398601ULL, 1, MOVE(9, 17, 0x0)},
+    {14783785900967398601ULL, 1, MOVE(13, 29, 0x1)},
+    {14783785900967398601ULL, 1, MOVE(11, 19, 0x0)},
+    {14783785900967398601ULL, 1, MOVE(13, 21, 0x0)},
+    {14783785900967398601ULL, 1, MOVE(11, 27, 0x1)},
+    {14786805514034792531ULL, 7, MOVE(5, 26, 0x0)},
+    {14786805514034792531ULL, 6, MOVE(29, 36, 0x4)},
+    {14786805514034792531ULL, 5, MOVE(5, 33, 0x0)},
+    {14786805514034792531ULL, 3, MOVE(4, 13, 0x0)},
+    {14786805514034792531ULL, 2, MOVE(11, 19, 0x0)},
+    {14786805514034792531ULL, 1, MOVE(15, 23, 0x0)},
+    {14786805514034792531ULL, 1, MOVE(9, 17, 0x0)},
+    {14787146795040931219ULL, 2, MOVE(42, 36, 0x4)},
+    {14787609022329154648ULL, 1, MOVE(12, 28, 0x1)},
+    {14791773550112962661ULL, 1, MOVE(11, 19, 0x0)},
+    {14791779790448904031ULL, 2, MOVE(6, 21, 0x0)},
+    {14793260641901885565ULL, 1, MOVE(61, 52, 0x0)},
+    {14799182543896006377ULL, 3, MOVE(51, 43, 0x0)},
+    {14801080014453631598ULL, 106, MOVE(59, 57, 0x2)},
+    {14801662614010119941ULL, 5, MOVE(13, 29, 0x1)},
+    {14801662614010119941ULL, 4, MOVE(12, 20, 0x0)},
+    {14804006501146087607ULL, 1, MOVE(49, 41, 0x0)},
+    {14804006501146087607ULL, 1, MOVE(51, 35, 0x1)},
+    {14809116808208455894ULL, 2, MOVE(57, 51, 0x0)},
+    {14811415758766476692ULL, 1, MOVE(57, 42, 0x0)},
+    {14814780719070473262ULL, 7, MOVE(13, 29, 0x1)},
+    {14814780719070473262ULL, 1, MOVE(13, 21, 0x0)},
+    {14814780719070473262ULL, 1, MOVE(11, 19, 0x0)},
+    {14820519378191008295ULL, 1, MOVE(49, 41, 0x0)},
+    {14821169066879762562ULL, 1, MOVE(61, 52, 0x0)},
+    {14821169066879762562ULL, 1, MOVE(51, 43, 0x0)},
+    {14821391139006363091ULL, 1, MOVE(2, 9, 0x0)},
+    {14822976440181273040ULL, 1, MOVE(57, 42, 0x0)},
+    {14824081911839906707ULL, 1, MOVE(3, 1, 0x2)},
+    {14824081911839906707ULL, 1, MOVE(13, 29, 0x1)},
+    {14824081911839906707ULL, 1, MOVE(12, 28, 0x1)},
+    {14830014135872996429ULL, 1, MOVE(12, 28, 0x1)},
+    {14830218056370896118ULL, 1, MOVE(58, 49, 0x0)},
+    {14835784831661649549ULL, 6, MOVE(1, 18, 0x0)},
+    {14835784831661649549ULL, 2, MOVE(11, 19, 0x0)},
+    {14835784831661649549ULL, 2, MOVE(15, 23, 0x0)},
+    {14835784831661649549ULL, 1, MOVE(29, 36, 0x4)},
+    {14835784831661649549ULL, 1, MOVE(9, 17, 0x0)},
+    {14838341121397982214ULL, 1, MOVE(36, 29, 0x4)},
+    {14838341121397982214ULL, 1, MOVE(62, 52, 0x0)},
+    {14840892961499343927ULL, 1, MOVE(34, 27, 0x4)},
+    {14844827457311525070ULL, 40, MOVE(58, 51, 0x0)},
+    {14844827457311525070ULL, 18, MOVE(53, 45, 0x0)},
+    {14844827457311525070ULL, 11, MOVE(57, 42, 0x0)},
+    {14844827457311525070ULL, 10, MOVE(58, 30, 0x0)},
+    {14844827457311525070ULL, 3, MOVE(55, 47, 0x0)},
+    {14844827457311525070ULL, 3, MOVE(53, 37, 0x1)},
+    {14844827457311525070ULL, 1, MOVE(50, 34, 0x1)},
+    {14844834356083480465ULL, 1, MOVE(58, 49, 0x0)},
+    {14844834356083480465ULL, 1, MOVE(37, 28, 0x4)},
+    {14851134896933763303ULL, 1, MOVE(58, 49, 0x0)},
+    {14859532205576770013ULL, 6, MOVE(62, 45, 0x0)},
+    {14859532205576770013ULL, 5, MOVE(52, 36, 0x1)},
+    {14859532205576770013ULL, 2, MOVE(49, 41, 0x0)},
+    {14859532205576770013ULL, 2, MOVE(54, 46, 0x0)},
+    {14859532205576770013ULL, 1, MOVE(52, 44, 0x0)},
+    {14864118359694271395ULL, 1, MOVE(51, 43, 0x0)},
+    {14864224626361261496ULL, 1, MOVE(15, 23, 0x0)},
+    {14867991699566254505ULL, 1, MOVE(62, 52, 0x0)},
+    {14868657270310298543ULL, 1, MOVE(52, 44, 0x0)},
+    {14870775301755779030ULL, 1, MOVE(61, 52, 0x0)},
+    {14872605389211903863ULL, 223, MOVE(18, 35, 0x4)},
+    {14872605389211903863ULL, 41, MOVE(12, 28, 0x1)},
+    {14872605389211903863ULL, 8, MOVE(6, 21, 0x0)},
+    {14878020546722721943ULL, 42, MOVE(9, 17, 0x0)},
+    {14878020546722721943ULL, 37, MOVE(6, 21, 0x0)},
+    {14878020546722721943ULL, 7, MOVE(12, 28, 0x1)},
+    {14878020546722721943ULL, 3, MOVE(14, 22, 0x0)},
+    {14880471099355547514ULL, 1, MOVE(25, 32, 0x0)},
+    {14886941955474873389ULL, 13, MOVE(6, 21, 0x0)},
+    {14886941955474873389ULL, 7, MOVE(1, 18, 0x0)},
+    {14887904878691151812ULL, 2, MOVE(30, 12, 0x4)},
+    {14887904878691151812ULL, 2, MOVE(55, 39, 0x1)},
+    {14888651743065779626ULL, 1, MOVE(13, 21, 0x0)},
+    {14889450273862703859ULL, 1, MOVE(57, 42, 0x0)},
+    {14890203626925552659ULL, 1, MOVE(55, 47, 0x0)},
+    {14890203626925552659ULL, 1, MOVE(57, 42, 0x0)},
+    {14897174166951592272ULL, 1, MOVE(1, 18, 0x0)},
+    {14897711322401616057ULL, 4, MOVE(3, 1, 0x2)},
+    {14897711322401616057ULL, 1, MOVE(38, 45, 0x4)},
+    {14900568074434164175ULL, 1, MOVE(36, 27, 0x4)},
+    {14901221747370452102ULL, 12, MOVE(2, 9, 0x0)},
+    {14901221747370452102ULL, 1, MOVE(1, 18, 0x0)},
+    {14906832943242073855ULL, 1, MOVE(3, 1, 0x2)},
+    {14909814228649404875ULL, 1, MOVE(51, 35, 0x1)},
+    {14912355268190249406ULL, 1, MOVE(11, 27, 0x1)},
+    {14912508655231223447ULL, 56, MOVE(5, 33, 0x0)},
+    {14912508655231223447ULL, 41, MOVE(29, 36, 0x4)},
+    {14912508655231223447ULL, 12, MOVE(4, 31, 0x0)},
+    {14912508655231223447ULL, 6, MOVE(11, 19, 0x0)},
+    {14912508655231223447ULL, 5, MOVE(4, 22, 0x0)},
+    {14912508655231223447ULL, 2, MOVE(5, 12, 0x0)},
+    {14913237983732065980ULL, 1, MOVE(15, 31, 0x1)},
+    {14915169002306869447ULL, 5, MOVE(51, 43, 0x0)},
+    {14919724006323778645ULL, 1, MOVE(29, 36, 0x4)},
+    {14922599690585216164ULL, 1, MOVE(52, 36, 0x1)},
+    {14926494862855922616ULL, 1, MOVE(51, 35, 0x1)},
+    {14927682680567575209ULL, 2, MOVE(61, 54, 0x0)},
+    {14927851178373049692ULL, 1, MOVE(48, 40, 0x0)},
+    {14928208149731698549ULL, 2, MOVE(58, 51, 0x0)},
+    {14928208149731698549ULL, 1, MOVE(54, 46, 0x0)},
+    {14928208149731698549ULL, 1, MOVE(62, 45, 0x0)},
+    {14933353866647537466ULL, 1, MOVE(51, 43, 0x0)},
+    {14935808703457755782ULL, 10, MOVE(6, 21, 0x0)},
+    {14938120743895780849ULL, 11, MOVE(59, 57, 0x2)},
+    {14938120743895780849ULL, 9, MOVE(53, 37, 0x1)},
+    {14938120743895780849ULL, 1, MOVE(53, 45, 0x0)},
+    {14939675871350705947ULL, 5, MOVE(29, 36, 0x4)},
+    {14943436764319225315ULL, 1, MOVE(9, 25, 0x1)},
+    {14944237311422857184ULL, 1, MOVE(51, 35, 0x1)},
+    {14948307033173435213ULL, 1, MOVE(60, 46, 0x0)},
+    {14952938834640628275ULL, 1, MOVE(57, 42, 0x0)},
+    {14964634505381996230ULL, 6, MOVE(49, 41, 0x0)},
+    {14967932910556530892ULL, 3, MOVE(55, 47, 0x0)},
+    {14967932910556530892ULL, 3, MOVE(36, 29, 0x4)},
+    {14967932910556530892ULL, 1, MOVE(53, 45, 0x0)},
+    {14967932910556530892ULL, 1, MOVE(57, 42, 0x0)},
+    {14968096081227615330ULL, 10, MOVE(3, 1, 0x2)},
+    {14968096081227615330ULL, 7, MOVE(13, 21, 0x0)},
+    {14968096081227615330ULL, 1, MOVE(12, 28, 0x1)},
+    {14970792189213142989ULL, 1, MOVE(18, 28, 0x4)},
+    {14971796506751276884ULL, 1, MOVE(15, 23, 0x0)},
+    {14972613275860998787ULL, 1, MOVE(52, 44, 0x0)},
+    {14972968013596341006ULL, 1, MOVE(62, 52, 0x0)},
+    {14982825262317278076ULL, 8, MOVE(11, 27, 0x1)},
+    {14982825262317278076ULL, 4, MOVE(13, 29, 0x1)},
+    {14982825262317278076ULL, 3, MOVE(9, 17, 0x0)},
+    {14982825262317278076ULL, 1, MOVE(12, 28, 0x1)},
+    {14986506396781892174ULL, 1, MOVE(35, 27, 0x0)},
+    {14986774971643466684ULL, 1, MOVE(9, 17, 0x0)},
+    {14987197842980211143ULL, 13, MOVE(45, 36, 0x4)},
+    {14987928705636380328ULL, 4, MOVE(49, 41, 0x0)},
+    {14987928705636380328ULL, 1, MOVE(50, 34, 0x1)},
+    {14990841586627893834ULL, 2, MOVE(3, 1, 0x2)},
+    {14991919607099184822ULL, 2, MOVE(38, 30, 0x0)},
+    {14994908378016895015ULL, 3, MOVE(13, 29, 0x1)},
+    {14994908378016895015ULL, 3, MOVE(9, 17, 0x0)},
+    {14994908378016895015ULL, 1, MOVE(14, 22, 0x0)},
+    {14999619246349216546ULL, 1, MOVE(52, 36, 0x1)},
+    {15001211505873965993ULL, 20, MOVE(12, 28, 0x1)},
+    {15001211505873965993ULL, 5, MOVE(3, 1, 0x2)},
+    {15011036628425524009ULL, 2, MOVE(5, 14, 0x0)},
+    {15019436083464122348ULL, 1, MOVE(58, 30, 0x0)},
+    {15023077491933563204ULL, 1, MOVE(9, 17, 0x0)},
+    {15024480724403556626ULL, 2, MOVE(58, 49, 0x0)},
+    {15025247643562535925ULL, 2, MOVE(53, 37, 0x1)},
+    {15025247643562535925ULL, 1, MOVE(58, 51, 0x0)},
+    {15038002510990451730ULL, 1, MOVE(2, 9, 0x0)},
+    {15040715628957455570ULL, 4, MOVE(9, 17, 0x0)},
+    {15040715628957455570ULL, 1, MOVE(11, 19, 0x0)},
+    {15040715628957455570ULL, 1, MOVE(9, 25, 0x1)},
+    {15040715628957455570ULL, 1, MOVE(1, 18, 0x0)},
+    {15042356376484466624ULL, 1, MOVE(36, 27, 0x4)},
+    {15042907740151897088ULL, 1, MOVE(12, 28, 0x1)},
+    {15042907740151897088ULL, 1, MOVE(1, 18, 0x0)},
+    {15042907740151897088ULL, 1, MOVE(11, 27, 0x1)},
+    {15043013291014996652ULL, 12, MOVE(2, 9, 0x0)},
+    {15043013291014996652ULL, 2, MOVE(13, 29, 0x1)},
+    {15043045538022147528ULL, 1, MOVE(12, 28, 0x1)},
+    {15047779407645814786ULL, 2, MOVE(62, 45, 0x0)},
+    {15047779407645814786ULL, 1, MOVE(49, 41, 0x0)},
+    {15047779407645814786ULL, 1, MOVE(51, 43, 0x0)},
+    {15050372857523882776ULL, 1, MOVE(58, 49, 0x0)},
+    {15055795237418400898ULL, 1, MOVE(2, 9, 0x0)},
+    {15056516110695468934ULL, 3, MOVE(4, 12, 0x0)},
+    {15059146169660328994ULL, 1, MOVE(6, 21, 0x0)},
+    {15061851387083764627ULL, 1, MOVE(52, 36, 0x1)},
+    {15066403302076971087ULL, 1, MOVE(14, 30, 0x1)},
+    {15067101762169750392ULL, 4, MOVE(12, 28, 0x1)},
+    {15072701915600022178ULL, 1, MOVE(3, 1, 0x2)},
+    {15075727771507211283ULL, 6, MOVE(53, 45, 0x0)},
+    {15075727771507211283ULL, 3, MOVE(49, 41, 0x0)},
+    {15075727771507211283ULL, 1, MOVE(55, 47, 0x0)},
+    {15078526503536851862ULL, 1, MOVE(48, 32, 0x1)},
+    {15080133942991294863ULL, 1, MOVE(1, 18, 0x0)},
+    {15080344919695872854ULL, 12, MOVE(6, 21, 0x0)},
+    {15080344919695872854ULL, 10, MOVE(1, 18, 0x0)},
+    {15081721224437883785ULL, 1, MOVE(62, 45, 0x0)},
+    {15084134750932415803ULL, 1, MOVE(51, 35, 0x1)},
+    {15085865362834083066ULL, 1, MOVE(51, 35, 0x1)},
+    {15090543245635307054ULL, 2, MOVE(59, 57, 0x2)},
+    {15093700431420768837ULL, 24, MOVE(36, 27, 0x4)},
+    {15095885281735851699ULL, 22, MOVE(58, 49, 0x0)},
+    {15100931190156258941ULL, 3, MOVE(12, 20, 0x0)},
+    {15102842385850172257ULL, 4, MOVE(58, 49, 0x0)},
+    {15108070161034984777ULL, 1, MOVE(15, 31, 0x1)},
+    {15108273603392009846ULL, 3, MOVE(28, 12, 0x0)},
+    {15108273603392009846ULL, 1, MOVE(2, 38, 0x0)},
+    {15115408963333091691ULL, 2, MOVE(13, 21, 0x0)},
+    {15122923832611963526ULL, 1, MOVE(43, 36, 0x4)},
+    {15123715279150201890ULL, 4, MOVE(1, 11, 0x0)},
+    {15123715279150201890ULL, 1, MOVE(9, 25, 0x1)},
+    {15123715279150201890ULL, 1, MOVE(1, 18, 0x0)},
+    {15123715279150201890ULL, 1, MOVE(9, 17, 0x0)},
+    {15126395351075533218ULL, 1, MOVE(57, 42, 0x0)},
+    {15128029146107956783ULL, 1, MOVE(60, 46, 0x0)},
+    {15128617958922077397ULL, 148, MOVE(61, 47, 0x0)},
+    {15128617958922077397ULL, 39, MOVE(61, 54, 0x0)},
+    {15128617958922077397ULL, 13, MOVE(58, 30, 0x0)},
+    {15130214919479486616ULL, 1, MOVE(27, 36, 0x4)},
+    {15133698801703490053ULL, 1, MOVE(27, 35, 0x0)},
+    {15136999190508813045ULL, 3, MOVE(3, 1, 0x2)},
+    {15136999190508813045ULL, 1, MOVE(13, 29, 0x1)},
+    {15138223181120691840ULL, 3, MOVE(58, 37, 0x0)},
+    {15138223181120691840ULL, 1, MOVE(52, 36, 0x1)},
+    {15140853210569373028ULL, 1, MOVE(62, 45, 0x0)},
+    {15141013926365093219ULL, 1, MOVE(54, 46, 0x0)},
+    {15142351408712457486ULL, 4, MOVE(62, 52, 0x0)},
+    {15144069441444492452ULL, 1, MOVE(51, 43, 0x0)},
+    {15146299086823517605ULL, 1, MOVE(2, 11, 0x0)},
+    {15146299086823517605ULL, 1, MOVE(2, 20, 0x0)},
+    {15148002233069058654ULL, 1, MOVE(51, 35, 0x1)},
+    {15148002233069058654ULL, 1, MOVE(51, 43, 0x0)},
+    {15149015201653982224ULL, 1, MOVE(12, 20, 0x0)},
+    {15149516132781732700ULL, 4, MOVE(11, 19, 0x0)},
+    {15149516132781732700ULL, 1, MOVE(15, 31, 0x1)},
+    {15157621670680083199ULL, 3, MOVE(52, 36, 0x1)},
+    {15157621670680083199ULL, 1, MOVE(42, 27, 0x0)},
+    {15160337380066147142ULL, 1, MOVE(61, 25, 0x0)},
+    {15165090375960782231ULL, 4, MOVE(35, 27, 0x0)},
+    {15166664571812775448ULL, 2, MOVE(42, 52, 0x0)},
+    {15168939739780713753ULL, 1, MOVE(57, 42, 0x0)},
+    {15169343070567365225ULL, 1, MOVE(13, 21, 0x0)},
+    {15170284939089610763ULL, 2, MOVE(42, 27, 0x4)},
+    {15172674956200401904ULL, 6, MOVE(6, 21, 0x0)},
+    {15172674956200401904ULL, 4, MOVE(11, 19, 0x0)},
+    {15172674956200401904ULL, 1, MOVE(29, 36, 0x4)},
+    {15176067252810826357ULL, 6, MOVE(37, 28, 0x4)},
+    {15176067252810826357ULL, 4, MOVE(58, 49, 0x0)},
+    {15176747765653098988ULL, 1, MOVE(53, 37, 0x1)},
+    {15176747765653098988ULL, 1, MOVE(51, 35, 0x1)},
+    {15176747765653098988ULL, 1, MOVE(50, 34, 0x1)},
+    {15178710260014237150ULL, 11, MOVE(9, 17, 0x0)},
+    {15178710260014237150ULL, 8, MOVE(12, 28, 0x1)},
+    {15178710260014237150ULL, 5, MOVE(11, 27, 0x1)},
+    {15178710260014237150ULL, 5, MOVE(6, 21, 0x0)},
+    {15178710260014237150ULL, 1, MOVE(1, 18, 0x0)},
+    {15186577159550313396ULL, 1, MOVE(58, 49, 0x0)},
+    {15187880888391144940ULL, 11, MOVE(62, 45, 0x0)},
+    {15187880888391144940ULL, 3, MOVE(51, 43, 0x0)},
+    {15187880888391144940ULL, 1, MOVE(52, 44, 0x0)},
+    {15188450156989899068ULL, 4, MOVE(11, 27, 0x1)},
+    {15191664019859527249ULL, 9, MOVE(57, 42, 0x0)},
+    {15197607163124411638ULL, 2, MOVE(57, 42, 0x0)},
+    {15199059705691937149ULL, 3, MOVE(27, 35, 0x0)},
+    {15203645580215780451ULL, 2, MOVE(62, 52, 0x0)},
+    {15206908358190368903ULL, 2, MOVE(44, 26, 0x4)},
+    {15206908358190368903ULL, 1, MOVE(53, 37, 0x1)},
+    {15208067252259670207ULL, 8, MOVE(59, 57, 0x2)},
+    {15208067252259670207ULL, 3, MOVE(52, 36, 0x1)},
+    {15208067252259670207ULL, 1, MOVE(53, 37, 0x1)},
+    {15208973919737899966ULL, 3, MOVE(60, 46, 0x0)},
+    {15208973919737899966ULL, 1, MOVE(51, 43, 0x0)},
+    {15208973919737899966ULL, 1, MOVE(51, 35, 0x1)},
+    {15212621752507211582ULL, 13, MOVE(30, 51, 0x0)},
+    {15212621752507211582ULL, 8, MOVE(30, 12, 0x4)},
+    {15212621752507211582ULL, 3, MOVE(53, 37, 0x1)},
+    {15212621752507211582ULL, 2, MOVE(55, 39, 0x1)},
+    {15212621752507211582ULL, 1, MOVE(60, 51, 0x0)},
+    {15219476474486520450ULL, 2, MOVE(30, 21, 0x4)},
+    {15235974220639487864ULL, 1, MOVE(43, 36, 0x4)},
+    {15237947796287380224ULL, 1, MOVE(26, 17, 0x0)},
+    {15241546753085229888ULL, 1, MOVE(19, 28, 0x4)},
+    {15242325501351020641ULL, 1, MOVE(6, 21, 0x0)},
+    {15244036935758725705ULL, 5, MOVE(3, 1, 0x2)},
+    {15244036935758725705ULL, 1, MOVE(29, 36, 0x4)},
+    {15244418029398614846ULL, 112, MOVE(58, 37, 0x0)},
+    {15244418029398614846ULL, 16, MOVE(52, 44, 0x0)},
+    {15247749791936861289ULL, 1, MOVE(52, 36, 0x1)},
+    {15250365695140994042ULL, 1, MOVE(54, 45, 0x4)},
+    {15253135747056524925ULL, 1, MOVE(57, 42, 0x0)},
+    {15254863164974906563ULL, 189, MOVE(18, 28, 0x4)},
+    {15258381758310631423ULL, 1, MOVE(57, 42, 0x0)},
+    {15259301564992274946ULL, 1, MOVE(48, 40, 0x0)},
+    {15259961909752990109ULL, 4, MOVE(3, 1, 0x2)},
+    {15259961909752990109ULL, 2, MOVE(11, 19, 0x0)},
+    {15261733116179973305ULL, 1, MOVE(5, 12, 0x0)},
+    {15264982431224369264ULL, 1, MOVE(2, 20, 0x0)},
+    {15265224815114118988ULL, 13, MOVE(1, 18, 0x0)},
+    {15265224815114118988ULL, 1, MOVE(4, 11, 0x0)},
+    {15265788540523754003ULL, 1, MOVE(15, 23, 0x0)},
+    {15267411468318500604ULL, 10, MOVE(37, 28, 0x4)},
+    {15270453753229027748ULL, 1, MOVE(57, 42, 0x0)},
+    {15275757087742391819ULL, 1, MOVE(51, 43, 0x0)},
+    {15276424450704986580ULL, 1, MOVE(59, 57, 0x2)},
+    {15278193525252374643ULL, 11, MOVE(58, 37, 0x0)},
+    {15278193525252374643ULL, 10, MOVE(57, 42, 0x0)},
+    {15278193525252374643ULL, 1, MOVE(52, 44, 0x0)},
+    {15278193525252374643ULL, 1, MOVE(49, 41, 0x0)},
+    {15278193525252374643ULL, 1, MOVE(57, 51, 0x0)},
+    {15278193525252374643ULL, 1, MOVE(52, 36, 0x1)},
+    {15284880592684687562ULL, 1, MOVE(55, 47, 0x0)},
+    {15286775276627142884ULL, 6, MOVE(55, 47, 0x0)},
+    {15287777072116580244ULL, 1, MOVE(51, 43, 0x0)},
+    {15288264753121107849ULL, 1, MOVE(34, 52, 0x0)},
+    {15291033815252050139ULL, 1, MOVE(51, 35, 0x1)},
+    {15292182069324320247ULL, 2, MOVE(42, 27, 0x4)},
+    {15294123370353601410ULL, 2, MOVE(53, 45, 0x0)},
+    {15294123370353601410ULL, 1, MOVE(52, 44, 0x0)},
+    {15296967767018441446ULL, 1, MOVE(37, 28, 0x4)},
+    {15301545555950680705ULL, 28, MOVE(53, 37, 0x1)},
+    {15301545555950680705ULL, 16, MOVE(57, 42, 0x0)},
+    {15301545555950680705ULL, 6, MOVE(58, 51, 0x0)},
+    {15301545555950680705ULL, 4, MOVE(36, 27, 0x4)},
+    {15301545555950680705ULL, 3, MOVE(62, 45, 0x0)},
+    {15301545555950680705ULL, 2, MOVE(55, 47, 0x0)},
+    {15303123935364238221ULL, 18, MOVE(51, 43, 0x0)},
+    {15306871103187275123ULL, 2, MOVE(59, 57, 0x2)},
+    {15307288739378316726ULL, 3, MOVE(12, 28, 0x1)},
+    {15307288739378316726ULL, 1, MOVE(12, 20, 0x0)},
+    {15307975612095806053ULL, 4, MOVE(58, 49, 0x0)},
+    {15307975612095806053ULL, 3, MOVE(52, 44, 0x0)},
+    {15310904340535262991ULL, 3, MOVE(53, 45, 0x0)},
+    {15315089471151137809ULL, 1, MOVE(8, 16, 0x0)},
+    {15315089471151137809ULL, 1, MOVE(12, 28, 0x1)},
+    {15315089471151137809ULL, 1, MOVE(12, 20, 0x0)},
+    {15319811241057226675ULL, 27, MOVE(11, 19, 0x0)},
+    {15319811241057226675ULL, 3, MOVE(6, 21, 0x0)},
+    {15323034413739400682ULL, 1, MOVE(51, 35, 0x1)},
+    {15324289494485267632ULL, 2, MOVE(48, 40, 0x0)},
+    {15326223135747431274ULL, 1, MOVE(58, 49, 0x0)},
+    {15330863956172145218ULL, 3, MOVE(62, 45, 0x0)},
+    {15337927714156842584ULL, 1, MOVE(35, 29, 0x0)},
+    {15340834388669391950ULL, 1, MOVE(53, 45, 0x0)},
+    {15340939793667601002ULL, 41, MOVE(15, 23, 0x0)},
+    {15340939793667601002ULL, 12, MOVE(11, 27, 0x1)},
+    {15340939793667601002ULL, 7, MOVE(1, 18, 0x0)},
+    {15340939793667601002ULL, 1, MOVE(5, 33, 0x0)},
+    {15343257037127173088ULL, 1, MOVE(62, 52, 0x0)},
+    {15349273696031743643ULL, 7, MOVE(33, 42, 0x4)},
+    {15349273696031743643ULL, 1, MOVE(1, 18, 0x0)},
+    {15349522559279031008ULL, 2, MOVE(52, 44, 0x0)},
+    {15358238678315362549ULL, 2, MOVE(1, 18, 0x0)},
+    {15358987855667828897ULL, 5, MOVE(28, 36, 0x0)},
+    {15367114905051249174ULL, 1, MOVE(12, 28, 0x1)},
+    {15367114905051249174ULL, 1, MOVE(13, 29, 0x1)},
+    {15370636574571035465ULL, 1, MOVE(58, 37, 0x4)},
+    {15371739946319348890ULL, 1, MOVE(53, 37, 0x1)},
+    {15372786037618742241ULL, 18, MOVE(57, 42, 0x0)},
+    {15375591455635873806ULL, 4, MOVE(51, 43, 0x0)},
+    {15375591455635873806ULL, 1, MOVE(53, 37, 0x1)},
+    {15378192192236028293ULL, 1, MOVE(12, 28, 0x1)},
+    {15383242433690783130ULL, 1, MOVE(13, 29, 0x1)},
+    {15398269115123770354ULL, 9, MOVE(38, 29, 0x0)},
+    {15398269115123770354ULL, 5, MOVE(38, 31, 0x0)},
+    {15398269115123770354ULL, 2, MOVE(18, 28, 0x4)},
+    {15402542490058345349ULL, 1, MOVE(62, 45, 0x0)},
+    {15403877859232085712ULL, 5, MOVE(27, 36, 0x4)},
+    {15403877859232085712ULL, 1, MOVE(27, 35, 0x0)},
+    {15405436995771174056ULL, 3, MOVE(33, 24, 0x0)},
+    {15406502552299956960ULL, 39, MOVE(29, 36, 0x4)},
+    {15407119587173273516ULL, 2, MOVE(35, 27, 0x0)},
+    {15412508745311090809ULL, 1, MOVE(59, 57, 0x2)},
+    {15415169050657797449ULL, 1, MOVE(33, 24, 0x0)},
+    {15415169050657797449ULL, 1, MOVE(33, 42, 0x4)},
+    {15417136991538114822ULL, 6, MOVE(43, 36, 0x4)},
+    {15419048708294904890ULL, 13, MOVE(52, 36, 0x1)},
+    {15419048708294904890ULL, 3, MOVE(57, 42, 0x0)},
+    {15423599021888432283ULL, 1, MOVE(58, 44, 0x0)},
+    {15425497357719736839ULL, 15, MOVE(5, 26, 0x0)},
+    {15425642385338135756ULL, 1, MOVE(38, 29, 0x4)},
+    {15427448072840118952ULL, 1, MOVE(6, 21, 0x0)},
+    {15428353735287155871ULL, 1, MOVE(60, 36, 0x4)},
+    {15428941850126800241ULL, 2, MOVE(51, 43, 0x0)},
+    {15437154050935256964ULL, 1, MOVE(18, 28, 0x4)},
+    {15437154050935256964ULL, 1, MOVE(4, 28, 0x4)},
+    {15445616416013213257ULL, 1, MOVE(3, 1, 0x2)},
+    {15446006290334099400ULL, 2, MOVE(1, 18, 0x0)},
+    {15447249870531398245ULL, 1, MOVE(43, 35, 0x0)},
+    {15454196075117080876ULL, 1, MOVE(2, 9, 0x0)},
+    {15466321103651634401ULL, 1, MOVE(28, 36, 0x0)},
+    {15466321103651634401ULL, 1, MOVE(5, 26, 0x0)},
+    {15466321103651634401ULL, 1, MOVE(9, 17, 0x0)},
+    {15466766153504069948ULL, 2, MOVE(8, 16, 0x0)},
+    {15471780677375328054ULL, 2, MOVE(12, 28, 0x1)},
+    {15471780677375328054ULL, 1, MOVE(1, 18, 0x0)},
+    {15471780677375328054ULL, 1, MOVE(6, 21, 0x0)},
+    {15471780677375328054ULL, 1, MOVE(9, 17, 0x0)},
+    {15474891012771332789ULL, 7, MOVE(51, 43, 0x0)},
+    {15478333766059373126ULL, 2, MOVE(58, 49, 0x0)},
+    {15479692973268952471ULL, 1, MOVE(5, 14, 0x0)},
+    {15482817343018728520ULL, 34, MOVE(54, 38, 0x1)},
+    {15482817343018728520ULL, 10, MOVE(49, 41, 0x0)},
+    {15482817343018728520ULL, 10, MOVE(51, 43, 0x0)},
+    {15482817343018728520ULL, 5, MOVE(61, 34, 0x0)},
+    {15488000634527952533ULL, 1, MOVE(52, 36, 0x1)},
+    {15491542972227447805ULL, 1, MOVE(4, 22, 0x0)},
+    {15492099035118891757ULL, 1, MOVE(27, 35, 0x0)},
+    {15502790568626811337ULL, 2, MOVE(11, 19, 0x0)},
+    {15503994200331857815ULL, 1, MOVE(58, 51, 0x0)},
+    {15503994200331857815ULL, 1, MOVE(50, 42, 0x0)},
+    {15504074575115305555ULL, 2, MOVE(6, 21, 0x0)},
+    {15507274552373016874ULL, 2, MOVE(61, 25, 0x0)},
+    {15512160511713008513ULL, 2, MOVE(57, 42, 0x0)},
+    {15512160511713008513ULL, 1, MOVE(53, 45, 0x0)},
+    {15512160511713008513ULL, 1, MOVE(57, 51, 0x0)},
+    {15512160511713008513ULL, 1, MOVE(62, 45, 0x0)},
+    {15513724526510473652ULL, 1, MOVE(51, 43, 0x0)},
+    {15518809950485859356ULL, 2, MOVE(18, 28, 0x4)},
+    {15536726938824368269ULL, 1, MOVE(49, 41, 0x0)},
+    {15538935877549568371ULL, 8, MOVE(57, 42, 0x0)},
+    {15538935877549568371ULL, 3, MOVE(60, 53, 0x0)},
+    {15541371297749655392ULL, 6, MOVE(59, 57, 0x2)},
+    {15541371297749655392ULL, 2, MOVE(36, 29, 0x4)},
+    {15541371297749655392ULL, 1, MOVE(53, 45, 0x0)},
+    {15543083409923230470ULL, 1, MOVE(6, 21, 0x0)},
+    {15545691668011886600ULL, 5, MOVE(57, 42, 0x0)},
+    {15545691668011886600ULL, 2, MOVE(50, 34, 0x1)},
+    {15545691668011886600ULL, 2, MOVE(58, 44, 0x0)},
+    {15545691668011886600ULL, 1, MOVE(62, 52, 0x0)},
+    {15552103752660043172ULL, 1, MOVE(62, 45, 0x0)},
+    {15552395560254436786ULL, 1, MOVE(49, 41, 0x0)},
+    {15559759633509874702ULL, 3, MOVE(37, 28, 0x4)},
+    {15563614289196341224ULL, 1, MOVE(52, 46, 0x0)},
+    {15565403218451770049ULL, 1, MOVE(29, 36, 0x4)},
+    {15567190529177856629ULL, 1, MOVE(6, 21, 0x0)},
+    {15575963703591521702ULL, 2, MOVE(53, 37, 0x1)},
+    {15577658622448847543ULL, 13, MOVE(59, 57, 0x2)},
+    {15577658622448847543ULL, 1, MOVE(53, 45, 0x0)},
+    {15587781267113939558ULL, 1, MOVE(58, 49, 0x0)},
+    {15600799605251911477ULL, 4, MOVE(62, 45, 0x0)},
+    {15600799605251911477ULL, 1, MOVE(57, 42, 0x0)},
+    {15601617251738118311ULL, 2, MOVE(1, 11, 0x0)},
+    {15601617251738118311ULL, 2, MOVE(5, 19, 0x0)},
+    {15601617251738118311ULL, 2, MOVE(6, 21, 0x0)},
+    {15603296731805117512ULL, 1, MOVE(58, 51, 0x0)},
+    {15612465643840114443ULL, 1, MOVE(61, 54, 0x0)},
+    {15612465643840114443ULL, 1, MOVE(53, 37, 0x1)},
+    {15614808749553031970ULL, 1, MOVE(1, 18, 0x0)},
+    {15624391706889586733ULL, 1, MOVE(51, 35, 0x1)},
+    {15624494088192279308ULL, 1, MOVE(61, 34, 0x0)},
+    {15625356518698429226ULL, 1, MOVE(62, 45, 0x0)},
+    {15638827592237059351ULL, 1, MOVE(36, 28, 0x0)},
+    {15642717968967388419ULL, 1, MOVE(37, 10, 0x4)},
+    {15643342750863056958ULL, 2, MOVE(35, 27, 0x0)},
+    {15643342750863056958ULL, 1, MOVE(58, 30, 0x0)},
+    {15643342750863056958ULL, 1, MOVE(35, 28, 0x4)},
+    {15646232861137070531ULL, 1, MOVE(53, 45, 0x0)},
+    {15646232861137070531ULL, 1, MOVE(62, 52, 0x0)},
+    {15646350575703943441ULL, 4, MOVE(55, 47, 0x0)},
+    {15646350575703943441ULL, 1, MOVE(57, 42, 0x0)},
+    {15647365035980378476ULL, 6, MOVE(58, 51, 0x0)},
+    {15647365035980378476ULL, 4, MOVE(36, 29, 0x4)},
+    {15647365035980378476ULL, 2, MOVE(58, 30, 0x0)},
+    {15655534216916741161ULL, 1, MOVE(58, 44, 0x0)},
+    {15662193920663234639ULL, 6, MOVE(51, 35, 0x1)},
+    {15662193920663234639ULL, 1, MOVE(57, 42, 0x0)},
+    {15663093853200682021ULL, 1, MOVE(52, 36, 0x1)},
+    {15665118164579494709ULL, 1, MOVE(15, 31, 0x1)},
+    {15665118164579494709ULL, 1, MOVE(11, 27, 0x1)},
+    {15670840758972587419ULL, 15, MOVE(11, 27, 0x1)},
+    {15670840758972587419ULL, 5, MOVE(1, 18, 0x0)},
+    {15670840758972587419ULL, 3, MOVE(12, 28, 0x1)},
+    {15673585780861600043ULL, 2, MOVE(3, 1, 0x2)},
+    {15675038834182613124ULL, 189, MOVE(37, 28, 0x4)},
+    {15675546052372158039ULL, 9, MOVE(12, 20, 0x0)},
+    {15678505194245743068ULL, 2, MOVE(15, 23, 0x0)},
+    {15678505194245743068ULL, 2, MOVE(1, 11, 0x0)},
+    {15678505194245743068ULL, 2, MOVE(2, 20, 0x0)},
+    {15685543904367789952ULL, 2, MOVE(2, 9, 0x0)},
+    {15693833181435269755ULL, 1, MOVE(54, 46, 0x0)},
+    {15697529732397744343ULL, 1, MOVE(3, 1, 0x2)},
+    {15702359293752011661ULL, 1, MOVE(52, 36, 0x1)},
+    {15703377938568828405ULL, 94, MOVE(57, 42, 0x0)},
+    {15703377938568828405ULL, 5, MOVE(53, 45, 0x0)},
+    {15703377938568828405ULL, 4, MOVE(51, 43, 0x0)},
+    {15703377938568828405ULL, 4, MOVE(61, 34, 0x0)},
+    {15703377938568828405ULL, 1, MOVE(53, 37, 0x1)},
+    {15703593316695087983ULL, 1, MOVE(60, 36, 0x4)},
+    {15707452986165409210ULL, 1, MOVE(62, 45, 0x0)},
+    {15707452986165409210ULL, 1, MOVE(51, 43, 0x0)},
+    {15711147837025501172ULL, 1, MOVE(4, 22, 0x0)},
+    {15711147837025501172ULL, 1, MOVE(18, 35, 0x0)},
+    {15712428185523199541ULL, 56, MOVE(2, 11, 0x0)},
+    {15712428185523199541ULL, 2, MOVE(13, 21, 0x0)},
+    {15713763924570285340ULL, 1, MOVE(13, 21, 0x0)},
+    {15716178771344594499ULL, 1, MOVE(58, 49, 0x0)},
+    {15719478130720151829ULL, 1, MOVE(57, 42, 0x0)},
+    {15724523368341727640ULL, 3, MOVE(43, 36, 0x4)},
+    {15728561661017244900ULL, 1, MOVE(2, 9, 0x0)},
+    {15728623238150956813ULL, 2, MOVE(58, 37, 0x4)},
+    {15728623238150956813ULL, 1, MOVE(62, 45, 0x0)},
+    {15729614969344158977ULL, 2, MOVE(11, 19, 0x0)},
+    {15746471319844499519ULL, 1, MOVE(57, 42, 0x0)},
+    {15750200314418573419ULL, 5, MOVE(52, 44, 0x0)},
+    {15751813382882133113ULL, 1, MOVE(21, 36, 0x4)},
+    {15763822734711992934ULL, 1, MOVE(13, 29, 0x1)},
+    {15764527119931704741ULL, 1, MOVE(4, 13, 0x0)},
+    {15765669759583131496ULL, 7, MOVE(42, 36, 0x0)},
+    {15767550864983308635ULL, 8, MOVE(52, 44, 0x0)},
+    {15767550864983308635ULL, 2, MOVE(55, 47, 0x0)},
+    {15767550864983308635ULL, 1, MOVE(48, 40, 0x0)},
+    {15767550864983308635ULL, 1, MOVE(59, 57, 0x2)},
+    {15769421243249667203ULL, 1, MOVE(62, 45, 0x0)},
+    {15769808921365253392ULL, 1, MOVE(58, 49, 0x0)},
+    {15770984337311464306ULL, 2, MOVE(52, 36, 0x1)},
+    {15770984337311464306ULL, 1, MOVE(62, 45, 0x0)},
+    {15770984337311464306ULL, 1, MOVE(58, 51, 0x0)},
+    {15776296958963014783ULL, 2, MOVE(6, 12, 0x0)},
+    {15776296958963014783ULL, 1, MOVE(8, 16, 0x0)},
+    {15781963881806604129ULL, 3, MOVE(58, 49, 0x0)},
+    {15781963881806604129ULL, 1, MOVE(50, 34, 0x1)},
+    {15783997244443500505ULL, 1, MOVE(14, 22, 0x0)},
+    {15785635894244981277ULL, 6, MOVE(55, 47, 0x0)},
+    {15785635894244981277ULL, 2, MOVE(53, 45, 0x0)},
+    {15785635894244981277ULL, 2, MOVE(57, 42, 0x0)},
+    {15785635894244981277ULL, 1, MOVE(51, 43, 0x0)},
+    {15794563882661026932ULL, 6, MOVE(42, 27, 0x0)},
+    {15806064578058778728ULL, 1, MOVE(12, 20, 0x0)},
+    {15806064578058778728ULL, 1, MOVE(8, 16, 0x0)},
+    {15806064578058778728ULL, 1, MOVE(9, 17, 0x0)},
+    {15811544210704732222ULL, 1, MOVE(18, 27, 0x4)},
+    {15817298529433757170ULL, 1, MOVE(2, 9, 0x0)},
+    {15817931984043023074ULL, 1, MOVE(10, 26, 0x1)},
+    {15819976734682014716ULL, 1, MOVE(58, 44, 0x0)},
+    {15826433042280346140ULL, 1, MOVE(60, 24, 0x0)},
+    {15843677581990472542ULL, 1, MOVE(61, 34, 0x0)},
+    {15843677581990472542ULL, 1, MOVE(57, 42, 0x0)},
+    {15844361954421418703ULL, 1, MOVE(2, 20, 0x0)},
+    {15844361954421418703ULL, 1, MOVE(2, 11, 0x0)},
+    {15849436527270876256ULL, 1, MOVE(2, 9, 0x0)},
+    {15853327233346339567ULL, 3, MOVE(12, 28, 0x1)},
+    {15853327233346339567ULL, 1, MOVE(11, 27, 0x1)},
+    {15853327233346339567ULL, 1, MOVE(6, 21, 0x0)},
+    {15854298750020998491ULL, 2, MOVE(53, 37, 0x1)},
+    {15859321947168704758ULL, 3, MOVE(2, 38, 0x0)},
+    {15862321915084623075ULL, 9, MOVE(42, 36, 0x4)},
+    {15866307651598513401ULL, 1, MOVE(53, 37, 0x1)},
+    {15866307651598513401ULL, 1, MOVE(49, 41, 0x0)},
+    {15870348251070444762ULL, 5, MOVE(51, 43, 0x0)},
+    {15871311355326417738ULL, 3, MOVE(50, 34, 0x1)},
+    {15871311355326417738ULL, 2, MOVE(53, 37, 0x1)},
+    {15871311355326417738ULL, 2, MOVE(57, 42, 0x0)},
+    {15871311355326417738ULL, 1, MOVE(54, 46, 0x0)},
+    {15871311355326417738ULL, 1, MOVE(52, 36, 0x1)},
+    {15874908871024349670ULL, 2, MOVE(57, 42, 0x0)},
+    {15886828755460865057ULL, 1, MOVE(57, 42, 0x0)},
+    {15888249554963164362ULL, 1, MOVE(3, 1, 0x2)},
+    {15897976919747503107ULL, 4, MOVE(3, 1, 0x2)},
+    {15897976919747503107ULL, 2, MOVE(13, 21, 0x0)},
+    {15897976919747503107ULL, 1, MOVE(6, 21, 0x0)},
+    {15902460390516786766ULL, 1, MOVE(35, 27, 0x0)},
+    {15903038813817600414ULL, 24, MOVE(13, 29, 0x1)},
+    {15903038813817600414ULL, 4, MOVE(11, 19, 0x0)},
+    {15903038813817600414ULL, 4, MOVE(5, 26, 0x0)},
+    {15903139063618070715ULL, 1, MOVE(2, 9, 0x0)},
+    {15904034959124157414ULL, 1, MOVE(1, 11, 0x0)},
+    {15907968204951449389ULL, 1, MOVE(12, 28, 0x1)},
+    {15909644112130344852ULL, 1, MOVE(12, 28, 0x1)},
+    {15910529589739571861ULL, 1, MOVE(28, 35, 0x4)},
+    {15911096888622699207ULL, 1, MOVE(53, 37, 0x1)},
+    {15915291554037386368ULL, 1, MOVE(45, 28, 0x0)},
+    {15915291554037386368ULL, 1, MOVE(57, 51, 0x0)},
+    {15922057144552798951ULL, 11, MOVE(58, 49, 0x0)},
+    {15922057144552798951ULL, 1, MOVE(52, 36, 0x1)},
+    {15931350434151818069ULL, 12, MOVE(55, 47, 0x0)},
+    {15931350434151818069ULL, 2, MOVE(57, 42, 0x0)},
+    {15931883991425908126ULL, 8, MOVE(58, 49, 0x0)},
+    {15934269264400316572ULL, 1, MOVE(62, 45, 0x0)},
+    {15934472863346101857ULL, 4, MOVE(62, 45, 0x0)},
+    {15935132093730882094ULL, 1, MOVE(51, 43, 0x0)},
+    {15936227981166688493ULL, 2, MOVE(53, 37, 0x1)},
+    {15940793430932476639ULL, 2, MOVE(29, 36, 0x4)},
+    {15947404463563569580ULL, 4, MOVE(51, 43, 0x0)},
+    {15947404463563569580ULL, 2, MOVE(37, 28, 0x4)},
+    {15951628119734191741ULL, 1, MOVE(58, 51, 0x0)},
+    {15956672042873563650ULL, 1, MOVE(5, 33, 0x0)},
+    {15957899179843692126ULL, 1, MOVE(28, 36, 0x0)},
+    {15958486340765317228ULL, 1, MOVE(37, 28, 0x4)},
+    {15959385010588200892ULL, 1, MOVE(6, 21, 0x0)},
+    {15959385010588200892ULL, 1, MOVE(5, 19, 0x0)},
+    {15959453154989213789ULL, 1, MOVE(27, 35, 0x0)},
+    {15959923360381684989ULL, 1, MOVE(54, 45, 0x4)},
+    {15964596494731092581ULL, 1, MOVE(58, 30, 0x0)},
+    {15966386620841321481ULL, 1, MOVE(52, 36, 0x1)},
+    {15970501872635838508ULL, 1, MOVE(52, 44, 0x0)},
+    {15983423065043880832ULL, 2, MOVE(58, 49, 0x0)},
+    {15986124350959340318ULL, 1, MOVE(33, 24, 0x0)},
+    {15986676040456203442ULL, 1, MOVE(61, 54, 0x0)},
+    {15988508608179915173ULL, 2, MOVE(29, 22, 0x0)},
+    {15988508608179915173ULL, 1, MOVE(3, 1, 0x2)},
+    {15988508608179915173ULL, 1, MOVE(4, 11, 0x0)},
+    {15990847974206992062ULL, 2, MOVE(2, 9, 0x0)},
+    {15990993257115141661ULL, 1, MOVE(2, 9, 0x0)},
+    {15991670957458639058ULL, 1, MOVE(51, 43, 0x0)},
+    {15995125720638228343ULL, 2, MOVE(59, 57, 0x2)},
+    {15998500977716238897ULL, 2, MOVE(60, 36, 0x4)},
+    {15999491478527139252ULL, 1, MOVE(11, 19, 0x0)},
+    {15999877143920231641ULL, 13, MOVE(25, 18, 0x4)},
+    {15999877143920231641ULL, 10, MOVE(25, 32, 0x0)},
+    {16000773324480086114ULL, 3, MOVE(38, 31, 0x0)},
+    {16010597998710671755ULL, 1, MOVE(62, 45, 0x0)},
+    {16011285558988782754ULL, 1, MOVE(58, 51, 0x0)},
+    {16014969072354304645ULL, 1, MOVE(58, 30, 0x0)},
+    {16015634392320258500ULL, 1, MOVE(51, 43, 0x0)},
+    {16015634392320258500ULL, 1, MOVE(52, 44, 0x0)},
+    {16023893542986799360ULL, 2, MOVE(45, 35, 0x0)},
+    {16024616944124003698ULL, 1, MOVE(11, 19, 0x0)},
+    {16026139249690003329ULL, 1, MOVE(58, 51, 0x0)},
+    {16033269815702364101ULL, 28, MOVE(58, 49, 0x0)},
+    {16038750448179474883ULL, 2, MOVE(62, 52, 0x0)},
+    {16038750448179474883ULL, 1, MOVE(53, 45, 0x0)},
+    {16041893229697429387ULL, 1, MOVE(52, 36, 0x1)},
+    {16042297656783649604ULL, 1, MOVE(2, 9, 0x0)},
+    {16042461870651309485ULL, 1, MOVE(1, 18, 0x0)},
+    {16044267728404670756ULL, 1, MOVE(2, 9, 0x0)},
+    {16044626701759485250ULL, 1, MOVE(4, 12, 0x0)},
+    {16044626701759485250ULL, 1, MOVE(27, 35, 0x0)},
+    {16045615938218708456ULL, 1, MOVE(57, 42, 0x0)},
+    {16047715529951033826ULL, 1, MOVE(42, 32, 0x0)},
+    {16051494761636724006ULL, 1, MOVE(52, 44, 0x0)},
+    {16076012578906554498ULL, 9, MOVE(2, 9, 0x0)},
+    {16076012578906554498ULL, 4, MOVE(14, 22, 0x0)},
+    {16076012578906554498ULL, 2, MOVE(12, 28, 0x1)},
+    {16076012578906554498ULL, 1, MOVE(13, 29, 0x1)},
+    {16077536440975265980ULL, 1, MOVE(62, 45, 0x0)},
+    {16079838069394318863ULL, 4, MOVE(58, 44, 0x0)},
+    {16083454359407930157ULL, 7, MOVE(52, 44, 0x0)},
+    {16083454359407930157ULL, 2, MOVE(53, 37, 0x1)},
+    {16083454359407930157ULL, 1, MOVE(52, 36, 0x1)},
+    {16084342817045449268ULL, 5, MOVE(36, 21, 0x4)},
+    {16086452201153868928ULL, 149, MOVE(12, 28, 0x1)},
+    {16086452201153868928ULL, 102, MOVE(2, 38, 0x0)},
+    {16086452201153868928ULL, 42, MOVE(6, 21, 0x0)},
+    {16086452201153868928ULL, 3, MOVE(13, 21, 0x0)},
+    {16086452201153868928ULL, 2, MOVE(12, 20, 0x0)},
+    {16086676465374949579ULL, 1, MOVE(51, 43, 0x0)},
+    {16089065205237898204ULL, 1, MOVE(60, 39, 0x0)},
+    {16092962842642909823ULL, 1, MOVE(12, 28, 0x1)},
+    {16099841706347622851ULL, 1, MOVE(52, 44, 0x0)},
+    {16100126992278844633ULL, 14, MOVE(51, 43, 0x0)},
+    {16100126992278844633ULL, 3, MOVE(49, 41, 0x0)},
+    {16100126992278844633ULL, 1, MOVE(53, 37, 0x1)},
+    {16101180021102204228ULL, 1, MOVE(12, 28, 0x1)},
+    {16107828652757440362ULL, 2, MOVE(1, 18, 0x0)},
+    {16107828652757440362ULL, 1, MOVE(9, 25, 0x1)},
+    {16108890653513171977ULL, 1, MOVE(15, 23, 0x0)},
+    {16108890653513171977ULL, 1, MOVE(1, 18, 0x0)},
+    {16108932566900142720ULL, 1, MOVE(49, 41, 0x0)},
+    {16119141201891496473ULL, 2, MOVE(52, 36, 0x1)},
+    {16122756089936506516ULL, 1, MOVE(36, 29, 0x4)},
+    {16122832041531010768ULL, 6, MOVE(6, 12, 0x0)},
+    {16124679052965644032ULL, 2, MOVE(3, 1, 0x2)},
+    {16124679052965644032ULL, 1, MOVE(12, 28, 0x1)},
+    {16124679052965644032ULL, 1, MOVE(13, 29, 0x1)},
+    {16124679052965644032ULL, 1, MOVE(8, 16, 0x0)},
+    {16125677912596589472ULL, 4, MOVE(18, 28, 0x4)},
+    {16125677912596589472ULL, 2, MOVE(4, 28, 0x4)},
+    {16130821662079137114ULL, 3, MOVE(62, 52, 0x0)},
+    {16133763465166766437ULL, 1, MOVE(57, 42, 0x0)},
+    {16134951765389151292ULL, 1, MOVE(51, 43, 0x0)},
+    {16149267697293473870ULL, 1, MOVE(1, 18, 0x0)},
+    {16160493143309711475ULL, 1, MOVE(6, 21, 0x0)},
+    {16161882633132060663ULL, 1, MOVE(49, 41, 0x0)},
+    {16165273987861084926ULL, 2, MOVE(51, 43, 0x0)},
+    {16166384984392802666ULL, 1, MOVE(52, 36, 0x1)},
+    {16166384984392802666ULL, 1, MOVE(51, 43, 0x0)},
+    {16166384984392802666ULL, 1, MOVE(49, 41, 0x0)},
+    {16170734905039444388ULL, 2, MOVE(51, 35, 0x1)},
+    {16178996912685084332ULL, 5, MOVE(37, 28, 0x4)},
+    {16184777448677083983ULL, 4, MOVE(59, 57, 0x2)},
+    {16184777448677083983ULL, 2, MOVE(52, 44, 0x0)},
+    {16185588438425045947ULL, 1, MOVE(52, 44, 0x0)},
+    {16186271518977668026ULL, 1, MOVE(52, 36, 0x1)},
+    {16187175440247651594ULL, 1, MOVE(4, 13, 0x0)},
+    {16189382886871218125ULL, 2, MOVE(12, 28, 0x1)},
+    {16191468960106392415ULL, 11, MOVE(58, 49, 0x0)},
+    {16195295210446943030ULL, 1, MOVE(13, 29, 0x1)},
+    {16195965730362404735ULL, 1, MOVE(54, 38, 0x1)},
+    {16199821166319121980ULL, 1, MOVE(59, 57, 0x2)},
+    {16200622695021112459ULL, 1, MOVE(1, 18, 0x0)},
+    {16208295745117243424ULL, 1, MOVE(59, 57, 0x2)},
+    {16208295745117243424ULL, 1, MOVE(62, 45, 0x0)},
+    {16215180617916230381ULL, 4, MOVE(62, 45, 0x0)},
+    {16220995228481948069ULL, 1, MOVE(12, 20, 0x0)},
+    {16228966911907385688ULL, 286, MOVE(58, 30, 0x0)},
+    {16228966911907385688ULL, 17, MOVE(52, 36, 0x1)},
+    {16228966911907385688ULL, 4, MOVE(53, 37, 0x1)},
+    {16231115769579433772ULL, 14, MOVE(53, 37, 0x1)},
+    {16232682458722154997ULL, 1, MOVE(52, 36, 0x1)},
+    {16232682458722154997ULL, 1, MOVE(62, 45, 0x0)},
+    {16238978743849595694ULL, 1, MOVE(53, 37, 0x1)},
+    {16240091476247615721ULL, 1, MOVE(45, 28, 0x0)},
+    {16243519254601383454ULL, 1, MOVE(57, 42, 0x0)},
+    {16244862923131964937ULL, 1, MOVE(62, 52, 0x0)},
+    {16256756974938074554ULL, 2, MOVE(42, 52, 0x0)},
+    {16257097268434136104ULL, 4, MOVE(13, 29, 0x1)},
+    {16257097268434136104ULL, 3, MOVE(2, 20, 0x0)},
+    {16262840436507318387ULL, 1, MOVE(62, 45, 0x0)},
+    {16264027291797640511ULL, 9, MOVE(58, 51, 0x0)},
+    {16264027291797640511ULL, 9, MOVE(62, 52, 0x0)},
+    {16269742679473054840ULL, 2, MOVE(11, 27, 0x1)},
+    {16269742679473054840ULL, 2, MOVE(9, 17, 0x0)},
+    {16269742679473054840ULL, 1, MOVE(12, 28, 0x1)},
+    {16269969763765474400ULL, 82, MOVE(6, 21, 0x0)},
+    {16269969763765474400ULL, 58, MOVE(9, 17, 0x0)},
+    {16269969763765474400ULL, 6, MOVE(12, 20, 0x0)},
+    {16269969763765474400ULL, 2, MOVE(15, 23, 0x0)},
+    {16276695824839541126ULL, 1, MOVE(1, 18, 0x0)},
+    {16285019043953964100ULL, 1, MOVE(13, 21, 0x0)},
+    {16286724957976613671ULL, 16, MOVE(45, 28, 0x0)},
+    {16286724957976613671ULL, 13, MOVE(58, 30, 0x0)},
+    {16286724957976613671ULL, 4, MOVE(58, 44, 0x0)},
+    {16286724957976613671ULL, 3, MOVE(58, 37, 0x0)},
+    {16286724957976613671ULL, 1, MOVE(52, 44, 0x0)},
+    {16295225101571396706ULL, 3, MOVE(11, 27, 0x1)},
+    {16295225101571396706ULL, 3, MOVE(6, 12, 0x0)},
+    {16295225101571396706ULL, 1, MOVE(1, 18, 0x0)},
+    {16298428079989731722ULL, 1, MOVE(2, 9, 0x0)},
+    {16299410025516671526ULL, 1, MOVE(58, 30, 0x0)},
+    {16299410025516671526ULL, 1, MOVE(62, 52, 0x0)},
+    {16304751831419734384ULL, 1, MOVE(2, 9, 0x0)},
+    {16307306787979267051ULL, 1, MOVE(55, 39, 0x1)},
+    {16311738673844727407ULL, 1, MOVE(61, 54, 0x0)},
+    {16312229832476337426ULL, 5, MOVE(43, 36, 0x4)},
+    {16315039211288720736ULL, 1, MOVE(2, 9, 0x0)},
+    {16322081069638909478ULL, 19, MOVE(12, 28, 0x1)},
+    {16322081069638909478ULL, 2, MOVE(2, 38, 0x0)},
+    {16322081069638909478ULL, 1, MOVE(15, 23, 0x0)},
+    {16322081069638909478ULL, 1, MOVE(9, 17, 0x0)},
+    {16322243606798646720ULL, 130, MOVE(62, 52, 0x0)},
+    {16322243606798646720ULL, 14, MOVE(55, 47, 0x0)},
+    {16328335030864989334ULL, 4, MOVE(28, 36, 0x0)},
+    {16329127678136049248ULL, 17, MOVE(13, 29, 0x1)},
+    {16329127678136049248ULL, 1, MOVE(14, 22, 0x0)},
+    {16330952840520217609ULL, 1, MOVE(3, 2, 0x0)},
+    {16330952840520217609ULL, 1, MOVE(5, 12, 0x0)},
+    {16333602040182766869ULL, 1, MOVE(57, 42, 0x0)},
+    {16338209616837166699ULL, 1, MOVE(9, 25, 0x1)},
+    {16338209616837166699ULL, 1, MOVE(4, 12, 0x0)},
+    {16339524873648102693ULL, 1, MOVE(62, 45, 0x0)},
+    {16341756237726457435ULL, 1, MOVE(13, 21, 0x0)},
+    {16343259991232979185ULL, 1, MOVE(57, 42, 0x0)},
+    {16361063422069259355ULL, 1, MOVE(12, 28, 0x1)},
+    {16367538768560379927ULL, 1, MOVE(5, 26, 0x0)},
+    {16380852200735282901ULL, 1, MOVE(46, 53, 0x0)},
+    {16383890876427829230ULL, 1, MOVE(34, 20, 0x4)},
+    {16384781760165550587ULL, 1, MOVE(1, 11, 0x0)},
+    {16387720834556272809ULL, 1, MOVE(11, 27, 0x1)},
+    {16389658443756364938ULL, 3, MOVE(30, 21, 0x4)},
+    {16395124007663035585ULL, 3, MOVE(59, 57, 0x2)},
+    {16395124007663035585ULL, 2, MOVE(52, 44, 0x0)},
+    {16406053154587549829ULL, 2, MOVE(58, 44, 0x0)},
+    {16411178209763373946ULL, 1, MOVE(10, 26, 0x1)},
+    {16413674698006998565ULL, 3, MOVE(13, 21, 0x0)},
+    {16413674698006998565ULL, 2, MOVE(11, 19, 0x0)},
+    {16415819038032855212ULL, 1, MOVE(6, 21, 0x0)},
+    {16419208563653743463ULL, 15, MOVE(18, 28, 0x4)},
+    {16422536969269099167ULL, 2, MOVE(57, 42, 0x0)},
+    {16427702868890405999ULL, 2, MOVE(62, 45, 0x0)},
+    {16442994370200959247ULL, 2, MOVE(28, 36, 0x0)},
+    {16447271290254097307ULL, 1, MOVE(18, 28, 0x4)},
+    {16450512401097393990ULL, 1, MOVE(50, 34, 0x1)},
+    {16451047249412261588ULL, 1, MOVE(58, 49, 0x0)},
+    {16451047249412261588ULL, 1, MOVE(36, 21, 0x4)},
+    {16456659206539656905ULL, 2, MOVE(11, 28, 0x4)},
+    {16457010074871104837ULL, 3, MOVE(42, 36, 0x4)},
+    {16461254064896954000ULL, 1, MOVE(59, 57, 0x2)},
+    {16465146174140577745ULL, 1, MOVE(61, 25, 0x0)},
+    {16466491163319481834ULL, 1, MOVE(62, 52, 0x0)},
+    {16467085625833133415ULL, 2, MOVE(2, 9, 0x0)},
+    {16467085625833133415ULL, 1, MOVE(12, 28, 0x1)},
+    {16469233390820467603ULL, 1, MOVE(62, 45, 0x0)},
+    {16470920449103612852ULL, 1, MOVE(8, 16, 0x0)},
+    {16479042260086204431ULL, 15, MOVE(59, 57, 0x2)},
+    {16479042260086204431ULL, 1, MOVE(51, 35, 0x1)},
+    {16479042260086204431ULL, 1, MOVE(55, 47, 0x0)},
+    {16480701036339587402ULL, 6, MOVE(58, 30, 0x0)},
+    {16480701036339587402ULL, 2, MOVE(58, 44, 0x0)},
+    {16480701036339587402ULL, 1, MOVE(55, 39, 0x1)},
+    {16481155002993949900ULL, 437, MOVE(6, 21, 0x0)},
+    {16481155002993949900ULL, 65, MOVE(9, 17, 0x0)},
+    {16481155002993949900ULL, 38, MOVE(10, 18, 0x0)},
+    {16481155002993949900ULL, 38, MOVE(1, 18, 0x0)},
+    {16481155002993949900ULL, 3, MOVE(5, 33, 0x0)},
+    {16481155002993949900ULL, 1, MOVE(8, 24, 0x1)},
+    {16483465824228383641ULL, 2, MOVE(51, 43, 0x0)},
+    {16483465824228383641ULL, 1, MOVE(42, 32, 0x0)},
+    {16485997008729725944ULL, 1, MOVE(4, 22, 0x0)},
+    {16485997008729725944ULL, 1, MOVE(5, 33, 0x0)},
+    {16500151240613196743ULL, 1, MOVE(2, 29, 0x0)},
+    {16500151240613196743ULL, 1, MOVE(9, 17, 0x0)},
+    {16507145314165356464ULL, 1, MOVE(60, 51, 0x4)},
+    {16512601130551205774ULL, 1, MOVE(42, 36, 0x4)},
+    {16513153682045033525ULL, 1, MOVE(15, 23, 0x0)},
+    {16513302113304306523ULL, 1, MOVE(25, 18, 0x4)},
+    {16519212885434601516ULL, 1, MOVE(58, 49, 0x0)},
+    {16519416918840422655ULL, 2, MOVE(19, 28, 0x4)},
+    {16522509712876901003ULL, 8, MOVE(52, 36, 0x1)},
+    {16522763457632703514ULL, 1, MOVE(15, 23, 0x0)},
+    {16522893951470712735ULL, 7, MOVE(29, 36, 0x4)},
+    {16524922263705215308ULL, 1, MOVE(59, 57, 0x2)},
+    {16530246536931435579ULL, 3, MOVE(6, 12, 0x0)},
+    {16530246536931435579ULL, 2, MOVE(13, 21, 0x0)},
+    {16533565529167163212ULL, 4, MOVE(6, 12, 0x0)},
+    {16533565529167163212ULL, 2, MOVE(6, 21, 0x0)},
+    {16536369538972414540ULL, 1, MOVE(8, 16, 0x0)},
+    {16553410113159219008ULL, 1, MOVE(5, 14, 0x0)},
+    {16566731121031870468ULL, 1, MOVE(12, 28, 0x1)},
+    {16568695407135634231ULL, 1, MOVE(18, 28, 0x4)},
+    {16573562331880924586ULL, 1, MOVE(61, 54, 0x0)},
+    {16576340125263318608ULL, 612, MOVE(57, 42, 0x0)},
+    {16576340125263318608ULL, 18, MOVE(52, 44, 0x0)},
+    {16576340125263318608ULL, 2, MOVE(57, 51, 0x0)},
+    {16576340125263318608ULL, 1, MOVE(58, 51, 0x0)},
+    {16576340125263318608ULL, 1, MOVE(49, 41, 0x0)},
+    {16576340125263318608ULL, 1, MOVE(50, 34, 0x1)},
+    {16576596393701968532ULL, 1, MOVE(51, 35, 0x1)},
+    {16576596393701968532ULL, 1, MOVE(57, 42, 0x0)},
+    {16577138756520837347ULL, 1, MOVE(9, 17, 0x0)},
+    {16583638763008261147ULL, 2, MOVE(61, 54, 0x0)},
+    {16584525557971222757ULL, 16, MOVE(33, 24, 0x0)},
+    {16584525557971222757ULL, 1, MOVE(21, 27, 0x4)},
+    {16584525557971222757ULL, 1, MOVE(8, 24, 0x1)},
+    {16589910872415471765ULL, 3, MOVE(57, 42, 0x0)},
+    {16589910872415471765ULL, 1, MOVE(51, 43, 0x0)},
+    {16590627909913132959ULL, 1, MOVE(3, 1, 0x2)},
+    {16591432098644532373ULL, 1, MOVE(61, 54, 0x0)},
+    {16591618751264102261ULL, 1, MOVE(49, 41, 0x0)},
+    {16593662882796608773ULL, 1, MOVE(6, 21, 0x0)},
+    {16600811901057831574ULL, 1, MOVE(51, 43, 0x0)},
+    {16605777566982845551ULL, 1, MOVE(53, 37, 0x1)},
+    {16605777566982845551ULL, 1, MOVE(53, 45, 0x0)},
+    {16607011228818266249ULL, 1, MOVE(62, 52, 0x0)},
+    {16608119715830181707ULL, 1, MOVE(51, 43, 0x0)},
+    {16614960517351434890ULL, 7, MOVE(52, 36, 0x1)},
+    {16614960517351434890ULL, 1, MOVE(58, 30, 0x0)},
+    {16615435909344049583ULL, 3, MOVE(59, 57, 0x2)},
+    {16615435909344049583ULL, 2, MOVE(53, 45, 0x0)},
+    {16615435909344049583ULL, 2, MOVE(52, 44, 0x0)},
+    {16616484927163915605ULL, 6, MOVE(53, 45, 0x0)},
+    {16616484927163915605ULL, 5, MOVE(55, 47, 0x0)},
+    {16616484927163915605ULL, 3, MOVE(58, 49, 0x0)},
+    {16618821404328432340ULL, 2, MOVE(61, 25, 0x0)},
+    {16618821404328432340ULL, 2, MOVE(54, 38, 0x1)},
+    {16619910677251611603ULL, 2, MOVE(57, 42, 0x0)},
+    {16619910677251611603ULL, 1, MOVE(62, 52, 0x0)},
+    {16627130665657605774ULL, 1, MOVE(52, 36, 0x1)},
+    {16627130665657605774ULL, 1, MOVE(54, 46, 0x0)},
+    {16632410792882256146ULL, 4, MOVE(4, 18, 0x4)},
+    {16632606767459348053ULL, 1, MOVE(58, 51, 0x0)},
+    {16636188606338512643ULL, 1, MOVE(61, 43, 0x0)},
+    {16636284789862403867ULL, 2, MOVE(1, 18, 0x0)},
+    {16636683412129523599ULL, 2, MOVE(6, 21, 0x0)},
+    {16638172470952839858ULL, 1, MOVE(8, 16, 0x0)},
+    {16646725041303174077ULL, 1, MOVE(62, 45, 0x0)},
+    {16649125457178183508ULL, 1, MOVE(57, 42, 0x0)},
+    {16653400019026269664ULL, 4, MOVE(59, 57, 0x2)},
+    {16662848809926337071ULL, 1, MOVE(6, 21, 0x0)},
+    {16672290463834501663ULL, 1, MOVE(27, 36, 0x4)},
+    {16673458247004759612ULL, 4, MOVE(3, 1, 0x2)},
+    {16673458247004759612ULL, 2, MOVE(14, 22, 0x0)},
+    {16673458247004759612ULL, 2, MOVE(13, 29, 0x1)},
+    {16677033246745216219ULL, 12, MOVE(52, 44, 0x0)},
+    {16679501043875521942ULL, 1, MOVE(25, 32, 0x0)},
+    {16681075051455833859ULL, 2, MOVE(18, 28, 0x4)},
+    {16683853709824873093ULL, 1, MOVE(14, 22, 0x0)},
+    {16692775745952702739ULL, 1, MOVE(58, 49, 0x0)},
+    {16696364381012711590ULL, 2, MOVE(62, 45, 0x0)},
+    {16708243329712653353ULL, 3, MOVE(58, 49, 0x0)},
+    {16714896181140333145ULL, 1, MOVE(12, 28, 0x1)},
+    {16715154846965558763ULL, 1, MOVE(37, 28, 0x4)},
+    {16715324912760771006ULL, 15, MOVE(28, 37, 0x4)},
+    {16715324912760771006ULL, 3, MOVE(1, 18, 0x0)},
+    {16715324912760771006ULL, 2, MOVE(1, 11, 0x0)},
+    {16715324912760771006ULL, 1, MOVE(13, 29, 0x1)},
+    {16715324912760771006ULL, 1, MOVE(13, 21, 0x0)},
+    {16716312524870937345ULL, 1, MOVE(58, 30, 0x0)},
+    {16717052845333013480ULL, 2, MOVE(4, 22, 0x0)},
+    {16726239604249353934ULL, 14, MOVE(59, 57, 0x2)},
+    {16726239604249353934ULL, 1, MOVE(52, 44, 0x0)},
+    {16732704055149426172ULL, 4, MOVE(53, 37, 0x1)},
+    {16732704055149426172ULL, 1, MOVE(58, 49, 0x0)},
+    {16735286565176590703ULL, 1, MOVE(42, 52, 0x0)},
+    {16736625676928893282ULL, 13, MOVE(52, 44, 0x0)},
+    {16736625676928893282ULL, 5, MOVE(52, 36, 0x1)},
+    {16736625676928893282ULL, 3, MOVE(53, 45, 0x0)},
+    {16736625676928893282ULL, 3, MOVE(53, 37, 0x1)},
+    {16737318500190807828ULL, 24, MOVE(29, 36, 0x4)},
+    {16737318500190807828ULL, 5, MOVE(1, 18, 0x0)},
+    {16737318500190807828ULL, 2, MOVE(5, 33, 0x0)},
+    {16737506929071728267ULL, 1, MOVE(36, 53, 0x0)},
+    {16739788487491816234ULL, 1, MOVE(51, 35, 0x1)},
+    {16742758461460848673ULL, 1, MOVE(25, 18, 0x4)},
+    {16742758461460848673ULL, 1, MOVE(25, 32, 0x0)},
+    {16744290235474083177ULL, 1, MOVE(1, 11, 0x0)},
+    {16749991259957636350ULL, 2, MOVE(61, 25, 0x0)},
+    {16749991259957636350ULL, 2, MOVE(53, 37, 0x1)},
+    {16749991259957636350ULL, 1, MOVE(49, 33, 0x1)},
+    {16749991259957636350ULL, 1, MOVE(50, 42, 0x0)},
+    {16751514426814786804ULL, 7, MOVE(1, 18, 0x0)},
+    {16751514426814786804ULL, 2, MOVE(12, 28, 0x1)},
+    {16755969635800584756ULL, 3, MOVE(52, 44, 0x0)},
+    {16764546303442426248ULL, 47, MOVE(13, 29, 0x1)},
+    {16764546303442426248ULL, 9, MOVE(1, 18, 0x0)},
+    {16764546303442426248ULL, 4, MOVE(11, 27, 0x1)},
+    {16764546303442426248ULL, 3, MOVE(9, 17, 0x0)},
+    {16764546303442426248ULL, 1, MOVE(5, 26, 0x0)},
+    {16764546303442426248ULL, 1, MOVE(6, 12, 0x0)},
+    {16769639420264252993ULL, 1, MOVE(3, 1, 0x2)},
+    {16769940570881657008ULL, 6, MOVE(57, 42, 0x0)},
+    {16769940570881657008ULL, 2, MOVE(58, 49, 0x0)},
+    {16770724318775481839ULL, 1, MOVE(51, 35, 0x1)},
+    {16778713838391386943ULL, 1, MOVE(60, 39, 0x0)},
+    {16778713838391386943ULL, 1, MOVE(51, 43, 0x0)},
+    {16792392205774385321ULL, 1, MOVE(52, 44, 0x0)},
+    {16793891477578164676ULL, 1, MOVE(13, 29, 0x1)},
+    {16795235038764463928ULL, 5, MOVE(12, 20, 0x0)},
+    {16795829264826714856ULL, 1, MOVE(12, 28, 0x1)},
+    {16796877881896341609ULL, 1, MOVE(60, 51, 0x0)},
+    {16799733167866954322ULL, 1, MOVE(52, 36, 0x1)},
+    {16800596429760964118ULL, 1, MOVE(57, 42, 0x0)},
+    {16801472893648106522ULL, 9, MOVE(37, 28, 0x4)},
+    {16806484283425201541ULL, 1, MOVE(55, 47, 0x0)},
+    {16806692610013496090ULL, 1, MOVE(34, 27, 0x4)},
+    {16808350629236749438ULL, 2, MOVE(12, 28, 0x1)},
+    {16809098110328476850ULL, 1, MOVE(1, 18, 0x0)},
+    {16811225116065040740ULL, 1, MOVE(6, 21, 0x0)},
+    {16819080869646010437ULL, 1, MOVE(57, 51, 0x0)},
+    {16819215092143981720ULL, 1, MOVE(25, 18, 0x4)},
+    {16820036440816881490ULL, 1, MOVE(19, 28, 0x4)},
+    {16823396082354798915ULL, 1, MOVE(37, 28, 0x4)},
+    {16826190534473732609ULL, 1, MOVE(1, 18, 0x0)},
+    {16826712543225336292ULL, 2, MOVE(14, 22, 0x0)},
+    {16828880233011369855ULL, 2, MOVE(52, 36, 0x1)},
+    {16834256498298395265ULL, 1, MOVE(53, 37, 0x1)},
+    {16834804579963191393ULL, 2, MOVE(2, 11, 0x0)},
+    {16835082142921762744ULL, 8, MOVE(37, 28, 0x4)},
+    {16838175850833517876ULL, 2, MOVE(27, 35, 0x0)},
+    {16838785698363190156ULL, 25, MOVE(2, 20, 0x0)},
+    {16838785698363190156ULL, 14, MOVE(6, 21, 0x0)},
+    {16838785698363190156ULL, 10, MOVE(13, 29, 0x1)},
+    {16838785698363190156ULL, 6, MOVE(2, 11, 0x0)},
+    {16838785698363190156ULL, 1, MOVE(9, 17, 0x0)},
+    {16839738908512949538ULL, 2, MOVE(35, 28, 0x4)},
+    {16844206851289119157ULL, 1, MOVE(1, 18, 0x0)},
+    {16845647299295107418ULL, 1, MOVE(52, 36, 0x1)},
+    {16846945141246388234ULL, 3, MOVE(1, 18, 0x0)},
+    {16848848731687310581ULL, 1, MOVE(58, 37, 0x0)},
+    {16856978025533890793ULL, 1, MOVE(52, 36, 0x1)},
+    {16856978025533890793ULL, 1, MOVE(58, 30, 0x0)},
+    {16856978025533890793ULL, 1, MOVE(58, 51, 0x0)},
+    {16858022554857852332ULL, 5, MOVE(57, 42, 0x0)},
+    {16860113988184620885ULL, 1, MOVE(58, 49, 0x0)},
+    {16861246218397967427ULL, 8, MOVE(53, 37, 0x1)},
+    {16861246218397967427ULL, 5, MOVE(61, 34, 0x0)},
+    {16861246218397967427ULL, 2, MOVE(51, 43, 0x0)},
+    {16868496994491747704ULL, 1, MOVE(12, 28, 0x1)},
+    {16868496994491747704ULL, 1, MOVE(12, 20, 0x0)},
+    {16871081215536574553ULL, 1, MOVE(35, 28, 0x4)},
+    {16875726397009642708ULL, 2, MOVE(29, 36, 0x4)},
+    {16875726397009642708ULL, 1, MOVE(3, 1, 0x2)},
+    {16881142848612127142ULL, 1, MOVE(6, 21, 0x0)},
+    {16881142848612127142ULL, 1, MOVE(28, 36, 0x0)},
+    {16883991084228447582ULL, 1, MOVE(53, 45, 0x0)},
+    {16884333245572098912ULL, 1, MOVE(11, 27, 0x1)},
+    {16884930034854772929ULL, 1, MOVE(4, 12, 0x0)},
+    {16890061432601373324ULL, 1, MOVE(4, 11, 0x0)},
+    {16890211989583392808ULL, 483, MOVE(18, 28, 0x4)},
+    {16890211989583392808ULL, 8, MOVE(4, 28, 0x4)},
+    {16893502116682396105ULL, 2, MOVE(42, 27, 0x0)},
+    {16900398627141144394ULL, 1, MOVE(58, 37, 0x0)},
+    {16900398627141144394ULL, 1, MOVE(58, 30, 0x0)},
+    {16901637410980053552ULL, 7, MOVE(57, 42, 0x0)},
+    {16901637410980053552ULL, 2, MOVE(58, 49, 0x0)},
+    {16903320222177165557ULL, 2, MOVE(9, 17, 0x0)},
+    {16904519284079334485ULL, 2, MOVE(35, 27, 0x0)},
+    {16909523857707907783ULL, 2, MOVE(10, 18, 0x0)},
+    {16910873182433450079ULL, 1, MOVE(11, 27, 0x1)},
+    {16931334825703414252ULL, 2, MOVE(28, 36, 0x0)},
+    {16933381364790634389ULL, 1, MOVE(8, 16, 0x0)},
+    {16933381364790634389ULL, 1, MOVE(12, 20, 0x0)},
+    {16936074908239813515ULL, 3, MOVE(2, 9, 0x0)},
+    {16944499736665105690ULL, 1, MOVE(30, 12, 0x4)},
+    {16946774953133501958ULL, 1, MOVE(49, 42, 0x4)},
+    {16949266855950069613ULL, 6, MOVE(53, 37, 0x1)},
+    {16951514924685277679ULL, 1, MOVE(60, 36, 0x4)},
+    {16954522953539018144ULL, 4, MOVE(6, 21, 0x0)},
+    {16954522953539018144ULL, 1, MOVE(12, 28, 0x1)},
+    {16954522953539018144ULL, 1, MOVE(11, 27, 0x1)},
+    {16955102825490010288ULL, 1, MOVE(18, 28, 0x0)},
+    {16955422532604991171ULL, 1, MOVE(42, 52, 0x0)},
+    {16958530572748384779ULL, 19, MOVE(60, 52, 0x4)},
+    {16958530572748384779ULL, 4, MOVE(62, 52, 0x4)},
+    {16962532372017379917ULL, 1, MOVE(1, 18, 0x0)},
+    {16965590171753796382ULL, 1, MOVE(5, 14, 0x0)},
+    {16965590171753796382ULL, 1, MOVE(2, 38, 0x0)},
+    {16972105036193221050ULL, 1, MOVE(58, 44, 0x0)},
+    {16972310216973429816ULL, 479, MOVE(6, 21, 0x0)},
+    {16972310216973429816ULL, 4, MOVE(10, 18, 0x0)},
+    {16974726260933053736ULL, 9, MOVE(6, 12, 0x0)},
+    {16974726260933053736ULL, 6, MOVE(13, 21, 0x0)},
+    {16980985132946108732ULL, 5, MOVE(49, 42, 0x4)},
+    {16982306989595514134ULL, 1, MOVE(59, 57, 0x2)},
+    {16985886788055541155ULL, 1, MOVE(61, 54, 0x0)},
+    {16992168441342409546ULL, 4, MOVE(52, 36, 0x1)},
+    {16993932736707781992ULL, 2, MOVE(37, 30, 0x4)},
+    {16995851547538842892ULL, 3, MOVE(2, 9, 0x0)},
+    {16996868660896590625ULL, 1, MOVE(12, 28, 0x1)},
+    {16996868660896590625ULL, 1, MOVE(2, 38, 0x0)},
+    {16996868660896590625ULL, 1, MOVE(13, 29, 0x1)},
+    {16997059719571608075ULL, 2, MOVE(53, 37, 0x1)},
+    {16999124547881171548ULL, 1, MOVE(27, 34, 0x4)},
+    {17002836538408447309ULL, 4, MOVE(51, 43, 0x0)},
+    {17002836538408447309ULL, 2, MOVE(57, 42, 0x0)},
+    {17002836538408447309ULL, 1, MOVE(36, 29, 0x4)},
+    {17004333105976284212ULL, 6, MOVE(43, 36, 0x4)},
+    {17009048183442145544ULL, 4, MOVE(1, 18, 0x0)},
+    {17009048183442145544ULL, 2, MOVE(38, 29, 0x0)},
+    {17009048183442145544ULL, 1, MOVE(15, 31, 0x1)},
+    {17016180258952233915ULL, 1, MOVE(61, 54, 0x0)},
+    {17016705753342824920ULL, 1, MOVE(8, 16, 0x0)},
+    {17017989480636133258ULL, 1, MOVE(51, 43, 0x0)},
+    {17019657236933890393ULL, 1, MOVE(5, 19, 0x0)},
+    {17019730063059733190ULL, 16, MOVE(11, 27, 0x1)},
+    {17021446775532186470ULL, 3, MOVE(12, 20, 0x0)},
+    {17022579313815396799ULL, 1, MOVE(52, 36, 0x1)},
+    {17026068999397319178ULL, 1, MOVE(58, 49, 0x0)},
+    {17026068999397319178ULL, 1, MOVE(62, 45, 0x0)},
+    {17027104306962652157ULL, 9, MOVE(61, 54, 0x0)},
+    {17031411106409820498ULL, 1, MOVE(58, 49, 0x0)},
+    {17032071001735553489ULL, 1, MOVE(35, 28, 0x4)},
+    {17032071001735553489ULL, 1, MOVE(37, 28, 0x4)},
+    {17035308851424784207ULL, 1, MOVE(13, 21, 0x0)},
+    {17037432886962653192ULL, 2, MOVE(52, 36, 0x1)},
+    {17037432886962653192ULL, 2, MOVE(53, 37, 0x1)},
+    {17041220566591979461ULL, 4, MOVE(36, 46, 0x0)},
+    {17047478063245314977ULL, 1, MOVE(5, 14, 0x0)},
+    {17053332901298631340ULL, 1, MOVE(55, 39, 0x1)},
+    {17061177227525189947ULL, 1, MOVE(1, 18, 0x0)},
+    {17062104511720056560ULL, 44, MOVE(2, 20, 0x0)},
+    {17062104511720056560ULL, 13, MOVE(1, 11, 0x0)},
+    {17062104511720056560ULL, 2, MOVE(5, 12, 0x0)},
+    {17062104511720056560ULL, 2, MOVE(1, 18, 0x0)},
+    {17062104511720056560ULL, 1, MOVE(15, 23, 0x0)},
+    {17062168505804268613ULL, 27, MOVE(2, 29, 0x4)},
+    {17066852164245255537ULL, 1, MOVE(51, 43, 0x0)},
+    {17069874145698822359ULL, 1, MOVE(11, 19, 0x0)},
+    {17072301288187539959ULL, 1, MOVE(62, 45, 0x0)},
+    {17073980700669489392ULL, 5, MOVE(51, 43, 0x0)},
+    {17073980700669489392ULL, 2, MOVE(62, 45, 0x0)},
+    {17073980700669489392ULL, 1, MOVE(55, 47, 0x0)},
+    {17073980700669489392ULL, 1, MOVE(52, 36, 0x1)},
+    {17082887491275607890ULL, 1, MOVE(49, 41, 0x0)},
+    {17085492582626832488ULL, 1, MOVE(52, 43, 0x4)},
+    {17086738202479737193ULL, 1, MOVE(6, 21, 0x0)},
+    {17089400723149794624ULL, 3, MOVE(62, 45, 0x0)},
+    {17090598348757172286ULL, 1, MOVE(12, 28, 0x1)},
+    {17090941165623980138ULL, 1, MOVE(54, 45, 0x4)},
+    {17092755077021478666ULL, 2, MOVE(61, 34, 0x0)},
+    {17094807668047066791ULL, 3, MOVE(12, 28, 0x1)},
+    {17096585829321398356ULL, 1, MOVE(1, 11, 0x0)},
+    {17104789744344844412ULL, 5, MOVE(61, 54, 0x0)},
+    {17109414767797610316ULL, 2, MOVE(53, 37, 0x1)},
+    {17109414767797610316ULL, 2, MOVE(58, 51, 0x0)},
+    {17109414767797610316ULL, 1, MOVE(55, 47, 0x0)},
+    {17113255786594379444ULL, 2, MOVE(61, 54, 0x0)},
+    {17114006831059760528ULL, 1, MOVE(33, 26, 0x0)},
+    {17121389247970721295ULL, 2, MOVE(49, 41, 0x0)},
+    {17126951192117276716ULL, 11, MOVE(62, 45, 0x0)},
+    {17126951192117276716ULL, 5, MOVE(57, 42, 0x0)},
+    {17130578250547307224ULL, 6, MOVE(5, 14, 0x0)},
+    {17130578250547307224ULL, 1, MOVE(11, 19, 0x0)},
+    {17130578250547307224ULL, 1, MOVE(1, 18, 0x0)},
+    {17133496805546514110ULL, 5, MOVE(52, 36, 0x1)},
+    {17133496805546514110ULL, 4, MOVE(53, 37, 0x1)},
+    {17133496805546514110ULL, 1, MOVE(54, 46, 0x0)},
+    {17136210561104122632ULL, 38, MOVE(38, 45, 0x4)},
+    {17136210561104122632ULL, 18, MOVE(3, 1, 0x2)},
+    {17142027502159825647ULL, 1, MOVE(53, 45, 0x0)},
+    {17146409829735757289ULL, 1, MOVE(25, 18, 0x4)},
+    {17146566594920179803ULL, 1, MOVE(13, 29, 0x1)},
+    {17150155133668666767ULL, 2, MOVE(15, 23, 0x0)},
+    {17151539045224789561ULL, 1, MOVE(42, 41, 0x0)},
+    {17157036753470320711ULL, 1, MOVE(21, 31, 0x0)},
+    {17162645171949097006ULL, 1, MOVE(52, 36, 0x1)},
+    {17164272640709704176ULL, 1, MOVE(2, 9, 0x0)},
+    {17167283517864731557ULL, 14, MOVE(59, 57, 0x2)},
+    {17168431791711507106ULL, 1, MOVE(27, 35, 0x0)},
+    {17168543931555136612ULL, 2, MOVE(51, 35, 0x1)},
+    {17168543931555136612ULL, 1, MOVE(51, 43, 0x0)},
+    {17169962698603568783ULL, 1, MOVE(1, 18, 0x0)},
+    {17170762129768520253ULL, 4, MOVE(5, 14, 0x0)},
+    {17178858327780990062ULL, 2, MOVE(61, 25, 0x0)},
+    {17181749530464600074ULL, 1, MOVE(42, 36, 0x4)},
+    {17188657718858330447ULL, 1126, MOVE(1, 18, 0x0)},
+    {17188657718858330447ULL, 53, MOVE(6, 21, 0x0)},
+    {17188657718858330447ULL, 34, MOVE(13, 21, 0x0)},
+    {17188657718858330447ULL, 4, MOVE(6, 23, 0x0)},
+    {17188657718858330447ULL, 4, MOVE(1, 11, 0x0)},
+    {17188657718858330447ULL, 3, MOVE(12, 28, 0x1)},
+    {17188657718858330447ULL, 2, MOVE(10, 26, 0x1)},
+    {17188657718858330447ULL, 2, MOVE(12, 20, 0x0)},
+    {17188657718858330447ULL, 2, MOVE(14, 22, 0x0)},
+    {17188657718858330447ULL, 1, MOVE(14, 30, 0x1)},
+    {17188657718858330447ULL, 1, MOVE(15, 23, 0x0)},
+    {17190097366240346434ULL, 18, MOVE(15, 23, 0x0)},
+    {17190097366240346434ULL, 17, MOVE(29, 36, 0x4)},
+    {17190097366240346434ULL, 1, MOVE(1, 18, 0x0)},
+    {17192087352904672055ULL, 1, MOVE(2, 29, 0x4)},
+    {17192387111477417047ULL, 116, MOVE(12, 28, 0x1)},
+    {17192387111477417047ULL, 83, MOVE(6, 21, 0x0)},
+    {17192387111477417047ULL, 6, MOVE(2, 20, 0x0)},
+    {17192387111477417047ULL, 5, MOVE(13, 29, 0x1)},
+    {17192387111477417047ULL, 4, MOVE(12, 20, 0x0)},
+    {17192387111477417047ULL, 3, MOVE(4, 11, 0x0)},
+    {17193123311850793042ULL, 1, MOVE(52, 44, 0x0)},
+    {17193384353076523928ULL, 2, MOVE(53, 45, 0x0)},
+    {17194288512067949122ULL, 6, MOVE(5, 14, 0x0)},
+    {17196095747006781747ULL, 1, MOVE(2, 9, 0x0)},
+    {17201815950281226095ULL, 1, MOVE(58, 51, 0x0)},
+    {17202862586476645642ULL, 1, MOVE(8, 16, 0x0)},
+    {17221150231857802054ULL, 2, MOVE(51, 43, 0x0)},
+    {17222813472492065789ULL, 1, MOVE(58, 51, 0x0)},
+    {17227076540127596792ULL, 1, MOVE(58, 49, 0x0)},
+    {17229666207499210875ULL, 1, MOVE(2, 9, 0x0)},
+    {17230918052558009234ULL, 2, MOVE(30, 21, 0x4)},
+    {17236358238867494427ULL, 3, MOVE(1, 18, 0x0)},
+    {17236358238867494427ULL, 1, MOVE(4, 13, 0x0)},
+    {17238399497057935238ULL, 1, MOVE(11, 27, 0x1)},
+    {17239054035929852610ULL, 1, MOVE(6, 21, 0x0)},
+    {17241590091840813457ULL, 1, MOVE(57, 42, 0x0)},
+    {17244396857156160822ULL, 1, MOVE(29, 36, 0x4)},
+    {17248235910084058812ULL, 2, MOVE(55, 47, 0x0)},
+    {17249587808713272659ULL, 3, MOVE(2, 9, 0x0)},
+    {17251119358163868237ULL, 1, MOVE(6, 21, 0x0)},
+    {17253686817926314415ULL, 4, MOVE(5, 26, 0x0)},
+    {17253686817926314415ULL, 2, MOVE(5, 33, 0x0)},
+    {17253686817926314415ULL, 1, MOVE(11, 27, 0x1)},
+    {17260343367499928723ULL, 1, MOVE(62, 45, 0x0)},
+    {17264791390724112172ULL, 1, MOVE(2, 9, 0x0)},
+    {17268564348960552641ULL, 16, MOVE(57, 42, 0x0)},
+    {17283018314849349467ULL, 1, MOVE(59, 57, 0x2)},
+    {17289678316442885910ULL, 39, MOVE(57, 42, 0x0)},
+    {17289678316442885910ULL, 9, MOVE(53, 45, 0x0)},
+    {17289678316442885910ULL, 4, MOVE(55, 47, 0x0)},
+    {17289678316442885910ULL, 3, MOVE(53, 37, 0x1)},
+    {17289678316442885910ULL, 2, MOVE(36, 29, 0x4)},
+    {17289678316442885910ULL, 2, MOVE(58, 51, 0x0)},
+    {17289911072901296405ULL, 4, MOVE(1, 18, 0x0)},
+    {17289911072901296405ULL, 4, MOVE(12, 28, 0x1)},
+    {17291056249465375489ULL, 2, MOVE(9, 17, 0x0)},
+    {17292134458140428200ULL, 15, MOVE(52, 36, 0x1)},
+    {17296226348537621014ULL, 1, MOVE(55, 39, 0x1)},
+    {17298671013218249113ULL, 2, MOVE(62, 45, 0x0)},
+    {17304774685644002423ULL, 2, MOVE(11, 27, 0x1)},
+    {17311312624053654560ULL, 1, MOVE(28, 36, 0x0)},
+    {17312489975484012561ULL, 1, MOVE(37, 28, 0x4)},
+    {17313780895394783879ULL, 7, MOVE(51, 43, 0x0)},
+    {17313780895394783879ULL, 5, MOVE(53, 37, 0x1)},
+    {17317031262156987225ULL, 1, MOVE(35, 28, 0x4)},
+    {17324407511141808068ULL, 220, MOVE(12, 28, 0x1)},
+    {17324407511141808068ULL, 10, MOVE(6, 21, 0x0)},
+    {17324407511141808068ULL, 6, MOVE(13, 29, 0x1)},
+    {17324407511141808068ULL, 5, MOVE(1, 18, 0x0)},
+    {17324407511141808068ULL, 3, MOVE(12, 20, 0x0)},
+    {17328174543632318266ULL, 1, MOVE(25, 32, 0x0)},
+    {17330799602674278462ULL, 1, MOVE(42, 25, 0x0)},
+    {17343768162173374433ULL, 2, MOVE(51, 35, 0x1)},
+    {17343768162173374433ULL, 2, MOVE(51, 43, 0x0)},
+    {17343768162173374433ULL, 1, MOVE(52, 44, 0x0)},
+    {17345594780179071437ULL, 1, MOVE(2, 9, 0x0)},
+    {17352001458879994114ULL, 2, MOVE(11, 19, 0x0)},
+    {17355296761389975716ULL, 2, MOVE(11, 19, 0x0)},
+    {17355296761389975716ULL, 1, MOVE(9, 17, 0x0)},
+    {17356624092169913147ULL, 1, MOVE(9, 18, 0x4)},
+    {17358220433928412790ULL, 1, MOVE(2, 9, 0x0)},
+    {17359497498319073023ULL, 1, MOVE(58, 49, 0x0)},
+    {17360513819293165133ULL, 2, MOVE(51, 43, 0x0)},
+    {17368058752340016328ULL, 29, MOVE(28, 45, 0x4)},
+    {17368058752340016328ULL, 3, MOVE(6, 21, 0x0)},
+    {17372698285898210683ULL, 12, MOVE(59, 57, 0x2)},
+    {17374786467211406040ULL, 1, MOVE(9, 17, 0x0)},
+    {17378943678831727094ULL, 1, MOVE(43, 36, 0x4)},
+    {17392497401996612697ULL, 2, MOVE(53, 45, 0x0)},
+    {17392497401996612697ULL, 2, MOVE(52, 44, 0x0)},
+    {17392497401996612697ULL, 1, MOVE(53, 37, 0x1)},
+    {17393542962966078266ULL, 1, MOVE(57, 42, 0x0)},
+    {17394181685670745588ULL, 1, MOVE(4, 13, 0x0)},
+    {17395175703782566709ULL, 1, MOVE(58, 51, 0x0)},
+    {17397682677203836705ULL, 1, MOVE(13, 29, 0x1)},
+    {17400354758213905207ULL, 1, MOVE(58, 30, 0x0)},
+    {17410964988926628791ULL, 1, MOVE(51, 43, 0x0)},
+    {17410964988926628791ULL, 1, MOVE(49, 41, 0x0)},
+    {17412844422434330551ULL, 483, MOVE(57, 42, 0x0)},
+    {17413182187553574573ULL, 1, MOVE(53, 45, 0x0)},
+    {17415752652186653249ULL, 4, MOVE(2, 9, 0x0)},
+    {17420342993121999225ULL, 1, MOVE(60, 39, 0x0)},
+    {17421263965940890947ULL, 1, MOVE(11, 19, 0x0)},
+    {17428683693293653841ULL, 2, MOVE(9, 17, 0x0)},
+    {17432009091388267619ULL, 1, MOVE(11, 27, 0x1)},
+    {17442165573530301713ULL, 6, MOVE(42, 36, 0x4)},
+    {17442651412078622752ULL, 65, MOVE(58, 30, 0x0)},
+    {17442651412078622752ULL, 6, MOVE(52, 36, 0x1)},
+    {17442651412078622752ULL, 4, MOVE(47, 54, 0x0)},
+    {17442651412078622752ULL, 3, MOVE(46, 38, 0x0)},
+    {17445106151273050946ULL, 1, MOVE(52, 44, 0x0)},
+    {17453747397223256467ULL, 2, MOVE(6, 21, 0x0)},
+    {17460674825607768299ULL, 1, MOVE(6, 21, 0x0)},
+    {17460674825607768299ULL, 1, MOVE(29, 36, 0x4)},
+    {17466318604203947744ULL, 1, MOVE(30, 12, 0x4)},
+    {17473064067654198323ULL, 1, MOVE(53, 37, 0x1)},
+    {17473868040356433141ULL, 1, MOVE(5, 14, 0x0)},
+    {17478352840886361180ULL, 1, MOVE(55, 47, 0x0)},
+    {17478679850864923970ULL, 7, MOVE(14, 22, 0x0)},
+    {17478679850864923970ULL, 3, MOVE(12, 28, 0x1)},
+    {17478679850864923970ULL, 1, MOVE(4, 13, 0x0)},
+    {17481061622390293590ULL, 1, MOVE(51, 43, 0x0)},
+    {17482927045218093447ULL, 16, MOVE(4, 28, 0x4)},
+    {17489352742252499211ULL, 1, MOVE(57, 42, 0x0)},
+    {17497397403863889460ULL, 1, MOVE(28, 37, 0x4)},
+    {17497397403863889460ULL, 1, MOVE(11, 19, 0x0)},
+    {17500984169399236072ULL, 46, MOVE(34, 41, 0x0)},
+    {17505916372964406442ULL, 1, MOVE(1, 18, 0x0)},
+    {17517123737796866621ULL, 1, MOVE(1, 18, 0x0)},
+    {17518309165863011692ULL, 2, MOVE(49, 41, 0x0)},
+    {17518309165863011692ULL, 1, MOVE(61, 54, 0x0)},
+    {17519490298778175817ULL, 1, MOVE(21, 28, 0x4)},
+    {17522253231117604952ULL, 1, MOVE(29, 36, 0x4)},
+    {17522253231117604952ULL, 1, MOVE(12, 28, 0x1)},
+    {17522276463236900188ULL, 1, MOVE(62, 45, 0x0)},
+    {17525189418810427092ULL, 2, MOVE(2, 9, 0x0)},
+    {17529522759103616866ULL, 1, MOVE(61, 54, 0x0)},
+    {17529598866704190916ULL, 6, MOVE(52, 36, 0x1)},
+    {17532501624377146179ULL, 3, MOVE(2, 9, 0x0)},
+    {17532767241507462930ULL, 2, MOVE(37, 28, 0x4)},
+    {17534946915197922388ULL, 6, MOVE(58, 49, 0x0)},
+    {17541791095697374391ULL, 1, MOVE(62, 45, 0x0)},
+    {17541988205838967304ULL, 1, MOVE(61, 52, 0x0)},
+    {17543867194890805084ULL, 1, MOVE(6, 21, 0x0)},
+    {17549429878562197331ULL, 1, MOVE(57, 42, 0x0)},
+    {17549429878562197331ULL, 1, MOVE(62, 45, 0x0)},
+    {17549429878562197331ULL, 1, MOVE(53, 45, 0x0)},
+    {17550743015418581110ULL, 1, MOVE(60, 46, 0x0)},
+    {17550743015418581110ULL, 1, MOVE(60, 53, 0x0)},
+    {17555407266575488267ULL, 1, MOVE(58, 30, 0x0)},
+    {17559230284135454376ULL, 2, MOVE(14, 30, 0x1)},
+    {17563019226101926097ULL, 2, MOVE(6, 23, 0x0)},
+    {17563019226101926097ULL, 1, MOVE(1, 11, 0x0)},
+    {17563019226101926097ULL, 1, MOVE(38, 45, 0x4)},
+    {17567275503093017253ULL, 1, MOVE(58, 49, 0x0)},
+    {17569587732497452335ULL, 5, MOVE(62, 45, 0x0)},
+    {17569587732497452335ULL, 2, MOVE(30, 12, 0x4)},
+    {17576687542214718682ULL, 1, MOVE(14, 21, 0x4)},
+    {17577781045043597180ULL, 1, MOVE(2, 9, 0x0)},
+    {17579494662915593523ULL, 1, MOVE(61, 54, 0x0)},
+    {17579846004372916489ULL, 1, MOVE(52, 36, 0x1)},
+    {17579846004372916489ULL, 1, MOVE(57, 42, 0x0)},
+    {17581902460901627761ULL, 1, MOVE(61, 54, 0x0)},
+    {17582251946335691483ULL, 1, MOVE(29, 36, 0x4)},
+    {17582251946335691483ULL, 1, MOVE(18, 24, 0x0)},
+    {17584810569547362000ULL, 1, MOVE(53, 37, 0x1)},
+    {17585359720448068750ULL, 1, MOVE(21, 27, 0x4)},
+    {17585704880308186542ULL, 6, MOVE(57, 42, 0x0)},
+    {17585704880308186542ULL, 1, MOVE(55, 47, 0x0)},
+    {17587229113542786395ULL, 1, MOVE(36, 28, 0x0)},
+    {17601076987678586237ULL, 4, MOVE(59, 57, 0x2)},
+    {17601076987678586237ULL, 2, MOVE(52, 44, 0x0)},
+    {17601076987678586237ULL, 2, MOVE(45, 28, 0x0)},
+    {17602522198243146145ULL, 1, MOVE(21, 31, 0x0)},
+    {17619456107160643504ULL, 1, MOVE(12, 20, 0x0)},
+    {17620088045602845731ULL, 1, MOVE(12, 28, 0x1)},
+    {17620414026409448408ULL, 1, MOVE(52, 36, 0x1)},
+    {17624360114268537659ULL, 1, MOVE(52, 44, 0x0)},
+    {17630799631603171513ULL, 1, MOVE(51, 43, 0x0)},
+    {17631482829038658193ULL, 2, MOVE(49, 41, 0x0)},
+    {17631482829038658193ULL, 1, MOVE(57, 42, 0x0)},
+    {17633405332301155400ULL, 3, MOVE(34, 6, 0x4)},
+    {17634482788067829918ULL, 2, MOVE(49, 41, 0x0)},
+    {17635026690004585557ULL, 5, MOVE(9, 17, 0x0)},
+    {17635026690004585557ULL, 2, MOVE(6, 21, 0x0)},
+    {17635026690004585557ULL, 1, MOVE(1, 18, 0x0)},
+    {17653127058113474043ULL, 2, MOVE(51, 43, 0x0)},
+    {17663833439775761853ULL, 1, MOVE(32, 41, 0x0)},
+    {17664890956102248178ULL, 1, MOVE(45, 37, 0x0)},
+    {17668875459543967371ULL, 1, MOVE(57, 42, 0x0)},
+    {17669415395245569191ULL, 9, MOVE(52, 36, 0x1)},
+    {17673254940818477226ULL, 149, MOVE(37, 28, 0x4)},
+    {17674561234970890517ULL, 1, MOVE(52, 44, 0x0)},
+    {17680840167867293803ULL, 1, MOVE(9, 17, 0x0)},
+    {17681432306470096337ULL, 2, MOVE(1, 18, 0x0)},
+    {17687659119355474719ULL, 3, MOVE(57, 42, 0x0)},
+    {17690575525356375328ULL, 3, MOVE(11, 27, 0x1)},
+    {17691261484008082439ULL, 1, MOVE(1, 18, 0x0)},
+    {17693275005444399663ULL, 2, MOVE(57, 42, 0x0)},
+    {17693275005444399663ULL, 1, MOVE(50, 34, 0x1)},
+    {17698282400848229718ULL, 2, MOVE(58, 49, 0x0)},
+    {17703459259886953412ULL, 1, MOVE(51, 43, 0x0)},
+    {17703487712236695804ULL, 2, MOVE(51, 43, 0x0)},
+    {17713395013888759588ULL, 1, MOVE(1, 18, 0x0)},
+    {17713910236975932114ULL, 5, MOVE(62, 45, 0x0)},
+    {17713910236975932114ULL, 3, MOVE(49, 41, 0x0)},
+    {17713910236975932114ULL, 1, MOVE(57, 42, 0x0)},
+    {17716716147889547255ULL, 1, MOVE(11, 27, 0x1)},
+    {17717565933533024088ULL, 1, MOVE(2, 9, 0x0)},
+    {17724737368881040068ULL, 1, MOVE(13, 29, 0x1)},
+    {17726787498060847846ULL, 1, MOVE(58, 49, 0x0)},
+    {17731649927793641890ULL, 1, MOVE(9, 17, 0x0)},
+    {17731649927793641890ULL, 1, MOVE(12, 28, 0x1)},
+    {17733885169485483915ULL, 1, MOVE(28, 36, 0x0)},
+    {17737043026969287528ULL, 2, MOVE(2, 9, 0x0)},
+    {17740310931603245709ULL, 1, MOVE(62, 45, 0x0)},
+    {17743348602524724461ULL, 1, MOVE(52, 44, 0x0)},
+    {17743355200043250827ULL, 1, MOVE(6, 21, 0x0)},
+    {17744495788526304343ULL, 1, MOVE(36, 29, 0x4)},
+    {17752243117616576859ULL, 3, MOVE(36, 29, 0x4)},
+    {17752243117616576859ULL, 1, MOVE(62, 52, 0x0)},
+    {17752939435398844767ULL, 1, MOVE(11, 19, 0x0)},
+    {17757592753060749438ULL, 28, MOVE(53, 37, 0x1)},
+    {17757592753060749438ULL, 23, MOVE(54, 46, 0x0)},
+    {17757592753060749438ULL, 11, MOVE(52, 36, 0x1)},
+    {17757592753060749438ULL, 7, MOVE(59, 57, 0x2)},
+    {17757592753060749438ULL, 2, MOVE(52, 44, 0x0)},
+    {17761317798730265785ULL, 13, MOVE(52, 36, 0x1)},
+    {17761317798730265785ULL, 7, MOVE(51, 43, 0x0)},
+    {17761317798730265785ULL, 5, MOVE(42, 27, 0x0)},
+    {17761317798730265785ULL, 3, MOVE(53, 37, 0x1)},
+    {17768034571497458371ULL, 1, MOVE(30, 37, 0x0)},
+    {17772974021590953202ULL, 1, MOVE(51, 35, 0x1)},
+    {17776891145295318630ULL, 1, MOVE(58, 44, 0x0)},
+    {17777733629842685107ULL, 1, MOVE(54, 38, 0x1)},
+    {17777733629842685107ULL, 1, MOVE(49, 41, 0x0)},
+    {17781208038847832262ULL, 1, MOVE(51, 35, 0x1)},
+    {17787125560235599109ULL, 10, MOVE(59, 57, 0x2)},
+    {17790959118579486274ULL, 1, MOVE(58, 49, 0x0)},
+    {17791765001825661139ULL, 72, MOVE(18, 28, 0x4)},
+    {17791765001825661139ULL, 1, MOVE(2, 29, 0x0)},
+    {17796186028012732718ULL, 1, MOVE(19, 28, 0x4)},
+    {17802624275651125141ULL, 4, MOVE(55, 47, 0x0)},
+    {17812174044496671167ULL, 22, MOVE(52, 45, 0x4)},
+    {17812174044496671167ULL, 16, MOVE(54, 45, 0x4)},
+    {17812778394119697675ULL, 9, MOVE(30, 21, 0x4)},
+    {17812778394119697675ULL, 3, MOVE(30, 51, 0x0)},
+    {17817375877441011151ULL, 8, MOVE(37, 28, 0x4)},
+    {17819148946066809180ULL, 2, MOVE(42, 36, 0x0)},
+    {17822678757728540690ULL, 1, MOVE(13, 21, 0x0)},
+    {17822678757728540690ULL, 1, MOVE(2, 38, 0x0)},
+    {17831064832500006385ULL, 1, MOVE(1, 18, 0x0)},
+    {17833014464258215917ULL, 2, MOVE(28, 37, 0x4)},
+    {17833411376931423680ULL, 1, MOVE(4, 11, 0x0)},
+    {17839745566163824242ULL, 1, MOVE(1, 18, 0x0)},
+    {17845635959471148989ULL, 3, MOVE(2, 38, 0x0)},
+    {17846851669840453769ULL, 23, MOVE(52, 44, 0x0)},
+    {17846851669840453769ULL, 4, MOVE(54, 38, 0x1)},
+    {17846851669840453769ULL, 2, MOVE(43, 36, 0x4)},
+    {17848420598769485460ULL, 1, MOVE(57, 42, 0x0)},
+    {17848420598769485460ULL, 1, MOVE(53, 45, 0x0)},
+    {17851436344735038153ULL, 55, MOVE(27, 44, 0x0)},
+    {17851826671077016422ULL, 2, MOVE(51, 43, 0x0)},
+    {17851826671077016422ULL, 1, MOVE(52, 44, 0x0)},
+    {17852614301922414794ULL, 1, MOVE(57, 42, 0x0)},
+    {17855689868310326886ULL, 5, MOVE(11, 27, 0x1)},
+    {17867930500150545519ULL, 1, MOVE(59, 57, 0x2)},
+    {17871351009244034742ULL, 12, MOVE(57, 42, 0x0)},
+    {17871351009244034742ULL, 2, MOVE(58, 49, 0x0)},
+    {17875251600247296383ULL, 3, MOVE(4, 22, 0x0)},
+    {17875765517209485034ULL, 2, MOVE(27, 36, 0x4)},
+    {17880565821110250473ULL, 1, MOVE(12, 20, 0x0)},
+    {17890944822367621545ULL, 3, MOVE(57, 42, 0x0)},
+    {17891040775924183009ULL, 1, MOVE(25, 43, 0x0)},
+    {17900901150637285192ULL, 94, MOVE(62, 45, 0x0)},
+    {17905593382394388158ULL, 6, MOVE(57, 42, 0x0)},
+    {17905593382394388158ULL, 1, MOVE(53, 37, 0x1)},
+    {17905593382394388158ULL, 1, MOVE(51, 35, 0x1)},
+    {17905593382394388158ULL, 1, MOVE(51, 43, 0x0)},
+    {17907342412799359363ULL, 1, MOVE(54, 38, 0x1)},
+    {17908098039236078199ULL, 6, MOVE(1, 18, 0x0)},
+    {17908098039236078199ULL, 1, MOVE(2, 9, 0x0)},
+    {17915143023483086329ULL, 1, MOVE(57, 42, 0x0)},
+    {17917986786552939606ULL, 1, MOVE(30, 51, 0x0)},
+    {17919444226408373708ULL, 1, MOVE(61, 52, 0x0)},
+    {17919781982015556637ULL, 4, MOVE(52, 36, 0x1)},
+    {17920414189561426350ULL, 2, MOVE(58, 37, 0x0)},
+    {17920414189561426350ULL, 1, MOVE(62, 45, 0x0)},
+    {17920414189561426350ULL, 1, MOVE(42, 27, 0x4)},
+    {17926373725211858890ULL, 1, MOVE(54, 38, 0x1)},
+    {17926373725211858890ULL, 1, MOVE(43, 36, 0x4)},
+    {17932806170431131754ULL, 15, MOVE(57, 42, 0x0)},
+    {17932806170431131754ULL, 4, MOVE(53, 45, 0x0)},
+    {17932806170431131754ULL, 1, MOVE(57, 40, 0x0)},
+    {17932976855607244440ULL, 1, MOVE(5, 26, 0x0)},
+    {17936655032207322572ULL, 1, MOVE(58, 30, 0x0)},
+    {17941578739202831579ULL, 14, MOVE(13, 29, 0x1)},
+    {17941578739202831579ULL, 9, MOVE(12, 20, 0x0)},
+    {17941578739202831579ULL, 5, MOVE(12, 28, 0x1)},
+    {17942642077315564241ULL, 2, MOVE(1, 18, 0x0)},
+    {17942696889218479070ULL, 3, MOVE(53, 45, 0x0)},
+    {17942696889218479070ULL, 2, MOVE(58, 37, 0x0)},
+    {17950980260751052398ULL, 14, MOVE(2, 29, 0x4)},
+    {17950980260751052398ULL, 1, MOVE(4, 28, 0x4)},
+    {17951311593127819798ULL, 6, MOVE(62, 45, 0x0)},
+    {17951311593127819798ULL, 2, MOVE(52, 36, 0x1)},
+    {17951311593127819798ULL, 1, MOVE(57, 42, 0x0)},
+    {17959475808500748152ULL, 1, MOVE(11, 27, 0x1)},
+    {17961973800087387749ULL, 1, MOVE(38, 45, 0x4)},
+    {17964464479095685126ULL, 1, MOVE(62, 52, 0x0)},
+    {17964464479095685126ULL, 1, MOVE(48, 40, 0x0)},
+    {17970138625296563989ULL, 2, MOVE(4, 12, 0x4)},
+    {17973348622245705243ULL, 1, MOVE(62, 52, 0x0)},
+    {17973348622245705243ULL, 1, MOVE(57, 42, 0x0)},
+    {17975516294966124570ULL, 4, MOVE(12, 28, 0x1)},
+    {17975516294966124570ULL, 1, MOVE(2, 38, 0x0)},
+    {17975516294966124570ULL, 1, MOVE(9, 17, 0x0)},
+    {17979848928863056438ULL, 48, MOVE(52, 45, 0x4)},
+    {17983520388877863366ULL, 1, MOVE(38, 30, 0x0)},
+    {17986255588715308102ULL, 1153, MOVE(51, 43, 0x0)},
+    {17986255588715308102ULL, 575, MOVE(49, 41, 0x0)},
+    {17986255588715308102ULL, 34, MOVE(53, 37, 0x1)},
+    {17986255588715308102ULL, 5, MOVE(53, 45, 0x0)},
+    {17986255588715308102ULL, 4, MOVE(52, 44, 0x0)},
+    {17986255588715308102ULL, 1, MOVE(51, 35, 0x1)},
+    {17995935677730672616ULL, 1, MOVE(52, 36, 0x1)},
+    {17997269033105695736ULL, 1, MOVE(1, 18, 0x0)},
+    {18003783440831207674ULL, 1, MOVE(52, 36, 0x1)},
+    {18005960373333159012ULL, 10, MOVE(52, 36, 0x1)},
+    {18008241743026073344ULL, 1, MOVE(6, 21, 0x0)},
+    {18008241743026073344ULL, 1, MOVE(14, 22, 0x0)},
+    {18009342839269284110ULL, 1, MOVE(52, 36, 0x1)},
+    {18013332567305626445ULL, 9, MOVE(49, 41, 0x0)},
+    {18013332567305626445ULL, 3, MOVE(62, 45, 0x0)},
+    {18013332567305626445ULL, 1, MOVE(57, 42, 0x0)},
+    {18015902995294015927ULL, 1, MOVE(50, 34, 0x1)},
+    {18019904443391595349ULL, 1, MOVE(9, 17, 0x0)},
+    {18022891502337549559ULL, 4, MOVE(37, 28, 0x4)},
+    {18024949223581808694ULL, 11, MOVE(5, 12, 0x0)},
+    {18024949223581808694ULL, 2, MOVE(6, 12, 0x0)},
+    {18034131540365824595ULL, 2, MOVE(53, 37, 0x1)},
+    {18041017455324597307ULL, 1, MOVE(51, 43, 0x0)},
+    {18043311450885669919ULL, 1, MOVE(57, 42, 0x0)},
+    {18044027928765360793ULL, 1, MOVE(58, 51, 0x0)},
+    {18044662772253459635ULL, 1, MOVE(6, 12, 0x0)},
+    {18049956861693315839ULL, 1, MOVE(4, 12, 0x0)},
+    {18054640850853446350ULL, 3, MOVE(43, 36, 0x4)},
+    {18059960452840564990ULL, 3, MOVE(28, 36, 0x0)},
+    {18060155076760058546ULL, 1, MOVE(6, 21, 0x0)},
+    {18060155076760058546ULL, 1, MOVE(15, 31, 0x1)},
+    {18061316503614821639ULL, 1, MOVE(60, 53, 0x0)},
+    {18064672796223636113ULL, 1, MOVE(61, 54, 0x0)},
+    {18064900660289856072ULL, 1, MOVE(45, 62, 0x0)},
+    {18066325456659069058ULL, 1, MOVE(9, 17, 0x0)},
+    {18066325456659069058ULL, 1, MOVE(1, 18, 0x0)},
+    {18073753960391981282ULL, 2, MOVE(11, 19, 0x0)},
+    {18075131851039488572ULL, 3, MOVE(52, 36, 0x1)},
+    {18078478844053830260ULL, 1, MOVE(12, 20, 0x0)},
+    {18084995140901047081ULL, 12, MOVE(43, 36, 0x4)},
+    {18086612917388666306ULL, 1, MOVE(57, 40, 0x0)},
+    {18092739918451552239ULL, 1, MOVE(51, 43, 0x0)},
+    {18093754722816179813ULL, 1, MOVE(12, 20, 0x0)},
+    {18095802865463277208ULL, 8, MOVE(11, 19, 0x0)},
+    {18095802865463277208ULL, 1, MOVE(1, 18, 0x0)},
+    {18097649239267738950ULL, 4, MOVE(2, 9, 0x0)},
+    {18097649239267738950ULL, 1, MOVE(12, 28, 0x1)},
+    {18099297388613665079ULL, 1, MOVE(30, 21, 0x4)},
+    {18099297388613665079ULL, 1, MOVE(62, 45, 0x0)},
+    {18100485491562254856ULL, 1, MOVE(48, 32, 0x1)},
+    {18103518584862621543ULL, 1, MOVE(15, 23, 0x0)},
+    {18105542617842407789ULL, 1, MOVE(9, 17, 0x0)},
+    {18107926669044681207ULL, 3, MOVE(52, 36, 0x1)},
+    {18115655421454057521ULL, 2, MOVE(58, 30, 0x0)},
+    {18123477648210639119ULL, 1, MOVE(61, 25, 0x0)},
+    {18124417442460565296ULL, 12, MOVE(28, 36, 0x0)},
+    {18124417442460565296ULL, 10, MOVE(1, 18, 0x0)},
+    {18128335501968969319ULL, 2, MOVE(13, 29, 0x1)},
+    {18128335501968969319ULL, 1, MOVE(3, 1, 0x2)},
+    {18131455263535361834ULL, 1, MOVE(57, 42, 0x0)},
+    {18138823188614086316ULL, 1, MOVE(10, 18, 0x0)},
+    {18139304532532527960ULL, 2, MOVE(62, 45, 0x0)},
+    {18144441598318232976ULL, 1, MOVE(2, 9, 0x0)},
+    {18146352535235649390ULL, 2, MOVE(37, 28, 0x4)},
+    {18149191074949721952ULL, 5, MOVE(43, 36, 0x4)},
+    {18159464821010636281ULL, 9, MOVE(18, 28, 0x4)},
+    {18160083601501715416ULL, 1, MOVE(12, 28, 0x1)},
+    {18160083601501715416ULL, 1, MOVE(12, 20, 0x0)},
+    {18160167639728243208ULL, 3, MOVE(48, 40, 0x0)},
+    {18160167639728243208ULL, 2, MOVE(58, 30, 0x0)},
+    {18160575012496129293ULL, 23, MOVE(8, 16, 0x0)},
+    {18160575012496129293ULL, 10, MOVE(4, 22, 0x0)},
+    {18160575012496129293ULL, 5, MOVE(6, 21, 0x0)},
+    {18160575012496129293ULL, 1, MOVE(2, 20, 0x0)},
+    {18162769172309024673ULL, 2, MOVE(43, 36, 0x4)},
+    {18168730839155399966ULL, 2, MOVE(18, 24, 0x0)},
+    {18170394284451623213ULL, 1, MOVE(53, 45, 0x0)},
+    {18175628653502220633ULL, 1, MOVE(58, 37, 0x0)},
+    {18177636757166602576ULL, 1, MOVE(30, 21, 0x4)},
+    {18181360946000062474ULL, 1, MOVE(49, 41, 0x0)},
+    {18186174444750110772ULL, 5, MOVE(35, 28, 0x4)},
+    {18187600551419456123ULL, 1, MOVE(2, 9, 0x0)},
+    {18187600551419456123ULL, 1, MOVE(12, 28, 0x1)},
+    {18191595766369024472ULL, 1, MOVE(54, 46, 0x0)},
+    {18199251077287288567ULL, 42, MOVE(10, 26, 0x1)},
+    {18199251077287288567ULL, 2, MOVE(21, 11, 0x0)},
+    {18199251077287288567ULL, 1, MOVE(4, 32, 0x0)},
+    {18203145635484479350ULL, 2, MOVE(48, 40, 0x0)},
+    {18203145635484479350ULL, 2, MOVE(51, 43, 0x0)},
+    {18203791206909501250ULL, 1, MOVE(52, 36, 0x1)},
+    {18207383455912074416ULL, 4, MOVE(51, 35, 0x1)},
+    {18207383455912074416ULL, 1, MOVE(57, 42, 0x0)},
+    {18207604262266381598ULL, 1, MOVE(3, 1, 0x2)},
+    {18207604262266381598ULL, 1, MOVE(14, 22, 0x0)},
+    {18207760298088940676ULL, 1, MOVE(59, 57, 0x2)},
+    {18215182970462999684ULL, 1, MOVE(11, 27, 0x1)},
+    {18224467871734260357ULL, 11, MOVE(53, 45, 0x0)},
+    {18224467871734260357ULL, 9, MOVE(36, 28, 0x0)},
+    {18224467871734260357ULL, 9, MOVE(51, 43, 0x0)},
+    {18224467871734260357ULL, 1, MOVE(36, 29, 0x4)},
+    {18227398382931378351ULL, 4, MOVE(11, 19, 0x0)},
+    {18229112317190813776ULL, 5, MOVE(59, 57, 0x2)},
+    {18233074494206562603ULL, 16, MOVE(36, 46, 0x0)},
+    {18233361358252252636ULL, 1, MOVE(11, 19, 0x0)},
+    {18240066192920204458ULL, 1, MOVE(53, 37, 0x1)},
+    {18240185855572797018ULL, 1, MOVE(52, 36, 0x1)},
+    {18241325219517442881ULL, 52, MOVE(1, 18, 0x0)},
+    {18241325219517442881ULL, 13, MOVE(9, 17, 0x0)},
+    {18241325219517442881ULL, 11, MOVE(6, 21, 0x0)},
+    {18245348601198315170ULL, 1, MOVE(35, 27, 0x0)},
+    {18245348601198315170ULL, 1, MOVE(52, 44, 0x0)},
+    {18245494263147143151ULL, 1, MOVE(53, 45, 0x0)},
+    {18248890985497596581ULL, 1, MOVE(57, 42, 0x0)},
+    {18251266537852898417ULL, 2, MOVE(13, 29, 0x1)},
+    {18251266537852898417ULL, 1, MOVE(1, 18, 0x0)},
+    {18251932868970671675ULL, 12, MOVE(52, 36, 0x1)},
+    {18253633825973276994ULL, 1, MOVE(55, 39, 0x1)},
+    {18258640459667608914ULL, 1, MOVE(58, 49, 0x0)},
+    {18258654199023794385ULL, 19, MOVE(59, 57, 0x2)},
+    {18258654199023794385ULL, 10, MOVE(53, 45, 0x0)},
+    {18258654199023794385ULL, 6, MOVE(52, 36, 0x1)},
+    {18258654199023794385ULL, 3, MOVE(53, 37, 0x1)},
+    {18276373860265583901ULL, 1, MOVE(6, 21, 0x0)},
+    {18278227007709910958ULL, 2, MOVE(55, 47, 0x0)},
+    {18278227007709910958ULL, 1, MOVE(51, 43, 0x0)},
+    {18278701602224634493ULL, 9, MOVE(12, 28, 0x1)},
+    {18278701602224634493ULL, 4, MOVE(29, 36, 0x4)},
+    {18279750071061608428ULL, 1, MOVE(51, 43, 0x0)},
+    {18281442944788611966ULL, 1, MOVE(1, 18, 0x0)},
+    {18283719482100206621ULL, 1, MOVE(13, 29, 0x1)},
+    {18291790701760524058ULL, 1, MOVE(13, 29, 0x1)},
+    {18295344350778702024ULL, 1999, MOVE(57, 42, 0x0)},
+    {18295344350778702024ULL, 797, MOVE(52, 36, 0x1)},
+    {18295344350778702024ULL, 65, MOVE(51, 43, 0x0)},
+    {18295344350778702024ULL, 31, MOVE(52, 44, 0x0)},
+    {18295344350778702024ULL, 30, MOVE(50, 34, 0x1)},
+    {18295344350778702024ULL, 22, MOVE(49, 41, 0x0)},
+    {18295344350778702024ULL, 4, MOVE(53, 37, 0x1)},
+    {18295344350778702024ULL, 2, MOVE(62, 45, 0x0)},
+    {18295344350778702024ULL, 2, MOVE(54, 46, 0x0)},
+    {18295344350778702024ULL, 2, MOVE(53, 45, 0x0)},
+    {18295344350778702024ULL, 1, MOVE(55, 47, 0x0)},
+    {18298102107923659682ULL, 1, MOVE(62, 45, 0x0)},
+    {18302230291970547665ULL, 4, MOVE(13, 21, 0x0)},
+    {18302720294942730011ULL, 196, MOVE(3, 1, 0x2)},
+    {18302720294942730011ULL, 128, MOVE(12, 20, 0x0)},
+    {18302720294942730011ULL, 3, MOVE(6, 21, 0x0)},
+    {18302720294942730011ULL, 1, MOVE(4, 11, 0x0)},
+    {18302720294942730011ULL, 1, MOVE(12, 28, 0x1)},
+    {18305210571277610901ULL, 1, MOVE(61, 25, 0x0)},
+    {18306281971566318449ULL, 3, MOVE(18, 28, 0x0)},
+    {18308076639110698464ULL, 1, MOVE(52, 36, 0x1)},
+    {18311852058031207883ULL, 1, MOVE(52, 36, 0x1)},
+    {18313940594820593511ULL, 15, MOVE(60, 42, 0x0)},
+    {18313940594820593511ULL, 3, MOVE(54, 45, 0x4)},
+    {18320648813819720171ULL, 2, MOVE(6, 21, 0x4)},
+    {18321024871398562447ULL, 1, MOVE(4, 13, 0x0)},
+    {18327866067212850889ULL, 1, MOVE(62, 45, 0x0)},
+    {18331364818771772703ULL, 2, MOVE(5, 14, 0x0)},
+    {18332203148590987961ULL, 38, MOVE(58, 49, 0x0)},
+    {18332224890112414164ULL, 1, MOVE(52, 36, 0x1)},
+    {18335840822313811106ULL, 1, MOVE(2, 9, 0x0)},
+    {18336960009219471989ULL, 1, MOVE(53, 45, 0x0)},
+    {18337647927603569795ULL, 1, MOVE(1, 18, 0x0)},
+    {18338535724100163188ULL, 1, MOVE(6, 12, 0x0)},
+    {18339136762031753310ULL, 2, MOVE(48, 40, 0x0)},
+    {18342381722415433794ULL, 1, MOVE(49, 33, 0x1)},
+    {18343134245708614916ULL, 1, MOVE(18, 35, 0x0)},
+    {18346640659412894586ULL, 27, MOVE(52, 36, 0x1)},
+    {18346640659412894586ULL, 1, MOVE(49, 41, 0x0)},
+    {18346640659412894586ULL, 1, MOVE(42, 27, 0x0)},
+    {18350285346017450764ULL, 1, MOVE(2, 20, 0x0)},
+    {18351007843834764778ULL, 1, MOVE(12, 28, 0x1)},
+    {18352439132839590361ULL, 1, MOVE(58, 51, 0x0)},
+    {18355500386696156565ULL, 3, MOVE(59, 57, 0x2)},
+    {18355500386696156565ULL, 2, MOVE(51, 35, 0x1)},
+    {18357906187242215863ULL, 1, MOVE(2, 29, 0x0)},
+    {18358590189847490574ULL, 1, MOVE(44, 35, 0x4)},
+    {18365075640868446412ULL, 1, MOVE(62, 52, 0x0)},
+    {18365496232713548174ULL, 3, MOVE(42, 27, 0x4)},
+    {18367023779342783803ULL, 2, MOVE(5, 14, 0x0)},
+    {18367464845307951065ULL, 5, MOVE(6, 21, 0x0)},
+    {18368591231038986601ULL, 1, MOVE(1, 11, 0x0)},
+    {18372922676215202040ULL, 2, MOVE(49, 41, 0x0)},
+    {18373868559938525930ULL, 4, MOVE(53, 37, 0x1)},
+    {18376748313569109242ULL, 1, MOVE(60, 52, 0x4)},
+    {18377189299910335032ULL, 1, MOVE(53, 37, 0x4)},
+    {18379741013536072485ULL, 2, MOVE(6, 21, 0x0)},
+    {18384635556512858120ULL, 1, MOVE(49, 41, 0x0)},
+    {18387899818803381272ULL, 1, MOVE(49, 41, 0x0)},
+    {18390433579275433556ULL, 2, MOVE(11, 27, 0x1)},
+    {18390433579275433556ULL, 1, MOVE(1, 18, 0x0)},
+    {18394644541088175796ULL, 1, MOVE(13, 29, 0x1)},
+    {18397927602723351586ULL, 10, MOVE(30, 21, 0x4)},
+    {18397927602723351586ULL, 1, MOVE(59, 57, 0x2)},
+    {18401970026704119080ULL, 1, MOVE(58, 44, 0x0)},
+    {18414656148149789377ULL, 1, MOVE(54, 46, 0x0)},
+    {18414656148149789377ULL, 1, MOVE(52, 44, 0x0)},
+    {18439627273315409172ULL, 1, MOVE(27, 36, 0x4)},
+    {18444431847159111900ULL, 1, MOVE(12, 28, 0x1)}
 };
 
-static const int openings_size = sizeof(openings) / sizeof(Opening);
\ No newline at end of file
+const int openings_size = sizeof(openings) / sizeof(Opening);
\ No newline at end of file
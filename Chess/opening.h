@@ -11,8 +11,15 @@ typedef struct {
     Move move;
 } Opening;
 
+// Opening book, sorted by hash so the entries of a position are next to each other.
 extern const Opening openings[];
+extern const int openings_size;
 
+// Finds the book entries with the given hash by binary search. Returns their number and points
+// first at the first of them.
+int find_openings(uint64_t hash, const Opening** first);
+// Picks one of the book moves of the position at random, weighted by count. Returns false if the
+// position is not in the book.
 bool select_opening(Board* board, Move* move);
 
 #endif
\ No newline at end of file
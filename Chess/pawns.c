@@ -0,0 +1,128 @@
+#include <stdint.h>
+#include "tinycthread.h"
+#include "pawns.h"
+#include "bitboard.h"
+#include "board.h"
+
+// Pawn structure only changes on pawn moves and pawn captures, so most evaluations find their entry
+// here. Each thread has its own table, so no locking is needed.
+static _Thread_local PawnEntry pawn_table[1 << PAWN_TABLE_BITS];
+static _Thread_local PawnStats pawn_stats;
+
+// Pawns move towards the eighth rank for white and the first rank for black.
+#define FORWARD(x, color) ((color) == WHITE ? (x) << 8 : (x) >> 8)
+#define FORWARD_FILL(x, color) ((color) == WHITE ? north_fill(x) : south_fill(x))
+#define BACKWARD_FILL(x, color) ((color) == WHITE ? south_fill(x) : north_fill(x))
+// Shift towards the A and H files.
+#define SHIFT_WEST(x) (((x) << 1) & ~FILEH)
+#define SHIFT_EAST(x) (((x) >> 1) & ~FILEA)
+#define RELATIVE_RANK(i, color) ((color) == WHITE ? (i) / 8 : 7 - (i) / 8)
+
+Bitboard north_fill(Bitboard bitboard) {
+    bitboard |= bitboard << 8;
+    bitboard |= bitboard << 16;
+    bitboard |= bitboard << 32;
+    return bitboard;
+}
+
+Bitboard south_fill(Bitboard bitboard) {
+    bitboard |= bitboard >> 8;
+    bitboard |= bitboard >> 16;
+    bitboard |= bitboard >> 32;
+    return bitboard;
+}
+
+uint8_t file_set(Bitboard bitboard) {
+    return south_fill(bitboard) & RANK1;
+}
+
+// Fills in the fields of the entry for one color and returns its score in the middle and end game.
+INLINE void pawn_structure(PawnEntry* entry, int* middle_game, int* end_game, const Piece color) {
+    const Piece enemy = OPPOSITE(color);
+    Bitboard pawns = entry->pawns[color & 1];
+    Bitboard enemy_pawns = entry->pawns[enemy & 1];
+
+    Bitboard attacks = FORWARD(SHIFT_WEST(pawns) | SHIFT_EAST(pawns), color);
+    Bitboard enemy_attacks = FORWARD(SHIFT_WEST(enemy_pawns) | SHIFT_EAST(enemy_pawns), enemy);
+    // Squares in front of the enemy pawns and on either side of them.
+    Bitboard enemy_spans = FORWARD_FILL(FORWARD(enemy_pawns | SHIFT_WEST(enemy_pawns) | SHIFT_EAST(enemy_pawns), enemy), enemy);
+    // Pawns with no enemy pawn in front of them on their own file.
+    Bitboard open = pawns & ~BACKWARD_FILL(FORWARD(enemy_pawns, enemy), color);
+
+    entry->passed[color & 1] = pawns & ~enemy_spans;
+    entry->attack_spans[color & 1] = FORWARD_FILL(attacks, color);
+    entry->files[color & 1] = file_set(pawns);
+
+    // Squares the pawns could defend by advancing, including the squares next to them.
+    Bitboard support = FORWARD_FILL(SHIFT_WEST(pawns) | SHIFT_EAST(pawns), color);
+    // The square in front is attacked by an enemy pawn and no friendly pawn can come to help.
+    Bitboard backward = FORWARD(FORWARD(pawns, color) & enemy_attacks & ~support, enemy);
+    Bitboard connected = pawns & (attacks | SHIFT_WEST(pawns) | SHIFT_EAST(pawns));
+    Bitboard candidates = open & ~entry->passed[color & 1] & ~backward;
+
+    int stacked = 0;
+    int isolated = 0;
+    uint8_t files = entry->files[color & 1];
+    for (int i = 0; i < 8; i++) {
+        Bitboard file = FILEH << i;
+        int count = COUNT(pawns & file);
+        stacked += count > 1;
+        isolated += count * ((files & (0b101 << i >> 1)) == 0);
+    }
+
+    int score = 0;
+    score -= STACKED_PAWN_PENALTY * stacked;
+    score -= ISOLATED_PAWN_PENALTY * isolated;
+    score -= BACKWARD_PAWN_PENALTY * COUNT(backward);
+    score += CONNECTED_PAWN_BONUS * COUNT(connected);
+    score += CANDIDATE_PAWN_BONUS * COUNT(candidates);
+
+    *middle_game = score;
+    *end_game = score;
+
+    Bitboard passed = entry->passed[color & 1];
+    while (passed != 0) {
+        int i = LSB(passed);
+        passed &= passed - 1;
+        *middle_game += PASSED_PAWN_MIDDLE_GAME[RELATIVE_RANK(i, color)];
+        *end_game += PASSED_PAWN_END_GAME[RELATIVE_RANK(i, color)];
+    }
+}
+
+const PawnEntry* probe_pawns(Board* board) {
+    Bitboard white = get_pieces(board, PAWN, WHITE);
+    Bitboard black = get_pieces(board, PAWN, BLACK);
+
+    uint64_t key = (white * 0x9e3779b97f4a7c15ULL) ^ (black * 0xc2b2ae3d27d4eb4fULL);
+    PawnEntry* entry = &pawn_table[key >> (64 - PAWN_TABLE_BITS)];
+
+    pawn_stats.probes++;
+    if (entry->pawns[WHITE & 1] == white && entry->pawns[BLACK & 1] == black) {
+        pawn_stats.hits++;
+        return entry;
+    }
+
+    entry->pawns[WHITE & 1] = white;
+    entry->pawns[BLACK & 1] = black;
+
+    int white_middle_game, white_end_game, black_middle_game, black_end_game;
+    pawn_structure(entry, &white_middle_game, &white_end_game, WHITE);
+    pawn_structure(entry, &black_middle_game, &black_end_game, BLACK);
+    entry->middle_game = white_middle_game - black_middle_game;
+    entry->end_game = white_end_game - black_end_game;
+
+    return entry;
+}
+
+void get_pawn_stats(PawnStats* stats) {
+    *stats = pawn_stats;
+}
+
+void clear_pawn_stats() {
+    pawn_stats.probes = 0;
+    pawn_stats.hits = 0;
+}
+
+// Bonus for a passed pawn by its rank, counted from the side of the pawn's owner.
+const int PASSED_PAWN_MIDDLE_GAME[8] = {0, 5, 5, 10, 20, 35, 60, 0};
+const int PASSED_PAWN_END_GAME[8] = {0, 10, 15, 25, 40, 70, 110, 0};
\ No newline at end of file
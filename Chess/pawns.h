@@ -0,0 +1,49 @@
+#ifndef PAWNS_H_
+#define PAWNS_H_
+
+#include <stdint.h>
+#include "bitboard.h"
+#include "board.h"
+
+// Number of entries in each thread's pawn table, as a power of two.
+#define PAWN_TABLE_BITS 12
+
+#define STACKED_PAWN_PENALTY 5
+#define ISOLATED_PAWN_PENALTY 5
+#define BACKWARD_PAWN_PENALTY 8
+#define CONNECTED_PAWN_BONUS 5
+#define CANDIDATE_PAWN_BONUS 10
+
+#define ROOK_OPEN_FILE_BONUS 20
+#define ROOK_HALF_OPEN_FILE_BONUS 10
+
+// Everything in an entry follows from the pawns alone, so it is keyed by the two pawn bitboards.
+// An all zero entry is exactly the entry of a board without pawns, so an empty table is valid.
+// Arrays are indexed by color & 1 and scores are from white's point of view.
+typedef struct {
+    Bitboard pawns[2];
+    Bitboard passed[2];
+    Bitboard attack_spans[2]; // Squares the pawns attack now or could attack after advancing.
+    int16_t middle_game;
+    int16_t end_game;
+    uint8_t files[2]; // One bit per file containing pawns of that color, bit 0 for the H file.
+} PawnEntry;
+
+typedef struct {
+    uint64_t probes;
+    uint64_t hits;
+} PawnStats;
+
+extern const int PASSED_PAWN_MIDDLE_GAME[8];
+extern const int PASSED_PAWN_END_GAME[8];
+
+const PawnEntry* probe_pawns(Board* board);
+
+void get_pawn_stats(PawnStats* stats);
+void clear_pawn_stats();
+
+Bitboard north_fill(Bitboard bitboard);
+Bitboard south_fill(Bitboard bitboard);
+uint8_t file_set(Bitboard bitboard);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,251 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "polyglot.h"
+#include "bitboard.h"
+#include "board.h"
+#include "move.h"
+
+#define POLYGLOT_CASTLE 768
+#define POLYGLOT_EN_PASSANT 772
+#define POLYGLOT_TURN 780
+
+// Kind of the black piece of each type, the white one follows it.
+static const int POLYGLOT_KINDS[8] = {0, 0, 2, 10, 4, 6, 8, 0};
+
+typedef struct {
+    const uint8_t* entries;
+    uint64_t n_entries;
+    const void* mapping;
+    size_t length;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE view;
+#endif
+} Book;
+
+static Book books[POLYGLOT_MAX_BOOKS];
+static int n_books = 0;
+
+static bool map_book(Book* book, const char* path) {
+#ifdef _WIN32
+    book->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (book->file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size;
+    GetFileSizeEx(book->file, &size);
+    book->length = (size_t) size.QuadPart;
+    book->view = book->length == 0 ? NULL : CreateFileMappingA(book->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    book->mapping = book->view == NULL ? NULL : MapViewOfFile(book->view, FILE_MAP_READ, 0, 0, 0);
+    if (book->mapping == NULL) {
+        if (book->view != NULL) CloseHandle(book->view);
+        CloseHandle(book->file);
+        return false;
+    }
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    book->length = (size_t) st.st_size;
+    void* mapping = mmap(NULL, book->length, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) return false;
+    book->mapping = mapping;
+#endif
+    return true;
+}
+
+static void unmap_book(Book* book) {
+#ifdef _WIN32
+    UnmapViewOfFile(book->mapping);
+    CloseHandle(book->view);
+    CloseHandle(book->file);
+#else
+    munmap((void*) book->mapping, book->length);
+#endif
+}
+
+// Books are only found with the published random numbers, a wrong table would miss every position.
+static bool check_random() {
+    Board board;
+    board_from_fen(&board, "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+    if (polyglot_key(&board) == POLYGLOT_START_KEY) return true;
+    fprintf(stderr, "POLYGLOT_RANDOM is not the Polyglot Random64 array.\n");
+    return false;
+}
+
+bool book_open(const char* path) {
+    if (n_books == POLYGLOT_MAX_BOOKS || !check_random()) return false;
+    Book* book = &books[n_books];
+    if (!map_book(book, path)) return false;
+
+    if (book->length % POLYGLOT_ENTRY_SIZE != 0) {
+        fprintf(stderr, "Invalid opening book %s.\n", path);
+        unmap_book(book);
+        return false;
+    }
+    book->entries = book->mapping;
+    book->n_entries = book->length / POLYGLOT_ENTRY_SIZE;
+    n_books++;
+    return true;
+}
+
+int book_init(const char* list) {
+    FILE* file = fopen(list, "r");
+    if (file == NULL) return 0;
+
+    char line[1024];
+    int n = 0;
+    while (fgets(line, sizeof(line), file)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0' || line[0] == '#') continue;
+        n += book_open(line);
+    }
+    fclose(file);
+    return n;
+}
+
+void book_free() {
+    for (int i = 0; i < n_books; i++) unmap_book(&books[i]);
+    n_books = 0;
+}
+
+int book_count() {
+    return n_books;
+}
+
+// Squares are numbered from the A file in the book and from the H file on the board.
+INLINE int polyglot_square(int square) {
+    return square ^ 7;
+}
+
+uint64_t polyglot_key(Board* board) {
+    uint64_t key = 0;
+    Bitboard pieces = get_all_pieces(board);
+    while (pieces) {
+        int square = LSB(pieces);
+        pieces &= pieces - 1;
+        int kind = POLYGLOT_KINDS[get_piece(board, square)] + (get_color(board, square) == WHITE);
+        key ^= POLYGLOT_RANDOM[64 * kind + polyglot_square(square)];
+    }
+
+    if (can_castle_kingside(board, WHITE)) key ^= POLYGLOT_RANDOM[POLYGLOT_CASTLE];
+    if (can_castle_queenside(board, WHITE)) key ^= POLYGLOT_RANDOM[POLYGLOT_CASTLE + 1];
+    if (can_castle_kingside(board, BLACK)) key ^= POLYGLOT_RANDOM[POLYGLOT_CASTLE + 2];
+    if (can_castle_queenside(board, BLACK)) key ^= POLYGLOT_RANDOM[POLYGLOT_CASTLE + 3];
+
+    // The en passant file only counts if a pawn next to the pawn which just moved can take it.
+    if (board->en_passant != 0) {
+        int pawn = board->en_passant + (WHITE_TO_MOVE(board) ? -8 : 8);
+        int file = pawn & 7;
+        Bitboard neighbors = (file > 0 ? 1ULL << (pawn - 1) : 0) | (file < 7 ? 1ULL << (pawn + 1) : 0);
+        if (neighbors & get_pieces(board, PAWN, board->active_color)) {
+            key ^= POLYGLOT_RANDOM[POLYGLOT_EN_PASSANT + (polyglot_square(board->en_passant) & 7)];
+        }
+    }
+
+    if (WHITE_TO_MOVE(board)) key ^= POLYGLOT_RANDOM[POLYGLOT_TURN];
+    return key;
+}
+
+uint16_t polyglot_move(Move move) {
+    int from = MOVE_FROM(move);
+    int to = MOVE_TO(move);
+    Flag flags = MOVE_FLAGS(move);
+    // The king moves onto its rook.
+    if (IS_CASTLE_KINGSIDE(flags)) to = from - 3;
+    if (IS_CASTLE_QUEENSIDE(flags)) to = from + 4;
+
+    uint16_t encoded = polyglot_square(to) | polyglot_square(from) << 6;
+    if (IS_PROMOTION(flags)) encoded |= ((flags & 0x3) + 1) << 12;
+    return encoded;
+}
+
+static uint64_t read64(const uint8_t* data) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++) value = value << 8 | data[i];
+    return value;
+}
+
+static uint16_t read16(const uint8_t* data) {
+    return data[0] << 8 | data[1];
+}
+
+// Index of the first entry with the key, or n_entries if there is none.
+static uint64_t find_entry(const Book* book, uint64_t key) {
+    uint64_t low = 0, high = book->n_entries;
+    while (low < high) {
+        uint64_t middle = low + (high - low) / 2;
+        if (read64(book->entries + middle * POLYGLOT_ENTRY_SIZE) < key) low = middle + 1;
+        else high = middle;
+    }
+    return low;
+}
+
+int book_probe(Board* board, Move* moves, int* weights) {
+    if (n_books == 0) return 0;
+    uint64_t key = polyglot_key(board);
+
+    Move legal[MAX_MOVES];
+    int n_legal = gen_moves(board, legal);
+
+    for (int i = 0; i < n_books; i++) {
+        const Book* book = &books[i];
+        int n = 0;
+        for (uint64_t j = find_entry(book, key); j < book->n_entries; j++) {
+            const uint8_t* entry = book->entries + j * POLYGLOT_ENTRY_SIZE;
+            if (read64(entry) != key) break;
+
+            // Only legal moves are returned in case of key collisions or broken books.
+            uint16_t encoded = read16(entry + 8);
+            for (int k = 0; k < n_legal && n < MAX_MOVES; k++) {
+                if (polyglot_move(legal[k]) == encoded) {
+                    moves[n] = legal[k];
+                    weights[n++] = read16(entry + 10);
+                    break;
+                }
+            }
+        }
+        if (n > 0) return n;
+    }
+    return 0;
+}
+
+bool book_select(Board* board, Move* move) {
+    Move moves[MAX_MOVES];
+    int weights[MAX_MOVES];
+    int n = book_probe(board, moves, weights);
+
+    int total = 0;
+    for (int i = 0; i < n; i++) total += weights[i];
+    if (total == 0) return false;
+
+    static bool seeded = false;
+    if (!seeded) {
+        srand(time(NULL));
+        seeded = true;
+    }
+    int selection = rand() % total;
+    for (int i = 0; i < n; i++) {
+        selection -= weights[i];
+        if (selection < 0) {
+            *move = moves[i];
+            return true;
+        }
+    }
+    return false;
+}
\ No newline at end of file
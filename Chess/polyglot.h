@@ -0,0 +1,60 @@
+#ifndef POLYGLOT_H_
+#define POLYGLOT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "board.h"
+#include "move.h"
+
+// Opening books in the Polyglot format, loaded from files at runtime. The files are memory mapped
+// read only and searched in place, so a book of any size is ready as soon as it is mapped and its
+// pages are only read in when a probe touches them.
+//
+// Several books can be loaded at once. They form a chain in the order they were opened: a position
+// is played from the first book that has it, so a small book with prepared lines can be put in
+// front of a large general one. Books are probed at any move, unlike the built in book in opening.h.
+//
+// A book is a sorted array of 16 byte entries, big endian:
+//     uint64_t key     (polyglot_key of the position)
+//     uint16_t move    (bits 0-5 destination, 6-11 source, with squares numbered from a1 = 0 and
+//                       h1 = 7, bits 12-14 promotion: 1 knight, 2 bishop, 3 rook, 4 queen)
+//     uint16_t weight  (moves are picked with a probability proportional to their weight)
+//     uint32_t learn   (unused)
+// Castling is stored as the king capturing its own rook, e1h1 for white castling kingside.
+//
+// The key XORs one number of POLYGLOT_RANDOM for every piece (64 * kind + square, with kinds
+// ordered black pawn, white pawn, black knight, white knight and so on up to the white king), for
+// every castling right (768 to 771: white kingside, white queenside, black kingside, black
+// queenside), for the file of the en passant square if a pawn of the side to move can capture on
+// it (772 to 779) and for white to move (780).
+
+#define POLYGLOT_RANDOM_SIZE 781
+#define POLYGLOT_ENTRY_SIZE 16
+#define POLYGLOT_MAX_BOOKS 16
+// Key of the starting position in the format, which book_open checks POLYGLOT_RANDOM against.
+#define POLYGLOT_START_KEY 0x463b96181691fc9cULL
+
+extern const uint64_t POLYGLOT_RANDOM[POLYGLOT_RANDOM_SIZE];
+
+// Maps the book at the end of the chain. Returns false if the file can not be mapped or is not a
+// Polyglot book, or if the starting position does not hash to POLYGLOT_START_KEY.
+bool book_open(const char* path);
+// Opens the books listed in a text file, one path per line in the order of the chain. Returns the
+// number of books loaded.
+int book_init(const char* list);
+// Unmaps all books. Must not be called while a search is running.
+void book_free();
+int book_count();
+
+uint64_t polyglot_key(Board* board);
+// The move in the encoding of the book entries.
+uint16_t polyglot_move(Move move);
+
+// Legal moves and weights of the position in the first book of the chain which has it. Returns
+// their number, 0 if no book has the position.
+int book_probe(Board* board, Move* moves, int* weights);
+// Picks one of the book moves of the position at random, weighted by the book. Returns false if no
+// book has the position.
+bool book_select(Board* board, Move* move);
+
+#endif
\ No newline at end of file
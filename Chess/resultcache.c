@@ -0,0 +1,234 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "resultcache.h"
+#include "engine.h"
+#include "tinycthread.h"
+#include "board.h"
+
+#define START_FEN "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+
+typedef struct {
+    CachedResult result;
+    int32_t next; // Next entry of the bucket, -1 for none.
+    bool referenced; // Set by hits, cleared by the clock hand.
+} Slot;
+
+typedef struct {
+    mtx_t lock;
+    Slot* slots;
+    int32_t* buckets;
+    int capacity;
+    int bucket_mask;
+    int used;
+    int hand;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t stores;
+    uint64_t evictions;
+} Shard;
+
+struct EngineCache {
+    Shard shards[CACHE_SHARDS];
+    uint64_t bytes;
+};
+
+INLINE Shard* get_shard(EngineCache* cache, uint64_t key) {
+    return &cache->shards[key >> 58];
+}
+
+INLINE int32_t* get_bucket(Shard* shard, uint64_t key) {
+    return &shard->buckets[key & shard->bucket_mask];
+}
+
+EngineCache* engine_cache_new(int megabytes) {
+    EngineCache* cache = malloc(sizeof(EngineCache));
+    if (cache == NULL) return NULL;
+
+    // A bucket for every entry rounded up to a power of two.
+    uint64_t bytes = (uint64_t) (megabytes > 0 ? megabytes : 1) << 20;
+    int capacity = bytes / CACHE_SHARDS / (sizeof(Slot) + 2 * sizeof(int32_t));
+    if (capacity < 1) capacity = 1;
+    int buckets = 1;
+    while (buckets < capacity) buckets <<= 1;
+
+    cache->bytes = sizeof(EngineCache);
+    for (int i = 0; i < CACHE_SHARDS; i++) {
+        Shard* shard = &cache->shards[i];
+        shard->slots = malloc(capacity * sizeof(Slot));
+        shard->buckets = malloc(buckets * sizeof(int32_t));
+        if (shard->slots == NULL || shard->buckets == NULL) {
+            for (int j = 0; j <= i; j++) {
+                free(cache->shards[j].slots);
+                free(cache->shards[j].buckets);
+            }
+            free(cache);
+            return NULL;
+        }
+        memset(shard->buckets, 0xff, buckets * sizeof(int32_t));
+        shard->capacity = capacity;
+        shard->bucket_mask = buckets - 1;
+        shard->used = 0;
+        shard->hand = 0;
+        shard->hits = shard->misses = shard->stores = shard->evictions = 0;
+        mtx_init(&shard->lock, mtx_plain);
+        cache->bytes += capacity * sizeof(Slot) + buckets * sizeof(int32_t);
+    }
+    return cache;
+}
+
+void engine_cache_free(EngineCache* cache) {
+    for (int i = 0; i < CACHE_SHARDS; i++) {
+        free(cache->shards[i].slots);
+        free(cache->shards[i].buckets);
+        mtx_destroy(&cache->shards[i].lock);
+    }
+    free(cache);
+}
+
+static Slot* find_slot(Shard* shard, uint64_t key) {
+    for (int32_t i = *get_bucket(shard, key); i != -1; i = shard->slots[i].next) {
+        if (shard->slots[i].result.key == key) return &shard->slots[i];
+    }
+    return NULL;
+}
+
+// Reached any of the limits, see resultcache.h.
+static bool satisfies(const CachedResult* result, const EngineLimits* limits) {
+    return (limits->depth > 0 && result->depth >= limits->depth) ||
+           (limits->nodes > 0 && result->nodes >= limits->nodes) ||
+           (limits->milliseconds > 0 && result->milliseconds >= limits->milliseconds);
+}
+
+bool cache_get(EngineCache* cache, uint64_t key, const EngineLimits* limits, CachedResult* result) {
+    Shard* shard = get_shard(cache, key);
+    mtx_lock(&shard->lock);
+    Slot* slot = find_slot(shard, key);
+    bool hit = slot != NULL && satisfies(&slot->result, limits);
+    if (hit) {
+        *result = slot->result;
+        slot->referenced = true;
+        shard->hits++;
+    } else {
+        shard->misses++;
+    }
+    mtx_unlock(&shard->lock);
+    return hit;
+}
+
+// Takes the next entry the clock hand finds unreferenced out of its bucket.
+static int32_t evict(Shard* shard) {
+    while (shard->slots[shard->hand].referenced) {
+        shard->slots[shard->hand].referenced = false;
+        shard->hand = (shard->hand + 1) % shard->capacity;
+    }
+    int32_t victim = shard->hand;
+    shard->hand = (shard->hand + 1) % shard->capacity;
+
+    int32_t* link = get_bucket(shard, shard->slots[victim].result.key);
+    while (*link != victim) link = &shard->slots[*link].next;
+    *link = shard->slots[victim].next;
+    shard->evictions++;
+    return victim;
+}
+
+void cache_put(EngineCache* cache, const CachedResult* result) {
+    Shard* shard = get_shard(cache, result->key);
+    mtx_lock(&shard->lock);
+    Slot* slot = find_slot(shard, result->key);
+    if (slot != NULL) {
+        if (result->depth > slot->result.depth ||
+            (result->depth == slot->result.depth && result->nodes > slot->result.nodes)) {
+            slot->result = *result;
+            shard->stores++;
+        }
+    } else {
+        int32_t index = shard->used < shard->capacity ? shard->used++ : evict(shard);
+        slot = &shard->slots[index];
+        slot->result = *result;
+        slot->referenced = false;
+        int32_t* bucket = get_bucket(shard, result->key);
+        slot->next = *bucket;
+        *bucket = index;
+        shard->stores++;
+    }
+    mtx_unlock(&shard->lock);
+}
+
+void engine_cache_stats(EngineCache* cache, EngineCacheStats* stats) {
+    memset(stats, 0, sizeof(EngineCacheStats));
+    for (int i = 0; i < CACHE_SHARDS; i++) {
+        Shard* shard = &cache->shards[i];
+        mtx_lock(&shard->lock);
+        stats->hits += shard->hits;
+        stats->misses += shard->misses;
+        stats->stores += shard->stores;
+        stats->evictions += shard->evictions;
+        stats->entries += shard->used;
+        stats->capacity += shard->capacity;
+        mtx_unlock(&shard->lock);
+    }
+    stats->bytes = cache->bytes;
+}
+
+static uint64_t start_key() {
+    Board board;
+    board_from_fen(&board, START_FEN);
+    return position_key(&board);
+}
+
+int engine_cache_save(EngineCache* cache, const char* path) {
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) return ENGINE_NOT_FOUND;
+
+    uint32_t entry_size = sizeof(CachedResult);
+    uint64_t check = start_key();
+    uint64_t count = 0;
+    fwrite(CACHE_MAGIC, 1, 4, file);
+    fwrite(&entry_size, sizeof(entry_size), 1, file);
+    fwrite(&check, sizeof(check), 1, file);
+    fwrite(&count, sizeof(count), 1, file);
+
+    // Each shard is locked only while it is written.
+    for (int i = 0; i < CACHE_SHARDS; i++) {
+        Shard* shard = &cache->shards[i];
+        mtx_lock(&shard->lock);
+        for (int j = 0; j < shard->used; j++) fwrite(&shard->slots[j].result, sizeof(CachedResult), 1, file);
+        count += shard->used;
+        mtx_unlock(&shard->lock);
+    }
+    fseek(file, 16, SEEK_SET);
+    fwrite(&count, sizeof(count), 1, file);
+    bool written = ferror(file) == 0;
+    fclose(file);
+    return written ? (int) count : ENGINE_NOT_FOUND;
+}
+
+int engine_cache_load(EngineCache* cache, const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) return ENGINE_NOT_FOUND;
+
+    char magic[4];
+    uint32_t entry_size;
+    uint64_t check, count;
+    if (fread(magic, 1, 4, file) != 4 || memcmp(magic, CACHE_MAGIC, 4) != 0 ||
+        fread(&entry_size, sizeof(entry_size), 1, file) != 1 || entry_size != sizeof(CachedResult) ||
+        fread(&check, sizeof(check), 1, file) != 1 || check != start_key() ||
+        fread(&count, sizeof(count), 1, file) != 1) {
+        fclose(file);
+        return ENGINE_NOT_FOUND;
+    }
+
+    int loaded = 0;
+    CachedResult result;
+    for (uint64_t i = 0; i < count && fread(&result, sizeof(result), 1, file) == 1; i++) {
+        // Results without a move, or with a line longer than fits, can only come from a damaged file.
+        if (result.pv_length < 1 || result.pv_length > MAX_PV) continue;
+        cache_put(cache, &result);
+        loaded++;
+    }
+    fclose(file);
+    return loaded;
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#ifndef RESULTCACHE_H_
+#define RESULTCACHE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "engine.h"
+#include "move.h"
+#include "search.h"
+
+// Cache of finished searches in front of engine_search, shared by any number of engines.
+//
+// Results are stored by position key, and a lookup returns a result which is at least as good as a
+// search with the given limits would be: one which reached the depth, spent the nodes or took the
+// time of any of the limits, since the search stops at the first of them. So deeper results answer
+// shallower requests, and a search without limits is never answered from the cache.
+//
+// The cache is split into CACHE_SHARDS shards by the top bits of the key, each with its own lock,
+// so engines on different threads rarely wait for each other. A shard is a fixed number of entries
+// chained into hash buckets and evicted by the CLOCK algorithm: every hit marks its entry, and the
+// hand sweeping the entries for a free one clears the marks and takes the first unmarked entry, so
+// entries which were used since the last sweep stay. The entries never move and the memory is
+// allocated up front.
+//
+// A snapshot is a header followed by the stored results as they are in memory:
+//     char magic[4]        ("CRC1")
+//     uint32_t entry_size  (sizeof(CachedResult), the file is only read by the same build)
+//     uint64_t check       (position_key of the starting position, for the Zobrist keys)
+//     uint64_t count
+//     CachedResult results[count]
+
+#define CACHE_SHARDS 64
+#define CACHE_MAGIC "CRC1"
+
+typedef struct {
+    uint64_t key;
+    int32_t score; // Of the last completed iteration, see CHECKMATE for mate scores.
+    int16_t depth;
+    int16_t pv_length;
+    uint64_t nodes; // Spent by the search, as counted for its node limit.
+    uint64_t milliseconds;
+    Move pv[MAX_PV];
+} CachedResult;
+
+bool cache_get(EngineCache* cache, uint64_t key, const EngineLimits* limits, CachedResult* result);
+// Keeps the better of the result and the one stored for its key, if any.
+void cache_put(EngineCache* cache, const CachedResult* result);
+
+#endif
\ No newline at end of file
@@ -4,13 +4,30 @@
 #include <limits.h>
 #include <stdbool.h>
 #include <time.h>
+#include <stdatomic.h>
 #include "tinycthread.h"
 #include "search.h"
 #include "opening.h"
+#include "polyglot.h"
 #include "board.h"
 #include "evaluate.h"
 #include "move.h"
 #include "hashmap.h"
+#include "pawns.h"
+#include "nnue.h"
+#include "endgame.h"
+#include "tablebase.h"
+
+// Statistics of the last search started on this thread.
+static _Thread_local SearchStats search_stats;
+
+// Static evaluations are shared by all searches, so the cache is allocated once and never cleared.
+static EvalCache* eval_cache;
+static once_flag eval_cache_flag = ONCE_FLAG_INIT;
+
+static void alloc_eval_cache() {
+    eval_cache = evalcache_alloc(EVAL_CACHE_SIZE);
+}
 
 int timer(void* arg) {
     sleep(SEARCH_TIMEOUT);
@@ -23,54 +40,194 @@ void start_timer(bool* stop) {
     thrd_create(&thrd, timer, stop);
 }
 
+static void reset_search_stats() {
+    search_stats.depth = 0;
+    search_stats.nodes = 0;
+    search_stats.eval_probes = 0;
+    search_stats.eval_hits = 0;
+    search_stats.lazy_probes = 0;
+    search_stats.lazy_exits = 0;
+    search_stats.endgame_hits = 0;
+    search_stats.tablebase_hits = 0;
+    clear_pawn_stats();
+}
+
 bool select_move(Board* board, HashMap* hashmap, Move* move) {
-    if (IN_OPENING_BOOK(board)) {
-        // If an opening could be found, make that move.
-        if (select_opening(board, move)) {
-            sleep(SEARCH_TIMEOUT);
-            return true;
-        }
+    // Books loaded at runtime are probed at any move, the built in book only in the first moves.
+    // If an opening could be found, make that move.
+    if (book_select(board, move) || (IN_OPENING_BOOK(board) && select_opening(board, move))) {
+        sleep(SEARCH_TIMEOUT);
+        return true;
     }
 
-    hashmap_clear(hashmap);
+    // A hashmap kept in a file or shared with other processes keeps its entries from move to move.
+    if (hashmap->file == NULL) hashmap_clear(hashmap);
+
+    // Won and lost endings in the tablebases are played from them without searching.
+    if (tb_probe_root(board, move)) {
+        reset_search_stats();
+        search_stats.tablebase_hits++;
+        return true;
+    }
 
     bool stop = false;
     start_timer(&stop);
 
-    Move selected;
+    SearchLimits limits = {0, 0, 1};
+    bool found = search_position(board, hashmap, &limits, &stop, NULL, NULL, move);
+
+    // The timer still writes to stop, and the GUI expects the search to take its full time.
+    struct timespec wait = {0, 1000000};
+    while (!stop) thrd_sleep(&wait, NULL);
+    return found;
+}
+
+// Node limit of the search on this thread, 0 for none.
+static _Thread_local uint64_t node_limit;
+
+typedef struct {
+    Board board;
+    HashMap* hashmap;
+    bool* stop;
+    int depth;
+    _Atomic uint64_t* nodes; // Of all helpers of the search, added after each of their iterations.
+} Helper;
+
+// One iteration of iterative deepening, MTD(f) around the score of the previous one.
+static int search_iteration(Board* board, bool* stop, HashMap* hashmap, int depth, int score, Move* selected) {
+    int upper = INT_MAX;
+    int lower = INT_MIN;
+
+    while (lower < upper && !*stop) {
+        int beta = MAX(score, lower + 1);
+        score = search_moves(board, stop, hashmap, depth, beta - 1, beta, selected);
+        if (score < beta) {
+            upper = score;
+        } else {
+            lower = score;
+        }
+    }
+    return score;
+}
+
+// Helpers search the same position and share their results with the main thread through the hash
+// map. Half of them start one iteration deeper, so the threads do not all search the same depth.
+static int helper_search(void* arg) {
+    Helper* helper = arg;
+    reset_search_stats();
+    node_limit = 0;
 
+    Move selected = NULL_MOVE;
     int score = 0;
-    int depth = 1;
-    while (!stop) {
-        // MTDF
-        int upper = INT_MAX;
-        int lower = INT_MIN;
-
-        while (lower < upper && !stop) {
-            int beta = MAX(score, lower + 1);
-            score = search_moves(board, &stop, hashmap, depth, beta - 1, beta, &selected);
-            if (score < beta) {
-                upper = score;
-            } else {
-                lower = score;
-            }
+    uint64_t reported = 0;
+    for (int depth = helper->depth; !*helper->stop && depth <= MAX_SEARCH_DEPTH; depth++) {
+        score = search_iteration(&helper->board, helper->stop, helper->hashmap, depth, score, &selected);
+        atomic_fetch_add(helper->nodes, search_stats.nodes - reported);
+        reported = search_stats.nodes;
+    }
+    return 0;
+}
+
+static uint64_t milliseconds_since(const struct timespec* start) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (now.tv_sec - start->tv_sec) * 1000 + (now.tv_nsec - start->tv_nsec) / 1000000;
+}
+
+bool search_position(Board* board, HashMap* hashmap, const SearchLimits* limits, bool* stop,
+                     SearchCallback callback, void* data, Move* move) {
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+
+    call_once(&eval_cache_flag, alloc_eval_cache);
+    init_endgames();
+    reset_search_stats();
+    node_limit = limits->nodes;
+
+    // Kept per search, other threads may be running searches of their own.
+    _Atomic uint64_t helper_nodes = 0;
+    bool helpers_stop = false;
+    int n_helpers = MIN(MAX(limits->threads, 1), MAX_THREADS) - 1;
+    Helper helpers[MAX_THREADS];
+    thrd_t threads[MAX_THREADS];
+    for (int i = 0; i < n_helpers; i++) {
+        helpers[i] = (Helper) {*board, hashmap, &helpers_stop, 1 + (i & 1), &helper_nodes};
+        thrd_create(&threads[i], helper_search, &helpers[i]);
+    }
+
+    Move moves[MAX_MOVES];
+    int n_moves = gen_moves(board, moves);
+
+    Move selected = NULL_MOVE;
+    int score = 0;
+    int max_depth = limits->depth > 0 ? MIN(limits->depth, MAX_SEARCH_DEPTH) : MAX_SEARCH_DEPTH;
+    for (int depth = 1; !*stop && depth <= max_depth && n_moves > 0; depth++) {
+        // An iteration cut short by stop returns 0 for the moves it did not finish, so its best move
+        // is only taken once it completed.
+        Move iteration_move = selected;
+        score = search_iteration(board, stop, hashmap, depth, score, &iteration_move);
+        if (*stop) break;
+        selected = iteration_move;
+        search_stats.depth = depth;
+
+        if (callback != NULL) {
+            SearchReport report;
+            report.depth = depth;
+            report.score = score;
+            report.nodes = search_stats.nodes + atomic_load(&helper_nodes);
+            report.milliseconds = milliseconds_since(&start);
+            report.pv_length = get_pv(board, hashmap, selected, report.pv, MAX_PV);
+            callback(&report, data);
         }
-        depth++;
     }
 
+    helpers_stop = true;
+    for (int i = 0; i < n_helpers; i++) thrd_join(threads[i], NULL);
+
+    // A search stopped before it finished its first iteration still plays a legal move.
+    if (selected == NULL_MOVE && n_moves > 0) selected = moves[0];
     *move = selected;
+    get_pawn_stats(&search_stats.pawns);
+    return n_moves > 0;
+}
 
-    Move moves[MAX_MOVES];
-	return gen_moves(board, moves) > 0;
+int get_pv(Board* board, HashMap* hashmap, Move first, Move* pv, int max_length) {
+    if (first == NULL_MOVE || max_length == 0) return 0;
+    Board copy = *board;
+    int length = 0;
+    Move move = first;
+    while (true) {
+        pv[length++] = move;
+        make_move(&copy, &move);
+        if (length == max_length) break;
+
+        // The hash move is only followed if it is legal, the entry may belong to another position.
+        int score, eval;
+        hashmap_get(hashmap, position_key(&copy), INT8_MAX, &score, &move, &eval);
+        Move moves[MAX_MOVES];
+        int n_moves = gen_moves(&copy, moves);
+        bool legal = false;
+        for (int i = 0; i < n_moves && !legal; i++) legal = moves[i] == move;
+        if (!legal) break;
+    }
+    return length;
+}
+
+void get_search_stats(SearchStats* stats) {
+    *stats = search_stats;
 }
 
 int search_moves(Board* board, bool* stop, HashMap* hashmap, int depth, int alpha, int beta, Move* selected) {
+    AttackInfo info;
+    gen_attack_info(board, &info);
+
     Move moves[MAX_MOVES];
-    int n_moves = gen_moves(board, moves);
+    int n_moves = gen_moves_info(board, &info, moves);
 
-    order_moves(board, moves, n_moves);
+    // The best move of the previous iteration is searched first.
+    order_moves(board, &info, moves, n_moves, *selected);
 
-    Move best = {0, 0, 0};
+    Move best = NULL_MOVE;
 
     const Board copy = *board;
     for (int i = 0; i < n_moves && !*stop; i++) {
@@ -85,7 +242,7 @@ int search_moves(Board* board, bool* stop, HashMap* hashmap, int depth, int alph
         }
     }
 
-    if (best.to != best.from) {
+    if (best != NULL_MOVE) {
         *selected = best;
     }
 
@@ -95,6 +252,8 @@ int search_moves(Board* board, bool* stop, HashMap* hashmap, int depth, int alph
 int alpha_beta(Board* board, bool* stop, HashMap* hashmap, int depth, int ply, int alpha, int beta) {
     if (*stop) return 0;
     if (!is_legal(board)) return INF;
+    search_stats.nodes++;
+    if (node_limit != 0 && search_stats.nodes >= node_limit) *stop = true;
 
     if (ply > 0) {
         alpha = MAX(alpha, -CHECKMATE + ply);
@@ -102,9 +261,19 @@ int alpha_beta(Board* board, bool* stop, HashMap* hashmap, int depth, int ply, i
         if (alpha >= beta) return alpha;
     }
 
-    uint64_t board_hash = hash(board);
-    int score, flag;
-    if (flag = hashmap_get(hashmap, board_hash, depth, &score)) {
+    int score, flag, eval;
+    if (tb_probe_score(board, ply, &score)) {
+        search_stats.tablebase_hits++;
+        return score;
+    }
+    if (probe_endgame(board, &score)) {
+        search_stats.endgame_hits++;
+        return score;
+    }
+
+    uint64_t board_hash = position_key(board);
+    Move hash_move;
+    if ((flag = hashmap_get(hashmap, board_hash, depth, &score, &hash_move, &eval)) != 0) {
         if (flag == BOUND_EXACT || (flag == BOUND_UPPER && score <= alpha) || (flag == BOUND_LOWER && score >= beta)) {
             return score;
         }
@@ -112,65 +281,115 @@ int alpha_beta(Board* board, bool* stop, HashMap* hashmap, int depth, int ply, i
 
     if (depth <= 0) {
         // Once depth of 0 is reached, search all remaining captures to reach a stable board state.
-        int eval = quiescence(board, alpha, beta);
-        hashmap_set(hashmap, board_hash, eval, depth, BOUND_EXACT);
-        return eval;
+        int score = quiescence(board, alpha, beta);
+        hashmap_set(hashmap, board_hash, score, depth, BOUND_EXACT, NULL_MOVE, eval);
+        return score;
     }
 
-    // Null Move Pruning.
-    switch_ply(board);
-    uint8_t en_passant = board->en_passant;
-    board->en_passant = 0;
-    int eval = -alpha_beta(board, stop, hashmap, depth - 2, ply + 2, -beta, -beta + 1);
-    board->en_passant = en_passant;
-    switch_ply(board);
+    // Attack sets are computed once and used for the evaluation, move generation, check detection
+    // and ordering of this node.
+    AttackInfo info;
+    gen_attack_info(board, &info);
+    if (eval == EVAL_NONE) eval = static_eval(board, &info, board_hash);
 
+    // Null Move Pruning. Only tried when the static evaluation suggests passing could hold beta.
     if (eval >= beta) {
-        hashmap_set(hashmap, board_hash, beta, depth, BOUND_LOWER);
-        return beta;
+        switch_ply(board);
+        uint8_t en_passant = board->en_passant;
+        board->en_passant = 0;
+        int score = -alpha_beta(board, stop, hashmap, depth - 2, ply + 2, -beta, -beta + 1);
+        board->en_passant = en_passant;
+        switch_ply(board);
+
+        if (score >= beta) {
+            hashmap_set(hashmap, board_hash, beta, depth, BOUND_LOWER, hash_move, eval);
+            return beta;
+        }
     }
 
     Move moves[MAX_MOVES];
-    int n_moves = gen_moves(board, moves);
+    int n_moves = gen_moves_info(board, &info, moves);
     if (n_moves == 0) {
-        if (is_in_check(board)) {
+        if (info.checkers != 0) {
             return -CHECKMATE + ply;
         }
         return 0;
     }
 
-    order_moves(board, moves, n_moves);
+    order_moves(board, &info, moves, n_moves, hash_move);
     const Board copy = *board;
 
+    Move best = hash_move;
+
     for (int i = 0; i < n_moves && !*stop; i++) {
         Move* move = &moves[i];
         make_move(board, move);
-        int eval = -alpha_beta(board, stop, hashmap, depth - 1, ply + 1, -beta, -alpha);
+        int score = -alpha_beta(board, stop, hashmap, depth - 1, ply + 1, -beta, -alpha);
         *board = copy; // Undo move.
 
-        if (eval >= beta) {
-            hashmap_set(hashmap, board_hash, beta, depth, BOUND_LOWER);
+        if (score >= beta) {
+            hashmap_set(hashmap, board_hash, beta, depth, BOUND_LOWER, *move, eval);
             return beta;
         }
-        if (eval > alpha) {
-            alpha = eval;
+        if (score > alpha) {
+            alpha = score;
+            best = *move;
         }
     }
 
-    hashmap_set(hashmap, board_hash, alpha, depth, BOUND_UPPER);
+    hashmap_set(hashmap, board_hash, alpha, depth, BOUND_UPPER, best, eval);
 
     return alpha;
 }
 
+// Returns a bound on the evaluation from its cheap terms if that is already outside the window, or
+// EVAL_NONE if the full evaluation is needed.
+static int lazy_bound(Board* board, int alpha, int beta) {
+    // The margins are for the unscaled evaluation.
+    if (nnue_enabled || endgame_scale(board) != SCALE_NORMAL) return EVAL_NONE;
+
+    search_stats.lazy_probes++;
+    int lazy = evaluate_lazy(board);
+    int margin = lazy_margin(board);
+    if (lazy - margin >= beta) {
+        search_stats.lazy_exits++;
+        return lazy - margin;
+    }
+    if (lazy + margin <= alpha) {
+        search_stats.lazy_exits++;
+        return lazy + margin;
+    }
+    return EVAL_NONE;
+}
+
 int quiescence(Board* board, int alpha, int beta) {
-    int eval = evaluate(board);
+    search_stats.nodes++;
+
+    int score;
+    if (probe_endgame(board, &score)) {
+        search_stats.endgame_hits++;
+        return score >= beta ? beta : score <= alpha ? alpha : score;
+    }
+
+    // A lazy bound at or above beta ends the node. One at or below alpha does not raise alpha, so the
+    // captures are searched without ever computing the full evaluation.
+    AttackInfo info;
+    bool has_info = false;
+    int eval = lazy_bound(board, alpha, beta);
+    if (eval == EVAL_NONE) {
+        gen_attack_info(board, &info);
+        has_info = true;
+        eval = static_eval(board, &info, position_key(board));
+    }
 
     if (eval >= beta) return beta;
     if (eval > alpha) alpha = eval;
 
+    if (!has_info) gen_attack_info(board, &info);
+
     Move moves[MAX_MOVES];
-    int n_moves = gen_captures(board, moves);
-    order_moves(board, moves, n_moves);
+    int n_moves = gen_captures_info(board, &info, moves);
+    order_moves(board, &info, moves, n_moves, NULL_MOVE);
 
     const Board copy = *board;
 
@@ -186,27 +405,44 @@ int quiescence(Board* board, int alpha, int beta) {
     return alpha;
 }
 
-void order_moves(Board* board, Move* moves, int size) {
-    int scores[MAX_MOVES];
-    Move best;
+// Both evaluators share the cache, under different keys, so it does not need clearing when switching.
+#define NNUE_EVAL_KEY 0x9e3779b97f4a7c15ULL
+
+int static_eval(Board* board, const AttackInfo* info, uint64_t key) {
+    int eval;
+    if (nnue_enabled) key ^= NNUE_EVAL_KEY;
+    search_stats.eval_probes++;
+    if (evalcache_get(eval_cache, key, &eval)) {
+        search_stats.eval_hits++;
+        return eval;
+    }
+    eval = evaluate(board, info);
+    evalcache_set(eval_cache, key, eval);
+    return eval;
+}
+
+// Moves are 16 bits, so each move is packed with its score into a single int sort key
+// and sorted in place without moving separate score and move arrays.
+void order_moves(Board* board, const AttackInfo* info, Move* moves, int size, Move hash_move) {
+    int keys[MAX_MOVES];
 
     for (int i = 0; i < size; i++) {
-        scores[i] = -score_move(board, &moves[i]);
+        int score = moves[i] == hash_move ? HASH_MOVE_SCORE : score_move(board, info, &moves[i]);
+        keys[i] = score * 65536 + moves[i];
     }
 
-    // Sort moves based on their scores.
+    // Sort moves based on their scores, highest first.
     for (int i = 1; i < size; i++) {
+        int key = keys[i];
         int j = i;
-        while (j > 0 && scores[j - 1] > scores[j]) {
-            int temp = scores[j];
-            scores[j] = scores[j - 1];
-            scores[j - 1] = temp;
-
-            Move temp_move = moves[j];
-            moves[j] = moves[j - 1];
-            moves[j - 1] = temp_move;
-            
+        while (j > 0 && keys[j - 1] < key) {
+            keys[j] = keys[j - 1];
             j--;
         }
+        keys[j] = key;
+    }
+
+    for (int i = 0; i < size; i++) {
+        moves[i] = (Move) (keys[i] & 0xffff);
     }
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "board.h"
 #include "move.h"
 #include "hashmap.h"
+#include "pawns.h"
 #include "tinycthread.h"
 
 #define MIN(a, b) (((a) < (b)) ? (a) : (b))
@@ -13,17 +14,67 @@
 
 #define SEARCH_TIMEOUT 1
 
+// Deepest iteration of any search, depths are stored in 8 bits in the hashmap.
+#define MAX_SEARCH_DEPTH 100
+#define MAX_THREADS 64
+#define MAX_PV 64
+
 #define INF (1 << 25)
 
+// Ordering score of the move stored in the hashmap. Larger than any score from score_move.
+#define HASH_MOVE_SCORE 30000
+
+typedef struct {
+    int depth; // Deepest completed iteration.
+    uint64_t nodes;
+    uint64_t eval_probes;
+    uint64_t eval_hits;
+    uint64_t lazy_probes; // Quiescence nodes which tried the lazy evaluation.
+    uint64_t lazy_exits; // Of those, the ones where it was already outside the window.
+    uint64_t endgame_hits; // Nodes whose result came from probe_endgame.
+    uint64_t tablebase_hits; // Nodes whose result came from the tablebases.
+    PawnStats pawns;
+} SearchStats;
+
+// Limits of search_position, 0 for no limit.
+typedef struct {
+    int depth;
+    uint64_t nodes; // Counted by the main thread only.
+    int threads; // Threads searching the position, all sharing the hashmap.
+} SearchLimits;
+
+// Result of an iteration of search_position.
+typedef struct {
+    int depth;
+    int score; // From the point of view of the side to move, see CHECKMATE for mate scores.
+    uint64_t nodes; // Of all threads.
+    uint64_t milliseconds; // Since the start of the search.
+    int pv_length;
+    Move pv[MAX_PV];
+} SearchReport;
+
+typedef void (*SearchCallback)(const SearchReport* report, void* data);
+
 int timer(void* arg);
 void start_timer(bool* stop);
 
+// Clears the hashmap before the search, unless it was opened with hashmap_open or hashmap_attach.
 bool select_move(Board* board, HashMap* hashmap, Move* move);
+// Searches by iterative deepening until stop is set by another thread or a limit is reached, and
+// calls callback, if not NULL, after every completed iteration. Returns false if there are no legal
+// moves. Unlike select_move, it neither probes the books and tablebases at the root nor clears the
+// hashmap.
+bool search_position(Board* board, HashMap* hashmap, const SearchLimits* limits, bool* stop,
+                     SearchCallback callback, void* data, Move* move);
+// Principal variation starting with first, followed through the hash moves. Returns its length.
+int get_pv(Board* board, HashMap* hashmap, Move first, Move* pv, int max_length);
+void get_search_stats(SearchStats* stats);
 
 int search_moves(Board* board, bool* stop, HashMap* hashmap, int depth, int alpha, int beta, Move* selected);
 int alpha_beta(Board* board, bool* stop, HashMap* hashmap, int depth, int ply, int alpha, int beta);
 int quiescence(Board* board, int alpha, int beta);
+int static_eval(Board* board, const AttackInfo* info, uint64_t key);
 
-void order_moves(Board* board, Move* moves, int size);
+void order_moves(Board* board, const AttackInfo* info, Move* moves, int size, Move hash_move);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,748 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "engine.h"
+#include "tinycthread.h"
+
+// Analysis server for other local programs, on a Unix domain socket or on a TCP port of 127.0.0.1,
+// built on the engine library.
+//
+// Clients send one JSON request per line, or an array of requests on one line, and get one JSON
+// object per line back for each, in the order they finish. Requests carry their own id, which is
+// copied into the reply:
+//     {"id": "1", "fen": "<fen>", "moves": "e2e4 e7e5", "depth": 12, "nodes": 1000000,
+//      "movetime": 500, "priority": "interactive"}
+//     {"id": "1", "bestmove": "g1f3", "ponder": "b8c6", "cp": 31, "depth": 12, "nodes": 812345,
+//      "time": 412, "wait": 3, "pv": ["g1f3", "b8c6"]}
+// The position is the starting position if fen is missing, and mate scores are sent as "mate"
+// instead of "cp". Every search ends after -maxtime milliseconds, whatever its limits.
+//     {"op": "cancel", "id": "1"} drops the request if it is queued and stops it if it is searched,
+//         it is answered with {"id": "1", "cancelled": true}
+//     {"op": "stats"} answers with the queue depths and the latency percentiles of recent requests
+//
+// Requests wait in one of two lanes, interactive (the default) and bulk. Workers, each with an engine
+// of its own, always take interactive requests first. A lane holds at most -queue requests, further
+// ones are rejected with an error right away rather than waiting, so the server never falls behind
+// by more than that. Each connection is read on its own thread.
+//
+// With -cache, requests are answered from a cache of earlier results where one is deep enough, so
+// popular positions are only searched once. With -snapshot the cache is loaded at the start and
+// saved when the server is stopped with SIGINT or SIGTERM. With -hashfile, the workers share a hash
+// table kept in a memory mapped file, so a restarted server starts with the table it had. With
+// -hashshm, they share one in a shared memory segment with other servers attached to it, so servers
+// run as separate processes for isolation still share their results.
+// Usage: chess-server [-socket path | -port n] [-workers n] [-threads n] [-hash MB] [-shared]
+//                     [-queue n] [-depth n] [-nodes n] [-movetime ms] [-maxtime ms]
+//                     [-tablebases dir] [-nnue file] [-cache MB] [-snapshot file] [-hashfile file]
+//                     [-hashshm name]
+
+#define DEFAULT_PORT 7411
+#define DEFAULT_QUEUE 64
+#define DEFAULT_HASH 64 // MB
+#define DEFAULT_MOVETIME 1000 // Milliseconds, for requests without limits.
+#define DEFAULT_MAXTIME 60000
+#define MAX_LINE 65536
+#define MAX_ID 64
+#define MAX_FIELDS 16
+#define MAX_VALUE 1024
+// Latencies kept per lane for the percentiles.
+#define LATENCY_WINDOW 4096
+
+#define LANE_INTERACTIVE 0
+#define LANE_BULK 1
+#define N_LANES 2
+
+static const char* const LANE_NAMES[N_LANES] = {"interactive", "bulk"};
+
+typedef struct {
+    int socket;
+    int references; // The reading thread and every request not answered yet.
+    mtx_t write_lock;
+} Connection;
+
+typedef struct Request {
+    Connection* connection;
+    char id[MAX_ID];
+    char fen[ENGINE_FEN_LENGTH];
+    char moves[MAX_VALUE];
+    bool start; // No FEN given.
+    EngineLimits limits;
+    int lane;
+    uint64_t received; // Microseconds.
+    uint64_t started;
+    bool cancelled;
+    struct Request* next;
+} Request;
+
+typedef struct {
+    Request* head;
+    Request* tail;
+    int count;
+    uint64_t latencies[LATENCY_WINDOW]; // Microseconds.
+    uint64_t n_latencies;
+} Lane;
+
+typedef struct {
+    Engine* engine;
+    Request* request; // Being searched, NULL if none.
+    thrd_t thread;
+} Worker;
+
+typedef struct {
+    int workers;
+    int threads;
+    int hash;
+    bool shared;
+    int queue;
+    EngineLimits limits;
+    uint64_t maxtime;
+} Options;
+
+static Options options = {1, 1, DEFAULT_HASH, false, DEFAULT_QUEUE, {0, 0, 0}, DEFAULT_MAXTIME};
+
+static EngineCache* cache = NULL;
+static volatile sig_atomic_t stopping = 0;
+
+static Lane lanes[N_LANES];
+static Worker* workers;
+static uint64_t completed = 0;
+static uint64_t cancelled = 0;
+static uint64_t rejected = 0;
+static mtx_t queue_lock;
+static cnd_t queue_filled;
+
+static mtx_t connection_lock;
+
+typedef struct {
+    char key[32];
+    char value[MAX_VALUE];
+} Field;
+
+uint64_t now() {
+    struct timespec time;
+    timespec_get(&time, TIME_UTC);
+    return (uint64_t) time.tv_sec * 1000000 + time.tv_nsec / 1000;
+}
+
+void release(Connection* connection) {
+    mtx_lock(&connection_lock);
+    bool last = --connection->references == 0;
+    mtx_unlock(&connection_lock);
+    if (!last) return;
+    close(connection->socket);
+    mtx_destroy(&connection->write_lock);
+    free(connection);
+}
+
+// Writes a whole line, replies of the workers and the reading thread do not interleave.
+void reply(Connection* connection, const char* line) {
+    size_t length = strlen(line);
+    mtx_lock(&connection->write_lock);
+    size_t sent = 0;
+    while (sent < length) {
+        ssize_t n = send(connection->socket, line + sent, length - sent, MSG_NOSIGNAL);
+        if (n <= 0) break; // The client is gone, its requests are cancelled by its reading thread.
+        sent += n;
+    }
+    mtx_unlock(&connection->write_lock);
+}
+
+// Writes the string as a JSON string, returns the number of characters written.
+int write_string(char* out, const char* text) {
+    int length = 0;
+    out[length++] = '"';
+    for (const char* c = text; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') out[length++] = '\\';
+        if ((unsigned char) *c < 0x20) continue;
+        out[length++] = *c;
+    }
+    out[length++] = '"';
+    out[length] = '\0';
+    return length;
+}
+
+void reply_error(Connection* connection, const char* id, const char* error) {
+    char line[MAX_ID * 2 + 128];
+    int length = sprintf(line, "{\"id\": ");
+    length += write_string(line + length, id);
+    sprintf(line + length, ", \"error\": \"%s\"}\n", error);
+    reply(connection, line);
+}
+
+void reply_cancelled(Connection* connection, const char* id) {
+    char line[MAX_ID * 2 + 64];
+    int length = sprintf(line, "{\"id\": ");
+    length += write_string(line + length, id);
+    sprintf(line + length, ", \"cancelled\": true}\n");
+    reply(connection, line);
+}
+
+// Parses one flat JSON object of strings, numbers and literals at *text and moves past it. Returns
+// the number of fields, -1 if it is not such an object. Literals and numbers are kept as written.
+int parse_object(const char** text, Field* fields) {
+    const char* c = *text + strspn(*text, " \t");
+    if (*c++ != '{') return -1;
+    int n = 0;
+    while (true) {
+        c += strspn(c, " \t");
+        if (*c == '}' && n == 0) break;
+        if (*c++ != '"' || n == MAX_FIELDS) return -1;
+        int length = 0;
+        while (*c != '"' && *c != '\0' && length < (int) sizeof(fields[n].key) - 1) fields[n].key[length++] = *c++;
+        fields[n].key[length] = '\0';
+        if (*c++ != '"') return -1;
+        c += strspn(c, " \t");
+        if (*c++ != ':') return -1;
+        c += strspn(c, " \t");
+
+        length = 0;
+        if (*c == '"') {
+            c++;
+            while (*c != '"' && *c != '\0' && length < MAX_VALUE - 1) {
+                if (*c == '\\' && c[1] != '\0') c++;
+                fields[n].value[length++] = *c++;
+            }
+            if (*c++ != '"') return -1;
+        } else {
+            while (strchr(",} \t", *c) == NULL && length < MAX_VALUE - 1) fields[n].value[length++] = *c++;
+            if (length == 0) return -1;
+        }
+        fields[n++].value[length] = '\0';
+
+        c += strspn(c, " \t");
+        if (*c == '}') break;
+        if (*c++ != ',') return -1;
+    }
+    *text = c + 1;
+    return n;
+}
+
+const char* get_field(Field* fields, int n, const char* key) {
+    for (int i = 0; i < n; i++) {
+        if (strcmp(fields[i].key, key) == 0) return fields[i].value;
+    }
+    return NULL;
+}
+
+void push_request(Lane* lane, Request* request) {
+    request->next = NULL;
+    if (lane->tail != NULL) lane->tail->next = request;
+    else lane->head = request;
+    lane->tail = request;
+    lane->count++;
+}
+
+Request* pop_request(Lane* lane) {
+    Request* request = lane->head;
+    lane->head = request->next;
+    if (lane->head == NULL) lane->tail = NULL;
+    lane->count--;
+    return request;
+}
+
+// Cancels the request of the connection with the id, or all of its requests if id is NULL. Queued
+// requests are dropped, searches are stopped and answered by their worker. Returns the number of
+// requests found, and the number dropped from the queue in dropped if it is not NULL, which the
+// caller answers after releasing queue_lock so a slow client does not hold up the other threads.
+// The caller holds queue_lock.
+int cancel_requests(Connection* connection, const char* id, int* dropped) {
+    int found = 0;
+    if (dropped != NULL) *dropped = 0;
+    for (int i = 0; i < N_LANES; i++) {
+        Request* previous = NULL;
+        Request* request = lanes[i].head;
+        while (request != NULL) {
+            Request* next = request->next;
+            if (request->connection == connection && (id == NULL || strcmp(request->id, id) == 0)) {
+                if (previous != NULL) previous->next = next;
+                else lanes[i].head = next;
+                if (lanes[i].tail == request) lanes[i].tail = previous;
+                lanes[i].count--;
+                if (dropped != NULL) (*dropped)++;
+                cancelled++;
+                found++;
+                release(connection);
+                free(request);
+            } else {
+                previous = request;
+            }
+            request = next;
+        }
+    }
+    for (int i = 0; i < options.workers; i++) {
+        Request* request = workers[i].request;
+        if (request != NULL && request->connection == connection && (id == NULL || strcmp(request->id, id) == 0)) {
+            request->cancelled = true;
+            engine_stop(workers[i].engine);
+            found++;
+        }
+    }
+    return found;
+}
+
+void percentiles(Lane* lane, char* out) {
+    int n = lane->n_latencies < LATENCY_WINDOW ? lane->n_latencies : LATENCY_WINDOW;
+    uint64_t sorted[LATENCY_WINDOW];
+    memcpy(sorted, lane->latencies, n * sizeof(uint64_t));
+    // Insertion sort is fast enough for a stats request, the window is small.
+    for (int i = 1; i < n; i++) {
+        uint64_t value = sorted[i];
+        int j = i;
+        for (; j > 0 && sorted[j - 1] > value; j--) sorted[j] = sorted[j - 1];
+        sorted[j] = value;
+    }
+    const int PERCENTS[3] = {50, 90, 99};
+    double values[4] = {0, 0, 0, 0};
+    for (int i = 0; i < 3 && n > 0; i++) values[i] = sorted[(n - 1) * PERCENTS[i] / 100] / 1000.0;
+    if (n > 0) values[3] = sorted[n - 1] / 1000.0;
+    sprintf(out, "{\"count\": %d, \"p50\": %.1f, \"p90\": %.1f, \"p99\": %.1f, \"max\": %.1f}", n, values[0], values[1],
+            values[2], values[3]);
+}
+
+void reply_stats(Connection* connection, const char* id) {
+    char line[2048];
+    mtx_lock(&queue_lock);
+    int running = 0;
+    for (int i = 0; i < options.workers; i++) running += workers[i].request != NULL;
+    int length = sprintf(line, "{\"id\": ");
+    length += write_string(line + length, id);
+    length += sprintf(line + length, ", \"queued\": {\"interactive\": %d, \"bulk\": %d}, \"running\": %d, \"workers\": %d, "
+                      "\"completed\": %llu, \"cancelled\": %llu, \"rejected\": %llu, \"latency_ms\": {",
+                      lanes[LANE_INTERACTIVE].count, lanes[LANE_BULK].count, running, options.workers,
+                      (unsigned long long) completed, (unsigned long long) cancelled, (unsigned long long) rejected);
+    for (int i = 0; i < N_LANES; i++) {
+        length += sprintf(line + length, "%s\"%s\": ", i > 0 ? ", " : "", LANE_NAMES[i]);
+        percentiles(&lanes[i], line + length);
+        length += strlen(line + length);
+    }
+    mtx_unlock(&queue_lock);
+    length += sprintf(line + length, "}");
+    if (cache != NULL) {
+        EngineCacheStats stats;
+        engine_cache_stats(cache, &stats);
+        uint64_t lookups = stats.hits + stats.misses;
+        length += sprintf(line + length, ", \"cache\": {\"hits\": %llu, \"misses\": %llu, \"hit_ratio\": %.3f, "
+                          "\"entries\": %llu, \"capacity\": %llu, \"evictions\": %llu, \"bytes\": %llu}",
+                          (unsigned long long) stats.hits, (unsigned long long) stats.misses,
+                          lookups > 0 ? (double) stats.hits / lookups : 0.0, (unsigned long long) stats.entries,
+                          (unsigned long long) stats.capacity, (unsigned long long) stats.evictions,
+                          (unsigned long long) stats.bytes);
+    }
+    sprintf(line + length, "}\n");
+    reply(connection, line);
+}
+
+// Handles one request object of a line.
+void handle_request(Connection* connection, Field* fields, int n, uint64_t received) {
+    const char* id = get_field(fields, n, "id");
+    if (id == NULL) id = "";
+    if (strlen(id) >= MAX_ID) {
+        reply_error(connection, "", "id too long");
+        return;
+    }
+
+    const char* op = get_field(fields, n, "op");
+    if (op != NULL && strcmp(op, "stats") == 0) {
+        reply_stats(connection, id);
+        return;
+    } else if (op != NULL && strcmp(op, "cancel") == 0) {
+        int dropped;
+        mtx_lock(&queue_lock);
+        int found = cancel_requests(connection, id, &dropped);
+        mtx_unlock(&queue_lock);
+        for (int i = 0; i < dropped; i++) reply_cancelled(connection, id);
+        if (found == 0) reply_error(connection, id, "unknown id");
+        return;
+    } else if (op != NULL && strcmp(op, "analyze") != 0) {
+        reply_error(connection, id, "unknown op");
+        return;
+    }
+
+    const char* fen = get_field(fields, n, "fen");
+    const char* moves = get_field(fields, n, "moves");
+    if (fen != NULL && strlen(fen) >= ENGINE_FEN_LENGTH) {
+        reply_error(connection, id, "invalid fen");
+        return;
+    }
+
+    Request* request = malloc(sizeof(Request));
+    strcpy(request->id, id);
+    request->start = fen == NULL;
+    strcpy(request->fen, fen != NULL ? fen : "");
+    strcpy(request->moves, moves != NULL ? moves : "");
+
+    const char* depth = get_field(fields, n, "depth");
+    const char* nodes = get_field(fields, n, "nodes");
+    const char* movetime = get_field(fields, n, "movetime");
+    request->limits = options.limits;
+    if (depth != NULL || nodes != NULL || movetime != NULL) request->limits = (EngineLimits) {0, 0, 0};
+    if (depth != NULL) request->limits.depth = atoi(depth);
+    if (nodes != NULL) request->limits.nodes = strtoull(nodes, NULL, 10);
+    if (movetime != NULL) request->limits.milliseconds = strtoull(movetime, NULL, 10);
+    if (request->limits.milliseconds == 0 || request->limits.milliseconds > options.maxtime) {
+        request->limits.milliseconds = options.maxtime;
+    }
+
+    const char* priority = get_field(fields, n, "priority");
+    request->lane = priority != NULL && strcmp(priority, "bulk") == 0 ? LANE_BULK : LANE_INTERACTIVE;
+    request->connection = connection;
+    request->received = received;
+    request->cancelled = false;
+
+    mtx_lock(&queue_lock);
+    if (lanes[request->lane].count >= options.queue) {
+        rejected++;
+        mtx_unlock(&queue_lock);
+        reply_error(connection, id, "queue full");
+        free(request);
+        return;
+    }
+    mtx_lock(&connection_lock);
+    connection->references++;
+    mtx_unlock(&connection_lock);
+    push_request(&lanes[request->lane], request);
+    cnd_signal(&queue_filled);
+    mtx_unlock(&queue_lock);
+}
+
+// A line holds one request object or an array of them.
+void handle_line(Connection* connection, const char* line) {
+    uint64_t received = now();
+    const char* c = line + strspn(line, " \t");
+    bool array = *c == '[';
+    if (array) c++;
+    do {
+        Field fields[MAX_FIELDS];
+        int n = parse_object(&c, fields);
+        if (n < 0) {
+            reply_error(connection, "", "invalid request");
+            return;
+        }
+        handle_request(connection, fields, n, received);
+        c += strspn(c, " \t");
+    } while (array && *c++ == ',');
+}
+
+// Requests are cancelled by the reading threads while a worker searches them.
+bool is_cancelled(Request* request) {
+    mtx_lock(&queue_lock);
+    bool result = request->cancelled;
+    mtx_unlock(&queue_lock);
+    return result;
+}
+
+// Stops the search after its current iteration if the request was cancelled before the search
+// started, when engine_stop would have had no effect.
+void check_cancelled(const EngineInfo* info, void* data) {
+    Worker* worker = data;
+    if (is_cancelled(worker->request)) engine_stop(worker->engine);
+}
+
+// Searches the request and writes the answer into line.
+void analyze(Worker* worker, Request* request, char* line) {
+    int length = sprintf(line, "{\"id\": ");
+    length += write_string(line + length, request->id);
+
+    int result = engine_set_position(worker->engine, request->start ? NULL : request->fen, request->moves);
+    if (result == ENGINE_INVALID_FEN || result == ENGINE_ILLEGAL_MOVE) {
+        sprintf(line + length, ", \"error\": \"%s\"}\n", result == ENGINE_INVALID_FEN ? "invalid fen" : "illegal move");
+        return;
+    }
+
+    char best[ENGINE_MOVE_LENGTH], ponder[ENGINE_MOVE_LENGTH];
+    EngineInfo info;
+    result = engine_search(worker->engine, &request->limits, check_cancelled, worker, best, ponder, &info);
+    if (is_cancelled(request)) {
+        sprintf(line + length, ", \"cancelled\": true}\n");
+        return;
+    }
+    if (result == ENGINE_NO_MOVES) {
+        sprintf(line + length, ", \"bestmove\": null}\n");
+        return;
+    }
+
+    length += sprintf(line + length, ", \"bestmove\": \"%s\"", best);
+    if (ponder[0] != '\0') length += sprintf(line + length, ", \"ponder\": \"%s\"", ponder);
+    if (info.mate != 0) length += sprintf(line + length, ", \"mate\": %d", info.mate);
+    else length += sprintf(line + length, ", \"cp\": %d", info.score);
+    length += sprintf(line + length, ", \"depth\": %d, \"nodes\": %llu, \"time\": %llu, \"wait\": %llu, \"pv\": [",
+                      info.depth, (unsigned long long) info.nodes, (unsigned long long) info.milliseconds,
+                      (unsigned long long) (request->started - request->received) / 1000);
+    for (int i = 0; i < info.pv_length; i++) {
+        length += sprintf(line + length, "%s\"%s\"", i > 0 ? ", " : "", info.pv[i]);
+    }
+    sprintf(line + length, "]}\n");
+}
+
+int work(void* arg) {
+    Worker* worker = arg;
+    char* line = malloc(MAX_ID * 2 + 256 + ENGINE_MAX_PV * (ENGINE_MOVE_LENGTH + 4));
+    while (true) {
+        mtx_lock(&queue_lock);
+        while (lanes[LANE_INTERACTIVE].count == 0 && lanes[LANE_BULK].count == 0 && !stopping) {
+            cnd_wait(&queue_filled, &queue_lock);
+        }
+        // Requests still queued when the server stops are dropped.
+        if (stopping) {
+            mtx_unlock(&queue_lock);
+            break;
+        }
+        Request* request = pop_request(&lanes[lanes[LANE_INTERACTIVE].count > 0 ? LANE_INTERACTIVE : LANE_BULK]);
+        worker->request = request;
+        request->started = now();
+        mtx_unlock(&queue_lock);
+
+        analyze(worker, request, line);
+
+        // Counted before the answer, so a stats request sent after it sees the request as done.
+        mtx_lock(&queue_lock);
+        worker->request = NULL;
+        Lane* lane = &lanes[request->lane];
+        lane->latencies[lane->n_latencies++ % LATENCY_WINDOW] = now() - request->received;
+        if (request->cancelled) cancelled++;
+        else completed++;
+        mtx_unlock(&queue_lock);
+
+        reply(request->connection, line);
+        release(request->connection);
+        free(request);
+    }
+    free(line);
+    return 0;
+}
+
+int read_connection(void* arg) {
+    Connection* connection = arg;
+    char* buffer = malloc(MAX_LINE + 1);
+    size_t length = 0;
+    while (true) {
+        ssize_t n = recv(connection->socket, buffer + length, MAX_LINE - length, 0);
+        if (n <= 0) break;
+        length += n;
+
+        size_t start = 0;
+        for (size_t i = start; i < length; i++) {
+            if (buffer[i] != '\n') continue;
+            buffer[i] = '\0';
+            if (i > start && buffer[i - 1] == '\r') buffer[i - 1] = '\0';
+            if (buffer[start + strspn(buffer + start, " \t")] != '\0') handle_line(connection, buffer + start);
+            start = i + 1;
+        }
+        memmove(buffer, buffer + start, length - start);
+        length -= start;
+        if (length == MAX_LINE) {
+            reply_error(connection, "", "line too long");
+            break;
+        }
+    }
+    free(buffer);
+
+    // Nobody is left to read the answers.
+    mtx_lock(&queue_lock);
+    cancel_requests(connection, NULL, NULL);
+    mtx_unlock(&queue_lock);
+    release(connection);
+    return 0;
+}
+
+void stop_server(int signal) {
+    stopping = 1;
+}
+
+int open_socket(const char* path, int port) {
+    int listener;
+    if (path != NULL) {
+        struct sockaddr_un address = {0};
+        address.sun_family = AF_UNIX;
+        if (strlen(path) >= sizeof(address.sun_path)) return -1;
+        strcpy(address.sun_path, path);
+        unlink(path);
+        listener = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listener < 0 || bind(listener, (struct sockaddr*) &address, sizeof(address)) != 0) return -1;
+    } else {
+        // Only reachable from this machine.
+        struct sockaddr_in address = {0};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        listener = socket(AF_INET, SOCK_STREAM, 0);
+        int reuse = 1;
+        if (listener >= 0) setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        if (listener < 0 || bind(listener, (struct sockaddr*) &address, sizeof(address)) != 0) return -1;
+    }
+    if (listen(listener, 64) != 0) return -1;
+    return listener;
+}
+
+int main(int argc, char** argv) {
+    const char* path = NULL;
+    const char* tablebases = NULL;
+    const char* nnue = NULL;
+    const char* snapshot = NULL;
+    const char* hashfile = NULL;
+    const char* hashshm = NULL;
+    int cache_size = 0;
+    int port = DEFAULT_PORT;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-shared") == 0) {
+            options.shared = true;
+            continue;
+        }
+        if (i + 1 == argc) {
+            fprintf(stderr, "Missing value of %s.\n", argv[i]);
+            return 1;
+        }
+        const char* value = argv[++i];
+        if (strcmp(argv[i - 1], "-socket") == 0) path = value;
+        else if (strcmp(argv[i - 1], "-port") == 0) port = atoi(value);
+        else if (strcmp(argv[i - 1], "-workers") == 0) options.workers = atoi(value);
+        else if (strcmp(argv[i - 1], "-threads") == 0) options.threads = atoi(value);
+        else if (strcmp(argv[i - 1], "-hash") == 0) options.hash = atoi(value);
+        else if (strcmp(argv[i - 1], "-queue") == 0) options.queue = atoi(value);
+        else if (strcmp(argv[i - 1], "-depth") == 0) options.limits.depth = atoi(value);
+        else if (strcmp(argv[i - 1], "-nodes") == 0) options.limits.nodes = strtoull(value, NULL, 10);
+        else if (strcmp(argv[i - 1], "-movetime") == 0) options.limits.milliseconds = strtoull(value, NULL, 10);
+        else if (strcmp(argv[i - 1], "-maxtime") == 0) options.maxtime = strtoull(value, NULL, 10);
+        else if (strcmp(argv[i - 1], "-tablebases") == 0) tablebases = value;
+        else if (strcmp(argv[i - 1], "-nnue") == 0) nnue = value;
+        else if (strcmp(argv[i - 1], "-cache") == 0) cache_size = atoi(value);
+        else if (strcmp(argv[i - 1], "-snapshot") == 0) snapshot = value;
+        else if (strcmp(argv[i - 1], "-hashfile") == 0) hashfile = value;
+        else if (strcmp(argv[i - 1], "-hashshm") == 0) hashshm = value;
+        else {
+            fprintf(stderr, "Unknown option %s.\n", argv[i - 1]);
+            return 1;
+        }
+    }
+    EngineLimits* limits = &options.limits;
+    if (limits->depth == 0 && limits->nodes == 0 && limits->milliseconds == 0) limits->milliseconds = DEFAULT_MOVETIME;
+    if (options.workers < 1) options.workers = 1;
+    if (options.queue < 1) options.queue = 1;
+    if (options.maxtime == 0) options.maxtime = DEFAULT_MAXTIME;
+    // The hash table file is locked by the first engine, the others share its table, and so does a
+    // shared memory segment to keep the workers attached once.
+    if (hashfile != NULL || hashshm != NULL) options.shared = true;
+
+    if (tablebases != NULL) engine_load_tablebases(tablebases);
+    if (nnue != NULL && engine_load_nnue(nnue) != ENGINE_OK) {
+        fprintf(stderr, "Could not load %s.\n", nnue);
+        return 1;
+    }
+
+    if (cache_size > 0) {
+        cache = engine_cache_new(cache_size);
+        if (cache == NULL) {
+            fprintf(stderr, "Out of memory.\n");
+            return 1;
+        }
+        if (snapshot != NULL) {
+            int loaded = engine_cache_load(cache, snapshot);
+            if (loaded >= 0) fprintf(stderr, "Loaded %d results from %s.\n", loaded, snapshot);
+        }
+    }
+
+    int listener = open_socket(path, port);
+    if (listener < 0) {
+        perror("Could not open the socket");
+        return 1;
+    }
+
+    // SIGINT and SIGTERM are blocked before any thread is started, so they are only delivered to the
+    // main thread while it waits for connections below. Without SA_RESTART, so they interrupt the wait.
+    sigset_t stop_signals, waiting;
+    sigemptyset(&stop_signals);
+    sigaddset(&stop_signals, SIGINT);
+    sigaddset(&stop_signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stop_signals, &waiting);
+    struct sigaction action = {0};
+    action.sa_handler = stop_server;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    mtx_init(&queue_lock, mtx_plain);
+    cnd_init(&queue_filled);
+    mtx_init(&connection_lock, mtx_plain);
+    workers = calloc(options.workers, sizeof(Worker));
+    for (int i = 0; i < options.workers; i++) {
+        if (options.shared && i > 0) {
+            workers[i].engine = engine_new_shared(workers[0].engine, options.threads);
+        } else if (hashshm != NULL) {
+            workers[i].engine = engine_new_attached(hashshm, options.hash, options.threads);
+            if (workers[i].engine == NULL) {
+                fprintf(stderr, "Could not attach to %s, or it has another size.\n", hashshm);
+                return 1;
+            }
+        } else if (hashfile != NULL) {
+            workers[i].engine = engine_new_file(hashfile, options.hash, options.threads);
+            if (workers[i].engine == NULL) {
+                fprintf(stderr, "Could not open %s, or it is in use.\n", hashfile);
+                return 1;
+            }
+        } else {
+            workers[i].engine = engine_new(options.hash, options.threads);
+        }
+        if (workers[i].engine == NULL) {
+            fprintf(stderr, "Out of memory.\n");
+            return 1;
+        }
+        engine_set_cache(workers[i].engine, cache);
+        thrd_create(&workers[i].thread, work, &workers[i]);
+    }
+
+    if (path != NULL) fprintf(stderr, "Listening on %s.\n", path);
+    else fprintf(stderr, "Listening on 127.0.0.1:%d.\n", port);
+
+    while (!stopping) {
+        // pselect unblocks the signals only while it waits, so one arriving after stopping was checked
+        // still ends the wait.
+        fd_set ready;
+        FD_ZERO(&ready);
+        FD_SET(listener, &ready);
+        if (pselect(listener + 1, &ready, NULL, NULL, NULL, &waiting) <= 0) continue;
+        int client = accept(listener, NULL, NULL);
+        if (client < 0) continue;
+        Connection* connection = malloc(sizeof(Connection));
+        connection->socket = client;
+        connection->references = 1;
+        mtx_init(&connection->write_lock, mtx_plain);
+        thrd_t thread;
+        thrd_create(&thread, read_connection, connection);
+        thrd_detach(thread);
+    }
+
+    // Running searches are cancelled and the workers joined, so the engines can be freed. That writes
+    // back the hash table file, and detaches from a shared memory segment, which is removed if this
+    // was the last process attached to it.
+    mtx_lock(&queue_lock);
+    for (int i = 0; i < options.workers; i++) {
+        if (workers[i].request != NULL) {
+            workers[i].request->cancelled = true;
+            engine_stop(workers[i].engine);
+        }
+    }
+    cnd_broadcast(&queue_filled);
+    mtx_unlock(&queue_lock);
+    for (int i = 0; i < options.workers; i++) thrd_join(workers[i].thread, NULL);
+    // Engines sharing the hash table of the first are freed before it.
+    for (int i = options.workers - 1; i >= 0; i--) engine_free(workers[i].engine);
+
+    if (cache != NULL && snapshot != NULL) {
+        int saved = engine_cache_save(cache, snapshot);
+        if (saved >= 0) fprintf(stderr, "Saved %d results to %s.\n", saved, snapshot);
+        else fprintf(stderr, "Could not write %s.\n", snapshot);
+    }
+    close(listener);
+    if (path != NULL) unlink(path);
+    return 0;
+}
\ No newline at end of file
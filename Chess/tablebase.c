@@ -0,0 +1,377 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "tablebase.h"
+#include "bitboard.h"
+#include "board.h"
+#include "move.h"
+#include "evaluate.h"
+
+// Loaded tables are found by their material key in an open addressed table, once as they are
+// stored and once with the colors swapped.
+#define TB_SLOTS 1024
+#define TB_MAX_TABLES 512
+
+static const char PIECE_NAMES[] = "KQRBNP";
+static const Piece NAMED_PIECES[] = {KING, QUEEN, ROOK, BISHOP, KNIGHT, PAWN};
+
+typedef struct {
+    TableLayout layout;
+    uint64_t key;
+    const uint8_t* values;
+    const void* mapping;
+    size_t length;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE view;
+#endif
+} Table;
+
+typedef struct {
+    Table* table; // NULL if the slot is empty.
+    uint64_t key;
+    bool swapped; // The first side of the table is black.
+} TableSlot;
+
+int tb_largest = 0;
+
+static Table tables[TB_MAX_TABLES];
+static int n_tables = 0;
+static TableSlot slots[TB_SLOTS];
+
+// Four bits per piece type and color, kings are not counted.
+INLINE uint64_t material_shift(Piece piece, Piece color) {
+    return ((color & 1) * 8 + piece) * 4;
+}
+
+INLINE uint64_t swap_colors(uint64_t key) {
+    return (key >> 32) | (key << 32);
+}
+
+static uint64_t material_key(Board* board) {
+    static const Piece pieces[] = {PAWN, KNIGHT, BISHOP, ROOK, QUEEN};
+    uint64_t key = 0;
+    for (int i = 0; i < 5; i++) {
+        key |= (uint64_t) COUNT(get_pieces(board, pieces[i], WHITE)) << material_shift(pieces[i], WHITE);
+        key |= (uint64_t) COUNT(get_pieces(board, pieces[i], BLACK)) << material_shift(pieces[i], BLACK);
+    }
+    return key;
+}
+
+static TableSlot* find_slot(uint64_t key) {
+    int i = (int) ((key * 0x9e3779b97f4a7c15ULL) >> 54);
+    while (slots[i].table != NULL && slots[i].key != key) {
+        i = (i + 1) & (TB_SLOTS - 1);
+    }
+    return &slots[i];
+}
+
+bool tb_layout(const char* name, TableLayout* layout) {
+    memset(layout, 0, sizeof(TableLayout));
+    const char* split = strchr(name, 'v');
+    if (split == NULL || name[0] != 'K' || split[1] != 'K') return false;
+
+    // Both kings come first, then the other pieces of each side in the order of the name.
+    int n = 2;
+    layout->pieces[0] = layout->pieces[1] = KING;
+    layout->colors[0] = WHITE;
+    layout->colors[1] = BLACK;
+    for (int side = 0; side < 2; side++) {
+        const char* c = side == 0 ? name + 1 : split + 2;
+        int last = 1;
+        for (; *c != '\0' && *c != 'v'; c++) {
+            const char* found = strchr(PIECE_NAMES + 1, *c);
+            if (found == NULL) return false;
+            int kind = (int) (found - PIECE_NAMES);
+            if (kind < last || n == TB_MAX_PIECES) return false;
+            last = kind;
+            layout->pieces[n] = NAMED_PIECES[kind];
+            layout->colors[n++] = side == 0 ? WHITE : BLACK;
+        }
+        if (side == 1 && *c != '\0') return false;
+    }
+
+    layout->n_pieces = n;
+    for (int i = 0; i < n; i++) {
+        layout->has_pawns |= layout->pieces[i] == PAWN;
+    }
+
+    layout->size = layout->has_pawns ? 32 : 10;
+    for (int i = 1; i < n; i++) {
+        layout->size *= layout->pieces[i] == PAWN ? 48 : 64;
+    }
+    layout->size *= 2;
+
+    int length = (int) strlen(name);
+    if (length >= (int) sizeof(layout->name)) length = sizeof(layout->name) - 1;
+    memcpy(layout->name, name, length);
+    return true;
+}
+
+uint64_t tb_index(const TableLayout* layout, const int* squares, bool second_to_move) {
+    int king = squares[0];
+    int flip = 0;
+    if ((king & 7) > 3) flip ^= 7;
+    if (!layout->has_pawns && (king >> 3) > 3) flip ^= 56;
+    king ^= flip;
+    // Without pawns the board can also be flipped along the diagonal, which swaps ranks and files.
+    bool transpose = !layout->has_pawns && (king >> 3) > (king & 7);
+
+    uint64_t index = 0;
+    for (int i = 0; i < layout->n_pieces; i++) {
+        int square = squares[i] ^ flip;
+        if (transpose) square = ((square & 7) << 3) | (square >> 3);
+
+        if (i == 0) {
+            int rank = square >> 3, file = square & 7;
+            // Ranks of the triangle are 4, 3, 2 and 1 squares long.
+            index = layout->has_pawns ? rank * 4 + file : rank * 4 - rank * (rank - 1) / 2 + file - rank;
+        } else if (layout->pieces[i] == PAWN) {
+            index = index * 48 + square - 8;
+        } else {
+            index = index * 64 + square;
+        }
+    }
+    return index * 2 + second_to_move;
+}
+
+static bool map_table(Table* table, const char* path) {
+#ifdef _WIN32
+    table->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (table->file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size;
+    GetFileSizeEx(table->file, &size);
+    table->length = (size_t) size.QuadPart;
+    table->view = CreateFileMappingA(table->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    table->mapping = table->view == NULL ? NULL : MapViewOfFile(table->view, FILE_MAP_READ, 0, 0, 0);
+    if (table->mapping == NULL) {
+        if (table->view != NULL) CloseHandle(table->view);
+        CloseHandle(table->file);
+        return false;
+    }
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    table->length = (size_t) st.st_size;
+    // Shared mappings of the same file use the same pages in every process.
+    void* mapping = mmap(NULL, table->length, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) return false;
+    table->mapping = mapping;
+#endif
+    return true;
+}
+
+static void unmap_table(Table* table) {
+#ifdef _WIN32
+    UnmapViewOfFile(table->mapping);
+    CloseHandle(table->view);
+    CloseHandle(table->file);
+#else
+    munmap((void*) table->mapping, table->length);
+#endif
+}
+
+static uint32_t read32(const uint8_t* data) {
+    return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t) data[3] << 24);
+}
+
+static void load_table(const char* path, const char* name) {
+    if (n_tables == TB_MAX_TABLES) return;
+    Table* table = &tables[n_tables];
+    if (!tb_layout(name, &table->layout)) return;
+
+    char file[1024];
+    snprintf(file, sizeof(file), "%s/%s%s", path, name, TB_EXTENSION);
+    if (!map_table(table, file)) return;
+
+    const uint8_t* header = table->mapping;
+    uint64_t size = table->length < TB_HEADER_SIZE ? 0 : read32(header + 16) | (uint64_t) read32(header + 20) << 32;
+    if (size != table->layout.size || table->length != TB_HEADER_SIZE + size || memcmp(header, "CTBL", 4) != 0 ||
+        read32(header + 4) != TB_VERSION || read32(header + 8) != (uint32_t) table->layout.n_pieces) {
+        fprintf(stderr, "Invalid tablebase file %s.\n", file);
+        unmap_table(table);
+        return;
+    }
+    table->values = header + TB_HEADER_SIZE;
+
+    table->key = 0;
+    for (int i = 2; i < table->layout.n_pieces; i++) {
+        table->key += 1ULL << material_shift(table->layout.pieces[i], table->layout.colors[i]);
+    }
+    // KRvK and KvKR are the same table.
+    if (find_slot(table->key)->table != NULL) {
+        unmap_table(table);
+        return;
+    }
+
+    TableSlot* slot = find_slot(table->key);
+    *slot = (TableSlot) {table, table->key, false};
+    uint64_t swapped = swap_colors(table->key);
+    if (swapped != table->key) {
+        slot = find_slot(swapped);
+        *slot = (TableSlot) {table, swapped, true};
+    }
+
+    if (table->layout.n_pieces > tb_largest) tb_largest = table->layout.n_pieces;
+    n_tables++;
+}
+
+static int side_names(char names[][TB_MAX_PIECES], char* prefix, int length, int first, int n) {
+    prefix[length] = '\0';
+    strcpy(names[n++], prefix);
+    if (length == TB_MAX_PIECES - 2) return n;
+    for (int i = first; i < 6; i++) {
+        prefix[length] = PIECE_NAMES[i];
+        n = side_names(names, prefix, length + 1, i, n);
+    }
+    return n;
+}
+
+int tb_side_names(char names[][TB_MAX_PIECES]) {
+    char prefix[TB_MAX_PIECES];
+    return side_names(names, prefix, 0, 1, 0);
+}
+
+int tb_init(const char* path) {
+    tb_free();
+
+    char names[TB_MAX_SIDES][TB_MAX_PIECES];
+    int n_names = tb_side_names(names);
+
+    // Files are opened by name, which avoids listing the directory in a platform specific way.
+    for (int i = 0; i < n_names; i++) {
+        for (int j = 0; j < n_names; j++) {
+            if (strlen(names[i]) + strlen(names[j]) + 2 > TB_MAX_PIECES) continue;
+            char name[2 * TB_MAX_PIECES];
+            snprintf(name, sizeof(name), "K%svK%s", names[i], names[j]);
+            load_table(path, name);
+        }
+    }
+    return n_tables;
+}
+
+void tb_free() {
+    for (int i = 0; i < n_tables; i++) {
+        unmap_table(&tables[i]);
+    }
+    n_tables = 0;
+    tb_largest = 0;
+    memset(slots, 0, sizeof(slots));
+}
+
+int tb_rank(uint8_t value) {
+    if (value == TB_DRAW) return 0;
+    int plies = value - 1;
+    return (plies & 1) ? 1000 - plies : plies - 1000;
+}
+
+// Value of the position as it is stored, as if no pawn could be taken en passant.
+static uint8_t probe_table(Board* board) {
+    if (n_tables == 0 || can_castle(board)) return TB_ILLEGAL;
+    if (COUNT(get_all_pieces(board)) > tb_largest) return TB_ILLEGAL;
+
+    TableSlot* slot = find_slot(material_key(board));
+    if (slot->table == NULL) return TB_ILLEGAL;
+    const TableLayout* layout = &slot->table->layout;
+
+    // With the colors swapped, the board is also flipped vertically so the pawns of the first side
+    // still move up.
+    Piece first = slot->swapped ? BLACK : WHITE;
+    int flip = slot->swapped ? 56 : 0;
+    int squares[TB_MAX_PIECES];
+    Bitboard taken = 0;
+    for (int i = 0; i < layout->n_pieces; i++) {
+        Piece color = layout->colors[i] == WHITE ? first : OPPOSITE(first);
+        Bitboard pieces = get_pieces(board, layout->pieces[i], color) & ~taken;
+        int square = LSB(pieces);
+        taken |= 1ULL << square;
+        squares[i] = square ^ flip;
+    }
+
+    uint64_t index = tb_index(layout, squares, board->active_color != first);
+    return slot->table->values[index];
+}
+
+uint8_t tb_en_passant(Board* board, uint8_t value) {
+    // Every double push sets the en passant square, it only matters if a pawn can take.
+    Move moves[MAX_MOVES];
+    if (board->en_passant == 0 || gen_pawn_en_passant(board, moves, 0) == 0) return value;
+
+    int n_moves = gen_moves(board, moves);
+    int others = n_moves;
+    uint8_t best = TB_ILLEGAL;
+    const Board copy = *board;
+    for (int i = 0; i < n_moves; i++) {
+        if (!IS_EN_PASSANT(MOVE_FLAGS(moves[i]))) continue;
+        others--;
+        make_move(board, &moves[i]);
+        uint8_t child = probe_table(board);
+        *board = copy; // Undo move.
+
+        if (child == TB_ILLEGAL || child == (TB_MAX_PLIES + 1)) return TB_ILLEGAL;
+        uint8_t before = TB_BEFORE(child);
+        if (best == TB_ILLEGAL || tb_rank(before) > tb_rank(best)) best = before;
+    }
+
+    // Without any other move the stored value is a stalemate or checkmate which is not one.
+    if (best == TB_ILLEGAL) return value;
+    if (others == 0) return best;
+    return tb_rank(best) > tb_rank(value) ? best : value;
+}
+
+uint8_t tb_probe(Board* board) {
+    uint8_t value = probe_table(board);
+    if (value == TB_ILLEGAL) return value;
+    return tb_en_passant(board, value);
+}
+
+bool tb_probe_score(Board* board, int ply, int* score) {
+    uint8_t value = tb_probe(board);
+    if (value == TB_ILLEGAL) return false;
+    if (value == TB_DRAW) {
+        *score = 0;
+        return true;
+    }
+
+    int plies = value - 1;
+    *score = (plies & 1) ? CHECKMATE - ply - plies : -CHECKMATE + ply + plies;
+    return true;
+}
+
+bool tb_probe_root(Board* board, Move* move) {
+    Move moves[MAX_MOVES];
+    int n_moves = gen_moves(board, moves);
+    if (n_moves == 0) return false;
+
+    int best = -CHECKMATE - 1;
+    const Board copy = *board;
+    for (int i = 0; i < n_moves; i++) {
+        make_move(board, &moves[i]);
+        int score;
+        bool found = tb_probe_score(board, 1, &score);
+        *board = copy; // Undo move.
+
+        if (!found) return false;
+        if (-score > best) {
+            best = -score;
+            *move = moves[i];
+        }
+    }
+    return best != 0;
+}
\ No newline at end of file
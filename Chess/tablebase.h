@@ -0,0 +1,94 @@
+#ifndef TABLEBASE_H_
+#define TABLEBASE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "board.h"
+#include "move.h"
+
+// Endgame tablebases, loaded from a directory of files with exact results for every position with
+// a given set of pieces. The files are written by tbgen.
+//
+// Each file covers one material combination and is named after it, white pieces first, in the
+// order KQRBNP: KRvK.ctb, KQPvKQ.ctb. Positions where black has the pieces of the first side are
+// looked up in the same file with the colors swapped. The files are memory mapped read only, so
+// all threads share one copy and the operating system shares the pages with any other engine
+// process probing the same directory.
+//
+// A position is indexed by the pieces of the table in a fixed order: the king of the first side,
+// the king of the second side, then the other pieces of the first and the second side in the order
+// of the name. Every piece is a factor of 64 squares, pawns of 48 (ranks 2 to 7) and the side to
+// move a factor of 2, which is the lowest bit. Symmetry moves the first king onto a tenth of the
+// board for tables without pawns (the triangle H1-E1-E4, by mirroring and flipping along the
+// diagonal, positions with it on the diagonal are stored twice) and onto the files H to E for tables
+// with pawns (by mirroring the files).
+//
+// Each position is stored in one byte: 0 for a draw, TB_ILLEGAL if the position can not occur, or
+// one more than the number of plies to mate. An odd number of plies is a win for the side to move,
+// an even one a loss. Castling is not in the tables and the fifty move rule is ignored. Positions
+// are stored without en passant, tb_probe takes the en passant captures into account on top.
+//
+// Table file, little endian:
+//     char magic[4] = "CTBL"
+//     uint32_t version, pieces
+//     uint32_t reserved
+//     uint64_t size   (number of positions)
+//     uint8_t values[size]
+
+#define TB_VERSION 1
+#define TB_MAX_PIECES 5
+#define TB_MAX_SIDES 64
+#define TB_HEADER_SIZE 24
+#define TB_EXTENSION ".ctb"
+
+#define TB_DRAW 0
+#define TB_ILLEGAL 255
+#define TB_MAX_PLIES 253
+
+// Value of a position whose best move leads to a position with the given value.
+#define TB_BEFORE(x) ((x) == TB_DRAW ? TB_DRAW : (uint8_t) ((x) + 1))
+
+typedef struct {
+    char name[TB_MAX_PIECES + 2];
+    int n_pieces;
+    Piece pieces[TB_MAX_PIECES]; // In index order.
+    Piece colors[TB_MAX_PIECES]; // WHITE for the first side, BLACK for the second.
+    bool has_pawns;
+    uint64_t size;
+} TableLayout;
+
+// Largest number of pieces, kings included, of any loaded table. 0 if none are loaded.
+extern int tb_largest;
+
+// Maps all tables found in the directory and returns their number. Unmaps any tables loaded before,
+// so it must not be called while a search is running.
+int tb_init(const char* path);
+void tb_free();
+
+// Reads a material name like KRPvKR. Returns false if it is not a valid table of at most
+// TB_MAX_PIECES pieces.
+bool tb_layout(const char* name, TableLayout* layout);
+// Every material combination of one side without its king, as piece letters in the order of the
+// names, of up to TB_MAX_PIECES - 2 pieces. Returns their number, at most TB_MAX_SIDES.
+int tb_side_names(char names[][TB_MAX_PIECES]);
+// Index of the position with the given squares, in the order of the layout and from the point of
+// view of the table's colors.
+uint64_t tb_index(const TableLayout* layout, const int* squares, bool second_to_move);
+
+// Orders values from the point of view of the side to move: fast wins, slow wins, draws, slow
+// losses, fast losses.
+int tb_rank(uint8_t value);
+
+// Value of the position, or TB_ILLEGAL if it is not in the loaded tables.
+uint8_t tb_probe(Board* board);
+// Value of the position given the value stored for it, adding the en passant captures if any pawn
+// can take.
+uint8_t tb_en_passant(Board* board, uint8_t value);
+// Search score of the position from the side to move's point of view, with mate scores counted
+// from ply. Returns false if the position is not in the tables.
+bool tb_probe_score(Board* board, int ply, int* score);
+// Move which wins fastest or loses slowest. Returns false if the position is not in the tables or
+// is a draw, in which case searching is better than picking any of the drawing moves.
+bool tb_probe_root(Board* board, Move* move);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "bitboard.h"
+#include "board.h"
+
+// Generates the rook and bishop magic attack tables as const data so they are built into the
+// binary instead of being filled in by init_magic_tables on every startup. The table layout
+// (magics, offsets and indices into the flat tables) comes from magic.c. The Zobrist keys for
+// position_key are generated here as well, from a fixed seed so every build gets the same keys.
+// Usage: tablegen <output file>
+
+// Fills in the attack sets of every square at its index in the flat table. Squares may share entries,
+// so a conflicting write means magic.c is inconsistent.
+bool fill_table(Bitboard* table, const Bitboard* masks, const Bitboard* magics, const int* offsets,
+                const int* indices, bool rook) {
+    for (int i = 0; i < 64; i++) {
+        for (int j = 0; j < (1 << COUNT(masks[i])); j++) {
+            Bitboard blockers = get_blocker(masks[i], j);
+            Bitboard key = MAGIC_KEY(blockers, masks[i], magics[i], offsets[i]);
+            Bitboard attacks = rook ? gen_cardinal_attacks_classical(i, blockers)
+                                    : gen_intercardinal_attacks_classical(i, blockers);
+            Bitboard* entry = &table[indices[i] + key];
+            if (*entry != 0 && *entry != attacks) return false;
+            *entry = attacks;
+        }
+    }
+    return true;
+}
+
+void write_table(FILE* file, const char* name, const Bitboard* table, int size) {
+    fprintf(file, "const Bitboard %s[%d] = {", name, size);
+    for (int i = 0; i < size; i++) {
+        fprintf(file, i % 4 == 0 ? "\n    " : " ");
+        fprintf(file, "0x%llxULL%s", (unsigned long long) table[i], i < size - 1 ? "," : "");
+    }
+    fprintf(file, "\n};\n");
+}
+
+// xorshift64*
+uint64_t random64(uint64_t* state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 0x2545f4914f6cdd1dULL;
+}
+
+void write_keys(FILE* file, const char* name, uint64_t* state, int size, int skip) {
+    fprintf(file, "const uint64_t %s[%d] = {", name, size);
+    for (int i = 0; i < size; i++) {
+        fprintf(file, i % 4 == 0 ? "\n    " : " ");
+        // Skipped entries stand for empty squares and missing en passant squares, which do not change the key.
+        uint64_t key = i < skip ? 0 : random64(state);
+        fprintf(file, "0x%016llxULL%s", (unsigned long long) key, i < size - 1 ? "," : "");
+    }
+    fprintf(file, "\n};\n");
+}
+
+void write_zobrist(FILE* file) {
+    uint64_t state = 0x6a09e667f3bcc908ULL;
+    fprintf(file, "const uint64_t ZOBRIST_PIECES[2][8][64] = {");
+    for (int color = 0; color < 2; color++) {
+        fprintf(file, "%s\n    {", color == 0 ? "" : ",");
+        for (int piece = 0; piece < 8; piece++) {
+            fprintf(file, "%s\n        {", piece == 0 ? "" : ",");
+            for (int i = 0; i < 64; i++) {
+                uint64_t key = piece == EMPTY ? 0 : random64(&state);
+                fprintf(file, "%s0x%016llxULL", i == 0 ? "" : i % 4 == 0 ? ",\n         " : ", ", (unsigned long long) key);
+            }
+            fprintf(file, "}");
+        }
+        fprintf(file, "\n    }");
+    }
+    fprintf(file, "\n};\n\n");
+    write_keys(file, "ZOBRIST_CASTLE", &state, 16, 1);
+    fprintf(file, "\n");
+    write_keys(file, "ZOBRIST_EN_PASSANT", &state, 64, 1);
+    fprintf(file, "\nconst uint64_t ZOBRIST_BLACK = 0x%016llxULL;\n", (unsigned long long) random64(&state));
+}
+
+int main(int argc, char* args[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <output file>\n", args[0]);
+        return 1;
+    }
+
+    Bitboard* rook_table = calloc(ROOK_TABLE_SIZE, sizeof(Bitboard));
+    Bitboard* bishop_table = calloc(BISHOP_TABLE_SIZE, sizeof(Bitboard));
+
+    if (!fill_table(rook_table, ROOK_BLOCKER_MASK, ROOK_MAGIC, ROOK_OFFSET, ROOK_INDEX, true) ||
+        !fill_table(bishop_table, BISHOP_BLOCKER_MASK, BISHOP_MAGIC, BISHOP_OFFSET, BISHOP_INDEX, false)) {
+        fprintf(stderr, "The magic numbers in magic.c produce conflicting attack sets.\n");
+        return 1;
+    }
+
+    FILE* file = fopen(args[1], "w");
+    if (file == NULL) {
+        fprintf(stderr, "Could not open %s for writing.\n", args[1]);
+        return 1;
+    }
+
+    fprintf(file, "// Generated by tablegen. Do not edit.\n\n");
+    fprintf(file, "#include \"bitboard.h\"\n#include \"board.h\"\n\n");
+    write_table(file, "ROOK_TABLE", rook_table, ROOK_TABLE_SIZE);
+    fprintf(file, "\n");
+    write_table(file, "BISHOP_TABLE", bishop_table, BISHOP_TABLE_SIZE);
+    fprintf(file, "\n");
+    write_zobrist(file);
+
+    fclose(file);
+    free(rook_table);
+    free(bishop_table);
+
+    return 0;
+}
\ No newline at end of file
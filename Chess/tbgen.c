@@ -0,0 +1,541 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#endif
+#include "tinycthread.h"
+#include "bitboard.h"
+#include "board.h"
+#include "move.h"
+#include "evaluate.h"
+#include "tablebase.h"
+
+// Generates the endgame tablebases read by tablebase.c, see tablebase.h for the format.
+//
+// Every table is solved by retrograde analysis over its index space. A first pass marks illegal
+// positions, checkmates and stalemates and probes the already generated smaller tables for every
+// capture and promotion, which leave the table. Then for every number of plies d, positions lost
+// in d - 1 plies make all positions one move before them won in d plies, and positions won in
+// d - 1 plies make the positions one move before them candidates for a loss in d plies, which holds
+// if all their moves lose. Positions one move before are found by moving the pieces backwards, so
+// only the candidates have their moves generated. Whatever is left at the end is a draw. Every
+// pass is split over the threads by ranges of the index.
+//
+// Tables are generated with fewer pieces first, and with fewer pawns first among the same number of
+// pieces, so captures and promotions always lead into tables which are already there.
+// Usage: tbgen <directory> <pieces or table, like KRPvKR> [threads]
+
+// A multiple of 8, so every byte of the en passant bits is only written by one thread.
+#define CHUNK_SIZE 65536
+#define MAX_PREDECESSORS 256
+
+// Encoding of the tables: the number of plies to mate plus one, odd plies are wins.
+#define CODE(plies) ((uint8_t) ((plies) + 1))
+#define IS_WIN(x) ((x) != TB_DRAW && (x) != TB_ILLEGAL && (((x) - 1) & 1))
+#define IS_LOSS(x) ((x) != TB_DRAW && (x) != TB_ILLEGAL && !(((x) - 1) & 1))
+
+typedef struct {
+    TableLayout layout;
+    uint8_t* values;
+    // Best result of the captures and promotions of each position, TB_ILLEGAL if it has none.
+    uint8_t* exits;
+    // One bit per position with a double push a pawn can take en passant. The position after it is
+    // not the stored one, so these are not found from the positions after their moves, but looked
+    // at again in every pass.
+    uint8_t* en_passant;
+    int plies; // Number of plies of the current pass.
+} Generation;
+
+static Generation generation;
+static uint64_t next_chunk;
+static mtx_t chunk_lock;
+static bool changed;
+static bool failed;
+static int longest; // Most plies of any result the first pass found.
+
+// Square of the first king for each value of its index.
+static int king_squares[2][32];
+
+long elapsed_ms(struct timespec* start) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (now.tv_sec - start->tv_sec) * 1000 + (now.tv_nsec - start->tv_nsec) / 1000000;
+}
+
+void init_king_squares() {
+    for (int square = 0; square < 64; square++) {
+        int rank = square >> 3, file = square & 7;
+        if (file > 3) continue;
+        int squares[TB_MAX_PIECES] = {square};
+        TableLayout layout = {.n_pieces = 1, .has_pawns = true};
+        king_squares[1][tb_index(&layout, squares, false) / 2] = square;
+        if (rank <= file) {
+            layout.has_pawns = false;
+            king_squares[0][tb_index(&layout, squares, false) / 2] = square;
+        }
+    }
+}
+
+// Inverse of tb_index. Returns true if the second side is to move.
+bool decode(const TableLayout* layout, uint64_t index, int* squares) {
+    bool second_to_move = index & 1;
+    index >>= 1;
+    for (int i = layout->n_pieces - 1; i > 0; i--) {
+        if (layout->pieces[i] == PAWN) {
+            squares[i] = (int) (index % 48) + 8;
+            index /= 48;
+        } else {
+            squares[i] = (int) (index % 64);
+            index /= 64;
+        }
+    }
+    squares[0] = king_squares[layout->has_pawns][index];
+    return second_to_move;
+}
+
+// Returns false if pieces share a square or the side which is not to move is in check.
+bool set_board(const TableLayout* layout, const int* squares, bool second_to_move, Board* board) {
+    board_clear(board);
+    Bitboard occupied = 0;
+    for (int i = 0; i < layout->n_pieces; i++) {
+        if ((occupied >> squares[i]) & 1) return false;
+        occupied |= 1ULL << squares[i];
+        add_piece(board, layout->pieces[i], layout->colors[i], squares[i]);
+    }
+    board->active_color = second_to_move ? BLACK : WHITE;
+    return is_legal(board);
+}
+
+INLINE uint64_t child_index(const TableLayout* layout, const int* squares, bool second_to_move, Move move) {
+    int child[TB_MAX_PIECES];
+    for (int i = 0; i < layout->n_pieces; i++) {
+        child[i] = squares[i] == MOVE_FROM(move) ? MOVE_TO(move) : squares[i];
+    }
+    return tb_index(layout, child, !second_to_move);
+}
+
+// Whether a pawn of the side to move could take a pawn which just moved two squares to this square.
+INLINE bool allows_en_passant(const TableLayout* layout, const int* squares, int to, Piece mover) {
+    for (int i = 0; i < layout->n_pieces; i++) {
+        if (layout->pieces[i] != PAWN || layout->colors[i] == mover || (squares[i] >> 3) != (to >> 3)) continue;
+        if (squares[i] == to - 1 || squares[i] == to + 1) return true;
+    }
+    return false;
+}
+
+// Indices of the positions one move before this one, found by moving the pieces of the side which
+// is not to move backwards. Captures and promotions lead out of the table, so they are not undone.
+int predecessors(const TableLayout* layout, const int* squares, bool second_to_move, uint64_t* indices) {
+    Piece mover = second_to_move ? WHITE : BLACK;
+    Bitboard occupied = 0;
+    for (int i = 0; i < layout->n_pieces; i++) {
+        occupied |= 1ULL << squares[i];
+    }
+
+    int n = 0;
+    int before[TB_MAX_PIECES];
+    memcpy(before, squares, sizeof(before));
+    for (int i = 0; i < layout->n_pieces; i++) {
+        if (layout->colors[i] != mover) continue;
+
+        int to = squares[i];
+        Bitboard from;
+        switch (layout->pieces[i]) {
+            case KING: from = KING_MOVES[to]; break;
+            case KNIGHT: from = KNIGHT_MOVES[to]; break;
+            case BISHOP: from = gen_intercardinal_attacks_magic(to, occupied); break;
+            case ROOK: from = gen_cardinal_attacks_magic(to, occupied); break;
+            case QUEEN: from = gen_cardinal_attacks_magic(to, occupied) | gen_intercardinal_attacks_magic(to, occupied); break;
+            default: {
+                // Pawns of the first side move up, the ones of the second side down. Neither can
+                // come from the first or last rank.
+                int push = mover == WHITE ? -8 : 8;
+                int double_rank = mover == WHITE ? 3 : 4;
+                from = 0;
+                int single = to + push;
+                if (single >= 8 && single < 56 && ((occupied >> single) & 1) == 0) {
+                    from |= 1ULL << single;
+                    if ((to >> 3) == double_rank && ((occupied >> (single + push)) & 1) == 0 &&
+                        !allows_en_passant(layout, squares, to, mover)) {
+                        from |= 1ULL << (single + push);
+                    }
+                }
+            }
+        }
+        from &= ~occupied;
+
+        while (from != 0) {
+            before[i] = LSB(from);
+            indices[n++] = tb_index(layout, before, !second_to_move);
+            // Positions with the first king on the diagonal are also stored flipped along it, and
+            // that copy may only be reached from this position.
+            if (!layout->has_pawns) {
+                int flipped[TB_MAX_PIECES];
+                for (int j = 0; j < layout->n_pieces; j++) {
+                    flipped[j] = ((before[j] & 7) << 3) | (before[j] >> 3);
+                }
+                indices[n++] = tb_index(layout, flipped, !second_to_move);
+            }
+            from &= from - 1;
+        }
+        before[i] = to;
+    }
+    return n;
+}
+
+// Value of the position after a move inside the table, as far as it is known in the pass for
+// plies. After a double push which a pawn can take en passant, unknown positions may still have a
+// known value from the capture.
+uint8_t child_value(const Generation* gen, Board* board, const int* squares, bool second_to_move, Move move, int plies) {
+    uint8_t value = gen->values[child_index(&gen->layout, squares, second_to_move, move)];
+    Piece mover = second_to_move ? BLACK : WHITE;
+    if (!IS_DOUBLE_PUSH(MOVE_FLAGS(move)) || !allows_en_passant(&gen->layout, squares, MOVE_TO(move), mover)) {
+        return value;
+    }
+
+    const Board copy = *board;
+    make_move(board, &move);
+    uint8_t result = tb_en_passant(board, value);
+    *board = copy; // Undo move.
+
+    // Positions still unknown are drawn or lost or won in at least plies - 1 plies, so only a faster
+    // win is certain.
+    if (value == TB_DRAW && IS_WIN(result) && result > CODE(plies - 1)) return TB_DRAW;
+    return result;
+}
+
+// Checks that every move of the position loses within plies - 1 plies, or within plies for the
+// captures and promotions.
+bool all_moves_lose(const Generation* gen, uint64_t index, int plies) {
+    uint8_t exit = gen->exits[index];
+    if (exit != TB_ILLEGAL && (!IS_LOSS(exit) || exit > CODE(plies))) return false;
+
+    int squares[TB_MAX_PIECES];
+    bool second_to_move = decode(&gen->layout, index, squares);
+    Board board;
+    set_board(&gen->layout, squares, second_to_move, &board);
+
+    Move moves[MAX_MOVES];
+    int n_moves = gen_moves(&board, moves);
+    for (int i = 0; i < n_moves; i++) {
+        Flag flags = MOVE_FLAGS(moves[i]);
+        if (IS_CAPTURE(flags) || IS_PROMOTION(flags)) continue;
+        uint8_t child = child_value(gen, &board, squares, second_to_move, moves[i], plies);
+        if (!IS_WIN(child) || child > CODE(plies - 1)) return false;
+    }
+    return true;
+}
+
+// Checks whether a move inside the table leads to a position lost in plies - 1 plies.
+bool any_move_wins(const Generation* gen, uint64_t index, int plies) {
+    int squares[TB_MAX_PIECES];
+    bool second_to_move = decode(&gen->layout, index, squares);
+    Board board;
+    set_board(&gen->layout, squares, second_to_move, &board);
+
+    Move moves[MAX_MOVES];
+    int n_moves = gen_moves(&board, moves);
+    for (int i = 0; i < n_moves; i++) {
+        Flag flags = MOVE_FLAGS(moves[i]);
+        if (IS_CAPTURE(flags) || IS_PROMOTION(flags)) continue;
+        if (child_value(gen, &board, squares, second_to_move, moves[i], plies) == CODE(plies - 1)) return true;
+    }
+    return false;
+}
+
+// Marks illegal positions, checkmates and stalemates, and stores the best result of the moves which
+// leave the table. Positions which have no other moves get that result right away.
+void init_range(Generation* gen, uint64_t start, uint64_t end, int* most) {
+    int squares[TB_MAX_PIECES];
+    Board board;
+    Move moves[MAX_MOVES];
+
+    for (uint64_t index = start; index < end; index++) {
+        bool second_to_move = decode(&gen->layout, index, squares);
+        gen->values[index] = TB_DRAW;
+        gen->exits[index] = TB_ILLEGAL;
+        if (!set_board(&gen->layout, squares, second_to_move, &board)) {
+            gen->values[index] = TB_ILLEGAL;
+            continue;
+        }
+
+        int n_moves = gen_moves(&board, moves);
+        if (n_moves == 0) {
+            if (is_in_check(&board)) gen->values[index] = CODE(0);
+            continue;
+        }
+
+        int inside = 0;
+        uint8_t best = TB_ILLEGAL;
+        const Board copy = board;
+        for (int i = 0; i < n_moves; i++) {
+            Flag flags = MOVE_FLAGS(moves[i]);
+            if (!IS_CAPTURE(flags) && !IS_PROMOTION(flags)) {
+                if (IS_DOUBLE_PUSH(flags) && allows_en_passant(&gen->layout, squares, MOVE_TO(moves[i]), board.active_color)) {
+                    gen->en_passant[index / 8] |= 1 << (index % 8);
+                }
+                inside++;
+                continue;
+            }
+
+            make_move(&board, &moves[i]);
+            uint8_t child = tb_probe(&board);
+            board = copy; // Undo move.
+
+            if (child == TB_ILLEGAL || child == CODE(TB_MAX_PLIES)) {
+                failed = true;
+                return;
+            }
+            uint8_t value = TB_BEFORE(child);
+            if (best == TB_ILLEGAL || tb_rank(value) > tb_rank(best)) best = value;
+        }
+
+        if (best != TB_ILLEGAL && best != TB_DRAW && best - 1 > *most) *most = best - 1;
+        if (inside == 0) {
+            gen->values[index] = best;
+        } else {
+            gen->exits[index] = best;
+        }
+    }
+}
+
+// One pass for the positions won or lost in gen->plies plies.
+void retro_range(Generation* gen, uint64_t start, uint64_t end, bool* found) {
+    int plies = gen->plies;
+    bool wins = plies & 1;
+    int squares[TB_MAX_PIECES];
+    uint64_t before[MAX_PREDECESSORS];
+
+    for (uint64_t index = start; index < end; index++) {
+        uint8_t value = gen->values[index];
+        if (value == TB_DRAW && gen->exits[index] == CODE(plies)) {
+            if (wins || all_moves_lose(gen, index, plies)) {
+                gen->values[index] = CODE(plies);
+                *found = true;
+            }
+        }
+        if (value == TB_DRAW && (gen->en_passant[index / 8] >> (index % 8)) & 1) {
+            if (wins ? any_move_wins(gen, index, plies) : all_moves_lose(gen, index, plies)) {
+                gen->values[index] = CODE(plies);
+                *found = true;
+            }
+        }
+        if (value != CODE(plies - 1)) continue;
+
+        bool second_to_move = decode(&gen->layout, index, squares);
+        int n = predecessors(&gen->layout, squares, second_to_move, before);
+        for (int i = 0; i < n; i++) {
+            if (gen->values[before[i]] != TB_DRAW) continue;
+            if (wins || all_moves_lose(gen, before[i], plies)) {
+                gen->values[before[i]] = CODE(plies);
+                *found = true;
+            }
+        }
+    }
+}
+
+int worker(void* arg) {
+    bool init = (bool) (uintptr_t) arg;
+    bool found = false;
+    int most = 0;
+    while (true) {
+        mtx_lock(&chunk_lock);
+        uint64_t start = next_chunk;
+        next_chunk += CHUNK_SIZE;
+        mtx_unlock(&chunk_lock);
+        if (start >= generation.layout.size) break;
+
+        uint64_t end = start + CHUNK_SIZE < generation.layout.size ? start + CHUNK_SIZE : generation.layout.size;
+        if (init) {
+            init_range(&generation, start, end, &most);
+        } else {
+            retro_range(&generation, start, end, &found);
+        }
+    }
+
+    mtx_lock(&chunk_lock);
+    changed |= found;
+    if (most > longest) longest = most;
+    mtx_unlock(&chunk_lock);
+    return 0;
+}
+
+void run_pass(int n_threads, bool init) {
+    next_chunk = 0;
+    thrd_t* threads = malloc(n_threads * sizeof(thrd_t));
+    for (int i = 0; i < n_threads; i++) {
+        thrd_create(&threads[i], worker, (void*) (uintptr_t) init);
+    }
+    for (int i = 0; i < n_threads; i++) {
+        thrd_join(threads[i], NULL);
+    }
+    free(threads);
+}
+
+bool write_table(const char* directory, Generation* gen) {
+    char path[1024], temporary[1100];
+    snprintf(path, sizeof(path), "%s/%s%s", directory, gen->layout.name, TB_EXTENSION);
+    snprintf(temporary, sizeof(temporary), "%s.tmp", path);
+
+    FILE* file = fopen(temporary, "wb");
+    if (file == NULL) return false;
+
+    uint8_t header[TB_HEADER_SIZE] = {'C', 'T', 'B', 'L'};
+    uint32_t fields[] = {TB_VERSION, gen->layout.n_pieces, 0};
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 4; j++) header[4 + i * 4 + j] = (fields[i] >> (j * 8)) & 0xff;
+    }
+    for (int j = 0; j < 8; j++) header[16 + j] = (gen->layout.size >> (j * 8)) & 0xff;
+
+    bool ok = fwrite(header, 1, TB_HEADER_SIZE, file) == TB_HEADER_SIZE &&
+              fwrite(gen->values, 1, gen->layout.size, file) == gen->layout.size;
+    ok &= fclose(file) == 0;
+    // Tables are only ever loaded complete.
+    remove(path);
+    return ok && rename(temporary, path) == 0;
+}
+
+bool generate(const char* directory, const char* name, int n_threads) {
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+
+    // Captures and promotions are probed in the tables written so far.
+    tb_init(directory);
+
+    Generation* gen = &generation;
+    tb_layout(name, &gen->layout);
+    gen->values = malloc(gen->layout.size);
+    gen->exits = malloc(gen->layout.size);
+    gen->en_passant = calloc(gen->layout.size / 8 + 1, 1);
+    if (gen->values == NULL || gen->exits == NULL || gen->en_passant == NULL) {
+        fprintf(stderr, "Not enough memory for %s.\n", name);
+        return false;
+    }
+
+    failed = false;
+    longest = 0;
+    run_pass(n_threads, true);
+    if (failed) {
+        fprintf(stderr, "%s leads into a missing table or a mate too long to store.\n", name);
+        return false;
+    }
+
+    // Stops once a pass finds nothing and no results from the first pass are still to come.
+    int plies = 1;
+    for (; plies <= TB_MAX_PLIES; plies++) {
+        gen->plies = plies;
+        changed = false;
+        run_pass(n_threads, false);
+        if (!changed && plies > longest) break;
+    }
+    if (plies > TB_MAX_PLIES) {
+        fprintf(stderr, "%s has mates too long to store.\n", name);
+        return false;
+    }
+
+    uint64_t wins = 0, draws = 0, losses = 0;
+    int most = 0;
+    for (uint64_t i = 0; i < gen->layout.size; i++) {
+        uint8_t value = gen->values[i];
+        if (value == TB_ILLEGAL) continue;
+        wins += IS_WIN(value);
+        losses += IS_LOSS(value);
+        draws += value == TB_DRAW;
+        if (value != TB_DRAW && value - 1 > most) most = value - 1;
+    }
+
+    bool ok = write_table(directory, gen);
+    free(gen->values);
+    free(gen->exits);
+    free(gen->en_passant);
+    tb_free();
+    if (!ok) {
+        fprintf(stderr, "Could not write %s.\n", name);
+        return false;
+    }
+
+    printf("%-8s %11llu positions, %11llu wins, %11llu draws, %11llu losses, longest mate %3d plies (%ld ms)\n",
+           name, (unsigned long long) gen->layout.size, (unsigned long long) wins, (unsigned long long) draws,
+           (unsigned long long) losses, most, elapsed_ms(&start));
+    return true;
+}
+
+int side_value(const char* side) {
+    static const char names[] = "QRBNP";
+    static const Piece pieces[] = {QUEEN, ROOK, BISHOP, KNIGHT, PAWN};
+    int value = 0;
+    for (; *side != '\0'; side++) {
+        value += PIECE_VALUES[pieces[strchr(names, *side) - names]];
+    }
+    return value;
+}
+
+int count_pawns(const char* name) {
+    int n = 0;
+    for (; *name != '\0'; name++) n += *name == 'P';
+    return n;
+}
+
+int main(int argc, char* args[]) {
+    if (argc < 3) {
+        fprintf(stderr, "Usage: %s <directory> <pieces or table> [threads]\n", args[0]);
+        return 1;
+    }
+    const char* directory = args[1];
+    int n_threads = argc > 3 ? atoi(args[3]) : 4;
+    if (n_threads < 1) n_threads = 1;
+
+    init_magic_tables();
+    init_king_squares();
+    mtx_init(&chunk_lock, mtx_plain);
+#ifdef _WIN32
+    _mkdir(directory);
+#else
+    mkdir(directory, 0755);
+#endif
+
+    TableLayout layout;
+    if (tb_layout(args[2], &layout)) {
+        return !generate(directory, args[2], n_threads);
+    }
+
+    int pieces = atoi(args[2]);
+    if (pieces < 2 || pieces > TB_MAX_PIECES) {
+        fprintf(stderr, "Tables have 2 to %d pieces.\n", TB_MAX_PIECES);
+        return 1;
+    }
+
+    char sides[TB_MAX_SIDES][TB_MAX_PIECES];
+    int n_sides = tb_side_names(sides);
+
+    // Of a table and the one with the colors swapped only the one with the stronger first side is
+    // generated, tablebase.c looks up both in it.
+    for (int n = 2; n <= pieces; n++) {
+        for (int pawns = 0; pawns <= n - 2; pawns++) {
+            for (int i = 0; i < n_sides; i++) {
+                for (int j = 0; j < n_sides; j++) {
+                    if ((int) (strlen(sides[i]) + strlen(sides[j])) + 2 != n) continue;
+                    if (count_pawns(sides[i]) + count_pawns(sides[j]) != pawns) continue;
+                    int first = side_value(sides[i]), second = side_value(sides[j]);
+                    if (first < second || (first == second && strcmp(sides[i], sides[j]) > 0)) continue;
+
+                    char name[2 * TB_MAX_PIECES];
+                    snprintf(name, sizeof(name), "K%svK%s", sides[i], sides[j]);
+                    char path[1024];
+                    snprintf(path, sizeof(path), "%s/%s%s", directory, name, TB_EXTENSION);
+                    struct stat st;
+                    if (stat(path, &st) == 0) continue;
+                    if (!generate(directory, name, n_threads)) return 1;
+                }
+            }
+        }
+    }
+
+    mtx_destroy(&chunk_lock);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,374 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include "tinycthread.h"
+#include "bitboard.h"
+#include "board.h"
+#include "move.h"
+#include "evaluate.h"
+#include "search.h"
+#include "hashmap.h"
+#include "nnue.h"
+#include "tablebase.h"
+
+// Headless front end speaking the UCI protocol on standard input and output, for tournament
+// managers and analysis GUIs.
+//
+// The main thread reads the commands and every go starts the search on a thread of its own, so stop,
+// ponderhit and isready are answered while it runs. A third thread ends the search once its time is
+// up. Searches in infinite or ponder mode do not send their best move before stop or ponderhit, as
+// the protocol requires.
+//
+// Every search starts from an empty hashmap, unless the HashFile option names a file to keep it in.
+// It is then memory mapped and kept between searches, games and runs, see hashmap_open. The
+// SharedHash option names a shared memory segment instead, like /chess, which engines running in
+// other processes attach to as well, see hashmap_attach.
+// Usage: uci
+
+#define ENGINE_NAME "Chess"
+#define ENGINE_AUTHOR "Alex Eidt"
+#define START_FEN "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+
+#define DEFAULT_HASH 16 // MB
+#define MAX_HASH 65536
+#define DEFAULT_TABLEBASES "tablebases"
+#define DEFAULT_NNUE "nnue.bin"
+// Time kept back on every move for the GUI and the operating system, in milliseconds.
+#define MOVE_OVERHEAD 30
+// Moves left to plan for when the GUI does not say.
+#define DEFAULT_MOVES_TO_GO 30
+#define MAX_COMMAND 65536
+#define MAX_PATH 1024
+
+typedef struct {
+    bool stop; // Ends the search, read by search_position.
+    bool infinite; // Set for go infinite and go ponder, the best move waits for stop or ponderhit.
+    bool finished; // Set once the best move was sent, ends the timer.
+    uint64_t start; // Milliseconds.
+    uint64_t budget; // Milliseconds to search from start, 0 for no limit.
+} SearchControl;
+
+static Board board;
+static HashMap* hashmap;
+static int hash_size = DEFAULT_HASH;
+// Hashmap file of the HashFile option, empty to keep the hashmap in memory.
+static char hash_file[MAX_PATH] = "";
+// Shared memory segment of the SharedHash option, used instead of the file if set.
+static char hash_segment[MAX_PATH] = "";
+static int n_threads = 1;
+
+static SearchControl control;
+static SearchLimits limits;
+static thrd_t search_thread;
+static thrd_t timer_thread;
+static bool searching = false;
+
+static mtx_t output_lock;
+
+// Lines are written whole, the reader and the search thread both write.
+void send_line(const char* format, ...) {
+    mtx_lock(&output_lock);
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+    printf("\n");
+    fflush(stdout);
+    mtx_unlock(&output_lock);
+}
+
+uint64_t now() {
+    struct timespec time;
+    timespec_get(&time, TIME_UTC);
+    return (uint64_t) time.tv_sec * 1000 + time.tv_nsec / 1000000;
+}
+
+// Largest power of two number of entries which fits into the given number of megabytes, mapped from
+// the shared memory segment or the hashmap file if one is set.
+void resize_hash(int megabytes) {
+    int size = 0;
+    while ((sizeof(Item) << (size + 1)) <= (uint64_t) megabytes << 20) size++;
+    if (hashmap != NULL) hashmap_free(hashmap);
+    hashmap = NULL;
+    if (hash_segment[0] != '\0') {
+        hashmap = hashmap_attach(hash_segment, size);
+        if (hashmap == NULL) {
+            send_line("info string could not attach to shared hash %s", hash_segment);
+            hash_segment[0] = '\0';
+        }
+    }
+    if (hashmap == NULL && hash_file[0] != '\0') {
+        hashmap = hashmap_open(hash_file, size);
+        if (hashmap == NULL) {
+            send_line("info string could not open hash file %s", hash_file);
+            hash_file[0] = '\0';
+        }
+    }
+    if (hashmap == NULL) hashmap = hashmap_alloc(size);
+}
+
+void send_info(const SearchReport* report, void* data) {
+    char line[128 + MAX_PV * 6];
+    int length;
+    // Mate scores count plies from the root, UCI counts moves.
+    if (report->score > CHECKMATE - MAX_SEARCH_DEPTH * 2) {
+        length = sprintf(line, "info depth %d score mate %d", report->depth, (CHECKMATE - report->score + 1) / 2);
+    } else if (report->score < -CHECKMATE + MAX_SEARCH_DEPTH * 2) {
+        length = sprintf(line, "info depth %d score mate %d", report->depth, -(CHECKMATE + report->score) / 2);
+    } else {
+        length = sprintf(line, "info depth %d score cp %d", report->depth, report->score);
+    }
+    uint64_t nps = report->nodes * 1000 / (report->milliseconds > 0 ? report->milliseconds : 1);
+    length += sprintf(line + length, " nodes %llu nps %llu time %llu pv", (unsigned long long) report->nodes,
+                      (unsigned long long) nps, (unsigned long long) report->milliseconds);
+    for (int i = 0; i < report->pv_length; i++) {
+        line[length++] = ' ';
+        move_to_string(report->pv[i], line + length);
+        length += strlen(line + length);
+    }
+    send_line("%s", line);
+    // Kept for the expected reply, the hashmap may have lost the line once the search stopped.
+    *(SearchReport*) data = *report;
+}
+
+int search(void* arg) {
+    Board position = board;
+    Move move = NULL_MOVE;
+    bool found;
+    SearchReport last;
+    last.pv_length = 0;
+
+    // Won and lost endings in the tablebases are played from them without searching.
+    if (tb_probe_root(&position, &move)) {
+        found = true;
+        send_line("info depth 0 string tablebase move");
+    } else {
+        found = search_position(&position, hashmap, &limits, &control.stop, send_info, &last, &move);
+    }
+
+    // The best move of an infinite search is only sent once the GUI stops it.
+    struct timespec wait = {0, 1000000};
+    while (control.infinite && !control.stop) thrd_sleep(&wait, NULL);
+
+    char best[6] = "0000";
+    if (found) move_to_string(move, best);
+    // The expected reply is the second move of the line of the last completed iteration, or of the
+    // hashmap for tablebase moves.
+    Move pv[2];
+    char ponder[6];
+    if (last.pv_length >= 2 && last.pv[0] == move) {
+        move_to_string(last.pv[1], ponder);
+        send_line("bestmove %s ponder %s", best, ponder);
+    } else if (found && last.pv_length == 0 && get_pv(&position, hashmap, move, pv, 2) == 2) {
+        move_to_string(pv[1], ponder);
+        send_line("bestmove %s ponder %s", best, ponder);
+    } else {
+        send_line("bestmove %s", best);
+    }
+    control.finished = true;
+    return 0;
+}
+
+int watch_time(void* arg) {
+    struct timespec wait = {0, 1000000};
+    while (!control.finished && !control.stop) {
+        if (!control.infinite && control.budget != 0 && now() - control.start >= control.budget) {
+            control.stop = true;
+            break;
+        }
+        thrd_sleep(&wait, NULL);
+    }
+    return 0;
+}
+
+void stop_search() {
+    if (!searching) return;
+    control.infinite = false;
+    control.stop = true;
+    thrd_join(search_thread, NULL);
+    thrd_join(timer_thread, NULL);
+    searching = false;
+}
+
+// Finds the legal move written in coordinate notation.
+bool parse_move(Board* position, const char* text, Move* move) {
+    Move moves[MAX_MOVES];
+    int n_moves = gen_moves(position, moves);
+    for (int i = 0; i < n_moves; i++) {
+        char name[6];
+        move_to_string(moves[i], name);
+        if (strcmp(name, text) == 0) {
+            *move = moves[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+// position [startpos | fen <fen>] [moves <move>...]
+void set_position(char* command) {
+    char* moves = strstr(command, " moves");
+    if (moves != NULL) *moves = '\0';
+
+    char* fen = strstr(command, "fen ");
+    board_from_fen(&board, fen != NULL ? fen + 4 : START_FEN);
+    if (nnue_enabled) nnue_refresh(&board);
+    if (moves == NULL) return;
+
+    char* token = strtok(moves + 6, " \t");
+    while (token != NULL) {
+        Move move;
+        if (!parse_move(&board, token, &move)) {
+            send_line("info string illegal move %s", token);
+            return;
+        }
+        make_move(&board, &move);
+        token = strtok(NULL, " \t");
+    }
+}
+
+// go [wtime, btime, winc, binc, movestogo, depth, nodes, movetime <n>] [infinite] [ponder]
+void go(char* command) {
+    stop_search();
+
+    int64_t times[2] = {-1, -1}, increments[2] = {0, 0};
+    int64_t moves_to_go = 0, movetime = 0;
+    limits = (SearchLimits) {0, 0, n_threads};
+    control = (SearchControl) {false, false, false, now(), 0};
+
+    char* token = strtok(command + 2, " \t");
+    while (token != NULL) {
+        char* value = strtok(NULL, " \t");
+        int64_t number = value != NULL ? atoll(value) : 0;
+        if (strcmp(token, "wtime") == 0) times[0] = number;
+        else if (strcmp(token, "btime") == 0) times[1] = number;
+        else if (strcmp(token, "winc") == 0) increments[0] = number;
+        else if (strcmp(token, "binc") == 0) increments[1] = number;
+        else if (strcmp(token, "movestogo") == 0) moves_to_go = number;
+        else if (strcmp(token, "depth") == 0) limits.depth = (int) number;
+        else if (strcmp(token, "nodes") == 0) limits.nodes = number;
+        else if (strcmp(token, "movetime") == 0) movetime = number;
+        else {
+            if (strcmp(token, "infinite") == 0 || strcmp(token, "ponder") == 0) control.infinite = true;
+            // Flags take no value.
+            token = value;
+            continue;
+        }
+        token = strtok(NULL, " \t");
+    }
+
+    int side = board.active_color & 1;
+    if (movetime > 0) {
+        control.budget = MAX(movetime - MOVE_OVERHEAD, 1);
+    } else if (times[side] >= 0) {
+        // An even share of the time left, plus most of the increment, never running the clock down.
+        int64_t left = times[side];
+        int64_t moves = moves_to_go > 0 ? moves_to_go : DEFAULT_MOVES_TO_GO;
+        int64_t budget = left / moves + increments[side] * 3 / 4;
+        budget = MIN(budget, left - MOVE_OVERHEAD);
+        control.budget = MAX(budget, 1);
+    }
+
+    // Like select_move, every search starts from an empty hashmap, unless it is kept in a file or
+    // shared with other processes.
+    if (hashmap->file == NULL) hashmap_clear(hashmap);
+    searching = true;
+    thrd_create(&timer_thread, watch_time, NULL);
+    thrd_create(&search_thread, search, NULL);
+}
+
+// setoption name <name> value <value>
+void set_option(char* command) {
+    char* name = strstr(command, "name ");
+    char* value = strstr(command, " value ");
+    if (name == NULL) return;
+    name += 5;
+    if (value != NULL) {
+        *value = '\0';
+        value += 7;
+    }
+
+    if (strcmp(name, "Hash") == 0 && value != NULL) {
+        hash_size = MIN(MAX(atoi(value), 1), MAX_HASH);
+        resize_hash(hash_size);
+    } else if (strcmp(name, "HashFile") == 0) {
+        bool empty = value == NULL || strcmp(value, "<empty>") == 0 || strlen(value) >= MAX_PATH;
+        strcpy(hash_file, empty ? "" : value);
+        resize_hash(hash_size);
+    } else if (strcmp(name, "SharedHash") == 0) {
+        bool empty = value == NULL || strcmp(value, "<empty>") == 0 || strlen(value) >= MAX_PATH;
+        strcpy(hash_segment, empty ? "" : value);
+        resize_hash(hash_size);
+    } else if (strcmp(name, "Threads") == 0 && value != NULL) {
+        n_threads = MIN(MAX(atoi(value), 1), MAX_THREADS);
+    } else if (strcmp(name, "Tablebases") == 0 && value != NULL) {
+        send_line("info string %d tablebases", tb_init(value));
+    } else if (strcmp(name, "Ponder") == 0) {
+        // Nothing to set up, go ponder searches like go infinite.
+    } else if (strcmp(name, "NNUE") == 0 && value != NULL) {
+        bool enable = strcmp(value, "true") == 0 && nnue_load(DEFAULT_NNUE);
+        nnue_enable(enable);
+        if (enable) nnue_refresh(&board);
+    } else {
+        send_line("info string unknown option %s", name);
+    }
+}
+
+int main() {
+    init_magic_tables();
+    mtx_init(&output_lock, mtx_plain);
+    resize_hash(hash_size);
+    tb_init(DEFAULT_TABLEBASES);
+    board_from_fen(&board, START_FEN);
+
+    char* line = malloc(MAX_COMMAND);
+    while (fgets(line, MAX_COMMAND, stdin)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        char* command = line + strspn(line, " \t");
+
+        if (strcmp(command, "uci") == 0) {
+            send_line("id name " ENGINE_NAME);
+            send_line("id author " ENGINE_AUTHOR);
+            send_line("option name Hash type spin default %d min 1 max %d", DEFAULT_HASH, MAX_HASH);
+            send_line("option name HashFile type string default <empty>");
+            send_line("option name SharedHash type string default <empty>");
+            send_line("option name Threads type spin default 1 min 1 max %d", MAX_THREADS);
+            send_line("option name Ponder type check default false");
+            send_line("option name Tablebases type string default " DEFAULT_TABLEBASES);
+            send_line("option name NNUE type check default false");
+            send_line("uciok");
+        } else if (strcmp(command, "isready") == 0) {
+            send_line("readyok");
+        } else if (strcmp(command, "ucinewgame") == 0) {
+            stop_search();
+            if (hashmap->file == NULL) hashmap_clear(hashmap);
+        } else if (strncmp(command, "setoption", 9) == 0) {
+            stop_search();
+            set_option(command);
+        } else if (strncmp(command, "position", 8) == 0) {
+            stop_search();
+            set_position(command);
+        } else if (strncmp(command, "go", 2) == 0) {
+            go(command);
+        } else if (strcmp(command, "stop") == 0) {
+            stop_search();
+        } else if (strcmp(command, "ponderhit") == 0) {
+            // The search goes on with the time of a normal move, counted from now.
+            control.start = now();
+            control.infinite = false;
+        } else if (strcmp(command, "quit") == 0) {
+            break;
+        }
+    }
+
+    stop_search();
+    free(line);
+    hashmap_free(hashmap);
+    tb_free();
+    mtx_destroy(&output_lock);
+    return 0;
+}
\ No newline at end of file
@@ -13,6 +13,9 @@ extern "C" {
 	#include "Chess/move.h"
 	#include "Chess/search.h"
 	#include "Chess/hashmap.h"
+	#include "Chess/nnue.h"
+	#include "Chess/tablebase.h"
+	#include "Chess/polyglot.h"
 }
 
 #define CAPTURE_AUDIO 0
@@ -24,6 +27,13 @@ extern "C" {
 
 #define ENABLE_AI true
 
+// Weights of the neural evaluator. If the file is missing, the classical evaluation is used.
+#define NNUE_FILE "nnue.bin"
+// Endgame tablebases, see Chess/tablebase.h. Searched normally if the directory is missing.
+#define TABLEBASE_DIRECTORY "tablebases"
+// Polyglot opening books, one path per line, probed in that order. See Chess/polyglot.h.
+#define BOOK_LIST "books.txt"
+
 class Chess : public olc::PixelGameEngine {
 public:
 	Chess() {
@@ -146,6 +156,12 @@ public:
 		chessboard = new Board();
 		board_from_fen(chessboard, BOARD_STATE);
 		init_magic_tables();
+		if (nnue_load(NNUE_FILE)) {
+			nnue_enable(true);
+			nnue_refresh(chessboard);
+		}
+		tb_init(TABLEBASE_DIRECTORY);
+		book_init(BOOK_LIST);
 		table = hashmap_alloc(20);
 
 		DrawBoard();
@@ -177,6 +193,11 @@ public:
 			return true;
 		}
 
+		// Switch between the classical and neural evaluators.
+		if (GetKey(olc::Key::N).bPressed && nnue_enable(!nnue_enabled)) {
+			nnue_refresh(chessboard);
+		}
+
 		if (gameOver) {
 			DrawStringDecal({10, 10}, "Game Over", {255, 255, 255}, {4, 4});
 			return true;
@@ -218,7 +239,7 @@ public:
 				Move* selected = nullptr;
 				if (selectedSource != -1) {
 					for (const auto& move : possible_moves[selectedSource]) {
-						if (move->to == index) {
+						if (MOVE_TO(*move) == index) {
 							selected = move;
 							break;
 						}
@@ -262,12 +283,12 @@ public:
 		destinations.clear();
 		for (const auto& move : possible_moves[selectedSource]) {
 			// Check for duplicate destination spots.
-			if (std::find(destinations.begin(), destinations.end(), move->to) != destinations.end()) continue;
-			destinations.push_back(move->to);
+			if (std::find(destinations.begin(), destinations.end(), MOVE_TO(*move)) != destinations.end()) continue;
+			destinations.push_back(MOVE_TO(*move));
 
-			olc::vi2d rf = Itov(move->to);
+			olc::vi2d rf = Itov(MOVE_TO(*move));
 			olc::vi2d center = {rf.x * unit + unit * 3 / 2, rf.y * unit + unit * 3 / 2};
-			if (IS_CAPTURE(move->flags) && !IS_EN_PASSANT(move->flags)) {
+			if (IS_CAPTURE(MOVE_FLAGS(*move)) && !IS_EN_PASSANT(MOVE_FLAGS(*move))) {
 				FillCircle(center, unit / 2.1, {0, 0, 0, 100});
 				FillCircle(center, unit / 2.75, (rf.x + rf.y) % 2 != 0 ? dark : light);
 			} else {
@@ -292,13 +313,13 @@ public:
 
 				if (select_move(&copy, table, &selected)) {
 					make_move(chessboard, &selected);
-					if (IS_CAPTURE(selected.flags) || IS_CASTLE(selected.flags)) {
+					if (IS_CAPTURE(MOVE_FLAGS(selected)) || IS_CASTLE(MOVE_FLAGS(selected))) {
 						olc::SOUND::PlaySample(audio[CAPTURE_AUDIO]);
 					} else {
 						olc::SOUND::PlaySample(audio[MOVE_AUDIO]);
 					}
 					// Highlight the source and destination squares of the most recently made move.
-					olc::vi2d rfs = Itov(selected.from), rfd = Itov(selected.to);
+					olc::vi2d rfs = Itov(MOVE_FROM(selected)), rfd = Itov(MOVE_TO(selected));
 					FillRect({unit * rfs.x + unit, unit * rfs.y + unit}, {unit, unit}, highlightEnemy);
 					FillRect({unit * rfd.x + unit, unit * rfd.y + unit}, {unit, unit}, highlightEnemy);
 				} else {
@@ -327,10 +348,10 @@ public:
 
 		// If the move was a pawn promotion, show the pawn promotion GUI to allow user to select the
 		// piece they want to promote to (Queen, Bishop, Rook, Knight).
-		if (IS_PROMOTION(move->flags)) {
+		if (IS_PROMOTION(MOVE_FLAGS(*move))) {
 			isPromotion = true;
 		} else {
-			if (IS_CAPTURE(move->flags) || IS_CASTLE(move->flags)) {
+			if (IS_CAPTURE(MOVE_FLAGS(*move)) || IS_CASTLE(MOVE_FLAGS(*move))) {
 				olc::SOUND::PlaySample(audio[CAPTURE_AUDIO]);
 			} else {
 				olc::SOUND::PlaySample(audio[MOVE_AUDIO]);
@@ -342,8 +363,8 @@ public:
 	// Once the user selects a piece to promote, make the corresponding move on the board.
 	void HandlePromotion() {
 		for (const auto& move : possible_moves[selectedSource]) {
-			if (move->to == selectedDestination && IS_PROMOTION(move->flags) && PROMOTED_PIECE(move->flags) == promoted) {
-				if (IS_CAPTURE(move->flags)) {
+			if (MOVE_TO(*move) == selectedDestination && IS_PROMOTION(MOVE_FLAGS(*move)) && PROMOTED_PIECE(MOVE_FLAGS(*move)) == promoted) {
+				if (IS_CAPTURE(MOVE_FLAGS(*move))) {
 					olc::SOUND::PlaySample(audio[CAPTURE_AUDIO]);
 				} else {
 					olc::SOUND::PlaySample(audio[MOVE_AUDIO]);
@@ -475,7 +496,7 @@ public:
 
 		for (int i = 0; i < legal; i++) {
 			Move* move = &moves[i];
-			possible_moves[move->from].push_back(move);
+			possible_moves[MOVE_FROM(*move)].push_back(move);
 		}
 	}
 };